@@ -78,3 +78,33 @@ def phq_test(name, srcs, deps = [], **kwargs):
         ],
         **kwargs
     )
+
+def phq_benchmark(name, srcs, deps = [], **kwargs):
+    """
+    C++ benchmark. Part of the Physical Quantities library.
+
+    Benchmarks are tagged as manual so that they are only built when explicitly requested, such as
+    with "bazel run //:benchmark/ConvertInPlace".
+
+    Args:
+      name: Required. Name of the benchmark.
+      srcs: Required. List of source files.
+      deps: Optional. List of dependencies.
+      **kwargs: Additional arguments passed to the native cc_binary rule.
+    """
+    native.cc_binary(
+        name = name,
+        srcs = srcs,
+        deps = deps + ["@google_benchmark//:benchmark_main"],
+        tags = ["manual"],
+        copts = [
+            "-ffast-math",
+            "-O3",
+            "-Wall",
+            "-Wextra",
+            "-Wno-return-type",
+            "-Wpedantic",
+            "-std=c++17",
+        ],
+        **kwargs
+    )
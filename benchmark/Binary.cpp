@@ -0,0 +1,116 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../include/PhQ/Binary.hpp"
+#include "../include/PhQ/Stress.hpp"
+#include "../include/PhQ/Unit/Pressure.hpp"
+
+namespace PhQ {
+
+namespace {
+
+// Returns stresses whose components span several orders of magnitude.
+std::vector<Stress<double>> MakeStresses(const std::size_t size) {
+  std::vector<Stress<double>> stresses;
+  stresses.reserve(size);
+  for (std::size_t index = 0; index < size; ++index) {
+    const double value{1.2345678901234567 * static_cast<double>(index + 1)};
+    stresses.emplace_back(
+        SymmetricDyad<double>{value, -2.0 * value, 0.5 * value, 1000.0 * value, -0.001 * value,
+                              3.0 * value},
+        Unit::Pressure::Pascal);
+  }
+  return stresses;
+}
+
+constexpr std::size_t stresses_size{1 << 16};
+
+// Encodes stresses in their standard unit of measure into a reused buffer.
+void EncodeBinaryStandard(benchmark::State& state) {
+  const std::vector<Stress<double>> stresses{MakeStresses(stresses_size)};
+  std::vector<std::byte> message(BinarySize<Stress<double>>(stresses_size));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(EncodeBinary(stresses.data(), stresses_size, message.data()));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(stresses_size));
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(message.size()));
+}
+
+// Encodes stresses in kilopascals into a reused buffer.
+void EncodeBinaryUnit(benchmark::State& state) {
+  const std::vector<Stress<double>> stresses{MakeStresses(stresses_size)};
+  std::vector<std::byte> message(BinarySize<Stress<double>>(stresses_size));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(EncodeBinary(
+        stresses.data(), stresses_size, message.data(), Unit::Pressure::Kilopascal));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(stresses_size));
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(message.size()));
+}
+
+// Decodes stresses in their standard unit of measure into a reused buffer.
+void DecodeBinaryStandard(benchmark::State& state) {
+  const std::vector<std::byte> message{EncodeBinary(MakeStresses(stresses_size))};
+  std::vector<Stress<double>> stresses(stresses_size, Stress<double>::Zero());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        DecodeBinary(message.data(), message.size(), stresses.data(), stresses_size));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(stresses_size));
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(message.size()));
+}
+
+// Decodes stresses in kilopascals into a reused buffer.
+void DecodeBinaryUnit(benchmark::State& state) {
+  const std::vector<std::byte> message{
+      EncodeBinary(MakeStresses(stresses_size), Unit::Pressure::Kilopascal)};
+  std::vector<Stress<double>> stresses(stresses_size, Stress<double>::Zero());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        DecodeBinary(message.data(), message.size(), stresses.data(), stresses_size));
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(stresses_size));
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(message.size()));
+}
+
+BENCHMARK(EncodeBinaryStandard);
+
+BENCHMARK(EncodeBinaryUnit);
+
+BENCHMARK(DecodeBinaryStandard);
+
+BENCHMARK(DecodeBinaryUnit);
+
+}  // namespace
+
+}  // namespace PhQ
@@ -0,0 +1,143 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../include/PhQ/SymmetricDyad.hpp"
+#include "../include/PhQ/Unit/Length.hpp"
+#include "../include/PhQ/Unit/Pressure.hpp"
+
+namespace PhQ {
+
+namespace {
+
+std::vector<double> MakeValues(const std::size_t size) {
+  std::vector<double> values(size);
+  for (std::size_t index = 0; index < size; ++index) {
+    values[index] = static_cast<double>(index % 1000) * 0.25;
+  }
+  return values;
+}
+
+// Converts a sequence of values back and forth between two units using a given number of threads.
+// The first argument is the number of values and the second argument is the number of threads.
+void ConvertInPlaceThreadCount(benchmark::State& state) {
+  const std::size_t size{static_cast<std::size_t>(state.range(0))};
+  const std::size_t thread_count{static_cast<std::size_t>(state.range(1))};
+  std::vector<double> values{MakeValues(size)};
+  for (auto _ : state) {
+    ConvertInPlace(values, Unit::Length::Foot, Unit::Length::Metre, thread_count);
+    ConvertInPlace(values, Unit::Length::Metre, Unit::Length::Foot, thread_count);
+    benchmark::DoNotOptimize(values.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(2 * size));
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(2 * size * sizeof(double)));
+}
+
+// Converts a sequence of values back and forth between two units using the parallel execution
+// policy. The argument is the number of values.
+void ConvertInPlaceParallel(benchmark::State& state) {
+  const std::size_t size{static_cast<std::size_t>(state.range(0))};
+  std::vector<double> values{MakeValues(size)};
+  for (auto _ : state) {
+    ConvertInPlace(values, Unit::Length::Foot, Unit::Length::Metre, ExecutionPolicy::Parallel);
+    ConvertInPlace(values, Unit::Length::Metre, Unit::Length::Foot, ExecutionPolicy::Parallel);
+    benchmark::DoNotOptimize(values.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(2 * size));
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(2 * size * sizeof(double)));
+}
+
+std::vector<SymmetricDyad<double>> MakeSymmetricDyads(const std::size_t size) {
+  std::vector<SymmetricDyad<double>> symmetric_dyads(size);
+  for (std::size_t index = 0; index < size; ++index) {
+    const double value{static_cast<double>(index % 1000) * 0.25};
+    symmetric_dyads[index] = SymmetricDyad<double>(value, -value, value, -value, value, -value);
+  }
+  return symmetric_dyads;
+}
+
+// Converts a field of symmetric dyadic tensors back and forth between two units one element at a
+// time. The argument is the number of elements.
+void ConvertInPlaceSymmetricDyadsOneByOne(benchmark::State& state) {
+  const std::size_t size{static_cast<std::size_t>(state.range(0))};
+  std::vector<SymmetricDyad<double>> symmetric_dyads{MakeSymmetricDyads(size)};
+  for (auto _ : state) {
+    for (SymmetricDyad<double>& symmetric_dyad : symmetric_dyads) {
+      ConvertInPlace(
+          symmetric_dyad, Unit::Pressure::Kilopascal, Unit::Pressure::PoundPerSquareInch);
+    }
+    for (SymmetricDyad<double>& symmetric_dyad : symmetric_dyads) {
+      ConvertInPlace(
+          symmetric_dyad, Unit::Pressure::PoundPerSquareInch, Unit::Pressure::Kilopascal);
+    }
+    benchmark::DoNotOptimize(symmetric_dyads.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(2 * size));
+}
+
+// Converts a field of symmetric dyadic tensors back and forth between two units in a single pass
+// over all of their components. The argument is the number of elements.
+void ConvertInPlaceSymmetricDyadsField(benchmark::State& state) {
+  const std::size_t size{static_cast<std::size_t>(state.range(0))};
+  std::vector<SymmetricDyad<double>> symmetric_dyads{MakeSymmetricDyads(size)};
+  for (auto _ : state) {
+    ConvertInPlace(symmetric_dyads, Unit::Pressure::Kilopascal, Unit::Pressure::PoundPerSquareInch);
+    ConvertInPlace(symmetric_dyads, Unit::Pressure::PoundPerSquareInch, Unit::Pressure::Kilopascal);
+    benchmark::DoNotOptimize(symmetric_dyads.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(2 * size));
+}
+
+BENCHMARK(ConvertInPlaceThreadCount)
+    ->ArgsProduct({{1 << 12, 1 << 16, 1 << 20, 1 << 24}, {1, 2, 4, 8, 16, 32, 64}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(ConvertInPlaceParallel)
+    ->RangeMultiplier(16)
+    ->Range(1 << 12, 1 << 24)
+    ->UseRealTime()
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(ConvertInPlaceSymmetricDyadsOneByOne)
+    ->RangeMultiplier(16)
+    ->Range(1 << 12, 1 << 20)
+    ->Unit(benchmark::kMicrosecond);
+
+BENCHMARK(ConvertInPlaceSymmetricDyadsField)
+    ->RangeMultiplier(16)
+    ->Range(1 << 12, 1 << 20)
+    ->Unit(benchmark::kMicrosecond);
+
+}  // namespace
+
+}  // namespace PhQ
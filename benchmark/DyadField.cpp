@@ -0,0 +1,200 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "../include/PhQ/Displacement.hpp"
+#include "../include/PhQ/Dyad.hpp"
+#include "../include/PhQ/DyadField.hpp"
+#include "../include/PhQ/Vector.hpp"
+#include "../include/PhQ/VectorField.hpp"
+#include "../include/PhQ/VelocityGradient.hpp"
+
+namespace PhQ {
+
+namespace {
+
+constexpr std::size_t field_size{1 << 16};
+
+// Returns velocity gradients whose components vary from one element to the next.
+std::vector<VelocityGradient<double>> MakeVelocityGradients() {
+  std::vector<VelocityGradient<double>> velocity_gradients;
+  velocity_gradients.reserve(field_size);
+  for (std::size_t index = 0; index < field_size; ++index) {
+    const double value{1.2345678901234567 * static_cast<double>(index + 1)};
+    velocity_gradients.emplace_back(
+        Dyad<double>{value, -0.5 * value, 0.25 * value, 2.0, value, 0.125, -value, 1.0, 3.0},
+        Unit::Frequency::Hertz);
+  }
+  return velocity_gradients;
+}
+
+// Returns displacements whose components vary from one element to the next.
+std::vector<Displacement<double>> MakeDisplacements() {
+  std::vector<Displacement<double>> displacements;
+  displacements.reserve(field_size);
+  for (std::size_t index = 0; index < field_size; ++index) {
+    const double value{1.2345678901234567 * static_cast<double>(index + 1)};
+    displacements.emplace_back(Vector<double>{value, -2.0 * value, 0.5}, Unit::Length::Metre);
+  }
+  return displacements;
+}
+
+void SetItemsProcessed(benchmark::State& state) {
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(field_size));
+}
+
+// Computes the determinants of a std::vector of velocity gradients one element at a time.
+void DeterminantArrayOfStructures(benchmark::State& state) {
+  const std::vector<VelocityGradient<double>> velocity_gradients{MakeVelocityGradients()};
+  std::vector<double> determinants(field_size);
+  for (auto _ : state) {
+    for (std::size_t index = 0; index < field_size; ++index) {
+      determinants[index] = velocity_gradients[index].Value().Determinant();
+    }
+    benchmark::DoNotOptimize(determinants.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the determinants of a dyadic tensor field of velocity gradients.
+void DeterminantStructureOfArrays(benchmark::State& state) {
+  const DyadField<VelocityGradient<double>> velocity_gradients{MakeVelocityGradients()};
+  std::vector<double> determinants(field_size);
+  for (auto _ : state) {
+    velocity_gradients.Determinant(determinants.data());
+    benchmark::DoNotOptimize(determinants.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the inverses of a std::vector of velocity gradients one element at a time.
+void InverseArrayOfStructures(benchmark::State& state) {
+  const std::vector<VelocityGradient<double>> velocity_gradients{MakeVelocityGradients()};
+  std::vector<std::optional<Dyad<double>>> inverses(field_size);
+  for (auto _ : state) {
+    for (std::size_t index = 0; index < field_size; ++index) {
+      inverses[index] = velocity_gradients[index].Value().Inverse();
+    }
+    benchmark::DoNotOptimize(inverses.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the inverses of a dyadic tensor field of velocity gradients with a singular bitmask.
+void InverseStructureOfArrays(benchmark::State& state) {
+  const DyadField<VelocityGradient<double>> velocity_gradients{MakeVelocityGradients()};
+  DyadField<Dyad<double>> inverses(field_size);
+  std::vector<std::uint64_t> singular((field_size + 63) / 64);
+  for (auto _ : state) {
+    velocity_gradients.Inverse(inverses, singular.data());
+    benchmark::DoNotOptimize(inverses.xx());
+    benchmark::DoNotOptimize(singular.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the products of a std::vector of velocity gradients and a std::vector of displacements
+// one element at a time.
+void VectorProductArrayOfStructures(benchmark::State& state) {
+  const std::vector<VelocityGradient<double>> velocity_gradients{MakeVelocityGradients()};
+  const std::vector<Displacement<double>> displacements{MakeDisplacements()};
+  std::vector<Vector<double>> products(field_size);
+  for (auto _ : state) {
+    for (std::size_t index = 0; index < field_size; ++index) {
+      products[index] = velocity_gradients[index].Value() * displacements[index].Value();
+    }
+    benchmark::DoNotOptimize(products.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the products of a dyadic tensor field of velocity gradients and a vector field of
+// displacements.
+void VectorProductStructureOfArrays(benchmark::State& state) {
+  const DyadField<VelocityGradient<double>> velocity_gradients{MakeVelocityGradients()};
+  const VectorField<Displacement<double>> displacements{MakeDisplacements()};
+  VectorField<Vector<double>> products(field_size);
+  for (auto _ : state) {
+    velocity_gradients.Multiply(displacements, products);
+    benchmark::DoNotOptimize(products.x());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the products of pairs of velocity gradients in a std::vector one element at a time.
+void DyadProductArrayOfStructures(benchmark::State& state) {
+  const std::vector<VelocityGradient<double>> velocity_gradients{MakeVelocityGradients()};
+  std::vector<Dyad<double>> products(field_size);
+  for (auto _ : state) {
+    for (std::size_t index = 0; index < field_size; ++index) {
+      products[index] = velocity_gradients[index].Value() * velocity_gradients[index].Value();
+    }
+    benchmark::DoNotOptimize(products.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the products of pairs of velocity gradients in a dyadic tensor field.
+void DyadProductStructureOfArrays(benchmark::State& state) {
+  const DyadField<VelocityGradient<double>> velocity_gradients{MakeVelocityGradients()};
+  DyadField<Dyad<double>> products(field_size);
+  for (auto _ : state) {
+    velocity_gradients.Multiply(velocity_gradients, products);
+    benchmark::DoNotOptimize(products.xx());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+BENCHMARK(DeterminantArrayOfStructures);
+
+BENCHMARK(DeterminantStructureOfArrays);
+
+BENCHMARK(InverseArrayOfStructures);
+
+BENCHMARK(InverseStructureOfArrays);
+
+BENCHMARK(VectorProductArrayOfStructures);
+
+BENCHMARK(VectorProductStructureOfArrays);
+
+BENCHMARK(DyadProductArrayOfStructures);
+
+BENCHMARK(DyadProductStructureOfArrays);
+
+}  // namespace
+
+}  // namespace PhQ
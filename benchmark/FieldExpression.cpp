@@ -0,0 +1,243 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../include/PhQ/Acceleration.hpp"
+#include "../include/PhQ/FieldExpression.hpp"
+#include "../include/PhQ/Position.hpp"
+#include "../include/PhQ/Stress.hpp"
+#include "../include/PhQ/SymmetricDyadField.hpp"
+#include "../include/PhQ/Time.hpp"
+#include "../include/PhQ/Vector.hpp"
+#include "../include/PhQ/VectorField.hpp"
+#include "../include/PhQ/Velocity.hpp"
+
+namespace PhQ {
+
+namespace {
+
+constexpr std::size_t field_size{1 << 16};
+
+const Time<double> time_step{0.001, Unit::Time::Second};
+
+// Returns vectors whose components vary from one element to the next.
+std::vector<Vector<double>> MakeVectors(const double factor) {
+  std::vector<Vector<double>> vectors;
+  vectors.reserve(field_size);
+  for (std::size_t index = 0; index < field_size; ++index) {
+    const double value{factor * static_cast<double>(index + 1)};
+    vectors.emplace_back(value, -0.5 * value, 0.25 * value);
+  }
+  return vectors;
+}
+
+template <typename Quantity, typename Unit>
+std::vector<Quantity> MakeQuantities(const double factor, const Unit unit) {
+  std::vector<Quantity> quantities;
+  quantities.reserve(field_size);
+  for (const Vector<double>& vector : MakeVectors(factor)) {
+    quantities.emplace_back(vector, unit);
+  }
+  return quantities;
+}
+
+std::vector<Position<double>> MakePositions() {
+  return MakeQuantities<Position<double>>(1.2345678901234567, Unit::Length::Metre);
+}
+
+std::vector<Velocity<double>> MakeVelocities() {
+  return MakeQuantities<Velocity<double>>(2.3456789012345678, Unit::Speed::MetrePerSecond);
+}
+
+std::vector<Acceleration<double>> MakeAccelerations() {
+  return MakeQuantities<Acceleration<double>>(
+      3.4567890123456789, Unit::Acceleration::MetrePerSquareSecond);
+}
+
+// Returns stresses whose components vary from one element to the next.
+std::vector<Stress<double>> MakeStresses(const double factor) {
+  std::vector<Stress<double>> stresses;
+  stresses.reserve(field_size);
+  for (std::size_t index = 0; index < field_size; ++index) {
+    const double value{factor * static_cast<double>(index + 1)};
+    stresses.emplace_back(
+        SymmetricDyad<double>{value, -0.5 * value, 0.25 * value, 2.0 * value, 0.125, -value},
+        Unit::Pressure::Pascal);
+  }
+  return stresses;
+}
+
+void SetItemsProcessed(benchmark::State& state) {
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(field_size));
+}
+
+// Computes the positions of particles after a time step from std::vectors of positions,
+// velocities, and accelerations, one element at a time with the eager operators of the physical
+// quantities.
+void KinematicsArrayOfStructures(benchmark::State& state) {
+  const std::vector<Position<double>> positions{MakePositions()};
+  const std::vector<Velocity<double>> velocities{MakeVelocities()};
+  const std::vector<Acceleration<double>> accelerations{MakeAccelerations()};
+  std::vector<Position<double>> results(field_size, Position<double>::Zero());
+  for (auto _ : state) {
+    for (std::size_t index = 0; index < field_size; ++index) {
+      results[index] = positions[index] + velocities[index] * time_step
+                       + 0.5 * accelerations[index] * time_step * time_step;
+    }
+    benchmark::DoNotOptimize(results.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the positions of particles after a time step from vector fields of positions,
+// velocities, and accelerations with the eager operators of the vector fields. These operators
+// only combine fields of the same quantity, so the fields hold plain vectors in standard units.
+void KinematicsEagerFieldOperators(benchmark::State& state) {
+  const VectorField<Vector<double>> positions{MakeVectors(1.2345678901234567)};
+  const VectorField<Vector<double>> velocities{MakeVectors(2.3456789012345678)};
+  const VectorField<Vector<double>> accelerations{MakeVectors(3.4567890123456789)};
+  const double time{time_step.Value()};
+  for (auto _ : state) {
+    const VectorField<Vector<double>> results{
+        positions + velocities * time + accelerations * (0.5 * time * time)};
+    benchmark::DoNotOptimize(results.x());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the positions of particles after a time step from vector fields of positions,
+// velocities, and accelerations with a lazily evaluated expression.
+void KinematicsFieldExpression(benchmark::State& state) {
+  const VectorField<Position<double>> positions{MakePositions()};
+  const VectorField<Velocity<double>> velocities{MakeVelocities()};
+  const VectorField<Acceleration<double>> accelerations{MakeAccelerations()};
+  VectorField<Position<double>> results(field_size);
+  for (auto _ : state) {
+    Evaluate(Lazy(positions) + Lazy(velocities) * time_step
+                 + 0.5 * Lazy(accelerations) * time_step * time_step,
+             results);
+    benchmark::DoNotOptimize(results.x());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Advances a std::vector of positions in place by a time step, one element at a time with the
+// eager operators of the physical quantities.
+void AdvanceInPlaceArrayOfStructures(benchmark::State& state) {
+  std::vector<Position<double>> positions{MakePositions()};
+  const std::vector<Velocity<double>> velocities{MakeVelocities()};
+  for (auto _ : state) {
+    for (std::size_t index = 0; index < field_size; ++index) {
+      positions[index] += velocities[index] * time_step;
+    }
+    benchmark::DoNotOptimize(positions.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Advances a vector field of positions in place by a time step with a lazily evaluated
+// expression.
+void AdvanceInPlaceFieldExpression(benchmark::State& state) {
+  VectorField<Position<double>> positions{MakePositions()};
+  const VectorField<Velocity<double>> velocities{MakeVelocities()};
+  for (auto _ : state) {
+    Evaluate(Lazy(positions) + Lazy(velocities) * time_step, positions);
+    benchmark::DoNotOptimize(positions.x());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Combines three std::vectors of stresses one element at a time with the eager operators of the
+// physical quantities.
+void StressCombinationArrayOfStructures(benchmark::State& state) {
+  const std::vector<Stress<double>> first{MakeStresses(1.2345678901234567)};
+  const std::vector<Stress<double>> second{MakeStresses(2.3456789012345678)};
+  const std::vector<Stress<double>> third{MakeStresses(3.4567890123456789)};
+  std::vector<Stress<double>> results(field_size, Stress<double>::Zero());
+  for (auto _ : state) {
+    for (std::size_t index = 0; index < field_size; ++index) {
+      results[index] = (first[index] + second[index]) * 0.5 - third[index];
+    }
+    benchmark::DoNotOptimize(results.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Combines three symmetric dyadic tensor fields of stresses with the eager operators of the
+// fields.
+void StressCombinationEagerFieldOperators(benchmark::State& state) {
+  const SymmetricDyadField<Stress<double>> first{MakeStresses(1.2345678901234567)};
+  const SymmetricDyadField<Stress<double>> second{MakeStresses(2.3456789012345678)};
+  const SymmetricDyadField<Stress<double>> third{MakeStresses(3.4567890123456789)};
+  for (auto _ : state) {
+    const SymmetricDyadField<Stress<double>> results{(first + second) * 0.5 - third};
+    benchmark::DoNotOptimize(results.xx());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Combines three symmetric dyadic tensor fields of stresses with a lazily evaluated expression.
+void StressCombinationFieldExpression(benchmark::State& state) {
+  const SymmetricDyadField<Stress<double>> first{MakeStresses(1.2345678901234567)};
+  const SymmetricDyadField<Stress<double>> second{MakeStresses(2.3456789012345678)};
+  const SymmetricDyadField<Stress<double>> third{MakeStresses(3.4567890123456789)};
+  SymmetricDyadField<Stress<double>> results(field_size);
+  for (auto _ : state) {
+    Evaluate((Lazy(first) + Lazy(second)) * 0.5 - Lazy(third), results);
+    benchmark::DoNotOptimize(results.xx());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+BENCHMARK(KinematicsArrayOfStructures);
+
+BENCHMARK(KinematicsEagerFieldOperators);
+
+BENCHMARK(KinematicsFieldExpression);
+
+BENCHMARK(AdvanceInPlaceArrayOfStructures);
+
+BENCHMARK(AdvanceInPlaceFieldExpression);
+
+BENCHMARK(StressCombinationArrayOfStructures);
+
+BENCHMARK(StressCombinationEagerFieldOperators);
+
+BENCHMARK(StressCombinationFieldExpression);
+
+}  // namespace
+
+}  // namespace PhQ
@@ -0,0 +1,123 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "../include/PhQ/Base.hpp"
+#include "../include/PhQ/Unit/MemoryRate.hpp"
+#include "../include/PhQ/Unit/SpecificHeatCapacity.hpp"
+#include "../include/PhQ/Unit/VolumeRate.hpp"
+#include "../include/PhQ/UnitSystem.hpp"
+
+namespace PhQ {
+
+namespace {
+
+// Returns the spellings to look up: every spelling of the given enumeration, each followed by a
+// string that is not a spelling, so that half of the lookups miss.
+template <typename Enumeration>
+std::vector<std::string_view> MakeSpellings() {
+  std::vector<std::string_view> spellings;
+  for (const std::pair<std::string_view, Enumeration>& entry : Internal::Spellings<Enumeration>) {
+    spellings.push_back(entry.first);
+    spellings.push_back(entry.first.substr(0, entry.first.size() / 2 + 1).substr(1));
+  }
+  return spellings;
+}
+
+// Looks up spellings in a std::unordered_map, as PhQ::ParseEnumeration did before its tables were
+// made constant expressions.
+template <typename Enumeration>
+void ParseEnumerationUnorderedMap(benchmark::State& state) {
+  const std::unordered_map<std::string_view, Enumeration> map{
+      Internal::Spellings<Enumeration>.cbegin(), Internal::Spellings<Enumeration>.cend()};
+  const std::vector<std::string_view> spellings{MakeSpellings<Enumeration>()};
+  for (auto _ : state) {
+    for (const std::string_view spelling : spellings) {
+      const typename std::unordered_map<std::string_view, Enumeration>::const_iterator found{
+          map.find(spelling)};
+      benchmark::DoNotOptimize(found == map.cend() ? Enumeration{} : found->second);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(spellings.size()));
+}
+
+// Looks up spellings with a binary search in the sorted table of spellings.
+template <typename Enumeration>
+void ParseEnumerationBinarySearch(benchmark::State& state) {
+  const std::vector<std::string_view> spellings{MakeSpellings<Enumeration>()};
+  for (auto _ : state) {
+    for (const std::string_view spelling : spellings) {
+      const std::pair<std::string_view, Enumeration>* const found{
+          Internal::Find(Internal::Spellings<Enumeration>, spelling)};
+      benchmark::DoNotOptimize(found == nullptr ? Enumeration{} : found->second);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(spellings.size()));
+}
+
+// Looks up spellings with PhQ::ParseEnumeration, which uses a compile-time perfect hash index.
+template <typename Enumeration>
+void ParseEnumerationPerfectHash(benchmark::State& state) {
+  const std::vector<std::string_view> spellings{MakeSpellings<Enumeration>()};
+  for (auto _ : state) {
+    for (const std::string_view spelling : spellings) {
+      benchmark::DoNotOptimize(ParseEnumeration<Enumeration>(spelling));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(spellings.size()));
+}
+
+BENCHMARK_TEMPLATE(ParseEnumerationUnorderedMap, UnitSystem);
+
+BENCHMARK_TEMPLATE(ParseEnumerationBinarySearch, UnitSystem);
+
+BENCHMARK_TEMPLATE(ParseEnumerationPerfectHash, UnitSystem);
+
+BENCHMARK_TEMPLATE(ParseEnumerationUnorderedMap, Unit::MemoryRate);
+
+BENCHMARK_TEMPLATE(ParseEnumerationBinarySearch, Unit::MemoryRate);
+
+BENCHMARK_TEMPLATE(ParseEnumerationPerfectHash, Unit::MemoryRate);
+
+BENCHMARK_TEMPLATE(ParseEnumerationUnorderedMap, Unit::VolumeRate);
+
+BENCHMARK_TEMPLATE(ParseEnumerationBinarySearch, Unit::VolumeRate);
+
+BENCHMARK_TEMPLATE(ParseEnumerationPerfectHash, Unit::VolumeRate);
+
+BENCHMARK_TEMPLATE(ParseEnumerationUnorderedMap, Unit::SpecificHeatCapacity);
+
+BENCHMARK_TEMPLATE(ParseEnumerationBinarySearch, Unit::SpecificHeatCapacity);
+
+BENCHMARK_TEMPLATE(ParseEnumerationPerfectHash, Unit::SpecificHeatCapacity);
+
+}  // namespace
+
+}  // namespace PhQ
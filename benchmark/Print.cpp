@@ -0,0 +1,142 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <limits>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../include/PhQ/Base.hpp"
+
+namespace PhQ {
+
+namespace {
+
+// Reference implementation of PhQ::Print based on std::ostringstream, against which the
+// std::to_chars implementation is compared.
+template <typename NumericType>
+std::string PrintStream(const NumericType value) {
+  constexpr int digits{std::numeric_limits<NumericType>::max_digits10};
+  const NumericType absolute{std::abs(value)};
+  std::ostringstream stream;
+  if (absolute == 0.0) {
+    stream << 0;
+  } else if (absolute < 0.001 || absolute >= 10000.0) {
+    stream << std::scientific << std::setprecision(digits) << value;
+  } else if (absolute < 0.01) {
+    stream << std::fixed << std::setprecision(digits + 3) << value;
+  } else if (absolute < 0.1) {
+    stream << std::fixed << std::setprecision(digits + 2) << value;
+  } else if (absolute < 1.0) {
+    stream << std::fixed << std::setprecision(digits + 1) << value;
+  } else if (absolute < 10.0) {
+    stream << std::fixed << std::setprecision(digits) << value;
+  } else if (absolute < 100.0) {
+    stream << std::fixed << std::setprecision(digits - 1) << value;
+  } else if (absolute < 1000.0) {
+    stream << std::fixed << std::setprecision(digits - 2) << value;
+  } else {
+    stream << std::fixed << std::setprecision(digits - 3) << value;
+  }
+  return stream.str();
+}
+
+// Returns values whose magnitudes span every interval of PhQ::Print.
+std::vector<double> MakeValues(const std::size_t size) {
+  std::vector<double> values(size);
+  for (std::size_t index = 0; index < size; ++index) {
+    const double sign{index % 2 == 0 ? 1.0 : -1.0};
+    const double exponent{static_cast<double>(index % 11) - 5.0};
+    values[index] = sign * 1.2345678901234567 * std::pow(10.0, exponent);
+  }
+  return values;
+}
+
+constexpr std::size_t values_size{1024};
+
+// Prints numbers to strings using std::ostringstream.
+void PrintStringStream(benchmark::State& state) {
+  const std::vector<double> values{MakeValues(values_size)};
+  for (auto _ : state) {
+    for (const double value : values) {
+      benchmark::DoNotOptimize(PrintStream(value));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values_size));
+}
+
+// Prints numbers to strings using PhQ::Print.
+void PrintString(benchmark::State& state) {
+  const std::vector<double> values{MakeValues(values_size)};
+  for (auto _ : state) {
+    for (const double value : values) {
+      benchmark::DoNotOptimize(Print(value));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values_size));
+}
+
+// Prints numbers into a caller-supplied buffer using PhQ::Print.
+void PrintBuffer(benchmark::State& state) {
+  const std::vector<double> values{MakeValues(values_size)};
+  char buffer[PrintBufferSize];
+  for (auto _ : state) {
+    for (const double value : values) {
+      benchmark::DoNotOptimize(Print(buffer, buffer + PrintBufferSize, value));
+      benchmark::ClobberMemory();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values_size));
+}
+
+// Prints numbers into a caller-supplied buffer using PhQ::PrintShortest.
+void PrintShortestBuffer(benchmark::State& state) {
+  const std::vector<double> values{MakeValues(values_size)};
+  char buffer[PrintBufferSize];
+  for (auto _ : state) {
+    for (const double value : values) {
+      benchmark::DoNotOptimize(PrintShortest(buffer, buffer + PrintBufferSize, value));
+      benchmark::ClobberMemory();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(values_size));
+}
+
+BENCHMARK(PrintStringStream);
+
+BENCHMARK(PrintString);
+
+BENCHMARK(PrintBuffer);
+
+BENCHMARK(PrintShortestBuffer);
+
+}  // namespace
+
+}  // namespace PhQ
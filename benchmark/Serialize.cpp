@@ -0,0 +1,193 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "../include/PhQ/Parse.hpp"
+#include "../include/PhQ/Stress.hpp"
+#include "../include/PhQ/Unit/Pressure.hpp"
+
+namespace PhQ {
+
+namespace {
+
+// Returns stresses whose components span several orders of magnitude.
+std::vector<Stress<double>> MakeStresses(const std::size_t size) {
+  std::vector<Stress<double>> stresses;
+  stresses.reserve(size);
+  for (std::size_t index = 0; index < size; ++index) {
+    const double value{1.2345678901234567 * static_cast<double>(index + 1)};
+    stresses.emplace_back(
+        SymmetricDyad<double>{value, -2.0 * value, 0.5 * value, 1000.0 * value, -0.001 * value,
+                              3.0 * value},
+        Unit::Pressure::Pascal);
+  }
+  return stresses;
+}
+
+constexpr std::size_t stresses_size{1024};
+
+// Serializes stresses as JSON messages into new strings using PhQ::Stress::JSON.
+void SerializeJSONString(benchmark::State& state) {
+  const std::vector<Stress<double>> stresses{MakeStresses(stresses_size)};
+  for (auto _ : state) {
+    for (const Stress<double>& stress : stresses) {
+      benchmark::DoNotOptimize(stress.JSON());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(stresses_size));
+}
+
+// Serializes stresses as JSON messages into a reused string using PhQ::Stress::AppendJSON.
+void SerializeJSONAppend(benchmark::State& state) {
+  const std::vector<Stress<double>> stresses{MakeStresses(stresses_size)};
+  std::string string;
+  for (auto _ : state) {
+    for (const Stress<double>& stress : stresses) {
+      string.clear();
+      stress.AppendJSON(string);
+      benchmark::DoNotOptimize(string.data());
+      benchmark::ClobberMemory();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(stresses_size));
+}
+
+// Serializes stresses as JSON messages into a fixed-size character buffer using
+// PhQ::Stress::WriteJSON.
+void SerializeJSONWrite(benchmark::State& state) {
+  const std::vector<Stress<double>> stresses{MakeStresses(stresses_size)};
+  char buffer[1024];
+  for (auto _ : state) {
+    for (const Stress<double>& stress : stresses) {
+      benchmark::DoNotOptimize(stress.WriteJSON(buffer));
+      benchmark::ClobberMemory();
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(stresses_size));
+}
+
+// Serializes all stresses as one YAML sequence into a reused string using PhQ::Stress::AppendYAML.
+void SerializeYAMLAppendSequence(benchmark::State& state) {
+  const std::vector<Stress<double>> stresses{MakeStresses(stresses_size)};
+  std::string string;
+  for (auto _ : state) {
+    string.clear();
+    string.push_back('[');
+    for (const Stress<double>& stress : stresses) {
+      stress.AppendYAML(string);
+      string.push_back(',');
+    }
+    string.back() = ']';
+    benchmark::DoNotOptimize(string.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(stresses_size));
+}
+
+// Returns the messages of the given stresses produced by the given serialization member method.
+std::vector<std::string> MakeMessages(const std::vector<Stress<double>>& stresses,
+                                      std::string (Stress<double>::*serialize)() const) {
+  std::vector<std::string> messages;
+  messages.reserve(stresses.size());
+  for (const Stress<double>& stress : stresses) {
+    messages.push_back((stress.*serialize)());
+  }
+  return messages;
+}
+
+// Parses stresses from JSON messages using PhQ::ParseJSON.
+void DeserializeJSON(benchmark::State& state) {
+  const std::vector<std::string> messages{
+      MakeMessages(MakeStresses(stresses_size), &Stress<double>::JSON)};
+  for (auto _ : state) {
+    for (const std::string& message : messages) {
+      benchmark::DoNotOptimize(ParseJSON<Stress<double>>(message));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(stresses_size));
+}
+
+// Parses stresses from XML messages using PhQ::ParseXML.
+void DeserializeXML(benchmark::State& state) {
+  const std::vector<std::string> messages{
+      MakeMessages(MakeStresses(stresses_size), &Stress<double>::XML)};
+  for (auto _ : state) {
+    for (const std::string& message : messages) {
+      benchmark::DoNotOptimize(ParseXML<Stress<double>>(message));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(stresses_size));
+}
+
+// Parses stresses from YAML messages using PhQ::ParseYAML.
+void DeserializeYAML(benchmark::State& state) {
+  const std::vector<std::string> messages{
+      MakeMessages(MakeStresses(stresses_size), &Stress<double>::YAML)};
+  for (auto _ : state) {
+    for (const std::string& message : messages) {
+      benchmark::DoNotOptimize(ParseYAML<Stress<double>>(message));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(stresses_size));
+}
+
+// Serializes stresses as JSON messages into a reused string using PhQ::Stress::AppendJSON and
+// parses them back using PhQ::ParseJSON.
+void RoundTripJSON(benchmark::State& state) {
+  const std::vector<Stress<double>> stresses{MakeStresses(stresses_size)};
+  std::string string;
+  for (auto _ : state) {
+    for (const Stress<double>& stress : stresses) {
+      string.clear();
+      stress.AppendJSON(string);
+      benchmark::DoNotOptimize(ParseJSON<Stress<double>>(string));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(stresses_size));
+}
+
+BENCHMARK(SerializeJSONString);
+
+BENCHMARK(SerializeJSONAppend);
+
+BENCHMARK(SerializeJSONWrite);
+
+BENCHMARK(SerializeYAMLAppendSequence);
+
+BENCHMARK(DeserializeJSON);
+
+BENCHMARK(DeserializeXML);
+
+BENCHMARK(DeserializeYAML);
+
+BENCHMARK(RoundTripJSON);
+
+}  // namespace
+
+}  // namespace PhQ
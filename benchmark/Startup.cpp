@@ -0,0 +1,237 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <spawn.h>
+#include <sys/wait.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+#include <string_view>
+
+#include "../include/PhQ/ConstitutiveModel.hpp"
+#include "../include/PhQ/Unit/Acceleration.hpp"
+#include "../include/PhQ/Unit/Angle.hpp"
+#include "../include/PhQ/Unit/AngularAcceleration.hpp"
+#include "../include/PhQ/Unit/AngularSpeed.hpp"
+#include "../include/PhQ/Unit/Area.hpp"
+#include "../include/PhQ/Unit/Diffusivity.hpp"
+#include "../include/PhQ/Unit/DynamicViscosity.hpp"
+#include "../include/PhQ/Unit/ElectricCharge.hpp"
+#include "../include/PhQ/Unit/ElectricCurrent.hpp"
+#include "../include/PhQ/Unit/Energy.hpp"
+#include "../include/PhQ/Unit/EnergyFlux.hpp"
+#include "../include/PhQ/Unit/Force.hpp"
+#include "../include/PhQ/Unit/Frequency.hpp"
+#include "../include/PhQ/Unit/HeatCapacity.hpp"
+#include "../include/PhQ/Unit/Length.hpp"
+#include "../include/PhQ/Unit/Mass.hpp"
+#include "../include/PhQ/Unit/MassDensity.hpp"
+#include "../include/PhQ/Unit/MassRate.hpp"
+#include "../include/PhQ/Unit/Memory.hpp"
+#include "../include/PhQ/Unit/MemoryRate.hpp"
+#include "../include/PhQ/Unit/Power.hpp"
+#include "../include/PhQ/Unit/Pressure.hpp"
+#include "../include/PhQ/Unit/SolidAngle.hpp"
+#include "../include/PhQ/Unit/SpecificEnergy.hpp"
+#include "../include/PhQ/Unit/SpecificHeatCapacity.hpp"
+#include "../include/PhQ/Unit/SpecificPower.hpp"
+#include "../include/PhQ/Unit/Speed.hpp"
+#include "../include/PhQ/Unit/SubstanceAmount.hpp"
+#include "../include/PhQ/Unit/Temperature.hpp"
+#include "../include/PhQ/Unit/TemperatureDifference.hpp"
+#include "../include/PhQ/Unit/TemperatureGradient.hpp"
+#include "../include/PhQ/Unit/ThermalConductivity.hpp"
+#include "../include/PhQ/Unit/ThermalExpansion.hpp"
+#include "../include/PhQ/Unit/Time.hpp"
+#include "../include/PhQ/Unit/TransportEnergyConsumption.hpp"
+#include "../include/PhQ/Unit/Volume.hpp"
+#include "../include/PhQ/Unit/VolumeRate.hpp"
+#include "../include/PhQ/UnitSystem.hpp"
+
+// This benchmark measures the cost that the Physical Quantities library adds to program startup.
+// The tables of abbreviations, spellings, consistent units, and related unit systems are constant
+// expressions, so they are constant-initialized and no heap allocation occurs before main() even
+// though every table is used below. The global allocation functions are replaced so that heap
+// allocations can be counted.
+
+namespace {
+
+// Number of heap allocations performed so far. This counter is constant-initialized, so it is
+// valid during the dynamic initialization of other objects.
+std::atomic<std::int64_t> allocation_count{0};
+
+// Number of heap allocations performed before main() was entered.
+std::int64_t allocations_before_main{0};
+
+// Path of this executable, used to launch it again as a startup probe.
+const char* executable{nullptr};
+
+// Command-line argument that makes this executable exit immediately as a startup probe.
+constexpr std::string_view startup_probe_argument{"--startup-probe"};
+
+}  // namespace
+
+void* operator new(const std::size_t size) {
+  allocation_count.fetch_add(1, std::memory_order_relaxed);
+  if (void* const pointer = std::malloc(size == 0 ? 1 : size)) {
+    return pointer;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void* const pointer) noexcept {
+  std::free(pointer);
+}
+
+void operator delete(void* const pointer, const std::size_t /*size*/) noexcept {
+  std::free(pointer);
+}
+
+namespace PhQ {
+
+namespace {
+
+// Uses every table of the given enumeration type so that none of them is discarded by the linker.
+template <typename Enumeration>
+void UseTables(const Enumeration enumeration) {
+  benchmark::DoNotOptimize(Abbreviation(enumeration));
+  benchmark::DoNotOptimize(ParseEnumeration<Enumeration>(Abbreviation(enumeration)));
+}
+
+// Uses every table of the given unit type so that none of them is discarded by the linker.
+template <typename Unit>
+void UseUnitTables() {
+  UseTables(Standard<Unit>);
+  benchmark::DoNotOptimize(ConsistentUnit<Unit>(UnitSystem::FootPoundSecondRankine));
+  benchmark::DoNotOptimize(RelatedUnitSystem(Standard<Unit>));
+}
+
+void UseAllTables() {
+  UseTables(UnitSystem::MetreKilogramSecondKelvin);
+  UseTables(ConstitutiveModel::Type::ElasticIsotropicSolid);
+  UseUnitTables<Unit::Acceleration>();
+  UseUnitTables<Unit::Angle>();
+  UseUnitTables<Unit::AngularAcceleration>();
+  UseUnitTables<Unit::AngularSpeed>();
+  UseUnitTables<Unit::Area>();
+  UseUnitTables<Unit::Diffusivity>();
+  UseUnitTables<Unit::DynamicViscosity>();
+  UseUnitTables<Unit::ElectricCharge>();
+  UseUnitTables<Unit::ElectricCurrent>();
+  UseUnitTables<Unit::Energy>();
+  UseUnitTables<Unit::EnergyFlux>();
+  UseUnitTables<Unit::Force>();
+  UseUnitTables<Unit::Frequency>();
+  UseUnitTables<Unit::HeatCapacity>();
+  UseUnitTables<Unit::Length>();
+  UseUnitTables<Unit::Mass>();
+  UseUnitTables<Unit::MassDensity>();
+  UseUnitTables<Unit::MassRate>();
+  UseUnitTables<Unit::Memory>();
+  UseUnitTables<Unit::MemoryRate>();
+  UseUnitTables<Unit::Power>();
+  UseUnitTables<Unit::Pressure>();
+  UseUnitTables<Unit::SolidAngle>();
+  UseUnitTables<Unit::SpecificEnergy>();
+  UseUnitTables<Unit::SpecificHeatCapacity>();
+  UseUnitTables<Unit::SpecificPower>();
+  UseUnitTables<Unit::Speed>();
+  UseUnitTables<Unit::SubstanceAmount>();
+  UseUnitTables<Unit::Temperature>();
+  UseUnitTables<Unit::TemperatureDifference>();
+  UseUnitTables<Unit::TemperatureGradient>();
+  UseUnitTables<Unit::ThermalConductivity>();
+  UseUnitTables<Unit::ThermalExpansion>();
+  UseUnitTables<Unit::Time>();
+  UseUnitTables<Unit::TransportEnergyConsumption>();
+  UseUnitTables<Unit::Volume>();
+  UseUnitTables<Unit::VolumeRate>();
+}
+
+// Reports the number of heap allocations performed before main() was entered. This number is zero
+// when every table is constant-initialized.
+void StartupAllocations(benchmark::State& state) {
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(allocations_before_main);
+  }
+  state.counters["allocations_before_main"] = static_cast<double>(allocations_before_main);
+}
+
+// Launches this executable as a startup probe and waits for it to exit. The probe exits as soon as
+// main() is entered, so this measures the cost of loading the executable and of its static
+// initialization. The exit status of the probe is its number of heap allocations before main().
+void StartupProcess(benchmark::State& state) {
+  char* const arguments[]{
+      const_cast<char*>(executable), const_cast<char*>(startup_probe_argument.data()), nullptr};
+  int probe_allocations{0};
+  for (auto _ : state) {
+    pid_t process;
+    if (posix_spawn(&process, executable, nullptr, nullptr, arguments, nullptr) != 0) {
+      state.SkipWithError("Could not launch the startup probe.");
+      break;
+    }
+    int status{0};
+    waitpid(process, &status, 0);
+    probe_allocations = WIFEXITED(status) ? WEXITSTATUS(status) : -1;
+  }
+  state.counters["allocations_before_main"] = static_cast<double>(probe_allocations);
+}
+
+// Looks up every table once per iteration.
+void StartupTableLookups(benchmark::State& state) {
+  for (auto _ : state) {
+    UseAllTables();
+  }
+}
+
+}  // namespace
+
+}  // namespace PhQ
+
+int main(int argc, char** argv) {
+  allocations_before_main = allocation_count.load(std::memory_order_relaxed);
+  if (argc > 1 && argv[1] == startup_probe_argument) {
+    return static_cast<int>(std::min<std::int64_t>(allocations_before_main, 255));
+  }
+  executable = argv[0];
+
+  benchmark::RegisterBenchmark("StartupAllocations", PhQ::StartupAllocations);
+  benchmark::RegisterBenchmark("StartupProcess", PhQ::StartupProcess)
+      ->UseRealTime()
+      ->Unit(benchmark::kMicrosecond);
+  benchmark::RegisterBenchmark("StartupTableLookups", PhQ::StartupTableLookups);
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+  return 0;
+}
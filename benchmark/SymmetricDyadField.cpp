@@ -0,0 +1,216 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <array>
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../include/PhQ/Direction.hpp"
+#include "../include/PhQ/Stress.hpp"
+#include "../include/PhQ/SymmetricDyadField.hpp"
+#include "../include/PhQ/VectorField.hpp"
+
+namespace PhQ {
+
+namespace {
+
+constexpr std::size_t field_size{1 << 16};
+
+// Returns stresses whose components vary from one element to the next.
+std::vector<Stress<double>> MakeStresses() {
+  std::vector<Stress<double>> stresses;
+  stresses.reserve(field_size);
+  for (std::size_t index = 0; index < field_size; ++index) {
+    const double value{1.2345678901234567 * static_cast<double>(index + 1)};
+    stresses.emplace_back(
+        SymmetricDyad<double>{value, -0.5 * value, 0.25 * value, 2.0 * value, 0.125, -value},
+        Unit::Pressure::Pascal);
+  }
+  return stresses;
+}
+
+void SetItemsProcessed(benchmark::State& state) {
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(field_size));
+}
+
+// Computes the von Mises stresses of a std::vector of stresses one element at a time.
+void VonMisesArrayOfStructures(benchmark::State& state) {
+  const std::vector<Stress<double>> stresses{MakeStresses()};
+  std::vector<ScalarStress<double>> von_mises(field_size, ScalarStress<double>::Zero());
+  for (auto _ : state) {
+    for (std::size_t index = 0; index < field_size; ++index) {
+      von_mises[index] = stresses[index].VonMises();
+    }
+    benchmark::DoNotOptimize(von_mises.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the von Mises stresses of a symmetric dyadic tensor field of stresses.
+void VonMisesStructureOfArrays(benchmark::State& state) {
+  const SymmetricDyadField<Stress<double>> stresses{MakeStresses()};
+  std::vector<ScalarStress<double>> von_mises(field_size, ScalarStress<double>::Zero());
+  for (auto _ : state) {
+    stresses.VonMises(von_mises.data());
+    benchmark::DoNotOptimize(von_mises.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the determinants of a std::vector of stresses one element at a time.
+void DeterminantArrayOfStructures(benchmark::State& state) {
+  const std::vector<Stress<double>> stresses{MakeStresses()};
+  std::vector<double> determinants(field_size);
+  for (auto _ : state) {
+    for (std::size_t index = 0; index < field_size; ++index) {
+      determinants[index] = stresses[index].Value().Determinant();
+    }
+    benchmark::DoNotOptimize(determinants.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the determinants of a symmetric dyadic tensor field of stresses.
+void DeterminantStructureOfArrays(benchmark::State& state) {
+  const SymmetricDyadField<Stress<double>> stresses{MakeStresses()};
+  std::vector<double> determinants(field_size);
+  for (auto _ : state) {
+    stresses.Determinant(determinants.data());
+    benchmark::DoNotOptimize(determinants.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the hydrostatic pressures of a std::vector of stresses one element at a time.
+void HydrostaticPressureArrayOfStructures(benchmark::State& state) {
+  const std::vector<Stress<double>> stresses{MakeStresses()};
+  std::vector<StaticPressure<double>> pressures(field_size, StaticPressure<double>::Zero());
+  for (auto _ : state) {
+    for (std::size_t index = 0; index < field_size; ++index) {
+      pressures[index] =
+          StaticPressure<double>(-stresses[index].Value().Trace() / 3.0, Unit::Pressure::Pascal);
+    }
+    benchmark::DoNotOptimize(pressures.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the hydrostatic pressures of a symmetric dyadic tensor field of stresses.
+void HydrostaticPressureStructureOfArrays(benchmark::State& state) {
+  const SymmetricDyadField<Stress<double>> stresses{MakeStresses()};
+  std::vector<StaticPressure<double>> pressures(field_size, StaticPressure<double>::Zero());
+  for (auto _ : state) {
+    stresses.HydrostaticPressure(pressures.data());
+    benchmark::DoNotOptimize(pressures.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the principal stresses of a std::vector of stresses one element at a time.
+void PrincipalStressesArrayOfStructures(benchmark::State& state) {
+  const std::vector<Stress<double>> stresses{MakeStresses()};
+  std::vector<std::array<ScalarStress<double>, 3>> principal_stresses(field_size);
+  for (auto _ : state) {
+    for (std::size_t index = 0; index < field_size; ++index) {
+      principal_stresses[index] = stresses[index].PrincipalStresses();
+    }
+    benchmark::DoNotOptimize(principal_stresses.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the principal stresses of a symmetric dyadic tensor field of stresses.
+void PrincipalStressesStructureOfArrays(benchmark::State& state) {
+  const SymmetricDyadField<Stress<double>> stresses{MakeStresses()};
+  std::vector<ScalarStress<double>> first(field_size, ScalarStress<double>::Zero());
+  std::vector<ScalarStress<double>> second(field_size, ScalarStress<double>::Zero());
+  std::vector<ScalarStress<double>> third(field_size, ScalarStress<double>::Zero());
+  for (auto _ : state) {
+    stresses.PrincipalValues(first.data(), second.data(), third.data());
+    benchmark::DoNotOptimize(first.data());
+    benchmark::DoNotOptimize(second.data());
+    benchmark::DoNotOptimize(third.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the principal directions of a std::vector of stresses one element at a time.
+void PrincipalDirectionsArrayOfStructures(benchmark::State& state) {
+  const std::vector<Stress<double>> stresses{MakeStresses()};
+  std::vector<std::array<Direction<double>, 3>> principal_directions(field_size);
+  for (auto _ : state) {
+    for (std::size_t index = 0; index < field_size; ++index) {
+      principal_directions[index] = stresses[index].PrincipalDirections();
+    }
+    benchmark::DoNotOptimize(principal_directions.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the principal directions of a symmetric dyadic tensor field of stresses.
+void PrincipalDirectionsStructureOfArrays(benchmark::State& state) {
+  const SymmetricDyadField<Stress<double>> stresses{MakeStresses()};
+  for (auto _ : state) {
+    std::array<VectorField<Direction<double>>, 3> principal_directions{
+        stresses.PrincipalDirections()};
+    benchmark::DoNotOptimize(principal_directions[0].x());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+BENCHMARK(VonMisesArrayOfStructures);
+
+BENCHMARK(VonMisesStructureOfArrays);
+
+BENCHMARK(DeterminantArrayOfStructures);
+
+BENCHMARK(DeterminantStructureOfArrays);
+
+BENCHMARK(HydrostaticPressureArrayOfStructures);
+
+BENCHMARK(HydrostaticPressureStructureOfArrays);
+
+BENCHMARK(PrincipalStressesArrayOfStructures);
+
+BENCHMARK(PrincipalStressesStructureOfArrays);
+
+BENCHMARK(PrincipalDirectionsArrayOfStructures);
+
+BENCHMARK(PrincipalDirectionsStructureOfArrays);
+
+}  // namespace
+
+}  // namespace PhQ
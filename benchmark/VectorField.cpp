@@ -0,0 +1,175 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../include/PhQ/Velocity.hpp"
+#include "../include/PhQ/VectorField.hpp"
+
+namespace PhQ {
+
+namespace {
+
+constexpr std::size_t field_size{1 << 16};
+
+// Returns velocities whose components vary from one element to the next.
+std::vector<Velocity<double>> MakeVelocities() {
+  std::vector<Velocity<double>> velocities;
+  velocities.reserve(field_size);
+  for (std::size_t index = 0; index < field_size; ++index) {
+    const double value{1.2345678901234567 * static_cast<double>(index + 1)};
+    velocities.emplace_back(
+        Vector<double>{value, -0.5 * value, 2.0 * value}, Unit::Speed::MetrePerSecond);
+  }
+  return velocities;
+}
+
+void SetItemsProcessed(benchmark::State& state) {
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(field_size));
+}
+
+// Computes the magnitudes of a std::vector of velocities one element at a time.
+void MagnitudeArrayOfStructures(benchmark::State& state) {
+  const std::vector<Velocity<double>> velocities{MakeVelocities()};
+  std::vector<Speed<double>> speeds(field_size, Speed<double>::Zero());
+  for (auto _ : state) {
+    for (std::size_t index = 0; index < field_size; ++index) {
+      speeds[index] = velocities[index].Magnitude();
+    }
+    benchmark::DoNotOptimize(speeds.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the magnitudes of a vector field of velocities.
+void MagnitudeStructureOfArrays(benchmark::State& state) {
+  const VectorField<Velocity<double>> velocities{MakeVelocities()};
+  std::vector<Speed<double>> speeds(field_size, Speed<double>::Zero());
+  for (auto _ : state) {
+    velocities.Magnitude(speeds.data());
+    benchmark::DoNotOptimize(speeds.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the dot products of two std::vectors of velocities one element at a time.
+void DotArrayOfStructures(benchmark::State& state) {
+  const std::vector<Velocity<double>> velocities{MakeVelocities()};
+  std::vector<double> products(field_size);
+  for (auto _ : state) {
+    for (std::size_t index = 0; index < field_size; ++index) {
+      products[index] = velocities[index].Value().Dot(velocities[index].Value());
+    }
+    benchmark::DoNotOptimize(products.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the dot products of two vector fields of velocities.
+void DotStructureOfArrays(benchmark::State& state) {
+  const VectorField<Velocity<double>> velocities{MakeVelocities()};
+  std::vector<double> products(field_size);
+  for (auto _ : state) {
+    velocities.Dot(velocities, products.data());
+    benchmark::DoNotOptimize(products.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the directions of a std::vector of velocities one element at a time.
+void DirectionArrayOfStructures(benchmark::State& state) {
+  const std::vector<Velocity<double>> velocities{MakeVelocities()};
+  std::vector<Direction<double>> directions(field_size);
+  for (auto _ : state) {
+    for (std::size_t index = 0; index < field_size; ++index) {
+      directions[index] = velocities[index].Direction();
+    }
+    benchmark::DoNotOptimize(directions.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Computes the directions of a vector field of velocities.
+void DirectionStructureOfArrays(benchmark::State& state) {
+  const VectorField<Velocity<double>> velocities{MakeVelocities()};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(velocities.Direction());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Adds a scaled std::vector of velocities to another one element at a time.
+void AddScaledArrayOfStructures(benchmark::State& state) {
+  std::vector<Velocity<double>> velocities{MakeVelocities()};
+  const std::vector<Velocity<double>> others{MakeVelocities()};
+  for (auto _ : state) {
+    for (std::size_t index = 0; index < field_size; ++index) {
+      velocities[index] += others[index] * 1.0e-6;
+    }
+    benchmark::DoNotOptimize(velocities.data());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+// Adds a scaled vector field of velocities to another one.
+void AddScaledStructureOfArrays(benchmark::State& state) {
+  VectorField<Velocity<double>> velocities{MakeVelocities()};
+  const VectorField<Velocity<double>> others{MakeVelocities()};
+  for (auto _ : state) {
+    velocities.AddScaled(1.0e-6, others);
+    benchmark::DoNotOptimize(velocities.x());
+    benchmark::ClobberMemory();
+  }
+  SetItemsProcessed(state);
+}
+
+BENCHMARK(MagnitudeArrayOfStructures);
+
+BENCHMARK(MagnitudeStructureOfArrays);
+
+BENCHMARK(DotArrayOfStructures);
+
+BENCHMARK(DotStructureOfArrays);
+
+BENCHMARK(DirectionArrayOfStructures);
+
+BENCHMARK(DirectionStructureOfArrays);
+
+BENCHMARK(AddScaledArrayOfStructures);
+
+BENCHMARK(AddScaledStructureOfArrays);
+
+}  // namespace
+
+}  // namespace PhQ
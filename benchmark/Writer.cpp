@@ -0,0 +1,143 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include <benchmark/benchmark.h>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <streambuf>
+#include <vector>
+
+#include "../include/PhQ/Stress.hpp"
+#include "../include/PhQ/Unit/Pressure.hpp"
+#include "../include/PhQ/Writer.hpp"
+
+namespace PhQ {
+
+namespace {
+
+// Stream buffer that discards all characters, so that the benchmarks measure only serialization.
+class NullStreamBuffer : public std::streambuf {
+protected:
+  std::streamsize xsputn(const char* /*characters*/, const std::streamsize count) override {
+    return count;
+  }
+
+  int overflow(const int character) override {
+    return character;
+  }
+};
+
+// Returns stresses whose components span several orders of magnitude.
+std::vector<Stress<double>> MakeStresses(const std::size_t size) {
+  std::vector<Stress<double>> stresses;
+  stresses.reserve(size);
+  for (std::size_t index = 0; index < size; ++index) {
+    const double value{1.2345678901234567 * static_cast<double>(index + 1)};
+    stresses.emplace_back(
+        SymmetricDyad<double>{value, -2.0 * value, 0.5 * value, 1000.0 * value, -0.001 * value,
+                              3.0 * value},
+        Unit::Pressure::Pascal);
+  }
+  return stresses;
+}
+
+constexpr std::size_t stresses_size{1 << 14};
+
+// Streams stresses as newline-delimited JSON by calling PhQ::Stress::JSON for each element.
+void WriteNDJSONPerElement(benchmark::State& state) {
+  const std::vector<Stress<double>> stresses{MakeStresses(stresses_size)};
+  NullStreamBuffer buffer;
+  std::ostream stream{&buffer};
+  for (auto _ : state) {
+    for (const Stress<double>& stress : stresses) {
+      stream << stress.JSON() << '\n';
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(stresses_size));
+}
+
+// Streams stresses as newline-delimited JSON with PhQ::Writer.
+void WriteNDJSONWriter(benchmark::State& state) {
+  const std::vector<Stress<double>> stresses{MakeStresses(stresses_size)};
+  NullStreamBuffer buffer;
+  std::ostream stream{&buffer};
+  for (auto _ : state) {
+    Writer<Stress<double>> writer{stream, WriterFormat::NDJSON};
+    writer.Write(stresses);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(stresses_size));
+}
+
+// Streams stresses as newline-delimited JSON in kilopascals by calling PhQ::Stress::JSON for each
+// element.
+void WriteNDJSONUnitPerElement(benchmark::State& state) {
+  const std::vector<Stress<double>> stresses{MakeStresses(stresses_size)};
+  NullStreamBuffer buffer;
+  std::ostream stream{&buffer};
+  for (auto _ : state) {
+    for (const Stress<double>& stress : stresses) {
+      stream << stress.JSON(Unit::Pressure::Kilopascal) << '\n';
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(stresses_size));
+}
+
+// Streams stresses as newline-delimited JSON in kilopascals with PhQ::Writer.
+void WriteNDJSONUnitWriter(benchmark::State& state) {
+  const std::vector<Stress<double>> stresses{MakeStresses(stresses_size)};
+  NullStreamBuffer buffer;
+  std::ostream stream{&buffer};
+  for (auto _ : state) {
+    Writer<Stress<double>> writer{stream, WriterFormat::NDJSON, Unit::Pressure::Kilopascal};
+    writer.Write(stresses);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(stresses_size));
+}
+
+// Streams stresses as comma-separated values with PhQ::Writer.
+void WriteCSVWriter(benchmark::State& state) {
+  const std::vector<Stress<double>> stresses{MakeStresses(stresses_size)};
+  NullStreamBuffer buffer;
+  std::ostream stream{&buffer};
+  for (auto _ : state) {
+    Writer<Stress<double>> writer{stream, WriterFormat::CSV};
+    writer.Write(stresses);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(stresses_size));
+}
+
+BENCHMARK(WriteNDJSONPerElement);
+
+BENCHMARK(WriteNDJSONWriter);
+
+BENCHMARK(WriteNDJSONUnitPerElement);
+
+BENCHMARK(WriteNDJSONUnitWriter);
+
+BENCHMARK(WriteCSVWriter);
+
+}  // namespace
+
+}  // namespace PhQ
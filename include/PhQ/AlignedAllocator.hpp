@@ -0,0 +1,85 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_ALIGNED_ALLOCATOR_HPP
+#define PHQ_ALIGNED_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace PhQ {
+
+namespace Internal {
+
+/// \brief Alignment in bytes of the component arrays of field containers. This is the size of a
+/// cache line and of the widest SIMD register on current processors, so that vectorized loops over
+/// a component array never split a load across two cache lines. Internal implementation detail not
+/// intended to be used outside of the Physical Quantities library's field containers.
+inline constexpr std::size_t FieldAlignment{64};
+
+/// \brief Standard-conforming allocator whose allocations are aligned to FieldAlignment bytes.
+/// Internal implementation detail not intended to be used outside of the Physical Quantities
+/// library's field containers.
+template <typename Type>
+class AlignedAllocator {
+public:
+  using value_type = Type;
+
+  constexpr AlignedAllocator() noexcept = default;
+
+  template <typename OtherType>
+  constexpr AlignedAllocator(const AlignedAllocator<OtherType>& /*other*/) noexcept {}
+
+  [[nodiscard]] Type* allocate(const std::size_t size) {
+    return static_cast<Type*>(
+        ::operator new(size * sizeof(Type), std::align_val_t{FieldAlignment}));
+  }
+
+  void deallocate(Type* const pointer, const std::size_t /*size*/) noexcept {
+    ::operator delete(pointer, std::align_val_t{FieldAlignment});
+  }
+
+  template <typename OtherType>
+  constexpr bool operator==(const AlignedAllocator<OtherType>& /*other*/) const noexcept {
+    return true;
+  }
+
+  template <typename OtherType>
+  constexpr bool operator!=(const AlignedAllocator<OtherType>& /*other*/) const noexcept {
+    return false;
+  }
+};
+
+/// \brief Contiguous array of values whose storage is aligned to FieldAlignment bytes.
+/// Internal implementation detail not intended to be used outside of the Physical Quantities
+/// library's field containers.
+template <typename Type>
+using AlignedVector = std::vector<Type, AlignedAllocator<Type>>;
+
+}  // namespace Internal
+
+}  // namespace PhQ
+
+#endif  // PHQ_ALIGNED_ALLOCATOR_HPP
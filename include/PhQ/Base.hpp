@@ -26,23 +26,56 @@
 #define PHQ_BASE_HPP
 
 #include <algorithm>
+#include <array>
+#include <cctype>
+#include <cerrno>
+#include <charconv>
 #include <climits>
 #include <cmath>
 #include <cstddef>
 #include <cstdint>
-#include <iomanip>
+#include <cstdio>
+#include <cstdlib>
 #include <iterator>
 #include <limits>
-#include <map>
 #include <optional>
-#include <sstream>
 #include <string>
 #include <string_view>
+#include <system_error>
 #include <type_traits>
-#include <unordered_map>
 #include <utility>
 #include <vector>
 
+// Forces a kernel, or a function called within a kernel's loop, to be inlined into its caller so
+// that it is compiled for the caller's instruction set and vectorized with the caller's loop. See
+// PhQ::Internal::RunKernel.
+#if defined(__GNUC__) || defined(__clang__)
+  #define PHQ_ALWAYS_INLINE __attribute__((always_inline))
+#else
+  #define PHQ_ALWAYS_INLINE
+#endif
+
+// Promises that a pointer parameter of a kernel does not alias any other pointer parameter, so that
+// the compiler vectorizes the kernel's loop without runtime overlap checks.
+#if defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+  #define PHQ_RESTRICT __restrict
+#else
+  #define PHQ_RESTRICT
+#endif
+
+// Whether the standard library implements std::to_chars and std::from_chars for all floating-point
+// types, which GCC's libstdc++ does since GCC 11 and Microsoft's STL does. LLVM's libc++ does not
+// implement them for long double. Otherwise, PhQ::Print and PhQ::PrintShortest fall back to the C
+// library's std::snprintf function and PhQ::ParseNumber falls back to its std::strtod function,
+// which use the decimal point of the current C locale. Define this as 0 to force the fallback.
+#ifndef PHQ_FLOATING_POINT_CHARCONV
+  #if defined(__cpp_lib_to_chars) && !defined(_LIBCPP_VERSION)
+    #define PHQ_FLOATING_POINT_CHARCONV 1
+  #else
+    #define PHQ_FLOATING_POINT_CHARCONV 0
+  #endif
+#endif
+
 /// \brief Namespace that encompasses all of the Physical Quantities library's content.
 namespace PhQ {
 
@@ -76,27 +109,263 @@ namespace Dimension {}
 /// Quantities library's own functions and classes.
 namespace Internal {
 
-/// \brief Map of enumerations to their corresponding abbreviations. This is an internal
-/// implementation detail and is not intended to be used except by the PhQ::Abbreviation function.
+/// \brief Returns whether the given table of key-value pairs is sorted by key in strictly
+/// increasing order. Tables searched by PhQ::Internal::Find must satisfy this requirement. This is
+/// an internal implementation detail and is not intended to be used outside of the Physical
+/// Quantities library.
+template <typename Key, typename Value, std::size_t Size>
+[[nodiscard]] inline constexpr bool IsSortedByKey(
+    const std::array<std::pair<Key, Value>, Size>& table) {
+  for (std::size_t index = 1; index < Size; ++index) {
+    if (!(table[index - 1].first < table[index].first)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// \brief Searches the given table of key-value pairs, which must be sorted by key, for the given
+/// key using a binary search. Returns a pointer to the matching key-value pair, or a null pointer
+/// if the table does not contain the given key. This is an internal implementation detail and is
+/// not intended to be used outside of the Physical Quantities library.
+template <typename Key, typename Value, std::size_t Size>
+[[nodiscard]] inline constexpr const std::pair<Key, Value>* Find(
+    const std::array<std::pair<Key, Value>, Size>& table, const Key& key) {
+  std::size_t low{0};
+  std::size_t high{Size};
+  while (low < high) {
+    const std::size_t middle{low + (high - low) / 2};
+    if (table[middle].first < key) {
+      low = middle + 1;
+    } else {
+      high = middle;
+    }
+  }
+  if (low < Size && table[low].first == key) {
+    return &table[low];
+  }
+  return nullptr;
+}
+
+/// \brief Returns whether the given table of enumeration-value pairs is indexed by enumeration,
+/// that is, whether the enumeration of each pair has the pair's index as its underlying value. Such
+/// a table contains exactly one pair per enumeration value and is looked up by direct indexing.
+/// This is an internal implementation detail and is not intended to be used outside of the
+/// Physical Quantities library.
+template <typename Enumeration, typename Value, std::size_t Size>
+[[nodiscard]] inline constexpr bool IsIndexedByKey(
+    const std::array<std::pair<Enumeration, Value>, Size>& table) {
+  for (std::size_t index = 0; index < Size; ++index) {
+    if (static_cast<std::size_t>(table[index].first) != index) {
+      return false;
+    }
+  }
+  return true;
+}
+
+/// \brief Table of enumerations and their corresponding abbreviations, indexed by the underlying
+/// value of the enumeration. The table is a constant expression, so it is constant-initialized and
+/// incurs no cost at program startup. This is an internal implementation detail and is not
+/// intended to be used except by the PhQ::Abbreviation function.
 template <typename Enumeration>
-inline const std::map<Enumeration, std::string_view> Abbreviations;
+inline constexpr std::array<std::pair<Enumeration, std::string_view>, 0> Abbreviations{};
 
 }  // namespace Internal
 
 /// \brief Returns the abbreviation of a given enumeration value. For example,
-/// PhQ::Abbreviation(PhQ::Unit::Time::Hour) returns "hr".
+/// PhQ::Abbreviation(PhQ::Unit::Time::Hour) returns "hr". The abbreviation is obtained by directly
+/// indexing a table with the underlying value of the enumeration, so this function takes constant
+/// time and can be evaluated at compile time.
 template <typename Enumeration>
-[[nodiscard]] inline std::string_view Abbreviation(const Enumeration enumeration) {
-  return Internal::Abbreviations<Enumeration>.find(enumeration)->second;
+[[nodiscard]] inline constexpr std::string_view Abbreviation(const Enumeration enumeration) {
+  static_assert(Internal::IsIndexedByKey(Internal::Abbreviations<Enumeration>),
+                "The table of abbreviations must contain every enumeration value in order.");
+  return Internal::Abbreviations<Enumeration>[static_cast<std::size_t>(enumeration)].second;
 }
 
 namespace Internal {
 
-/// \brief Map of spellings to their corresponding enumeration values. This is an internal
-/// implementation detail and is not intended to be used except by the PhQ::ParseEnumeration
-/// function.
+/// \brief Table of spellings and their corresponding enumeration values, sorted by spelling. The
+/// table is a constant expression, so it is constant-initialized and incurs no cost at program
+/// startup. This is an internal implementation detail and is not intended to be used except by the
+/// PhQ::ParseEnumeration function.
+template <typename Enumeration>
+inline constexpr std::array<std::pair<std::string_view, Enumeration>, 0> Spellings{};
+
+/// \brief Computes a 64-bit hash of the given string. The characters are consumed eight at a time
+/// as 64-bit words, each of which is mixed into the hash with a multiplication and a shift. This is
+/// an internal implementation detail and is not intended to be used outside of the
+/// PhQ::Internal::PerfectHash class template.
+[[nodiscard]] inline constexpr std::uint64_t HashString(const std::string_view string) noexcept {
+  constexpr std::uint64_t multiplier{11400714819323198485ULL};
+  const std::size_t size{string.size()};
+  std::uint64_t hash{size * 13787848793156543929ULL};
+  std::size_t index{0};
+  for (; index + 8 <= size; index += 8) {
+    std::uint64_t word{0};
+    for (std::size_t byte = 0; byte < 8; ++byte) {
+      word |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(string[index + byte]))
+              << (8 * byte);
+    }
+    hash = (hash ^ word) * multiplier;
+    hash ^= hash >> 29;
+  }
+  if (index < size) {
+    std::uint64_t word{0};
+    for (std::size_t byte = 0; index + byte < size; ++byte) {
+      word |= static_cast<std::uint64_t>(static_cast<std::uint8_t>(string[index + byte]))
+              << (8 * byte);
+    }
+    hash = (hash ^ word) * multiplier;
+    hash ^= hash >> 29;
+  }
+  hash *= multiplier;
+  hash ^= hash >> 32;
+  return hash;
+}
+
+/// \brief Collision-free hash index over a table of distinct string keys, built entirely at compile
+/// time with the hash-and-displace method. The keys are distributed into buckets of about four keys
+/// each, and each bucket is given a displacement such that its keys land in distinct free slots of
+/// a power-of-two slot array. A lookup therefore costs one hash of the searched string, two array
+/// reads, and a single string comparison against the only candidate key, with no probing, no
+/// branching on collisions, and no memory allocation. This is an internal implementation detail and
+/// is not intended to be used outside of the Physical Quantities library.
+/// \tparam Size Number of keys in the table.
+template <std::size_t Size>
+class PerfectHash {
+  static_assert(Size < UINT16_MAX, "The table of a PhQ::Internal::PerfectHash is too large.");
+
+public:
+  /// \brief Constructor. Builds a hash index over the keys of the given table. The keys must be
+  /// distinct. This constructor is intended to be evaluated at compile time.
+  template <typename Value>
+  explicit constexpr PerfectHash(
+      const std::array<std::pair<std::string_view, Value>, Size>& table) {
+    // Hash the keys and sort their indices by bucket with a counting sort.
+    std::array<std::uint64_t, Size> hashes{};
+    std::array<std::size_t, BucketCount + 1> bucket_starts{};
+    for (std::size_t index = 0; index < Size; ++index) {
+      hashes[index] = HashString(table[index].first);
+      ++bucket_starts[Bucket(hashes[index]) + 1];
+    }
+    std::size_t largest_bucket_size{0};
+    for (std::size_t bucket = 0; bucket < BucketCount; ++bucket) {
+      largest_bucket_size = std::max(largest_bucket_size, bucket_starts[bucket + 1]);
+      bucket_starts[bucket + 1] += bucket_starts[bucket];
+    }
+    std::array<std::size_t, Size> members{};
+    std::array<std::size_t, BucketCount> bucket_ends{};
+    for (std::size_t bucket = 0; bucket < BucketCount; ++bucket) {
+      bucket_ends[bucket] = bucket_starts[bucket];
+    }
+    for (std::size_t index = 0; index < Size; ++index) {
+      members[bucket_ends[Bucket(hashes[index])]++] = index;
+    }
+
+    // Place the buckets from the largest to the smallest, since large buckets are the hardest to
+    // place. For each bucket, find the first displacement that sends all of its keys to distinct
+    // free slots.
+    for (std::size_t bucket_size = largest_bucket_size; bucket_size > 0; --bucket_size) {
+      for (std::size_t bucket = 0; bucket < BucketCount; ++bucket) {
+        if (bucket_ends[bucket] - bucket_starts[bucket] != bucket_size) {
+          continue;
+        }
+        bool placed{false};
+        for (std::uint32_t displacement = 0; displacement < MaximumDisplacement && !placed;
+             ++displacement) {
+          placed = true;
+          for (std::size_t member = bucket_starts[bucket]; member < bucket_ends[bucket] && placed;
+               ++member) {
+            const std::size_t slot{Slot(hashes[members[member]], displacement)};
+            placed = slots_[slot] == 0;
+            for (std::size_t other = bucket_starts[bucket]; other < member && placed; ++other) {
+              placed = Slot(hashes[members[other]], displacement) != slot;
+            }
+          }
+          if (placed) {
+            displacements_[bucket] = displacement;
+            for (std::size_t member = bucket_starts[bucket]; member < bucket_ends[bucket];
+                 ++member) {
+              slots_[Slot(hashes[members[member]], displacement)] =
+                  static_cast<std::uint16_t>(members[member] + 1);
+            }
+          }
+        }
+        valid_ = valid_ && placed;
+      }
+    }
+  }
+
+  /// \brief Returns whether the hash index was built successfully. This is always the case for
+  /// distinct keys.
+  [[nodiscard]] constexpr bool Valid() const noexcept {
+    return valid_;
+  }
+
+  /// \brief Returns the index in the table of the only key that can be equal to the given key, or
+  /// the size of the table if no key can be equal to it. The caller must still compare the key at
+  /// the returned index with the given key.
+  [[nodiscard]] constexpr std::size_t Candidate(const std::string_view key) const noexcept {
+    const std::uint64_t hash{HashString(key)};
+    const std::uint16_t slot{slots_[Slot(hash, displacements_[Bucket(hash)])]};
+    return slot == 0 ? Size : static_cast<std::size_t>(slot - 1);
+  }
+
+private:
+  /// \brief Returns the smallest exponent such that two to its power is greater than or equal to
+  /// the given number. The result is at least one.
+  [[nodiscard]] static constexpr std::size_t CeilingLogarithm2(const std::size_t number) noexcept {
+    std::size_t exponent{1};
+    while ((std::size_t{1} << exponent) < number) {
+      ++exponent;
+    }
+    return exponent;
+  }
+
+  /// \brief Number of buckets.
+  static constexpr std::size_t BucketCount{Size / 4 + 1};
+
+  /// \brief Number of bits of a slot index. The number of slots is a power of two that keeps the
+  /// load factor of the slots at or below 80%.
+  static constexpr std::size_t SlotBitCount{CeilingLogarithm2(Size + Size / 4 + 1)};
+
+  /// \brief Number of slots.
+  static constexpr std::size_t SlotCount{std::size_t{1} << SlotBitCount};
+
+  /// \brief Exclusive upper bound on the displacement of a bucket.
+  static constexpr std::uint32_t MaximumDisplacement{1U << 16};
+
+  /// \brief Returns the bucket of a given hash.
+  [[nodiscard]] static constexpr std::size_t Bucket(const std::uint64_t hash) noexcept {
+    return static_cast<std::size_t>((hash >> 32) % BucketCount);
+  }
+
+  /// \brief Returns the slot of a given hash for a given displacement. The slot is taken from the
+  /// high bits of a multiplicative remix of the hash and the displacement, so the keys of a bucket
+  /// are sent to independent slots for each displacement.
+  [[nodiscard]] static constexpr std::size_t Slot(
+      const std::uint64_t hash, const std::uint32_t displacement) noexcept {
+    return static_cast<std::size_t>(
+        ((hash ^ displacement) * 11400714819323198485ULL) >> (64 - SlotBitCount));
+  }
+
+  /// \brief Displacement of each bucket.
+  std::array<std::uint32_t, BucketCount> displacements_{};
+
+  /// \brief Index in the table of the key in each slot plus one, or zero for an empty slot.
+  std::array<std::uint16_t, SlotCount> slots_{};
+
+  /// \brief Whether every bucket was placed.
+  bool valid_{true};
+};
+
+/// \brief Compile-time perfect hash index over the spellings of an enumeration. This is an
+/// internal implementation detail and is not intended to be used except by the
+/// PhQ::ParseEnumeration function.
 template <typename Enumeration>
-inline const std::unordered_map<std::string_view, Enumeration> Spellings;
+inline constexpr PerfectHash<Spellings<Enumeration>.size()> SpellingsHash{
+    Spellings<Enumeration>};
 
 }  // namespace Internal
 
@@ -105,139 +374,335 @@ inline const std::unordered_map<std::string_view, Enumeration> Spellings;
 /// if the given string could not be parsed into an enumeration of the given type.
 template <typename Enumeration>
 [[nodiscard]] std::optional<Enumeration> ParseEnumeration(const std::string_view spelling) {
-  const typename std::unordered_map<std::string_view, Enumeration>::const_iterator found{
-      Internal::Spellings<Enumeration>.find(spelling)};
-  if (found != Internal::Spellings<Enumeration>.cend()) {
-    return found->second;
+  static_assert(
+      Internal::IsSortedByKey(Internal::Spellings<Enumeration>),
+      "The table of spellings must be sorted by spelling and must not contain duplicates.");
+  static_assert(Internal::SpellingsHash<Enumeration>.Valid(),
+                "The perfect hash index of the table of spellings could not be built.");
+  constexpr std::size_t size{Internal::Spellings<Enumeration>.size()};
+  const std::size_t candidate{Internal::SpellingsHash<Enumeration>.Candidate(spelling)};
+  if (candidate != size && Internal::Spellings<Enumeration>[candidate].first == spelling) {
+    return Internal::Spellings<Enumeration>[candidate].second;
   }
   return std::nullopt;
 }
 
+namespace Internal {
+
+/// \brief Parses a floating-point number from the character range [first, last) with the same
+/// syntax and results as std::from_chars. Falls back to std::strtof, std::strtod, or std::strtold
+/// if the standard library does not implement std::from_chars for floating-point numbers, in which
+/// case the characters are copied into a temporary string. Internal implementation detail not
+/// intended to be used outside of PhQ::ParseNumber.
+template <typename NumericType>
+inline std::from_chars_result FromChars(const char* const first, const char* const last,
+                                        NumericType& number, const std::chars_format format) {
+#if PHQ_FLOATING_POINT_CHARCONV
+  return std::from_chars(first, last, number, format);
+#else
+  // Unlike std::strtod, std::from_chars rejects leading whitespace and signs, and it only parses
+  // hexadecimal numbers in the hexadecimal format, where they have no "0x" prefix.
+  if (first == last || *first == '+' || *first == '-'
+      || std::isspace(static_cast<unsigned char>(*first)) != 0) {
+    return {first, std::errc::invalid_argument};
+  }
+  if (format != std::chars_format::hex && last - first >= 2 && first[0] == '0'
+      && (first[1] == 'x' || first[1] == 'X')) {
+    number = static_cast<NumericType>(0);
+    return {first + 1, std::errc{}};
+  }
+  const std::string prefix{format == std::chars_format::hex ? "0x" : ""};
+  const std::string string{prefix + std::string(first, last)};
+  char* string_end{nullptr};
+  errno = 0;
+  NumericType result;
+  if constexpr (std::is_same_v<NumericType, float>) {
+    result = std::strtof(string.c_str(), &string_end);
+  } else if constexpr (std::is_same_v<NumericType, double>) {
+    result = std::strtod(string.c_str(), &string_end);
+  } else {
+    result = std::strtold(string.c_str(), &string_end);
+  }
+  const std::size_t parsed_size{static_cast<std::size_t>(string_end - string.c_str())};
+  if (parsed_size <= prefix.size()) {
+    return {first, std::errc::invalid_argument};
+  }
+  const char* const pointer{first + (parsed_size - prefix.size())};
+  if (errno == ERANGE) {
+    return {pointer, std::errc::result_out_of_range};
+  }
+  number = result;
+  return {pointer, std::errc{}};
+#endif
+}
+
+/// \brief Prints a floating-point number into the character range [first, last) with the same
+/// characters and results as std::to_chars with a format and a precision. Falls back to
+/// std::snprintf if the standard library does not implement std::to_chars for floating-point
+/// numbers. Internal implementation detail not intended to be used outside of PhQ::Print.
+template <typename NumericType>
+inline std::to_chars_result ToChars(char* const first, char* const last, const NumericType value,
+                                    const std::chars_format format, const int precision) {
+#if PHQ_FLOATING_POINT_CHARCONV
+  return std::to_chars(first, last, value, format, precision);
+#else
+  char buffer[64];
+  int size;
+  if constexpr (std::is_same_v<NumericType, long double>) {
+    size = std::snprintf(buffer, sizeof(buffer),
+                         format == std::chars_format::scientific ? "%.*Le" : "%.*Lf", precision,
+                         value);
+  } else {
+    size = std::snprintf(buffer, sizeof(buffer),
+                         format == std::chars_format::scientific ? "%.*e" : "%.*f", precision,
+                         static_cast<double>(value));
+  }
+  if (size < 0 || static_cast<std::size_t>(size) >= sizeof(buffer) || size > last - first) {
+    return {last, std::errc::value_too_large};
+  }
+  return {std::copy(buffer, buffer + size, first), std::errc{}};
+#endif
+}
+
+/// \brief Prints a floating-point number into the character range [first, last) using the fewest
+/// digits that parse back to exactly the same number, like std::to_chars without a format. Falls
+/// back to std::snprintf with increasing precision if the standard library does not implement
+/// std::to_chars for floating-point numbers, in which case the choice between fixed and scientific
+/// notation may differ from std::to_chars. Internal implementation detail not intended to be used
+/// outside of PhQ::PrintShortest.
+template <typename NumericType>
+inline std::to_chars_result ToChars(char* const first, char* const last, const NumericType value) {
+#if PHQ_FLOATING_POINT_CHARCONV
+  return std::to_chars(first, last, value);
+#else
+  char buffer[64];
+  int size{-1};
+  for (int precision = 1; precision <= std::numeric_limits<NumericType>::max_digits10;
+       ++precision) {
+    // The printed characters are null-terminated, so they can be parsed back directly.
+    NumericType parsed;
+    if constexpr (std::is_same_v<NumericType, float>) {
+      size = std::snprintf(buffer, sizeof(buffer), "%.*g", precision, static_cast<double>(value));
+      parsed = std::strtof(buffer, nullptr);
+    } else if constexpr (std::is_same_v<NumericType, double>) {
+      size = std::snprintf(buffer, sizeof(buffer), "%.*g", precision, value);
+      parsed = std::strtod(buffer, nullptr);
+    } else {
+      size = std::snprintf(buffer, sizeof(buffer), "%.*Lg", precision, value);
+      parsed = std::strtold(buffer, nullptr);
+    }
+    if (size > 0 && static_cast<std::size_t>(size) < sizeof(buffer) && parsed == value) {
+      break;
+    }
+  }
+  if (size < 0 || static_cast<std::size_t>(size) >= sizeof(buffer) || size > last - first) {
+    return {last, std::errc::value_too_large};
+  }
+  return {std::copy(buffer, buffer + size, first), std::errc{}};
+#endif
+}
+
+}  // namespace Internal
+
+/// \brief Result of parsing a number with PhQ::ParseNumber.
+struct ParseNumberResult {
+  /// \brief Number of characters consumed from the beginning of the string. This is zero if the
+  /// string does not begin with a number. If the number is out of range, this is the number of
+  /// characters of the out-of-range number, such that it can be skipped.
+  std::size_t consumed{0};
+
+  /// \brief Error code. This is a value-initialized std::errc if a number was parsed,
+  /// std::errc::invalid_argument if the string does not begin with a number, or
+  /// std::errc::result_out_of_range if the number is not representable by the numeric type.
+  std::errc error{};
+};
+
+/// \brief Parses a number of the given numeric type from the beginning of the given string. The
+/// number can optionally be preceded by a plus or minus sign, and otherwise follows the syntax of
+/// std::from_chars with the std::chars_format::general format, including "inf" and "nan". As with
+/// std::strtod, a "0x" or "0X" prefix introduces a hexadecimal number, such as 0x10 or 0x1.8p3. The
+/// parsing stops at the first character that is not part of the number, so this can be used to
+/// parse a sequence of numbers in a stream of characters. Never throws exceptions, does not access
+/// the locale, and does not allocate memory, unless PHQ_FLOATING_POINT_CHARCONV is 0. On success,
+/// the resulting number is stored in the given number. Otherwise, the given number is unchanged.
+/// Returns the number of consumed characters and an error code.
+/// \tparam NumericType Floating-point numeric type: float, double, or long double. Deduced
+/// automatically.
+template <typename NumericType>
+inline ParseNumberResult ParseNumber(const std::string_view string, NumericType& number) noexcept {
+  static_assert(std::is_floating_point<NumericType>::value,
+                "The NumericType template parameter of PhQ::ParseNumber<NumericType> must be a "
+                "numeric floating-point type: float, double, or long double.");
+  const char* const begin{string.data()};
+  const char* const end{begin + string.size()};
+  const char* first{begin};
+  // Unlike std::from_chars, a leading plus sign is accepted. The sign is applied after parsing, so
+  // that it also applies to hexadecimal numbers. It cannot be followed by another sign.
+  bool negative{false};
+  if (first != end && (*first == '+' || *first == '-')) {
+    negative = *first == '-';
+    ++first;
+    if (first != end && (*first == '+' || *first == '-')) {
+      return {0, std::errc::invalid_argument};
+    }
+  }
+  NumericType result;
+  std::from_chars_result parsed{first, std::errc::invalid_argument};
+  // Unlike std::from_chars, a "0x" or "0X" prefix introduces a hexadecimal number. If no
+  // hexadecimal number follows the prefix, only the leading zero is parsed, as with std::strtod.
+  if (end - first > 2 && first[0] == '0' && (first[1] == 'x' || first[1] == 'X')
+      && (std::isxdigit(static_cast<unsigned char>(first[2])) != 0 || first[2] == '.')) {
+    parsed = Internal::FromChars(first + 2, end, result, std::chars_format::hex);
+  }
+  if (parsed.ec == std::errc::invalid_argument) {
+    parsed = Internal::FromChars(first, end, result, std::chars_format::general);
+  }
+  if (parsed.ec == std::errc::invalid_argument) {
+    return {0, std::errc::invalid_argument};
+  }
+  if (parsed.ec == std::errc{}) {
+    number = negative ? -result : result;
+  }
+  return {static_cast<std::size_t>(parsed.ptr - begin), parsed.ec};
+}
+
 /// \brief Parses the given string as a number of the given numeric type. Returns a std::optional
 /// container that contains the resulting number if successful, or std::nullopt if the string could
-/// not be parsed into the given numeric type.
+/// not be parsed into the given numeric type. Leading whitespace is ignored, as are any characters
+/// that follow the number. Never throws exceptions.
 /// \tparam NumericType Floating-point numeric type: float, double, or long double. Defaults to
 /// double if unspecified.
 template <typename NumericType = double>
-[[nodiscard]] inline std::optional<NumericType> ParseNumber(const std::string& string);
-
-/// \brief Parses the given string as a single-precision floating-point number (a float). Returns a
-/// std::optional container that contains the resulting number if successful, or std::nullopt if the
-/// string could not be parsed into a float.
-template <>
-[[nodiscard]] inline std::optional<float> ParseNumber(const std::string& string) {
-  float number;
-  try {
-    number = std::stof(string);
-  } catch (...) {
+[[nodiscard]] inline std::optional<NumericType> ParseNumber(std::string_view string) noexcept {
+  const std::size_t start{string.find_first_not_of(" \f\n\r\t\v")};
+  if (start == std::string_view::npos) {
     return std::nullopt;
   }
-  return number;
-}
-
-/// \brief Parses the given string as a double-precision floating-point number (a double). Returns a
-/// std::optional container that contains the resulting number if successful, or std::nullopt if the
-/// string could not be parsed into a double.
-template <>
-[[nodiscard]] inline std::optional<double> ParseNumber(const std::string& string) {
-  double number;
-  try {
-    number = std::stod(string);
-  } catch (...) {
+  string.remove_prefix(start);
+  NumericType number;
+  if (ParseNumber(string, number).error != std::errc{}) {
     return std::nullopt;
   }
   return number;
 }
 
-/// \brief Parses the given string as an extended-precision floating-point number (a long double).
-/// Returns a std::optional container that contains the resulting number if successful, or
-/// std::nullopt if the string could not be parsed into a long double.
-template <>
-[[nodiscard]] inline std::optional<long double> ParseNumber(const std::string& string) {
-  long double number;
-  try {
-    number = std::stold(string);
-  } catch (...) {
-    return std::nullopt;
-  }
-  return number;
-}
+/// \brief Number of characters that is always sufficient to hold a floating-point number printed
+/// by PhQ::Print or PhQ::PrintShortest, regardless of its type or value.
+inline constexpr std::size_t PrintBufferSize{64};
 
-/// \brief Prints a given floating-point number as a string. Prints enough digits to represent the
-/// number exactly. The printed number of digits depends on the type of the floating-point number.
+/// \brief Prints a given floating-point number into the character range [first, last). Prints
+/// enough digits to represent the number exactly. The printed number of digits depends on the type
+/// of the floating-point number and on the interval in which its magnitude lies. Does not allocate
+/// memory, and does not access the locale unless PHQ_FLOATING_POINT_CHARCONV is 0. The characters
+/// are not null-terminated. Returns a std::to_chars_result whose pointer is one past the last
+/// written character, or whose error code is std::errc::value_too_large if the range is too small,
+/// in which case the contents of the range are unspecified. A range of PhQ::PrintBufferSize
+/// characters is always sufficient.
 /// \tparam NumericType Floating-point numeric type of the given value. Deduced automatically.
 template <typename NumericType>
-[[nodiscard]] inline std::string Print(const NumericType value) {
+inline std::to_chars_result Print(char* const first, char* const last, const NumericType value) {
   static_assert(std::is_floating_point<NumericType>::value,
                 "The NumericType template parameter of PhQ::Print<NumericType> must be a numeric "
                 "floating-point type: float, double, or long double.");
+  constexpr int digits{std::numeric_limits<NumericType>::max_digits10};
   const NumericType absolute{std::abs(value)};
-  std::ostringstream stream;
+  std::chars_format format{std::chars_format::fixed};
+  int precision{digits};
   if (absolute < 1.0) {
     // Interval: [0, 1[
     if (absolute < 0.001) {
       // Interval: [0, 0.001[
       if (absolute == 0.0) {
         // Interval: [0, 0]
-        stream << 0;
-      } else {
-        // Interval: ]0, 0.001[
-        stream << std::scientific
-               << std::setprecision(std::numeric_limits<NumericType>::max_digits10) << value;
+        if (first == last) {
+          return {last, std::errc::value_too_large};
+        }
+        *first = '0';
+        return {first + 1, std::errc{}};
       }
+      // Interval: ]0, 0.001[
+      format = std::chars_format::scientific;
     } else {
       // Interval: [0.001, 1[
       if (absolute < 0.1) {
         // Interval: [0.001, 0.1[
         if (absolute < 0.01) {
           // Interval: [0.001, 0.01[
-          stream << std::fixed
-                 << std::setprecision(std::numeric_limits<NumericType>::max_digits10 + 3) << value;
+          precision = digits + 3;
         } else {
           // Interval: [0.01, 0.1[
-          stream << std::fixed
-                 << std::setprecision(std::numeric_limits<NumericType>::max_digits10 + 2) << value;
+          precision = digits + 2;
         }
       } else {
         // Interval: [0.1, 1[
-        stream << std::fixed
-               << std::setprecision(std::numeric_limits<NumericType>::max_digits10 + 1) << value;
+        precision = digits + 1;
       }
     }
   } else {
     // Interval: [1, +inf[
     if (absolute < 1000.0) {
       // Interval: [1, 1000[
-      if (absolute < 10.0) {
-        // Interval: [1, 10[
-        stream << std::fixed << std::setprecision(std::numeric_limits<NumericType>::max_digits10)
-               << value;
-      } else {
+      if (absolute >= 10.0) {
         // Interval: [10, 1000[
         if (absolute < 100.0) {
           // Interval: [10, 100[
-          stream << std::fixed
-                 << std::setprecision(std::numeric_limits<NumericType>::max_digits10 - 1) << value;
+          precision = digits - 1;
         } else {
           // Interval: [100, 1000[
-          stream << std::fixed
-                 << std::setprecision(std::numeric_limits<NumericType>::max_digits10 - 2) << value;
+          precision = digits - 2;
         }
       }
     } else {
       // Interval: [1000, +inf[
       if (absolute < 10000.0) {
         // Interval: [1000, 10000[
-        stream << std::fixed
-               << std::setprecision(std::numeric_limits<NumericType>::max_digits10 - 3) << value;
+        precision = digits - 3;
       } else {
         // Interval: [10000, +inf[
-        stream << std::scientific
-               << std::setprecision(std::numeric_limits<NumericType>::max_digits10) << value;
+        format = std::chars_format::scientific;
       }
     }
   }
-  return stream.str();
+  return Internal::ToChars(first, last, value, format, precision);
+}
+
+/// \brief Prints a given floating-point number as a string. Prints enough digits to represent the
+/// number exactly. The printed number of digits depends on the type of the floating-point number.
+/// \tparam NumericType Floating-point numeric type of the given value. Deduced automatically.
+template <typename NumericType>
+[[nodiscard]] inline std::string Print(const NumericType value) {
+  char buffer[PrintBufferSize];
+  const std::to_chars_result result{Print(buffer, buffer + PrintBufferSize, value)};
+  return {buffer, result.ptr};
+}
+
+/// \brief Prints a given floating-point number and appends it to the given string. Prints the same
+/// characters as PhQ::Print, but writes them directly into the string so that a reused string does
+/// not allocate memory once its capacity suffices.
+/// \tparam String Type of the string: std::string, or any type with the same append member
+/// function, such as PhQ::Internal::OutputIteratorString. Deduced automatically.
+/// \tparam NumericType Floating-point numeric type of the given value. Deduced automatically.
+template <typename String, typename NumericType>
+inline void AppendPrint(String& string, const NumericType value) {
+  char buffer[PrintBufferSize];
+  const std::to_chars_result result{Print(buffer, buffer + PrintBufferSize, value)};
+  string.append(buffer, result.ptr);
+}
+
+/// \brief Prints a given floating-point number into the character range [first, last) using the
+/// fewest digits that parse back to exactly the same number. Does not access the locale and does
+/// not allocate memory, unless PHQ_FLOATING_POINT_CHARCONV is 0. The characters are not
+/// null-terminated. Returns a std::to_chars_result whose pointer is one past the last written
+/// character, or whose error code is std::errc::value_too_large if the range is too small. A range
+/// of PhQ::PrintBufferSize characters is always sufficient.
+/// \tparam NumericType Floating-point numeric type of the given value. Deduced automatically.
+template <typename NumericType>
+inline std::to_chars_result PrintShortest(
+    char* const first, char* const last, const NumericType value) {
+  static_assert(std::is_floating_point<NumericType>::value,
+                "The NumericType template parameter of PhQ::PrintShortest<NumericType> must be a "
+                "numeric floating-point type: float, double, or long double.");
+  return Internal::ToChars(first, last, value);
 }
 
 /// \brief Returns a copy of the given string where all characters are lowercase.
@@ -266,6 +731,62 @@ template <typename NumericType>
   return result;
 }
 
+/// \brief Appends a copy of the given string to another string, where all characters are lowercase
+/// and all spaces are replaced with underscores. Appends the same characters as PhQ::SnakeCase
+/// without constructing an intermediate string.
+/// \tparam String Type of the string: std::string, or any type with the same push_back member
+/// function, such as PhQ::Internal::OutputIteratorString. Deduced automatically.
+template <typename String>
+inline void AppendSnakeCase(String& string, const std::string_view source) {
+  for (const char character : source) {
+    string.push_back(character == ' ' ? '_' : static_cast<char>(std::tolower(character)));
+  }
+}
+
+namespace Internal {
+
+/// \brief Adapter that gives an output iterator the append and push_back member functions of
+/// std::string, so that the AppendJSON, AppendXML, and AppendYAML member functions write their
+/// message directly through the output iterator instead of into an intermediate string. Internal
+/// implementation detail not intended to be used outside of the WriteJSON, WriteXML, and WriteYAML
+/// member functions.
+/// \tparam OutputIterator Output iterator of characters.
+template <typename OutputIterator>
+class OutputIteratorString {
+public:
+  /// \brief Constructor. Constructs an adapter that writes through the given output iterator.
+  explicit constexpr OutputIteratorString(OutputIterator output) : output(std::move(output)) {}
+
+  /// \brief Writes the given characters through the output iterator.
+  OutputIteratorString& append(const std::string_view characters) {
+    output = std::copy(characters.begin(), characters.end(), std::move(output));
+    return *this;
+  }
+
+  /// \brief Writes the characters in the range [first, last) through the output iterator.
+  OutputIteratorString& append(const char* const first, const char* const last) {
+    output = std::copy(first, last, std::move(output));
+    return *this;
+  }
+
+  /// \brief Writes the given character through the output iterator.
+  void push_back(const char character) {
+    *output = character;
+    ++output;
+  }
+
+  /// \brief Returns the output iterator one past the last written character.
+  [[nodiscard]] OutputIterator Output() const {
+    return output;
+  }
+
+private:
+  /// \brief Output iterator one past the last written character.
+  OutputIterator output;
+};
+
+}  // namespace Internal
+
 }  // namespace PhQ
 
 #endif  // PHQ_BASE_HPP
@@ -0,0 +1,406 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_BINARY_HPP
+#define PHQ_BINARY_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+#include <vector>
+
+#include "ConversionPlan.hpp"
+#include "Dimensions.hpp"
+#include "QuantityTraits.hpp"
+#include "Unit.hpp"
+
+namespace PhQ {
+
+/// \brief Version of the binary wire format written by PhQ::EncodeBinary. PhQ::DecodeBinary rejects
+/// messages of any other version.
+inline constexpr std::uint8_t BinaryFormatVersion{1};
+
+/// \brief Size in bytes of the header of a binary message written by PhQ::EncodeBinary.
+inline constexpr std::size_t BinaryHeaderSize{7};
+
+/// \brief Header of a binary message of physical quantities. A binary message consists of this
+/// header followed by the components of zero or more physical quantities of the same type, stored
+/// contiguously as little-endian floating-point numbers. The header is packed into 7 bytes:
+/// - Byte 0: version of the binary wire format.
+/// - Byte 1: base-2 logarithm of the size in bytes of a component in the upper four bits, and the
+///   number of components per physical quantity in the lower four bits.
+/// - Byte 2: index of the unit of measure of the components within its unit of measure enumeration.
+/// - Bytes 3 to 6: physical dimension set of the unit of measure, as seven signed four-bit
+///   exponents in the order time, length, mass, electric current, temperature, amount of substance,
+///   and luminous intensity, starting from the lower four bits of byte 3. The upper four bits of
+///   byte 6 are zero.
+struct BinaryHeader {
+  /// \brief Version of the binary wire format.
+  std::uint8_t version{BinaryFormatVersion};
+
+  /// \brief Size in bytes of each component.
+  std::size_t numeric_size{0};
+
+  /// \brief Number of components per physical quantity.
+  std::size_t component_count{0};
+
+  /// \brief Index of the unit of measure of the components within its unit of measure enumeration.
+  std::uint8_t unit{0};
+
+  /// \brief Physical dimension set of the unit of measure of the components.
+  Dimensions dimensions;
+
+  /// \brief Writes this header to the given output buffer, which must hold at least
+  /// PhQ::BinaryHeaderSize bytes.
+  void Write(std::byte* const output) const noexcept {
+    std::uint8_t width{0};
+    while ((std::size_t{1} << width) < numeric_size) {
+      ++width;
+    }
+    const std::array<int8_t, 7> exponents{
+        dimensions.Time().Value(),        dimensions.Length().Value(),
+        dimensions.Mass().Value(),        dimensions.ElectricCurrent().Value(),
+        dimensions.Temperature().Value(), dimensions.SubstanceAmount().Value(),
+        dimensions.LuminousIntensity().Value()};
+    std::array<std::uint8_t, BinaryHeaderSize> bytes{
+        version, static_cast<std::uint8_t>((width << 4) | (component_count & 0x0F)), unit, 0, 0,
+        0,       0};
+    for (std::size_t index = 0; index < exponents.size(); ++index) {
+      const std::uint8_t nibble{static_cast<std::uint8_t>(exponents[index] & 0x0F)};
+      bytes[3 + index / 2] |= static_cast<std::uint8_t>(index % 2 == 0 ? nibble : nibble << 4);
+    }
+    std::memcpy(output, bytes.data(), BinaryHeaderSize);
+  }
+
+  /// \brief Reads a header from the given input buffer, which must hold at least
+  /// PhQ::BinaryHeaderSize bytes.
+  [[nodiscard]] static BinaryHeader Read(const std::byte* const input) noexcept {
+    std::array<std::uint8_t, BinaryHeaderSize> bytes;
+    std::memcpy(bytes.data(), input, BinaryHeaderSize);
+    std::array<int8_t, 7> exponents{};
+    for (std::size_t index = 0; index < exponents.size(); ++index) {
+      const std::uint8_t nibble{static_cast<std::uint8_t>(
+          index % 2 == 0 ? bytes[3 + index / 2] & 0x0F : bytes[3 + index / 2] >> 4)};
+      // Sign-extend the four-bit exponent.
+      exponents[index] = static_cast<int8_t>(nibble >= 8 ? nibble - 16 : nibble);
+    }
+    BinaryHeader header;
+    header.version = bytes[0];
+    header.numeric_size = std::size_t{1} << (bytes[1] >> 4);
+    header.component_count = bytes[1] & 0x0F;
+    header.unit = bytes[2];
+    header.dimensions = Dimensions{
+        Dimension::Time{exponents[0]},        Dimension::Length{exponents[1]},
+        Dimension::Mass{exponents[2]},        Dimension::ElectricCurrent{exponents[3]},
+        Dimension::Temperature{exponents[4]}, Dimension::SubstanceAmount{exponents[5]},
+        Dimension::LuminousIntensity{exponents[6]}};
+    return header;
+  }
+};
+
+/// \brief Errors that can occur when decoding a binary message with PhQ::DecodeBinary.
+enum class BinaryError : int8_t {
+  /// \brief No error. The binary message was decoded successfully.
+  None,
+
+  /// \brief The binary message is shorter than its header.
+  TruncatedHeader,
+
+  /// \brief The binary message was written with a different version of the binary wire format.
+  UnsupportedVersion,
+
+  /// \brief The components of the binary message have a different size than the numeric type of
+  /// the physical quantity.
+  NumericTypeMismatch,
+
+  /// \brief The binary message has a different number of components per physical quantity than
+  /// the physical quantity.
+  ComponentCountMismatch,
+
+  /// \brief The unit of measure of the binary message has a different physical dimension set than
+  /// the units of measure of the physical quantity.
+  DimensionsMismatch,
+
+  /// \brief The unit of measure of the binary message is not a unit of measure of the physical
+  /// quantity's unit of measure type.
+  UnknownUnit,
+
+  /// \brief The payload of the binary message does not hold a whole number of physical quantities,
+  /// or holds a different number of physical quantities than expected.
+  PayloadSizeMismatch,
+};
+
+namespace Internal {
+
+/// \brief Whether this platform stores numbers in little-endian byte order. Internal
+/// implementation detail not intended to be used outside of the PhQ::EncodeBinary and
+/// PhQ::DecodeBinary functions.
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) \
+    && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+inline constexpr bool IsLittleEndian{false};
+#else
+inline constexpr bool IsLittleEndian{true};
+#endif
+
+/// \brief Copies a given number of components to a byte buffer in little-endian byte order.
+/// Internal implementation detail not intended to be used outside of the PhQ::EncodeBinary and
+/// PhQ::DecodeBinary functions.
+template <typename NumericType>
+inline void StoreLittleEndian(
+    const NumericType* const components, const std::size_t size, std::byte* const output) noexcept {
+  std::memcpy(output, components, size * sizeof(NumericType));
+  if constexpr (!IsLittleEndian) {
+    for (std::size_t index = 0; index < size; ++index) {
+      std::byte* const first{output + index * sizeof(NumericType)};
+      std::reverse(first, first + sizeof(NumericType));
+    }
+  }
+}
+
+/// \brief Copies a given number of components from a byte buffer in little-endian byte order.
+/// Internal implementation detail not intended to be used outside of the PhQ::EncodeBinary and
+/// PhQ::DecodeBinary functions.
+template <typename NumericType>
+inline void LoadLittleEndian(
+    const std::byte* const input, const std::size_t size, NumericType* const components) noexcept {
+  std::memcpy(components, input, size * sizeof(NumericType));
+  if constexpr (!IsLittleEndian) {
+    std::byte* const bytes{reinterpret_cast<std::byte*>(components)};
+    for (std::size_t index = 0; index < size; ++index) {
+      std::byte* const first{bytes + index * sizeof(NumericType)};
+      std::reverse(first, first + sizeof(NumericType));
+    }
+  }
+}
+
+}  // namespace Internal
+
+/// \brief Size in bytes of the binary message of a given number of physical quantities of a given
+/// type, including its header.
+/// \tparam Quantity Type of the physical quantities, such as PhQ::Stress<double>.
+template <typename Quantity>
+[[nodiscard]] constexpr std::size_t BinarySize(const std::size_t size) noexcept {
+  using Traits = Internal::QuantityTraitsOf<Quantity>;
+  using NumericType = typename Traits::NumericType;
+  static_assert((sizeof(NumericType) & (sizeof(NumericType) - 1)) == 0,
+                "The binary wire format requires the size of a numeric type to be a power of two.");
+  static_assert(Internal::NumberOfUnits<typename Traits::UnitType> <= 256,
+                "The binary wire format stores the index of a unit of measure in one byte.");
+  return BinaryHeaderSize + size * Traits::ComponentCount * sizeof(NumericType);
+}
+
+namespace Internal {
+
+/// \brief Returns the header of a binary message of physical quantities of a given type whose
+/// components are expressed in a given unit of measure. Internal implementation detail not
+/// intended to be used outside of the PhQ::EncodeBinary function and the PhQ::MappedField class.
+template <typename Quantity>
+[[nodiscard]] inline BinaryHeader MakeBinaryHeader(
+    const typename QuantityTraitsOf<Quantity>::UnitType unit) noexcept {
+  using Traits = QuantityTraitsOf<Quantity>;
+  return BinaryHeader{BinaryFormatVersion, sizeof(typename Traits::NumericType),
+                      Traits::ComponentCount, static_cast<std::uint8_t>(unit),
+                      RelatedDimensions<typename Traits::UnitType>};
+}
+
+/// \brief Validates the header of a binary message against a given type of physical quantities.
+/// Returns PhQ::BinaryError::None if the header is valid, or another PhQ::BinaryError otherwise.
+/// Internal implementation detail not intended to be used outside of the PhQ::DecodeBinary
+/// function and the PhQ::MappedField class.
+template <typename Quantity>
+[[nodiscard]] inline BinaryError ValidateBinaryHeader(const BinaryHeader& header) noexcept {
+  using Traits = QuantityTraitsOf<Quantity>;
+  using UnitType = typename Traits::UnitType;
+  if (header.version != BinaryFormatVersion) {
+    return BinaryError::UnsupportedVersion;
+  }
+  if (header.numeric_size != sizeof(typename Traits::NumericType)) {
+    return BinaryError::NumericTypeMismatch;
+  }
+  if (header.component_count != Traits::ComponentCount) {
+    return BinaryError::ComponentCountMismatch;
+  }
+  if (header.dimensions != RelatedDimensions<UnitType>) {
+    return BinaryError::DimensionsMismatch;
+  }
+  if (header.unit >= NumberOfUnits<UnitType>) {
+    return BinaryError::UnknownUnit;
+  }
+  return BinaryError::None;
+}
+
+/// \brief Writes the components of a contiguous sequence of a given number of physical quantities
+/// to an output buffer in little-endian byte order, expressed in a given unit of measure. When the
+/// unit of measure is the standard one and the platform is little-endian, this is a single memory
+/// copy. Otherwise, the components are converted and written in blocks. Internal implementation
+/// detail not intended to be used outside of the PhQ::EncodeBinary and PhQ::WriteMappedField
+/// functions.
+template <typename Quantity>
+inline void EncodeBinaryPayload(const Quantity* const quantities, const std::size_t size,
+                                std::byte* const output,
+                                const typename QuantityTraitsOf<Quantity>::UnitType unit) noexcept {
+  using Traits = QuantityTraitsOf<Quantity>;
+  using UnitType = typename Traits::UnitType;
+  using NumericType = typename Traits::NumericType;
+  const NumericType* const components{
+      QuantityComponents<const Quantity, const NumericType>(quantities)};
+  const std::size_t count{size * Traits::ComponentCount};
+  const ConversionPlan<UnitType, NumericType> plan{Standard<UnitType>, unit};
+  if (plan.IsIdentity()) {
+    StoreLittleEndian(components, count, output);
+  } else {
+    constexpr std::size_t block_size{256};
+    std::array<NumericType, block_size> block;
+    for (std::size_t begin = 0; begin < count; begin += block_size) {
+      const std::size_t length{std::min(block_size, count - begin)};
+      plan.Apply(components + begin, block.data(), length);
+      StoreLittleEndian(block.data(), length, output + begin * sizeof(NumericType));
+    }
+  }
+}
+
+}  // namespace Internal
+
+/// \brief Encodes a contiguous sequence of a given number of physical quantities as a binary
+/// message written to a caller-provided output buffer of PhQ::BinarySize<Quantity>(size) bytes. The
+/// components are expressed in a given unit of measure, which defaults to the standard unit of
+/// measure. When the unit of measure is the standard one and the platform is little-endian, the
+/// payload is written with a single memory copy. Otherwise, the components are converted and
+/// written in blocks. Returns the number of bytes written.
+/// \tparam Quantity Type of the physical quantities, such as PhQ::Stress<double>. This must be
+/// derived from PhQ::DimensionalScalar, PhQ::DimensionalPlanarVector, PhQ::DimensionalVector,
+/// PhQ::DimensionalSymmetricDyad, or PhQ::DimensionalDyad.
+template <typename Quantity>
+std::size_t EncodeBinary(
+    const Quantity* const quantities, const std::size_t size, std::byte* const output,
+    const typename Internal::QuantityTraitsOf<Quantity>::UnitType unit =
+        Standard<typename Internal::QuantityTraitsOf<Quantity>::UnitType>) noexcept {
+  Internal::MakeBinaryHeader<Quantity>(unit).Write(output);
+  Internal::EncodeBinaryPayload(quantities, size, output + BinaryHeaderSize, unit);
+  return BinarySize<Quantity>(size);
+}
+
+/// \brief Encodes a vector of physical quantities as a binary message. The components are
+/// expressed in a given unit of measure, which defaults to the standard unit of measure.
+/// \tparam Quantity Type of the physical quantities, such as PhQ::Stress<double>. This must be
+/// derived from PhQ::DimensionalScalar, PhQ::DimensionalPlanarVector, PhQ::DimensionalVector,
+/// PhQ::DimensionalSymmetricDyad, or PhQ::DimensionalDyad.
+template <typename Quantity>
+[[nodiscard]] std::vector<std::byte> EncodeBinary(
+    const std::vector<Quantity>& quantities,
+    const typename Internal::QuantityTraitsOf<Quantity>::UnitType unit =
+        Standard<typename Internal::QuantityTraitsOf<Quantity>::UnitType>) {
+  std::vector<std::byte> message(BinarySize<Quantity>(quantities.size()));
+  EncodeBinary(quantities.data(), quantities.size(), message.data(), unit);
+  return message;
+}
+
+/// \brief Decodes a binary message of a given size in bytes that holds exactly a given number of
+/// physical quantities into a caller-provided contiguous sequence of that many physical
+/// quantities. The header is validated against the type of the physical quantities, and the
+/// components are converted from the unit of measure of the message to the standard unit of
+/// measure. When the message is in the standard unit of measure and the platform is little-endian,
+/// the payload is read with a single memory copy. Returns PhQ::BinaryError::None if successful, in
+/// which case the physical quantities are set, or another PhQ::BinaryError otherwise, in which case
+/// the physical quantities remain unchanged.
+/// \tparam Quantity Type of the physical quantities, such as PhQ::Stress<double>. This must be
+/// derived from PhQ::DimensionalScalar, PhQ::DimensionalPlanarVector, PhQ::DimensionalVector,
+/// PhQ::DimensionalSymmetricDyad, or PhQ::DimensionalDyad.
+template <typename Quantity>
+[[nodiscard]] BinaryError DecodeBinary(
+    const std::byte* const input, const std::size_t input_size, Quantity* const quantities,
+    const std::size_t size) noexcept {
+  using Traits = Internal::QuantityTraitsOf<Quantity>;
+  using UnitType = typename Traits::UnitType;
+  using NumericType = typename Traits::NumericType;
+  if (input_size < BinaryHeaderSize) {
+    return BinaryError::TruncatedHeader;
+  }
+  const BinaryHeader header{BinaryHeader::Read(input)};
+  const BinaryError error{Internal::ValidateBinaryHeader<Quantity>(header)};
+  if (error != BinaryError::None) {
+    return error;
+  }
+  if (input_size != BinarySize<Quantity>(size)) {
+    return BinaryError::PayloadSizeMismatch;
+  }
+
+  NumericType* const components{Internal::QuantityComponents<Quantity, NumericType>(quantities)};
+  const std::size_t count{size * Traits::ComponentCount};
+  Internal::LoadLittleEndian(input + BinaryHeaderSize, count, components);
+  ConversionPlan<UnitType, NumericType>{static_cast<UnitType>(header.unit), Standard<UnitType>}
+      .Apply(components, count);
+  return BinaryError::None;
+}
+
+/// \brief Decodes a binary message of a given size in bytes into a vector of physical quantities,
+/// which is resized to the number of physical quantities in the message. Otherwise, this function
+/// behaves like the overload that decodes into a caller-provided sequence of physical quantities.
+/// \tparam Quantity Type of the physical quantities, such as PhQ::Stress<double>. This must be
+/// derived from PhQ::DimensionalScalar, PhQ::DimensionalPlanarVector, PhQ::DimensionalVector,
+/// PhQ::DimensionalSymmetricDyad, or PhQ::DimensionalDyad.
+template <typename Quantity>
+[[nodiscard]] BinaryError DecodeBinary(
+    const std::byte* const input, const std::size_t input_size, std::vector<Quantity>& quantities) {
+  if (input_size < BinaryHeaderSize) {
+    return BinaryError::TruncatedHeader;
+  }
+  // Validate the header before the payload size so that a message of a different type of physical
+  // quantities reports why it does not match rather than a payload size mismatch.
+  const BinaryError header_error{
+      Internal::ValidateBinaryHeader<Quantity>(BinaryHeader::Read(input))};
+  if (header_error != BinaryError::None) {
+    return header_error;
+  }
+  constexpr std::size_t element_size{BinarySize<Quantity>(1) - BinaryHeaderSize};
+  if ((input_size - BinaryHeaderSize) % element_size != 0) {
+    return BinaryError::PayloadSizeMismatch;
+  }
+  const std::size_t size{(input_size - BinaryHeaderSize) / element_size};
+  std::vector<Quantity> decoded(size, Quantity::Zero());
+  const BinaryError error{DecodeBinary(input, input_size, decoded.data(), size)};
+  if (error == BinaryError::None) {
+    quantities = std::move(decoded);
+  }
+  return error;
+}
+
+/// \brief Decodes a binary message into a vector of physical quantities, which is resized to the
+/// number of physical quantities in the message. Otherwise, this function behaves like the
+/// overload that decodes into a caller-provided sequence of physical quantities.
+/// \tparam Quantity Type of the physical quantities, such as PhQ::Stress<double>. This must be
+/// derived from PhQ::DimensionalScalar, PhQ::DimensionalPlanarVector, PhQ::DimensionalVector,
+/// PhQ::DimensionalSymmetricDyad, or PhQ::DimensionalDyad.
+template <typename Quantity>
+[[nodiscard]] BinaryError DecodeBinary(
+    const std::vector<std::byte>& message, std::vector<Quantity>& quantities) {
+  return DecodeBinary(message.data(), message.size(), quantities);
+}
+
+}  // namespace PhQ
+
+#endif  // PHQ_BINARY_HPP
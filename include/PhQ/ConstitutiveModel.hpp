@@ -25,10 +25,12 @@
 #ifndef PHQ_CONSTITUTIVE_MODEL_HPP
 #define PHQ_CONSTITUTIVE_MODEL_HPP
 
+#include <array>
 #include <cstddef>
 #include <functional>
 #include <ostream>
 #include <string>
+#include <utility>
 
 #include "Base.hpp"
 #include "Strain.hpp"
@@ -150,46 +152,70 @@ public:
   /// \brief Prints this constitutive model as a string.
   [[nodiscard]] virtual inline std::string Print() const = 0;
 
+  /// \brief Serializes this constitutive model as a JSON message and appends it to the given
+  /// string. Constitutive models override this to append their message without an intermediate
+  /// string. Member function templates cannot be virtual, so the WriteJSON member function that
+  /// writes through an output iterator is only defined on the concrete constitutive models.
+  virtual inline void AppendJSON(std::string& string) const {
+    string.append(JSON());
+  }
+
   /// \brief Serializes this constitutive model as a JSON message.
   [[nodiscard]] virtual inline std::string JSON() const = 0;
 
+  /// \brief Serializes this constitutive model as an XML message and appends it to the given
+  /// string. Constitutive models override this to append their message without an intermediate
+  /// string. Member function templates cannot be virtual, so the WriteXML member function that
+  /// writes through an output iterator is only defined on the concrete constitutive models.
+  virtual inline void AppendXML(std::string& string) const {
+    string.append(XML());
+  }
+
   /// \brief Serializes this constitutive model as an XML message.
   [[nodiscard]] virtual inline std::string XML() const = 0;
 
+  /// \brief Serializes this constitutive model as a YAML message and appends it to the given
+  /// string. Constitutive models override this to append their message without an intermediate
+  /// string. Member function templates cannot be virtual, so the WriteYAML member function that
+  /// writes through an output iterator is only defined on the concrete constitutive models.
+  virtual inline void AppendYAML(std::string& string) const {
+    string.append(YAML());
+  }
+
   /// \brief Serializes this constitutive model as a YAML message.
   [[nodiscard]] virtual inline std::string YAML() const = 0;
 };
 
 template <>
-inline const std::map<typename ConstitutiveModel::Type, std::string_view>
-    Internal::Abbreviations<typename ConstitutiveModel::Type>{
+inline constexpr std::array<std::pair<typename ConstitutiveModel::Type, std::string_view>, 3>
+    Internal::Abbreviations<typename ConstitutiveModel::Type>{{
+        {ConstitutiveModel::Type::CompressibleNewtonianFluid,   "Compressible Newtonian Fluid"  },
         {ConstitutiveModel::Type::ElasticIsotropicSolid,        "Elastic Isotropic Solid"       },
         {ConstitutiveModel::Type::IncompressibleNewtonianFluid, "Incompressible Newtonian Fluid"},
-        {ConstitutiveModel::Type::CompressibleNewtonianFluid,   "Compressible Newtonian Fluid"  },
-};
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, typename ConstitutiveModel::Type>
-    Internal::Spellings<typename ConstitutiveModel::Type>{
-        {"Elastic Isotropic Solid",        ConstitutiveModel::Type::ElasticIsotropicSolid       },
+inline constexpr std::array<std::pair<std::string_view, typename ConstitutiveModel::Type>, 18>
+    Internal::Spellings<typename ConstitutiveModel::Type>{{
+        {"COMPRESSIBLE NEWTONIAN FLUID",   ConstitutiveModel::Type::CompressibleNewtonianFluid  },
+        {"COMPRESSIBLE_NEWTONIAN_FLUID",   ConstitutiveModel::Type::CompressibleNewtonianFluid  },
+        {"Compressible Newtonian Fluid",   ConstitutiveModel::Type::CompressibleNewtonianFluid  },
+        {"CompressibleNewtonianFluid",     ConstitutiveModel::Type::CompressibleNewtonianFluid  },
         {"ELASTIC ISOTROPIC SOLID",        ConstitutiveModel::Type::ElasticIsotropicSolid       },
-        {"elastic isotropic solid",        ConstitutiveModel::Type::ElasticIsotropicSolid       },
-        {"ElasticIsotropicSolid",          ConstitutiveModel::Type::ElasticIsotropicSolid       },
         {"ELASTIC_ISOTROPIC_SOLID",        ConstitutiveModel::Type::ElasticIsotropicSolid       },
-        {"elastic_isotropic_solid",        ConstitutiveModel::Type::ElasticIsotropicSolid       },
-        {"Incompressible Newtonian Fluid", ConstitutiveModel::Type::IncompressibleNewtonianFluid},
+        {"Elastic Isotropic Solid",        ConstitutiveModel::Type::ElasticIsotropicSolid       },
+        {"ElasticIsotropicSolid",          ConstitutiveModel::Type::ElasticIsotropicSolid       },
         {"INCOMPRESSIBLE NEWTONIAN FLUID", ConstitutiveModel::Type::IncompressibleNewtonianFluid},
-        {"incompressible newtonian fluid", ConstitutiveModel::Type::IncompressibleNewtonianFluid},
-        {"IncompressibleNewtonianFluid",   ConstitutiveModel::Type::IncompressibleNewtonianFluid},
         {"INCOMPRESSIBLE_NEWTONIAN_FLUID", ConstitutiveModel::Type::IncompressibleNewtonianFluid},
-        {"incompressible_newtonian_fluid", ConstitutiveModel::Type::IncompressibleNewtonianFluid},
-        {"Compressible Newtonian Fluid",   ConstitutiveModel::Type::CompressibleNewtonianFluid  },
-        {"COMPRESSIBLE NEWTONIAN FLUID",   ConstitutiveModel::Type::CompressibleNewtonianFluid  },
+        {"Incompressible Newtonian Fluid", ConstitutiveModel::Type::IncompressibleNewtonianFluid},
+        {"IncompressibleNewtonianFluid",   ConstitutiveModel::Type::IncompressibleNewtonianFluid},
         {"compressible newtonian fluid",   ConstitutiveModel::Type::CompressibleNewtonianFluid  },
-        {"CompressibleNewtonianFluid",     ConstitutiveModel::Type::CompressibleNewtonianFluid  },
-        {"COMPRESSIBLE_NEWTONIAN_FLUID",   ConstitutiveModel::Type::CompressibleNewtonianFluid  },
         {"compressible_newtonian_fluid",   ConstitutiveModel::Type::CompressibleNewtonianFluid  },
-};
+        {"elastic isotropic solid",        ConstitutiveModel::Type::ElasticIsotropicSolid       },
+        {"elastic_isotropic_solid",        ConstitutiveModel::Type::ElasticIsotropicSolid       },
+        {"incompressible newtonian fluid", ConstitutiveModel::Type::IncompressibleNewtonianFluid},
+        {"incompressible_newtonian_fluid", ConstitutiveModel::Type::IncompressibleNewtonianFluid},
+}};
 
 inline std::ostream& operator<<(std::ostream& stream, const ConstitutiveModel& model) {
   stream << model.Print();
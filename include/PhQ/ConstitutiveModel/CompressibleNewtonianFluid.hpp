@@ -27,6 +27,7 @@
 
 #include <cstddef>
 #include <functional>
+#include <iterator>
 #include <ostream>
 #include <string>
 
@@ -312,25 +313,91 @@ public:
             + ", Bulk Dynamic Viscosity = " + bulk_dynamic_viscosity.Print()};
   }
 
+  /// \brief Serializes this compressible Newtonian fluid constitutive model as a JSON message and
+  /// appends it to the given string.
+  inline void AppendJSON(std::string& string) const override {
+    WriteJSON(std::back_inserter(string));
+  }
+
+  /// \brief Serializes this compressible Newtonian fluid constitutive model as a JSON message and
+  /// writes it through the given output iterator. Returns the output iterator one past the last
+  /// written character.
+  template <typename OutputIterator>
+  OutputIterator WriteJSON(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    string.append(R"({"type":")");
+    AppendSnakeCase(string, Abbreviation(this->GetType()));
+    string.append(R"(","dynamic_viscosity":)");
+    dynamic_viscosity.AppendJSON(string);
+    string.append(",\"bulk_dynamic_viscosity\":");
+    bulk_dynamic_viscosity.AppendJSON(string);
+    string.append("}");
+    return string.Output();
+  }
+
   /// \brief Serializes this compressible Newtonian fluid constitutive model as a JSON message.
   [[nodiscard]] inline std::string JSON() const override {
-    return {R"({"type":")" + SnakeCase(Abbreviation(this->GetType())) + R"(","dynamic_viscosity":)"
-            + dynamic_viscosity.JSON()
-            + ",\"bulk_dynamic_viscosity\":" + bulk_dynamic_viscosity.JSON() + "}"};
+    std::string string;
+    AppendJSON(string);
+    return string;
+  }
+
+  /// \brief Serializes this compressible Newtonian fluid constitutive model as an XML message and
+  /// appends it to the given string.
+  inline void AppendXML(std::string& string) const override {
+    WriteXML(std::back_inserter(string));
+  }
+
+  /// \brief Serializes this compressible Newtonian fluid constitutive model as an XML message and
+  /// writes it through the given output iterator. Returns the output iterator one past the last
+  /// written character.
+  template <typename OutputIterator>
+  OutputIterator WriteXML(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    string.append("<type>");
+    AppendSnakeCase(string, Abbreviation(this->GetType()));
+    string.append("</type><dynamic_viscosity>");
+    dynamic_viscosity.AppendXML(string);
+    string.append("</dynamic_viscosity><bulk_dynamic_viscosity>");
+    bulk_dynamic_viscosity.AppendXML(string);
+    string.append("</bulk_dynamic_viscosity>");
+    return string.Output();
   }
 
   /// \brief Serializes this compressible Newtonian fluid constitutive model as an XML message.
   [[nodiscard]] inline std::string XML() const override {
-    return {"<type>" + SnakeCase(Abbreviation(this->GetType())) + "</type><dynamic_viscosity>"
-            + dynamic_viscosity.XML() + "</dynamic_viscosity><bulk_dynamic_viscosity>"
-            + bulk_dynamic_viscosity.XML() + "</bulk_dynamic_viscosity>"};
+    std::string string;
+    AppendXML(string);
+    return string;
+  }
+
+  /// \brief Serializes this compressible Newtonian fluid constitutive model as a YAML message and
+  /// appends it to the given string.
+  inline void AppendYAML(std::string& string) const override {
+    WriteYAML(std::back_inserter(string));
+  }
+
+  /// \brief Serializes this compressible Newtonian fluid constitutive model as a YAML message and
+  /// writes it through the given output iterator. Returns the output iterator one past the last
+  /// written character.
+  template <typename OutputIterator>
+  OutputIterator WriteYAML(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    string.append("{type:\"");
+    AppendSnakeCase(string, Abbreviation(this->GetType()));
+    string.append("\",dynamic_viscosity:");
+    dynamic_viscosity.AppendYAML(string);
+    string.append(",bulk_dynamic_viscosity:");
+    bulk_dynamic_viscosity.AppendYAML(string);
+    string.append("}");
+    return string.Output();
   }
 
   /// \brief Serializes this compressible Newtonian fluid constitutive model as a YAML message.
   [[nodiscard]] inline std::string YAML() const override {
-    return {"{type:\"" + SnakeCase(Abbreviation(this->GetType()))
-            + "\",dynamic_viscosity:" + dynamic_viscosity.YAML()
-            + ",bulk_dynamic_viscosity:" + bulk_dynamic_viscosity.YAML() + "}"};
+    std::string string;
+    AppendYAML(string);
+    return string;
   }
 
 private:
@@ -28,6 +28,7 @@
 #include <cmath>
 #include <cstddef>
 #include <functional>
+#include <iterator>
 #include <ostream>
 #include <string>
 
@@ -556,23 +557,91 @@ public:
             + shear_modulus.Print() + ", Lamé's First Modulus = " + lame_first_modulus.Print()};
   }
 
+  /// \brief Serializes this elastic isotropic solid constitutive model as a JSON message and
+  /// appends it to the given string.
+  inline void AppendJSON(std::string& string) const override {
+    WriteJSON(std::back_inserter(string));
+  }
+
+  /// \brief Serializes this elastic isotropic solid constitutive model as a JSON message and writes
+  /// it through the given output iterator. Returns the output iterator one past the last written
+  /// character.
+  template <typename OutputIterator>
+  OutputIterator WriteJSON(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    string.append(R"({"type":")");
+    AppendSnakeCase(string, Abbreviation(this->GetType()));
+    string.append(R"(","shear_modulus":)");
+    shear_modulus.AppendJSON(string);
+    string.append(",\"lame_first_modulus\":");
+    lame_first_modulus.AppendJSON(string);
+    string.append("}");
+    return string.Output();
+  }
+
   /// \brief Serializes this elastic isotropic solid constitutive model as a JSON message.
   [[nodiscard]] inline std::string JSON() const override {
-    return {R"({"type":")" + SnakeCase(Abbreviation(this->GetType())) + R"(","shear_modulus":)"
-            + shear_modulus.JSON() + ",\"lame_first_modulus\":" + lame_first_modulus.JSON() + "}"};
+    std::string string;
+    AppendJSON(string);
+    return string;
+  }
+
+  /// \brief Serializes this elastic isotropic solid constitutive model as an XML message and
+  /// appends it to the given string.
+  inline void AppendXML(std::string& string) const override {
+    WriteXML(std::back_inserter(string));
+  }
+
+  /// \brief Serializes this elastic isotropic solid constitutive model as an XML message and writes
+  /// it through the given output iterator. Returns the output iterator one past the last written
+  /// character.
+  template <typename OutputIterator>
+  OutputIterator WriteXML(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    string.append("<type>");
+    AppendSnakeCase(string, Abbreviation(this->GetType()));
+    string.append("</type><shear_modulus>");
+    shear_modulus.AppendXML(string);
+    string.append("</shear_modulus><lame_first_modulus>");
+    lame_first_modulus.AppendXML(string);
+    string.append("</lame_first_modulus>");
+    return string.Output();
   }
 
   /// \brief Serializes this elastic isotropic solid constitutive model as an XML message.
   [[nodiscard]] inline std::string XML() const override {
-    return {"<type>" + SnakeCase(Abbreviation(this->GetType())) + "</type><shear_modulus>"
-            + shear_modulus.XML() + "</shear_modulus><lame_first_modulus>"
-            + lame_first_modulus.XML() + "</lame_first_modulus>"};
+    std::string string;
+    AppendXML(string);
+    return string;
+  }
+
+  /// \brief Serializes this elastic isotropic solid constitutive model as a YAML message and
+  /// appends it to the given string.
+  inline void AppendYAML(std::string& string) const override {
+    WriteYAML(std::back_inserter(string));
+  }
+
+  /// \brief Serializes this elastic isotropic solid constitutive model as a YAML message and writes
+  /// it through the given output iterator. Returns the output iterator one past the last written
+  /// character.
+  template <typename OutputIterator>
+  OutputIterator WriteYAML(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    string.append("{type:\"");
+    AppendSnakeCase(string, Abbreviation(this->GetType()));
+    string.append("\",shear_modulus:");
+    shear_modulus.AppendYAML(string);
+    string.append(",lame_first_modulus:");
+    lame_first_modulus.AppendYAML(string);
+    string.append("}");
+    return string.Output();
   }
 
   /// \brief Serializes this elastic isotropic solid constitutive model as a YAML message.
   [[nodiscard]] inline std::string YAML() const override {
-    return {"{type:\"" + SnakeCase(Abbreviation(this->GetType())) + "\",shear_modulus:"
-            + shear_modulus.YAML() + ",lame_first_modulus:" + lame_first_modulus.YAML() + "}"};
+    std::string string;
+    AppendYAML(string);
+    return string;
   }
 
 private:
@@ -0,0 +1,231 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_CONVERSION_PLAN_HPP
+#define PHQ_CONVERSION_PLAN_HPP
+
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+#if __cplusplus >= 202002L
+  #include <span>
+#endif
+
+#include "Dyad.hpp"
+#include "PlanarVector.hpp"
+#include "SymmetricDyad.hpp"
+#include "Unit.hpp"
+#include "Vector.hpp"
+
+namespace PhQ {
+
+/// \brief Conversion between two units of measure of the same type that are only known at runtime,
+/// resolved once and then applied any number of times. A conversion plan holds the coefficients of
+/// the fused affine map between its two units of measure, so applying it costs only one
+/// multiplication and one addition per value, with no lookup. This is useful when the units of
+/// measure of a data source are learned at runtime and many sequences of values must then be
+/// converted between the same two units of measure. For units of measure known at compile time, see
+/// PhQ::ConvertStatically.
+/// \tparam Unit Unit of measure enumeration type.
+/// \tparam NumericType Floating-point numeric type: float, double, or long double. Defaults to
+/// double if unspecified.
+template <typename Unit, typename NumericType = double>
+class ConversionPlan {
+  static_assert(std::is_floating_point<NumericType>::value,
+                "The NumericType template parameter of PhQ::ConversionPlan<Unit, NumericType> must "
+                "be a numeric floating-point type: float, double, or long double.");
+
+public:
+  /// \brief Default constructor. Constructs a conversion plan from the standard unit of measure to
+  /// itself. Applying this conversion plan leaves values unchanged.
+  constexpr ConversionPlan() noexcept
+    : original_unit_(Standard<Unit>), new_unit_(Standard<Unit>), conversion_() {}
+
+  /// \brief Constructor. Constructs a conversion plan from a given original unit of measure to a
+  /// given new unit of measure.
+  constexpr ConversionPlan(const Unit original_unit, const Unit new_unit) noexcept
+    : original_unit_(original_unit), new_unit_(new_unit),
+      conversion_(Internal::ConversionBetween<NumericType>(original_unit, new_unit)) {}
+
+  /// \brief Original unit of measure of this conversion plan. Values are converted from this unit.
+  [[nodiscard]] constexpr Unit OriginalUnit() const noexcept {
+    return original_unit_;
+  }
+
+  /// \brief New unit of measure of this conversion plan. Values are converted to this unit.
+  [[nodiscard]] constexpr Unit NewUnit() const noexcept {
+    return new_unit_;
+  }
+
+  /// \brief Multiplicative coefficient of this conversion plan. A value x expressed in the original
+  /// unit of measure is expressed as Scale() * x + Offset() in the new unit of measure.
+  [[nodiscard]] constexpr NumericType Scale() const noexcept {
+    return conversion_.Scale();
+  }
+
+  /// \brief Additive coefficient of this conversion plan. A value x expressed in the original unit
+  /// of measure is expressed as Scale() * x + Offset() in the new unit of measure.
+  [[nodiscard]] constexpr NumericType Offset() const noexcept {
+    return conversion_.Offset();
+  }
+
+  /// \brief Whether this conversion plan leaves values unchanged, which is the case when its
+  /// original and new units of measure are the same.
+  [[nodiscard]] constexpr bool IsIdentity() const noexcept {
+    return original_unit_ == new_unit_;
+  }
+
+  /// \brief Conversion plan in the opposite direction, from the new unit of measure to the original
+  /// unit of measure.
+  [[nodiscard]] constexpr ConversionPlan<Unit, NumericType> Inverse() const noexcept {
+    return ConversionPlan<Unit, NumericType>{new_unit_, original_unit_};
+  }
+
+  /// \brief Converts a value expressed in the original unit of measure to the new unit of measure.
+  /// The conversion is performed in-place.
+  constexpr void Apply(NumericType& value) const noexcept {
+    if (!IsIdentity()) {
+      conversion_.Apply(value);
+    }
+  }
+
+  /// \brief Converts a buffer of a given number of values expressed in the original unit of measure
+  /// to the new unit of measure. The conversion is performed in-place.
+  constexpr void Apply(NumericType* const values, const std::size_t size) const noexcept {
+    if (!IsIdentity()) {
+      conversion_.Apply(values, size);
+    }
+  }
+
+  /// \brief Converts a buffer of a given number of values expressed in the original unit of measure
+  /// to the new unit of measure and writes the converted values to a caller-provided output buffer
+  /// of the same size in a single pass. The input and output buffers must either be the same buffer
+  /// or not overlap.
+  constexpr void Apply(const NumericType* const input, NumericType* const output,
+                       const std::size_t size) const noexcept {
+    if (!IsIdentity()) {
+      conversion_.Apply(input, output, size);
+    } else if (input != output) {
+      for (std::size_t index = 0; index < size; ++index) {
+        output[index] = input[index];
+      }
+    }
+  }
+
+#if __cplusplus >= 202002L
+
+  /// \brief Converts a span of values expressed in the original unit of measure to the new unit of
+  /// measure. The conversion is performed in-place.
+  constexpr void Apply(const std::span<NumericType> values) const noexcept {
+    Apply(values.data(), values.size());
+  }
+
+  /// \brief Converts a span of values expressed in the original unit of measure to the new unit of
+  /// measure and writes the converted values to a caller-provided output span in a single pass. The
+  /// input and output spans must either be the same span or not overlap. Returns true if the values
+  /// are converted, or false without modifying the output span if the spans differ in size.
+  [[nodiscard]] constexpr bool Apply(const std::span<const NumericType> input,
+                                     const std::span<NumericType> output) const noexcept {
+    if (input.size() != output.size()) {
+      return false;
+    }
+    Apply(input.data(), output.data(), input.size());
+    return true;
+  }
+
+#endif  // __cplusplus >= 202002L
+
+  /// \brief Converts a vector of values expressed in the original unit of measure to the new unit
+  /// of measure. The conversion is performed in-place.
+  void Apply(std::vector<NumericType>& values) const noexcept {
+    Apply(values.data(), values.size());
+  }
+
+  /// \brief Converts a two-dimensional Euclidean planar vector in the XY plane expressed in the
+  /// original unit of measure to the new unit of measure. The conversion is performed in-place.
+  constexpr void Apply(PlanarVector<NumericType>& planar_vector) const noexcept {
+    Apply(planar_vector.Mutable_x_y().data(), 2);
+  }
+
+  /// \brief Converts a three-dimensional Euclidean vector expressed in the original unit of measure
+  /// to the new unit of measure. The conversion is performed in-place.
+  constexpr void Apply(Vector<NumericType>& vector) const noexcept {
+    Apply(vector.Mutable_x_y_z().data(), 3);
+  }
+
+  /// \brief Converts a three-dimensional Euclidean symmetric dyadic tensor expressed in the
+  /// original unit of measure to the new unit of measure. The conversion is performed in-place.
+  constexpr void Apply(SymmetricDyad<NumericType>& symmetric_dyad) const noexcept {
+    Apply(symmetric_dyad.Mutable_xx_xy_xz_yy_yz_zz().data(), 6);
+  }
+
+  /// \brief Converts a three-dimensional Euclidean dyadic tensor expressed in the original unit of
+  /// measure to the new unit of measure. The conversion is performed in-place.
+  constexpr void Apply(Dyad<NumericType>& dyad) const noexcept {
+    Apply(dyad.Mutable_xx_xy_xz_yx_yy_yz_zx_zy_zz().data(), 9);
+  }
+
+  /// \brief Converts a vector of two-dimensional Euclidean planar vectors in the XY plane expressed
+  /// in the original unit of measure to the new unit of measure. The conversion is performed
+  /// in-place in a single pass over the components of all elements.
+  void Apply(std::vector<PlanarVector<NumericType>>& planar_vectors) const noexcept {
+    Apply(Internal::Components(planar_vectors.data()), 2 * planar_vectors.size());
+  }
+
+  /// \brief Converts a vector of three-dimensional Euclidean vectors expressed in the original unit
+  /// of measure to the new unit of measure. The conversion is performed in-place in a single pass
+  /// over the components of all elements.
+  void Apply(std::vector<Vector<NumericType>>& vectors) const noexcept {
+    Apply(Internal::Components(vectors.data()), 3 * vectors.size());
+  }
+
+  /// \brief Converts a vector of three-dimensional Euclidean symmetric dyadic tensors expressed in
+  /// the original unit of measure to the new unit of measure. The conversion is performed in-place
+  /// in a single pass over the components of all elements.
+  void Apply(std::vector<SymmetricDyad<NumericType>>& symmetric_dyads) const noexcept {
+    Apply(Internal::Components(symmetric_dyads.data()), 6 * symmetric_dyads.size());
+  }
+
+  /// \brief Converts a vector of three-dimensional Euclidean dyadic tensors expressed in the
+  /// original unit of measure to the new unit of measure. The conversion is performed in-place in a
+  /// single pass over the components of all elements.
+  void Apply(std::vector<Dyad<NumericType>>& dyads) const noexcept {
+    Apply(Internal::Components(dyads.data()), 9 * dyads.size());
+  }
+
+private:
+  /// \brief Original unit of measure of this conversion plan.
+  Unit original_unit_;
+
+  /// \brief New unit of measure of this conversion plan.
+  Unit new_unit_;
+
+  /// \brief Fused affine map from the original unit of measure to the new unit of measure.
+  Internal::AffineConversion<NumericType> conversion_;
+};
+
+}  // namespace PhQ
+
+#endif  // PHQ_CONVERSION_PLAN_HPP
@@ -102,64 +102,178 @@ public:
     return PhQ::Print(Value(unit)).append(" ").append(PhQ::Abbreviation(unit));
   }
 
+  /// \brief Serializes this physical quantity as a JSON message and appends it to the given string.
+  /// This physical quantity's value is expressed in its standard unit of measure.
+  template <typename String>
+  void AppendJSON(String& string) const {
+    string.append("{\"value\":");
+    PhQ::AppendPrint(string, value);
+    string.append(R"(,"unit":")");
+    string.append(PhQ::Abbreviation(PhQ::Standard<UnitType>));
+    string.append("\"}");
+  }
+
+  /// \brief Serializes this physical quantity as a JSON message and writes it through the given
+  /// output iterator. This physical quantity's value is expressed in its standard unit of measure.
+  /// Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteJSON(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendJSON(string);
+    return string.Output();
+  }
+
   /// \brief Serializes this physical quantity as a JSON message. This physical quantity's value is
   /// expressed in its standard unit of measure.
   [[nodiscard]] std::string JSON() const {
-    return std::string{"{\"value\":"}
-        .append(PhQ::Print(value))
-        .append(R"(,"unit":")")
-        .append(PhQ::Abbreviation(PhQ::Standard<UnitType>))
-        .append("\"}");
+    std::string string;
+    AppendJSON(string);
+    return string;
+  }
+
+  /// \brief Serializes this physical quantity as a JSON message and appends it to the given string.
+  /// This physical quantity's value is expressed in the given unit of measure.
+  template <typename String>
+  void AppendJSON(String& string, const UnitType unit) const {
+    string.append("{\"value\":");
+    PhQ::AppendPrint(string, Value(unit));
+    string.append(R"(,"unit":")");
+    string.append(PhQ::Abbreviation(unit));
+    string.append("\"}");
+  }
+
+  /// \brief Serializes this physical quantity as a JSON message and writes it through the given
+  /// output iterator. This physical quantity's value is expressed in the given unit of measure.
+  /// Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteJSON(OutputIterator output, const UnitType unit) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendJSON(string, unit);
+    return string.Output();
   }
 
   /// \brief Serializes this physical quantity as a JSON message. This physical quantity's value is
   /// expressed in the given unit of measure.
   [[nodiscard]] std::string JSON(const UnitType unit) const {
-    return std::string{"{\"value\":"}
-        .append(PhQ::Print(Value(unit)))
-        .append(R"(,"unit":")")
-        .append(PhQ::Abbreviation(unit))
-        .append("\"}");
+    std::string string;
+    AppendJSON(string, unit);
+    return string;
+  }
+
+  /// \brief Serializes this physical quantity as an XML message and appends it to the given string.
+  /// This physical quantity's value is expressed in its standard unit of measure.
+  template <typename String>
+  void AppendXML(String& string) const {
+    string.append("<value>");
+    PhQ::AppendPrint(string, value);
+    string.append("</value><unit>");
+    string.append(PhQ::Abbreviation(PhQ::Standard<UnitType>));
+    string.append("</unit>");
+  }
+
+  /// \brief Serializes this physical quantity as an XML message and writes it through the given
+  /// output iterator. This physical quantity's value is expressed in its standard unit of measure.
+  /// Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteXML(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendXML(string);
+    return string.Output();
   }
 
   /// \brief Serializes this physical quantity as an XML message. This physical quantity's value is
   /// expressed in its standard unit of measure.
   [[nodiscard]] std::string XML() const {
-    return std::string{"<value>"}
-        .append(PhQ::Print(value))
-        .append("</value><unit>")
-        .append(PhQ::Abbreviation(PhQ::Standard<UnitType>))
-        .append("</unit>");
+    std::string string;
+    AppendXML(string);
+    return string;
+  }
+
+  /// \brief Serializes this physical quantity as an XML message and appends it to the given string.
+  /// This physical quantity's value is expressed in the given unit of measure.
+  template <typename String>
+  void AppendXML(String& string, const UnitType unit) const {
+    string.append("<value>");
+    PhQ::AppendPrint(string, Value(unit));
+    string.append("</value><unit>");
+    string.append(PhQ::Abbreviation(unit));
+    string.append("</unit>");
+  }
+
+  /// \brief Serializes this physical quantity as an XML message and writes it through the given
+  /// output iterator. This physical quantity's value is expressed in the given unit of measure.
+  /// Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteXML(OutputIterator output, const UnitType unit) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendXML(string, unit);
+    return string.Output();
   }
 
   /// \brief Serializes this physical quantity as an XML message. This physical quantity's value is
   /// expressed in the given unit of measure.
   [[nodiscard]] std::string XML(const UnitType unit) const {
-    return std::string{"<value>"}
-        .append(PhQ::Print(Value(unit)))
-        .append("</value><unit>")
-        .append(PhQ::Abbreviation(unit))
-        .append("</unit>");
+    std::string string;
+    AppendXML(string, unit);
+    return string;
+  }
+
+  /// \brief Serializes this physical quantity as a YAML message and appends it to the given string.
+  /// This physical quantity's value is expressed in its standard unit of measure.
+  template <typename String>
+  void AppendYAML(String& string) const {
+    string.append("{value:");
+    PhQ::AppendPrint(string, value);
+    string.append(",unit:\"");
+    string.append(PhQ::Abbreviation(PhQ::Standard<UnitType>));
+    string.append("\"}");
+  }
+
+  /// \brief Serializes this physical quantity as a YAML message and writes it through the given
+  /// output iterator. This physical quantity's value is expressed in its standard unit of measure.
+  /// Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteYAML(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendYAML(string);
+    return string.Output();
   }
 
   /// \brief Serializes this physical quantity as a YAML message. This physical quantity's value is
   /// expressed in its standard unit of measure.
   [[nodiscard]] std::string YAML() const {
-    return std::string{"{value:"}
-        .append(PhQ::Print(value))
-        .append(",unit:\"")
-        .append(PhQ::Abbreviation(PhQ::Standard<UnitType>))
-        .append("\"}");
+    std::string string;
+    AppendYAML(string);
+    return string;
+  }
+
+  /// \brief Serializes this physical quantity as a YAML message and appends it to the given string.
+  /// This physical quantity's value is expressed in the given unit of measure.
+  template <typename String>
+  void AppendYAML(String& string, const UnitType unit) const {
+    string.append("{value:");
+    PhQ::AppendPrint(string, Value(unit));
+    string.append(",unit:\"");
+    string.append(PhQ::Abbreviation(unit));
+    string.append("\"}");
+  }
+
+  /// \brief Serializes this physical quantity as a YAML message and writes it through the given
+  /// output iterator. This physical quantity's value is expressed in the given unit of measure.
+  /// Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteYAML(OutputIterator output, const UnitType unit) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendYAML(string, unit);
+    return string.Output();
   }
 
   /// \brief Serializes this physical quantity as a YAML message. This physical quantity's value is
   /// expressed in the given unit of measure.
   [[nodiscard]] std::string YAML(const UnitType unit) const {
-    return std::string{"{value:"}
-        .append(PhQ::Print(Value(unit)))
-        .append(",unit:\"")
-        .append(PhQ::Abbreviation(unit))
-        .append("\"}");
+    std::string string;
+    AppendYAML(string, unit);
+    return string;
   }
 
 protected:
@@ -29,6 +29,8 @@
 #include <functional>
 #include <ostream>
 #include <string>
+#include <type_traits>
+#include <vector>
 
 #include "Base.hpp"
 #include "Dimensions.hpp"
@@ -98,64 +100,178 @@ public:
     return Value(unit).Print().append(" ").append(PhQ::Abbreviation(unit));
   }
 
+  /// \brief Serializes this physical quantity as a JSON message and appends it to the given string.
+  /// This physical quantity's value is expressed in its standard unit of measure.
+  template <typename String>
+  void AppendJSON(String& string) const {
+    string.append("{\"value\":");
+    value.AppendJSON(string);
+    string.append(R"(,"unit":")");
+    string.append(PhQ::Abbreviation(PhQ::Standard<UnitType>));
+    string.append("\"}");
+  }
+
+  /// \brief Serializes this physical quantity as a JSON message and writes it through the given
+  /// output iterator. This physical quantity's value is expressed in its standard unit of measure.
+  /// Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteJSON(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendJSON(string);
+    return string.Output();
+  }
+
   /// \brief Serializes this physical quantity as a JSON message. This physical quantity's value is
   /// expressed in its standard unit of measure.
   [[nodiscard]] std::string JSON() const {
-    return std::string{"{\"value\":"}
-        .append(value.JSON())
-        .append(R"(,"unit":")")
-        .append(PhQ::Abbreviation(PhQ::Standard<UnitType>))
-        .append("\"}");
+    std::string string;
+    AppendJSON(string);
+    return string;
+  }
+
+  /// \brief Serializes this physical quantity as a JSON message and appends it to the given string.
+  /// This physical quantity's value is expressed in the given unit of measure.
+  template <typename String>
+  void AppendJSON(String& string, const UnitType unit) const {
+    string.append("{\"value\":");
+    Value(unit).AppendJSON(string);
+    string.append(R"(,"unit":")");
+    string.append(PhQ::Abbreviation(unit));
+    string.append("\"}");
+  }
+
+  /// \brief Serializes this physical quantity as a JSON message and writes it through the given
+  /// output iterator. This physical quantity's value is expressed in the given unit of measure.
+  /// Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteJSON(OutputIterator output, const UnitType unit) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendJSON(string, unit);
+    return string.Output();
   }
 
   /// \brief Serializes this physical quantity as a JSON message. This physical quantity's value is
   /// expressed in the given unit of measure.
   [[nodiscard]] std::string JSON(const UnitType unit) const {
-    return std::string{"{\"value\":"}
-        .append(Value(unit).JSON())
-        .append(R"(,"unit":")")
-        .append(PhQ::Abbreviation(unit))
-        .append("\"}");
+    std::string string;
+    AppendJSON(string, unit);
+    return string;
+  }
+
+  /// \brief Serializes this physical quantity as an XML message and appends it to the given string.
+  /// This physical quantity's value is expressed in its standard unit of measure.
+  template <typename String>
+  void AppendXML(String& string) const {
+    string.append("<value>");
+    value.AppendXML(string);
+    string.append("</value><unit>");
+    string.append(PhQ::Abbreviation(PhQ::Standard<UnitType>));
+    string.append("</unit>");
+  }
+
+  /// \brief Serializes this physical quantity as an XML message and writes it through the given
+  /// output iterator. This physical quantity's value is expressed in its standard unit of measure.
+  /// Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteXML(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendXML(string);
+    return string.Output();
   }
 
   /// \brief Serializes this physical quantity as an XML message. This physical quantity's value is
   /// expressed in its standard unit of measure.
   [[nodiscard]] std::string XML() const {
-    return std::string{"<value>"}
-        .append(value.XML())
-        .append("</value><unit>")
-        .append(PhQ::Abbreviation(PhQ::Standard<UnitType>))
-        .append("</unit>");
+    std::string string;
+    AppendXML(string);
+    return string;
+  }
+
+  /// \brief Serializes this physical quantity as an XML message and appends it to the given string.
+  /// This physical quantity's value is expressed in the given unit of measure.
+  template <typename String>
+  void AppendXML(String& string, const UnitType unit) const {
+    string.append("<value>");
+    Value(unit).AppendXML(string);
+    string.append("</value><unit>");
+    string.append(PhQ::Abbreviation(unit));
+    string.append("</unit>");
+  }
+
+  /// \brief Serializes this physical quantity as an XML message and writes it through the given
+  /// output iterator. This physical quantity's value is expressed in the given unit of measure.
+  /// Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteXML(OutputIterator output, const UnitType unit) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendXML(string, unit);
+    return string.Output();
   }
 
   /// \brief Serializes this physical quantity as an XML message. This physical quantity's value is
   /// expressed in the given unit of measure.
   [[nodiscard]] std::string XML(const UnitType unit) const {
-    return std::string{"<value>"}
-        .append(Value(unit).XML())
-        .append("</value><unit>")
-        .append(PhQ::Abbreviation(unit))
-        .append("</unit>");
+    std::string string;
+    AppendXML(string, unit);
+    return string;
+  }
+
+  /// \brief Serializes this physical quantity as a YAML message and appends it to the given string.
+  /// This physical quantity's value is expressed in its standard unit of measure.
+  template <typename String>
+  void AppendYAML(String& string) const {
+    string.append("{value:");
+    value.AppendYAML(string);
+    string.append(",unit:\"");
+    string.append(PhQ::Abbreviation(PhQ::Standard<UnitType>));
+    string.append("\"}");
+  }
+
+  /// \brief Serializes this physical quantity as a YAML message and writes it through the given
+  /// output iterator. This physical quantity's value is expressed in its standard unit of measure.
+  /// Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteYAML(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendYAML(string);
+    return string.Output();
   }
 
   /// \brief Serializes this physical quantity as a YAML message. This physical quantity's value is
   /// expressed in its standard unit of measure.
   [[nodiscard]] std::string YAML() const {
-    return std::string{"{value:"}
-        .append(value.YAML())
-        .append(",unit:\"")
-        .append(PhQ::Abbreviation(PhQ::Standard<UnitType>))
-        .append("\"}");
+    std::string string;
+    AppendYAML(string);
+    return string;
+  }
+
+  /// \brief Serializes this physical quantity as a YAML message and appends it to the given string.
+  /// This physical quantity's value is expressed in the given unit of measure.
+  template <typename String>
+  void AppendYAML(String& string, const UnitType unit) const {
+    string.append("{value:");
+    Value(unit).AppendYAML(string);
+    string.append(",unit:\"");
+    string.append(PhQ::Abbreviation(unit));
+    string.append("\"}");
+  }
+
+  /// \brief Serializes this physical quantity as a YAML message and writes it through the given
+  /// output iterator. This physical quantity's value is expressed in the given unit of measure.
+  /// Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteYAML(OutputIterator output, const UnitType unit) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendYAML(string, unit);
+    return string.Output();
   }
 
   /// \brief Serializes this physical quantity as a YAML message. This physical quantity's value is
   /// expressed in the given unit of measure.
   [[nodiscard]] std::string YAML(const UnitType unit) const {
-    return std::string{"{value:"}
-        .append(Value(unit).YAML())
-        .append(",unit:\"")
-        .append(PhQ::Abbreviation(unit))
-        .append("\"}");
+    std::string string;
+    AppendYAML(string, unit);
+    return string;
   }
 
 protected:
@@ -217,6 +333,73 @@ protected:
   PhQ::Vector<NumericType> value;
 };
 
+/// \brief Expresses a contiguous sequence of a given number of dimensional vector physical
+/// quantities, such as a velocity field, in a given unit of measure and writes their values to a
+/// caller-provided buffer of the same size. The conversion from the standard unit of measure is
+/// resolved once and the components of all physical quantities are converted in a single vectorized
+/// pass. The physical quantities remain unchanged.
+template <template <typename> class Quantity, typename NumericType, typename UnitType,
+          std::enable_if_t<std::is_base_of_v<DimensionalVector<UnitType, NumericType>,
+                                             Quantity<NumericType>>,
+                           bool> = true>
+inline void Values(const Quantity<NumericType>* const quantities, const std::size_t size,
+                   const UnitType unit, PhQ::Vector<NumericType>* const values) {
+  static_assert(sizeof(Quantity<NumericType>) == sizeof(PhQ::Vector<NumericType>),
+                "A physical quantity must hold nothing but its value.");
+  constexpr std::size_t components{Internal::NumberOfComponents<PhQ::Vector<NumericType>>};
+  PhQ::Convert(
+      Internal::Components(reinterpret_cast<const PhQ::Vector<NumericType>*>(quantities)),
+      Internal::Components(values), components * size, PhQ::Standard<UnitType>, unit);
+}
+
+/// \brief Expresses a vector of dimensional vector physical quantities, such as a velocity field,
+/// in a given unit of measure. Returns their values. The conversion from the standard unit of
+/// measure is resolved once and the components of all physical quantities are converted in a single
+/// vectorized pass. The physical quantities remain unchanged.
+template <template <typename> class Quantity, typename NumericType, typename UnitType,
+          std::enable_if_t<std::is_base_of_v<DimensionalVector<UnitType, NumericType>,
+                                             Quantity<NumericType>>,
+                           bool> = true>
+[[nodiscard]] inline std::vector<PhQ::Vector<NumericType>> Values(
+    const std::vector<Quantity<NumericType>>& quantities, const UnitType unit) {
+  std::vector<PhQ::Vector<NumericType>> values(quantities.size());
+  PhQ::Values(quantities.data(), quantities.size(), unit, values.data());
+  return values;
+}
+
+/// \brief Sets a contiguous sequence of a given number of dimensional vector physical quantities,
+/// such as a velocity field, from a caller-provided buffer of the same size of values expressed in
+/// a given unit of measure. The conversion to the standard unit of measure is resolved once and the
+/// components of all values are converted in a single vectorized pass. The values remain unchanged.
+template <template <typename> class Quantity, typename NumericType, typename UnitType,
+          std::enable_if_t<std::is_base_of_v<DimensionalVector<UnitType, NumericType>,
+                                             Quantity<NumericType>>,
+                           bool> = true>
+inline void SetValues(const PhQ::Vector<NumericType>* const values, const std::size_t size,
+                      const UnitType unit, Quantity<NumericType>* const quantities) {
+  static_assert(sizeof(Quantity<NumericType>) == sizeof(PhQ::Vector<NumericType>),
+                "A physical quantity must hold nothing but its value.");
+  constexpr std::size_t components{Internal::NumberOfComponents<PhQ::Vector<NumericType>>};
+  PhQ::Convert(Internal::Components(values),
+               Internal::Components(reinterpret_cast<PhQ::Vector<NumericType>*>(quantities)),
+               components * size, unit, PhQ::Standard<UnitType>);
+}
+
+/// \brief Sets a vector of dimensional vector physical quantities, such as a velocity field, from a
+/// vector of values expressed in a given unit of measure. The vector of physical quantities is
+/// resized to the number of values. The conversion to the standard unit of measure is resolved once
+/// and the components of all values are converted in a single vectorized pass. The values remain
+/// unchanged.
+template <template <typename> class Quantity, typename NumericType, typename UnitType,
+          std::enable_if_t<std::is_base_of_v<DimensionalVector<UnitType, NumericType>,
+                                             Quantity<NumericType>>,
+                           bool> = true>
+inline void SetValues(const std::vector<PhQ::Vector<NumericType>>& values,
+                      const UnitType unit, std::vector<Quantity<NumericType>>& quantities) {
+  quantities.resize(values.size());
+  PhQ::SetValues(values.data(), values.size(), unit, quantities.data());
+}
+
 }  // namespace PhQ
 
 #endif  // PHQ_DIMENSIONAL_VECTOR_HPP
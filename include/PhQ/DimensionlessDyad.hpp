@@ -77,19 +77,70 @@ public:
     return value.Print();
   }
 
+  /// \brief Serializes this physical quantity as a JSON message and appends it to the given string.
+  template <typename String>
+  void AppendJSON(String& string) const {
+    value.AppendJSON(string);
+  }
+
+  /// \brief Serializes this physical quantity as a JSON message and writes it through the given
+  /// output iterator. Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteJSON(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendJSON(string);
+    return string.Output();
+  }
+
   /// \brief Serializes this physical quantity as a JSON message.
   [[nodiscard]] std::string JSON() const {
-    return value.JSON();
+    std::string string;
+    AppendJSON(string);
+    return string;
+  }
+
+  /// \brief Serializes this physical quantity as an XML message and appends it to the given string.
+  template <typename String>
+  void AppendXML(String& string) const {
+    value.AppendXML(string);
+  }
+
+  /// \brief Serializes this physical quantity as an XML message and writes it through the given
+  /// output iterator. Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteXML(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendXML(string);
+    return string.Output();
   }
 
   /// \brief Serializes this physical quantity as an XML message.
   [[nodiscard]] std::string XML() const {
-    return value.XML();
+    std::string string;
+    AppendXML(string);
+    return string;
+  }
+
+  /// \brief Serializes this physical quantity as a YAML message and appends it to the given string.
+  template <typename String>
+  void AppendYAML(String& string) const {
+    value.AppendYAML(string);
+  }
+
+  /// \brief Serializes this physical quantity as a YAML message and writes it through the given
+  /// output iterator. Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteYAML(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendYAML(string);
+    return string.Output();
   }
 
   /// \brief Serializes this physical quantity as a YAML message.
   [[nodiscard]] std::string YAML() const {
-    return value.YAML();
+    std::string string;
+    AppendYAML(string);
+    return string;
   }
 
 protected:
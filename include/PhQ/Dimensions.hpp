@@ -167,145 +167,162 @@ public:
     return string;
   }
 
+  /// \brief Serializes this physical dimension set as a JSON message and appends it to the given
+  /// string.
+  template <typename String>
+  void AppendJSON(String& string) const {
+    string.push_back('{');
+    bool separator{false};
+    AppendJSONEntry(string, separator, Dimension::Time::Label(), time.Value());
+    AppendJSONEntry(string, separator, Dimension::Length::Label(), length.Value());
+    AppendJSONEntry(string, separator, Dimension::Mass::Label(), mass.Value());
+    AppendJSONEntry(
+        string, separator, Dimension::ElectricCurrent::Label(), electric_current.Value());
+    AppendJSONEntry(string, separator, Dimension::Temperature::Label(), temperature.Value());
+    AppendJSONEntry(
+        string, separator, Dimension::SubstanceAmount::Label(), substance_amount.Value());
+    AppendJSONEntry(
+        string, separator, Dimension::LuminousIntensity::Label(), luminous_intensity.Value());
+    string.push_back('}');
+  }
+
+  /// \brief Serializes this physical dimension set as a JSON message and writes it through the
+  /// given output iterator. Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteJSON(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendJSON(string);
+    return string.Output();
+  }
+
   /// \brief Serializes this physical dimension set as a JSON message.
   [[nodiscard]] std::string JSON() const {
-    std::string message;
-    if (time.Value() != 0) {
-      message.append(
-          "\"" + SnakeCase(Dimension::Time::Label()) + "\":" + std::to_string(time.Value()));
-    }
-    if (length.Value() != 0) {
-      if (!message.empty()) {
-        message.append(",");
-      }
-      message.append(
-          "\"" + SnakeCase(Dimension::Length::Label()) + "\":" + std::to_string(length.Value()));
-    }
-    if (mass.Value() != 0) {
-      if (!message.empty()) {
-        message.append(",");
-      }
-      message.append(
-          "\"" + SnakeCase(Dimension::Mass::Label()) + "\":" + std::to_string(mass.Value()));
-    }
-    if (electric_current.Value() != 0) {
-      if (!message.empty()) {
-        message.append(",");
-      }
-      message.append("\"" + SnakeCase(Dimension::ElectricCurrent::Label())
-                     + "\":" + std::to_string(electric_current.Value()));
-    }
-    if (temperature.Value() != 0) {
-      if (!message.empty()) {
-        message.append(",");
-      }
-      message.append("\"" + SnakeCase(Dimension::Temperature::Label())
-                     + "\":" + std::to_string(temperature.Value()));
-    }
-    if (substance_amount.Value() != 0) {
-      if (!message.empty()) {
-        message.append(",");
-      }
-      message.append("\"" + SnakeCase(Dimension::SubstanceAmount::Label())
-                     + "\":" + std::to_string(substance_amount.Value()));
-    }
-    if (luminous_intensity.Value() != 0) {
-      if (!message.empty()) {
-        message.append(",");
-      }
-      message.append("\"" + SnakeCase(Dimension::LuminousIntensity::Label())
-                     + "\":" + std::to_string(luminous_intensity.Value()));
-    }
-    return "{" + message + "}";
+    std::string string;
+    AppendJSON(string);
+    return string;
+  }
+
+  /// \brief Serializes this physical dimension set as an XML message and appends it to the given
+  /// string.
+  template <typename String>
+  void AppendXML(String& string) const {
+    AppendXMLEntry(string, Dimension::Time::Label(), time.Value());
+    AppendXMLEntry(string, Dimension::Length::Label(), length.Value());
+    AppendXMLEntry(string, Dimension::Mass::Label(), mass.Value());
+    AppendXMLEntry(string, Dimension::ElectricCurrent::Label(), electric_current.Value());
+    AppendXMLEntry(string, Dimension::Temperature::Label(), temperature.Value());
+    AppendXMLEntry(string, Dimension::SubstanceAmount::Label(), substance_amount.Value());
+    AppendXMLEntry(string, Dimension::LuminousIntensity::Label(), luminous_intensity.Value());
+  }
+
+  /// \brief Serializes this physical dimension set as an XML message and writes it through the
+  /// given output iterator. Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteXML(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendXML(string);
+    return string.Output();
   }
 
   /// \brief Serializes this physical dimension set as an XML message.
   [[nodiscard]] std::string XML() const {
-    std::string message;
-    if (time.Value() != 0) {
-      const std::string label{SnakeCase(Dimension::Time::Label())};
-      message.append("<" + label + ">" + std::to_string(time.Value()) + "</" + label + ">");
-    }
-    if (length.Value() != 0) {
-      const std::string label{SnakeCase(Dimension::Length::Label())};
-      message.append("<" + label + ">" + std::to_string(length.Value()) + "</" + label + ">");
-    }
-    if (mass.Value() != 0) {
-      const std::string label{SnakeCase(Dimension::Mass::Label())};
-      message.append("<" + label + ">" + std::to_string(mass.Value()) + "</" + label + ">");
-    }
-    if (electric_current.Value() != 0) {
-      const std::string label{SnakeCase(Dimension::ElectricCurrent::Label())};
-      message.append(
-          "<" + label + ">" + std::to_string(electric_current.Value()) + "</" + label + ">");
-    }
-    if (temperature.Value() != 0) {
-      const std::string label{SnakeCase(Dimension::Temperature::Label())};
-      message.append("<" + label + ">" + std::to_string(temperature.Value()) + "</" + label + ">");
-    }
-    if (substance_amount.Value() != 0) {
-      const std::string label{SnakeCase(Dimension::SubstanceAmount::Label())};
-      message.append(
-          "<" + label + ">" + std::to_string(substance_amount.Value()) + "</" + label + ">");
-    }
-    if (luminous_intensity.Value() != 0) {
-      const std::string label{SnakeCase(Dimension::LuminousIntensity::Label())};
-      message.append(
-          "<" + label + ">" + std::to_string(luminous_intensity.Value()) + "</" + label + ">");
-    }
-    return message;
+    std::string string;
+    AppendXML(string);
+    return string;
+  }
+
+  /// \brief Serializes this physical dimension set as a YAML message and appends it to the given
+  /// string.
+  template <typename String>
+  void AppendYAML(String& string) const {
+    string.push_back('{');
+    bool separator{false};
+    AppendYAMLEntry(string, separator, Dimension::Time::Label(), time.Value());
+    AppendYAMLEntry(string, separator, Dimension::Length::Label(), length.Value());
+    AppendYAMLEntry(string, separator, Dimension::Mass::Label(), mass.Value());
+    AppendYAMLEntry(
+        string, separator, Dimension::ElectricCurrent::Label(), electric_current.Value());
+    AppendYAMLEntry(string, separator, Dimension::Temperature::Label(), temperature.Value());
+    AppendYAMLEntry(
+        string, separator, Dimension::SubstanceAmount::Label(), substance_amount.Value());
+    AppendYAMLEntry(
+        string, separator, Dimension::LuminousIntensity::Label(), luminous_intensity.Value());
+    string.push_back('}');
+  }
+
+  /// \brief Serializes this physical dimension set as a YAML message and writes it through the
+  /// given output iterator. Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteYAML(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendYAML(string);
+    return string.Output();
   }
 
   /// \brief Serializes this physical dimension set as a YAML message.
   [[nodiscard]] std::string YAML() const {
-    std::string message;
-    if (time.Value() != 0) {
-      message.append(SnakeCase(Dimension::Time::Label()) + ":" + std::to_string(time.Value()));
-    }
-    if (length.Value() != 0) {
-      if (!message.empty()) {
-        message.append(",");
-      }
-      message.append(SnakeCase(Dimension::Length::Label()) + ":" + std::to_string(length.Value()));
-    }
-    if (mass.Value() != 0) {
-      if (!message.empty()) {
-        message.append(",");
-      }
-      message.append(SnakeCase(Dimension::Mass::Label()) + ":" + std::to_string(mass.Value()));
-    }
-    if (electric_current.Value() != 0) {
-      if (!message.empty()) {
-        message.append(",");
-      }
-      message.append(SnakeCase(Dimension::ElectricCurrent::Label()) + ":"
-                     + std::to_string(electric_current.Value()));
-    }
-    if (temperature.Value() != 0) {
-      if (!message.empty()) {
-        message.append(",");
+    std::string string;
+    AppendYAML(string);
+    return string;
+  }
+
+private:
+  /// \brief Appends the given value of a base physical dimension to the given string.
+  template <typename String>
+  static void AppendValue(String& string, const int8_t value) {
+    char buffer[4];
+    const std::to_chars_result result{std::to_chars(buffer, buffer + 4, value)};
+    string.append(buffer, result.ptr);
+  }
+
+  /// \brief Appends the given base physical dimension to the given string as a JSON key-value
+  /// pair, unless its value is zero. Prepends a comma if a previous pair was appended.
+  template <typename String>
+  static void AppendJSONEntry(
+      String& string, bool& separator, const std::string_view label, const int8_t value) {
+    if (value != 0) {
+      if (separator) {
+        string.push_back(',');
       }
-      message.append(
-          SnakeCase(Dimension::Temperature::Label()) + ":" + std::to_string(temperature.Value()));
+      string.push_back('"');
+      AppendSnakeCase(string, label);
+      string.append("\":");
+      AppendValue(string, value);
+      separator = true;
     }
-    if (substance_amount.Value() != 0) {
-      if (!message.empty()) {
-        message.append(",");
-      }
-      message.append(SnakeCase(Dimension::SubstanceAmount::Label()) + ":"
-                     + std::to_string(substance_amount.Value()));
+  }
+
+  /// \brief Appends the given base physical dimension to the given string as an XML element,
+  /// unless its value is zero.
+  template <typename String>
+  static void AppendXMLEntry(String& string, const std::string_view label, const int8_t value) {
+    if (value != 0) {
+      string.push_back('<');
+      AppendSnakeCase(string, label);
+      string.push_back('>');
+      AppendValue(string, value);
+      string.append("</");
+      AppendSnakeCase(string, label);
+      string.push_back('>');
     }
-    if (luminous_intensity.Value() != 0) {
-      if (!message.empty()) {
-        message.append(",");
+  }
+
+  /// \brief Appends the given base physical dimension to the given string as a YAML key-value
+  /// pair, unless its value is zero. Prepends a comma if a previous pair was appended.
+  template <typename String>
+  static void AppendYAMLEntry(
+      String& string, bool& separator, const std::string_view label, const int8_t value) {
+    if (value != 0) {
+      if (separator) {
+        string.push_back(',');
       }
-      message.append(SnakeCase(Dimension::LuminousIntensity::Label()) + ":"
-                     + std::to_string(luminous_intensity.Value()));
+      AppendSnakeCase(string, label);
+      string.push_back(':');
+      AppendValue(string, value);
+      separator = true;
     }
-    return "{" + message + "}";
   }
 
-private:
   /// \brief Base physical dimension of time of this physical dimension set.
   Dimension::Time time;
 
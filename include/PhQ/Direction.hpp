@@ -378,6 +378,19 @@ inline PhQ::Direction<NumericType> Vector<NumericType>::Direction() const {
   return PhQ::Direction<NumericType>{*this};
 }
 
+template <typename NumericType>
+inline std::array<PhQ::Direction<NumericType>, 3> SymmetricDyad<NumericType>::Eigenvectors() const {
+  std::array<NumericType, 3> eigenvalues;
+  std::array<NumericType, 9> eigenvectors;
+  Internal::SymmetricDyadEigensystem(xx(), xy(), xz(), yy(), yz(), zz(), eigenvalues[0],
+                                     eigenvalues[1], eigenvalues[2], eigenvectors);
+  return {
+      PhQ::Direction<NumericType>{eigenvectors[0], eigenvectors[1], eigenvectors[2]},
+      PhQ::Direction<NumericType>{eigenvectors[3], eigenvectors[4], eigenvectors[5]},
+      PhQ::Direction<NumericType>{eigenvectors[6], eigenvectors[7], eigenvectors[8]},
+  };
+}
+
 template <typename NumericType>
 inline constexpr NumericType Vector<NumericType>::Dot(
     const PhQ::Direction<NumericType>& direction) const noexcept {
@@ -389,28 +389,127 @@ public:
            + PhQ::Print(zx()) + ", " + PhQ::Print(zy()) + ", " + PhQ::Print(zz()) + ")";
   }
 
+  /// \brief Serializes this three-dimensional dyadic tensor as a JSON message and appends it to the
+  /// given string.
+  template <typename String>
+  void AppendJSON(String& string) const {
+    string.append("{\"xx\":");
+    PhQ::AppendPrint(string, xx());
+    string.append(",\"xy\":");
+    PhQ::AppendPrint(string, xy());
+    string.append(",\"xz\":");
+    PhQ::AppendPrint(string, xz());
+    string.append(",\"yx\":");
+    PhQ::AppendPrint(string, yx());
+    string.append(",\"yy\":");
+    PhQ::AppendPrint(string, yy());
+    string.append(",\"yz\":");
+    PhQ::AppendPrint(string, yz());
+    string.append(",\"zx\":");
+    PhQ::AppendPrint(string, zx());
+    string.append(",\"zy\":");
+    PhQ::AppendPrint(string, zy());
+    string.append(",\"zz\":");
+    PhQ::AppendPrint(string, zz());
+    string.append("}");
+  }
+
+  /// \brief Serializes this three-dimensional dyadic tensor as a JSON message and writes it through
+  /// the given output iterator. Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteJSON(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendJSON(string);
+    return string.Output();
+  }
+
   /// \brief Serializes this three-dimensional dyadic tensor as a JSON message.
   [[nodiscard]] std::string JSON() const {
-    return "{\"xx\":" + PhQ::Print(xx()) + ",\"xy\":" + PhQ::Print(xy()) + ",\"xz\":"
-           + PhQ::Print(xz()) + ",\"yx\":" + PhQ::Print(yx()) + ",\"yy\":" + PhQ::Print(yy())
-           + ",\"yz\":" + PhQ::Print(yz()) + ",\"zx\":" + PhQ::Print(zx())
-           + ",\"zy\":" + PhQ::Print(zy()) + ",\"zz\":" + PhQ::Print(zz()) + "}";
+    std::string string;
+    AppendJSON(string);
+    return string;
+  }
+
+  /// \brief Serializes this three-dimensional dyadic tensor as an XML message and appends it to the
+  /// given string.
+  template <typename String>
+  void AppendXML(String& string) const {
+    string.append("<xx>");
+    PhQ::AppendPrint(string, xx());
+    string.append("</xx><xy>");
+    PhQ::AppendPrint(string, xy());
+    string.append("</xy><xz>");
+    PhQ::AppendPrint(string, xz());
+    string.append("</xz><yx>");
+    PhQ::AppendPrint(string, yx());
+    string.append("</yx><yy>");
+    PhQ::AppendPrint(string, yy());
+    string.append("</yy><yz>");
+    PhQ::AppendPrint(string, yz());
+    string.append("</yz><zx>");
+    PhQ::AppendPrint(string, zx());
+    string.append("</zx><zy>");
+    PhQ::AppendPrint(string, zy());
+    string.append("</zy><zz>");
+    PhQ::AppendPrint(string, zz());
+    string.append("</zz>");
+  }
+
+  /// \brief Serializes this three-dimensional dyadic tensor as an XML message and writes it through
+  /// the given output iterator. Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteXML(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendXML(string);
+    return string.Output();
   }
 
   /// \brief Serializes this three-dimensional dyadic tensor as an XML message.
   [[nodiscard]] std::string XML() const {
-    return "<xx>" + PhQ::Print(xx()) + "</xx><xy>" + PhQ::Print(xy()) + "</xy><xz>"
-           + PhQ::Print(xz()) + "</xz><yx>" + PhQ::Print(yx()) + "</yx><yy>" + PhQ::Print(yy())
-           + "</yy><yz>" + PhQ::Print(yz()) + "</yz><zx>" + PhQ::Print(zx()) + "</zx><zy>"
-           + PhQ::Print(zy()) + "</zy><zz>" + PhQ::Print(zz()) + "</zz>";
+    std::string string;
+    AppendXML(string);
+    return string;
+  }
+
+  /// \brief Serializes this three-dimensional dyadic tensor as a YAML message and appends it to the
+  /// given string.
+  template <typename String>
+  void AppendYAML(String& string) const {
+    string.append("{xx:");
+    PhQ::AppendPrint(string, xx());
+    string.append(",xy:");
+    PhQ::AppendPrint(string, xy());
+    string.append(",xz:");
+    PhQ::AppendPrint(string, xz());
+    string.append(",yx:");
+    PhQ::AppendPrint(string, yx());
+    string.append(",yy:");
+    PhQ::AppendPrint(string, yy());
+    string.append(",yz:");
+    PhQ::AppendPrint(string, yz());
+    string.append(",zx:");
+    PhQ::AppendPrint(string, zx());
+    string.append(",zy:");
+    PhQ::AppendPrint(string, zy());
+    string.append(",zz:");
+    PhQ::AppendPrint(string, zz());
+    string.append("}");
+  }
+
+  /// \brief Serializes this three-dimensional dyadic tensor as a YAML message and writes it through
+  /// the given output iterator. Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteYAML(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendYAML(string);
+    return string.Output();
   }
 
   /// \brief Serializes this three-dimensional dyadic tensor as a YAML message.
   [[nodiscard]] std::string YAML() const {
-    return "{xx:" + PhQ::Print(xx()) + ",xy:" + PhQ::Print(xy()) + ",xz:" + PhQ::Print(xz())
-           + ",yx:" + PhQ::Print(yx()) + ",yy:" + PhQ::Print(yy()) + ",yz:" + PhQ::Print(yz())
-           + ",zx:" + PhQ::Print(zx()) + ",zy:" + PhQ::Print(zy()) + ",zz:" + PhQ::Print(zz())
-           + "}";
+    std::string string;
+    AppendYAML(string);
+    return string;
   }
 
   /// \brief Adds another three-dimensional dyadic tensor to this one.
@@ -711,9 +810,18 @@ inline std::ostream& operator<<(std::ostream& stream, const Dyad<NumericType>& d
 
 template <typename NumericType>
 inline constexpr std::optional<Dyad<NumericType>> Dyad<NumericType>::Inverse() const {
-  const NumericType determinant_{Determinant()};
+  // The determinant is the expansion of the cofactors along the first row, so the cofactors are
+  // computed only once, and the adjugate is their transpose.
+  const Dyad<NumericType> cofactors{Cofactors()};
+  const NumericType determinant_{
+      xx() * cofactors.xx() + xy() * cofactors.xy() + xz() * cofactors.xz()};
   if (determinant_ != static_cast<NumericType>(0)) {
-    return std::optional<Dyad<NumericType>>{Adjugate() / determinant_};
+    return std::optional<Dyad<NumericType>>{Dyad<NumericType>{
+        cofactors.xx() / determinant_, cofactors.yx() / determinant_,
+        cofactors.zx() / determinant_, cofactors.xy() / determinant_,
+        cofactors.yy() / determinant_, cofactors.zy() / determinant_,
+        cofactors.xz() / determinant_, cofactors.yz() / determinant_,
+        cofactors.zz() / determinant_}};
   }
   return std::nullopt;
 }
@@ -0,0 +1,861 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_DYAD_FIELD_HPP
+#define PHQ_DYAD_FIELD_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "AlignedAllocator.hpp"
+#include "DimensionalDyad.hpp"
+#include "DimensionlessDyad.hpp"
+#include "Dyad.hpp"
+#include "Simd.hpp"
+#include "Vector.hpp"
+#include "VectorField.hpp"
+
+namespace PhQ {
+
+namespace Internal {
+
+/// \brief Properties of an element of a PhQ::DyadField. The unit of measure type is void for
+/// dimensionless elements. Internal implementation detail not intended to be used outside of the
+/// PhQ::DyadField class.
+template <typename Unit, typename Numeric>
+struct DyadFieldTraits {
+  using UnitType = Unit;
+
+  using NumericType = Numeric;
+};
+
+// The following functions are only declared. They are used in unevaluated contexts to deduce the
+// properties of an element of a dyadic tensor field from its base class.
+
+template <typename UnitType, typename NumericType>
+DyadFieldTraits<UnitType, NumericType> DeduceDyadFieldTraits(
+    const DimensionalDyad<UnitType, NumericType>*);
+
+template <typename NumericType>
+DyadFieldTraits<void, NumericType> DeduceDyadFieldTraits(const DimensionlessDyad<NumericType>*);
+
+template <typename NumericType>
+DyadFieldTraits<void, NumericType> DeduceDyadFieldTraits(const Dyad<NumericType>*);
+
+/// \brief Conversions between an element of a PhQ::DyadField and its xx, xy, xz, yx, yy, yz, zx,
+/// zy, and zz Cartesian components. Handles physical quantities derived from PhQ::DimensionalDyad
+/// or PhQ::DimensionlessDyad, and PhQ::Dyad itself. Internal implementation detail not intended to
+/// be used outside of the PhQ::DyadField class.
+template <typename Type>
+struct DyadFieldElement {
+  using Traits = decltype(DeduceDyadFieldTraits(static_cast<const Type*>(nullptr)));
+
+  using UnitType = typename Traits::UnitType;
+
+  using NumericType = typename Traits::NumericType;
+
+  [[nodiscard]] static constexpr Type Make(const std::array<NumericType, 9>& components) {
+    if constexpr (std::is_same_v<Type, Dyad<NumericType>>) {
+      return Dyad<NumericType>{components};
+    } else if constexpr (std::is_void_v<UnitType>) {
+      return Type{Dyad<NumericType>{components}};
+    } else {
+      return Type::template Create<Standard<UnitType>>(components);
+    }
+  }
+
+  [[nodiscard]] static constexpr const Dyad<NumericType>& Value(const Type& element) noexcept {
+    if constexpr (std::is_same_v<Type, Dyad<NumericType>>) {
+      return element;
+    } else {
+      return element.Value();
+    }
+  }
+};
+
+/// \brief Type of the elements of the field that results from multiplying the elements of a
+/// PhQ::DyadField of a given type by those of a PhQ::VectorField of a given type. A dimensionless
+/// dyadic tensor preserves the type of the vector; otherwise, the result is a PhQ::Vector
+/// expressed in the product of the standard units of measure of the operands. Internal
+/// implementation detail not intended to be used outside of the PhQ::DyadField class.
+template <typename Quantity, typename VectorQuantity>
+using DyadVectorProductType =
+    std::conditional_t<std::is_void_v<typename DyadFieldElement<Quantity>::UnitType>,
+                       VectorQuantity, Vector<typename DyadFieldElement<Quantity>::NumericType>>;
+
+/// \brief Type of the elements of the field that results from multiplying the elements of a
+/// PhQ::DyadField of a given type by those of another PhQ::DyadField of a given type. A
+/// dimensionless dyadic tensor preserves the type of the other dyadic tensor; otherwise, the result
+/// is a PhQ::Dyad expressed in the product of the standard units of measure of the operands.
+/// Internal implementation detail not intended to be used outside of the PhQ::DyadField class.
+template <typename Left, typename Right>
+using DyadProductType = std::conditional_t<
+    std::is_void_v<typename DyadFieldElement<Left>::UnitType>, Right,
+    std::conditional_t<std::is_void_v<typename DyadFieldElement<Right>::UnitType>, Left,
+                       Dyad<typename DyadFieldElement<Left>::NumericType>>>;
+
+/// \brief Computes the determinants of a given number of dyadic tensors stored as component arrays.
+/// The output must not overlap the inputs. Internal implementation detail not intended to be used
+/// outside of the PhQ::DyadField class.
+template <typename NumericType>
+PHQ_ALWAYS_INLINE inline void DyadDeterminantKernel(
+    const NumericType* PHQ_RESTRICT xx, const NumericType* PHQ_RESTRICT xy,
+    const NumericType* PHQ_RESTRICT xz, const NumericType* PHQ_RESTRICT yx,
+    const NumericType* PHQ_RESTRICT yy, const NumericType* PHQ_RESTRICT yz,
+    const NumericType* PHQ_RESTRICT zx, const NumericType* PHQ_RESTRICT zy,
+    const NumericType* PHQ_RESTRICT zz, NumericType* PHQ_RESTRICT output,
+    const std::size_t size) noexcept {
+  for (std::size_t index = 0; index < size; ++index) {
+    output[index] = xx[index] * (yy[index] * zz[index] - yz[index] * zy[index])
+                    + xy[index] * (yz[index] * zx[index] - yx[index] * zz[index])
+                    + xz[index] * (yx[index] * zy[index] - yy[index] * zx[index]);
+  }
+}
+
+/// \brief Computes the inverses of a given number of dyadic tensors stored as component arrays as
+/// their adjugates divided by their determinants, like PhQ::Dyad::Inverse. Since this library is
+/// built with -ffast-math, the compiler may still replace either division with a multiplication by
+/// a reciprocal, so both results can differ in the last bit. A singular tensor, whose determinant
+/// is zero, is divided by one instead, its inverse is set to zero, and bit index % 64 of word
+/// index / 64 of the singular bitmask is set for it; that bitmask must hold (size + 63) / 64 words.
+/// The loop runs over blocks of 64 tensors so that each block's bits are accumulated in a register
+/// and written once. The outputs must not overlap the inputs. Internal implementation detail not
+/// intended to be used outside of the PhQ::DyadField class.
+template <typename NumericType>
+PHQ_ALWAYS_INLINE inline void DyadInverseKernel(
+    const NumericType* PHQ_RESTRICT xx, const NumericType* PHQ_RESTRICT xy,
+    const NumericType* PHQ_RESTRICT xz, const NumericType* PHQ_RESTRICT yx,
+    const NumericType* PHQ_RESTRICT yy, const NumericType* PHQ_RESTRICT yz,
+    const NumericType* PHQ_RESTRICT zx, const NumericType* PHQ_RESTRICT zy,
+    const NumericType* PHQ_RESTRICT zz, NumericType* PHQ_RESTRICT result_xx,
+    NumericType* PHQ_RESTRICT result_xy, NumericType* PHQ_RESTRICT result_xz,
+    NumericType* PHQ_RESTRICT result_yx, NumericType* PHQ_RESTRICT result_yy,
+    NumericType* PHQ_RESTRICT result_yz, NumericType* PHQ_RESTRICT result_zx,
+    NumericType* PHQ_RESTRICT result_zy, NumericType* PHQ_RESTRICT result_zz,
+    std::uint64_t* PHQ_RESTRICT singular, const std::size_t size) noexcept {
+  constexpr NumericType zero{static_cast<NumericType>(0)};
+  constexpr NumericType one{static_cast<NumericType>(1)};
+  for (std::size_t begin = 0; begin < size; begin += 64) {
+    const std::size_t end{std::min(begin + 64, size)};
+    std::uint64_t mask{0};
+    for (std::size_t index = begin; index < end; ++index) {
+      const NumericType cofactor_xx{yy[index] * zz[index] - yz[index] * zy[index]};
+      const NumericType cofactor_xy{yz[index] * zx[index] - yx[index] * zz[index]};
+      const NumericType cofactor_xz{yx[index] * zy[index] - yy[index] * zx[index]};
+      const NumericType cofactor_yx{xz[index] * zy[index] - xy[index] * zz[index]};
+      const NumericType cofactor_yy{xx[index] * zz[index] - xz[index] * zx[index]};
+      const NumericType cofactor_yz{xy[index] * zx[index] - xx[index] * zy[index]};
+      const NumericType cofactor_zx{xy[index] * yz[index] - xz[index] * yy[index]};
+      const NumericType cofactor_zy{xz[index] * yx[index] - xx[index] * yz[index]};
+      const NumericType cofactor_zz{xx[index] * yy[index] - xy[index] * yx[index]};
+      const NumericType determinant{
+          xx[index] * cofactor_xx + xy[index] * cofactor_xy + xz[index] * cofactor_xz};
+      const bool is_singular{determinant == zero};
+      const NumericType divisor{is_singular ? one : determinant};
+      result_xx[index] = is_singular ? zero : cofactor_xx / divisor;
+      result_xy[index] = is_singular ? zero : cofactor_yx / divisor;
+      result_xz[index] = is_singular ? zero : cofactor_zx / divisor;
+      result_yx[index] = is_singular ? zero : cofactor_xy / divisor;
+      result_yy[index] = is_singular ? zero : cofactor_yy / divisor;
+      result_yz[index] = is_singular ? zero : cofactor_zy / divisor;
+      result_zx[index] = is_singular ? zero : cofactor_xz / divisor;
+      result_zy[index] = is_singular ? zero : cofactor_yz / divisor;
+      result_zz[index] = is_singular ? zero : cofactor_zz / divisor;
+      mask |= static_cast<std::uint64_t>(is_singular) << (index - begin);
+    }
+    singular[begin / 64] = mask;
+  }
+}
+
+/// \brief Computes the products of a given number of dyadic tensors and three-dimensional vectors
+/// stored as component arrays. The outputs must not overlap the inputs. Internal implementation
+/// detail not intended to be used outside of the PhQ::DyadField class.
+template <typename NumericType>
+PHQ_ALWAYS_INLINE inline void DyadVectorProductKernel(
+    const NumericType* PHQ_RESTRICT xx, const NumericType* PHQ_RESTRICT xy,
+    const NumericType* PHQ_RESTRICT xz, const NumericType* PHQ_RESTRICT yx,
+    const NumericType* PHQ_RESTRICT yy, const NumericType* PHQ_RESTRICT yz,
+    const NumericType* PHQ_RESTRICT zx, const NumericType* PHQ_RESTRICT zy,
+    const NumericType* PHQ_RESTRICT zz, const NumericType* PHQ_RESTRICT x,
+    const NumericType* PHQ_RESTRICT y, const NumericType* PHQ_RESTRICT z,
+    NumericType* PHQ_RESTRICT result_x, NumericType* PHQ_RESTRICT result_y,
+    NumericType* PHQ_RESTRICT result_z, const std::size_t size) noexcept {
+  for (std::size_t index = 0; index < size; ++index) {
+    result_x[index] = xx[index] * x[index] + xy[index] * y[index] + xz[index] * z[index];
+    result_y[index] = yx[index] * x[index] + yy[index] * y[index] + yz[index] * z[index];
+    result_z[index] = zx[index] * x[index] + zy[index] * y[index] + zz[index] * z[index];
+  }
+}
+
+/// \brief Computes the products of a given number of pairs of dyadic tensors stored as component
+/// arrays. The outputs must not overlap the inputs. Internal implementation detail not intended to
+/// be used outside of the PhQ::DyadField class.
+template <typename NumericType>
+PHQ_ALWAYS_INLINE inline void DyadProductKernel(
+    const NumericType* PHQ_RESTRICT left_xx, const NumericType* PHQ_RESTRICT left_xy,
+    const NumericType* PHQ_RESTRICT left_xz, const NumericType* PHQ_RESTRICT left_yx,
+    const NumericType* PHQ_RESTRICT left_yy, const NumericType* PHQ_RESTRICT left_yz,
+    const NumericType* PHQ_RESTRICT left_zx, const NumericType* PHQ_RESTRICT left_zy,
+    const NumericType* PHQ_RESTRICT left_zz, const NumericType* PHQ_RESTRICT right_xx,
+    const NumericType* PHQ_RESTRICT right_xy, const NumericType* PHQ_RESTRICT right_xz,
+    const NumericType* PHQ_RESTRICT right_yx, const NumericType* PHQ_RESTRICT right_yy,
+    const NumericType* PHQ_RESTRICT right_yz, const NumericType* PHQ_RESTRICT right_zx,
+    const NumericType* PHQ_RESTRICT right_zy, const NumericType* PHQ_RESTRICT right_zz,
+    NumericType* PHQ_RESTRICT result_xx, NumericType* PHQ_RESTRICT result_xy,
+    NumericType* PHQ_RESTRICT result_xz, NumericType* PHQ_RESTRICT result_yx,
+    NumericType* PHQ_RESTRICT result_yy, NumericType* PHQ_RESTRICT result_yz,
+    NumericType* PHQ_RESTRICT result_zx, NumericType* PHQ_RESTRICT result_zy,
+    NumericType* PHQ_RESTRICT result_zz, const std::size_t size) noexcept {
+  for (std::size_t index = 0; index < size; ++index) {
+    result_xx[index] = left_xx[index] * right_xx[index] + left_xy[index] * right_yx[index]
+                       + left_xz[index] * right_zx[index];
+    result_xy[index] = left_xx[index] * right_xy[index] + left_xy[index] * right_yy[index]
+                       + left_xz[index] * right_zy[index];
+    result_xz[index] = left_xx[index] * right_xz[index] + left_xy[index] * right_yz[index]
+                       + left_xz[index] * right_zz[index];
+    result_yx[index] = left_yx[index] * right_xx[index] + left_yy[index] * right_yx[index]
+                       + left_yz[index] * right_zx[index];
+    result_yy[index] = left_yx[index] * right_xy[index] + left_yy[index] * right_yy[index]
+                       + left_yz[index] * right_zy[index];
+    result_yz[index] = left_yx[index] * right_xz[index] + left_yy[index] * right_yz[index]
+                       + left_yz[index] * right_zz[index];
+    result_zx[index] = left_zx[index] * right_xx[index] + left_zy[index] * right_yx[index]
+                       + left_zz[index] * right_zx[index];
+    result_zy[index] = left_zx[index] * right_xy[index] + left_zy[index] * right_yy[index]
+                       + left_zz[index] * right_zy[index];
+    result_zz[index] = left_zx[index] * right_xz[index] + left_zy[index] * right_yz[index]
+                       + left_zz[index] * right_zz[index];
+  }
+}
+
+}  // namespace Internal
+
+/// \brief Field of three-dimensional dyadic tensors stored as a structure of arrays: the xx, xy,
+/// xz, yx, yy, yz, zx, zy, and zz Cartesian components of all elements are stored in nine separate
+/// contiguous arrays aligned to cache lines, expressed in the standard unit of measure. Compared to
+/// a std::vector of physical quantities, which interleaves the components of each element, this
+/// layout lets field-wide determinants, inverses, tensor-vector products, and tensor-tensor
+/// products process consecutive elements with full-width SIMD instructions. Inverses report their
+/// singular elements through a bitmask rather than a std::optional per element. Individual elements
+/// are accessed through a proxy that behaves like the physical quantity.
+/// \tparam Quantity Type of the elements: a physical quantity derived from PhQ::DimensionalDyad or
+/// PhQ::DimensionlessDyad, such as PhQ::DisplacementGradient<double> or
+/// PhQ::VelocityGradient<double>, or PhQ::Dyad.
+template <typename Quantity>
+class DyadField {
+  using Element = Internal::DyadFieldElement<Quantity>;
+
+public:
+  /// \brief Floating-point numeric type of the components of this field.
+  using NumericType = typename Element::NumericType;
+
+  /// \brief Proxy to an element of a mutable field. It converts to the physical quantity and can be
+  /// assigned from one.
+  class Reference {
+  public:
+    /// \brief Returns the element as a physical quantity.
+    operator Quantity() const {
+      return Element::Make(Value().xx_xy_xz_yx_yy_yz_zx_zy_zz());
+    }
+
+    /// \brief Assigns a given physical quantity to the element.
+    Reference& operator=(const Quantity& quantity) noexcept {
+      const std::array<NumericType, 9>& value{
+          Element::Value(quantity).xx_xy_xz_yx_yy_yz_zx_zy_zz()};
+      for (std::size_t component = 0; component < 9; ++component) {
+        field_->components_[component][index_] = value[component];
+      }
+      return *this;
+    }
+
+    /// \brief Assigns the element referenced by another proxy to the element.
+    Reference& operator=(const Reference& other) noexcept {
+      return *this = static_cast<Quantity>(other);
+    }
+
+    /// \brief Returns the value of the element expressed in the standard unit of measure.
+    [[nodiscard]] Dyad<NumericType> Value() const noexcept {
+      return Dyad<NumericType>{
+          field_->components_[0][index_], field_->components_[1][index_],
+          field_->components_[2][index_], field_->components_[3][index_],
+          field_->components_[4][index_], field_->components_[5][index_],
+          field_->components_[6][index_], field_->components_[7][index_],
+          field_->components_[8][index_]};
+    }
+
+    Reference& operator+=(const Quantity& quantity) noexcept {
+      const std::array<NumericType, 9>& value{
+          Element::Value(quantity).xx_xy_xz_yx_yy_yz_zx_zy_zz()};
+      for (std::size_t component = 0; component < 9; ++component) {
+        field_->components_[component][index_] += value[component];
+      }
+      return *this;
+    }
+
+    Reference& operator-=(const Quantity& quantity) noexcept {
+      const std::array<NumericType, 9>& value{
+          Element::Value(quantity).xx_xy_xz_yx_yy_yz_zx_zy_zz()};
+      for (std::size_t component = 0; component < 9; ++component) {
+        field_->components_[component][index_] -= value[component];
+      }
+      return *this;
+    }
+
+    Reference& operator*=(const NumericType number) noexcept {
+      for (std::size_t component = 0; component < 9; ++component) {
+        field_->components_[component][index_] *= number;
+      }
+      return *this;
+    }
+
+    Reference& operator/=(const NumericType number) noexcept {
+      for (std::size_t component = 0; component < 9; ++component) {
+        field_->components_[component][index_] /= number;
+      }
+      return *this;
+    }
+
+    friend bool operator==(const Reference& left, const Quantity& right) noexcept {
+      return left.Value() == Element::Value(right);
+    }
+
+    friend bool operator==(const Quantity& left, const Reference& right) noexcept {
+      return Element::Value(left) == right.Value();
+    }
+
+    friend bool operator!=(const Reference& left, const Quantity& right) noexcept {
+      return left.Value() != Element::Value(right);
+    }
+
+    friend bool operator!=(const Quantity& left, const Reference& right) noexcept {
+      return Element::Value(left) != right.Value();
+    }
+
+  private:
+    Reference(DyadField* const field, const std::size_t index) noexcept
+      : field_(field), index_(index) {}
+
+    DyadField* field_;
+
+    std::size_t index_;
+
+    friend class DyadField;
+  };
+
+  /// \brief Default constructor. Constructs an empty field.
+  DyadField() = default;
+
+  /// \brief Constructor. Constructs a field of a given number of elements of zero.
+  explicit DyadField(const std::size_t size) {
+    Resize(size);
+  }
+
+  /// \brief Constructor. Constructs a field of a given number of copies of a given element.
+  DyadField(const std::size_t size, const Quantity& quantity) {
+    const std::array<NumericType, 9>& value{Element::Value(quantity).xx_xy_xz_yx_yy_yz_zx_zy_zz()};
+    for (std::size_t component = 0; component < 9; ++component) {
+      components_[component].assign(size, value[component]);
+    }
+  }
+
+  /// \brief Constructor. Constructs a field from a contiguous sequence of a given number of
+  /// elements.
+  DyadField(const Quantity* const quantities, const std::size_t size) {
+    Resize(size);
+    for (std::size_t index = 0; index < size; ++index) {
+      const std::array<NumericType, 9>& value{
+          Element::Value(quantities[index]).xx_xy_xz_yx_yy_yz_zx_zy_zz()};
+      for (std::size_t component = 0; component < 9; ++component) {
+        components_[component][index] = value[component];
+      }
+    }
+  }
+
+  /// \brief Constructor. Constructs a field from a std::vector of elements.
+  explicit DyadField(const std::vector<Quantity>& quantities)
+    : DyadField(quantities.data(), quantities.size()) {}
+
+  /// \brief Returns the number of elements of this field.
+  [[nodiscard]] std::size_t Size() const noexcept {
+    return components_[0].size();
+  }
+
+  /// \brief Returns whether this field has no elements.
+  [[nodiscard]] bool Empty() const noexcept {
+    return components_[0].empty();
+  }
+
+  /// \brief Resizes this field to a given number of elements. New elements are zero.
+  void Resize(const std::size_t size) {
+    for (Internal::AlignedVector<NumericType>& values : components_) {
+      values.resize(size);
+    }
+  }
+
+  /// \brief Reserves storage for a given number of elements.
+  void Reserve(const std::size_t size) {
+    for (Internal::AlignedVector<NumericType>& values : components_) {
+      values.reserve(size);
+    }
+  }
+
+  /// \brief Removes all elements of this field.
+  void Clear() noexcept {
+    for (Internal::AlignedVector<NumericType>& values : components_) {
+      values.clear();
+    }
+  }
+
+  /// \brief Appends a given element to the end of this field.
+  void PushBack(const Quantity& quantity) {
+    const std::array<NumericType, 9>& value{Element::Value(quantity).xx_xy_xz_yx_yy_yz_zx_zy_zz()};
+    for (std::size_t component = 0; component < 9; ++component) {
+      components_[component].push_back(value[component]);
+    }
+  }
+
+  /// \brief Returns a pointer to the contiguous xx Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure.
+  [[nodiscard]] const NumericType* xx() const noexcept {
+    return components_[0].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous xx Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure, as mutable values.
+  [[nodiscard]] NumericType* xx() noexcept {
+    return components_[0].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous xy Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure.
+  [[nodiscard]] const NumericType* xy() const noexcept {
+    return components_[1].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous xy Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure, as mutable values.
+  [[nodiscard]] NumericType* xy() noexcept {
+    return components_[1].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous xz Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure.
+  [[nodiscard]] const NumericType* xz() const noexcept {
+    return components_[2].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous xz Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure, as mutable values.
+  [[nodiscard]] NumericType* xz() noexcept {
+    return components_[2].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous yx Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure.
+  [[nodiscard]] const NumericType* yx() const noexcept {
+    return components_[3].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous yx Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure, as mutable values.
+  [[nodiscard]] NumericType* yx() noexcept {
+    return components_[3].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous yy Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure.
+  [[nodiscard]] const NumericType* yy() const noexcept {
+    return components_[4].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous yy Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure, as mutable values.
+  [[nodiscard]] NumericType* yy() noexcept {
+    return components_[4].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous yz Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure.
+  [[nodiscard]] const NumericType* yz() const noexcept {
+    return components_[5].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous yz Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure, as mutable values.
+  [[nodiscard]] NumericType* yz() noexcept {
+    return components_[5].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous zx Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure.
+  [[nodiscard]] const NumericType* zx() const noexcept {
+    return components_[6].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous zx Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure, as mutable values.
+  [[nodiscard]] NumericType* zx() noexcept {
+    return components_[6].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous zy Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure.
+  [[nodiscard]] const NumericType* zy() const noexcept {
+    return components_[7].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous zy Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure, as mutable values.
+  [[nodiscard]] NumericType* zy() noexcept {
+    return components_[7].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous zz Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure.
+  [[nodiscard]] const NumericType* zz() const noexcept {
+    return components_[8].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous zz Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure, as mutable values.
+  [[nodiscard]] NumericType* zz() noexcept {
+    return components_[8].data();
+  }
+
+  /// \brief Returns the element at a given index. The index must be less than Size().
+  [[nodiscard]] Quantity operator[](const std::size_t index) const {
+    return Element::Make(std::array<NumericType, 9>{
+        components_[0][index], components_[1][index], components_[2][index],
+        components_[3][index], components_[4][index], components_[5][index],
+        components_[6][index], components_[7][index], components_[8][index]});
+  }
+
+  /// \brief Returns a proxy to the element at a given index. The index must be less than Size().
+  [[nodiscard]] Reference operator[](const std::size_t index) noexcept {
+    return Reference{this, index};
+  }
+
+  /// \brief Returns the elements of this field as a std::vector of elements.
+  [[nodiscard]] std::vector<Quantity> Quantities() const {
+    std::vector<Quantity> quantities;
+    quantities.reserve(Size());
+    for (std::size_t index = 0; index < Size(); ++index) {
+      quantities.push_back((*this)[index]);
+    }
+    return quantities;
+  }
+
+  /// \brief Computes the determinants of the elements of this field into a caller-provided
+  /// contiguous sequence of Size() values. The determinants are expressed in the cube of the
+  /// standard unit of measure of this field.
+  void Determinant(NumericType* const output) const noexcept {
+    const NumericType* const xx{components_[0].data()};
+    const NumericType* const xy{components_[1].data()};
+    const NumericType* const xz{components_[2].data()};
+    const NumericType* const yx{components_[3].data()};
+    const NumericType* const yy{components_[4].data()};
+    const NumericType* const yz{components_[5].data()};
+    const NumericType* const zx{components_[6].data()};
+    const NumericType* const zy{components_[7].data()};
+    const NumericType* const zz{components_[8].data()};
+    const std::size_t size{Size()};
+    Internal::RunKernel(
+        [=]() PHQ_ALWAYS_INLINE {
+          Internal::DyadDeterminantKernel(xx, xy, xz, yx, yy, yz, zx, zy, zz, output, size);
+        },
+        size);
+  }
+
+  /// \brief Returns the determinants of the elements of this field, expressed in the cube of the
+  /// standard unit of measure of this field.
+  [[nodiscard]] std::vector<NumericType> Determinant() const {
+    std::vector<NumericType> output(Size());
+    Determinant(output.data());
+    return output;
+  }
+
+  /// \brief Computes the inverses of the elements of this field into a caller-provided field of
+  /// Size() dyadic tensors, expressed in the reciprocal of the standard unit of measure of this
+  /// field, and marks the singular elements in a caller-provided bitmask of (Size() + 63) / 64
+  /// words. Bit index % 64 of word index / 64 is set if the element at that index is singular, in
+  /// which case its inverse is set to zero. Unlike PhQ::Dyad::Inverse, which returns a
+  /// std::optional per tensor, this processes the whole field in a single vectorized pass. The
+  /// field of inverses may be this field, in which case the inverses are computed into a temporary
+  /// field that then replaces this field.
+  void Inverse(DyadField<Dyad<NumericType>>& inverses, std::uint64_t* const singular) const {
+    if (static_cast<const void*>(&inverses) == this) {
+      DyadField<Dyad<NumericType>> temporary(Size());
+      Inverse(temporary, singular);
+      inverses = std::move(temporary);
+      return;
+    }
+    const NumericType* const xx{components_[0].data()};
+    const NumericType* const xy{components_[1].data()};
+    const NumericType* const xz{components_[2].data()};
+    const NumericType* const yx{components_[3].data()};
+    const NumericType* const yy{components_[4].data()};
+    const NumericType* const yz{components_[5].data()};
+    const NumericType* const zx{components_[6].data()};
+    const NumericType* const zy{components_[7].data()};
+    const NumericType* const zz{components_[8].data()};
+    NumericType* const result_xx{inverses.xx()};
+    NumericType* const result_xy{inverses.xy()};
+    NumericType* const result_xz{inverses.xz()};
+    NumericType* const result_yx{inverses.yx()};
+    NumericType* const result_yy{inverses.yy()};
+    NumericType* const result_yz{inverses.yz()};
+    NumericType* const result_zx{inverses.zx()};
+    NumericType* const result_zy{inverses.zy()};
+    NumericType* const result_zz{inverses.zz()};
+    const std::size_t size{Size()};
+    Internal::RunKernel(
+        [=]() PHQ_ALWAYS_INLINE {
+          Internal::DyadInverseKernel(xx, xy, xz, yx, yy, yz, zx, zy, zz, result_xx, result_xy,
+                                      result_xz, result_yx, result_yy, result_yz, result_zx,
+                                      result_zy, result_zz, singular, size);
+        },
+        size);
+  }
+
+  /// \brief Computes the inverses of the elements of this field into a given field of dyadic
+  /// tensors, which is resized to Size(), expressed in the reciprocal of the standard unit of
+  /// measure of this field. Returns a bitmask of the singular elements: bit index % 64 of word
+  /// index / 64 is set if the element at that index is singular, in which case its inverse is set
+  /// to zero.
+  [[nodiscard]] std::vector<std::uint64_t> Inverse(DyadField<Dyad<NumericType>>& inverses) const {
+    inverses.Resize(Size());
+    std::vector<std::uint64_t> singular((Size() + 63) / 64);
+    Inverse(inverses, singular.data());
+    return singular;
+  }
+
+  /// \brief Computes the products of the elements of this field and the corresponding elements of
+  /// a vector field of the same size into a caller-provided vector field of Size() elements. If
+  /// this field is dimensionless, the products have the type of the vectors; otherwise, they are
+  /// expressed in the product of the standard units of measure of both fields. The field of
+  /// products may be the vector field, in which case the products are computed into a temporary
+  /// field that then replaces the vector field.
+  template <typename VectorQuantity>
+  void Multiply(const VectorField<VectorQuantity>& vectors,
+                VectorField<Internal::DyadVectorProductType<Quantity, VectorQuantity>>& products)
+      const {
+    static_assert(std::is_same_v<NumericType, typename VectorField<VectorQuantity>::NumericType>,
+                  "Both fields must have the same numeric type.");
+    if (static_cast<const void*>(&products) == &vectors) {
+      VectorField<Internal::DyadVectorProductType<Quantity, VectorQuantity>> temporary(Size());
+      Multiply(vectors, temporary);
+      products = std::move(temporary);
+      return;
+    }
+    const NumericType* const xx{components_[0].data()};
+    const NumericType* const xy{components_[1].data()};
+    const NumericType* const xz{components_[2].data()};
+    const NumericType* const yx{components_[3].data()};
+    const NumericType* const yy{components_[4].data()};
+    const NumericType* const yz{components_[5].data()};
+    const NumericType* const zx{components_[6].data()};
+    const NumericType* const zy{components_[7].data()};
+    const NumericType* const zz{components_[8].data()};
+    const NumericType* const x{vectors.x()};
+    const NumericType* const y{vectors.y()};
+    const NumericType* const z{vectors.z()};
+    NumericType* const result_x{products.x()};
+    NumericType* const result_y{products.y()};
+    NumericType* const result_z{products.z()};
+    const std::size_t size{Size()};
+    Internal::RunKernel(
+        [=]() PHQ_ALWAYS_INLINE {
+          Internal::DyadVectorProductKernel(xx, xy, xz, yx, yy, yz, zx, zy, zz, x, y, z, result_x,
+                                            result_y, result_z, size);
+        },
+        size);
+  }
+
+  /// \brief Returns the products of the elements of this field and the corresponding elements of a
+  /// vector field of the same size. If this field is dimensionless, the products have the type of
+  /// the vectors; otherwise, they are expressed in the product of the standard units of measure of
+  /// both fields.
+  template <typename VectorQuantity>
+  [[nodiscard]] VectorField<Internal::DyadVectorProductType<Quantity, VectorQuantity>> operator*(
+      const VectorField<VectorQuantity>& vectors) const {
+    VectorField<Internal::DyadVectorProductType<Quantity, VectorQuantity>> products(Size());
+    Multiply(vectors, products);
+    return products;
+  }
+
+  /// \brief Computes the products of the elements of this field and the corresponding elements of
+  /// another dyadic tensor field of the same size into a caller-provided dyadic tensor field of
+  /// Size() elements. If either field is dimensionless, the products have the type of the other
+  /// field's elements; otherwise, they are expressed in the product of the standard units of
+  /// measure of both fields. The field of products may be this field or the other field, in which
+  /// case the products are computed into a temporary field that then replaces that field.
+  template <typename OtherQuantity>
+  void Multiply(const DyadField<OtherQuantity>& other,
+                DyadField<Internal::DyadProductType<Quantity, OtherQuantity>>& products) const {
+    static_assert(std::is_same_v<NumericType, typename DyadField<OtherQuantity>::NumericType>,
+                  "Both fields must have the same numeric type.");
+    if (static_cast<const void*>(&products) == this
+        || static_cast<const void*>(&products) == &other) {
+      DyadField<Internal::DyadProductType<Quantity, OtherQuantity>> temporary(Size());
+      Multiply(other, temporary);
+      products = std::move(temporary);
+      return;
+    }
+    const NumericType* const xx{components_[0].data()};
+    const NumericType* const xy{components_[1].data()};
+    const NumericType* const xz{components_[2].data()};
+    const NumericType* const yx{components_[3].data()};
+    const NumericType* const yy{components_[4].data()};
+    const NumericType* const yz{components_[5].data()};
+    const NumericType* const zx{components_[6].data()};
+    const NumericType* const zy{components_[7].data()};
+    const NumericType* const zz{components_[8].data()};
+    const NumericType* const other_xx{other.xx()};
+    const NumericType* const other_xy{other.xy()};
+    const NumericType* const other_xz{other.xz()};
+    const NumericType* const other_yx{other.yx()};
+    const NumericType* const other_yy{other.yy()};
+    const NumericType* const other_yz{other.yz()};
+    const NumericType* const other_zx{other.zx()};
+    const NumericType* const other_zy{other.zy()};
+    const NumericType* const other_zz{other.zz()};
+    NumericType* const result_xx{products.xx()};
+    NumericType* const result_xy{products.xy()};
+    NumericType* const result_xz{products.xz()};
+    NumericType* const result_yx{products.yx()};
+    NumericType* const result_yy{products.yy()};
+    NumericType* const result_yz{products.yz()};
+    NumericType* const result_zx{products.zx()};
+    NumericType* const result_zy{products.zy()};
+    NumericType* const result_zz{products.zz()};
+    const std::size_t size{Size()};
+    Internal::RunKernel(
+        [=]() PHQ_ALWAYS_INLINE {
+          Internal::DyadProductKernel(xx, xy, xz, yx, yy, yz, zx, zy, zz, other_xx, other_xy,
+                                      other_xz, other_yx, other_yy, other_yz, other_zx, other_zy,
+                                      other_zz, result_xx, result_xy, result_xz, result_yx,
+                                      result_yy, result_yz, result_zx, result_zy, result_zz, size);
+        },
+        size);
+  }
+
+  /// \brief Returns the products of the elements of this field and the corresponding elements of
+  /// another dyadic tensor field of the same size. If either field is dimensionless, the products
+  /// have the type of the other field's elements; otherwise, they are expressed in the product of
+  /// the standard units of measure of both fields.
+  template <typename OtherQuantity>
+  [[nodiscard]] DyadField<Internal::DyadProductType<Quantity, OtherQuantity>> operator*(
+      const DyadField<OtherQuantity>& other) const {
+    DyadField<Internal::DyadProductType<Quantity, OtherQuantity>> products(Size());
+    Multiply(other, products);
+    return products;
+  }
+
+  /// \brief Adds the elements of another field of the same size, multiplied by a given number, to
+  /// the elements of this field in place.
+  void AddScaled(const NumericType number, const DyadField<Quantity>& other) noexcept {
+    const std::size_t size{Size()};
+    for (std::size_t component = 0; component < 9; ++component) {
+      NumericType* const values{components_[component].data()};
+      const NumericType* const other_values{other.components_[component].data()};
+      Internal::RunKernel(
+          [=]() PHQ_ALWAYS_INLINE {
+            Internal::AddScaledKernel(values, number, other_values, size);
+          },
+          size);
+    }
+  }
+
+  DyadField<Quantity> operator+(const DyadField<Quantity>& other) const {
+    DyadField<Quantity> result{*this};
+    result += other;
+    return result;
+  }
+
+  DyadField<Quantity> operator-(const DyadField<Quantity>& other) const {
+    DyadField<Quantity> result{*this};
+    result -= other;
+    return result;
+  }
+
+  DyadField<Quantity> operator*(const NumericType number) const {
+    DyadField<Quantity> result{*this};
+    result *= number;
+    return result;
+  }
+
+  DyadField<Quantity> operator/(const NumericType number) const {
+    DyadField<Quantity> result{*this};
+    result /= number;
+    return result;
+  }
+
+  void operator+=(const DyadField<Quantity>& other) noexcept {
+    AddScaled(static_cast<NumericType>(1), other);
+  }
+
+  void operator-=(const DyadField<Quantity>& other) noexcept {
+    AddScaled(static_cast<NumericType>(-1), other);
+  }
+
+  void operator*=(const NumericType number) noexcept {
+    const std::size_t size{Size()};
+    for (Internal::AlignedVector<NumericType>& component : components_) {
+      NumericType* const values{component.data()};
+      Internal::RunKernel(
+          [=]() PHQ_ALWAYS_INLINE { Internal::ScaleKernel(values, number, size); }, size);
+    }
+  }
+
+  void operator/=(const NumericType number) noexcept {
+    *this *= static_cast<NumericType>(1) / number;
+  }
+
+  bool operator==(const DyadField<Quantity>& other) const noexcept {
+    return components_ == other.components_;
+  }
+
+  bool operator!=(const DyadField<Quantity>& other) const noexcept {
+    return !(*this == other);
+  }
+
+private:
+  // Component arrays in the order xx, xy, xz, yx, yy, yz, zx, zy, and zz, as in PhQ::Dyad.
+  std::array<Internal::AlignedVector<NumericType>, 9> components_;
+};
+
+template <typename Quantity>
+inline DyadField<Quantity> operator*(
+    const typename DyadField<Quantity>::NumericType number, const DyadField<Quantity>& field) {
+  return field * number;
+}
+
+}  // namespace PhQ
+
+#endif  // PHQ_DYAD_FIELD_HPP
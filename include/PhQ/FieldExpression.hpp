@@ -0,0 +1,544 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_FIELD_EXPRESSION_HPP
+#define PHQ_FIELD_EXPRESSION_HPP
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "Base.hpp"
+#include "DyadField.hpp"
+#include "QuantityTraits.hpp"
+#include "Simd.hpp"
+#include "SymmetricDyadField.hpp"
+#include "VectorField.hpp"
+
+namespace PhQ {
+
+// Forward declaration for class PhQ::FieldExpression.
+template <typename Derived>
+class FieldExpression;
+
+namespace Internal {
+
+/// \brief Whether a given type is a lazily evaluated expression over fields. Internal
+/// implementation detail not intended to be used outside of the PhQ::FieldExpression class.
+template <typename Type>
+inline constexpr bool IsFieldExpression{
+    std::is_base_of_v<FieldExpression<std::decay_t<Type>>, std::decay_t<Type>>};
+
+/// \brief Whether a given type is a physical quantity derived from one of the dimensional base
+/// classes. Internal implementation detail not intended to be used outside of the
+/// PhQ::FieldExpression class.
+template <typename Type, typename = void>
+struct IsDimensionalQuantity : std::false_type {};
+
+template <typename Type>
+struct IsDimensionalQuantity<Type, std::void_t<QuantityTraitsOf<Type>>> : std::true_type {};
+
+/// \brief Container of the elements that result from the evaluation of an expression over fields
+/// whose elements have a given number of components: a std::vector for scalars, a PhQ::VectorField
+/// for vectors, a PhQ::SymmetricDyadField for symmetric dyadic tensors, and a PhQ::DyadField for
+/// dyadic tensors. Internal implementation detail not intended to be used outside of the
+/// PhQ::Evaluate function.
+template <typename Quantity, std::size_t Count>
+struct FieldOfCount;
+
+template <typename Quantity>
+struct FieldOfCount<Quantity, 1> {
+  using Type = std::vector<Quantity>;
+};
+
+template <typename Quantity>
+struct FieldOfCount<Quantity, 3> {
+  using Type = VectorField<Quantity>;
+};
+
+template <typename Quantity>
+struct FieldOfCount<Quantity, 6> {
+  using Type = SymmetricDyadField<Quantity>;
+};
+
+template <typename Quantity>
+struct FieldOfCount<Quantity, 9> {
+  using Type = DyadField<Quantity>;
+};
+
+/// \brief Container of the elements that result from the evaluation of a given expression over
+/// fields. Internal implementation detail not intended to be used outside of the PhQ::Evaluate
+/// function.
+template <typename Expression>
+using FieldOf =
+    typename FieldOfCount<typename Expression::Quantity, Expression::ComponentCount>::Type;
+
+// The following functions return pointers to the components of the elements of a field, in the
+// order in which the field stores them.
+
+template <typename NumericType, typename Quantity>
+[[nodiscard]] inline std::array<NumericType*, 1> FieldComponents(
+    std::vector<Quantity>& scalars) noexcept {
+  return {ScalarComponents<Quantity, NumericType>(scalars.data())};
+}
+
+template <typename NumericType, typename Quantity>
+[[nodiscard]] inline std::array<const NumericType*, 1> FieldComponents(
+    const std::vector<Quantity>& scalars) noexcept {
+  return {ScalarComponents<const Quantity, const NumericType>(scalars.data())};
+}
+
+template <typename NumericType, typename Quantity>
+[[nodiscard]] inline std::array<NumericType*, 3> FieldComponents(
+    VectorField<Quantity>& field) noexcept {
+  return {field.x(), field.y(), field.z()};
+}
+
+template <typename NumericType, typename Quantity>
+[[nodiscard]] inline std::array<const NumericType*, 3> FieldComponents(
+    const VectorField<Quantity>& field) noexcept {
+  return {field.x(), field.y(), field.z()};
+}
+
+template <typename NumericType, typename Quantity>
+[[nodiscard]] inline std::array<NumericType*, 6> FieldComponents(
+    SymmetricDyadField<Quantity>& field) noexcept {
+  return {field.xx(), field.xy(), field.xz(), field.yy(), field.yz(), field.zz()};
+}
+
+template <typename NumericType, typename Quantity>
+[[nodiscard]] inline std::array<const NumericType*, 6> FieldComponents(
+    const SymmetricDyadField<Quantity>& field) noexcept {
+  return {field.xx(), field.xy(), field.xz(), field.yy(), field.yz(), field.zz()};
+}
+
+template <typename NumericType, typename Quantity>
+[[nodiscard]] inline std::array<NumericType*, 9> FieldComponents(
+    DyadField<Quantity>& field) noexcept {
+  return {field.xx(), field.xy(), field.xz(), field.yx(), field.yy(),
+          field.yz(), field.zx(), field.zy(), field.zz()};
+}
+
+template <typename NumericType, typename Quantity>
+[[nodiscard]] inline std::array<const NumericType*, 9> FieldComponents(
+    const DyadField<Quantity>& field) noexcept {
+  return {field.xx(), field.xy(), field.xz(), field.yx(), field.yy(),
+          field.yz(), field.zx(), field.zy(), field.zz()};
+}
+
+/// \brief Leaf of an expression over fields that refers to the components of a field. Internal
+/// implementation detail not intended to be used outside of the PhQ::Lazy function.
+template <typename QuantityType, typename Numeric, std::size_t Count>
+class FieldOperand : public FieldExpression<FieldOperand<QuantityType, Numeric, Count>> {
+public:
+  using Quantity = QuantityType;
+
+  using NumericType = Numeric;
+
+  static constexpr std::size_t ComponentCount{Count};
+
+  static constexpr bool IsConstant{false};
+
+  FieldOperand(const std::array<const NumericType*, Count>& components, const std::size_t size)
+    : components_(components), size_(size) {}
+
+  [[nodiscard]] std::size_t Size() const noexcept {
+    return size_;
+  }
+
+  template <std::size_t Component>
+  [[nodiscard]] PHQ_ALWAYS_INLINE NumericType Evaluate(const std::size_t index) const noexcept {
+    return components_[Count == 1 ? 0 : Component][index];
+  }
+
+private:
+  std::array<const NumericType*, Count> components_;
+
+  std::size_t size_;
+};
+
+/// \brief Leaf of an expression over fields that holds a number or a physical quantity that is
+/// broadcast to every element of the fields, such as a time step. Internal implementation detail
+/// not intended to be used outside of the PhQ::FieldExpression class.
+template <typename QuantityType, typename Numeric, std::size_t Count>
+class ConstantOperand : public FieldExpression<ConstantOperand<QuantityType, Numeric, Count>> {
+public:
+  using Quantity = QuantityType;
+
+  using NumericType = Numeric;
+
+  static constexpr std::size_t ComponentCount{Count};
+
+  static constexpr bool IsConstant{true};
+
+  explicit ConstantOperand(const std::array<NumericType, Count>& components)
+    : components_(components) {}
+
+  [[nodiscard]] static constexpr std::size_t Size() noexcept {
+    return 0;
+  }
+
+  template <std::size_t Component>
+  [[nodiscard]] PHQ_ALWAYS_INLINE NumericType Evaluate(const std::size_t) const noexcept {
+    return components_[Count == 1 ? 0 : Component];
+  }
+
+private:
+  std::array<NumericType, Count> components_;
+};
+
+/// \brief Wraps a number or a physical quantity that appears in an expression over fields whose
+/// components are of a given numeric type. Internal implementation detail not intended to be used
+/// outside of the PhQ::FieldExpression class.
+template <typename NumericType, typename Type>
+[[nodiscard]] inline auto MakeConstantOperand(const Type& value) {
+  if constexpr (std::is_arithmetic_v<Type>) {
+    return ConstantOperand<NumericType, NumericType, 1>{{static_cast<NumericType>(value)}};
+  } else {
+    using Traits = QuantityTraitsOf<Type>;
+    static_assert(std::is_same_v<typename Traits::NumericType, NumericType>,
+                  "The operands of an expression over fields must share the same numeric type.");
+    const typename Traits::ValueType standard_value{value.Value()};
+    const NumericType* const components{ComponentsOf(standard_value)};
+    std::array<NumericType, Traits::ComponentCount> copy;
+    for (std::size_t index = 0; index < Traits::ComponentCount; ++index) {
+      copy[index] = components[index];
+    }
+    return ConstantOperand<Type, NumericType, Traits::ComponentCount>{copy};
+  }
+}
+
+/// \brief Whether a given type can appear alongside an expression over fields as a number or a
+/// physical quantity that is broadcast to every element. Internal implementation detail not
+/// intended to be used outside of the PhQ::FieldExpression class.
+template <typename Type>
+inline constexpr bool IsConstantOperand{
+    !IsFieldExpression<Type>
+    && (std::is_arithmetic_v<Type> || IsDimensionalQuantity<Type>::value)};
+
+// The following classes describe the operations of an expression over fields. Each one deduces
+// the physical quantity of its result from the corresponding eager operator of the physical
+// quantities, and applies the operation to one component of one element.
+
+struct FieldAddition {
+  template <typename Left, typename Right>
+  static auto Result(const Left& left, const Right& right) -> decltype(left + right);
+
+  static constexpr bool IsValid(const std::size_t left_count, const std::size_t right_count) {
+    return left_count == right_count;
+  }
+
+  template <typename NumericType>
+  [[nodiscard]] PHQ_ALWAYS_INLINE static NumericType Apply(
+      const NumericType left, const NumericType right) noexcept {
+    return left + right;
+  }
+};
+
+struct FieldSubtraction {
+  template <typename Left, typename Right>
+  static auto Result(const Left& left, const Right& right) -> decltype(left - right);
+
+  static constexpr bool IsValid(const std::size_t left_count, const std::size_t right_count) {
+    return left_count == right_count;
+  }
+
+  template <typename NumericType>
+  [[nodiscard]] PHQ_ALWAYS_INLINE static NumericType Apply(
+      const NumericType left, const NumericType right) noexcept {
+    return left - right;
+  }
+};
+
+struct FieldMultiplication {
+  template <typename Left, typename Right>
+  static auto Result(const Left& left, const Right& right) -> decltype(left * right);
+
+  static constexpr bool IsValid(const std::size_t left_count, const std::size_t right_count) {
+    return left_count == 1 || right_count == 1;
+  }
+
+  template <typename NumericType>
+  [[nodiscard]] PHQ_ALWAYS_INLINE static NumericType Apply(
+      const NumericType left, const NumericType right) noexcept {
+    return left * right;
+  }
+};
+
+struct FieldDivision {
+  template <typename Left, typename Right>
+  static auto Result(const Left& left, const Right& right) -> decltype(left / right);
+
+  static constexpr bool IsValid(const std::size_t, const std::size_t right_count) {
+    return right_count == 1;
+  }
+
+  template <typename NumericType>
+  [[nodiscard]] PHQ_ALWAYS_INLINE static NumericType Apply(
+      const NumericType left, const NumericType right) noexcept {
+    return left / right;
+  }
+};
+
+/// \brief Node of an expression over fields that combines two operands with a given operation.
+/// Internal implementation detail not intended to be used outside of the PhQ::FieldExpression
+/// class.
+template <typename Left, typename Right, typename Operation>
+class BinaryFieldExpression
+  : public FieldExpression<BinaryFieldExpression<Left, Right, Operation>> {
+public:
+  using Quantity = decltype(Operation::Result(std::declval<const typename Left::Quantity&>(),
+                                              std::declval<const typename Right::Quantity&>()));
+
+  using NumericType = typename Left::NumericType;
+
+  static constexpr std::size_t ComponentCount{
+      Left::ComponentCount > Right::ComponentCount ? Left::ComponentCount : Right::ComponentCount};
+
+  static constexpr bool IsConstant{Left::IsConstant && Right::IsConstant};
+
+  static_assert(std::is_same_v<typename Left::NumericType, typename Right::NumericType>,
+                "The operands of an expression over fields must share the same numeric type.");
+
+  static_assert(Operation::IsValid(Left::ComponentCount, Right::ComponentCount),
+                "Expressions over fields only fuse sums and differences of operands of the same "
+                "kind, and products and quotients by scalars.");
+
+  BinaryFieldExpression(const Left& left, const Right& right) : left_(left), right_(right) {}
+
+  [[nodiscard]] std::size_t Size() const noexcept {
+    return Left::IsConstant ? right_.Size() : left_.Size();
+  }
+
+  template <std::size_t Component>
+  [[nodiscard]] PHQ_ALWAYS_INLINE NumericType Evaluate(const std::size_t index) const noexcept {
+    return Operation::Apply(left_.template Evaluate<Component>(index),
+                            right_.template Evaluate<Component>(index));
+  }
+
+private:
+  Left left_;
+
+  Right right_;
+};
+
+/// \brief Writes the result of an expression over fields to the components of a field, one
+/// component at a time, in a single pass through memory without intermediate fields. Internal
+/// implementation detail not intended to be used outside of the PhQ::Evaluate function.
+template <typename Expression, typename NumericType, std::size_t... Components>
+PHQ_ALWAYS_INLINE inline void FieldExpressionKernel(
+    const Expression& expression, const std::array<NumericType*, sizeof...(Components)>& results,
+    const std::size_t size, std::index_sequence<Components...>) noexcept {
+  (
+      [&]() PHQ_ALWAYS_INLINE {
+        NumericType* const result{results[Components]};
+        for (std::size_t index = 0; index < size; ++index) {
+          result[index] = expression.template Evaluate<Components>(index);
+        }
+      }(),
+      ...);
+}
+
+}  // namespace Internal
+
+/// \brief Base class of the lazily evaluated expressions over fields. Combining the result of
+/// PhQ::Lazy with other fields, numbers, and physical quantities through the +, -, *, and /
+/// operators builds an expression rather than a field. The expression records the operations and
+/// deduces the physical quantity of its result from the eager operators of the physical quantities,
+/// so PhQ::Lazy(velocities) * time is an expression of PhQ::Displacement, and an operation that
+/// the physical quantities do not support does not compile. PhQ::Evaluate then computes the whole
+/// expression in a single pass through memory, without the intermediate fields that the eager
+/// operators of the fields allocate and traverse for every operator. Sums and differences combine
+/// operands of the same kind; products and quotients combine any operand with a scalar. An
+/// expression refers to the fields from which it is built, so these fields must outlive it.
+template <typename Derived>
+class FieldExpression {
+public:
+  /// \brief Returns this expression as its derived type.
+  [[nodiscard]] const Derived& Self() const noexcept {
+    return static_cast<const Derived&>(*this);
+  }
+
+protected:
+  FieldExpression() = default;
+};
+
+/// \brief Returns a lazily evaluated expression that refers to the elements of a given field. Use
+/// it as the first operand of an expression that is computed with PhQ::Evaluate.
+template <typename Quantity>
+[[nodiscard]] inline auto Lazy(const VectorField<Quantity>& field) {
+  using NumericType = typename VectorField<Quantity>::NumericType;
+  return Internal::FieldOperand<Quantity, NumericType, 3>{
+      Internal::FieldComponents<NumericType>(field), field.Size()};
+}
+
+/// \brief Returns a lazily evaluated expression that refers to the elements of a given field. Use
+/// it as the first operand of an expression that is computed with PhQ::Evaluate.
+template <typename Quantity>
+[[nodiscard]] inline auto Lazy(const SymmetricDyadField<Quantity>& field) {
+  using NumericType = typename SymmetricDyadField<Quantity>::NumericType;
+  return Internal::FieldOperand<Quantity, NumericType, 6>{
+      Internal::FieldComponents<NumericType>(field), field.Size()};
+}
+
+/// \brief Returns a lazily evaluated expression that refers to the elements of a given field. Use
+/// it as the first operand of an expression that is computed with PhQ::Evaluate.
+template <typename Quantity>
+[[nodiscard]] inline auto Lazy(const DyadField<Quantity>& field) {
+  using NumericType = typename DyadField<Quantity>::NumericType;
+  return Internal::FieldOperand<Quantity, NumericType, 9>{
+      Internal::FieldComponents<NumericType>(field), field.Size()};
+}
+
+/// \brief Returns a lazily evaluated expression that refers to a given sequence of scalar physical
+/// quantities, such as the time step of each element of a field. Use it as an operand of an
+/// expression that is computed with PhQ::Evaluate.
+template <typename Quantity>
+[[nodiscard]] inline auto Lazy(const std::vector<Quantity>& scalars) {
+  using NumericType = typename Internal::QuantityTraitsOf<Quantity>::NumericType;
+  static_assert(Internal::QuantityTraitsOf<Quantity>::ComponentCount == 1,
+                "A sequence of physical quantities in an expression over fields must be scalars.");
+  return Internal::FieldOperand<Quantity, NumericType, 1>{
+      Internal::FieldComponents<NumericType>(scalars), scalars.size()};
+}
+
+/// \brief Computes a lazily evaluated expression into a given field in a single pass through
+/// memory. The field must have the same size as the fields of the expression. It can be one of
+/// these fields, so PhQ::Evaluate(PhQ::Lazy(positions) + PhQ::Lazy(velocities) * time, positions)
+/// advances the positions in place; it must not otherwise overlap them.
+template <typename Expression>
+inline void Evaluate(
+    const FieldExpression<Expression>& expression, Internal::FieldOf<Expression>& result) {
+  using NumericType = typename Expression::NumericType;
+  static_assert(!Expression::IsConstant,
+                "An expression over fields must refer to at least one field.");
+  const Expression& self{expression.Self()};
+  const std::array<NumericType*, Expression::ComponentCount> results{
+      Internal::FieldComponents<NumericType>(result)};
+  const std::size_t size{self.Size()};
+  Internal::RunKernel(
+      [=]() PHQ_ALWAYS_INLINE {
+        Internal::FieldExpressionKernel(
+            self, results, size, std::make_index_sequence<Expression::ComponentCount>{});
+      },
+      size);
+}
+
+/// \brief Computes a lazily evaluated expression in a single pass through memory and returns the
+/// resulting field. The physical quantity of its elements is deduced from the expression, such as
+/// a PhQ::VectorField of PhQ::Position for PhQ::Lazy(positions) + PhQ::Lazy(velocities) * time.
+template <typename Expression>
+[[nodiscard]] inline Internal::FieldOf<Expression> Evaluate(
+    const FieldExpression<Expression>& expression) {
+  Internal::FieldOf<Expression> result(expression.Self().Size());
+  Evaluate(expression, result);
+  return result;
+}
+
+/// \brief Sum of two expressions over fields.
+template <typename Left, typename Right>
+[[nodiscard]] inline auto operator+(
+    const FieldExpression<Left>& left, const FieldExpression<Right>& right) {
+  return Internal::BinaryFieldExpression<Left, Right, Internal::FieldAddition>{
+      left.Self(), right.Self()};
+}
+
+/// \brief Sum of an expression over fields and a number or a physical quantity.
+template <typename Left, typename Right,
+          typename = std::enable_if_t<Internal::IsConstantOperand<Right>>>
+[[nodiscard]] inline auto operator+(const FieldExpression<Left>& left, const Right& right) {
+  return left + Internal::MakeConstantOperand<typename Left::NumericType>(right);
+}
+
+/// \brief Sum of a number or a physical quantity and an expression over fields.
+template <typename Left, typename Right,
+          typename = std::enable_if_t<Internal::IsConstantOperand<Left>>>
+[[nodiscard]] inline auto operator+(const Left& left, const FieldExpression<Right>& right) {
+  return Internal::MakeConstantOperand<typename Right::NumericType>(left) + right;
+}
+
+/// \brief Difference of two expressions over fields.
+template <typename Left, typename Right>
+[[nodiscard]] inline auto operator-(
+    const FieldExpression<Left>& left, const FieldExpression<Right>& right) {
+  return Internal::BinaryFieldExpression<Left, Right, Internal::FieldSubtraction>{
+      left.Self(), right.Self()};
+}
+
+/// \brief Difference of an expression over fields and a number or a physical quantity.
+template <typename Left, typename Right,
+          typename = std::enable_if_t<Internal::IsConstantOperand<Right>>>
+[[nodiscard]] inline auto operator-(const FieldExpression<Left>& left, const Right& right) {
+  return left - Internal::MakeConstantOperand<typename Left::NumericType>(right);
+}
+
+/// \brief Difference of a number or a physical quantity and an expression over fields.
+template <typename Left, typename Right,
+          typename = std::enable_if_t<Internal::IsConstantOperand<Left>>>
+[[nodiscard]] inline auto operator-(const Left& left, const FieldExpression<Right>& right) {
+  return Internal::MakeConstantOperand<typename Right::NumericType>(left) - right;
+}
+
+/// \brief Product of two expressions over fields, at least one of which is a scalar.
+template <typename Left, typename Right>
+[[nodiscard]] inline auto operator*(
+    const FieldExpression<Left>& left, const FieldExpression<Right>& right) {
+  return Internal::BinaryFieldExpression<Left, Right, Internal::FieldMultiplication>{
+      left.Self(), right.Self()};
+}
+
+/// \brief Product of an expression over fields and a number or a physical quantity.
+template <typename Left, typename Right,
+          typename = std::enable_if_t<Internal::IsConstantOperand<Right>>>
+[[nodiscard]] inline auto operator*(const FieldExpression<Left>& left, const Right& right) {
+  return left * Internal::MakeConstantOperand<typename Left::NumericType>(right);
+}
+
+/// \brief Product of a number or a physical quantity and an expression over fields.
+template <typename Left, typename Right,
+          typename = std::enable_if_t<Internal::IsConstantOperand<Left>>>
+[[nodiscard]] inline auto operator*(const Left& left, const FieldExpression<Right>& right) {
+  return Internal::MakeConstantOperand<typename Right::NumericType>(left) * right;
+}
+
+/// \brief Quotient of two expressions over fields, the second of which is a scalar.
+template <typename Left, typename Right>
+[[nodiscard]] inline auto operator/(
+    const FieldExpression<Left>& left, const FieldExpression<Right>& right) {
+  return Internal::BinaryFieldExpression<Left, Right, Internal::FieldDivision>{
+      left.Self(), right.Self()};
+}
+
+/// \brief Quotient of an expression over fields and a number or a scalar physical quantity.
+template <typename Left, typename Right,
+          typename = std::enable_if_t<Internal::IsConstantOperand<Right>>>
+[[nodiscard]] inline auto operator/(const FieldExpression<Left>& left, const Right& right) {
+  return left / Internal::MakeConstantOperand<typename Left::NumericType>(right);
+}
+
+}  // namespace PhQ
+
+#endif  // PHQ_FIELD_EXPRESSION_HPP
@@ -0,0 +1,6463 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_LITERALS_HPP
+#define PHQ_LITERALS_HPP
+
+#include <type_traits>
+
+#include "DimensionalScalar.hpp"
+#include "Unit.hpp"
+#include "Unit/Acceleration.hpp"
+#include "Unit/Angle.hpp"
+#include "Unit/AngularAcceleration.hpp"
+#include "Unit/AngularSpeed.hpp"
+#include "Unit/Area.hpp"
+#include "Unit/Diffusivity.hpp"
+#include "Unit/DynamicViscosity.hpp"
+#include "Unit/ElectricCharge.hpp"
+#include "Unit/ElectricCurrent.hpp"
+#include "Unit/Energy.hpp"
+#include "Unit/EnergyFlux.hpp"
+#include "Unit/Force.hpp"
+#include "Unit/Frequency.hpp"
+#include "Unit/HeatCapacity.hpp"
+#include "Unit/Length.hpp"
+#include "Unit/Mass.hpp"
+#include "Unit/MassDensity.hpp"
+#include "Unit/MassRate.hpp"
+#include "Unit/Memory.hpp"
+#include "Unit/MemoryRate.hpp"
+#include "Unit/Power.hpp"
+#include "Unit/Pressure.hpp"
+#include "Unit/SolidAngle.hpp"
+#include "Unit/SpecificEnergy.hpp"
+#include "Unit/SpecificHeatCapacity.hpp"
+#include "Unit/SpecificPower.hpp"
+#include "Unit/Speed.hpp"
+#include "Unit/SubstanceAmount.hpp"
+#include "Unit/Temperature.hpp"
+#include "Unit/TemperatureGradient.hpp"
+#include "Unit/ThermalConductivity.hpp"
+#include "Unit/ThermalExpansion.hpp"
+#include "Unit/Time.hpp"
+#include "Unit/TransportEnergyConsumption.hpp"
+#include "Unit/Volume.hpp"
+#include "Unit/VolumeRate.hpp"
+
+namespace PhQ {
+
+namespace Internal {
+
+/// \brief Trait that determines whether a type is a scalar physical quantity of a given unit type
+/// and numeric type. Types that are only forward-declared, which commonly occurs for physical
+/// quantities that appear in the constructors of other physical quantities, are not scalar physical
+/// quantities. Internal implementation detail not intended to be used outside of the
+/// PhQ::ScalarLiteral class template.
+template <typename UnitType, typename NumericType, typename Type, typename = void>
+struct IsScalarQuantity : std::false_type {};
+
+template <typename UnitType, typename NumericType, typename Type>
+struct IsScalarQuantity<UnitType, NumericType, Type, std::void_t<decltype(sizeof(Type))>>
+  : std::is_base_of<DimensionalScalar<UnitType, NumericType>, Type> {};
+
+}  // namespace Internal
+
+/// \brief Scalar value produced by a user-defined literal of the PhQ::Literals namespace, such as
+/// 12.5_km or 3.0_MPa. Its unit of measure is fixed at compile time. It converts implicitly to any
+/// scalar physical quantity of the same unit type, such as PhQ::Length or PhQ::StaticPressure,
+/// through PhQ::ConvertStatically in extended precision, so that a statement such as
+/// `constexpr PhQ::Length<> length = 12.5_km;` is resolved entirely at compile time. Negation is
+/// applied in this literal's unit of measure, so -40.0_degC is correctly 233.15 K.
+/// \tparam UnitValue Unit of measure of this literal, such as Unit::Length::Kilometre.
+template <auto UnitValue>
+class ScalarLiteral {
+public:
+  /// \brief Unit of measure enumeration type of this literal.
+  using UnitType = decltype(UnitValue);
+
+  /// \brief Constructor. Constructs a scalar literal with a given value expressed in its unit of
+  /// measure.
+  explicit constexpr ScalarLiteral(const long double value) : value(value) {}
+
+  /// \brief Unit of measure of this scalar literal.
+  [[nodiscard]] static constexpr UnitType Unit() {
+    return UnitValue;
+  }
+
+  /// \brief Value of this scalar literal expressed in its unit of measure.
+  [[nodiscard]] constexpr long double Value() const noexcept {
+    return value;
+  }
+
+  /// \brief Converts this scalar literal to a scalar physical quantity of the same unit type. This
+  /// conversion can be evaluated statically at compile-time.
+  /// \tparam Quantity Scalar physical quantity class template. Deduced automatically.
+  /// \tparam NumericType Floating-point numeric type of the scalar physical quantity. Deduced
+  /// automatically.
+  template <template <typename> class Quantity, typename NumericType,
+            std::enable_if_t<Internal::IsScalarQuantity<UnitType, NumericType,
+                                                         Quantity<NumericType>>::value,
+                             bool> = true>
+  constexpr operator Quantity<NumericType>() const {
+    return Quantity<NumericType>::template Create<Standard<UnitType>>(static_cast<NumericType>(
+        ConvertStatically<UnitType, UnitValue, Standard<UnitType>>(value)));
+  }
+
+  constexpr ScalarLiteral<UnitValue> operator+() const noexcept {
+    return *this;
+  }
+
+  constexpr ScalarLiteral<UnitValue> operator-() const noexcept {
+    return ScalarLiteral<UnitValue>{-value};
+  }
+
+private:
+  /// \brief Value of this scalar literal expressed in its unit of measure.
+  long double value;
+};
+
+/// \brief Namespace that contains user-defined literals for scalar physical quantities, such as
+/// 12.5_km or 3.0_MPa. Each literal's suffix is derived from the abbreviation of its unit of
+/// measure: "μ" is written "u", "°" is written "deg", "·" is written "_", "/" is written "_per_",
+/// and exponents are written without "^", such as 9.81_m_per_s2 or 20.0_degC. Temperature
+/// difference units share their abbreviations with temperature units, so temperature literals are
+/// only defined for PhQ::Temperature. Bring these literals into scope with
+/// `using namespace PhQ::Literals;`.
+namespace Literals {
+
+/// \brief Nautical mile per square second (nmi/s^2) acceleration literal. For example,
+/// 1.5_nmi_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::NauticalMilePerSquareSecond>
+operator""_nmi_per_s2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::NauticalMilePerSquareSecond>{value};
+}
+
+/// \brief Nautical mile per square second (nmi/s^2) acceleration literal. For example,
+/// 2_nmi_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::NauticalMilePerSquareSecond>
+operator""_nmi_per_s2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::NauticalMilePerSquareSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Nautical mile per square minute (nmi/min^2) acceleration literal. For example,
+/// 1.5_nmi_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::NauticalMilePerSquareMinute>
+operator""_nmi_per_min2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::NauticalMilePerSquareMinute>{value};
+}
+
+/// \brief Nautical mile per square minute (nmi/min^2) acceleration literal. For example,
+/// 2_nmi_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::NauticalMilePerSquareMinute>
+operator""_nmi_per_min2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::NauticalMilePerSquareMinute>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Knot per hour (kn/hr) acceleration literal, also known as nautical mile per square hour.
+/// For example, 1.5_kn_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::KnotPerHour> operator""_kn_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::Acceleration::KnotPerHour>{value};
+}
+
+/// \brief Knot per hour (kn/hr) acceleration literal, also known as nautical mile per square hour.
+/// For example, 2_kn_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::KnotPerHour> operator""_kn_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::KnotPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Mile per square second (mi/s^2) acceleration literal. For example, 1.5_mi_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MilePerSquareSecond> operator""_mi_per_s2(
+    const long double value) {
+  return ScalarLiteral<Unit::Acceleration::MilePerSquareSecond>{value};
+}
+
+/// \brief Mile per square second (mi/s^2) acceleration literal. For example, 2_mi_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MilePerSquareSecond> operator""_mi_per_s2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::MilePerSquareSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Mile per square minute (mi/min^2) acceleration literal. For example, 1.5_mi_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MilePerSquareMinute>
+operator""_mi_per_min2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::MilePerSquareMinute>{value};
+}
+
+/// \brief Mile per square minute (mi/min^2) acceleration literal. For example, 2_mi_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MilePerSquareMinute>
+operator""_mi_per_min2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::MilePerSquareMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Mile per square hour (mi/hr^2) acceleration literal. For example, 1.5_mi_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MilePerSquareHour> operator""_mi_per_hr2(
+    const long double value) {
+  return ScalarLiteral<Unit::Acceleration::MilePerSquareHour>{value};
+}
+
+/// \brief Mile per square hour (mi/hr^2) acceleration literal. For example, 2_mi_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MilePerSquareHour> operator""_mi_per_hr2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::MilePerSquareHour>{static_cast<long double>(value)};
+}
+
+/// \brief Kilometre per square second (km/s^2) acceleration literal. For example, 1.5_km_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::KilometrePerSquareSecond>
+operator""_km_per_s2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::KilometrePerSquareSecond>{value};
+}
+
+/// \brief Kilometre per square second (km/s^2) acceleration literal. For example, 2_km_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::KilometrePerSquareSecond>
+operator""_km_per_s2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::KilometrePerSquareSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Kilometre per square minute (km/min^2) acceleration literal. For example,
+/// 1.5_km_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::KilometrePerSquareMinute>
+operator""_km_per_min2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::KilometrePerSquareMinute>{value};
+}
+
+/// \brief Kilometre per square minute (km/min^2) acceleration literal. For example, 2_km_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::KilometrePerSquareMinute>
+operator""_km_per_min2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::KilometrePerSquareMinute>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Kilometre per square hour (km/hr^2) acceleration literal. For example, 1.5_km_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::KilometrePerSquareHour>
+operator""_km_per_hr2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::KilometrePerSquareHour>{value};
+}
+
+/// \brief Kilometre per square hour (km/hr^2) acceleration literal. For example, 2_km_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::KilometrePerSquareHour>
+operator""_km_per_hr2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::KilometrePerSquareHour>{static_cast<long double>(value)};
+}
+
+/// \brief Metre per square second (m/s^2) acceleration literal. For example, 1.5_m_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MetrePerSquareSecond> operator""_m_per_s2(
+    const long double value) {
+  return ScalarLiteral<Unit::Acceleration::MetrePerSquareSecond>{value};
+}
+
+/// \brief Metre per square second (m/s^2) acceleration literal. For example, 2_m_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MetrePerSquareSecond> operator""_m_per_s2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::MetrePerSquareSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Metre per square minute (m/min^2) acceleration literal. For example, 1.5_m_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MetrePerSquareMinute>
+operator""_m_per_min2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::MetrePerSquareMinute>{value};
+}
+
+/// \brief Metre per square minute (m/min^2) acceleration literal. For example, 2_m_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MetrePerSquareMinute>
+operator""_m_per_min2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::MetrePerSquareMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Metre per square hour (m/hr^2) acceleration literal. For example, 1.5_m_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MetrePerSquareHour> operator""_m_per_hr2(
+    const long double value) {
+  return ScalarLiteral<Unit::Acceleration::MetrePerSquareHour>{value};
+}
+
+/// \brief Metre per square hour (m/hr^2) acceleration literal. For example, 2_m_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MetrePerSquareHour> operator""_m_per_hr2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::MetrePerSquareHour>{static_cast<long double>(value)};
+}
+
+/// \brief Yard per square second (yd/s^2) acceleration literal. For example, 1.5_yd_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::YardPerSquareSecond> operator""_yd_per_s2(
+    const long double value) {
+  return ScalarLiteral<Unit::Acceleration::YardPerSquareSecond>{value};
+}
+
+/// \brief Yard per square second (yd/s^2) acceleration literal. For example, 2_yd_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::YardPerSquareSecond> operator""_yd_per_s2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::YardPerSquareSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Yard per square minute (yd/min^2) acceleration literal. For example, 1.5_yd_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::YardPerSquareMinute>
+operator""_yd_per_min2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::YardPerSquareMinute>{value};
+}
+
+/// \brief Yard per square minute (yd/min^2) acceleration literal. For example, 2_yd_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::YardPerSquareMinute>
+operator""_yd_per_min2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::YardPerSquareMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Yard per square hour (yd/hr^2) acceleration literal. For example, 1.5_yd_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::YardPerSquareHour> operator""_yd_per_hr2(
+    const long double value) {
+  return ScalarLiteral<Unit::Acceleration::YardPerSquareHour>{value};
+}
+
+/// \brief Yard per square hour (yd/hr^2) acceleration literal. For example, 2_yd_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::YardPerSquareHour> operator""_yd_per_hr2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::YardPerSquareHour>{static_cast<long double>(value)};
+}
+
+/// \brief Foot per square second (ft/s^2) acceleration literal. For example, 1.5_ft_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::FootPerSquareSecond> operator""_ft_per_s2(
+    const long double value) {
+  return ScalarLiteral<Unit::Acceleration::FootPerSquareSecond>{value};
+}
+
+/// \brief Foot per square second (ft/s^2) acceleration literal. For example, 2_ft_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::FootPerSquareSecond> operator""_ft_per_s2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::FootPerSquareSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Foot per square minute (ft/min^2) acceleration literal. For example, 1.5_ft_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::FootPerSquareMinute>
+operator""_ft_per_min2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::FootPerSquareMinute>{value};
+}
+
+/// \brief Foot per square minute (ft/min^2) acceleration literal. For example, 2_ft_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::FootPerSquareMinute>
+operator""_ft_per_min2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::FootPerSquareMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Foot per square hour (ft/hr^2) acceleration literal. For example, 1.5_ft_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::FootPerSquareHour> operator""_ft_per_hr2(
+    const long double value) {
+  return ScalarLiteral<Unit::Acceleration::FootPerSquareHour>{value};
+}
+
+/// \brief Foot per square hour (ft/hr^2) acceleration literal. For example, 2_ft_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::FootPerSquareHour> operator""_ft_per_hr2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::FootPerSquareHour>{static_cast<long double>(value)};
+}
+
+/// \brief Decimetre per square second (dm/s^2) acceleration literal. For example, 1.5_dm_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::DecimetrePerSquareSecond>
+operator""_dm_per_s2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::DecimetrePerSquareSecond>{value};
+}
+
+/// \brief Decimetre per square second (dm/s^2) acceleration literal. For example, 2_dm_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::DecimetrePerSquareSecond>
+operator""_dm_per_s2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::DecimetrePerSquareSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Decimetre per square minute (dm/min^2) acceleration literal. For example,
+/// 1.5_dm_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::DecimetrePerSquareMinute>
+operator""_dm_per_min2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::DecimetrePerSquareMinute>{value};
+}
+
+/// \brief Decimetre per square minute (dm/min^2) acceleration literal. For example, 2_dm_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::DecimetrePerSquareMinute>
+operator""_dm_per_min2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::DecimetrePerSquareMinute>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Decimetre per square hour (dm/hr^2) acceleration literal. For example, 1.5_dm_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::DecimetrePerSquareHour>
+operator""_dm_per_hr2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::DecimetrePerSquareHour>{value};
+}
+
+/// \brief Decimetre per square hour (dm/hr^2) acceleration literal. For example, 2_dm_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::DecimetrePerSquareHour>
+operator""_dm_per_hr2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::DecimetrePerSquareHour>{static_cast<long double>(value)};
+}
+
+/// \brief Inch per square second (in/s^2) acceleration literal. For example, 1.5_in_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::InchPerSquareSecond> operator""_in_per_s2(
+    const long double value) {
+  return ScalarLiteral<Unit::Acceleration::InchPerSquareSecond>{value};
+}
+
+/// \brief Inch per square second (in/s^2) acceleration literal. For example, 2_in_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::InchPerSquareSecond> operator""_in_per_s2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::InchPerSquareSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Inch per square minute (in/min^2) acceleration literal. For example, 1.5_in_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::InchPerSquareMinute>
+operator""_in_per_min2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::InchPerSquareMinute>{value};
+}
+
+/// \brief Inch per square minute (in/min^2) acceleration literal. For example, 2_in_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::InchPerSquareMinute>
+operator""_in_per_min2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::InchPerSquareMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Inch per square hour (in/hr^2) acceleration literal. For example, 1.5_in_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::InchPerSquareHour> operator""_in_per_hr2(
+    const long double value) {
+  return ScalarLiteral<Unit::Acceleration::InchPerSquareHour>{value};
+}
+
+/// \brief Inch per square hour (in/hr^2) acceleration literal. For example, 2_in_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::InchPerSquareHour> operator""_in_per_hr2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::InchPerSquareHour>{static_cast<long double>(value)};
+}
+
+/// \brief Centimetre per square second (cm/s^2) acceleration literal. For example, 1.5_cm_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::CentimetrePerSquareSecond>
+operator""_cm_per_s2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::CentimetrePerSquareSecond>{value};
+}
+
+/// \brief Centimetre per square second (cm/s^2) acceleration literal. For example, 2_cm_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::CentimetrePerSquareSecond>
+operator""_cm_per_s2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::CentimetrePerSquareSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Centimetre per square minute (cm/min^2) acceleration literal. For example,
+/// 1.5_cm_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::CentimetrePerSquareMinute>
+operator""_cm_per_min2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::CentimetrePerSquareMinute>{value};
+}
+
+/// \brief Centimetre per square minute (cm/min^2) acceleration literal. For example, 2_cm_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::CentimetrePerSquareMinute>
+operator""_cm_per_min2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::CentimetrePerSquareMinute>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Centimetre per square hour (cm/hr^2) acceleration literal. For example, 1.5_cm_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::CentimetrePerSquareHour>
+operator""_cm_per_hr2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::CentimetrePerSquareHour>{value};
+}
+
+/// \brief Centimetre per square hour (cm/hr^2) acceleration literal. For example, 2_cm_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::CentimetrePerSquareHour>
+operator""_cm_per_hr2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::CentimetrePerSquareHour>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Millimetre per square second (mm/s^2) acceleration literal. For example, 1.5_mm_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MillimetrePerSquareSecond>
+operator""_mm_per_s2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::MillimetrePerSquareSecond>{value};
+}
+
+/// \brief Millimetre per square second (mm/s^2) acceleration literal. For example, 2_mm_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MillimetrePerSquareSecond>
+operator""_mm_per_s2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::MillimetrePerSquareSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Millimetre per square minute (mm/min^2) acceleration literal. For example,
+/// 1.5_mm_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MillimetrePerSquareMinute>
+operator""_mm_per_min2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::MillimetrePerSquareMinute>{value};
+}
+
+/// \brief Millimetre per square minute (mm/min^2) acceleration literal. For example, 2_mm_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MillimetrePerSquareMinute>
+operator""_mm_per_min2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::MillimetrePerSquareMinute>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Millimetre per square hour (mm/hr^2) acceleration literal. For example, 1.5_mm_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MillimetrePerSquareHour>
+operator""_mm_per_hr2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::MillimetrePerSquareHour>{value};
+}
+
+/// \brief Millimetre per square hour (mm/hr^2) acceleration literal. For example, 2_mm_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MillimetrePerSquareHour>
+operator""_mm_per_hr2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::MillimetrePerSquareHour>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Milliinch per square second (mil/s^2) acceleration literal. For example, 1.5_mil_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MilliinchPerSquareSecond>
+operator""_mil_per_s2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::MilliinchPerSquareSecond>{value};
+}
+
+/// \brief Milliinch per square second (mil/s^2) acceleration literal. For example, 2_mil_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MilliinchPerSquareSecond>
+operator""_mil_per_s2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::MilliinchPerSquareSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Milliinch per square minute (mil/min^2) acceleration literal. For example,
+/// 1.5_mil_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MilliinchPerSquareMinute>
+operator""_mil_per_min2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::MilliinchPerSquareMinute>{value};
+}
+
+/// \brief Milliinch per square minute (mil/min^2) acceleration literal. For example,
+/// 2_mil_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MilliinchPerSquareMinute>
+operator""_mil_per_min2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::MilliinchPerSquareMinute>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Milliinch per square hour (mil/hr^2) acceleration literal. For example, 1.5_mil_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MilliinchPerSquareHour>
+operator""_mil_per_hr2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::MilliinchPerSquareHour>{value};
+}
+
+/// \brief Milliinch per square hour (mil/hr^2) acceleration literal. For example, 2_mil_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MilliinchPerSquareHour>
+operator""_mil_per_hr2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::MilliinchPerSquareHour>{static_cast<long double>(value)};
+}
+
+/// \brief Micrometre per square second (μm/s^2) acceleration literal. For example, 1.5_um_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MicrometrePerSquareSecond>
+operator""_um_per_s2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::MicrometrePerSquareSecond>{value};
+}
+
+/// \brief Micrometre per square second (μm/s^2) acceleration literal. For example, 2_um_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MicrometrePerSquareSecond>
+operator""_um_per_s2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::MicrometrePerSquareSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Micrometre per square minute (μm/min^2) acceleration literal. For example,
+/// 1.5_um_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MicrometrePerSquareMinute>
+operator""_um_per_min2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::MicrometrePerSquareMinute>{value};
+}
+
+/// \brief Micrometre per square minute (μm/min^2) acceleration literal. For example, 2_um_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MicrometrePerSquareMinute>
+operator""_um_per_min2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::MicrometrePerSquareMinute>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Micrometre per square hour (μm/hr^2) acceleration literal. For example, 1.5_um_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MicrometrePerSquareHour>
+operator""_um_per_hr2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::MicrometrePerSquareHour>{value};
+}
+
+/// \brief Micrometre per square hour (μm/hr^2) acceleration literal. For example, 2_um_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MicrometrePerSquareHour>
+operator""_um_per_hr2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::MicrometrePerSquareHour>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Microinch per square second (μin/s^2) acceleration literal. For example, 1.5_uin_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MicroinchPerSquareSecond>
+operator""_uin_per_s2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::MicroinchPerSquareSecond>{value};
+}
+
+/// \brief Microinch per square second (μin/s^2) acceleration literal. For example, 2_uin_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MicroinchPerSquareSecond>
+operator""_uin_per_s2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::MicroinchPerSquareSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Microinch per square minute (μin/min^2) acceleration literal. For example,
+/// 1.5_uin_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MicroinchPerSquareMinute>
+operator""_uin_per_min2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::MicroinchPerSquareMinute>{value};
+}
+
+/// \brief Microinch per square minute (μin/min^2) acceleration literal. For example,
+/// 2_uin_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MicroinchPerSquareMinute>
+operator""_uin_per_min2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::MicroinchPerSquareMinute>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Microinch per square hour (μin/hr^2) acceleration literal. For example, 1.5_uin_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MicroinchPerSquareHour>
+operator""_uin_per_hr2(const long double value) {
+  return ScalarLiteral<Unit::Acceleration::MicroinchPerSquareHour>{value};
+}
+
+/// \brief Microinch per square hour (μin/hr^2) acceleration literal. For example, 2_uin_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Acceleration::MicroinchPerSquareHour>
+operator""_uin_per_hr2(const unsigned long long value) {
+  return ScalarLiteral<Unit::Acceleration::MicroinchPerSquareHour>{static_cast<long double>(value)};
+}
+
+/// \brief Radian (rad) angle literal. For example, 1.5_rad.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Angle::Radian> operator""_rad(const long double value) {
+  return ScalarLiteral<Unit::Angle::Radian>{value};
+}
+
+/// \brief Radian (rad) angle literal. For example, 2_rad.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Angle::Radian> operator""_rad(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Angle::Radian>{static_cast<long double>(value)};
+}
+
+/// \brief Degree (deg) angle literal. For example, 1.5_deg.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Angle::Degree> operator""_deg(const long double value) {
+  return ScalarLiteral<Unit::Angle::Degree>{value};
+}
+
+/// \brief Degree (deg) angle literal. For example, 2_deg.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Angle::Degree> operator""_deg(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Angle::Degree>{static_cast<long double>(value)};
+}
+
+/// \brief Arcminute (arcmin) angle literal. For example, 1.5_arcmin.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Angle::Arcminute> operator""_arcmin(
+    const long double value) {
+  return ScalarLiteral<Unit::Angle::Arcminute>{value};
+}
+
+/// \brief Arcminute (arcmin) angle literal. For example, 2_arcmin.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Angle::Arcminute> operator""_arcmin(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Angle::Arcminute>{static_cast<long double>(value)};
+}
+
+/// \brief Arcsecond (arcsec) angle literal. For example, 1.5_arcsec.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Angle::Arcsecond> operator""_arcsec(
+    const long double value) {
+  return ScalarLiteral<Unit::Angle::Arcsecond>{value};
+}
+
+/// \brief Arcsecond (arcsec) angle literal. For example, 2_arcsec.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Angle::Arcsecond> operator""_arcsec(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Angle::Arcsecond>{static_cast<long double>(value)};
+}
+
+/// \brief Revolution (rev) angle literal. For example, 1.5_rev.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Angle::Revolution> operator""_rev(
+    const long double value) {
+  return ScalarLiteral<Unit::Angle::Revolution>{value};
+}
+
+/// \brief Revolution (rev) angle literal. For example, 2_rev.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Angle::Revolution> operator""_rev(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Angle::Revolution>{static_cast<long double>(value)};
+}
+
+/// \brief Radian per square second (rad/s^2) angular acceleration literal. For example,
+/// 1.5_rad_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::RadianPerSquareSecond>
+operator""_rad_per_s2(const long double value) {
+  return ScalarLiteral<Unit::AngularAcceleration::RadianPerSquareSecond>{value};
+}
+
+/// \brief Radian per square second (rad/s^2) angular acceleration literal. For example,
+/// 2_rad_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::RadianPerSquareSecond>
+operator""_rad_per_s2(const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularAcceleration::RadianPerSquareSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Radian per square minute (rad/min^2) angular acceleration literal. For example,
+/// 1.5_rad_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::RadianPerSquareMinute>
+operator""_rad_per_min2(const long double value) {
+  return ScalarLiteral<Unit::AngularAcceleration::RadianPerSquareMinute>{value};
+}
+
+/// \brief Radian per square minute (rad/min^2) angular acceleration literal. For example,
+/// 2_rad_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::RadianPerSquareMinute>
+operator""_rad_per_min2(const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularAcceleration::RadianPerSquareMinute>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Radian per square hour (rad/hr^2) angular acceleration literal. For example,
+/// 1.5_rad_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::RadianPerSquareHour>
+operator""_rad_per_hr2(const long double value) {
+  return ScalarLiteral<Unit::AngularAcceleration::RadianPerSquareHour>{value};
+}
+
+/// \brief Radian per square hour (rad/hr^2) angular acceleration literal. For example,
+/// 2_rad_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::RadianPerSquareHour>
+operator""_rad_per_hr2(const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularAcceleration::RadianPerSquareHour>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Degree per square second (deg/s^2) angular acceleration literal. For example,
+/// 1.5_deg_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::DegreePerSquareSecond>
+operator""_deg_per_s2(const long double value) {
+  return ScalarLiteral<Unit::AngularAcceleration::DegreePerSquareSecond>{value};
+}
+
+/// \brief Degree per square second (deg/s^2) angular acceleration literal. For example,
+/// 2_deg_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::DegreePerSquareSecond>
+operator""_deg_per_s2(const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularAcceleration::DegreePerSquareSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Degree per square minute (deg/min^2) angular acceleration literal. For example,
+/// 1.5_deg_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::DegreePerSquareMinute>
+operator""_deg_per_min2(const long double value) {
+  return ScalarLiteral<Unit::AngularAcceleration::DegreePerSquareMinute>{value};
+}
+
+/// \brief Degree per square minute (deg/min^2) angular acceleration literal. For example,
+/// 2_deg_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::DegreePerSquareMinute>
+operator""_deg_per_min2(const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularAcceleration::DegreePerSquareMinute>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Degree per square hour (deg/hr^2) angular acceleration literal. For example,
+/// 1.5_deg_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::DegreePerSquareHour>
+operator""_deg_per_hr2(const long double value) {
+  return ScalarLiteral<Unit::AngularAcceleration::DegreePerSquareHour>{value};
+}
+
+/// \brief Degree per square hour (deg/hr^2) angular acceleration literal. For example,
+/// 2_deg_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::DegreePerSquareHour>
+operator""_deg_per_hr2(const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularAcceleration::DegreePerSquareHour>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Arcminute per square second (arcmin/s^2) angular acceleration literal. For example,
+/// 1.5_arcmin_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::ArcminutePerSquareSecond>
+operator""_arcmin_per_s2(const long double value) {
+  return ScalarLiteral<Unit::AngularAcceleration::ArcminutePerSquareSecond>{value};
+}
+
+/// \brief Arcminute per square second (arcmin/s^2) angular acceleration literal. For example,
+/// 2_arcmin_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::ArcminutePerSquareSecond>
+operator""_arcmin_per_s2(const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularAcceleration::ArcminutePerSquareSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Arcminute per square minute (arcmin/min^2) angular acceleration literal. For example,
+/// 1.5_arcmin_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::ArcminutePerSquareMinute>
+operator""_arcmin_per_min2(const long double value) {
+  return ScalarLiteral<Unit::AngularAcceleration::ArcminutePerSquareMinute>{value};
+}
+
+/// \brief Arcminute per square minute (arcmin/min^2) angular acceleration literal. For example,
+/// 2_arcmin_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::ArcminutePerSquareMinute>
+operator""_arcmin_per_min2(const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularAcceleration::ArcminutePerSquareMinute>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Arcminute per square hour (arcmin/hr^2) angular acceleration literal. For example,
+/// 1.5_arcmin_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::ArcminutePerSquareHour>
+operator""_arcmin_per_hr2(const long double value) {
+  return ScalarLiteral<Unit::AngularAcceleration::ArcminutePerSquareHour>{value};
+}
+
+/// \brief Arcminute per square hour (arcmin/hr^2) angular acceleration literal. For example,
+/// 2_arcmin_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::ArcminutePerSquareHour>
+operator""_arcmin_per_hr2(const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularAcceleration::ArcminutePerSquareHour>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Arcsecond per square second (arcsec/s^2) angular acceleration literal. For example,
+/// 1.5_arcsec_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::ArcsecondPerSquareSecond>
+operator""_arcsec_per_s2(const long double value) {
+  return ScalarLiteral<Unit::AngularAcceleration::ArcsecondPerSquareSecond>{value};
+}
+
+/// \brief Arcsecond per square second (arcsec/s^2) angular acceleration literal. For example,
+/// 2_arcsec_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::ArcsecondPerSquareSecond>
+operator""_arcsec_per_s2(const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularAcceleration::ArcsecondPerSquareSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Arcsecond per square minute (arcsec/min^2) angular acceleration literal. For example,
+/// 1.5_arcsec_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::ArcsecondPerSquareMinute>
+operator""_arcsec_per_min2(const long double value) {
+  return ScalarLiteral<Unit::AngularAcceleration::ArcsecondPerSquareMinute>{value};
+}
+
+/// \brief Arcsecond per square minute (arcsec/min^2) angular acceleration literal. For example,
+/// 2_arcsec_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::ArcsecondPerSquareMinute>
+operator""_arcsec_per_min2(const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularAcceleration::ArcsecondPerSquareMinute>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Arcsecond per square hour (arcsec/hr^2) angular acceleration literal. For example,
+/// 1.5_arcsec_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::ArcsecondPerSquareHour>
+operator""_arcsec_per_hr2(const long double value) {
+  return ScalarLiteral<Unit::AngularAcceleration::ArcsecondPerSquareHour>{value};
+}
+
+/// \brief Arcsecond per square hour (arcsec/hr^2) angular acceleration literal. For example,
+/// 2_arcsec_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::ArcsecondPerSquareHour>
+operator""_arcsec_per_hr2(const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularAcceleration::ArcsecondPerSquareHour>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Revolution per square second (rev/s^2) angular acceleration literal. For example,
+/// 1.5_rev_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::RevolutionPerSquareSecond>
+operator""_rev_per_s2(const long double value) {
+  return ScalarLiteral<Unit::AngularAcceleration::RevolutionPerSquareSecond>{value};
+}
+
+/// \brief Revolution per square second (rev/s^2) angular acceleration literal. For example,
+/// 2_rev_per_s2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::RevolutionPerSquareSecond>
+operator""_rev_per_s2(const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularAcceleration::RevolutionPerSquareSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Revolution per square minute (rev/min^2) angular acceleration literal. For example,
+/// 1.5_rev_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::RevolutionPerSquareMinute>
+operator""_rev_per_min2(const long double value) {
+  return ScalarLiteral<Unit::AngularAcceleration::RevolutionPerSquareMinute>{value};
+}
+
+/// \brief Revolution per square minute (rev/min^2) angular acceleration literal. For example,
+/// 2_rev_per_min2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::RevolutionPerSquareMinute>
+operator""_rev_per_min2(const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularAcceleration::RevolutionPerSquareMinute>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Revolution per square hour (rev/hr^2) angular acceleration literal. For example,
+/// 1.5_rev_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::RevolutionPerSquareHour>
+operator""_rev_per_hr2(const long double value) {
+  return ScalarLiteral<Unit::AngularAcceleration::RevolutionPerSquareHour>{value};
+}
+
+/// \brief Revolution per square hour (rev/hr^2) angular acceleration literal. For example,
+/// 2_rev_per_hr2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularAcceleration::RevolutionPerSquareHour>
+operator""_rev_per_hr2(const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularAcceleration::RevolutionPerSquareHour>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Radian per second (rad/s) angular speed literal. For example, 1.5_rad_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::RadianPerSecond> operator""_rad_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::AngularSpeed::RadianPerSecond>{value};
+}
+
+/// \brief Radian per second (rad/s) angular speed literal. For example, 2_rad_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::RadianPerSecond> operator""_rad_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularSpeed::RadianPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Radian per minute (rad/min) angular speed literal. For example, 1.5_rad_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::RadianPerMinute> operator""_rad_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::AngularSpeed::RadianPerMinute>{value};
+}
+
+/// \brief Radian per minute (rad/min) angular speed literal. For example, 2_rad_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::RadianPerMinute> operator""_rad_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularSpeed::RadianPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Radian per hour (rad/hr) angular speed literal. For example, 1.5_rad_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::RadianPerHour> operator""_rad_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::AngularSpeed::RadianPerHour>{value};
+}
+
+/// \brief Radian per hour (rad/hr) angular speed literal. For example, 2_rad_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::RadianPerHour> operator""_rad_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularSpeed::RadianPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Degree per second (deg/s) angular speed literal. For example, 1.5_deg_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::DegreePerSecond> operator""_deg_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::AngularSpeed::DegreePerSecond>{value};
+}
+
+/// \brief Degree per second (deg/s) angular speed literal. For example, 2_deg_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::DegreePerSecond> operator""_deg_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularSpeed::DegreePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Degree per minute (deg/min) angular speed literal. For example, 1.5_deg_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::DegreePerMinute> operator""_deg_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::AngularSpeed::DegreePerMinute>{value};
+}
+
+/// \brief Degree per minute (deg/min) angular speed literal. For example, 2_deg_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::DegreePerMinute> operator""_deg_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularSpeed::DegreePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Degree per hour (deg/hr) angular speed literal. For example, 1.5_deg_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::DegreePerHour> operator""_deg_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::AngularSpeed::DegreePerHour>{value};
+}
+
+/// \brief Degree per hour (deg/hr) angular speed literal. For example, 2_deg_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::DegreePerHour> operator""_deg_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularSpeed::DegreePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Arcminute per second (arcmin/s) angular speed literal. For example, 1.5_arcmin_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::ArcminutePerSecond>
+operator""_arcmin_per_s(const long double value) {
+  return ScalarLiteral<Unit::AngularSpeed::ArcminutePerSecond>{value};
+}
+
+/// \brief Arcminute per second (arcmin/s) angular speed literal. For example, 2_arcmin_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::ArcminutePerSecond>
+operator""_arcmin_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularSpeed::ArcminutePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Arcminute per minute (arcmin/min) angular speed literal. For example, 1.5_arcmin_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::ArcminutePerMinute>
+operator""_arcmin_per_min(const long double value) {
+  return ScalarLiteral<Unit::AngularSpeed::ArcminutePerMinute>{value};
+}
+
+/// \brief Arcminute per minute (arcmin/min) angular speed literal. For example, 2_arcmin_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::ArcminutePerMinute>
+operator""_arcmin_per_min(const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularSpeed::ArcminutePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Arcminute per hour (arcmin/hr) angular speed literal. For example, 1.5_arcmin_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::ArcminutePerHour>
+operator""_arcmin_per_hr(const long double value) {
+  return ScalarLiteral<Unit::AngularSpeed::ArcminutePerHour>{value};
+}
+
+/// \brief Arcminute per hour (arcmin/hr) angular speed literal. For example, 2_arcmin_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::ArcminutePerHour>
+operator""_arcmin_per_hr(const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularSpeed::ArcminutePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Arcsecond per second (arcsec/s) angular speed literal. For example, 1.5_arcsec_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::ArcsecondPerSecond>
+operator""_arcsec_per_s(const long double value) {
+  return ScalarLiteral<Unit::AngularSpeed::ArcsecondPerSecond>{value};
+}
+
+/// \brief Arcsecond per second (arcsec/s) angular speed literal. For example, 2_arcsec_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::ArcsecondPerSecond>
+operator""_arcsec_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularSpeed::ArcsecondPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Arcsecond per minute (arcsec/min) angular speed literal. For example, 1.5_arcsec_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::ArcsecondPerMinute>
+operator""_arcsec_per_min(const long double value) {
+  return ScalarLiteral<Unit::AngularSpeed::ArcsecondPerMinute>{value};
+}
+
+/// \brief Arcsecond per minute (arcsec/min) angular speed literal. For example, 2_arcsec_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::ArcsecondPerMinute>
+operator""_arcsec_per_min(const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularSpeed::ArcsecondPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Arcsecond per hour (arcsec/hr) angular speed literal. For example, 1.5_arcsec_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::ArcsecondPerHour>
+operator""_arcsec_per_hr(const long double value) {
+  return ScalarLiteral<Unit::AngularSpeed::ArcsecondPerHour>{value};
+}
+
+/// \brief Arcsecond per hour (arcsec/hr) angular speed literal. For example, 2_arcsec_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::ArcsecondPerHour>
+operator""_arcsec_per_hr(const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularSpeed::ArcsecondPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Revolution per second (rev/s) angular speed literal. For example, 1.5_rev_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::RevolutionPerSecond> operator""_rev_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::AngularSpeed::RevolutionPerSecond>{value};
+}
+
+/// \brief Revolution per second (rev/s) angular speed literal. For example, 2_rev_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::RevolutionPerSecond> operator""_rev_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularSpeed::RevolutionPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Revolution per minute (rev/min) angular speed literal. For example, 1.5_rev_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::RevolutionPerMinute>
+operator""_rev_per_min(const long double value) {
+  return ScalarLiteral<Unit::AngularSpeed::RevolutionPerMinute>{value};
+}
+
+/// \brief Revolution per minute (rev/min) angular speed literal. For example, 2_rev_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::RevolutionPerMinute>
+operator""_rev_per_min(const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularSpeed::RevolutionPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Revolution per hour (rev/hr) angular speed literal. For example, 1.5_rev_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::RevolutionPerHour> operator""_rev_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::AngularSpeed::RevolutionPerHour>{value};
+}
+
+/// \brief Revolution per hour (rev/hr) angular speed literal. For example, 2_rev_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::AngularSpeed::RevolutionPerHour> operator""_rev_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::AngularSpeed::RevolutionPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Square nautical mile (nmi^2) area literal. For example, 1.5_nmi2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareNauticalMile> operator""_nmi2(
+    const long double value) {
+  return ScalarLiteral<Unit::Area::SquareNauticalMile>{value};
+}
+
+/// \brief Square nautical mile (nmi^2) area literal. For example, 2_nmi2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareNauticalMile> operator""_nmi2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Area::SquareNauticalMile>{static_cast<long double>(value)};
+}
+
+/// \brief Square mile (mi^2) area literal. For example, 1.5_mi2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareMile> operator""_mi2(
+    const long double value) {
+  return ScalarLiteral<Unit::Area::SquareMile>{value};
+}
+
+/// \brief Square mile (mi^2) area literal. For example, 2_mi2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareMile> operator""_mi2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Area::SquareMile>{static_cast<long double>(value)};
+}
+
+/// \brief Square kilometre (km^2) area literal. For example, 1.5_km2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareKilometre> operator""_km2(
+    const long double value) {
+  return ScalarLiteral<Unit::Area::SquareKilometre>{value};
+}
+
+/// \brief Square kilometre (km^2) area literal. For example, 2_km2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareKilometre> operator""_km2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Area::SquareKilometre>{static_cast<long double>(value)};
+}
+
+/// \brief Hectare (ha) area literal. For example, 1.5_ha.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::Hectare> operator""_ha(const long double value) {
+  return ScalarLiteral<Unit::Area::Hectare>{value};
+}
+
+/// \brief Hectare (ha) area literal. For example, 2_ha.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::Hectare> operator""_ha(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Area::Hectare>{static_cast<long double>(value)};
+}
+
+/// \brief Acre (ac) area literal. For example, 1.5_ac.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::Acre> operator""_ac(const long double value) {
+  return ScalarLiteral<Unit::Area::Acre>{value};
+}
+
+/// \brief Acre (ac) area literal. For example, 2_ac.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::Acre> operator""_ac(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Area::Acre>{static_cast<long double>(value)};
+}
+
+/// \brief Square metre (m^2) area literal. For example, 1.5_m2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareMetre> operator""_m2(
+    const long double value) {
+  return ScalarLiteral<Unit::Area::SquareMetre>{value};
+}
+
+/// \brief Square metre (m^2) area literal. For example, 2_m2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareMetre> operator""_m2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Area::SquareMetre>{static_cast<long double>(value)};
+}
+
+/// \brief Square yard (yd^2) area literal. For example, 1.5_yd2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareYard> operator""_yd2(
+    const long double value) {
+  return ScalarLiteral<Unit::Area::SquareYard>{value};
+}
+
+/// \brief Square yard (yd^2) area literal. For example, 2_yd2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareYard> operator""_yd2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Area::SquareYard>{static_cast<long double>(value)};
+}
+
+/// \brief Square foot (ft^2) area literal. For example, 1.5_ft2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareFoot> operator""_ft2(
+    const long double value) {
+  return ScalarLiteral<Unit::Area::SquareFoot>{value};
+}
+
+/// \brief Square foot (ft^2) area literal. For example, 2_ft2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareFoot> operator""_ft2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Area::SquareFoot>{static_cast<long double>(value)};
+}
+
+/// \brief Square decimetre (dm^2) area literal. For example, 1.5_dm2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareDecimetre> operator""_dm2(
+    const long double value) {
+  return ScalarLiteral<Unit::Area::SquareDecimetre>{value};
+}
+
+/// \brief Square decimetre (dm^2) area literal. For example, 2_dm2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareDecimetre> operator""_dm2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Area::SquareDecimetre>{static_cast<long double>(value)};
+}
+
+/// \brief Square inch (in^2) area literal. For example, 1.5_in2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareInch> operator""_in2(
+    const long double value) {
+  return ScalarLiteral<Unit::Area::SquareInch>{value};
+}
+
+/// \brief Square inch (in^2) area literal. For example, 2_in2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareInch> operator""_in2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Area::SquareInch>{static_cast<long double>(value)};
+}
+
+/// \brief Square centimetre (cm^2) area literal. For example, 1.5_cm2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareCentimetre> operator""_cm2(
+    const long double value) {
+  return ScalarLiteral<Unit::Area::SquareCentimetre>{value};
+}
+
+/// \brief Square centimetre (cm^2) area literal. For example, 2_cm2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareCentimetre> operator""_cm2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Area::SquareCentimetre>{static_cast<long double>(value)};
+}
+
+/// \brief Square millimetre (mm^2) area literal. For example, 1.5_mm2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareMillimetre> operator""_mm2(
+    const long double value) {
+  return ScalarLiteral<Unit::Area::SquareMillimetre>{value};
+}
+
+/// \brief Square millimetre (mm^2) area literal. For example, 2_mm2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareMillimetre> operator""_mm2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Area::SquareMillimetre>{static_cast<long double>(value)};
+}
+
+/// \brief Square milliinch (mil^2) area literal. For example, 1.5_mil2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareMilliinch> operator""_mil2(
+    const long double value) {
+  return ScalarLiteral<Unit::Area::SquareMilliinch>{value};
+}
+
+/// \brief Square milliinch (mil^2) area literal. For example, 2_mil2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareMilliinch> operator""_mil2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Area::SquareMilliinch>{static_cast<long double>(value)};
+}
+
+/// \brief Square micrometre (μm^2) area literal. For example, 1.5_um2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareMicrometre> operator""_um2(
+    const long double value) {
+  return ScalarLiteral<Unit::Area::SquareMicrometre>{value};
+}
+
+/// \brief Square micrometre (μm^2) area literal. For example, 2_um2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareMicrometre> operator""_um2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Area::SquareMicrometre>{static_cast<long double>(value)};
+}
+
+/// \brief Square microinch (μin^2) area literal. For example, 1.5_uin2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareMicroinch> operator""_uin2(
+    const long double value) {
+  return ScalarLiteral<Unit::Area::SquareMicroinch>{value};
+}
+
+/// \brief Square microinch (μin^2) area literal. For example, 2_uin2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Area::SquareMicroinch> operator""_uin2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Area::SquareMicroinch>{static_cast<long double>(value)};
+}
+
+/// \brief Square nautical mile per second (nmi^2/s) diffusivity literal. For example,
+/// 1.5_nmi2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareNauticalMilePerSecond>
+operator""_nmi2_per_s(const long double value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareNauticalMilePerSecond>{value};
+}
+
+/// \brief Square nautical mile per second (nmi^2/s) diffusivity literal. For example, 2_nmi2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareNauticalMilePerSecond>
+operator""_nmi2_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareNauticalMilePerSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Square mile per second (mi^2/s) diffusivity literal. For example, 1.5_mi2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareMilePerSecond> operator""_mi2_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareMilePerSecond>{value};
+}
+
+/// \brief Square mile per second (mi^2/s) diffusivity literal. For example, 2_mi2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareMilePerSecond> operator""_mi2_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareMilePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Square kilometre per second (km^2/s) diffusivity literal. For example, 1.5_km2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareKilometrePerSecond>
+operator""_km2_per_s(const long double value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareKilometrePerSecond>{value};
+}
+
+/// \brief Square kilometre per second (km^2/s) diffusivity literal. For example, 2_km2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareKilometrePerSecond>
+operator""_km2_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareKilometrePerSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Hectare per second (ha/s) diffusivity literal. For example, 1.5_ha_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::HectarePerSecond> operator""_ha_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::Diffusivity::HectarePerSecond>{value};
+}
+
+/// \brief Hectare per second (ha/s) diffusivity literal. For example, 2_ha_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::HectarePerSecond> operator""_ha_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Diffusivity::HectarePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Acre per second (ac/s) diffusivity literal. For example, 1.5_ac_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::AcrePerSecond> operator""_ac_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::Diffusivity::AcrePerSecond>{value};
+}
+
+/// \brief Acre per second (ac/s) diffusivity literal. For example, 2_ac_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::AcrePerSecond> operator""_ac_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Diffusivity::AcrePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Square metre per second (m^2/s) diffusivity literal. For example, 1.5_m2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareMetrePerSecond> operator""_m2_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareMetrePerSecond>{value};
+}
+
+/// \brief Square metre per second (m^2/s) diffusivity literal. For example, 2_m2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareMetrePerSecond> operator""_m2_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareMetrePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Square yard per second (yd^2/s) diffusivity literal. For example, 1.5_yd2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareYardPerSecond> operator""_yd2_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareYardPerSecond>{value};
+}
+
+/// \brief Square yard per second (yd^2/s) diffusivity literal. For example, 2_yd2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareYardPerSecond> operator""_yd2_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareYardPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Square foot per second (ft^2/s) diffusivity literal. For example, 1.5_ft2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareFootPerSecond> operator""_ft2_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareFootPerSecond>{value};
+}
+
+/// \brief Square foot per second (ft^2/s) diffusivity literal. For example, 2_ft2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareFootPerSecond> operator""_ft2_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareFootPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Square decimetre per second (dm^2/s) diffusivity literal. For example, 1.5_dm2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareDecimetrePerSecond>
+operator""_dm2_per_s(const long double value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareDecimetrePerSecond>{value};
+}
+
+/// \brief Square decimetre per second (dm^2/s) diffusivity literal. For example, 2_dm2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareDecimetrePerSecond>
+operator""_dm2_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareDecimetrePerSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Square inch per second (in^2/s) diffusivity literal. For example, 1.5_in2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareInchPerSecond> operator""_in2_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareInchPerSecond>{value};
+}
+
+/// \brief Square inch per second (in^2/s) diffusivity literal. For example, 2_in2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareInchPerSecond> operator""_in2_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareInchPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Square centimetre per second (cm^2/s) diffusivity literal. For example, 1.5_cm2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareCentimetrePerSecond>
+operator""_cm2_per_s(const long double value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareCentimetrePerSecond>{value};
+}
+
+/// \brief Square centimetre per second (cm^2/s) diffusivity literal. For example, 2_cm2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareCentimetrePerSecond>
+operator""_cm2_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareCentimetrePerSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Square millimetre per second (mm^2/s) diffusivity literal. For example, 1.5_mm2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareMillimetrePerSecond>
+operator""_mm2_per_s(const long double value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareMillimetrePerSecond>{value};
+}
+
+/// \brief Square millimetre per second (mm^2/s) diffusivity literal. For example, 2_mm2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareMillimetrePerSecond>
+operator""_mm2_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareMillimetrePerSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Square milliinch per second (mil^2/s) diffusivity literal. For example, 1.5_mil2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareMilliinchPerSecond>
+operator""_mil2_per_s(const long double value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareMilliinchPerSecond>{value};
+}
+
+/// \brief Square milliinch per second (mil^2/s) diffusivity literal. For example, 2_mil2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareMilliinchPerSecond>
+operator""_mil2_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareMilliinchPerSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Square micrometre per second (μm^2/s) diffusivity literal. For example, 1.5_um2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareMicrometrePerSecond>
+operator""_um2_per_s(const long double value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareMicrometrePerSecond>{value};
+}
+
+/// \brief Square micrometre per second (μm^2/s) diffusivity literal. For example, 2_um2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareMicrometrePerSecond>
+operator""_um2_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareMicrometrePerSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Square microinch per second (μin^2/s) diffusivity literal. For example, 1.5_uin2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareMicroinchPerSecond>
+operator""_uin2_per_s(const long double value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareMicroinchPerSecond>{value};
+}
+
+/// \brief Square microinch per second (μin^2/s) diffusivity literal. For example, 2_uin2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Diffusivity::SquareMicroinchPerSecond>
+operator""_uin2_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::Diffusivity::SquareMicroinchPerSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Pascal-second (Pa·s) dynamic viscosity literal. For example, 1.5_Pa_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::DynamicViscosity::PascalSecond> operator""_Pa_s(
+    const long double value) {
+  return ScalarLiteral<Unit::DynamicViscosity::PascalSecond>{value};
+}
+
+/// \brief Pascal-second (Pa·s) dynamic viscosity literal. For example, 2_Pa_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::DynamicViscosity::PascalSecond> operator""_Pa_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::DynamicViscosity::PascalSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Kilopascal-second (kPa·s) dynamic viscosity literal. For example, 1.5_kPa_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::DynamicViscosity::KilopascalSecond> operator""_kPa_s(
+    const long double value) {
+  return ScalarLiteral<Unit::DynamicViscosity::KilopascalSecond>{value};
+}
+
+/// \brief Kilopascal-second (kPa·s) dynamic viscosity literal. For example, 2_kPa_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::DynamicViscosity::KilopascalSecond> operator""_kPa_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::DynamicViscosity::KilopascalSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Megapascal-second (MPa·s) dynamic viscosity literal. For example, 1.5_MPa_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::DynamicViscosity::MegapascalSecond> operator""_MPa_s(
+    const long double value) {
+  return ScalarLiteral<Unit::DynamicViscosity::MegapascalSecond>{value};
+}
+
+/// \brief Megapascal-second (MPa·s) dynamic viscosity literal. For example, 2_MPa_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::DynamicViscosity::MegapascalSecond> operator""_MPa_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::DynamicViscosity::MegapascalSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Gigapascal-second (GPa·s) dynamic viscosity literal. For example, 1.5_GPa_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::DynamicViscosity::GigapascalSecond> operator""_GPa_s(
+    const long double value) {
+  return ScalarLiteral<Unit::DynamicViscosity::GigapascalSecond>{value};
+}
+
+/// \brief Gigapascal-second (GPa·s) dynamic viscosity literal. For example, 2_GPa_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::DynamicViscosity::GigapascalSecond> operator""_GPa_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::DynamicViscosity::GigapascalSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Poise (P) dynamic viscosity literal. For example, 1.5_P.
+[[nodiscard]] constexpr ScalarLiteral<Unit::DynamicViscosity::Poise> operator""_P(
+    const long double value) {
+  return ScalarLiteral<Unit::DynamicViscosity::Poise>{value};
+}
+
+/// \brief Poise (P) dynamic viscosity literal. For example, 2_P.
+[[nodiscard]] constexpr ScalarLiteral<Unit::DynamicViscosity::Poise> operator""_P(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::DynamicViscosity::Poise>{static_cast<long double>(value)};
+}
+
+/// \brief Pound-second per square foot (lbf·s/ft^2) dynamic viscosity literal. For example,
+/// 1.5_lbf_s_per_ft2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::DynamicViscosity::PoundSecondPerSquareFoot>
+operator""_lbf_s_per_ft2(const long double value) {
+  return ScalarLiteral<Unit::DynamicViscosity::PoundSecondPerSquareFoot>{value};
+}
+
+/// \brief Pound-second per square foot (lbf·s/ft^2) dynamic viscosity literal. For example,
+/// 2_lbf_s_per_ft2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::DynamicViscosity::PoundSecondPerSquareFoot>
+operator""_lbf_s_per_ft2(const unsigned long long value) {
+  return ScalarLiteral<Unit::DynamicViscosity::PoundSecondPerSquareFoot>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Pound-second per square inch (lbf·s/in^2) dynamic viscosity literal. For example,
+/// 1.5_lbf_s_per_in2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::DynamicViscosity::PoundSecondPerSquareInch>
+operator""_lbf_s_per_in2(const long double value) {
+  return ScalarLiteral<Unit::DynamicViscosity::PoundSecondPerSquareInch>{value};
+}
+
+/// \brief Pound-second per square inch (lbf·s/in^2) dynamic viscosity literal. For example,
+/// 2_lbf_s_per_in2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::DynamicViscosity::PoundSecondPerSquareInch>
+operator""_lbf_s_per_in2(const unsigned long long value) {
+  return ScalarLiteral<Unit::DynamicViscosity::PoundSecondPerSquareInch>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Coulomb (C) electric charge literal. For example, 1.5_C.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::Coulomb> operator""_C(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::Coulomb>{value};
+}
+
+/// \brief Coulomb (C) electric charge literal. For example, 2_C.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::Coulomb> operator""_C(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::Coulomb>{static_cast<long double>(value)};
+}
+
+/// \brief Kilocoulomb (kC) electric charge literal. For example, 1.5_kC.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::Kilocoulomb> operator""_kC(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::Kilocoulomb>{value};
+}
+
+/// \brief Kilocoulomb (kC) electric charge literal. For example, 2_kC.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::Kilocoulomb> operator""_kC(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::Kilocoulomb>{static_cast<long double>(value)};
+}
+
+/// \brief Megacoulomb (MC) electric charge literal. For example, 1.5_MC.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::Megacoulomb> operator""_MC(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::Megacoulomb>{value};
+}
+
+/// \brief Megacoulomb (MC) electric charge literal. For example, 2_MC.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::Megacoulomb> operator""_MC(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::Megacoulomb>{static_cast<long double>(value)};
+}
+
+/// \brief Gigacoulomb (GC) electric charge literal. For example, 1.5_GC.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::Gigacoulomb> operator""_GC(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::Gigacoulomb>{value};
+}
+
+/// \brief Gigacoulomb (GC) electric charge literal. For example, 2_GC.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::Gigacoulomb> operator""_GC(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::Gigacoulomb>{static_cast<long double>(value)};
+}
+
+/// \brief Teracoulomb (TC) electric charge literal. For example, 1.5_TC.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::Teracoulomb> operator""_TC(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::Teracoulomb>{value};
+}
+
+/// \brief Teracoulomb (TC) electric charge literal. For example, 2_TC.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::Teracoulomb> operator""_TC(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::Teracoulomb>{static_cast<long double>(value)};
+}
+
+/// \brief Millicoulomb (mC) electric charge literal. For example, 1.5_mC.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::Millicoulomb> operator""_mC(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::Millicoulomb>{value};
+}
+
+/// \brief Millicoulomb (mC) electric charge literal. For example, 2_mC.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::Millicoulomb> operator""_mC(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::Millicoulomb>{static_cast<long double>(value)};
+}
+
+/// \brief Microcoulomb (μC) electric charge literal. For example, 1.5_uC.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::Microcoulomb> operator""_uC(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::Microcoulomb>{value};
+}
+
+/// \brief Microcoulomb (μC) electric charge literal. For example, 2_uC.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::Microcoulomb> operator""_uC(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::Microcoulomb>{static_cast<long double>(value)};
+}
+
+/// \brief Nanocoulomb (nC) electric charge literal. For example, 1.5_nC.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::Nanocoulomb> operator""_nC(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::Nanocoulomb>{value};
+}
+
+/// \brief Nanocoulomb (nC) electric charge literal. For example, 2_nC.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::Nanocoulomb> operator""_nC(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::Nanocoulomb>{static_cast<long double>(value)};
+}
+
+/// \brief Elementary charge (e) electric charge literal. For example, 1.5_e.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::ElementaryCharge> operator""_e(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::ElementaryCharge>{value};
+}
+
+/// \brief Elementary charge (e) electric charge literal. For example, 2_e.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::ElementaryCharge> operator""_e(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::ElementaryCharge>{static_cast<long double>(value)};
+}
+
+/// \brief Ampere-minute (A·min) electric charge literal. For example, 1.5_A_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::AmpereMinute> operator""_A_min(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::AmpereMinute>{value};
+}
+
+/// \brief Ampere-minute (A·min) electric charge literal. For example, 2_A_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::AmpereMinute> operator""_A_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::AmpereMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Ampere-hour (A·hr) electric charge literal. For example, 1.5_A_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::AmpereHour> operator""_A_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::AmpereHour>{value};
+}
+
+/// \brief Ampere-hour (A·hr) electric charge literal. For example, 2_A_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::AmpereHour> operator""_A_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::AmpereHour>{static_cast<long double>(value)};
+}
+
+/// \brief Kiloampere-minute (kA·min) electric charge literal. For example, 1.5_kA_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::KiloampereMinute> operator""_kA_min(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::KiloampereMinute>{value};
+}
+
+/// \brief Kiloampere-minute (kA·min) electric charge literal. For example, 2_kA_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::KiloampereMinute> operator""_kA_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::KiloampereMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Kiloampere-hour (kA·hr) electric charge literal. For example, 1.5_kA_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::KiloampereHour> operator""_kA_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::KiloampereHour>{value};
+}
+
+/// \brief Kiloampere-hour (kA·hr) electric charge literal. For example, 2_kA_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::KiloampereHour> operator""_kA_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::KiloampereHour>{static_cast<long double>(value)};
+}
+
+/// \brief Megaampere-minute (MA·min) electric charge literal. For example, 1.5_MA_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::MegaampereMinute> operator""_MA_min(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::MegaampereMinute>{value};
+}
+
+/// \brief Megaampere-minute (MA·min) electric charge literal. For example, 2_MA_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::MegaampereMinute> operator""_MA_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::MegaampereMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Megaampere-hour (MA·hr) electric charge literal. For example, 1.5_MA_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::MegaampereHour> operator""_MA_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::MegaampereHour>{value};
+}
+
+/// \brief Megaampere-hour (MA·hr) electric charge literal. For example, 2_MA_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::MegaampereHour> operator""_MA_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::MegaampereHour>{static_cast<long double>(value)};
+}
+
+/// \brief Gigaampere-minute (GA·min) electric charge literal. For example, 1.5_GA_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::GigaampereMinute> operator""_GA_min(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::GigaampereMinute>{value};
+}
+
+/// \brief Gigaampere-minute (GA·min) electric charge literal. For example, 2_GA_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::GigaampereMinute> operator""_GA_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::GigaampereMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Gigaampere-hour (GA·hr) electric charge literal. For example, 1.5_GA_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::GigaampereHour> operator""_GA_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::GigaampereHour>{value};
+}
+
+/// \brief Gigaampere-hour (GA·hr) electric charge literal. For example, 2_GA_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::GigaampereHour> operator""_GA_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::GigaampereHour>{static_cast<long double>(value)};
+}
+
+/// \brief Teraampere-minute (TA·min) electric charge literal. For example, 1.5_TA_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::TeraampereMinute> operator""_TA_min(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::TeraampereMinute>{value};
+}
+
+/// \brief Teraampere-minute (TA·min) electric charge literal. For example, 2_TA_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::TeraampereMinute> operator""_TA_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::TeraampereMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Teraampere-hour (TA·hr) electric charge literal. For example, 1.5_TA_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::TeraampereHour> operator""_TA_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::TeraampereHour>{value};
+}
+
+/// \brief Teraampere-hour (TA·hr) electric charge literal. For example, 2_TA_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::TeraampereHour> operator""_TA_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::TeraampereHour>{static_cast<long double>(value)};
+}
+
+/// \brief Milliampere-minute (mA·min) electric charge literal. For example, 1.5_mA_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::MilliampereMinute> operator""_mA_min(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::MilliampereMinute>{value};
+}
+
+/// \brief Milliampere-minute (mA·min) electric charge literal. For example, 2_mA_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::MilliampereMinute> operator""_mA_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::MilliampereMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Milliampere-hour (mA·hr) electric charge literal. For example, 1.5_mA_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::MilliampereHour> operator""_mA_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::MilliampereHour>{value};
+}
+
+/// \brief Milliampere-hour (mA·hr) electric charge literal. For example, 2_mA_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::MilliampereHour> operator""_mA_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::MilliampereHour>{static_cast<long double>(value)};
+}
+
+/// \brief Microampere-minute (μA·min) electric charge literal. For example, 1.5_uA_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::MicroampereMinute> operator""_uA_min(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::MicroampereMinute>{value};
+}
+
+/// \brief Microampere-minute (μA·min) electric charge literal. For example, 2_uA_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::MicroampereMinute> operator""_uA_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::MicroampereMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Microampere-hour (μA·hr) electric charge literal. For example, 1.5_uA_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::MicroampereHour> operator""_uA_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::MicroampereHour>{value};
+}
+
+/// \brief Microampere-hour (μA·hr) electric charge literal. For example, 2_uA_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::MicroampereHour> operator""_uA_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::MicroampereHour>{static_cast<long double>(value)};
+}
+
+/// \brief Nanoampere-minute (μA·min) electric charge literal. For example, 1.5_nA_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::NanoampereMinute> operator""_nA_min(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::NanoampereMinute>{value};
+}
+
+/// \brief Nanoampere-minute (μA·min) electric charge literal. For example, 2_nA_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::NanoampereMinute> operator""_nA_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::NanoampereMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Nanoampere-hour (μA·hr) electric charge literal. For example, 1.5_nA_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::NanoampereHour> operator""_nA_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCharge::NanoampereHour>{value};
+}
+
+/// \brief Nanoampere-hour (μA·hr) electric charge literal. For example, 2_nA_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCharge::NanoampereHour> operator""_nA_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCharge::NanoampereHour>{static_cast<long double>(value)};
+}
+
+/// \brief Ampere (A) electric current literal. For example, 1.5_A.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCurrent::Ampere> operator""_A(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCurrent::Ampere>{value};
+}
+
+/// \brief Ampere (A) electric current literal. For example, 2_A.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCurrent::Ampere> operator""_A(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCurrent::Ampere>{static_cast<long double>(value)};
+}
+
+/// \brief Kiloampere (kA) electric current literal. For example, 1.5_kA.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCurrent::Kiloampere> operator""_kA(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCurrent::Kiloampere>{value};
+}
+
+/// \brief Kiloampere (kA) electric current literal. For example, 2_kA.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCurrent::Kiloampere> operator""_kA(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCurrent::Kiloampere>{static_cast<long double>(value)};
+}
+
+/// \brief Megaampere (MA) electric current literal. For example, 1.5_MA.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCurrent::Megaampere> operator""_MA(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCurrent::Megaampere>{value};
+}
+
+/// \brief Megaampere (MA) electric current literal. For example, 2_MA.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCurrent::Megaampere> operator""_MA(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCurrent::Megaampere>{static_cast<long double>(value)};
+}
+
+/// \brief Gigaampere (GA) electric current literal. For example, 1.5_GA.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCurrent::Gigaampere> operator""_GA(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCurrent::Gigaampere>{value};
+}
+
+/// \brief Gigaampere (GA) electric current literal. For example, 2_GA.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCurrent::Gigaampere> operator""_GA(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCurrent::Gigaampere>{static_cast<long double>(value)};
+}
+
+/// \brief Teraampere (TA) electric current literal. For example, 1.5_TA.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCurrent::Teraampere> operator""_TA(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCurrent::Teraampere>{value};
+}
+
+/// \brief Teraampere (TA) electric current literal. For example, 2_TA.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCurrent::Teraampere> operator""_TA(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCurrent::Teraampere>{static_cast<long double>(value)};
+}
+
+/// \brief Milliampere (mA) electric current literal. For example, 1.5_mA.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCurrent::Milliampere> operator""_mA(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCurrent::Milliampere>{value};
+}
+
+/// \brief Milliampere (mA) electric current literal. For example, 2_mA.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCurrent::Milliampere> operator""_mA(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCurrent::Milliampere>{static_cast<long double>(value)};
+}
+
+/// \brief Microampere (μA) electric current literal. For example, 1.5_uA.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCurrent::Microampere> operator""_uA(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCurrent::Microampere>{value};
+}
+
+/// \brief Microampere (μA) electric current literal. For example, 2_uA.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCurrent::Microampere> operator""_uA(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCurrent::Microampere>{static_cast<long double>(value)};
+}
+
+/// \brief Nanoampere (nA) electric current literal. For example, 1.5_nA.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCurrent::Nanoampere> operator""_nA(
+    const long double value) {
+  return ScalarLiteral<Unit::ElectricCurrent::Nanoampere>{value};
+}
+
+/// \brief Nanoampere (nA) electric current literal. For example, 2_nA.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCurrent::Nanoampere> operator""_nA(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCurrent::Nanoampere>{static_cast<long double>(value)};
+}
+
+/// \brief Elementary charge per second (e/s) electric current literal. For example, 1.5_e_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCurrent::ElementaryChargePerSecond>
+operator""_e_per_s(const long double value) {
+  return ScalarLiteral<Unit::ElectricCurrent::ElementaryChargePerSecond>{value};
+}
+
+/// \brief Elementary charge per second (e/s) electric current literal. For example, 2_e_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCurrent::ElementaryChargePerSecond>
+operator""_e_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCurrent::ElementaryChargePerSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Elementary charge per minute (e/min) electric current literal. For example,
+/// 1.5_e_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCurrent::ElementaryChargePerMinute>
+operator""_e_per_min(const long double value) {
+  return ScalarLiteral<Unit::ElectricCurrent::ElementaryChargePerMinute>{value};
+}
+
+/// \brief Elementary charge per minute (e/min) electric current literal. For example, 2_e_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCurrent::ElementaryChargePerMinute>
+operator""_e_per_min(const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCurrent::ElementaryChargePerMinute>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Elementary charge per hour (e/hr) electric current literal. For example, 1.5_e_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCurrent::ElementaryChargePerHour>
+operator""_e_per_hr(const long double value) {
+  return ScalarLiteral<Unit::ElectricCurrent::ElementaryChargePerHour>{value};
+}
+
+/// \brief Elementary charge per hour (e/hr) electric current literal. For example, 2_e_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ElectricCurrent::ElementaryChargePerHour>
+operator""_e_per_hr(const unsigned long long value) {
+  return ScalarLiteral<Unit::ElectricCurrent::ElementaryChargePerHour>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Joule (J) energy literal. For example, 1.5_J.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Joule> operator""_J(const long double value) {
+  return ScalarLiteral<Unit::Energy::Joule>{value};
+}
+
+/// \brief Joule (J) energy literal. For example, 2_J.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Joule> operator""_J(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::Joule>{static_cast<long double>(value)};
+}
+
+/// \brief Millijoule (mJ) energy literal. For example, 1.5_mJ.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Millijoule> operator""_mJ(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::Millijoule>{value};
+}
+
+/// \brief Millijoule (mJ) energy literal. For example, 2_mJ.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Millijoule> operator""_mJ(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::Millijoule>{static_cast<long double>(value)};
+}
+
+/// \brief Microjoule (μJ) energy literal. For example, 1.5_uJ.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Microjoule> operator""_uJ(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::Microjoule>{value};
+}
+
+/// \brief Microjoule (μJ) energy literal. For example, 2_uJ.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Microjoule> operator""_uJ(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::Microjoule>{static_cast<long double>(value)};
+}
+
+/// \brief Nanojoule (nJ) energy literal. For example, 1.5_nJ.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Nanojoule> operator""_nJ(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::Nanojoule>{value};
+}
+
+/// \brief Nanojoule (nJ) energy literal. For example, 2_nJ.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Nanojoule> operator""_nJ(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::Nanojoule>{static_cast<long double>(value)};
+}
+
+/// \brief Kilojoule (kJ) energy literal. For example, 1.5_kJ.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Kilojoule> operator""_kJ(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::Kilojoule>{value};
+}
+
+/// \brief Kilojoule (kJ) energy literal. For example, 2_kJ.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Kilojoule> operator""_kJ(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::Kilojoule>{static_cast<long double>(value)};
+}
+
+/// \brief Megajoule (MJ) energy literal. For example, 1.5_MJ.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Megajoule> operator""_MJ(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::Megajoule>{value};
+}
+
+/// \brief Megajoule (MJ) energy literal. For example, 2_MJ.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Megajoule> operator""_MJ(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::Megajoule>{static_cast<long double>(value)};
+}
+
+/// \brief Gigajoule (GJ) energy literal. For example, 1.5_GJ.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Gigajoule> operator""_GJ(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::Gigajoule>{value};
+}
+
+/// \brief Gigajoule (GJ) energy literal. For example, 2_GJ.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Gigajoule> operator""_GJ(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::Gigajoule>{static_cast<long double>(value)};
+}
+
+/// \brief Watt-minute (W·min) energy literal. For example, 1.5_W_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::WattMinute> operator""_W_min(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::WattMinute>{value};
+}
+
+/// \brief Watt-minute (W·min) energy literal. For example, 2_W_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::WattMinute> operator""_W_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::WattMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Watt-hour (W·hr) energy literal. For example, 1.5_W_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::WattHour> operator""_W_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::WattHour>{value};
+}
+
+/// \brief Watt-hour (W·hr) energy literal. For example, 2_W_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::WattHour> operator""_W_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::WattHour>{static_cast<long double>(value)};
+}
+
+/// \brief Kilowatt-minute (kW·min) energy literal. For example, 1.5_kW_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::KilowattMinute> operator""_kW_min(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::KilowattMinute>{value};
+}
+
+/// \brief Kilowatt-minute (kW·min) energy literal. For example, 2_kW_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::KilowattMinute> operator""_kW_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::KilowattMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Kilowatt-hour (kW·hr) energy literal. For example, 1.5_kW_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::KilowattHour> operator""_kW_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::KilowattHour>{value};
+}
+
+/// \brief Kilowatt-hour (kW·hr) energy literal. For example, 2_kW_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::KilowattHour> operator""_kW_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::KilowattHour>{static_cast<long double>(value)};
+}
+
+/// \brief Megawatt-minute (MW·min) energy literal. For example, 1.5_MW_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::MegawattMinute> operator""_MW_min(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::MegawattMinute>{value};
+}
+
+/// \brief Megawatt-minute (MW·min) energy literal. For example, 2_MW_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::MegawattMinute> operator""_MW_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::MegawattMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Megawatt-hour (MW·hr) energy literal. For example, 1.5_MW_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::MegawattHour> operator""_MW_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::MegawattHour>{value};
+}
+
+/// \brief Megawatt-hour (MW·hr) energy literal. For example, 2_MW_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::MegawattHour> operator""_MW_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::MegawattHour>{static_cast<long double>(value)};
+}
+
+/// \brief Gigawatt-minute (GW·min) energy literal. For example, 1.5_GW_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::GigawattMinute> operator""_GW_min(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::GigawattMinute>{value};
+}
+
+/// \brief Gigawatt-minute (GW·min) energy literal. For example, 2_GW_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::GigawattMinute> operator""_GW_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::GigawattMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Gigawatt-hour (GW·hr) energy literal. For example, 1.5_GW_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::GigawattHour> operator""_GW_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::GigawattHour>{value};
+}
+
+/// \brief Gigawatt-hour (GW·hr) energy literal. For example, 2_GW_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::GigawattHour> operator""_GW_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::GigawattHour>{static_cast<long double>(value)};
+}
+
+/// \brief Foot-pound (ft·lbf) energy literal. For example, 1.5_ft_lbf.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::FootPound> operator""_ft_lbf(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::FootPound>{value};
+}
+
+/// \brief Foot-pound (ft·lbf) energy literal. For example, 2_ft_lbf.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::FootPound> operator""_ft_lbf(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::FootPound>{static_cast<long double>(value)};
+}
+
+/// \brief Inch-pound (in·lbf) energy literal. For example, 1.5_in_lbf.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::InchPound> operator""_in_lbf(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::InchPound>{value};
+}
+
+/// \brief Inch-pound (in·lbf) energy literal. For example, 2_in_lbf.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::InchPound> operator""_in_lbf(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::InchPound>{static_cast<long double>(value)};
+}
+
+/// \brief Calorie (cal) energy literal. For example, 1.5_cal.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Calorie> operator""_cal(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::Calorie>{value};
+}
+
+/// \brief Calorie (cal) energy literal. For example, 2_cal.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Calorie> operator""_cal(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::Calorie>{static_cast<long double>(value)};
+}
+
+/// \brief Millicalorie (mcal) energy literal. For example, 1.5_mcal.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Millicalorie> operator""_mcal(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::Millicalorie>{value};
+}
+
+/// \brief Millicalorie (mcal) energy literal. For example, 2_mcal.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Millicalorie> operator""_mcal(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::Millicalorie>{static_cast<long double>(value)};
+}
+
+/// \brief Microcalorie (μcal) energy literal. For example, 1.5_ucal.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Microcalorie> operator""_ucal(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::Microcalorie>{value};
+}
+
+/// \brief Microcalorie (μcal) energy literal. For example, 2_ucal.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Microcalorie> operator""_ucal(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::Microcalorie>{static_cast<long double>(value)};
+}
+
+/// \brief Nanocalorie (ncal) energy literal. For example, 1.5_ncal.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Nanocalorie> operator""_ncal(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::Nanocalorie>{value};
+}
+
+/// \brief Nanocalorie (ncal) energy literal. For example, 2_ncal.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Nanocalorie> operator""_ncal(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::Nanocalorie>{static_cast<long double>(value)};
+}
+
+/// \brief Kilocalorie (kcal) energy literal. For example, 1.5_kcal.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Kilocalorie> operator""_kcal(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::Kilocalorie>{value};
+}
+
+/// \brief Kilocalorie (kcal) energy literal. For example, 2_kcal.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Kilocalorie> operator""_kcal(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::Kilocalorie>{static_cast<long double>(value)};
+}
+
+/// \brief Megacalorie (Mcal) energy literal. For example, 1.5_Mcal.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Megacalorie> operator""_Mcal(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::Megacalorie>{value};
+}
+
+/// \brief Megacalorie (Mcal) energy literal. For example, 2_Mcal.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Megacalorie> operator""_Mcal(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::Megacalorie>{static_cast<long double>(value)};
+}
+
+/// \brief Gigacalorie (Gcal) energy literal. For example, 1.5_Gcal.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Gigacalorie> operator""_Gcal(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::Gigacalorie>{value};
+}
+
+/// \brief Gigacalorie (Gcal) energy literal. For example, 2_Gcal.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Gigacalorie> operator""_Gcal(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::Gigacalorie>{static_cast<long double>(value)};
+}
+
+/// \brief Electronvolt (eV) energy literal. For example, 1.5_eV.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Electronvolt> operator""_eV(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::Electronvolt>{value};
+}
+
+/// \brief Electronvolt (eV) energy literal. For example, 2_eV.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Electronvolt> operator""_eV(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::Electronvolt>{static_cast<long double>(value)};
+}
+
+/// \brief Millielectronvolt (meV) energy literal. For example, 1.5_meV.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Millielectronvolt> operator""_meV(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::Millielectronvolt>{value};
+}
+
+/// \brief Millielectronvolt (meV) energy literal. For example, 2_meV.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Millielectronvolt> operator""_meV(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::Millielectronvolt>{static_cast<long double>(value)};
+}
+
+/// \brief Microelectronvolt (μeV) energy literal. For example, 1.5_ueV.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Microelectronvolt> operator""_ueV(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::Microelectronvolt>{value};
+}
+
+/// \brief Microelectronvolt (μeV) energy literal. For example, 2_ueV.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Microelectronvolt> operator""_ueV(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::Microelectronvolt>{static_cast<long double>(value)};
+}
+
+/// \brief Nanoelectronvolt (neV) energy literal. For example, 1.5_neV.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Nanoelectronvolt> operator""_neV(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::Nanoelectronvolt>{value};
+}
+
+/// \brief Nanoelectronvolt (neV) energy literal. For example, 2_neV.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Nanoelectronvolt> operator""_neV(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::Nanoelectronvolt>{static_cast<long double>(value)};
+}
+
+/// \brief Kiloelectronvolt (keV) energy literal. For example, 1.5_keV.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Kiloelectronvolt> operator""_keV(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::Kiloelectronvolt>{value};
+}
+
+/// \brief Kiloelectronvolt (keV) energy literal. For example, 2_keV.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Kiloelectronvolt> operator""_keV(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::Kiloelectronvolt>{static_cast<long double>(value)};
+}
+
+/// \brief Megaelectronvolt (MeV) energy literal. For example, 1.5_MeV.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Megaelectronvolt> operator""_MeV(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::Megaelectronvolt>{value};
+}
+
+/// \brief Megaelectronvolt (MeV) energy literal. For example, 2_MeV.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Megaelectronvolt> operator""_MeV(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::Megaelectronvolt>{static_cast<long double>(value)};
+}
+
+/// \brief Gigaelectronvolt (GeV) energy literal. For example, 1.5_GeV.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Gigaelectronvolt> operator""_GeV(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::Gigaelectronvolt>{value};
+}
+
+/// \brief Gigaelectronvolt (GeV) energy literal. For example, 2_GeV.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::Gigaelectronvolt> operator""_GeV(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::Gigaelectronvolt>{static_cast<long double>(value)};
+}
+
+/// \brief British thermal literal (BTU) energy unit. For example, 1.5_BTU.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::BritishThermalUnit> operator""_BTU(
+    const long double value) {
+  return ScalarLiteral<Unit::Energy::BritishThermalUnit>{value};
+}
+
+/// \brief British thermal literal (BTU) energy unit. For example, 2_BTU.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Energy::BritishThermalUnit> operator""_BTU(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Energy::BritishThermalUnit>{static_cast<long double>(value)};
+}
+
+/// \brief Watt per square metre (W/m^2) energy flux literal. For example, 1.5_W_per_m2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::EnergyFlux::WattPerSquareMetre> operator""_W_per_m2(
+    const long double value) {
+  return ScalarLiteral<Unit::EnergyFlux::WattPerSquareMetre>{value};
+}
+
+/// \brief Watt per square metre (W/m^2) energy flux literal. For example, 2_W_per_m2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::EnergyFlux::WattPerSquareMetre> operator""_W_per_m2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::EnergyFlux::WattPerSquareMetre>{static_cast<long double>(value)};
+}
+
+/// \brief Nanowatt per square millimetre (nW/mm^2) energy flux literal. For example,
+/// 1.5_nW_per_mm2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::EnergyFlux::NanowattPerSquareMillimetre>
+operator""_nW_per_mm2(const long double value) {
+  return ScalarLiteral<Unit::EnergyFlux::NanowattPerSquareMillimetre>{value};
+}
+
+/// \brief Nanowatt per square millimetre (nW/mm^2) energy flux literal. For example, 2_nW_per_mm2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::EnergyFlux::NanowattPerSquareMillimetre>
+operator""_nW_per_mm2(const unsigned long long value) {
+  return ScalarLiteral<Unit::EnergyFlux::NanowattPerSquareMillimetre>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Foot-pound per square foot per second (ft·lbf/ft^2/s) energy flux literal. For example,
+/// 1.5_ft_lbf_per_ft2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::EnergyFlux::FootPoundPerSquareFootPerSecond>
+operator""_ft_lbf_per_ft2_per_s(const long double value) {
+  return ScalarLiteral<Unit::EnergyFlux::FootPoundPerSquareFootPerSecond>{value};
+}
+
+/// \brief Foot-pound per square foot per second (ft·lbf/ft^2/s) energy flux literal. For example,
+/// 2_ft_lbf_per_ft2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::EnergyFlux::FootPoundPerSquareFootPerSecond>
+operator""_ft_lbf_per_ft2_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::EnergyFlux::FootPoundPerSquareFootPerSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Inch-pound per square inch per second (in·lbf/in^2/s) energy flux literal. For example,
+/// 1.5_in_lbf_per_in2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::EnergyFlux::InchPoundPerSquareInchPerSecond>
+operator""_in_lbf_per_in2_per_s(const long double value) {
+  return ScalarLiteral<Unit::EnergyFlux::InchPoundPerSquareInchPerSecond>{value};
+}
+
+/// \brief Inch-pound per square inch per second (in·lbf/in^2/s) energy flux literal. For example,
+/// 2_in_lbf_per_in2_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::EnergyFlux::InchPoundPerSquareInchPerSecond>
+operator""_in_lbf_per_in2_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::EnergyFlux::InchPoundPerSquareInchPerSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Newton (N) force literal. For example, 1.5_N.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Force::Newton> operator""_N(const long double value) {
+  return ScalarLiteral<Unit::Force::Newton>{value};
+}
+
+/// \brief Newton (N) force literal. For example, 2_N.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Force::Newton> operator""_N(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Force::Newton>{static_cast<long double>(value)};
+}
+
+/// \brief Kilonewton (kN) force literal. For example, 1.5_kN.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Force::Kilonewton> operator""_kN(
+    const long double value) {
+  return ScalarLiteral<Unit::Force::Kilonewton>{value};
+}
+
+/// \brief Kilonewton (kN) force literal. For example, 2_kN.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Force::Kilonewton> operator""_kN(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Force::Kilonewton>{static_cast<long double>(value)};
+}
+
+/// \brief Meganewton (MN) force literal. For example, 1.5_MN.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Force::Meganewton> operator""_MN(
+    const long double value) {
+  return ScalarLiteral<Unit::Force::Meganewton>{value};
+}
+
+/// \brief Meganewton (MN) force literal. For example, 2_MN.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Force::Meganewton> operator""_MN(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Force::Meganewton>{static_cast<long double>(value)};
+}
+
+/// \brief Giganewton (GN) force literal. For example, 1.5_GN.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Force::Giganewton> operator""_GN(
+    const long double value) {
+  return ScalarLiteral<Unit::Force::Giganewton>{value};
+}
+
+/// \brief Giganewton (GN) force literal. For example, 2_GN.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Force::Giganewton> operator""_GN(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Force::Giganewton>{static_cast<long double>(value)};
+}
+
+/// \brief Millinewton (mN) force literal. For example, 1.5_mN.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Force::Millinewton> operator""_mN(
+    const long double value) {
+  return ScalarLiteral<Unit::Force::Millinewton>{value};
+}
+
+/// \brief Millinewton (mN) force literal. For example, 2_mN.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Force::Millinewton> operator""_mN(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Force::Millinewton>{static_cast<long double>(value)};
+}
+
+/// \brief Micronewton (μN) force literal. For example, 1.5_uN.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Force::Micronewton> operator""_uN(
+    const long double value) {
+  return ScalarLiteral<Unit::Force::Micronewton>{value};
+}
+
+/// \brief Micronewton (μN) force literal. For example, 2_uN.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Force::Micronewton> operator""_uN(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Force::Micronewton>{static_cast<long double>(value)};
+}
+
+/// \brief Nanonewton (nN) force literal. For example, 1.5_nN.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Force::Nanonewton> operator""_nN(
+    const long double value) {
+  return ScalarLiteral<Unit::Force::Nanonewton>{value};
+}
+
+/// \brief Nanonewton (nN) force literal. For example, 2_nN.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Force::Nanonewton> operator""_nN(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Force::Nanonewton>{static_cast<long double>(value)};
+}
+
+/// \brief Dyne (dyn) force literal. For example, 1.5_dyn.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Force::Dyne> operator""_dyn(const long double value) {
+  return ScalarLiteral<Unit::Force::Dyne>{value};
+}
+
+/// \brief Dyne (dyn) force literal. For example, 2_dyn.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Force::Dyne> operator""_dyn(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Force::Dyne>{static_cast<long double>(value)};
+}
+
+/// \brief Pound (lbf) force literal. For example, 1.5_lbf.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Force::Pound> operator""_lbf(const long double value) {
+  return ScalarLiteral<Unit::Force::Pound>{value};
+}
+
+/// \brief Pound (lbf) force literal. For example, 2_lbf.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Force::Pound> operator""_lbf(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Force::Pound>{static_cast<long double>(value)};
+}
+
+/// \brief Hertz (Hz) frequency literal. For example, 1.5_Hz.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Frequency::Hertz> operator""_Hz(
+    const long double value) {
+  return ScalarLiteral<Unit::Frequency::Hertz>{value};
+}
+
+/// \brief Hertz (Hz) frequency literal. For example, 2_Hz.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Frequency::Hertz> operator""_Hz(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Frequency::Hertz>{static_cast<long double>(value)};
+}
+
+/// \brief Kilohertz (kHz) frequency literal. For example, 1.5_kHz.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Frequency::Kilohertz> operator""_kHz(
+    const long double value) {
+  return ScalarLiteral<Unit::Frequency::Kilohertz>{value};
+}
+
+/// \brief Kilohertz (kHz) frequency literal. For example, 2_kHz.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Frequency::Kilohertz> operator""_kHz(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Frequency::Kilohertz>{static_cast<long double>(value)};
+}
+
+/// \brief Megahertz (MHz) frequency literal. For example, 1.5_MHz.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Frequency::Megahertz> operator""_MHz(
+    const long double value) {
+  return ScalarLiteral<Unit::Frequency::Megahertz>{value};
+}
+
+/// \brief Megahertz (MHz) frequency literal. For example, 2_MHz.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Frequency::Megahertz> operator""_MHz(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Frequency::Megahertz>{static_cast<long double>(value)};
+}
+
+/// \brief Gigahertz (GHz) frequency literal. For example, 1.5_GHz.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Frequency::Gigahertz> operator""_GHz(
+    const long double value) {
+  return ScalarLiteral<Unit::Frequency::Gigahertz>{value};
+}
+
+/// \brief Gigahertz (GHz) frequency literal. For example, 2_GHz.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Frequency::Gigahertz> operator""_GHz(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Frequency::Gigahertz>{static_cast<long double>(value)};
+}
+
+/// \brief Per minute (/min) frequency literal. For example, 1.5_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Frequency::PerMinute> operator""_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::Frequency::PerMinute>{value};
+}
+
+/// \brief Per minute (/min) frequency literal. For example, 2_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Frequency::PerMinute> operator""_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Frequency::PerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Per hour (/hr) frequency literal. For example, 1.5_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Frequency::PerHour> operator""_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::Frequency::PerHour>{value};
+}
+
+/// \brief Per hour (/hr) frequency literal. For example, 2_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Frequency::PerHour> operator""_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Frequency::PerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Joule per kelvin (J/K) heat capacity literal. For example, 1.5_J_per_K.
+[[nodiscard]] constexpr ScalarLiteral<Unit::HeatCapacity::JoulePerKelvin> operator""_J_per_K(
+    const long double value) {
+  return ScalarLiteral<Unit::HeatCapacity::JoulePerKelvin>{value};
+}
+
+/// \brief Joule per kelvin (J/K) heat capacity literal. For example, 2_J_per_K.
+[[nodiscard]] constexpr ScalarLiteral<Unit::HeatCapacity::JoulePerKelvin> operator""_J_per_K(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::HeatCapacity::JoulePerKelvin>{static_cast<long double>(value)};
+}
+
+/// \brief Nanojoule per kelvin (nJ/K) heat capacity literal. For example, 1.5_nJ_per_K.
+[[nodiscard]] constexpr ScalarLiteral<Unit::HeatCapacity::NanojoulePerKelvin> operator""_nJ_per_K(
+    const long double value) {
+  return ScalarLiteral<Unit::HeatCapacity::NanojoulePerKelvin>{value};
+}
+
+/// \brief Nanojoule per kelvin (nJ/K) heat capacity literal. For example, 2_nJ_per_K.
+[[nodiscard]] constexpr ScalarLiteral<Unit::HeatCapacity::NanojoulePerKelvin> operator""_nJ_per_K(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::HeatCapacity::NanojoulePerKelvin>{static_cast<long double>(value)};
+}
+
+/// \brief Foot-pound per degree Rankine (ft·lbf/°R) heat capacity literal. For example,
+/// 1.5_ft_lbf_per_degR.
+[[nodiscard]] constexpr ScalarLiteral<Unit::HeatCapacity::FootPoundPerRankine>
+operator""_ft_lbf_per_degR(const long double value) {
+  return ScalarLiteral<Unit::HeatCapacity::FootPoundPerRankine>{value};
+}
+
+/// \brief Foot-pound per degree Rankine (ft·lbf/°R) heat capacity literal. For example,
+/// 2_ft_lbf_per_degR.
+[[nodiscard]] constexpr ScalarLiteral<Unit::HeatCapacity::FootPoundPerRankine>
+operator""_ft_lbf_per_degR(const unsigned long long value) {
+  return ScalarLiteral<Unit::HeatCapacity::FootPoundPerRankine>{static_cast<long double>(value)};
+}
+
+/// \brief Inch-pound per degree Rankine (in·lbf/°R) heat capacity literal. For example,
+/// 1.5_in_lbf_per_degR.
+[[nodiscard]] constexpr ScalarLiteral<Unit::HeatCapacity::InchPoundPerRankine>
+operator""_in_lbf_per_degR(const long double value) {
+  return ScalarLiteral<Unit::HeatCapacity::InchPoundPerRankine>{value};
+}
+
+/// \brief Inch-pound per degree Rankine (in·lbf/°R) heat capacity literal. For example,
+/// 2_in_lbf_per_degR.
+[[nodiscard]] constexpr ScalarLiteral<Unit::HeatCapacity::InchPoundPerRankine>
+operator""_in_lbf_per_degR(const unsigned long long value) {
+  return ScalarLiteral<Unit::HeatCapacity::InchPoundPerRankine>{static_cast<long double>(value)};
+}
+
+/// \brief Nautical mile (nmi) length literal. For example, 1.5_nmi.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::NauticalMile> operator""_nmi(
+    const long double value) {
+  return ScalarLiteral<Unit::Length::NauticalMile>{value};
+}
+
+/// \brief Nautical mile (nmi) length literal. For example, 2_nmi.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::NauticalMile> operator""_nmi(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Length::NauticalMile>{static_cast<long double>(value)};
+}
+
+/// \brief Mile (mi) length literal. For example, 1.5_mi.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Mile> operator""_mi(const long double value) {
+  return ScalarLiteral<Unit::Length::Mile>{value};
+}
+
+/// \brief Mile (mi) length literal. For example, 2_mi.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Mile> operator""_mi(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Length::Mile>{static_cast<long double>(value)};
+}
+
+/// \brief Kilometre (km) length literal. For example, 1.5_km.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Kilometre> operator""_km(
+    const long double value) {
+  return ScalarLiteral<Unit::Length::Kilometre>{value};
+}
+
+/// \brief Kilometre (km) length literal. For example, 2_km.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Kilometre> operator""_km(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Length::Kilometre>{static_cast<long double>(value)};
+}
+
+/// \brief Metre (m) length literal. For example, 1.5_m.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Metre> operator""_m(const long double value) {
+  return ScalarLiteral<Unit::Length::Metre>{value};
+}
+
+/// \brief Metre (m) length literal. For example, 2_m.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Metre> operator""_m(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Length::Metre>{static_cast<long double>(value)};
+}
+
+/// \brief Yard (yd) length literal. For example, 1.5_yd.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Yard> operator""_yd(const long double value) {
+  return ScalarLiteral<Unit::Length::Yard>{value};
+}
+
+/// \brief Yard (yd) length literal. For example, 2_yd.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Yard> operator""_yd(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Length::Yard>{static_cast<long double>(value)};
+}
+
+/// \brief Foot (ft) length literal. For example, 1.5_ft.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Foot> operator""_ft(const long double value) {
+  return ScalarLiteral<Unit::Length::Foot>{value};
+}
+
+/// \brief Foot (ft) length literal. For example, 2_ft.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Foot> operator""_ft(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Length::Foot>{static_cast<long double>(value)};
+}
+
+/// \brief Decimetre (dm) length literal. For example, 1.5_dm.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Decimetre> operator""_dm(
+    const long double value) {
+  return ScalarLiteral<Unit::Length::Decimetre>{value};
+}
+
+/// \brief Decimetre (dm) length literal. For example, 2_dm.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Decimetre> operator""_dm(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Length::Decimetre>{static_cast<long double>(value)};
+}
+
+/// \brief Inch (in) length literal. For example, 1.5_in.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Inch> operator""_in(const long double value) {
+  return ScalarLiteral<Unit::Length::Inch>{value};
+}
+
+/// \brief Inch (in) length literal. For example, 2_in.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Inch> operator""_in(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Length::Inch>{static_cast<long double>(value)};
+}
+
+/// \brief Centimetre (cm) length literal. For example, 1.5_cm.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Centimetre> operator""_cm(
+    const long double value) {
+  return ScalarLiteral<Unit::Length::Centimetre>{value};
+}
+
+/// \brief Centimetre (cm) length literal. For example, 2_cm.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Centimetre> operator""_cm(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Length::Centimetre>{static_cast<long double>(value)};
+}
+
+/// \brief Millimetre (mm) length literal. For example, 1.5_mm.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Millimetre> operator""_mm(
+    const long double value) {
+  return ScalarLiteral<Unit::Length::Millimetre>{value};
+}
+
+/// \brief Millimetre (mm) length literal. For example, 2_mm.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Millimetre> operator""_mm(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Length::Millimetre>{static_cast<long double>(value)};
+}
+
+/// \brief Milliinch (mil) length literal. For example, 1.5_mil.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Milliinch> operator""_mil(
+    const long double value) {
+  return ScalarLiteral<Unit::Length::Milliinch>{value};
+}
+
+/// \brief Milliinch (mil) length literal. For example, 2_mil.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Milliinch> operator""_mil(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Length::Milliinch>{static_cast<long double>(value)};
+}
+
+/// \brief Micrometre (μm) length literal. For example, 1.5_um.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Micrometre> operator""_um(
+    const long double value) {
+  return ScalarLiteral<Unit::Length::Micrometre>{value};
+}
+
+/// \brief Micrometre (μm) length literal. For example, 2_um.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Micrometre> operator""_um(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Length::Micrometre>{static_cast<long double>(value)};
+}
+
+/// \brief Microinch (μin) length literal. For example, 1.5_uin.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Microinch> operator""_uin(
+    const long double value) {
+  return ScalarLiteral<Unit::Length::Microinch>{value};
+}
+
+/// \brief Microinch (μin) length literal. For example, 2_uin.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Length::Microinch> operator""_uin(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Length::Microinch>{static_cast<long double>(value)};
+}
+
+/// \brief Kilogram (kg) mass literal. For example, 1.5_kg.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Mass::Kilogram> operator""_kg(const long double value) {
+  return ScalarLiteral<Unit::Mass::Kilogram>{value};
+}
+
+/// \brief Kilogram (kg) mass literal. For example, 2_kg.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Mass::Kilogram> operator""_kg(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Mass::Kilogram>{static_cast<long double>(value)};
+}
+
+/// \brief Gram (g) mass literal. For example, 1.5_g.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Mass::Gram> operator""_g(const long double value) {
+  return ScalarLiteral<Unit::Mass::Gram>{value};
+}
+
+/// \brief Gram (g) mass literal. For example, 2_g.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Mass::Gram> operator""_g(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Mass::Gram>{static_cast<long double>(value)};
+}
+
+/// \brief Slug (slug) mass literal. For example, 1.5_slug.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Mass::Slug> operator""_slug(const long double value) {
+  return ScalarLiteral<Unit::Mass::Slug>{value};
+}
+
+/// \brief Slug (slug) mass literal. For example, 2_slug.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Mass::Slug> operator""_slug(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Mass::Slug>{static_cast<long double>(value)};
+}
+
+/// \brief Slinch (slinch) mass literal. For example, 1.5_slinch.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Mass::Slinch> operator""_slinch(
+    const long double value) {
+  return ScalarLiteral<Unit::Mass::Slinch>{value};
+}
+
+/// \brief Slinch (slinch) mass literal. For example, 2_slinch.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Mass::Slinch> operator""_slinch(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Mass::Slinch>{static_cast<long double>(value)};
+}
+
+/// \brief Pound (lbm) mass literal. For example, 1.5_lbm.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Mass::Pound> operator""_lbm(const long double value) {
+  return ScalarLiteral<Unit::Mass::Pound>{value};
+}
+
+/// \brief Pound (lbm) mass literal. For example, 2_lbm.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Mass::Pound> operator""_lbm(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Mass::Pound>{static_cast<long double>(value)};
+}
+
+/// \brief Kilogram per cubic metre (kg/m^3) mass density literal. For example, 1.5_kg_per_m3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassDensity::KilogramPerCubicMetre>
+operator""_kg_per_m3(const long double value) {
+  return ScalarLiteral<Unit::MassDensity::KilogramPerCubicMetre>{value};
+}
+
+/// \brief Kilogram per cubic metre (kg/m^3) mass density literal. For example, 2_kg_per_m3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassDensity::KilogramPerCubicMetre>
+operator""_kg_per_m3(const unsigned long long value) {
+  return ScalarLiteral<Unit::MassDensity::KilogramPerCubicMetre>{static_cast<long double>(value)};
+}
+
+/// \brief Gram per cubic millimetre (g/mm^3) mass density literal. For example, 1.5_g_per_mm3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassDensity::GramPerCubicMillimetre>
+operator""_g_per_mm3(const long double value) {
+  return ScalarLiteral<Unit::MassDensity::GramPerCubicMillimetre>{value};
+}
+
+/// \brief Gram per cubic millimetre (g/mm^3) mass density literal. For example, 2_g_per_mm3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassDensity::GramPerCubicMillimetre>
+operator""_g_per_mm3(const unsigned long long value) {
+  return ScalarLiteral<Unit::MassDensity::GramPerCubicMillimetre>{static_cast<long double>(value)};
+}
+
+/// \brief Slug per cubic foot (slug/ft^3) mass density literal. For example, 1.5_slug_per_ft3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassDensity::SlugPerCubicFoot> operator""_slug_per_ft3(
+    const long double value) {
+  return ScalarLiteral<Unit::MassDensity::SlugPerCubicFoot>{value};
+}
+
+/// \brief Slug per cubic foot (slug/ft^3) mass density literal. For example, 2_slug_per_ft3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassDensity::SlugPerCubicFoot> operator""_slug_per_ft3(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MassDensity::SlugPerCubicFoot>{static_cast<long double>(value)};
+}
+
+/// \brief Slinch per cubic inch (slinch/in^3) mass density literal. For example,
+/// 1.5_slinch_per_in3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassDensity::SlinchPerCubicInch>
+operator""_slinch_per_in3(const long double value) {
+  return ScalarLiteral<Unit::MassDensity::SlinchPerCubicInch>{value};
+}
+
+/// \brief Slinch per cubic inch (slinch/in^3) mass density literal. For example, 2_slinch_per_in3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassDensity::SlinchPerCubicInch>
+operator""_slinch_per_in3(const unsigned long long value) {
+  return ScalarLiteral<Unit::MassDensity::SlinchPerCubicInch>{static_cast<long double>(value)};
+}
+
+/// \brief Pound per cubic foot (lbm/ft^3) mass density literal. For example, 1.5_lbm_per_ft3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassDensity::PoundPerCubicFoot> operator""_lbm_per_ft3(
+    const long double value) {
+  return ScalarLiteral<Unit::MassDensity::PoundPerCubicFoot>{value};
+}
+
+/// \brief Pound per cubic foot (lbm/ft^3) mass density literal. For example, 2_lbm_per_ft3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassDensity::PoundPerCubicFoot> operator""_lbm_per_ft3(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MassDensity::PoundPerCubicFoot>{static_cast<long double>(value)};
+}
+
+/// \brief Pound per cubic inch (lbm/in^3) mass density literal. For example, 1.5_lbm_per_in3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassDensity::PoundPerCubicInch> operator""_lbm_per_in3(
+    const long double value) {
+  return ScalarLiteral<Unit::MassDensity::PoundPerCubicInch>{value};
+}
+
+/// \brief Pound per cubic inch (lbm/in^3) mass density literal. For example, 2_lbm_per_in3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassDensity::PoundPerCubicInch> operator""_lbm_per_in3(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MassDensity::PoundPerCubicInch>{static_cast<long double>(value)};
+}
+
+/// \brief Kilogram per second (kg/s) mass rate literal. For example, 1.5_kg_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::KilogramPerSecond> operator""_kg_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MassRate::KilogramPerSecond>{value};
+}
+
+/// \brief Kilogram per second (kg/s) mass rate literal. For example, 2_kg_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::KilogramPerSecond> operator""_kg_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MassRate::KilogramPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Gram per second (g/s) mass rate literal. For example, 1.5_g_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::GramPerSecond> operator""_g_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MassRate::GramPerSecond>{value};
+}
+
+/// \brief Gram per second (g/s) mass rate literal. For example, 2_g_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::GramPerSecond> operator""_g_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MassRate::GramPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Slug per second (slug/s) mass rate literal. For example, 1.5_slug_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::SlugPerSecond> operator""_slug_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MassRate::SlugPerSecond>{value};
+}
+
+/// \brief Slug per second (slug/s) mass rate literal. For example, 2_slug_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::SlugPerSecond> operator""_slug_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MassRate::SlugPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Slinch per second (slinch/s) mass rate literal. For example, 1.5_slinch_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::SlinchPerSecond> operator""_slinch_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MassRate::SlinchPerSecond>{value};
+}
+
+/// \brief Slinch per second (slinch/s) mass rate literal. For example, 2_slinch_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::SlinchPerSecond> operator""_slinch_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MassRate::SlinchPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Pound per second (lbm/s) mass rate literal. For example, 1.5_lbm_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::PoundPerSecond> operator""_lbm_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MassRate::PoundPerSecond>{value};
+}
+
+/// \brief Pound per second (lbm/s) mass rate literal. For example, 2_lbm_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::PoundPerSecond> operator""_lbm_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MassRate::PoundPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Kilogram per minute (kg/min) mass rate literal. For example, 1.5_kg_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::KilogramPerMinute> operator""_kg_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MassRate::KilogramPerMinute>{value};
+}
+
+/// \brief Kilogram per minute (kg/min) mass rate literal. For example, 2_kg_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::KilogramPerMinute> operator""_kg_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MassRate::KilogramPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Gram per minute (g/min) mass rate literal. For example, 1.5_g_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::GramPerMinute> operator""_g_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MassRate::GramPerMinute>{value};
+}
+
+/// \brief Gram per minute (g/min) mass rate literal. For example, 2_g_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::GramPerMinute> operator""_g_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MassRate::GramPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Slug per minute (slug/min) mass rate literal. For example, 1.5_slug_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::SlugPerMinute> operator""_slug_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MassRate::SlugPerMinute>{value};
+}
+
+/// \brief Slug per minute (slug/min) mass rate literal. For example, 2_slug_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::SlugPerMinute> operator""_slug_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MassRate::SlugPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Slinch per minute (slinch/min) mass rate literal. For example, 1.5_slinch_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::SlinchPerMinute> operator""_slinch_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MassRate::SlinchPerMinute>{value};
+}
+
+/// \brief Slinch per minute (slinch/min) mass rate literal. For example, 2_slinch_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::SlinchPerMinute> operator""_slinch_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MassRate::SlinchPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Pound per minute (lbm/min) mass rate literal. For example, 1.5_lbm_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::PoundPerMinute> operator""_lbm_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MassRate::PoundPerMinute>{value};
+}
+
+/// \brief Pound per minute (lbm/min) mass rate literal. For example, 2_lbm_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::PoundPerMinute> operator""_lbm_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MassRate::PoundPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Kilogram per hour (kg/hr) mass rate literal. For example, 1.5_kg_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::KilogramPerHour> operator""_kg_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MassRate::KilogramPerHour>{value};
+}
+
+/// \brief Kilogram per hour (kg/hr) mass rate literal. For example, 2_kg_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::KilogramPerHour> operator""_kg_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MassRate::KilogramPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Gram per hour (g/hr) mass rate literal. For example, 1.5_g_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::GramPerHour> operator""_g_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MassRate::GramPerHour>{value};
+}
+
+/// \brief Gram per hour (g/hr) mass rate literal. For example, 2_g_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::GramPerHour> operator""_g_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MassRate::GramPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Slug per hour (slug/hr) mass rate literal. For example, 1.5_slug_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::SlugPerHour> operator""_slug_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MassRate::SlugPerHour>{value};
+}
+
+/// \brief Slug per hour (slug/hr) mass rate literal. For example, 2_slug_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::SlugPerHour> operator""_slug_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MassRate::SlugPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Slinch per hour (slinch/hr) mass rate literal. For example, 1.5_slinch_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::SlinchPerHour> operator""_slinch_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MassRate::SlinchPerHour>{value};
+}
+
+/// \brief Slinch per hour (slinch/hr) mass rate literal. For example, 2_slinch_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::SlinchPerHour> operator""_slinch_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MassRate::SlinchPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Pound per hour (lbm/hr) mass rate literal. For example, 1.5_lbm_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::PoundPerHour> operator""_lbm_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MassRate::PoundPerHour>{value};
+}
+
+/// \brief Pound per hour (lbm/hr) mass rate literal. For example, 2_lbm_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MassRate::PoundPerHour> operator""_lbm_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MassRate::PoundPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Bit (b) memory literal. For example, 1.5_b.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Bit> operator""_b(const long double value) {
+  return ScalarLiteral<Unit::Memory::Bit>{value};
+}
+
+/// \brief Bit (b) memory literal. For example, 2_b.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Bit> operator""_b(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Memory::Bit>{static_cast<long double>(value)};
+}
+
+/// \brief Byte (B) memory literal. For example, 1.5_B.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Byte> operator""_B(const long double value) {
+  return ScalarLiteral<Unit::Memory::Byte>{value};
+}
+
+/// \brief Byte (B) memory literal. For example, 2_B.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Byte> operator""_B(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Memory::Byte>{static_cast<long double>(value)};
+}
+
+/// \brief Kilobit (kb) memory literal. For example, 1.5_kb.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Kilobit> operator""_kb(
+    const long double value) {
+  return ScalarLiteral<Unit::Memory::Kilobit>{value};
+}
+
+/// \brief Kilobit (kb) memory literal. For example, 2_kb.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Kilobit> operator""_kb(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Memory::Kilobit>{static_cast<long double>(value)};
+}
+
+/// \brief Kibibit (kib) memory literal. For example, 1.5_kib.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Kibibit> operator""_kib(
+    const long double value) {
+  return ScalarLiteral<Unit::Memory::Kibibit>{value};
+}
+
+/// \brief Kibibit (kib) memory literal. For example, 2_kib.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Kibibit> operator""_kib(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Memory::Kibibit>{static_cast<long double>(value)};
+}
+
+/// \brief Kilobyte (kB) memory literal. For example, 1.5_kB.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Kilobyte> operator""_kB(
+    const long double value) {
+  return ScalarLiteral<Unit::Memory::Kilobyte>{value};
+}
+
+/// \brief Kilobyte (kB) memory literal. For example, 2_kB.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Kilobyte> operator""_kB(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Memory::Kilobyte>{static_cast<long double>(value)};
+}
+
+/// \brief Kibibyte (kiB) memory literal. For example, 1.5_kiB.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Kibibyte> operator""_kiB(
+    const long double value) {
+  return ScalarLiteral<Unit::Memory::Kibibyte>{value};
+}
+
+/// \brief Kibibyte (kiB) memory literal. For example, 2_kiB.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Kibibyte> operator""_kiB(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Memory::Kibibyte>{static_cast<long double>(value)};
+}
+
+/// \brief Megabit (Mb) memory literal. For example, 1.5_Mb.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Megabit> operator""_Mb(
+    const long double value) {
+  return ScalarLiteral<Unit::Memory::Megabit>{value};
+}
+
+/// \brief Megabit (Mb) memory literal. For example, 2_Mb.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Megabit> operator""_Mb(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Memory::Megabit>{static_cast<long double>(value)};
+}
+
+/// \brief Mebibit (Mib) memory literal. For example, 1.5_Mib.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Mebibit> operator""_Mib(
+    const long double value) {
+  return ScalarLiteral<Unit::Memory::Mebibit>{value};
+}
+
+/// \brief Mebibit (Mib) memory literal. For example, 2_Mib.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Mebibit> operator""_Mib(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Memory::Mebibit>{static_cast<long double>(value)};
+}
+
+/// \brief Megabyte (MB) memory literal. For example, 1.5_MB.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Megabyte> operator""_MB(
+    const long double value) {
+  return ScalarLiteral<Unit::Memory::Megabyte>{value};
+}
+
+/// \brief Megabyte (MB) memory literal. For example, 2_MB.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Megabyte> operator""_MB(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Memory::Megabyte>{static_cast<long double>(value)};
+}
+
+/// \brief Mebibyte (MiB) memory literal. For example, 1.5_MiB.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Mebibyte> operator""_MiB(
+    const long double value) {
+  return ScalarLiteral<Unit::Memory::Mebibyte>{value};
+}
+
+/// \brief Mebibyte (MiB) memory literal. For example, 2_MiB.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Mebibyte> operator""_MiB(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Memory::Mebibyte>{static_cast<long double>(value)};
+}
+
+/// \brief Gigabit (Gb) memory literal. For example, 1.5_Gb.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Gigabit> operator""_Gb(
+    const long double value) {
+  return ScalarLiteral<Unit::Memory::Gigabit>{value};
+}
+
+/// \brief Gigabit (Gb) memory literal. For example, 2_Gb.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Gigabit> operator""_Gb(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Memory::Gigabit>{static_cast<long double>(value)};
+}
+
+/// \brief Gibibit (Gib) memory literal. For example, 1.5_Gib.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Gibibit> operator""_Gib(
+    const long double value) {
+  return ScalarLiteral<Unit::Memory::Gibibit>{value};
+}
+
+/// \brief Gibibit (Gib) memory literal. For example, 2_Gib.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Gibibit> operator""_Gib(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Memory::Gibibit>{static_cast<long double>(value)};
+}
+
+/// \brief Gigabyte (GB) memory literal. For example, 1.5_GB.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Gigabyte> operator""_GB(
+    const long double value) {
+  return ScalarLiteral<Unit::Memory::Gigabyte>{value};
+}
+
+/// \brief Gigabyte (GB) memory literal. For example, 2_GB.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Gigabyte> operator""_GB(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Memory::Gigabyte>{static_cast<long double>(value)};
+}
+
+/// \brief Gibibyte (GiB) memory literal. For example, 1.5_GiB.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Gibibyte> operator""_GiB(
+    const long double value) {
+  return ScalarLiteral<Unit::Memory::Gibibyte>{value};
+}
+
+/// \brief Gibibyte (GiB) memory literal. For example, 2_GiB.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Gibibyte> operator""_GiB(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Memory::Gibibyte>{static_cast<long double>(value)};
+}
+
+/// \brief Terabit (Tb) memory literal. For example, 1.5_Tb.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Terabit> operator""_Tb(
+    const long double value) {
+  return ScalarLiteral<Unit::Memory::Terabit>{value};
+}
+
+/// \brief Terabit (Tb) memory literal. For example, 2_Tb.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Terabit> operator""_Tb(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Memory::Terabit>{static_cast<long double>(value)};
+}
+
+/// \brief Tebibit (Tib) memory literal. For example, 1.5_Tib.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Tebibit> operator""_Tib(
+    const long double value) {
+  return ScalarLiteral<Unit::Memory::Tebibit>{value};
+}
+
+/// \brief Tebibit (Tib) memory literal. For example, 2_Tib.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Tebibit> operator""_Tib(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Memory::Tebibit>{static_cast<long double>(value)};
+}
+
+/// \brief Terabyte (TB) memory literal. For example, 1.5_TB.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Terabyte> operator""_TB(
+    const long double value) {
+  return ScalarLiteral<Unit::Memory::Terabyte>{value};
+}
+
+/// \brief Terabyte (TB) memory literal. For example, 2_TB.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Terabyte> operator""_TB(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Memory::Terabyte>{static_cast<long double>(value)};
+}
+
+/// \brief Tebibyte (TiB) memory literal. For example, 1.5_TiB.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Tebibyte> operator""_TiB(
+    const long double value) {
+  return ScalarLiteral<Unit::Memory::Tebibyte>{value};
+}
+
+/// \brief Tebibyte (TiB) memory literal. For example, 2_TiB.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Tebibyte> operator""_TiB(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Memory::Tebibyte>{static_cast<long double>(value)};
+}
+
+/// \brief Petabit (Pb) memory literal. For example, 1.5_Pb.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Petabit> operator""_Pb(
+    const long double value) {
+  return ScalarLiteral<Unit::Memory::Petabit>{value};
+}
+
+/// \brief Petabit (Pb) memory literal. For example, 2_Pb.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Petabit> operator""_Pb(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Memory::Petabit>{static_cast<long double>(value)};
+}
+
+/// \brief Pebibit (Pib) memory literal. For example, 1.5_Pib.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Pebibit> operator""_Pib(
+    const long double value) {
+  return ScalarLiteral<Unit::Memory::Pebibit>{value};
+}
+
+/// \brief Pebibit (Pib) memory literal. For example, 2_Pib.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Pebibit> operator""_Pib(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Memory::Pebibit>{static_cast<long double>(value)};
+}
+
+/// \brief Petabyte (PB) memory literal. For example, 1.5_PB.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Petabyte> operator""_PB(
+    const long double value) {
+  return ScalarLiteral<Unit::Memory::Petabyte>{value};
+}
+
+/// \brief Petabyte (PB) memory literal. For example, 2_PB.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Petabyte> operator""_PB(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Memory::Petabyte>{static_cast<long double>(value)};
+}
+
+/// \brief Pebibyte (PiB) memory literal. For example, 1.5_PiB.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Pebibyte> operator""_PiB(
+    const long double value) {
+  return ScalarLiteral<Unit::Memory::Pebibyte>{value};
+}
+
+/// \brief Pebibyte (PiB) memory literal. For example, 2_PiB.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Memory::Pebibyte> operator""_PiB(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Memory::Pebibyte>{static_cast<long double>(value)};
+}
+
+/// \brief Bit per second (b/s) memory rate literal. For example, 1.5_b_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::BitPerSecond> operator""_b_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::BitPerSecond>{value};
+}
+
+/// \brief Bit per second (b/s) memory rate literal. For example, 2_b_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::BitPerSecond> operator""_b_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::BitPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Byte per second (B/s) memory rate literal. For example, 1.5_B_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::BytePerSecond> operator""_B_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::BytePerSecond>{value};
+}
+
+/// \brief Byte per second (B/s) memory rate literal. For example, 2_B_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::BytePerSecond> operator""_B_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::BytePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Kilobit per second (kb/s) memory rate literal. For example, 1.5_kb_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KilobitPerSecond> operator""_kb_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::KilobitPerSecond>{value};
+}
+
+/// \brief Kilobit per second (kb/s) memory rate literal. For example, 2_kb_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KilobitPerSecond> operator""_kb_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::KilobitPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Kibibit per second (kib/s) memory rate literal. For example, 1.5_kib_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KibibitPerSecond> operator""_kib_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::KibibitPerSecond>{value};
+}
+
+/// \brief Kibibit per second (kib/s) memory rate literal. For example, 2_kib_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KibibitPerSecond> operator""_kib_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::KibibitPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Kilobyte per second (kB/s) memory rate literal. For example, 1.5_kB_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KilobytePerSecond> operator""_kB_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::KilobytePerSecond>{value};
+}
+
+/// \brief Kilobyte per second (kB/s) memory rate literal. For example, 2_kB_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KilobytePerSecond> operator""_kB_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::KilobytePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Kibibyte per second (kiB/s) memory rate literal. For example, 1.5_kiB_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KibibytePerSecond> operator""_kiB_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::KibibytePerSecond>{value};
+}
+
+/// \brief Kibibyte per second (kiB/s) memory rate literal. For example, 2_kiB_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KibibytePerSecond> operator""_kiB_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::KibibytePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Megabit per second (Mb/s) memory rate literal. For example, 1.5_Mb_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MegabitPerSecond> operator""_Mb_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::MegabitPerSecond>{value};
+}
+
+/// \brief Megabit per second (Mb/s) memory rate literal. For example, 2_Mb_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MegabitPerSecond> operator""_Mb_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::MegabitPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Mebibit per second (Mib/s) memory rate literal. For example, 1.5_Mib_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MebibitPerSecond> operator""_Mib_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::MebibitPerSecond>{value};
+}
+
+/// \brief Mebibit per second (Mib/s) memory rate literal. For example, 2_Mib_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MebibitPerSecond> operator""_Mib_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::MebibitPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Megabyte per second (MB/s) memory rate literal. For example, 1.5_MB_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MegabytePerSecond> operator""_MB_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::MegabytePerSecond>{value};
+}
+
+/// \brief Megabyte per second (MB/s) memory rate literal. For example, 2_MB_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MegabytePerSecond> operator""_MB_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::MegabytePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Mebibyte per second (MiB/s) memory rate literal. For example, 1.5_MiB_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MebibytePerSecond> operator""_MiB_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::MebibytePerSecond>{value};
+}
+
+/// \brief Mebibyte per second (MiB/s) memory rate literal. For example, 2_MiB_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MebibytePerSecond> operator""_MiB_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::MebibytePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Gigabit per second (Gb/s) memory rate literal. For example, 1.5_Gb_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GigabitPerSecond> operator""_Gb_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::GigabitPerSecond>{value};
+}
+
+/// \brief Gigabit per second (Gb/s) memory rate literal. For example, 2_Gb_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GigabitPerSecond> operator""_Gb_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::GigabitPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Gibibit per second (Gib/s) memory rate literal. For example, 1.5_Gib_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GibibitPerSecond> operator""_Gib_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::GibibitPerSecond>{value};
+}
+
+/// \brief Gibibit per second (Gib/s) memory rate literal. For example, 2_Gib_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GibibitPerSecond> operator""_Gib_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::GibibitPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Gigabyte per second (GB/s) memory rate literal. For example, 1.5_GB_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GigabytePerSecond> operator""_GB_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::GigabytePerSecond>{value};
+}
+
+/// \brief Gigabyte per second (GB/s) memory rate literal. For example, 2_GB_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GigabytePerSecond> operator""_GB_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::GigabytePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Gibibyte per second (GiB/s) memory rate literal. For example, 1.5_GiB_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GibibytePerSecond> operator""_GiB_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::GibibytePerSecond>{value};
+}
+
+/// \brief Gibibyte per second (GiB/s) memory rate literal. For example, 2_GiB_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GibibytePerSecond> operator""_GiB_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::GibibytePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Terabit per second (Tb/s) memory rate literal. For example, 1.5_Tb_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TerabitPerSecond> operator""_Tb_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::TerabitPerSecond>{value};
+}
+
+/// \brief Terabit per second (Tb/s) memory rate literal. For example, 2_Tb_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TerabitPerSecond> operator""_Tb_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::TerabitPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Tebibit per second (Tib/s) memory rate literal. For example, 1.5_Tib_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TebibitPerSecond> operator""_Tib_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::TebibitPerSecond>{value};
+}
+
+/// \brief Tebibit per second (Tib/s) memory rate literal. For example, 2_Tib_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TebibitPerSecond> operator""_Tib_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::TebibitPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Terabyte per second (TB/s) memory rate literal. For example, 1.5_TB_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TerabytePerSecond> operator""_TB_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::TerabytePerSecond>{value};
+}
+
+/// \brief Terabyte per second (TB/s) memory rate literal. For example, 2_TB_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TerabytePerSecond> operator""_TB_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::TerabytePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Tebibyte per second (TiB/s) memory rate literal. For example, 1.5_TiB_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TebibytePerSecond> operator""_TiB_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::TebibytePerSecond>{value};
+}
+
+/// \brief Tebibyte per second (TiB/s) memory rate literal. For example, 2_TiB_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TebibytePerSecond> operator""_TiB_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::TebibytePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Petabit per second (Pb/s) memory rate literal. For example, 1.5_Pb_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PetabitPerSecond> operator""_Pb_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::PetabitPerSecond>{value};
+}
+
+/// \brief Petabit per second (Pb/s) memory rate literal. For example, 2_Pb_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PetabitPerSecond> operator""_Pb_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::PetabitPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Pebibit per second (Pib/s) memory rate literal. For example, 1.5_Pib_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PebibitPerSecond> operator""_Pib_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::PebibitPerSecond>{value};
+}
+
+/// \brief Pebibit per second (Pib/s) memory rate literal. For example, 2_Pib_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PebibitPerSecond> operator""_Pib_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::PebibitPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Petabyte per second (PB/s) memory rate literal. For example, 1.5_PB_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PetabytePerSecond> operator""_PB_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::PetabytePerSecond>{value};
+}
+
+/// \brief Petabyte per second (PB/s) memory rate literal. For example, 2_PB_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PetabytePerSecond> operator""_PB_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::PetabytePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Pebibyte per second (PiB/s) memory rate literal. For example, 1.5_PiB_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PebibytePerSecond> operator""_PiB_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::PebibytePerSecond>{value};
+}
+
+/// \brief Pebibyte per second (PiB/s) memory rate literal. For example, 2_PiB_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PebibytePerSecond> operator""_PiB_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::PebibytePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Bit per minute (b/min) memory rate literal. For example, 1.5_b_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::BitPerMinute> operator""_b_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::BitPerMinute>{value};
+}
+
+/// \brief Bit per minute (b/min) memory rate literal. For example, 2_b_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::BitPerMinute> operator""_b_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::BitPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Byte per minute (B/min) memory rate literal. For example, 1.5_B_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::BytePerMinute> operator""_B_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::BytePerMinute>{value};
+}
+
+/// \brief Byte per minute (B/min) memory rate literal. For example, 2_B_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::BytePerMinute> operator""_B_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::BytePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Kilobit per minute (kb/min) memory rate literal. For example, 1.5_kb_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KilobitPerMinute> operator""_kb_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::KilobitPerMinute>{value};
+}
+
+/// \brief Kilobit per minute (kb/min) memory rate literal. For example, 2_kb_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KilobitPerMinute> operator""_kb_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::KilobitPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Kibibit per minute (kib/min) memory rate literal. For example, 1.5_kib_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KibibitPerMinute> operator""_kib_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::KibibitPerMinute>{value};
+}
+
+/// \brief Kibibit per minute (kib/min) memory rate literal. For example, 2_kib_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KibibitPerMinute> operator""_kib_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::KibibitPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Kilobyte per minute (kB/min) memory rate literal. For example, 1.5_kB_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KilobytePerMinute> operator""_kB_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::KilobytePerMinute>{value};
+}
+
+/// \brief Kilobyte per minute (kB/min) memory rate literal. For example, 2_kB_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KilobytePerMinute> operator""_kB_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::KilobytePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Kibibyte per minute (kiB/min) memory rate literal. For example, 1.5_kiB_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KibibytePerMinute> operator""_kiB_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::KibibytePerMinute>{value};
+}
+
+/// \brief Kibibyte per minute (kiB/min) memory rate literal. For example, 2_kiB_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KibibytePerMinute> operator""_kiB_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::KibibytePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Megabit per minute (Mb/min) memory rate literal. For example, 1.5_Mb_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MegabitPerMinute> operator""_Mb_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::MegabitPerMinute>{value};
+}
+
+/// \brief Megabit per minute (Mb/min) memory rate literal. For example, 2_Mb_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MegabitPerMinute> operator""_Mb_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::MegabitPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Mebibit per minute (Mib/min) memory rate literal. For example, 1.5_Mib_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MebibitPerMinute> operator""_Mib_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::MebibitPerMinute>{value};
+}
+
+/// \brief Mebibit per minute (Mib/min) memory rate literal. For example, 2_Mib_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MebibitPerMinute> operator""_Mib_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::MebibitPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Megabyte per minute (MB/min) memory rate literal. For example, 1.5_MB_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MegabytePerMinute> operator""_MB_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::MegabytePerMinute>{value};
+}
+
+/// \brief Megabyte per minute (MB/min) memory rate literal. For example, 2_MB_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MegabytePerMinute> operator""_MB_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::MegabytePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Mebibyte per minute (MiB/min) memory rate literal. For example, 1.5_MiB_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MebibytePerMinute> operator""_MiB_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::MebibytePerMinute>{value};
+}
+
+/// \brief Mebibyte per minute (MiB/min) memory rate literal. For example, 2_MiB_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MebibytePerMinute> operator""_MiB_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::MebibytePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Gigabit per minute (Gb/min) memory rate literal. For example, 1.5_Gb_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GigabitPerMinute> operator""_Gb_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::GigabitPerMinute>{value};
+}
+
+/// \brief Gigabit per minute (Gb/min) memory rate literal. For example, 2_Gb_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GigabitPerMinute> operator""_Gb_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::GigabitPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Gibibit per minute (Gib/min) memory rate literal. For example, 1.5_Gib_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GibibitPerMinute> operator""_Gib_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::GibibitPerMinute>{value};
+}
+
+/// \brief Gibibit per minute (Gib/min) memory rate literal. For example, 2_Gib_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GibibitPerMinute> operator""_Gib_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::GibibitPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Gigabyte per minute (GB/min) memory rate literal. For example, 1.5_GB_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GigabytePerMinute> operator""_GB_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::GigabytePerMinute>{value};
+}
+
+/// \brief Gigabyte per minute (GB/min) memory rate literal. For example, 2_GB_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GigabytePerMinute> operator""_GB_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::GigabytePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Gibibyte per minute (GiB/min) memory rate literal. For example, 1.5_GiB_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GibibytePerMinute> operator""_GiB_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::GibibytePerMinute>{value};
+}
+
+/// \brief Gibibyte per minute (GiB/min) memory rate literal. For example, 2_GiB_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GibibytePerMinute> operator""_GiB_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::GibibytePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Terabit per minute (Tb/min) memory rate literal. For example, 1.5_Tb_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TerabitPerMinute> operator""_Tb_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::TerabitPerMinute>{value};
+}
+
+/// \brief Terabit per minute (Tb/min) memory rate literal. For example, 2_Tb_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TerabitPerMinute> operator""_Tb_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::TerabitPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Tebibit per minute (Tib/min) memory rate literal. For example, 1.5_Tib_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TebibitPerMinute> operator""_Tib_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::TebibitPerMinute>{value};
+}
+
+/// \brief Tebibit per minute (Tib/min) memory rate literal. For example, 2_Tib_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TebibitPerMinute> operator""_Tib_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::TebibitPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Terabyte per minute (TB/min) memory rate literal. For example, 1.5_TB_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TerabytePerMinute> operator""_TB_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::TerabytePerMinute>{value};
+}
+
+/// \brief Terabyte per minute (TB/min) memory rate literal. For example, 2_TB_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TerabytePerMinute> operator""_TB_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::TerabytePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Tebibyte per minute (TiB/min) memory rate literal. For example, 1.5_TiB_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TebibytePerMinute> operator""_TiB_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::TebibytePerMinute>{value};
+}
+
+/// \brief Tebibyte per minute (TiB/min) memory rate literal. For example, 2_TiB_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TebibytePerMinute> operator""_TiB_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::TebibytePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Petabit per minute (Pb/min) memory rate literal. For example, 1.5_Pb_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PetabitPerMinute> operator""_Pb_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::PetabitPerMinute>{value};
+}
+
+/// \brief Petabit per minute (Pb/min) memory rate literal. For example, 2_Pb_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PetabitPerMinute> operator""_Pb_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::PetabitPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Pebibit per minute (Pib/min) memory rate literal. For example, 1.5_Pib_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PebibitPerMinute> operator""_Pib_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::PebibitPerMinute>{value};
+}
+
+/// \brief Pebibit per minute (Pib/min) memory rate literal. For example, 2_Pib_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PebibitPerMinute> operator""_Pib_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::PebibitPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Petabyte per minute (PB/min) memory rate literal. For example, 1.5_PB_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PetabytePerMinute> operator""_PB_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::PetabytePerMinute>{value};
+}
+
+/// \brief Petabyte per minute (PB/min) memory rate literal. For example, 2_PB_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PetabytePerMinute> operator""_PB_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::PetabytePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Pebibyte per minute (PiB/min) memory rate literal. For example, 1.5_PiB_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PebibytePerMinute> operator""_PiB_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::PebibytePerMinute>{value};
+}
+
+/// \brief Pebibyte per minute (PiB/min) memory rate literal. For example, 2_PiB_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PebibytePerMinute> operator""_PiB_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::PebibytePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Bit per hour (b/hr) memory rate literal. For example, 1.5_b_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::BitPerHour> operator""_b_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::BitPerHour>{value};
+}
+
+/// \brief Bit per hour (b/hr) memory rate literal. For example, 2_b_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::BitPerHour> operator""_b_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::BitPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Byte per hour (B/hr) memory rate literal. For example, 1.5_B_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::BytePerHour> operator""_B_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::BytePerHour>{value};
+}
+
+/// \brief Byte per hour (B/hr) memory rate literal. For example, 2_B_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::BytePerHour> operator""_B_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::BytePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Kilobit per hour (kb/hr) memory rate literal. For example, 1.5_kb_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KilobitPerHour> operator""_kb_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::KilobitPerHour>{value};
+}
+
+/// \brief Kilobit per hour (kb/hr) memory rate literal. For example, 2_kb_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KilobitPerHour> operator""_kb_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::KilobitPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Kibibit per hour (kib/hr) memory rate literal. For example, 1.5_kib_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KibibitPerHour> operator""_kib_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::KibibitPerHour>{value};
+}
+
+/// \brief Kibibit per hour (kib/hr) memory rate literal. For example, 2_kib_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KibibitPerHour> operator""_kib_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::KibibitPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Kilobyte per hour (kB/hr) memory rate literal. For example, 1.5_kB_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KilobytePerHour> operator""_kB_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::KilobytePerHour>{value};
+}
+
+/// \brief Kilobyte per hour (kB/hr) memory rate literal. For example, 2_kB_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KilobytePerHour> operator""_kB_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::KilobytePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Kibibyte per hour (kiB/hr) memory rate literal. For example, 1.5_kiB_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KibibytePerHour> operator""_kiB_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::KibibytePerHour>{value};
+}
+
+/// \brief Kibibyte per hour (kiB/hr) memory rate literal. For example, 2_kiB_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::KibibytePerHour> operator""_kiB_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::KibibytePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Megabit per hour (Mb/hr) memory rate literal. For example, 1.5_Mb_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MegabitPerHour> operator""_Mb_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::MegabitPerHour>{value};
+}
+
+/// \brief Megabit per hour (Mb/hr) memory rate literal. For example, 2_Mb_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MegabitPerHour> operator""_Mb_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::MegabitPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Mebibit per hour (Mib/hr) memory rate literal. For example, 1.5_Mib_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MebibitPerHour> operator""_Mib_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::MebibitPerHour>{value};
+}
+
+/// \brief Mebibit per hour (Mib/hr) memory rate literal. For example, 2_Mib_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MebibitPerHour> operator""_Mib_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::MebibitPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Megabyte per hour (MB/hr) memory rate literal. For example, 1.5_MB_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MegabytePerHour> operator""_MB_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::MegabytePerHour>{value};
+}
+
+/// \brief Megabyte per hour (MB/hr) memory rate literal. For example, 2_MB_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MegabytePerHour> operator""_MB_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::MegabytePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Mebibyte per hour (MiB/hr) memory rate literal. For example, 1.5_MiB_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MebibytePerHour> operator""_MiB_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::MebibytePerHour>{value};
+}
+
+/// \brief Mebibyte per hour (MiB/hr) memory rate literal. For example, 2_MiB_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::MebibytePerHour> operator""_MiB_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::MebibytePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Gigabit per hour (Gb/hr) memory rate literal. For example, 1.5_Gb_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GigabitPerHour> operator""_Gb_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::GigabitPerHour>{value};
+}
+
+/// \brief Gigabit per hour (Gb/hr) memory rate literal. For example, 2_Gb_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GigabitPerHour> operator""_Gb_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::GigabitPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Gibibit per hour (Gib/hr) memory rate literal. For example, 1.5_Gib_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GibibitPerHour> operator""_Gib_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::GibibitPerHour>{value};
+}
+
+/// \brief Gibibit per hour (Gib/hr) memory rate literal. For example, 2_Gib_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GibibitPerHour> operator""_Gib_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::GibibitPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Gigabyte per hour (GB/hr) memory rate literal. For example, 1.5_GB_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GigabytePerHour> operator""_GB_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::GigabytePerHour>{value};
+}
+
+/// \brief Gigabyte per hour (GB/hr) memory rate literal. For example, 2_GB_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GigabytePerHour> operator""_GB_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::GigabytePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Gibibyte per hour (GiB/hr) memory rate literal. For example, 1.5_GiB_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GibibytePerHour> operator""_GiB_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::GibibytePerHour>{value};
+}
+
+/// \brief Gibibyte per hour (GiB/hr) memory rate literal. For example, 2_GiB_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::GibibytePerHour> operator""_GiB_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::GibibytePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Terabit per hour (Tb/hr) memory rate literal. For example, 1.5_Tb_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TerabitPerHour> operator""_Tb_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::TerabitPerHour>{value};
+}
+
+/// \brief Terabit per hour (Tb/hr) memory rate literal. For example, 2_Tb_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TerabitPerHour> operator""_Tb_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::TerabitPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Tebibit per hour (Tib/hr) memory rate literal. For example, 1.5_Tib_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TebibitPerHour> operator""_Tib_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::TebibitPerHour>{value};
+}
+
+/// \brief Tebibit per hour (Tib/hr) memory rate literal. For example, 2_Tib_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TebibitPerHour> operator""_Tib_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::TebibitPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Terabyte per hour (TB/hr) memory rate literal. For example, 1.5_TB_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TerabytePerHour> operator""_TB_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::TerabytePerHour>{value};
+}
+
+/// \brief Terabyte per hour (TB/hr) memory rate literal. For example, 2_TB_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TerabytePerHour> operator""_TB_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::TerabytePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Tebibyte per hour (TiB/hr) memory rate literal. For example, 1.5_TiB_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TebibytePerHour> operator""_TiB_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::TebibytePerHour>{value};
+}
+
+/// \brief Tebibyte per hour (TiB/hr) memory rate literal. For example, 2_TiB_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::TebibytePerHour> operator""_TiB_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::TebibytePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Petabit per hour (Pb/hr) memory rate literal. For example, 1.5_Pb_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PetabitPerHour> operator""_Pb_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::PetabitPerHour>{value};
+}
+
+/// \brief Petabit per hour (Pb/hr) memory rate literal. For example, 2_Pb_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PetabitPerHour> operator""_Pb_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::PetabitPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Pebibit per hour (Pib/hr) memory rate literal. For example, 1.5_Pib_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PebibitPerHour> operator""_Pib_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::PebibitPerHour>{value};
+}
+
+/// \brief Pebibit per hour (Pib/hr) memory rate literal. For example, 2_Pib_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PebibitPerHour> operator""_Pib_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::PebibitPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Petabyte per hour (PB/hr) memory rate literal. For example, 1.5_PB_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PetabytePerHour> operator""_PB_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::PetabytePerHour>{value};
+}
+
+/// \brief Petabyte per hour (PB/hr) memory rate literal. For example, 2_PB_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PetabytePerHour> operator""_PB_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::PetabytePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Pebibyte per hour (PiB/hr) memory rate literal. For example, 1.5_PiB_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PebibytePerHour> operator""_PiB_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::MemoryRate::PebibytePerHour>{value};
+}
+
+/// \brief Pebibyte per hour (PiB/hr) memory rate literal. For example, 2_PiB_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::MemoryRate::PebibytePerHour> operator""_PiB_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::MemoryRate::PebibytePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Watt (W) power literal. For example, 1.5_W.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Power::Watt> operator""_W(const long double value) {
+  return ScalarLiteral<Unit::Power::Watt>{value};
+}
+
+/// \brief Watt (W) power literal. For example, 2_W.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Power::Watt> operator""_W(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Power::Watt>{static_cast<long double>(value)};
+}
+
+/// \brief Milliwatt (mW) power literal. For example, 1.5_mW.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Power::Milliwatt> operator""_mW(
+    const long double value) {
+  return ScalarLiteral<Unit::Power::Milliwatt>{value};
+}
+
+/// \brief Milliwatt (mW) power literal. For example, 2_mW.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Power::Milliwatt> operator""_mW(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Power::Milliwatt>{static_cast<long double>(value)};
+}
+
+/// \brief Microwatt (μW) power literal. For example, 1.5_uW.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Power::Microwatt> operator""_uW(
+    const long double value) {
+  return ScalarLiteral<Unit::Power::Microwatt>{value};
+}
+
+/// \brief Microwatt (μW) power literal. For example, 2_uW.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Power::Microwatt> operator""_uW(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Power::Microwatt>{static_cast<long double>(value)};
+}
+
+/// \brief Nanowatt (nW) power literal. For example, 1.5_nW.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Power::Nanowatt> operator""_nW(
+    const long double value) {
+  return ScalarLiteral<Unit::Power::Nanowatt>{value};
+}
+
+/// \brief Nanowatt (nW) power literal. For example, 2_nW.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Power::Nanowatt> operator""_nW(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Power::Nanowatt>{static_cast<long double>(value)};
+}
+
+/// \brief Kilowatt (kW) power literal. For example, 1.5_kW.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Power::Kilowatt> operator""_kW(
+    const long double value) {
+  return ScalarLiteral<Unit::Power::Kilowatt>{value};
+}
+
+/// \brief Kilowatt (kW) power literal. For example, 2_kW.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Power::Kilowatt> operator""_kW(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Power::Kilowatt>{static_cast<long double>(value)};
+}
+
+/// \brief Megawatt (MW) power literal. For example, 1.5_MW.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Power::Megawatt> operator""_MW(
+    const long double value) {
+  return ScalarLiteral<Unit::Power::Megawatt>{value};
+}
+
+/// \brief Megawatt (MW) power literal. For example, 2_MW.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Power::Megawatt> operator""_MW(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Power::Megawatt>{static_cast<long double>(value)};
+}
+
+/// \brief Gigawatt (GW) power literal. For example, 1.5_GW.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Power::Gigawatt> operator""_GW(
+    const long double value) {
+  return ScalarLiteral<Unit::Power::Gigawatt>{value};
+}
+
+/// \brief Gigawatt (GW) power literal. For example, 2_GW.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Power::Gigawatt> operator""_GW(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Power::Gigawatt>{static_cast<long double>(value)};
+}
+
+/// \brief Foot-pound per second (ft·lbf/s) power literal. For example, 1.5_ft_lbf_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Power::FootPoundPerSecond> operator""_ft_lbf_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::Power::FootPoundPerSecond>{value};
+}
+
+/// \brief Foot-pound per second (ft·lbf/s) power literal. For example, 2_ft_lbf_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Power::FootPoundPerSecond> operator""_ft_lbf_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Power::FootPoundPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Inch-pound per second (in·lbf/s) power literal. For example, 1.5_in_lbf_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Power::InchPoundPerSecond> operator""_in_lbf_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::Power::InchPoundPerSecond>{value};
+}
+
+/// \brief Inch-pound per second (in·lbf/s) power literal. For example, 2_in_lbf_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Power::InchPoundPerSecond> operator""_in_lbf_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Power::InchPoundPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Pascal (Pa) pressure literal. For example, 1.5_Pa.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Pressure::Pascal> operator""_Pa(
+    const long double value) {
+  return ScalarLiteral<Unit::Pressure::Pascal>{value};
+}
+
+/// \brief Pascal (Pa) pressure literal. For example, 2_Pa.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Pressure::Pascal> operator""_Pa(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Pressure::Pascal>{static_cast<long double>(value)};
+}
+
+/// \brief Kilopascal (kPa) pressure literal. For example, 1.5_kPa.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Pressure::Kilopascal> operator""_kPa(
+    const long double value) {
+  return ScalarLiteral<Unit::Pressure::Kilopascal>{value};
+}
+
+/// \brief Kilopascal (kPa) pressure literal. For example, 2_kPa.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Pressure::Kilopascal> operator""_kPa(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Pressure::Kilopascal>{static_cast<long double>(value)};
+}
+
+/// \brief Megapascal (MPa) pressure literal. For example, 1.5_MPa.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Pressure::Megapascal> operator""_MPa(
+    const long double value) {
+  return ScalarLiteral<Unit::Pressure::Megapascal>{value};
+}
+
+/// \brief Megapascal (MPa) pressure literal. For example, 2_MPa.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Pressure::Megapascal> operator""_MPa(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Pressure::Megapascal>{static_cast<long double>(value)};
+}
+
+/// \brief Gigapascal (GPa) pressure literal. For example, 1.5_GPa.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Pressure::Gigapascal> operator""_GPa(
+    const long double value) {
+  return ScalarLiteral<Unit::Pressure::Gigapascal>{value};
+}
+
+/// \brief Gigapascal (GPa) pressure literal. For example, 2_GPa.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Pressure::Gigapascal> operator""_GPa(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Pressure::Gigapascal>{static_cast<long double>(value)};
+}
+
+/// \brief Bar (bar) pressure literal. For example, 1.5_bar.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Pressure::Bar> operator""_bar(const long double value) {
+  return ScalarLiteral<Unit::Pressure::Bar>{value};
+}
+
+/// \brief Bar (bar) pressure literal. For example, 2_bar.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Pressure::Bar> operator""_bar(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Pressure::Bar>{static_cast<long double>(value)};
+}
+
+/// \brief Atmosphere (atm) pressure literal. For example, 1.5_atm.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Pressure::Atmosphere> operator""_atm(
+    const long double value) {
+  return ScalarLiteral<Unit::Pressure::Atmosphere>{value};
+}
+
+/// \brief Atmosphere (atm) pressure literal. For example, 2_atm.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Pressure::Atmosphere> operator""_atm(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Pressure::Atmosphere>{static_cast<long double>(value)};
+}
+
+/// \brief Pound per square foot (lbf/ft^2) pressure literal. For example, 1.5_lbf_per_ft2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Pressure::PoundPerSquareFoot> operator""_lbf_per_ft2(
+    const long double value) {
+  return ScalarLiteral<Unit::Pressure::PoundPerSquareFoot>{value};
+}
+
+/// \brief Pound per square foot (lbf/ft^2) pressure literal. For example, 2_lbf_per_ft2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Pressure::PoundPerSquareFoot> operator""_lbf_per_ft2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Pressure::PoundPerSquareFoot>{static_cast<long double>(value)};
+}
+
+/// \brief Pound per square inch (lbf/in^2) pressure literal. For example, 1.5_lbf_per_in2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Pressure::PoundPerSquareInch> operator""_lbf_per_in2(
+    const long double value) {
+  return ScalarLiteral<Unit::Pressure::PoundPerSquareInch>{value};
+}
+
+/// \brief Pound per square inch (lbf/in^2) pressure literal. For example, 2_lbf_per_in2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Pressure::PoundPerSquareInch> operator""_lbf_per_in2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Pressure::PoundPerSquareInch>{static_cast<long double>(value)};
+}
+
+/// \brief Steradian (sr) solid angle literal, also known as square radian. For example, 1.5_sr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SolidAngle::Steradian> operator""_sr(
+    const long double value) {
+  return ScalarLiteral<Unit::SolidAngle::Steradian>{value};
+}
+
+/// \brief Steradian (sr) solid angle literal, also known as square radian. For example, 2_sr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SolidAngle::Steradian> operator""_sr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::SolidAngle::Steradian>{static_cast<long double>(value)};
+}
+
+/// \brief Square degree (deg^2) solid angle literal. For example, 1.5_deg2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SolidAngle::SquareDegree> operator""_deg2(
+    const long double value) {
+  return ScalarLiteral<Unit::SolidAngle::SquareDegree>{value};
+}
+
+/// \brief Square degree (deg^2) solid angle literal. For example, 2_deg2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SolidAngle::SquareDegree> operator""_deg2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::SolidAngle::SquareDegree>{static_cast<long double>(value)};
+}
+
+/// \brief Square arcminute (arcmin^2) solid angle literal. For example, 1.5_arcmin2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SolidAngle::SquareArcminute> operator""_arcmin2(
+    const long double value) {
+  return ScalarLiteral<Unit::SolidAngle::SquareArcminute>{value};
+}
+
+/// \brief Square arcminute (arcmin^2) solid angle literal. For example, 2_arcmin2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SolidAngle::SquareArcminute> operator""_arcmin2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::SolidAngle::SquareArcminute>{static_cast<long double>(value)};
+}
+
+/// \brief Square arcsecond (arcsec^2) solid angle literal. For example, 1.5_arcsec2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SolidAngle::SquareArcsecond> operator""_arcsec2(
+    const long double value) {
+  return ScalarLiteral<Unit::SolidAngle::SquareArcsecond>{value};
+}
+
+/// \brief Square arcsecond (arcsec^2) solid angle literal. For example, 2_arcsec2.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SolidAngle::SquareArcsecond> operator""_arcsec2(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::SolidAngle::SquareArcsecond>{static_cast<long double>(value)};
+}
+
+/// \brief Joule per kilogram (J/kg) specific energy literal. For example, 1.5_J_per_kg.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificEnergy::JoulePerKilogram> operator""_J_per_kg(
+    const long double value) {
+  return ScalarLiteral<Unit::SpecificEnergy::JoulePerKilogram>{value};
+}
+
+/// \brief Joule per kilogram (J/kg) specific energy literal. For example, 2_J_per_kg.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificEnergy::JoulePerKilogram> operator""_J_per_kg(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::SpecificEnergy::JoulePerKilogram>{static_cast<long double>(value)};
+}
+
+/// \brief Nanojoule per gram (nJ/g) specific energy literal. For example, 1.5_nJ_per_g.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificEnergy::NanojoulePerGram> operator""_nJ_per_g(
+    const long double value) {
+  return ScalarLiteral<Unit::SpecificEnergy::NanojoulePerGram>{value};
+}
+
+/// \brief Nanojoule per gram (nJ/g) specific energy literal. For example, 2_nJ_per_g.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificEnergy::NanojoulePerGram> operator""_nJ_per_g(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::SpecificEnergy::NanojoulePerGram>{static_cast<long double>(value)};
+}
+
+/// \brief Foot-pound per slug (ft·lbf/slug) specific energy literal. For example,
+/// 1.5_ft_lbf_per_slug.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificEnergy::FootPoundPerSlug>
+operator""_ft_lbf_per_slug(const long double value) {
+  return ScalarLiteral<Unit::SpecificEnergy::FootPoundPerSlug>{value};
+}
+
+/// \brief Foot-pound per slug (ft·lbf/slug) specific energy literal. For example,
+/// 2_ft_lbf_per_slug.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificEnergy::FootPoundPerSlug>
+operator""_ft_lbf_per_slug(const unsigned long long value) {
+  return ScalarLiteral<Unit::SpecificEnergy::FootPoundPerSlug>{static_cast<long double>(value)};
+}
+
+/// \brief Inch-pound per slinch (in·lbf/slinch) specific energy literal. For example,
+/// 1.5_in_lbf_per_slinch.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificEnergy::InchPoundPerSlinch>
+operator""_in_lbf_per_slinch(const long double value) {
+  return ScalarLiteral<Unit::SpecificEnergy::InchPoundPerSlinch>{value};
+}
+
+/// \brief Inch-pound per slinch (in·lbf/slinch) specific energy literal. For example,
+/// 2_in_lbf_per_slinch.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificEnergy::InchPoundPerSlinch>
+operator""_in_lbf_per_slinch(const unsigned long long value) {
+  return ScalarLiteral<Unit::SpecificEnergy::InchPoundPerSlinch>{static_cast<long double>(value)};
+}
+
+/// \brief Joule per kilogram per kelvin (J/kg/K) specific heat capacity literal. For example,
+/// 1.5_J_per_kg_per_K.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin>
+operator""_J_per_kg_per_K(const long double value) {
+  return ScalarLiteral<Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin>{value};
+}
+
+/// \brief Joule per kilogram per kelvin (J/kg/K) specific heat capacity literal. For example,
+/// 2_J_per_kg_per_K.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin>
+operator""_J_per_kg_per_K(const unsigned long long value) {
+  return ScalarLiteral<Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Nanojoule per gram per kelvin (nJ/g/K) specific heat capacity literal. For example,
+/// 1.5_nJ_per_g_per_K.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin>
+operator""_nJ_per_g_per_K(const long double value) {
+  return ScalarLiteral<Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin>{value};
+}
+
+/// \brief Nanojoule per gram per kelvin (nJ/g/K) specific heat capacity literal. For example,
+/// 2_nJ_per_g_per_K.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin>
+operator""_nJ_per_g_per_K(const unsigned long long value) {
+  return ScalarLiteral<Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Foot-pound per slug per degree Rankine (ft·lbf/slug/°R) specific heat capacity literal.
+/// For example, 1.5_ft_lbf_per_slug_per_degR.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine>
+operator""_ft_lbf_per_slug_per_degR(const long double value) {
+  return ScalarLiteral<Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine>{value};
+}
+
+/// \brief Foot-pound per slug per degree Rankine (ft·lbf/slug/°R) specific heat capacity literal.
+/// For example, 2_ft_lbf_per_slug_per_degR.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine>
+operator""_ft_lbf_per_slug_per_degR(const unsigned long long value) {
+  return ScalarLiteral<Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Inch-pound per slinch per degree Rankine (in·lbf/slinch/°R) specific heat capacity
+/// literal. For example, 1.5_in_lbf_per_slinch_per_degR.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine>
+operator""_in_lbf_per_slinch_per_degR(const long double value) {
+  return ScalarLiteral<Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine>{value};
+}
+
+/// \brief Inch-pound per slinch per degree Rankine (in·lbf/slinch/°R) specific heat capacity
+/// literal. For example, 2_in_lbf_per_slinch_per_degR.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine>
+operator""_in_lbf_per_slinch_per_degR(const unsigned long long value) {
+  return ScalarLiteral<Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Watt per kilogram (W/kg) specific power literal. For example, 1.5_W_per_kg.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificPower::WattPerKilogram> operator""_W_per_kg(
+    const long double value) {
+  return ScalarLiteral<Unit::SpecificPower::WattPerKilogram>{value};
+}
+
+/// \brief Watt per kilogram (W/kg) specific power literal. For example, 2_W_per_kg.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificPower::WattPerKilogram> operator""_W_per_kg(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::SpecificPower::WattPerKilogram>{static_cast<long double>(value)};
+}
+
+/// \brief Nanowatt per gram (nW/g) specific power literal. For example, 1.5_nW_per_g.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificPower::NanowattPerGram> operator""_nW_per_g(
+    const long double value) {
+  return ScalarLiteral<Unit::SpecificPower::NanowattPerGram>{value};
+}
+
+/// \brief Nanowatt per gram (nW/g) specific power literal. For example, 2_nW_per_g.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificPower::NanowattPerGram> operator""_nW_per_g(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::SpecificPower::NanowattPerGram>{static_cast<long double>(value)};
+}
+
+/// \brief Foot-pound per slug per second (ft·lbf/slug/s) specific power literal. For example,
+/// 1.5_ft_lbf_per_slug_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificPower::FootPoundPerSlugPerSecond>
+operator""_ft_lbf_per_slug_per_s(const long double value) {
+  return ScalarLiteral<Unit::SpecificPower::FootPoundPerSlugPerSecond>{value};
+}
+
+/// \brief Foot-pound per slug per second (ft·lbf/slug/s) specific power literal. For example,
+/// 2_ft_lbf_per_slug_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificPower::FootPoundPerSlugPerSecond>
+operator""_ft_lbf_per_slug_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::SpecificPower::FootPoundPerSlugPerSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Inch-pound per slinch per second (in·lbf/slinch/s) specific power literal. For example,
+/// 1.5_in_lbf_per_slinch_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificPower::InchPoundPerSlinchPerSecond>
+operator""_in_lbf_per_slinch_per_s(const long double value) {
+  return ScalarLiteral<Unit::SpecificPower::InchPoundPerSlinchPerSecond>{value};
+}
+
+/// \brief Inch-pound per slinch per second (in·lbf/slinch/s) specific power literal. For example,
+/// 2_in_lbf_per_slinch_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SpecificPower::InchPoundPerSlinchPerSecond>
+operator""_in_lbf_per_slinch_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::SpecificPower::InchPoundPerSlinchPerSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Nautical mile per second (nmi/s) speed literal. For example, 1.5_nmi_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::NauticalMilePerSecond> operator""_nmi_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::NauticalMilePerSecond>{value};
+}
+
+/// \brief Nautical mile per second (nmi/s) speed literal. For example, 2_nmi_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::NauticalMilePerSecond> operator""_nmi_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::NauticalMilePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Nautical mile per minute (nmi/min) speed literal. For example, 1.5_nmi_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::NauticalMilePerMinute> operator""_nmi_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::NauticalMilePerMinute>{value};
+}
+
+/// \brief Nautical mile per minute (nmi/min) speed literal. For example, 2_nmi_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::NauticalMilePerMinute> operator""_nmi_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::NauticalMilePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Knot (kn) speed literal, also known as nautical mile per hour. For example, 1.5_kn.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::Knot> operator""_kn(const long double value) {
+  return ScalarLiteral<Unit::Speed::Knot>{value};
+}
+
+/// \brief Knot (kn) speed literal, also known as nautical mile per hour. For example, 2_kn.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::Knot> operator""_kn(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::Knot>{static_cast<long double>(value)};
+}
+
+/// \brief Mile per second (mi/s) speed literal. For example, 1.5_mi_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MilePerSecond> operator""_mi_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::MilePerSecond>{value};
+}
+
+/// \brief Mile per second (mi/s) speed literal. For example, 2_mi_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MilePerSecond> operator""_mi_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::MilePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Mile per minute (mi/min) speed literal. For example, 1.5_mi_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MilePerMinute> operator""_mi_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::MilePerMinute>{value};
+}
+
+/// \brief Mile per minute (mi/min) speed literal. For example, 2_mi_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MilePerMinute> operator""_mi_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::MilePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Mile per hour (mi/hr) speed literal. For example, 1.5_mi_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MilePerHour> operator""_mi_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::MilePerHour>{value};
+}
+
+/// \brief Mile per hour (mi/hr) speed literal. For example, 2_mi_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MilePerHour> operator""_mi_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::MilePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Kilometre per second (km/s) speed literal. For example, 1.5_km_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::KilometrePerSecond> operator""_km_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::KilometrePerSecond>{value};
+}
+
+/// \brief Kilometre per second (km/s) speed literal. For example, 2_km_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::KilometrePerSecond> operator""_km_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::KilometrePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Kilometre per minute (km/min) speed literal. For example, 1.5_km_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::KilometrePerMinute> operator""_km_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::KilometrePerMinute>{value};
+}
+
+/// \brief Kilometre per minute (km/min) speed literal. For example, 2_km_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::KilometrePerMinute> operator""_km_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::KilometrePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Kilometre per hour (km/hr) speed literal. For example, 1.5_km_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::KilometrePerHour> operator""_km_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::KilometrePerHour>{value};
+}
+
+/// \brief Kilometre per hour (km/hr) speed literal. For example, 2_km_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::KilometrePerHour> operator""_km_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::KilometrePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Metre per second (m/s) speed literal. For example, 1.5_m_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MetrePerSecond> operator""_m_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::MetrePerSecond>{value};
+}
+
+/// \brief Metre per second (m/s) speed literal. For example, 2_m_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MetrePerSecond> operator""_m_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::MetrePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Metre per minute (m/min) speed literal. For example, 1.5_m_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MetrePerMinute> operator""_m_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::MetrePerMinute>{value};
+}
+
+/// \brief Metre per minute (m/min) speed literal. For example, 2_m_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MetrePerMinute> operator""_m_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::MetrePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Metre per hour (m/hr) speed literal. For example, 1.5_m_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MetrePerHour> operator""_m_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::MetrePerHour>{value};
+}
+
+/// \brief Metre per hour (m/hr) speed literal. For example, 2_m_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MetrePerHour> operator""_m_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::MetrePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Yard per second (yd/s) speed literal. For example, 1.5_yd_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::YardPerSecond> operator""_yd_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::YardPerSecond>{value};
+}
+
+/// \brief Yard per second (yd/s) speed literal. For example, 2_yd_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::YardPerSecond> operator""_yd_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::YardPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Yard per minute (yd/min) speed literal. For example, 1.5_yd_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::YardPerMinute> operator""_yd_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::YardPerMinute>{value};
+}
+
+/// \brief Yard per minute (yd/min) speed literal. For example, 2_yd_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::YardPerMinute> operator""_yd_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::YardPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Yard per hour (yd/hr) speed literal. For example, 1.5_yd_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::YardPerHour> operator""_yd_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::YardPerHour>{value};
+}
+
+/// \brief Yard per hour (yd/hr) speed literal. For example, 2_yd_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::YardPerHour> operator""_yd_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::YardPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Foot per second (ft/s) speed literal. For example, 1.5_ft_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::FootPerSecond> operator""_ft_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::FootPerSecond>{value};
+}
+
+/// \brief Foot per second (ft/s) speed literal. For example, 2_ft_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::FootPerSecond> operator""_ft_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::FootPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Foot per minute (ft/min) speed literal. For example, 1.5_ft_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::FootPerMinute> operator""_ft_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::FootPerMinute>{value};
+}
+
+/// \brief Foot per minute (ft/min) speed literal. For example, 2_ft_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::FootPerMinute> operator""_ft_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::FootPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Foot per hour (ft/hr) speed literal. For example, 1.5_ft_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::FootPerHour> operator""_ft_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::FootPerHour>{value};
+}
+
+/// \brief Foot per hour (ft/hr) speed literal. For example, 2_ft_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::FootPerHour> operator""_ft_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::FootPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Decimetre per second (dm/s) speed literal. For example, 1.5_dm_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::DecimetrePerSecond> operator""_dm_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::DecimetrePerSecond>{value};
+}
+
+/// \brief Decimetre per second (dm/s) speed literal. For example, 2_dm_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::DecimetrePerSecond> operator""_dm_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::DecimetrePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Decimetre per minute (dm/min) speed literal. For example, 1.5_dm_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::DecimetrePerMinute> operator""_dm_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::DecimetrePerMinute>{value};
+}
+
+/// \brief Decimetre per minute (dm/min) speed literal. For example, 2_dm_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::DecimetrePerMinute> operator""_dm_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::DecimetrePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Decimetre per hour (dm/hr) speed literal. For example, 1.5_dm_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::DecimetrePerHour> operator""_dm_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::DecimetrePerHour>{value};
+}
+
+/// \brief Decimetre per hour (dm/hr) speed literal. For example, 2_dm_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::DecimetrePerHour> operator""_dm_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::DecimetrePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Inch per second (in/s) speed literal. For example, 1.5_in_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::InchPerSecond> operator""_in_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::InchPerSecond>{value};
+}
+
+/// \brief Inch per second (in/s) speed literal. For example, 2_in_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::InchPerSecond> operator""_in_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::InchPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Inch per minute (in/min) speed literal. For example, 1.5_in_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::InchPerMinute> operator""_in_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::InchPerMinute>{value};
+}
+
+/// \brief Inch per minute (in/min) speed literal. For example, 2_in_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::InchPerMinute> operator""_in_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::InchPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Inch per hour (in/hr) speed literal. For example, 1.5_in_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::InchPerHour> operator""_in_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::InchPerHour>{value};
+}
+
+/// \brief Inch per hour (in/hr) speed literal. For example, 2_in_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::InchPerHour> operator""_in_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::InchPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Centimetre per second (cm/s) speed literal. For example, 1.5_cm_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::CentimetrePerSecond> operator""_cm_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::CentimetrePerSecond>{value};
+}
+
+/// \brief Centimetre per second (cm/s) speed literal. For example, 2_cm_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::CentimetrePerSecond> operator""_cm_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::CentimetrePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Centimetre per minute (cm/min) speed literal. For example, 1.5_cm_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::CentimetrePerMinute> operator""_cm_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::CentimetrePerMinute>{value};
+}
+
+/// \brief Centimetre per minute (cm/min) speed literal. For example, 2_cm_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::CentimetrePerMinute> operator""_cm_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::CentimetrePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Centimetre per hour (cm/hr) speed literal. For example, 1.5_cm_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::CentimetrePerHour> operator""_cm_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::CentimetrePerHour>{value};
+}
+
+/// \brief Centimetre per hour (cm/hr) speed literal. For example, 2_cm_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::CentimetrePerHour> operator""_cm_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::CentimetrePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Millimetre per second (mm/s) speed literal. For example, 1.5_mm_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MillimetrePerSecond> operator""_mm_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::MillimetrePerSecond>{value};
+}
+
+/// \brief Millimetre per second (mm/s) speed literal. For example, 2_mm_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MillimetrePerSecond> operator""_mm_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::MillimetrePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Millimetre per minute (mm/min) speed literal. For example, 1.5_mm_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MillimetrePerMinute> operator""_mm_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::MillimetrePerMinute>{value};
+}
+
+/// \brief Millimetre per minute (mm/min) speed literal. For example, 2_mm_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MillimetrePerMinute> operator""_mm_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::MillimetrePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Millimetre per hour (mm/hr) speed literal. For example, 1.5_mm_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MillimetrePerHour> operator""_mm_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::MillimetrePerHour>{value};
+}
+
+/// \brief Millimetre per hour (mm/hr) speed literal. For example, 2_mm_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MillimetrePerHour> operator""_mm_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::MillimetrePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Milliinch per second (mil/s) speed literal. For example, 1.5_mil_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MilliinchPerSecond> operator""_mil_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::MilliinchPerSecond>{value};
+}
+
+/// \brief Milliinch per second (mil/s) speed literal. For example, 2_mil_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MilliinchPerSecond> operator""_mil_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::MilliinchPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Milliinch per minute (mil/min) speed literal. For example, 1.5_mil_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MilliinchPerMinute> operator""_mil_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::MilliinchPerMinute>{value};
+}
+
+/// \brief Milliinch per minute (mil/min) speed literal. For example, 2_mil_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MilliinchPerMinute> operator""_mil_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::MilliinchPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Milliinch per hour (mil/hr) speed literal. For example, 1.5_mil_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MilliinchPerHour> operator""_mil_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::MilliinchPerHour>{value};
+}
+
+/// \brief Milliinch per hour (mil/hr) speed literal. For example, 2_mil_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MilliinchPerHour> operator""_mil_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::MilliinchPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Micrometre per second (μm/s) speed literal. For example, 1.5_um_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MicrometrePerSecond> operator""_um_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::MicrometrePerSecond>{value};
+}
+
+/// \brief Micrometre per second (μm/s) speed literal. For example, 2_um_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MicrometrePerSecond> operator""_um_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::MicrometrePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Micrometre per minute (μm/min) speed literal. For example, 1.5_um_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MicrometrePerMinute> operator""_um_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::MicrometrePerMinute>{value};
+}
+
+/// \brief Micrometre per minute (μm/min) speed literal. For example, 2_um_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MicrometrePerMinute> operator""_um_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::MicrometrePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Micrometre per hour (μm/hr) speed literal. For example, 1.5_um_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MicrometrePerHour> operator""_um_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::MicrometrePerHour>{value};
+}
+
+/// \brief Micrometre per hour (μm/hr) speed literal. For example, 2_um_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MicrometrePerHour> operator""_um_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::MicrometrePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Microinch per second (μin/s) speed literal. For example, 1.5_uin_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MicroinchPerSecond> operator""_uin_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::MicroinchPerSecond>{value};
+}
+
+/// \brief Microinch per second (μin/s) speed literal. For example, 2_uin_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MicroinchPerSecond> operator""_uin_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::MicroinchPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Microinch per minute (μin/min) speed literal. For example, 1.5_uin_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MicroinchPerMinute> operator""_uin_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::MicroinchPerMinute>{value};
+}
+
+/// \brief Microinch per minute (μin/min) speed literal. For example, 2_uin_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MicroinchPerMinute> operator""_uin_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::MicroinchPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Microinch per hour (μin/hr) speed literal. For example, 1.5_uin_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MicroinchPerHour> operator""_uin_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::Speed::MicroinchPerHour>{value};
+}
+
+/// \brief Microinch per hour (μin/hr) speed literal. For example, 2_uin_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Speed::MicroinchPerHour> operator""_uin_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Speed::MicroinchPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Mole (mol) substance amount literal. For example, 1.5_mol.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SubstanceAmount::Mole> operator""_mol(
+    const long double value) {
+  return ScalarLiteral<Unit::SubstanceAmount::Mole>{value};
+}
+
+/// \brief Mole (mol) substance amount literal. For example, 2_mol.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SubstanceAmount::Mole> operator""_mol(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::SubstanceAmount::Mole>{static_cast<long double>(value)};
+}
+
+/// \brief Kilomole (kmol) substance amount literal. For example, 1.5_kmol.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SubstanceAmount::Kilomole> operator""_kmol(
+    const long double value) {
+  return ScalarLiteral<Unit::SubstanceAmount::Kilomole>{value};
+}
+
+/// \brief Kilomole (kmol) substance amount literal. For example, 2_kmol.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SubstanceAmount::Kilomole> operator""_kmol(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::SubstanceAmount::Kilomole>{static_cast<long double>(value)};
+}
+
+/// \brief Megamole (Mmol) substance amount literal. For example, 1.5_Mmol.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SubstanceAmount::Megamole> operator""_Mmol(
+    const long double value) {
+  return ScalarLiteral<Unit::SubstanceAmount::Megamole>{value};
+}
+
+/// \brief Megamole (Mmol) substance amount literal. For example, 2_Mmol.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SubstanceAmount::Megamole> operator""_Mmol(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::SubstanceAmount::Megamole>{static_cast<long double>(value)};
+}
+
+/// \brief Gigamole (Gmol) substance amount literal. For example, 1.5_Gmol.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SubstanceAmount::Gigamole> operator""_Gmol(
+    const long double value) {
+  return ScalarLiteral<Unit::SubstanceAmount::Gigamole>{value};
+}
+
+/// \brief Gigamole (Gmol) substance amount literal. For example, 2_Gmol.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SubstanceAmount::Gigamole> operator""_Gmol(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::SubstanceAmount::Gigamole>{static_cast<long double>(value)};
+}
+
+/// \brief Particles (particles) substance amount literal. For example, 1.5_particles.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SubstanceAmount::Particles> operator""_particles(
+    const long double value) {
+  return ScalarLiteral<Unit::SubstanceAmount::Particles>{value};
+}
+
+/// \brief Particles (particles) substance amount literal. For example, 2_particles.
+[[nodiscard]] constexpr ScalarLiteral<Unit::SubstanceAmount::Particles> operator""_particles(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::SubstanceAmount::Particles>{static_cast<long double>(value)};
+}
+
+/// \brief Kelvin (K) temperature literal. For example, 1.5_K.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Temperature::Kelvin> operator""_K(
+    const long double value) {
+  return ScalarLiteral<Unit::Temperature::Kelvin>{value};
+}
+
+/// \brief Kelvin (K) temperature literal. For example, 2_K.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Temperature::Kelvin> operator""_K(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Temperature::Kelvin>{static_cast<long double>(value)};
+}
+
+/// \brief Degree Celsius (°C) temperature literal. For example, 1.5_degC.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Temperature::Celsius> operator""_degC(
+    const long double value) {
+  return ScalarLiteral<Unit::Temperature::Celsius>{value};
+}
+
+/// \brief Degree Celsius (°C) temperature literal. For example, 2_degC.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Temperature::Celsius> operator""_degC(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Temperature::Celsius>{static_cast<long double>(value)};
+}
+
+/// \brief Degree Rankine (°R) temperature literal. For example, 1.5_degR.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Temperature::Rankine> operator""_degR(
+    const long double value) {
+  return ScalarLiteral<Unit::Temperature::Rankine>{value};
+}
+
+/// \brief Degree Rankine (°R) temperature literal. For example, 2_degR.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Temperature::Rankine> operator""_degR(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Temperature::Rankine>{static_cast<long double>(value)};
+}
+
+/// \brief Degree Fahrenheit (°F) temperature literal. For example, 1.5_degF.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Temperature::Fahrenheit> operator""_degF(
+    const long double value) {
+  return ScalarLiteral<Unit::Temperature::Fahrenheit>{value};
+}
+
+/// \brief Degree Fahrenheit (°F) temperature literal. For example, 2_degF.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Temperature::Fahrenheit> operator""_degF(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Temperature::Fahrenheit>{static_cast<long double>(value)};
+}
+
+/// \brief Kelvin per metre (K/m) temperature gradient literal. For example, 1.5_K_per_m.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TemperatureGradient::KelvinPerMetre> operator""_K_per_m(
+    const long double value) {
+  return ScalarLiteral<Unit::TemperatureGradient::KelvinPerMetre>{value};
+}
+
+/// \brief Kelvin per metre (K/m) temperature gradient literal. For example, 2_K_per_m.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TemperatureGradient::KelvinPerMetre> operator""_K_per_m(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::TemperatureGradient::KelvinPerMetre>{static_cast<long double>(value)};
+}
+
+/// \brief Kelvin per millimetre (K/mm) temperature gradient literal. For example, 1.5_K_per_mm.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TemperatureGradient::KelvinPerMillimetre>
+operator""_K_per_mm(const long double value) {
+  return ScalarLiteral<Unit::TemperatureGradient::KelvinPerMillimetre>{value};
+}
+
+/// \brief Kelvin per millimetre (K/mm) temperature gradient literal. For example, 2_K_per_mm.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TemperatureGradient::KelvinPerMillimetre>
+operator""_K_per_mm(const unsigned long long value) {
+  return ScalarLiteral<Unit::TemperatureGradient::KelvinPerMillimetre>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Degree Celsius per metre (°C/m) temperature gradient literal. For example,
+/// 1.5_degC_per_m.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TemperatureGradient::CelsiusPerMetre>
+operator""_degC_per_m(const long double value) {
+  return ScalarLiteral<Unit::TemperatureGradient::CelsiusPerMetre>{value};
+}
+
+/// \brief Degree Celsius per metre (°C/m) temperature gradient literal. For example, 2_degC_per_m.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TemperatureGradient::CelsiusPerMetre>
+operator""_degC_per_m(const unsigned long long value) {
+  return ScalarLiteral<Unit::TemperatureGradient::CelsiusPerMetre>{static_cast<long double>(value)};
+}
+
+/// \brief Degree Celsius per millimetre (°C/mm) temperature gradient literal. For example,
+/// 1.5_degC_per_mm.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TemperatureGradient::CelsiusPerMillimetre>
+operator""_degC_per_mm(const long double value) {
+  return ScalarLiteral<Unit::TemperatureGradient::CelsiusPerMillimetre>{value};
+}
+
+/// \brief Degree Celsius per millimetre (°C/mm) temperature gradient literal. For example,
+/// 2_degC_per_mm.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TemperatureGradient::CelsiusPerMillimetre>
+operator""_degC_per_mm(const unsigned long long value) {
+  return ScalarLiteral<Unit::TemperatureGradient::CelsiusPerMillimetre>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Degree Rankine per foot (°R/ft) temperature gradient literal. For example,
+/// 1.5_degR_per_ft.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TemperatureGradient::RankinePerFoot>
+operator""_degR_per_ft(const long double value) {
+  return ScalarLiteral<Unit::TemperatureGradient::RankinePerFoot>{value};
+}
+
+/// \brief Degree Rankine per foot (°R/ft) temperature gradient literal. For example, 2_degR_per_ft.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TemperatureGradient::RankinePerFoot>
+operator""_degR_per_ft(const unsigned long long value) {
+  return ScalarLiteral<Unit::TemperatureGradient::RankinePerFoot>{static_cast<long double>(value)};
+}
+
+/// \brief Degree Rankine per inch (°R/in) temperature gradient literal. For example,
+/// 1.5_degR_per_in.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TemperatureGradient::RankinePerInch>
+operator""_degR_per_in(const long double value) {
+  return ScalarLiteral<Unit::TemperatureGradient::RankinePerInch>{value};
+}
+
+/// \brief Degree Rankine per inch (°R/in) temperature gradient literal. For example, 2_degR_per_in.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TemperatureGradient::RankinePerInch>
+operator""_degR_per_in(const unsigned long long value) {
+  return ScalarLiteral<Unit::TemperatureGradient::RankinePerInch>{static_cast<long double>(value)};
+}
+
+/// \brief Degree Fahrenheit per foot (°F/ft) temperature gradient literal. For example,
+/// 1.5_degF_per_ft.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TemperatureGradient::FahrenheitPerFoot>
+operator""_degF_per_ft(const long double value) {
+  return ScalarLiteral<Unit::TemperatureGradient::FahrenheitPerFoot>{value};
+}
+
+/// \brief Degree Fahrenheit per foot (°F/ft) temperature gradient literal. For example,
+/// 2_degF_per_ft.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TemperatureGradient::FahrenheitPerFoot>
+operator""_degF_per_ft(const unsigned long long value) {
+  return ScalarLiteral<Unit::TemperatureGradient::FahrenheitPerFoot>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Degree Fahrenheit per inch (°F/in) temperature gradient literal. For example,
+/// 1.5_degF_per_in.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TemperatureGradient::FahrenheitPerInch>
+operator""_degF_per_in(const long double value) {
+  return ScalarLiteral<Unit::TemperatureGradient::FahrenheitPerInch>{value};
+}
+
+/// \brief Degree Fahrenheit per inch (°F/in) temperature gradient literal. For example,
+/// 2_degF_per_in.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TemperatureGradient::FahrenheitPerInch>
+operator""_degF_per_in(const unsigned long long value) {
+  return ScalarLiteral<Unit::TemperatureGradient::FahrenheitPerInch>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Watt per metre per kelvin (W/m/K) thermal conductivity literal. For example,
+/// 1.5_W_per_m_per_K.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ThermalConductivity::WattPerMetrePerKelvin>
+operator""_W_per_m_per_K(const long double value) {
+  return ScalarLiteral<Unit::ThermalConductivity::WattPerMetrePerKelvin>{value};
+}
+
+/// \brief Watt per metre per kelvin (W/m/K) thermal conductivity literal. For example,
+/// 2_W_per_m_per_K.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ThermalConductivity::WattPerMetrePerKelvin>
+operator""_W_per_m_per_K(const unsigned long long value) {
+  return ScalarLiteral<Unit::ThermalConductivity::WattPerMetrePerKelvin>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Nanowatt per millimetre per kelvin (nW/mm/K) thermal conductivity literal. For example,
+/// 1.5_nW_per_mm_per_K.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin>
+operator""_nW_per_mm_per_K(const long double value) {
+  return ScalarLiteral<Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin>{value};
+}
+
+/// \brief Nanowatt per millimetre per kelvin (nW/mm/K) thermal conductivity literal. For example,
+/// 2_nW_per_mm_per_K.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin>
+operator""_nW_per_mm_per_K(const unsigned long long value) {
+  return ScalarLiteral<Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Pound per second per degree Rankine (lbf/s/°R) thermal conductivity literal. For example,
+/// 1.5_lbf_per_s_per_degR.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ThermalConductivity::PoundPerSecondPerRankine>
+operator""_lbf_per_s_per_degR(const long double value) {
+  return ScalarLiteral<Unit::ThermalConductivity::PoundPerSecondPerRankine>{value};
+}
+
+/// \brief Pound per second per degree Rankine (lbf/s/°R) thermal conductivity literal. For example,
+/// 2_lbf_per_s_per_degR.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ThermalConductivity::PoundPerSecondPerRankine>
+operator""_lbf_per_s_per_degR(const unsigned long long value) {
+  return ScalarLiteral<Unit::ThermalConductivity::PoundPerSecondPerRankine>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Per kelvin (/K) thermal expansion literal. For example, 1.5_per_K.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ThermalExpansion::PerKelvin> operator""_per_K(
+    const long double value) {
+  return ScalarLiteral<Unit::ThermalExpansion::PerKelvin>{value};
+}
+
+/// \brief Per kelvin (/K) thermal expansion literal. For example, 2_per_K.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ThermalExpansion::PerKelvin> operator""_per_K(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ThermalExpansion::PerKelvin>{static_cast<long double>(value)};
+}
+
+/// \brief Per degree Celsius (/°C) thermal expansion literal. For example, 1.5_per_degC.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ThermalExpansion::PerCelsius> operator""_per_degC(
+    const long double value) {
+  return ScalarLiteral<Unit::ThermalExpansion::PerCelsius>{value};
+}
+
+/// \brief Per degree Celsius (/°C) thermal expansion literal. For example, 2_per_degC.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ThermalExpansion::PerCelsius> operator""_per_degC(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ThermalExpansion::PerCelsius>{static_cast<long double>(value)};
+}
+
+/// \brief Per degree Rankine (/°R) thermal expansion literal. For example, 1.5_per_degR.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ThermalExpansion::PerRankine> operator""_per_degR(
+    const long double value) {
+  return ScalarLiteral<Unit::ThermalExpansion::PerRankine>{value};
+}
+
+/// \brief Per degree Rankine (/°R) thermal expansion literal. For example, 2_per_degR.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ThermalExpansion::PerRankine> operator""_per_degR(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ThermalExpansion::PerRankine>{static_cast<long double>(value)};
+}
+
+/// \brief Per degree Fahrenheit (/°F) thermal expansion literal. For example, 1.5_per_degF.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ThermalExpansion::PerFahrenheit> operator""_per_degF(
+    const long double value) {
+  return ScalarLiteral<Unit::ThermalExpansion::PerFahrenheit>{value};
+}
+
+/// \brief Per degree Fahrenheit (/°F) thermal expansion literal. For example, 2_per_degF.
+[[nodiscard]] constexpr ScalarLiteral<Unit::ThermalExpansion::PerFahrenheit> operator""_per_degF(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::ThermalExpansion::PerFahrenheit>{static_cast<long double>(value)};
+}
+
+/// \brief Nanosecond (ns) time literal. For example, 1.5_ns.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Time::Nanosecond> operator""_ns(
+    const long double value) {
+  return ScalarLiteral<Unit::Time::Nanosecond>{value};
+}
+
+/// \brief Nanosecond (ns) time literal. For example, 2_ns.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Time::Nanosecond> operator""_ns(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Time::Nanosecond>{static_cast<long double>(value)};
+}
+
+/// \brief Microsecond (μs) time literal. For example, 1.5_us.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Time::Microsecond> operator""_us(
+    const long double value) {
+  return ScalarLiteral<Unit::Time::Microsecond>{value};
+}
+
+/// \brief Microsecond (μs) time literal. For example, 2_us.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Time::Microsecond> operator""_us(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Time::Microsecond>{static_cast<long double>(value)};
+}
+
+/// \brief Millisecond (ms) time literal. For example, 1.5_ms.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Time::Millisecond> operator""_ms(
+    const long double value) {
+  return ScalarLiteral<Unit::Time::Millisecond>{value};
+}
+
+/// \brief Millisecond (ms) time literal. For example, 2_ms.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Time::Millisecond> operator""_ms(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Time::Millisecond>{static_cast<long double>(value)};
+}
+
+/// \brief Second (s) time literal. For example, 1.5_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Time::Second> operator""_s(const long double value) {
+  return ScalarLiteral<Unit::Time::Second>{value};
+}
+
+/// \brief Second (s) time literal. For example, 2_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Time::Second> operator""_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Time::Second>{static_cast<long double>(value)};
+}
+
+/// \brief Minute (min) time literal. For example, 1.5_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Time::Minute> operator""_min(const long double value) {
+  return ScalarLiteral<Unit::Time::Minute>{value};
+}
+
+/// \brief Minute (min) time literal. For example, 2_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Time::Minute> operator""_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Time::Minute>{static_cast<long double>(value)};
+}
+
+/// \brief Hour (hr) time literal. For example, 1.5_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Time::Hour> operator""_hr(const long double value) {
+  return ScalarLiteral<Unit::Time::Hour>{value};
+}
+
+/// \brief Hour (hr) time literal. For example, 2_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Time::Hour> operator""_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Time::Hour>{static_cast<long double>(value)};
+}
+
+/// \brief Joule per mile (J/mi) transport energy consumption literal. For example, 1.5_J_per_mi.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::JoulePerMile>
+operator""_J_per_mi(const long double value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::JoulePerMile>{value};
+}
+
+/// \brief Joule per mile (J/mi) transport energy consumption literal. For example, 2_J_per_mi.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::JoulePerMile>
+operator""_J_per_mi(const unsigned long long value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::JoulePerMile>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Joule per kilometre (J/km) transport energy consumption literal. For example,
+/// 1.5_J_per_km.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::JoulePerKilometre>
+operator""_J_per_km(const long double value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::JoulePerKilometre>{value};
+}
+
+/// \brief Joule per kilometre (J/km) transport energy consumption literal. For example, 2_J_per_km.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::JoulePerKilometre>
+operator""_J_per_km(const unsigned long long value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::JoulePerKilometre>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Joule per metre (J/m) transport energy consumption literal. For example, 1.5_J_per_m.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::JoulePerMetre>
+operator""_J_per_m(const long double value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::JoulePerMetre>{value};
+}
+
+/// \brief Joule per metre (J/m) transport energy consumption literal. For example, 2_J_per_m.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::JoulePerMetre>
+operator""_J_per_m(const unsigned long long value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::JoulePerMetre>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Nanojoule per millimetre (nJ/mm) transport energy consumption literal. For example,
+/// 1.5_nJ_per_mm.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::NanojoulePerMillimetre>
+operator""_nJ_per_mm(const long double value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::NanojoulePerMillimetre>{value};
+}
+
+/// \brief Nanojoule per millimetre (nJ/mm) transport energy consumption literal. For example,
+/// 2_nJ_per_mm.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::NanojoulePerMillimetre>
+operator""_nJ_per_mm(const unsigned long long value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::NanojoulePerMillimetre>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Kilojoule per mile (kJ/mi) transport energy consumption literal. For example,
+/// 1.5_kJ_per_mi.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::KilojoulePerMile>
+operator""_kJ_per_mi(const long double value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::KilojoulePerMile>{value};
+}
+
+/// \brief Kilojoule per mile (kJ/mi) transport energy consumption literal. For example,
+/// 2_kJ_per_mi.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::KilojoulePerMile>
+operator""_kJ_per_mi(const unsigned long long value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::KilojoulePerMile>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Watt-minute per mile (W·min/mi) transport energy consumption literal. For example,
+/// 1.5_W_min_per_mi.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::WattMinutePerMile>
+operator""_W_min_per_mi(const long double value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::WattMinutePerMile>{value};
+}
+
+/// \brief Watt-minute per mile (W·min/mi) transport energy consumption literal. For example,
+/// 2_W_min_per_mi.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::WattMinutePerMile>
+operator""_W_min_per_mi(const unsigned long long value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::WattMinutePerMile>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Watt-hour per mile (W·hr/mi) transport energy consumption literal. For example,
+/// 1.5_W_hr_per_mi.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::WattHourPerMile>
+operator""_W_hr_per_mi(const long double value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::WattHourPerMile>{value};
+}
+
+/// \brief Watt-hour per mile (W·hr/mi) transport energy consumption literal. For example,
+/// 2_W_hr_per_mi.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::WattHourPerMile>
+operator""_W_hr_per_mi(const unsigned long long value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::WattHourPerMile>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Watt-minute per kilometre (W·min/km) transport energy consumption literal. For example,
+/// 1.5_W_min_per_km.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::WattMinutePerKilometre>
+operator""_W_min_per_km(const long double value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::WattMinutePerKilometre>{value};
+}
+
+/// \brief Watt-minute per kilometre (W·min/km) transport energy consumption literal. For example,
+/// 2_W_min_per_km.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::WattMinutePerKilometre>
+operator""_W_min_per_km(const unsigned long long value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::WattMinutePerKilometre>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Watt-hour per kilometre (W·hr/km) transport energy consumption literal. For example,
+/// 1.5_W_hr_per_km.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::WattHourPerKilometre>
+operator""_W_hr_per_km(const long double value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::WattHourPerKilometre>{value};
+}
+
+/// \brief Watt-hour per kilometre (W·hr/km) transport energy consumption literal. For example,
+/// 2_W_hr_per_km.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::WattHourPerKilometre>
+operator""_W_hr_per_km(const unsigned long long value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::WattHourPerKilometre>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Watt-minute per metre (W·min/m) transport energy consumption literal. For example,
+/// 1.5_W_min_per_m.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::WattMinutePerMetre>
+operator""_W_min_per_m(const long double value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::WattMinutePerMetre>{value};
+}
+
+/// \brief Watt-minute per metre (W·min/m) transport energy consumption literal. For example,
+/// 2_W_min_per_m.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::WattMinutePerMetre>
+operator""_W_min_per_m(const unsigned long long value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::WattMinutePerMetre>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Watt-hour per metre (W·hr/m) transport energy consumption literal. For example,
+/// 1.5_W_hr_per_m.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::WattHourPerMetre>
+operator""_W_hr_per_m(const long double value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::WattHourPerMetre>{value};
+}
+
+/// \brief Watt-hour per metre (W·hr/m) transport energy consumption literal. For example,
+/// 2_W_hr_per_m.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::WattHourPerMetre>
+operator""_W_hr_per_m(const unsigned long long value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::WattHourPerMetre>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Kilowatt-minute per mile (kW·min/mi) transport energy consumption literal. For example,
+/// 1.5_kW_min_per_mi.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::KilowattMinutePerMile>
+operator""_kW_min_per_mi(const long double value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::KilowattMinutePerMile>{value};
+}
+
+/// \brief Kilowatt-minute per mile (kW·min/mi) transport energy consumption literal. For example,
+/// 2_kW_min_per_mi.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::KilowattMinutePerMile>
+operator""_kW_min_per_mi(const unsigned long long value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::KilowattMinutePerMile>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Kilowatt-hour per mile (kW·hr/mi) transport energy consumption literal. For example,
+/// 1.5_kW_hr_per_mi.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::KilowattHourPerMile>
+operator""_kW_hr_per_mi(const long double value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::KilowattHourPerMile>{value};
+}
+
+/// \brief Kilowatt-hour per mile (kW·hr/mi) transport energy consumption literal. For example,
+/// 2_kW_hr_per_mi.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::KilowattHourPerMile>
+operator""_kW_hr_per_mi(const unsigned long long value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::KilowattHourPerMile>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Kilowatt-minute per kilometre (kW·min/km) transport energy consumption literal. For
+/// example, 1.5_kW_min_per_km.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::KilowattMinutePerKilometre>
+operator""_kW_min_per_km(const long double value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::KilowattMinutePerKilometre>{value};
+}
+
+/// \brief Kilowatt-minute per kilometre (kW·min/km) transport energy consumption literal. For
+/// example, 2_kW_min_per_km.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::KilowattMinutePerKilometre>
+operator""_kW_min_per_km(const unsigned long long value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::KilowattMinutePerKilometre>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Kilowatt-hour per kilometre (kW·hr/km) transport energy consumption literal. For example,
+/// 1.5_kW_hr_per_km.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::KilowattHourPerKilometre>
+operator""_kW_hr_per_km(const long double value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::KilowattHourPerKilometre>{value};
+}
+
+/// \brief Kilowatt-hour per kilometre (kW·hr/km) transport energy consumption literal. For example,
+/// 2_kW_hr_per_km.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::KilowattHourPerKilometre>
+operator""_kW_hr_per_km(const unsigned long long value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::KilowattHourPerKilometre>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Kilowatt-minute per metre (kW·min/m) transport energy consumption literal. For example,
+/// 1.5_kW_min_per_m.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::KilowattMinutePerMetre>
+operator""_kW_min_per_m(const long double value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::KilowattMinutePerMetre>{value};
+}
+
+/// \brief Kilowatt-minute per metre (kW·min/m) transport energy consumption literal. For example,
+/// 2_kW_min_per_m.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::KilowattMinutePerMetre>
+operator""_kW_min_per_m(const unsigned long long value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::KilowattMinutePerMetre>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Kilowatt-hour per metre (kW·hr/m) transport energy consumption literal. For example,
+/// 1.5_kW_hr_per_m.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::KilowattHourPerMetre>
+operator""_kW_hr_per_m(const long double value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::KilowattHourPerMetre>{value};
+}
+
+/// \brief Kilowatt-hour per metre (kW·hr/m) transport energy consumption literal. For example,
+/// 2_kW_hr_per_m.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::KilowattHourPerMetre>
+operator""_kW_hr_per_m(const unsigned long long value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::KilowattHourPerMetre>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Foot-pound per foot (ft·lbf/ft) transport energy consumption literal. For example,
+/// 1.5_ft_lbf_per_ft.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::FootPoundPerFoot>
+operator""_ft_lbf_per_ft(const long double value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::FootPoundPerFoot>{value};
+}
+
+/// \brief Foot-pound per foot (ft·lbf/ft) transport energy consumption literal. For example,
+/// 2_ft_lbf_per_ft.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::FootPoundPerFoot>
+operator""_ft_lbf_per_ft(const unsigned long long value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::FootPoundPerFoot>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Inch-pound per inch (in·lbf/in) transport energy consumption literal. For example,
+/// 1.5_in_lbf_per_in.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::InchPoundPerInch>
+operator""_in_lbf_per_in(const long double value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::InchPoundPerInch>{value};
+}
+
+/// \brief Inch-pound per inch (in·lbf/in) transport energy consumption literal. For example,
+/// 2_in_lbf_per_in.
+[[nodiscard]] constexpr ScalarLiteral<Unit::TransportEnergyConsumption::InchPoundPerInch>
+operator""_in_lbf_per_in(const unsigned long long value) {
+  return ScalarLiteral<Unit::TransportEnergyConsumption::InchPoundPerInch>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Cubic nautical mile (nmi^3) volume literal. For example, 1.5_nmi3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicNauticalMile> operator""_nmi3(
+    const long double value) {
+  return ScalarLiteral<Unit::Volume::CubicNauticalMile>{value};
+}
+
+/// \brief Cubic nautical mile (nmi^3) volume literal. For example, 2_nmi3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicNauticalMile> operator""_nmi3(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Volume::CubicNauticalMile>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic mile (mi^3) volume literal. For example, 1.5_mi3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicMile> operator""_mi3(
+    const long double value) {
+  return ScalarLiteral<Unit::Volume::CubicMile>{value};
+}
+
+/// \brief Cubic mile (mi^3) volume literal. For example, 2_mi3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicMile> operator""_mi3(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Volume::CubicMile>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic kilometre (km^3) volume literal. For example, 1.5_km3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicKilometre> operator""_km3(
+    const long double value) {
+  return ScalarLiteral<Unit::Volume::CubicKilometre>{value};
+}
+
+/// \brief Cubic kilometre (km^3) volume literal. For example, 2_km3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicKilometre> operator""_km3(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Volume::CubicKilometre>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic metre (m^3) volume literal. For example, 1.5_m3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicMetre> operator""_m3(
+    const long double value) {
+  return ScalarLiteral<Unit::Volume::CubicMetre>{value};
+}
+
+/// \brief Cubic metre (m^3) volume literal. For example, 2_m3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicMetre> operator""_m3(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Volume::CubicMetre>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic yard (yd^3) volume literal. For example, 1.5_yd3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicYard> operator""_yd3(
+    const long double value) {
+  return ScalarLiteral<Unit::Volume::CubicYard>{value};
+}
+
+/// \brief Cubic yard (yd^3) volume literal. For example, 2_yd3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicYard> operator""_yd3(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Volume::CubicYard>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic foot (ft^3) volume literal. For example, 1.5_ft3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicFoot> operator""_ft3(
+    const long double value) {
+  return ScalarLiteral<Unit::Volume::CubicFoot>{value};
+}
+
+/// \brief Cubic foot (ft^3) volume literal. For example, 2_ft3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicFoot> operator""_ft3(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Volume::CubicFoot>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic decimetre (dm^3) volume literal. For example, 1.5_dm3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicDecimetre> operator""_dm3(
+    const long double value) {
+  return ScalarLiteral<Unit::Volume::CubicDecimetre>{value};
+}
+
+/// \brief Cubic decimetre (dm^3) volume literal. For example, 2_dm3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicDecimetre> operator""_dm3(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Volume::CubicDecimetre>{static_cast<long double>(value)};
+}
+
+/// \brief Litre (L) volume literal. For example, 1.5_L.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::Litre> operator""_L(const long double value) {
+  return ScalarLiteral<Unit::Volume::Litre>{value};
+}
+
+/// \brief Litre (L) volume literal. For example, 2_L.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::Litre> operator""_L(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Volume::Litre>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic inch (in^3) volume literal. For example, 1.5_in3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicInch> operator""_in3(
+    const long double value) {
+  return ScalarLiteral<Unit::Volume::CubicInch>{value};
+}
+
+/// \brief Cubic inch (in^3) volume literal. For example, 2_in3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicInch> operator""_in3(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Volume::CubicInch>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic centimetre (cm^3) volume literal. For example, 1.5_cm3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicCentimetre> operator""_cm3(
+    const long double value) {
+  return ScalarLiteral<Unit::Volume::CubicCentimetre>{value};
+}
+
+/// \brief Cubic centimetre (cm^3) volume literal. For example, 2_cm3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicCentimetre> operator""_cm3(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Volume::CubicCentimetre>{static_cast<long double>(value)};
+}
+
+/// \brief Millilitre (mL) volume literal. For example, 1.5_mL.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::Millilitre> operator""_mL(
+    const long double value) {
+  return ScalarLiteral<Unit::Volume::Millilitre>{value};
+}
+
+/// \brief Millilitre (mL) volume literal. For example, 2_mL.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::Millilitre> operator""_mL(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Volume::Millilitre>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic millimetre (mm^3) volume literal. For example, 1.5_mm3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicMillimetre> operator""_mm3(
+    const long double value) {
+  return ScalarLiteral<Unit::Volume::CubicMillimetre>{value};
+}
+
+/// \brief Cubic millimetre (mm^3) volume literal. For example, 2_mm3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicMillimetre> operator""_mm3(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Volume::CubicMillimetre>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic milliinch (mil^3) volume literal. For example, 1.5_mil3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicMilliinch> operator""_mil3(
+    const long double value) {
+  return ScalarLiteral<Unit::Volume::CubicMilliinch>{value};
+}
+
+/// \brief Cubic milliinch (mil^3) volume literal. For example, 2_mil3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicMilliinch> operator""_mil3(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Volume::CubicMilliinch>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic micrometre (μm^3) volume literal. For example, 1.5_um3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicMicrometre> operator""_um3(
+    const long double value) {
+  return ScalarLiteral<Unit::Volume::CubicMicrometre>{value};
+}
+
+/// \brief Cubic micrometre (μm^3) volume literal. For example, 2_um3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicMicrometre> operator""_um3(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Volume::CubicMicrometre>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic microinch (μin^3) volume literal. For example, 1.5_uin3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicMicroinch> operator""_uin3(
+    const long double value) {
+  return ScalarLiteral<Unit::Volume::CubicMicroinch>{value};
+}
+
+/// \brief Cubic microinch (μin^3) volume literal. For example, 2_uin3.
+[[nodiscard]] constexpr ScalarLiteral<Unit::Volume::CubicMicroinch> operator""_uin3(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::Volume::CubicMicroinch>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic nautical mile per second (nmi^3/s) volume rate literal. For example,
+/// 1.5_nmi3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicNauticalMilePerSecond>
+operator""_nmi3_per_s(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicNauticalMilePerSecond>{value};
+}
+
+/// \brief Cubic nautical mile per second (nmi^3/s) volume rate literal. For example, 2_nmi3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicNauticalMilePerSecond>
+operator""_nmi3_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicNauticalMilePerSecond>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Cubic mile per second (mi^3/s) volume rate literal. For example, 1.5_mi3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMilePerSecond> operator""_mi3_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMilePerSecond>{value};
+}
+
+/// \brief Cubic mile per second (mi^3/s) volume rate literal. For example, 2_mi3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMilePerSecond> operator""_mi3_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMilePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic kilometre per second (km^3/s) volume rate literal. For example, 1.5_km3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicKilometrePerSecond>
+operator""_km3_per_s(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicKilometrePerSecond>{value};
+}
+
+/// \brief Cubic kilometre per second (km^3/s) volume rate literal. For example, 2_km3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicKilometrePerSecond>
+operator""_km3_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicKilometrePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic metre per second (m^3/s) volume rate literal. For example, 1.5_m3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMetrePerSecond> operator""_m3_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMetrePerSecond>{value};
+}
+
+/// \brief Cubic metre per second (m^3/s) volume rate literal. For example, 2_m3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMetrePerSecond> operator""_m3_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMetrePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic yard per second (yd^3/s) volume rate literal. For example, 1.5_yd3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicYardPerSecond> operator""_yd3_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicYardPerSecond>{value};
+}
+
+/// \brief Cubic yard per second (yd^3/s) volume rate literal. For example, 2_yd3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicYardPerSecond> operator""_yd3_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicYardPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic foot per second (ft^3/s) volume rate literal. For example, 1.5_ft3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicFootPerSecond> operator""_ft3_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicFootPerSecond>{value};
+}
+
+/// \brief Cubic foot per second (ft^3/s) volume rate literal. For example, 2_ft3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicFootPerSecond> operator""_ft3_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicFootPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic decimetre per second (dm^3/s) volume rate literal. For example, 1.5_dm3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicDecimetrePerSecond>
+operator""_dm3_per_s(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicDecimetrePerSecond>{value};
+}
+
+/// \brief Cubic decimetre per second (dm^3/s) volume rate literal. For example, 2_dm3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicDecimetrePerSecond>
+operator""_dm3_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicDecimetrePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Litre per second (L/s) volume rate literal. For example, 1.5_L_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::LitrePerSecond> operator""_L_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::LitrePerSecond>{value};
+}
+
+/// \brief Litre per second (L/s) volume rate literal. For example, 2_L_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::LitrePerSecond> operator""_L_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::LitrePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic inch per second (in^3/s) volume rate literal. For example, 1.5_in3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicInchPerSecond> operator""_in3_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicInchPerSecond>{value};
+}
+
+/// \brief Cubic inch per second (in^3/s) volume rate literal. For example, 2_in3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicInchPerSecond> operator""_in3_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicInchPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic centimetre per second (cm^3/s) volume rate literal. For example, 1.5_cm3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicCentimetrePerSecond>
+operator""_cm3_per_s(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicCentimetrePerSecond>{value};
+}
+
+/// \brief Cubic centimetre per second (cm^3/s) volume rate literal. For example, 2_cm3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicCentimetrePerSecond>
+operator""_cm3_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicCentimetrePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Millilitre per second (mL/s) volume rate literal. For example, 1.5_mL_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::MillilitrePerSecond> operator""_mL_per_s(
+    const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::MillilitrePerSecond>{value};
+}
+
+/// \brief Millilitre per second (mL/s) volume rate literal. For example, 2_mL_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::MillilitrePerSecond> operator""_mL_per_s(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::MillilitrePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic millimetre per second (mm^3/s) volume rate literal. For example, 1.5_mm3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMillimetrePerSecond>
+operator""_mm3_per_s(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMillimetrePerSecond>{value};
+}
+
+/// \brief Cubic millimetre per second (mm^3/s) volume rate literal. For example, 2_mm3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMillimetrePerSecond>
+operator""_mm3_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMillimetrePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic milliinch per second (mil^3/s) volume rate literal. For example, 1.5_mil3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMilliinchPerSecond>
+operator""_mil3_per_s(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMilliinchPerSecond>{value};
+}
+
+/// \brief Cubic milliinch per second (mil^3/s) volume rate literal. For example, 2_mil3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMilliinchPerSecond>
+operator""_mil3_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMilliinchPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic micrometre per second (μm^3/s) volume rate literal. For example, 1.5_um3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMicrometrePerSecond>
+operator""_um3_per_s(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMicrometrePerSecond>{value};
+}
+
+/// \brief Cubic micrometre per second (μm^3/s) volume rate literal. For example, 2_um3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMicrometrePerSecond>
+operator""_um3_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMicrometrePerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic microinch per second (μin^3/s) volume rate literal. For example, 1.5_uin3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMicroinchPerSecond>
+operator""_uin3_per_s(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMicroinchPerSecond>{value};
+}
+
+/// \brief Cubic microinch per second (μin^3/s) volume rate literal. For example, 2_uin3_per_s.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMicroinchPerSecond>
+operator""_uin3_per_s(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMicroinchPerSecond>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic nautical mile per minute (nmi^3/min) volume rate literal. For example,
+/// 1.5_nmi3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicNauticalMilePerMinute>
+operator""_nmi3_per_min(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicNauticalMilePerMinute>{value};
+}
+
+/// \brief Cubic nautical mile per minute (nmi^3/min) volume rate literal. For example,
+/// 2_nmi3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicNauticalMilePerMinute>
+operator""_nmi3_per_min(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicNauticalMilePerMinute>{
+      static_cast<long double>(value)};
+}
+
+/// \brief Cubic mile per minute (mi^3/min) volume rate literal. For example, 1.5_mi3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMilePerMinute> operator""_mi3_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMilePerMinute>{value};
+}
+
+/// \brief Cubic mile per minute (mi^3/min) volume rate literal. For example, 2_mi3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMilePerMinute> operator""_mi3_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMilePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic kilometre per minute (km^3/min) volume rate literal. For example, 1.5_km3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicKilometrePerMinute>
+operator""_km3_per_min(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicKilometrePerMinute>{value};
+}
+
+/// \brief Cubic kilometre per minute (km^3/min) volume rate literal. For example, 2_km3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicKilometrePerMinute>
+operator""_km3_per_min(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicKilometrePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic metre per minute (m^3/min) volume rate literal. For example, 1.5_m3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMetrePerMinute> operator""_m3_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMetrePerMinute>{value};
+}
+
+/// \brief Cubic metre per minute (m^3/min) volume rate literal. For example, 2_m3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMetrePerMinute> operator""_m3_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMetrePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic yard per minute (yd^3/min) volume rate literal. For example, 1.5_yd3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicYardPerMinute> operator""_yd3_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicYardPerMinute>{value};
+}
+
+/// \brief Cubic yard per minute (yd^3/min) volume rate literal. For example, 2_yd3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicYardPerMinute> operator""_yd3_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicYardPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic foot per minute (ft^3/min) volume rate literal. For example, 1.5_ft3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicFootPerMinute> operator""_ft3_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicFootPerMinute>{value};
+}
+
+/// \brief Cubic foot per minute (ft^3/min) volume rate literal. For example, 2_ft3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicFootPerMinute> operator""_ft3_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicFootPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic decimetre per minute (dm^3/min) volume rate literal. For example, 1.5_dm3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicDecimetrePerMinute>
+operator""_dm3_per_min(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicDecimetrePerMinute>{value};
+}
+
+/// \brief Cubic decimetre per minute (dm^3/min) volume rate literal. For example, 2_dm3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicDecimetrePerMinute>
+operator""_dm3_per_min(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicDecimetrePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Litre per minute (L/min) volume rate literal. For example, 1.5_L_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::LitrePerMinute> operator""_L_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::LitrePerMinute>{value};
+}
+
+/// \brief Litre per minute (L/min) volume rate literal. For example, 2_L_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::LitrePerMinute> operator""_L_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::LitrePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic inch per minute (in^3/min) volume rate literal. For example, 1.5_in3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicInchPerMinute> operator""_in3_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicInchPerMinute>{value};
+}
+
+/// \brief Cubic inch per minute (in^3/min) volume rate literal. For example, 2_in3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicInchPerMinute> operator""_in3_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicInchPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic centimetre per minute (cm^3/min) volume rate literal. For example, 1.5_cm3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicCentimetrePerMinute>
+operator""_cm3_per_min(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicCentimetrePerMinute>{value};
+}
+
+/// \brief Cubic centimetre per minute (cm^3/min) volume rate literal. For example, 2_cm3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicCentimetrePerMinute>
+operator""_cm3_per_min(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicCentimetrePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Millilitre per minute (mL/min) volume rate literal. For example, 1.5_mL_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::MillilitrePerMinute> operator""_mL_per_min(
+    const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::MillilitrePerMinute>{value};
+}
+
+/// \brief Millilitre per minute (mL/min) volume rate literal. For example, 2_mL_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::MillilitrePerMinute> operator""_mL_per_min(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::MillilitrePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic millimetre per minute (mm^3/min) volume rate literal. For example, 1.5_mm3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMillimetrePerMinute>
+operator""_mm3_per_min(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMillimetrePerMinute>{value};
+}
+
+/// \brief Cubic millimetre per minute (mm^3/min) volume rate literal. For example, 2_mm3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMillimetrePerMinute>
+operator""_mm3_per_min(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMillimetrePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic milliinch per minute (mil^3/min) volume rate literal. For example,
+/// 1.5_mil3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMilliinchPerMinute>
+operator""_mil3_per_min(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMilliinchPerMinute>{value};
+}
+
+/// \brief Cubic milliinch per minute (mil^3/min) volume rate literal. For example, 2_mil3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMilliinchPerMinute>
+operator""_mil3_per_min(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMilliinchPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic micrometre per minute (μm^3/min) volume rate literal. For example, 1.5_um3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMicrometrePerMinute>
+operator""_um3_per_min(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMicrometrePerMinute>{value};
+}
+
+/// \brief Cubic micrometre per minute (μm^3/min) volume rate literal. For example, 2_um3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMicrometrePerMinute>
+operator""_um3_per_min(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMicrometrePerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic microinch per minute (μin^3/min) volume rate literal. For example,
+/// 1.5_uin3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMicroinchPerMinute>
+operator""_uin3_per_min(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMicroinchPerMinute>{value};
+}
+
+/// \brief Cubic microinch per minute (μin^3/min) volume rate literal. For example, 2_uin3_per_min.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMicroinchPerMinute>
+operator""_uin3_per_min(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMicroinchPerMinute>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic nautical mile per hour (nmi^3/hr) volume rate literal. For example,
+/// 1.5_nmi3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicNauticalMilePerHour>
+operator""_nmi3_per_hr(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicNauticalMilePerHour>{value};
+}
+
+/// \brief Cubic nautical mile per hour (nmi^3/hr) volume rate literal. For example, 2_nmi3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicNauticalMilePerHour>
+operator""_nmi3_per_hr(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicNauticalMilePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic mile per hour (mi^3/hr) volume rate literal. For example, 1.5_mi3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMilePerHour> operator""_mi3_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMilePerHour>{value};
+}
+
+/// \brief Cubic mile per hour (mi^3/hr) volume rate literal. For example, 2_mi3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMilePerHour> operator""_mi3_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMilePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic kilometre per hour (km^3/hr) volume rate literal. For example, 1.5_km3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicKilometrePerHour>
+operator""_km3_per_hr(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicKilometrePerHour>{value};
+}
+
+/// \brief Cubic kilometre per hour (km^3/hr) volume rate literal. For example, 2_km3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicKilometrePerHour>
+operator""_km3_per_hr(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicKilometrePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic metre per hour (m^3/hr) volume rate literal. For example, 1.5_m3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMetrePerHour> operator""_m3_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMetrePerHour>{value};
+}
+
+/// \brief Cubic metre per hour (m^3/hr) volume rate literal. For example, 2_m3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMetrePerHour> operator""_m3_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMetrePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic yard per hour (yd^3/hr) volume rate literal. For example, 1.5_yd3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicYardPerHour> operator""_yd3_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicYardPerHour>{value};
+}
+
+/// \brief Cubic yard per hour (yd^3/hr) volume rate literal. For example, 2_yd3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicYardPerHour> operator""_yd3_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicYardPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic foot per hour (ft^3/hr) volume rate literal. For example, 1.5_ft3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicFootPerHour> operator""_ft3_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicFootPerHour>{value};
+}
+
+/// \brief Cubic foot per hour (ft^3/hr) volume rate literal. For example, 2_ft3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicFootPerHour> operator""_ft3_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicFootPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic decimetre per hour (dm^3/hr) volume rate literal. For example, 1.5_dm3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicDecimetrePerHour>
+operator""_dm3_per_hr(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicDecimetrePerHour>{value};
+}
+
+/// \brief Cubic decimetre per hour (dm^3/hr) volume rate literal. For example, 2_dm3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicDecimetrePerHour>
+operator""_dm3_per_hr(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicDecimetrePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Litre per hour (L/hr) volume rate literal. For example, 1.5_L_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::LitrePerHour> operator""_L_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::LitrePerHour>{value};
+}
+
+/// \brief Litre per hour (L/hr) volume rate literal. For example, 2_L_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::LitrePerHour> operator""_L_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::LitrePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic inch per hour (in^3/hr) volume rate literal. For example, 1.5_in3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicInchPerHour> operator""_in3_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicInchPerHour>{value};
+}
+
+/// \brief Cubic inch per hour (in^3/hr) volume rate literal. For example, 2_in3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicInchPerHour> operator""_in3_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicInchPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic centimetre per hour (cm^3/hr) volume rate literal. For example, 1.5_cm3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicCentimetrePerHour>
+operator""_cm3_per_hr(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicCentimetrePerHour>{value};
+}
+
+/// \brief Cubic centimetre per hour (cm^3/hr) volume rate literal. For example, 2_cm3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicCentimetrePerHour>
+operator""_cm3_per_hr(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicCentimetrePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Millilitre per hour (mL/hr) volume rate literal. For example, 1.5_mL_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::MillilitrePerHour> operator""_mL_per_hr(
+    const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::MillilitrePerHour>{value};
+}
+
+/// \brief Millilitre per hour (mL/hr) volume rate literal. For example, 2_mL_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::MillilitrePerHour> operator""_mL_per_hr(
+    const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::MillilitrePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic millimetre per hour (mm^3/hr) volume rate literal. For example, 1.5_mm3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMillimetrePerHour>
+operator""_mm3_per_hr(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMillimetrePerHour>{value};
+}
+
+/// \brief Cubic millimetre per hour (mm^3/hr) volume rate literal. For example, 2_mm3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMillimetrePerHour>
+operator""_mm3_per_hr(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMillimetrePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic milliinch per hour (mil^3/hr) volume rate literal. For example, 1.5_mil3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMilliinchPerHour>
+operator""_mil3_per_hr(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMilliinchPerHour>{value};
+}
+
+/// \brief Cubic milliinch per hour (mil^3/hr) volume rate literal. For example, 2_mil3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMilliinchPerHour>
+operator""_mil3_per_hr(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMilliinchPerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic micrometre per hour (μm^3/hr) volume rate literal. For example, 1.5_um3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMicrometrePerHour>
+operator""_um3_per_hr(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMicrometrePerHour>{value};
+}
+
+/// \brief Cubic micrometre per hour (μm^3/hr) volume rate literal. For example, 2_um3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMicrometrePerHour>
+operator""_um3_per_hr(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMicrometrePerHour>{static_cast<long double>(value)};
+}
+
+/// \brief Cubic microinch per hour (μin^3/hr) volume rate literal. For example, 1.5_uin3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMicroinchPerHour>
+operator""_uin3_per_hr(const long double value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMicroinchPerHour>{value};
+}
+
+/// \brief Cubic microinch per hour (μin^3/hr) volume rate literal. For example, 2_uin3_per_hr.
+[[nodiscard]] constexpr ScalarLiteral<Unit::VolumeRate::CubicMicroinchPerHour>
+operator""_uin3_per_hr(const unsigned long long value) {
+  return ScalarLiteral<Unit::VolumeRate::CubicMicroinchPerHour>{static_cast<long double>(value)};
+}
+
+}  // namespace Literals
+
+}  // namespace PhQ
+
+#endif  // PHQ_LITERALS_HPP
@@ -0,0 +1,526 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_MAPPED_FIELD_HPP
+#define PHQ_MAPPED_FIELD_HPP
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if __has_include(<sys/mman.h>)
+  #include <fcntl.h>
+  #include <sys/mman.h>
+  #include <sys/stat.h>
+  #include <unistd.h>
+#endif
+
+#include "Binary.hpp"
+#include "ConversionPlan.hpp"
+#include "QuantityTraits.hpp"
+
+namespace PhQ {
+
+/// \brief Size in bytes of the header of a field file written by PhQ::WriteMappedField. The
+/// components of the physical quantities start at this offset, which is a multiple of the alignment
+/// of every numeric type, so that a memory-mapped field file can be accessed in place.
+inline constexpr std::size_t MappedFieldHeaderSize{64};
+
+/// \brief Errors that can occur when opening a field file with PhQ::MappedField.
+enum class MappedFieldError : int8_t {
+  /// \brief No error. The field file was opened successfully.
+  None,
+
+  /// \brief The field file could not be opened or read.
+  CannotOpenFile,
+
+  /// \brief The field file could not be mapped into memory.
+  CannotMapFile,
+
+  /// \brief The field file is shorter than its header.
+  TruncatedHeader,
+
+  /// \brief The field file does not start with the field file signature.
+  NotAFieldFile,
+
+  /// \brief The field file was written with a different version of the binary wire format.
+  UnsupportedVersion,
+
+  /// \brief The components of the field file have a different size than the numeric type of the
+  /// physical quantity.
+  NumericTypeMismatch,
+
+  /// \brief The field file has a different number of components per physical quantity than the
+  /// physical quantity.
+  ComponentCountMismatch,
+
+  /// \brief The unit of measure of the field file has a different physical dimension set than the
+  /// units of measure of the physical quantity.
+  DimensionsMismatch,
+
+  /// \brief The unit of measure of the field file is not a unit of measure of the physical
+  /// quantity's unit of measure type.
+  UnknownUnit,
+
+  /// \brief The size of the field file does not match the number of physical quantities stated in
+  /// its header.
+  PayloadSizeMismatch,
+};
+
+namespace Internal {
+
+/// \brief Signature at the start of every field file. Internal implementation detail not intended
+/// to be used outside of the PhQ::WriteMappedField function and the PhQ::MappedField class.
+inline constexpr std::array<char, 4> MappedFieldSignature{'P', 'h', 'Q', 'F'};
+
+/// \brief Offset in bytes of the binary message header within the header of a field file. Internal
+/// implementation detail not intended to be used outside of the PhQ::WriteMappedField function and
+/// the PhQ::MappedField class.
+inline constexpr std::size_t MappedFieldBinaryHeaderOffset{4};
+
+/// \brief Offset in bytes of the number of physical quantities within the header of a field file.
+/// Internal implementation detail not intended to be used outside of the PhQ::WriteMappedField
+/// function and the PhQ::MappedField class.
+inline constexpr std::size_t MappedFieldSizeOffset{16};
+
+/// \brief Returns the PhQ::MappedFieldError that corresponds to a given PhQ::BinaryError. Internal
+/// implementation detail not intended to be used outside of the PhQ::MappedField class.
+[[nodiscard]] inline constexpr MappedFieldError ToMappedFieldError(const BinaryError error) {
+  switch (error) {
+    case BinaryError::None:
+      return MappedFieldError::None;
+    case BinaryError::TruncatedHeader:
+      return MappedFieldError::TruncatedHeader;
+    case BinaryError::UnsupportedVersion:
+      return MappedFieldError::UnsupportedVersion;
+    case BinaryError::NumericTypeMismatch:
+      return MappedFieldError::NumericTypeMismatch;
+    case BinaryError::ComponentCountMismatch:
+      return MappedFieldError::ComponentCountMismatch;
+    case BinaryError::DimensionsMismatch:
+      return MappedFieldError::DimensionsMismatch;
+    case BinaryError::UnknownUnit:
+      return MappedFieldError::UnknownUnit;
+    case BinaryError::PayloadSizeMismatch:
+      return MappedFieldError::PayloadSizeMismatch;
+  }
+  return MappedFieldError::None;
+}
+
+}  // namespace Internal
+
+/// \brief Writes a contiguous sequence of a given number of physical quantities to a field file at
+/// a given path, which can then be opened without copying with PhQ::MappedField. A field file
+/// consists of a header of PhQ::MappedFieldHeaderSize bytes followed by the components of the
+/// physical quantities, stored contiguously as little-endian floating-point numbers. The header
+/// holds:
+/// - Bytes 0 to 3: the field file signature "PhQF".
+/// - Bytes 4 to 10: the header of the binary wire format, which states the version, the numeric
+///   type, the number of components per physical quantity, the unit of measure, and the physical
+///   dimension set. See PhQ::BinaryHeader.
+/// - Bytes 16 to 23: the number of physical quantities, as a little-endian 64-bit unsigned integer.
+/// - All other bytes are zero.
+///
+/// The components are expressed in a given unit of measure, which defaults to the standard unit of
+/// measure. Fields in the standard unit of measure can be accessed in place when mapped, whereas
+/// fields in other units of measure are converted as they are accessed. Returns
+/// PhQ::MappedFieldError::None if successful, or PhQ::MappedFieldError::CannotOpenFile if the file
+/// could not be written.
+/// \tparam Quantity Type of the physical quantities, such as PhQ::Stress<double>. This must be
+/// derived from PhQ::DimensionalScalar, PhQ::DimensionalPlanarVector, PhQ::DimensionalVector,
+/// PhQ::DimensionalSymmetricDyad, or PhQ::DimensionalDyad.
+template <typename Quantity>
+MappedFieldError WriteMappedField(
+    const std::string& path, const Quantity* const quantities, const std::size_t size,
+    const typename Internal::QuantityTraitsOf<Quantity>::UnitType unit =
+        Standard<typename Internal::QuantityTraitsOf<Quantity>::UnitType>) {
+  std::array<std::byte, MappedFieldHeaderSize> header{};
+  std::memcpy(
+      header.data(), Internal::MappedFieldSignature.data(), Internal::MappedFieldSignature.size());
+  Internal::MakeBinaryHeader<Quantity>(unit).Write(
+      header.data() + Internal::MappedFieldBinaryHeaderOffset);
+  const std::uint64_t size_64{size};
+  Internal::StoreLittleEndian(&size_64, 1, header.data() + Internal::MappedFieldSizeOffset);
+
+  std::ofstream file{path, std::ios::binary | std::ios::trunc};
+  file.write(reinterpret_cast<const char*>(header.data()), header.size());
+
+  // Write the components in blocks so that large fields need no full-size intermediate buffer.
+  constexpr std::size_t block_size{4096};
+  constexpr std::size_t element_size{BinarySize<Quantity>(1) - BinaryHeaderSize};
+  std::vector<std::byte> block(std::min(size, block_size) * element_size);
+  for (std::size_t begin = 0; begin < size && file; begin += block_size) {
+    const std::size_t length{std::min(block_size, size - begin)};
+    Internal::EncodeBinaryPayload(quantities + begin, length, block.data(), unit);
+    file.write(reinterpret_cast<const char*>(block.data()),
+               static_cast<std::streamsize>(length * element_size));
+  }
+  file.close();
+  return file ? MappedFieldError::None : MappedFieldError::CannotOpenFile;
+}
+
+/// \brief Writes a vector of physical quantities to a field file at a given path. Otherwise, this
+/// function behaves like the overload that writes a contiguous sequence of physical quantities.
+/// \tparam Quantity Type of the physical quantities, such as PhQ::Stress<double>. This must be
+/// derived from PhQ::DimensionalScalar, PhQ::DimensionalPlanarVector, PhQ::DimensionalVector,
+/// PhQ::DimensionalSymmetricDyad, or PhQ::DimensionalDyad.
+template <typename Quantity>
+MappedFieldError WriteMappedField(
+    const std::string& path, const std::vector<Quantity>& quantities,
+    const typename Internal::QuantityTraitsOf<Quantity>::UnitType unit =
+        Standard<typename Internal::QuantityTraitsOf<Quantity>::UnitType>) {
+  return WriteMappedField(path, quantities.data(), quantities.size(), unit);
+}
+
+/// \brief Read-only view of a field file of physical quantities written by PhQ::WriteMappedField.
+/// On POSIX platforms, the file is mapped into memory rather than read, so opening a field file
+/// costs the same regardless of its size and its pages are only loaded as they are accessed. On
+/// other platforms, the file is read into memory once when opened. When the field file is in the
+/// standard unit of measure and the platform is little-endian, the physical quantities are accessed
+/// in place without copying and Data() points to them directly. Otherwise, each physical quantity
+/// is converted to the standard unit of measure as it is accessed, and Read() converts whole blocks
+/// of physical quantities at once. The field file is unmapped when this view is destroyed.
+/// \tparam Quantity Type of the physical quantities, such as PhQ::Stress<double>. This must be
+/// derived from PhQ::DimensionalScalar, PhQ::DimensionalPlanarVector, PhQ::DimensionalVector,
+/// PhQ::DimensionalSymmetricDyad, or PhQ::DimensionalDyad.
+template <typename Quantity>
+class MappedField {
+  using Traits = Internal::QuantityTraitsOf<Quantity>;
+
+  using UnitType = typename Traits::UnitType;
+
+  using NumericType = typename Traits::NumericType;
+
+  static_assert(MappedFieldHeaderSize % alignof(Quantity) == 0,
+                "The components of a field file must be aligned for the physical quantity.");
+
+public:
+  /// \brief Iterator over the physical quantities of a field file. Dereferencing it returns a
+  /// physical quantity in the standard unit of measure by value.
+  class Iterator {
+  public:
+    using iterator_category = std::input_iterator_tag;
+
+    using value_type = Quantity;
+
+    using difference_type = std::ptrdiff_t;
+
+    using pointer = void;
+
+    using reference = Quantity;
+
+    Iterator() = default;
+
+    Quantity operator*() const {
+      return (*field_)[index_];
+    }
+
+    Iterator& operator++() noexcept {
+      ++index_;
+      return *this;
+    }
+
+    Iterator operator++(int) noexcept {
+      Iterator copy{*this};
+      ++index_;
+      return copy;
+    }
+
+    bool operator==(const Iterator& other) const noexcept {
+      return index_ == other.index_;
+    }
+
+    bool operator!=(const Iterator& other) const noexcept {
+      return index_ != other.index_;
+    }
+
+  private:
+    Iterator(const MappedField* const field, const std::size_t index) noexcept
+      : field_(field), index_(index) {}
+
+    const MappedField* field_{nullptr};
+
+    std::size_t index_{0};
+
+    friend class MappedField;
+  };
+
+  /// \brief Opens the field file at a given path. Check Error() or Good() to determine whether the
+  /// field file was opened successfully. If not, this view is empty.
+  explicit MappedField(const std::string& path) {
+    Open(path);
+  }
+
+  /// \brief Destructor. Unmaps the field file.
+  ~MappedField() noexcept {
+    Close();
+  }
+
+  /// \brief Copy constructor. Deleted because this view owns its mapping.
+  MappedField(const MappedField& other) = delete;
+
+  /// \brief Copy assignment operator. Deleted because this view owns its mapping.
+  MappedField& operator=(const MappedField& other) = delete;
+
+  /// \brief Move constructor. Transfers the mapping of another view to this one.
+  MappedField(MappedField&& other) noexcept
+    : error_(other.error_), unit_(other.unit_), size_(other.size_), direct_(other.direct_),
+      plan_(other.plan_), mapping_(other.mapping_), mapping_size_(other.mapping_size_),
+      buffer_(std::move(other.buffer_)), components_(other.components_) {
+    other.Reset();
+  }
+
+  /// \brief Move assignment operator. Unmaps the field file of this view and transfers the mapping
+  /// of another view to this one.
+  MappedField& operator=(MappedField&& other) noexcept {
+    if (this != &other) {
+      Close();
+      error_ = other.error_;
+      unit_ = other.unit_;
+      size_ = other.size_;
+      direct_ = other.direct_;
+      plan_ = other.plan_;
+      mapping_ = other.mapping_;
+      mapping_size_ = other.mapping_size_;
+      buffer_ = std::move(other.buffer_);
+      components_ = other.components_;
+      other.Reset();
+    }
+    return *this;
+  }
+
+  /// \brief Returns the error that occurred when opening the field file, if any.
+  [[nodiscard]] MappedFieldError Error() const noexcept {
+    return error_;
+  }
+
+  /// \brief Returns whether the field file was opened successfully.
+  [[nodiscard]] bool Good() const noexcept {
+    return error_ == MappedFieldError::None;
+  }
+
+  /// \brief Returns the unit of measure in which the components are stored in the field file.
+  [[nodiscard]] UnitType Unit() const noexcept {
+    return unit_;
+  }
+
+  /// \brief Returns the number of physical quantities in the field file.
+  [[nodiscard]] std::size_t Size() const noexcept {
+    return size_;
+  }
+
+  /// \brief Returns whether the field file holds no physical quantities.
+  [[nodiscard]] bool Empty() const noexcept {
+    return size_ == 0;
+  }
+
+  /// \brief Returns whether the physical quantities are accessed in place without conversion, which
+  /// is the case when the field file is in the standard unit of measure and the platform is
+  /// little-endian.
+  [[nodiscard]] bool IsDirect() const noexcept {
+    return direct_;
+  }
+
+  /// \brief Returns a pointer to the physical quantities of the field file if they are accessed in
+  /// place, or a null pointer otherwise.
+  [[nodiscard]] const Quantity* Data() const noexcept {
+    return direct_ ? reinterpret_cast<const Quantity*>(components_) : nullptr;
+  }
+
+  /// \brief Returns the physical quantity at a given index, expressed in the standard unit of
+  /// measure. The index must be less than Size().
+  [[nodiscard]] Quantity operator[](const std::size_t index) const {
+    if (direct_) {
+      return reinterpret_cast<const Quantity*>(components_)[index];
+    }
+    Quantity quantity{Quantity::Zero()};
+    NumericType* const components{Internal::QuantityComponents<Quantity, NumericType>(&quantity)};
+    Internal::LoadLittleEndian(
+        components_ + index * sizeof(Quantity), Traits::ComponentCount, components);
+    plan_.Apply(components, Traits::ComponentCount);
+    return quantity;
+  }
+
+  /// \brief Copies a given number of physical quantities starting at a given index into a
+  /// caller-provided contiguous sequence of physical quantities, expressed in the standard unit of
+  /// measure. The range must lie within the field file. This converts all components at once and
+  /// is the fastest way to access a field file that is not in the standard unit of measure.
+  void Read(const std::size_t first, const std::size_t size, Quantity* const output) const {
+    NumericType* const components{Internal::QuantityComponents<Quantity, NumericType>(output)};
+    Internal::LoadLittleEndian(
+        components_ + first * sizeof(Quantity), size * Traits::ComponentCount, components);
+    plan_.Apply(components, size * Traits::ComponentCount);
+  }
+
+  /// \brief Returns an iterator to the first physical quantity of the field file.
+  [[nodiscard]] Iterator begin() const noexcept {
+    return Iterator{this, 0};
+  }
+
+  /// \brief Returns an iterator past the last physical quantity of the field file.
+  [[nodiscard]] Iterator end() const noexcept {
+    return Iterator{this, size_};
+  }
+
+private:
+  // Maps or reads the field file at the given path and validates its header.
+  void Open(const std::string& path) {
+#if __has_include(<sys/mman.h>)
+    const int file_descriptor{::open(path.c_str(), O_RDONLY)};
+    if (file_descriptor < 0) {
+      error_ = MappedFieldError::CannotOpenFile;
+      return;
+    }
+    struct stat status;
+    if (::fstat(file_descriptor, &status) != 0) {
+      ::close(file_descriptor);
+      error_ = MappedFieldError::CannotOpenFile;
+      return;
+    }
+    const std::size_t file_size{static_cast<std::size_t>(status.st_size)};
+    const std::byte* data{nullptr};
+    if (file_size > 0) {
+      void* const mapping{::mmap(nullptr, file_size, PROT_READ, MAP_PRIVATE, file_descriptor, 0)};
+      if (mapping == MAP_FAILED) {
+        ::close(file_descriptor);
+        error_ = MappedFieldError::CannotMapFile;
+        return;
+      }
+      mapping_ = mapping;
+      mapping_size_ = file_size;
+      data = static_cast<const std::byte*>(mapping);
+    }
+    // The mapping remains valid after its file descriptor is closed.
+    ::close(file_descriptor);
+#else
+    std::ifstream file{path, std::ios::binary | std::ios::ate};
+    if (!file) {
+      error_ = MappedFieldError::CannotOpenFile;
+      return;
+    }
+    const std::size_t file_size{static_cast<std::size_t>(file.tellg())};
+    // Operator new aligns the buffer for any numeric type.
+    buffer_ = std::make_unique<std::byte[]>(file_size);
+    file.seekg(0);
+    if (!file.read(reinterpret_cast<char*>(buffer_.get()), file_size)) {
+      buffer_.reset();
+      error_ = MappedFieldError::CannotOpenFile;
+      return;
+    }
+    const std::byte* const data{buffer_.get()};
+#endif  // __has_include(<sys/mman.h>)
+
+    error_ = Validate(data, file_size);
+    if (error_ != MappedFieldError::None) {
+      Close();
+      return;
+    }
+    components_ = data + MappedFieldHeaderSize;
+  }
+
+  // Validates the header of a field file of a given size in bytes and sets the unit of measure, the
+  // number of physical quantities, and the conversion plan of this view.
+  MappedFieldError Validate(const std::byte* const data, const std::size_t file_size) noexcept {
+    if (file_size < MappedFieldHeaderSize) {
+      return MappedFieldError::TruncatedHeader;
+    }
+    if (std::memcmp(data, Internal::MappedFieldSignature.data(),
+                    Internal::MappedFieldSignature.size())
+        != 0) {
+      return MappedFieldError::NotAFieldFile;
+    }
+    const BinaryHeader header{BinaryHeader::Read(data + Internal::MappedFieldBinaryHeaderOffset)};
+    const MappedFieldError error{
+        Internal::ToMappedFieldError(Internal::ValidateBinaryHeader<Quantity>(header))};
+    if (error != MappedFieldError::None) {
+      return error;
+    }
+    std::uint64_t size_64{0};
+    Internal::LoadLittleEndian(data + Internal::MappedFieldSizeOffset, 1, &size_64);
+    if ((file_size - MappedFieldHeaderSize) / sizeof(Quantity) != size_64
+        || (file_size - MappedFieldHeaderSize) % sizeof(Quantity) != 0) {
+      return MappedFieldError::PayloadSizeMismatch;
+    }
+    unit_ = static_cast<UnitType>(header.unit);
+    size_ = static_cast<std::size_t>(size_64);
+    plan_ = ConversionPlan<UnitType, NumericType>{unit_, Standard<UnitType>};
+    direct_ = plan_.IsIdentity() && Internal::IsLittleEndian;
+    return MappedFieldError::None;
+  }
+
+  // Unmaps or releases the field file, if any.
+  void Close() noexcept {
+#if __has_include(<sys/mman.h>)
+    if (mapping_ != nullptr) {
+      ::munmap(mapping_, mapping_size_);
+    }
+#endif  // __has_include(<sys/mman.h>)
+    const MappedFieldError error{error_};
+    Reset();
+    error_ = error;
+  }
+
+  // Resets this view to an empty view without releasing its field file.
+  void Reset() noexcept {
+    error_ = MappedFieldError::None;
+    unit_ = Standard<UnitType>;
+    size_ = 0;
+    direct_ = true;
+    plan_ = ConversionPlan<UnitType, NumericType>{Standard<UnitType>, Standard<UnitType>};
+    mapping_ = nullptr;
+    mapping_size_ = 0;
+    buffer_.reset();
+    components_ = nullptr;
+  }
+
+  MappedFieldError error_{MappedFieldError::None};
+
+  UnitType unit_{Standard<UnitType>};
+
+  std::size_t size_{0};
+
+  bool direct_{true};
+
+  ConversionPlan<UnitType, NumericType> plan_{Standard<UnitType>, Standard<UnitType>};
+
+  void* mapping_{nullptr};
+
+  std::size_t mapping_size_{0};
+
+  std::unique_ptr<std::byte[]> buffer_;
+
+  const std::byte* components_{nullptr};
+};
+
+}  // namespace PhQ
+
+#endif  // PHQ_MAPPED_FIELD_HPP
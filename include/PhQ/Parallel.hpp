@@ -0,0 +1,125 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_PARALLEL_HPP
+#define PHQ_PARALLEL_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+namespace PhQ {
+
+/// \brief Execution policy of bulk operations on long sequences of values, such as the
+/// PhQ::ConvertInPlace function. A sequential execution policy processes the sequence on the
+/// calling thread. A parallel execution policy splits the sequence into chunks that are processed
+/// concurrently by as many threads as the hardware supports.
+enum class ExecutionPolicy : int8_t {
+  /// \brief Process the sequence on the calling thread.
+  Sequential,
+
+  /// \brief Process the sequence concurrently on as many threads as the hardware supports.
+  Parallel,
+};
+
+namespace Internal {
+
+/// \brief Size in bytes of the chunks into which a sequence of values is split when it is processed
+/// in parallel. Each chunk fits in the level-2 cache of common processors. Internal implementation
+/// detail not intended to be used outside of the Physical Quantities library's bulk operations.
+inline constexpr const std::size_t ParallelChunkSizeInBytes{262144};
+
+/// \brief Minimum size in bytes of a sequence of values for it to be processed in parallel. Shorter
+/// sequences are processed on the calling thread because the cost of starting threads exceeds the
+/// time saved. Internal implementation detail not intended to be used outside of the Physical
+/// Quantities library's bulk operations.
+inline constexpr const std::size_t MinimumSizeInBytesForParallel{1048576};
+
+/// \brief Number of threads that the hardware can run concurrently, or one if this number cannot be
+/// determined. Internal implementation detail not intended to be used outside of the Physical
+/// Quantities library's bulk operations.
+[[nodiscard]] inline std::size_t HardwareThreadCount() noexcept {
+  const unsigned int count{std::thread::hardware_concurrency()};
+  return count > 0 ? static_cast<std::size_t>(count) : 1;
+}
+
+/// \brief Number of threads used by a given execution policy. Internal implementation detail not
+/// intended to be used outside of the Physical Quantities library's bulk operations.
+[[nodiscard]] inline std::size_t ThreadCount(const ExecutionPolicy policy) noexcept {
+  return policy == ExecutionPolicy::Parallel ? HardwareThreadCount() : 1;
+}
+
+/// \brief Calls a given function on every chunk of a sequence of values using up to a given number
+/// of threads, including the calling thread. The function is called as function(values, size) and
+/// must be safe to call concurrently on disjoint chunks. Chunks are handed out to threads on demand
+/// so that threads that finish early take on more work. If the sequence is too short, if only one
+/// thread is requested, or if no additional thread can be started, the calling thread processes
+/// the remaining chunks by itself. Internal implementation detail not intended to be used outside
+/// of the Physical Quantities library's bulk operations.
+template <typename NumericType, typename Function>
+inline void ParallelForEachChunk(NumericType* const values, const std::size_t size,
+                                 std::size_t thread_count, const Function& function) {
+  if (thread_count <= 1 || size * sizeof(NumericType) < MinimumSizeInBytesForParallel) {
+    function(values, size);
+    return;
+  }
+
+  const std::size_t chunk_size{
+      std::max<std::size_t>(ParallelChunkSizeInBytes / sizeof(NumericType), 1)};
+  const std::size_t chunk_count{(size + chunk_size - 1) / chunk_size};
+  thread_count = std::min(thread_count, chunk_count);
+
+  std::atomic<std::size_t> next_chunk{0};
+  const auto work = [&]() {
+    for (std::size_t chunk{next_chunk.fetch_add(1, std::memory_order_relaxed)};
+         chunk < chunk_count; chunk = next_chunk.fetch_add(1, std::memory_order_relaxed)) {
+      const std::size_t begin{chunk * chunk_size};
+      function(values + begin, std::min(chunk_size, size - begin));
+    }
+  };
+
+  std::vector<std::thread> threads;
+  threads.reserve(thread_count - 1);
+  for (std::size_t index = 1; index < thread_count; ++index) {
+    try {
+      threads.emplace_back(work);
+    } catch (const std::system_error&) {
+      break;
+    }
+  }
+  work();
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+}
+
+}  // namespace Internal
+
+}  // namespace PhQ
+
+#endif  // PHQ_PARALLEL_HPP
@@ -0,0 +1,452 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_PARSE_HPP
+#define PHQ_PARSE_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+#include <system_error>
+
+#include "Base.hpp"
+#include "QuantityTraits.hpp"
+
+namespace PhQ {
+
+/// \brief Errors that can occur when parsing a physical quantity with PhQ::Parse, PhQ::ParseJSON,
+/// PhQ::ParseXML, or PhQ::ParseYAML.
+enum class ParseError : int8_t {
+  /// \brief No error. The physical quantity was parsed successfully.
+  None,
+
+  /// \brief A number was expected but could not be parsed.
+  InvalidNumber,
+
+  /// \brief A number was parsed but is not representable by the numeric type of the physical
+  /// quantity.
+  NumberOutOfRange,
+
+  /// \brief The opening parenthesis of the components of a vector or tensor was expected.
+  MissingOpeningParenthesis,
+
+  /// \brief A comma or semicolon separating two components of a vector or tensor was expected.
+  MissingSeparator,
+
+  /// \brief The closing parenthesis of the components of a vector or tensor was expected.
+  MissingClosingParenthesis,
+
+  /// \brief A unit of measure was expected after the value but the string ended.
+  MissingUnit,
+
+  /// \brief The unit of measure is not a known spelling of a unit of the physical quantity's unit
+  /// of measure type.
+  UnknownUnit,
+
+  /// \brief A punctuation character, key, or tag of a JSON, XML, or YAML message was expected but
+  /// not found, or unexpected characters follow the end of the message.
+  UnexpectedToken,
+};
+
+/// \brief Result of parsing a physical quantity with PhQ::Parse, PhQ::ParseJSON, PhQ::ParseXML, or
+/// PhQ::ParseYAML.
+/// \tparam Quantity Type of the parsed physical quantity, such as PhQ::Speed<double>.
+template <typename Quantity>
+struct ParseResult {
+  /// \brief Parsed physical quantity, expressed in its standard unit of measure. This contains a
+  /// value if and only if the error is PhQ::ParseError::None.
+  std::optional<Quantity> quantity;
+
+  /// \brief Error that occurred during parsing, if any.
+  ParseError error{ParseError::None};
+
+  /// \brief Position in the parsed string of the character at which the error occurred. This is
+  /// zero if no error occurred.
+  std::size_t position{0};
+};
+
+namespace Internal {
+
+/// \brief Returns whether the given character is whitespace. Internal implementation detail not
+/// intended to be used outside of the PhQ::Parse function.
+inline constexpr bool IsWhitespace(const char character) noexcept {
+  return character == ' ' || character == '\t' || character == '\n' || character == '\r'
+         || character == '\f' || character == '\v';
+}
+
+/// \brief Returns the position of the first character at or after the given position in the given
+/// string that is not whitespace, or the size of the string if there is none. Internal
+/// implementation detail not intended to be used outside of the PhQ::Parse function.
+inline std::size_t SkipWhitespace(const std::string_view string, std::size_t position) noexcept {
+  while (position < string.size() && IsWhitespace(string[position])) {
+    ++position;
+  }
+  return position;
+}
+
+}  // namespace Internal
+
+/// \brief Parses the given string as a physical quantity of the given type, such as "12.5 km/hr" as
+/// a PhQ::Speed or "3e6 Pa" as a PhQ::StaticPressure. The string consists of a value followed by a
+/// spelling of a unit of measure, such as its abbreviation, optionally separated by whitespace. The
+/// value of a scalar physical quantity is a number. The value of a vector or tensor physical
+/// quantity is a parenthesized list of its components separated by commas or semicolons, such as
+/// "(1, 2, 3) m/s" for a PhQ::Velocity or "(1, 2, 3; 4, 5; 6) Pa" for a PhQ::Stress, which is the
+/// format produced by the Print method of physical quantities. Whitespace around the value and the
+/// unit of measure is ignored. The string is parsed in a single pass without allocating memory and
+/// without throwing exceptions. Returns a PhQ::ParseResult that contains the physical quantity
+/// expressed in its standard unit of measure if successful, or a PhQ::ParseError and the position
+/// at which it occurred otherwise.
+/// \tparam Quantity Type of the physical quantity, such as PhQ::Speed<double>. This must be derived
+/// from PhQ::DimensionalScalar, PhQ::DimensionalPlanarVector, PhQ::DimensionalVector,
+/// PhQ::DimensionalSymmetricDyad, or PhQ::DimensionalDyad.
+template <typename Quantity>
+[[nodiscard]] ParseResult<Quantity> Parse(const std::string_view string) {
+  using Traits = Internal::QuantityTraitsOf<Quantity>;
+  using UnitType = typename Traits::UnitType;
+  using NumericType = typename Traits::NumericType;
+  constexpr std::size_t count{Traits::ComponentCount};
+
+  std::array<NumericType, count> components{};
+  std::size_t position{Internal::SkipWhitespace(string, 0)};
+  if constexpr (count > 1) {
+    if (position == string.size() || string[position] != '(') {
+      return {std::nullopt, ParseError::MissingOpeningParenthesis, position};
+    }
+    position = Internal::SkipWhitespace(string, position + 1);
+  }
+  for (std::size_t index = 0; index < count; ++index) {
+    const ParseNumberResult result{ParseNumber(string.substr(position), components[index])};
+    if (result.error == std::errc::result_out_of_range) {
+      return {std::nullopt, ParseError::NumberOutOfRange, position};
+    }
+    if (result.error != std::errc{}) {
+      return {std::nullopt, ParseError::InvalidNumber, position};
+    }
+    position = Internal::SkipWhitespace(string, position + result.consumed);
+    if constexpr (count > 1) {
+      if (index + 1 < count) {
+        if (position == string.size() || (string[position] != ',' && string[position] != ';')) {
+          return {std::nullopt, ParseError::MissingSeparator, position};
+        }
+        position = Internal::SkipWhitespace(string, position + 1);
+      } else {
+        if (position == string.size() || string[position] != ')') {
+          return {std::nullopt, ParseError::MissingClosingParenthesis, position};
+        }
+        position = Internal::SkipWhitespace(string, position + 1);
+      }
+    }
+  }
+
+  std::size_t end{string.size()};
+  while (end > position && Internal::IsWhitespace(string[end - 1])) {
+    --end;
+  }
+  if (position == end) {
+    return {std::nullopt, ParseError::MissingUnit, position};
+  }
+  const std::optional<UnitType> unit{
+      ParseEnumeration<UnitType>(string.substr(position, end - position))};
+  if (!unit.has_value()) {
+    return {std::nullopt, ParseError::UnknownUnit, position};
+  }
+
+  if constexpr (count == 1) {
+    return {Quantity(components[0], unit.value()), ParseError::None, 0};
+  } else {
+    return {Quantity(typename Traits::ValueType{components}, unit.value()), ParseError::None, 0};
+  }
+}
+
+namespace Internal {
+
+/// \brief Serialization formats read by PhQ::ParseJSON, PhQ::ParseXML, and PhQ::ParseYAML. Internal
+/// implementation detail not intended to be used outside of these functions.
+enum class MessageFormat : int8_t {
+  JSON,
+  XML,
+  YAML,
+};
+
+/// \brief Consumes the given token at the given position in the given string. Returns whether the
+/// token was found, in which case the position is advanced past it. Internal implementation detail
+/// not intended to be used outside of the PhQ::ParseJSON, PhQ::ParseXML, and PhQ::ParseYAML
+/// functions.
+inline bool ConsumeToken(
+    const std::string_view string, std::size_t& position, const std::string_view token) noexcept {
+  if (string.size() - position < token.size()
+      || string.substr(position, token.size()) != token) {
+    return false;
+  }
+  position += token.size();
+  return true;
+}
+
+/// \brief Consumes the start of a structure in a message of the given format, which is an opening
+/// brace in JSON and YAML and nothing in XML. Whitespace before it is skipped. Internal
+/// implementation detail not intended to be used outside of the PhQ::ParseJSON, PhQ::ParseXML, and
+/// PhQ::ParseYAML functions.
+template <MessageFormat Format>
+inline bool ConsumeOpening(const std::string_view string, std::size_t& position) noexcept {
+  if constexpr (Format == MessageFormat::XML) {
+    return true;
+  } else {
+    position = SkipWhitespace(string, position);
+    return ConsumeToken(string, position, "{");
+  }
+}
+
+/// \brief Consumes the end of a structure in a message of the given format, which is a closing
+/// brace in JSON and YAML and nothing in XML. Whitespace before it is skipped. Internal
+/// implementation detail not intended to be used outside of the PhQ::ParseJSON, PhQ::ParseXML, and
+/// PhQ::ParseYAML functions.
+template <MessageFormat Format>
+inline bool ConsumeClosing(const std::string_view string, std::size_t& position) noexcept {
+  if constexpr (Format == MessageFormat::XML) {
+    return true;
+  } else {
+    position = SkipWhitespace(string, position);
+    return ConsumeToken(string, position, "}");
+  }
+}
+
+/// \brief Consumes the separator between two entries in a message of the given format, which is a
+/// comma in JSON and YAML and nothing in XML. Whitespace before it is skipped. Internal
+/// implementation detail not intended to be used outside of the PhQ::ParseJSON, PhQ::ParseXML, and
+/// PhQ::ParseYAML functions.
+template <MessageFormat Format>
+inline bool ConsumeSeparator(const std::string_view string, std::size_t& position) noexcept {
+  if constexpr (Format == MessageFormat::XML) {
+    return true;
+  } else {
+    position = SkipWhitespace(string, position);
+    return ConsumeToken(string, position, ",");
+  }
+}
+
+/// \brief Consumes the start of the entry with the given key in a message of the given format,
+/// which is "key": in JSON, key: in YAML, and <key> in XML. Whitespace before it is skipped. If
+/// the key is not found, the position is left at its expected start. Internal implementation
+/// detail not intended to be used outside of the PhQ::ParseJSON, PhQ::ParseXML, and PhQ::ParseYAML
+/// functions.
+template <MessageFormat Format>
+inline bool ConsumeKey(
+    const std::string_view string, std::size_t& position, const std::string_view key) noexcept {
+  position = SkipWhitespace(string, position);
+  std::size_t cursor{position};
+  bool found{false};
+  if constexpr (Format == MessageFormat::JSON) {
+    found = ConsumeToken(string, cursor, "\"") && ConsumeToken(string, cursor, key)
+            && ConsumeToken(string, cursor, "\"");
+  } else if constexpr (Format == MessageFormat::XML) {
+    found = ConsumeToken(string, cursor, "<") && ConsumeToken(string, cursor, key)
+            && ConsumeToken(string, cursor, ">");
+  } else {
+    found = ConsumeToken(string, cursor, key);
+  }
+  if constexpr (Format != MessageFormat::XML) {
+    if (found) {
+      cursor = SkipWhitespace(string, cursor);
+      found = ConsumeToken(string, cursor, ":");
+    }
+  }
+  if (found) {
+    position = cursor;
+  }
+  return found;
+}
+
+/// \brief Consumes the end of the entry with the given key in a message of the given format, which
+/// is </key> in XML and nothing in JSON and YAML. Whitespace before it is skipped. Internal
+/// implementation detail not intended to be used outside of the PhQ::ParseJSON, PhQ::ParseXML, and
+/// PhQ::ParseYAML functions.
+template <MessageFormat Format>
+inline bool ConsumeKeyEnd(
+    const std::string_view string, std::size_t& position, const std::string_view key) noexcept {
+  if constexpr (Format == MessageFormat::XML) {
+    position = SkipWhitespace(string, position);
+    std::size_t cursor{position};
+    if (ConsumeToken(string, cursor, "</") && ConsumeToken(string, cursor, key)
+        && ConsumeToken(string, cursor, ">")) {
+      position = cursor;
+      return true;
+    }
+    return false;
+  } else {
+    return true;
+  }
+}
+
+/// \brief Parses a physical quantity from a message of the given format in a single pass. Internal
+/// implementation detail not intended to be used outside of the PhQ::ParseJSON, PhQ::ParseXML, and
+/// PhQ::ParseYAML functions.
+template <typename Quantity, MessageFormat Format>
+[[nodiscard]] ParseResult<Quantity> ParseMessage(const std::string_view string) {
+  using Traits = QuantityTraitsOf<Quantity>;
+  using UnitType = typename Traits::UnitType;
+  using NumericType = typename Traits::NumericType;
+  constexpr std::size_t count{Traits::ComponentCount};
+  constexpr std::array<std::string_view, count> names{ComponentNames<count>};
+
+  std::array<NumericType, count> components{};
+  std::size_t position{0};
+  if (!ConsumeOpening<Format>(string, position) || !ConsumeKey<Format>(string, position, "value")) {
+    return {std::nullopt, ParseError::UnexpectedToken, position};
+  }
+  if constexpr (count > 1) {
+    if (!ConsumeOpening<Format>(string, position)) {
+      return {std::nullopt, ParseError::UnexpectedToken, position};
+    }
+  }
+  for (std::size_t index = 0; index < count; ++index) {
+    if constexpr (count > 1) {
+      if ((index > 0 && !ConsumeSeparator<Format>(string, position))
+          || !ConsumeKey<Format>(string, position, names[index])) {
+        return {std::nullopt, ParseError::UnexpectedToken, position};
+      }
+    }
+    position = SkipWhitespace(string, position);
+    const ParseNumberResult result{ParseNumber(string.substr(position), components[index])};
+    if (result.error == std::errc::result_out_of_range) {
+      return {std::nullopt, ParseError::NumberOutOfRange, position};
+    }
+    if (result.error != std::errc{}) {
+      return {std::nullopt, ParseError::InvalidNumber, position};
+    }
+    position += result.consumed;
+    if constexpr (count > 1) {
+      if (!ConsumeKeyEnd<Format>(string, position, names[index])) {
+        return {std::nullopt, ParseError::UnexpectedToken, position};
+      }
+    }
+  }
+  if constexpr (count > 1) {
+    if (!ConsumeClosing<Format>(string, position)) {
+      return {std::nullopt, ParseError::UnexpectedToken, position};
+    }
+  }
+  if (!ConsumeKeyEnd<Format>(string, position, "value")
+      || !ConsumeSeparator<Format>(string, position)
+      || !ConsumeKey<Format>(string, position, "unit")) {
+    return {std::nullopt, ParseError::UnexpectedToken, position};
+  }
+
+  // The unit of measure is quoted in JSON and YAML and is the text content of its element in XML.
+  position = SkipWhitespace(string, position);
+  char terminator{'<'};
+  if constexpr (Format != MessageFormat::XML) {
+    if (!ConsumeToken(string, position, "\"")) {
+      return {std::nullopt, ParseError::UnexpectedToken, position};
+    }
+    terminator = '"';
+  }
+  const std::size_t unit_begin{position};
+  std::size_t unit_end{string.find(terminator, position)};
+  if (unit_end == std::string_view::npos) {
+    return {std::nullopt, ParseError::UnexpectedToken, string.size()};
+  }
+  position = unit_end;
+  if constexpr (Format == MessageFormat::XML) {
+    while (unit_end > unit_begin && IsWhitespace(string[unit_end - 1])) {
+      --unit_end;
+    }
+  } else {
+    ++position;
+  }
+  if (unit_begin == unit_end) {
+    return {std::nullopt, ParseError::MissingUnit, unit_begin};
+  }
+  const std::optional<UnitType> unit{
+      ParseEnumeration<UnitType>(string.substr(unit_begin, unit_end - unit_begin))};
+  if (!unit.has_value()) {
+    return {std::nullopt, ParseError::UnknownUnit, unit_begin};
+  }
+
+  if (!ConsumeKeyEnd<Format>(string, position, "unit")
+      || !ConsumeClosing<Format>(string, position)) {
+    return {std::nullopt, ParseError::UnexpectedToken, position};
+  }
+  position = SkipWhitespace(string, position);
+  if (position != string.size()) {
+    return {std::nullopt, ParseError::UnexpectedToken, position};
+  }
+
+  if constexpr (count == 1) {
+    return {Quantity(components[0], unit.value()), ParseError::None, 0};
+  } else {
+    return {Quantity(typename Traits::ValueType{components}, unit.value()), ParseError::None, 0};
+  }
+}
+
+}  // namespace Internal
+
+/// \brief Parses the given JSON message as a physical quantity of the given type. The message has
+/// the format produced by the JSON member method of physical quantities, such as
+/// {"value":1.5,"unit":"m"} for a PhQ::Length or {"value":{"x":1,"y":2,"z":3},"unit":"m/s"} for a
+/// PhQ::Velocity. The components of a vector or tensor are listed in the same order as they are
+/// serialized, and the value precedes the unit of measure. Whitespace between tokens is ignored.
+/// The unit of measure is resolved from its spellings and the value is converted to the standard
+/// unit of measure. The message is parsed in a single pass without building a document tree,
+/// without allocating memory, and without throwing exceptions. Returns a PhQ::ParseResult that
+/// contains the physical quantity if successful, or a PhQ::ParseError and the position at which it
+/// occurred otherwise.
+/// \tparam Quantity Type of the physical quantity, such as PhQ::Velocity<double>. This must be
+/// derived from PhQ::DimensionalScalar, PhQ::DimensionalPlanarVector, PhQ::DimensionalVector,
+/// PhQ::DimensionalSymmetricDyad, or PhQ::DimensionalDyad.
+template <typename Quantity>
+[[nodiscard]] ParseResult<Quantity> ParseJSON(const std::string_view string) {
+  return Internal::ParseMessage<Quantity, Internal::MessageFormat::JSON>(string);
+}
+
+/// \brief Parses the given XML message as a physical quantity of the given type. The message has
+/// the format produced by the XML member method of physical quantities, such as
+/// <value>1.5</value><unit>m</unit> for a PhQ::Length or
+/// <value><x>1</x><y>2</y><z>3</z></value><unit>m/s</unit> for a PhQ::Velocity. Otherwise, this
+/// function behaves like PhQ::ParseJSON.
+/// \tparam Quantity Type of the physical quantity, such as PhQ::Velocity<double>. This must be
+/// derived from PhQ::DimensionalScalar, PhQ::DimensionalPlanarVector, PhQ::DimensionalVector,
+/// PhQ::DimensionalSymmetricDyad, or PhQ::DimensionalDyad.
+template <typename Quantity>
+[[nodiscard]] ParseResult<Quantity> ParseXML(const std::string_view string) {
+  return Internal::ParseMessage<Quantity, Internal::MessageFormat::XML>(string);
+}
+
+/// \brief Parses the given YAML message as a physical quantity of the given type. The message has
+/// the format produced by the YAML member method of physical quantities, such as
+/// {value:1.5,unit:"m"} for a PhQ::Length or {value:{x:1,y:2,z:3},unit:"m/s"} for a
+/// PhQ::Velocity. Otherwise, this function behaves like PhQ::ParseJSON.
+/// \tparam Quantity Type of the physical quantity, such as PhQ::Velocity<double>. This must be
+/// derived from PhQ::DimensionalScalar, PhQ::DimensionalPlanarVector, PhQ::DimensionalVector,
+/// PhQ::DimensionalSymmetricDyad, or PhQ::DimensionalDyad.
+template <typename Quantity>
+[[nodiscard]] ParseResult<Quantity> ParseYAML(const std::string_view string) {
+  return Internal::ParseMessage<Quantity, Internal::MessageFormat::YAML>(string);
+}
+
+}  // namespace PhQ
+
+#endif  // PHQ_PARSE_HPP
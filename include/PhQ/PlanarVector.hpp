@@ -243,19 +243,85 @@ public:
     return "(" + PhQ::Print(x_y_[0]) + ", " + PhQ::Print(x_y_[1]) + ")";
   }
 
+  /// \brief Serializes this two-dimensional planar vector as a JSON message and appends it to the
+  /// given string.
+  template <typename String>
+  void AppendJSON(String& string) const {
+    string.append("{\"x\":");
+    PhQ::AppendPrint(string, x_y_[0]);
+    string.append(",\"y\":");
+    PhQ::AppendPrint(string, x_y_[1]);
+    string.append("}");
+  }
+
+  /// \brief Serializes this two-dimensional planar vector as a JSON message and writes it through
+  /// the given output iterator. Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteJSON(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendJSON(string);
+    return string.Output();
+  }
+
   /// \brief Serializes this two-dimensional planar vector as a JSON message.
   [[nodiscard]] std::string JSON() const {
-    return "{\"x\":" + PhQ::Print(x_y_[0]) + ",\"y\":" + PhQ::Print(x_y_[1]) + "}";
+    std::string string;
+    AppendJSON(string);
+    return string;
+  }
+
+  /// \brief Serializes this two-dimensional planar vector as an XML message and appends it to the
+  /// given string.
+  template <typename String>
+  void AppendXML(String& string) const {
+    string.append("<x>");
+    PhQ::AppendPrint(string, x_y_[0]);
+    string.append("</x><y>");
+    PhQ::AppendPrint(string, x_y_[1]);
+    string.append("</y>");
+  }
+
+  /// \brief Serializes this two-dimensional planar vector as an XML message and writes it through
+  /// the given output iterator. Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteXML(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendXML(string);
+    return string.Output();
   }
 
   /// \brief Serializes this two-dimensional planar vector as an XML message.
   [[nodiscard]] std::string XML() const {
-    return "<x>" + PhQ::Print(x_y_[0]) + "</x><y>" + PhQ::Print(x_y_[1]) + "</y>";
+    std::string string;
+    AppendXML(string);
+    return string;
+  }
+
+  /// \brief Serializes this two-dimensional planar vector as a YAML message and appends it to the
+  /// given string.
+  template <typename String>
+  void AppendYAML(String& string) const {
+    string.append("{x:");
+    PhQ::AppendPrint(string, x_y_[0]);
+    string.append(",y:");
+    PhQ::AppendPrint(string, x_y_[1]);
+    string.append("}");
+  }
+
+  /// \brief Serializes this two-dimensional planar vector as a YAML message and writes it through
+  /// the given output iterator. Returns the output iterator one past the last written character.
+  template <typename OutputIterator>
+  OutputIterator WriteYAML(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendYAML(string);
+    return string.Output();
   }
 
   /// \brief Serializes this two-dimensional planar vector as a YAML message.
   [[nodiscard]] std::string YAML() const {
-    return "{x:" + PhQ::Print(x_y_[0]) + ",y:" + PhQ::Print(x_y_[1]) + "}";
+    std::string string;
+    AppendYAML(string);
+    return string;
   }
 
   /// \brief Adds another two-dimensional planar vector to this one.
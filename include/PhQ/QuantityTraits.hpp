@@ -0,0 +1,162 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_QUANTITY_TRAITS_HPP
+#define PHQ_QUANTITY_TRAITS_HPP
+
+#include <array>
+#include <cstddef>
+#include <string_view>
+#include <type_traits>
+
+#include "DimensionalDyad.hpp"
+#include "DimensionalPlanarVector.hpp"
+#include "DimensionalScalar.hpp"
+#include "DimensionalSymmetricDyad.hpp"
+#include "DimensionalVector.hpp"
+#include "Dyad.hpp"
+#include "PlanarVector.hpp"
+#include "SymmetricDyad.hpp"
+#include "Unit.hpp"
+#include "Vector.hpp"
+
+namespace PhQ {
+
+namespace Internal {
+
+/// \brief Properties of a physical quantity that are deduced from its dimensional base class.
+/// Internal implementation detail not intended to be used outside of the PhQ::Parse function and
+/// the PhQ::Writer class.
+template <typename Unit, typename Numeric, typename Value, std::size_t Count>
+struct QuantityTraits {
+  using UnitType = Unit;
+
+  using NumericType = Numeric;
+
+  using ValueType = Value;
+
+  static constexpr std::size_t ComponentCount{Count};
+};
+
+// The following functions are only declared. They are used in unevaluated contexts to deduce the
+// properties of a physical quantity from its dimensional base class.
+
+template <typename UnitType, typename NumericType>
+QuantityTraits<UnitType, NumericType, NumericType, 1> DeduceQuantityTraits(
+    const DimensionalScalar<UnitType, NumericType>*);
+
+template <typename UnitType, typename NumericType>
+QuantityTraits<UnitType, NumericType, PlanarVector<NumericType>, 2> DeduceQuantityTraits(
+    const DimensionalPlanarVector<UnitType, NumericType>*);
+
+template <typename UnitType, typename NumericType>
+QuantityTraits<UnitType, NumericType, Vector<NumericType>, 3> DeduceQuantityTraits(
+    const DimensionalVector<UnitType, NumericType>*);
+
+template <typename UnitType, typename NumericType>
+QuantityTraits<UnitType, NumericType, SymmetricDyad<NumericType>, 6> DeduceQuantityTraits(
+    const DimensionalSymmetricDyad<UnitType, NumericType>*);
+
+template <typename UnitType, typename NumericType>
+QuantityTraits<UnitType, NumericType, Dyad<NumericType>, 9> DeduceQuantityTraits(
+    const DimensionalDyad<UnitType, NumericType>*);
+
+/// \brief Properties of a given physical quantity type, such as PhQ::Velocity<double>. Internal
+/// implementation detail not intended to be used outside of the PhQ::Parse function and the
+/// PhQ::Writer class.
+template <typename Quantity>
+using QuantityTraitsOf = decltype(DeduceQuantityTraits(static_cast<const Quantity*>(nullptr)));
+
+/// \brief Names of the components of a physical quantity with a given number of components, in the
+/// order in which they are stored and serialized. Internal implementation detail not intended to be
+/// used outside of the PhQ::Parse function and the PhQ::Writer class.
+template <std::size_t Count>
+inline constexpr std::array<std::string_view, Count> ComponentNames{};
+
+template <>
+inline constexpr std::array<std::string_view, 1> ComponentNames<1>{"value"};
+
+template <>
+inline constexpr std::array<std::string_view, 2> ComponentNames<2>{"x", "y"};
+
+template <>
+inline constexpr std::array<std::string_view, 3> ComponentNames<3>{"x", "y", "z"};
+
+template <>
+inline constexpr std::array<std::string_view, 6> ComponentNames<6>{
+    "xx", "xy", "xz", "yy", "yz", "zz"};
+
+template <>
+inline constexpr std::array<std::string_view, 9> ComponentNames<9>{
+    "xx", "xy", "xz", "yx", "yy", "yz", "zx", "zy", "zz"};
+
+/// \brief Returns a pointer to the first component of the given value of a physical quantity. The
+/// components of a planar vector, vector, symmetric dyadic tensor, or dyadic tensor are contiguous.
+/// Internal implementation detail not intended to be used outside of the PhQ::Parse function and
+/// the PhQ::Writer class.
+template <typename NumericType>
+[[nodiscard]] inline const NumericType* ComponentsOf(const NumericType& value) noexcept {
+  return &value;
+}
+
+template <template <typename> class Type, typename NumericType>
+[[nodiscard]] inline const NumericType* ComponentsOf(const Type<NumericType>& value) noexcept {
+  return Components(&value);
+}
+
+/// \brief Returns a pointer to the first component of a contiguous sequence of physical
+/// quantities. A physical quantity holds nothing but its value, so a contiguous sequence of
+/// physical quantities is a contiguous sequence of components. Internal implementation detail not
+/// intended to be used outside of the Physical Quantities library's binary wire format, field
+/// files, and field containers.
+template <typename Quantity, typename NumericType>
+[[nodiscard]] inline NumericType* QuantityComponents(Quantity* const quantities) noexcept {
+  static_assert(
+      sizeof(Quantity) == QuantityTraitsOf<Quantity>::ComponentCount * sizeof(NumericType)
+          && std::is_trivially_copyable_v<Quantity>,
+      "A physical quantity must hold nothing but its value.");
+  return reinterpret_cast<NumericType*>(quantities);
+}
+
+/// \brief Returns a pointer to the values of a contiguous sequence of scalars, which are either
+/// numbers or scalar physical quantities such as PhQ::ScalarStress or PhQ::ScalarStrain. A scalar
+/// physical quantity holds nothing but its value. Internal implementation detail not intended to be
+/// used outside of the Physical Quantities library's field containers.
+template <typename ScalarType, typename NumericType>
+[[nodiscard]] inline NumericType* ScalarComponents(ScalarType* const scalars) noexcept {
+  if constexpr (std::is_same_v<ScalarType, NumericType>) {
+    return scalars;
+  } else {
+    static_assert(
+        sizeof(ScalarType) == sizeof(NumericType) && std::is_trivially_copyable_v<ScalarType>,
+        "A scalar physical quantity must hold nothing but its value.");
+    return reinterpret_cast<NumericType*>(scalars);
+  }
+}
+
+}  // namespace Internal
+
+}  // namespace PhQ
+
+#endif  // PHQ_QUANTITY_TRAITS_HPP
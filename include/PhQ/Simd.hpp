@@ -0,0 +1,366 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_SIMD_HPP
+#define PHQ_SIMD_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#include "Base.hpp"
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+  #define PHQ_SIMD_X86_64
+  #include <immintrin.h>
+#endif
+
+// Compiles a function for an instruction set without contracting multiplications and additions
+// into fused multiply-add instructions. A fused multiply-add rounds once instead of twice, so
+// contracting would make the explicitly vectorized kernels round differently from the scalar code
+// and make results depend on the processor and on the length of a sequence. AVX2 is targeted
+// without FMA, so no contraction is possible. AVX-512F includes fused multiply-add instructions,
+// so contraction is also turned off for GCC. Clang offers no per-function equivalent that would
+// also apply to the kernels inlined into PhQ::Internal::RunKernelAVX512, so the AVX-512F kernels
+// are not compiled with Clang, which uses the AVX2 kernels on AVX-512 processors instead.
+#ifdef PHQ_SIMD_X86_64
+  #define PHQ_TARGET_AVX2 __attribute__((target("avx2")))
+  #ifndef __clang__
+    #define PHQ_SIMD_AVX512
+    #define PHQ_TARGET_AVX512 __attribute__((target("avx512f"), optimize("fp-contract=off")))
+  #endif
+#endif
+
+namespace PhQ {
+
+namespace Internal {
+
+/// \brief Instruction sets for which the Physical Quantities library provides explicitly vectorized
+/// kernels. Internal implementation detail not intended to be used outside of the Physical
+/// Quantities library's bulk operations.
+enum class InstructionSet : int8_t {
+  /// \brief Portable scalar code. Always available.
+  Scalar,
+
+  /// \brief 128-bit Streaming SIMD Extensions 2 (SSE2). Always available on x86-64 processors.
+  SSE2,
+
+  /// \brief 256-bit Advanced Vector Extensions 2 (AVX2).
+  AVX2,
+
+  /// \brief 512-bit Advanced Vector Extensions foundation (AVX-512F).
+  AVX512,
+};
+
+/// \brief Queries the processor for the most capable instruction set supported by both the
+/// processor and the operating system. AVX-512F is not used with Clang; see PHQ_SIMD_AVX512.
+/// Internal implementation detail not intended to be used outside of the Physical Quantities
+/// library's bulk operations.
+[[nodiscard]] inline InstructionSet DetectInstructionSet() noexcept {
+#ifdef PHQ_SIMD_X86_64
+  __builtin_cpu_init();
+  #ifdef PHQ_SIMD_AVX512
+  if (__builtin_cpu_supports("avx512f")) {
+    return InstructionSet::AVX512;
+  }
+  #endif
+  if (__builtin_cpu_supports("avx2")) {
+    return InstructionSet::AVX2;
+  }
+  return InstructionSet::SSE2;
+#else
+  return InstructionSet::Scalar;
+#endif
+}
+
+/// \brief Most capable instruction set supported by the processor on which the program runs. The
+/// processor is queried once, on first use. Internal implementation detail not intended to be used
+/// outside of the Physical Quantities library's bulk operations.
+[[nodiscard]] inline InstructionSet SupportedInstructionSet() noexcept {
+  static const InstructionSet instruction_set{DetectInstructionSet()};
+  return instruction_set;
+}
+
+/// \brief Returns whether the call occurs within a constant-evaluated context, in which case
+/// explicitly vectorized kernels cannot be used. Conservatively returns true when the compiler
+/// offers no way of telling. Internal implementation detail not intended to be used outside of the
+/// Physical Quantities library's bulk operations.
+[[nodiscard]] inline constexpr bool IsConstantEvaluated() noexcept {
+#if defined(__GNUC__) || defined(__clang__)
+  return __builtin_is_constant_evaluated();
+#else
+  return true;
+#endif
+}
+
+/// \brief Minimum number of values for which the explicitly vectorized kernels are worth
+/// dispatching to. Shorter sequences, such as the components of a vector or of a dyadic tensor, are
+/// handled by scalar code. Internal implementation detail not intended to be used outside of the
+/// Physical Quantities library's bulk operations.
+inline constexpr const std::size_t MinimumSizeForSimd{32};
+
+/// \brief Computes `output[i] = scale * input[i] + offset` for a sequence of values using portable
+/// scalar code. The input and output sequences may be the same sequence but must not otherwise
+/// overlap. Internal implementation detail not intended to be used outside of the Physical
+/// Quantities library's bulk operations.
+template <typename NumericType>
+inline constexpr void AffineKernelScalar(
+    const NumericType* input, NumericType* output, const std::size_t size,
+    const NumericType scale, const NumericType offset) noexcept {
+  for (std::size_t index = 0; index < size; ++index) {
+    output[index] = scale * input[index] + offset;
+  }
+}
+
+#ifdef PHQ_SIMD_X86_64
+
+/// \brief Computes `output[i] = scale * input[i] + offset` for a sequence of double-precision
+/// values using SSE2 instructions and a scalar tail. Internal implementation detail not intended to
+/// be used outside of the Physical Quantities library's bulk operations.
+inline void AffineKernelSSE2(const double* input, double* output, const std::size_t size,
+                             const double scale, const double offset) noexcept {
+  const __m128d scales{_mm_set1_pd(scale)};
+  const __m128d offsets{_mm_set1_pd(offset)};
+  std::size_t index{0};
+  for (; index + 2 <= size; index += 2) {
+    _mm_storeu_pd(
+        output + index, _mm_add_pd(_mm_mul_pd(scales, _mm_loadu_pd(input + index)), offsets));
+  }
+  AffineKernelScalar(input + index, output + index, size - index, scale, offset);
+}
+
+/// \brief Computes `output[i] = scale * input[i] + offset` for a sequence of single-precision
+/// values using SSE2 instructions and a scalar tail. Internal implementation detail not intended to
+/// be used outside of the Physical Quantities library's bulk operations.
+inline void AffineKernelSSE2(const float* input, float* output, const std::size_t size,
+                             const float scale, const float offset) noexcept {
+  const __m128 scales{_mm_set1_ps(scale)};
+  const __m128 offsets{_mm_set1_ps(offset)};
+  std::size_t index{0};
+  for (; index + 4 <= size; index += 4) {
+    _mm_storeu_ps(
+        output + index, _mm_add_ps(_mm_mul_ps(scales, _mm_loadu_ps(input + index)), offsets));
+  }
+  AffineKernelScalar(input + index, output + index, size - index, scale, offset);
+}
+
+/// \brief Computes `output[i] = scale * input[i] + offset` for a sequence of double-precision
+/// values using AVX2 instructions and a scalar tail. Must only be called on processors that
+/// support AVX2. Internal implementation detail not intended to be used outside of the Physical
+/// Quantities library's bulk operations.
+PHQ_TARGET_AVX2 inline void AffineKernelAVX2(
+    const double* input, double* output, const std::size_t size, const double scale,
+    const double offset) noexcept {
+  const __m256d scales{_mm256_set1_pd(scale)};
+  const __m256d offsets{_mm256_set1_pd(offset)};
+  std::size_t index{0};
+  for (; index + 4 <= size; index += 4) {
+    _mm256_storeu_pd(
+        output + index,
+        _mm256_add_pd(_mm256_mul_pd(scales, _mm256_loadu_pd(input + index)), offsets));
+  }
+  AffineKernelScalar(input + index, output + index, size - index, scale, offset);
+}
+
+/// \brief Computes `output[i] = scale * input[i] + offset` for a sequence of single-precision
+/// values using AVX2 instructions and a scalar tail. Must only be called on processors that
+/// support AVX2. Internal implementation detail not intended to be used outside of the Physical
+/// Quantities library's bulk operations.
+PHQ_TARGET_AVX2 inline void AffineKernelAVX2(
+    const float* input, float* output, const std::size_t size, const float scale,
+    const float offset) noexcept {
+  const __m256 scales{_mm256_set1_ps(scale)};
+  const __m256 offsets{_mm256_set1_ps(offset)};
+  std::size_t index{0};
+  for (; index + 8 <= size; index += 8) {
+    _mm256_storeu_ps(
+        output + index,
+        _mm256_add_ps(_mm256_mul_ps(scales, _mm256_loadu_ps(input + index)), offsets));
+  }
+  AffineKernelScalar(input + index, output + index, size - index, scale, offset);
+}
+
+  #ifdef PHQ_SIMD_AVX512
+
+/// \brief Computes `output[i] = scale * input[i] + offset` for a sequence of double-precision
+/// values using AVX-512 instructions and a scalar tail. Must only be called on processors that
+/// support AVX-512F. Internal implementation detail not intended to be used outside of the Physical
+/// Quantities library's bulk operations.
+PHQ_TARGET_AVX512 inline void AffineKernelAVX512(
+    const double* input, double* output, const std::size_t size, const double scale,
+    const double offset) noexcept {
+  const __m512d scales{_mm512_set1_pd(scale)};
+  const __m512d offsets{_mm512_set1_pd(offset)};
+  std::size_t index{0};
+  for (; index + 8 <= size; index += 8) {
+    _mm512_storeu_pd(
+        output + index,
+        _mm512_add_pd(_mm512_mul_pd(scales, _mm512_loadu_pd(input + index)), offsets));
+  }
+  AffineKernelScalar(input + index, output + index, size - index, scale, offset);
+}
+
+/// \brief Computes `output[i] = scale * input[i] + offset` for a sequence of single-precision
+/// values using AVX-512 instructions and a scalar tail. Must only be called on processors that
+/// support AVX-512F. Internal implementation detail not intended to be used outside of the Physical
+/// Quantities library's bulk operations.
+PHQ_TARGET_AVX512 inline void AffineKernelAVX512(
+    const float* input, float* output, const std::size_t size, const float scale,
+    const float offset) noexcept {
+  const __m512 scales{_mm512_set1_ps(scale)};
+  const __m512 offsets{_mm512_set1_ps(offset)};
+  std::size_t index{0};
+  for (; index + 16 <= size; index += 16) {
+    _mm512_storeu_ps(
+        output + index,
+        _mm512_add_ps(_mm512_mul_ps(scales, _mm512_loadu_ps(input + index)), offsets));
+  }
+  AffineKernelScalar(input + index, output + index, size - index, scale, offset);
+}
+
+  #endif  // PHQ_SIMD_AVX512
+
+#endif  // PHQ_SIMD_X86_64
+
+/// \brief Computes `output[i] = scale * input[i] + offset` for a sequence of values. Dispatches to
+/// the explicitly vectorized kernel that corresponds to the most capable instruction set supported
+/// by the processor for single-precision and double-precision sequences of sufficient length, and
+/// to scalar code otherwise. The input and output sequences may be the same sequence but must not
+/// otherwise overlap. Internal implementation detail not intended to be used outside of the
+/// Physical Quantities library's bulk operations.
+template <typename NumericType>
+inline void AffineKernel(const NumericType* input, NumericType* output, const std::size_t size,
+                         const NumericType scale, const NumericType offset) noexcept {
+#ifdef PHQ_SIMD_X86_64
+  if constexpr (std::is_same_v<NumericType, float> || std::is_same_v<NumericType, double>) {
+    if (size >= MinimumSizeForSimd) {
+      switch (SupportedInstructionSet()) {
+  #ifdef PHQ_SIMD_AVX512
+        case InstructionSet::AVX512:
+          AffineKernelAVX512(input, output, size, scale, offset);
+          return;
+  #else
+        case InstructionSet::AVX512:
+  #endif
+        case InstructionSet::AVX2:
+          AffineKernelAVX2(input, output, size, scale, offset);
+          return;
+        case InstructionSet::SSE2:
+          AffineKernelSSE2(input, output, size, scale, offset);
+          return;
+        case InstructionSet::Scalar:
+          break;
+      }
+    }
+  }
+#endif
+  AffineKernelScalar(input, output, size, scale, offset);
+}
+
+#ifdef PHQ_SIMD_X86_64
+
+/// \brief Runs a given kernel compiled for AVX2. Must only be called on processors that support
+/// AVX2. Internal implementation detail not intended to be used outside of the
+/// PhQ::Internal::RunKernel function.
+template <typename Kernel>
+PHQ_TARGET_AVX2 inline void RunKernelAVX2(const Kernel& kernel) {
+  kernel();
+}
+
+  #ifdef PHQ_SIMD_AVX512
+
+/// \brief Runs a given kernel compiled for AVX-512F. Must only be called on processors that support
+/// AVX-512F. Internal implementation detail not intended to be used outside of the
+/// PhQ::Internal::RunKernel function.
+template <typename Kernel>
+PHQ_TARGET_AVX512 inline void RunKernelAVX512(const Kernel& kernel) {
+  kernel();
+}
+
+  #endif  // PHQ_SIMD_AVX512
+
+#endif  // PHQ_SIMD_X86_64
+
+/// \brief Runs a given kernel over a given number of elements, compiled for the most capable
+/// instruction set supported by the processor. The kernel is a callable object without parameters
+/// whose body is a simple loop over contiguous arrays, declared with PHQ_ALWAYS_INLINE, such as
+/// `[=]() PHQ_ALWAYS_INLINE { for (...) { ... } }`. It is inlined into an instruction-set-specific
+/// caller, where the compiler vectorizes its loop with the full width of that instruction set
+/// without contracting multiplications and additions, so that the results are the same as those of
+/// the baseline instruction set, with which short sequences are run. Internal implementation
+/// detail not intended to be used outside of the Physical Quantities library's bulk operations.
+template <typename Kernel>
+inline void RunKernel(const Kernel& kernel, const std::size_t size) {
+#ifdef PHQ_SIMD_X86_64
+  if (size >= MinimumSizeForSimd) {
+    switch (SupportedInstructionSet()) {
+  #ifdef PHQ_SIMD_AVX512
+      case InstructionSet::AVX512:
+        RunKernelAVX512(kernel);
+        return;
+  #else
+      case InstructionSet::AVX512:
+  #endif
+      case InstructionSet::AVX2:
+        RunKernelAVX2(kernel);
+        return;
+      case InstructionSet::SSE2:
+      case InstructionSet::Scalar:
+        break;
+    }
+  }
+#else
+  static_cast<void>(size);
+#endif
+  kernel();
+}
+
+/// \brief Adds a given number of values, multiplied by a given number, to another sequence of
+/// values in place. The two sequences may be the same sequence, as in `field += field`, so they are
+/// deliberately not declared PHQ_RESTRICT; they must not otherwise overlap. Internal implementation
+/// detail not intended to be used outside of the Physical Quantities library's field containers.
+template <typename NumericType>
+PHQ_ALWAYS_INLINE inline void AddScaledKernel(
+    NumericType* const values, const NumericType number, const NumericType* const other_values,
+    const std::size_t size) noexcept {
+  for (std::size_t index = 0; index < size; ++index) {
+    values[index] += number * other_values[index];
+  }
+}
+
+/// \brief Multiplies a given number of values by a given number in place. Internal implementation
+/// detail not intended to be used outside of the Physical Quantities library's field containers.
+template <typename NumericType>
+PHQ_ALWAYS_INLINE inline void ScaleKernel(
+    NumericType* const values, const NumericType number, const std::size_t size) noexcept {
+  for (std::size_t index = 0; index < size; ++index) {
+    values[index] *= number;
+  }
+}
+
+}  // namespace Internal
+
+}  // namespace PhQ
+
+#endif  // PHQ_SIMD_HPP
@@ -0,0 +1,254 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_STATIC_UNIT_PLANAR_VECTOR_HPP
+#define PHQ_STATIC_UNIT_PLANAR_VECTOR_HPP
+
+#include <cstddef>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <type_traits>
+
+#include "Base.hpp"
+#include "DimensionalPlanarVector.hpp"
+#include "Dimensions.hpp"
+#include "PlanarVector.hpp"
+#include "Unit.hpp"
+
+namespace PhQ {
+
+/// \brief Dimensional planar vector physical quantity whose value is stored in a unit of measure
+/// fixed at compile time rather than in the standard unit of measure of its unit type. The value is
+/// a two-dimensional planar vector in the XY plane. For example,
+/// PhQ::StaticUnitPlanarVector<Unit::Length::Millimetre> holds a value expressed in millimetres.
+/// Arithmetic between two such physical quantities with the same unit of measure performs no unit
+/// conversion. Unit conversions only occur at type boundaries: when constructing from a
+/// StaticUnitPlanarVector with a different unit of measure or from a physical quantity, and when
+/// converting to a physical quantity. These conversions are resolved at compile time through
+/// PhQ::ConvertStatically.
+/// \tparam UnitValue Unit of measure in which the value is stored, such as
+/// Unit::Length::Millimetre.
+/// \tparam NumericType Floating-point numeric type: float, double, or long double. Defaults to
+/// double if unspecified.
+template <auto UnitValue, typename NumericType = double>
+class StaticUnitPlanarVector {
+  static_assert(std::is_enum<decltype(UnitValue)>::value,
+                "The UnitValue template parameter of PhQ::StaticUnitPlanarVector must be "
+                "a unit of measure.");
+
+  static_assert(std::is_floating_point<NumericType>::value,
+                "The NumericType template parameter of a physical quantity must be a numeric "
+                "floating-point type: float, double, or long double.");
+
+public:
+  /// \brief Unit of measure enumeration type of this physical quantity.
+  using UnitType = decltype(UnitValue);
+
+  /// \brief Default constructor. Constructs a StaticUnitPlanarVector with an uninitialized value.
+  StaticUnitPlanarVector() = default;
+
+  /// \brief Constructor. Constructs a StaticUnitPlanarVector with a given value expressed in its
+  /// unit of measure.
+  explicit constexpr StaticUnitPlanarVector(
+      const PhQ::PlanarVector<NumericType>& value) : value(value) {}
+
+  /// \brief Constructor. Constructs a StaticUnitPlanarVector from another one with a different unit
+  /// of measure of the same unit type. The unit conversion is resolved at compile time.
+  template <UnitType OtherUnit>
+  explicit constexpr StaticUnitPlanarVector(
+      const StaticUnitPlanarVector<OtherUnit, NumericType>& other)
+    : value(PhQ::ConvertStatically<UnitType, OtherUnit, UnitValue>(other.Value())) {}
+
+  /// \brief Constructor. Constructs a StaticUnitPlanarVector from a physical quantity of the same
+  /// unit type, such as PhQ::PlanarVelocity. The unit conversion is resolved at compile time.
+  explicit constexpr StaticUnitPlanarVector(
+      const DimensionalPlanarVector<UnitType, NumericType>& quantity)
+    : value(quantity.template StaticValue<UnitValue>()) {}
+
+  /// \brief Destructor. Destroys this StaticUnitPlanarVector.
+  ~StaticUnitPlanarVector() noexcept = default;
+
+  /// \brief Copy constructor. Constructs a StaticUnitPlanarVector by copying another one.
+  constexpr StaticUnitPlanarVector(
+      const StaticUnitPlanarVector<UnitValue, NumericType>& other) = default;
+
+  /// \brief Move constructor. Constructs a StaticUnitPlanarVector by moving another one.
+  constexpr StaticUnitPlanarVector(
+      StaticUnitPlanarVector<UnitValue, NumericType>&& other) noexcept = default;
+
+  /// \brief Copy assignment operator. Assigns this StaticUnitPlanarVector by copying another one.
+  constexpr StaticUnitPlanarVector<UnitValue, NumericType>& operator=(
+      const StaticUnitPlanarVector<UnitValue, NumericType>& other) = default;
+
+  /// \brief Move assignment operator. Assigns this StaticUnitPlanarVector by moving another one.
+  constexpr StaticUnitPlanarVector<UnitValue, NumericType>& operator=(
+      StaticUnitPlanarVector<UnitValue, NumericType>&& other) noexcept = default;
+
+  /// \brief Statically creates a StaticUnitPlanarVector of zero.
+  [[nodiscard]] static constexpr StaticUnitPlanarVector<UnitValue, NumericType> Zero() {
+    return StaticUnitPlanarVector<UnitValue, NumericType>{PhQ::PlanarVector<NumericType>::Zero()};
+  }
+
+  /// \brief Physical dimension set of this physical quantity.
+  [[nodiscard]] static constexpr const PhQ::Dimensions& Dimensions() {
+    return PhQ::RelatedDimensions<UnitType>;
+  }
+
+  /// \brief Unit of measure in which this physical quantity's value is stored. Unlike for other
+  /// physical quantities, this is not necessarily the standard unit of measure of its unit type.
+  [[nodiscard]] static constexpr UnitType Unit() {
+    return UnitValue;
+  }
+
+  /// \brief Value of this physical quantity expressed in its unit of measure.
+  [[nodiscard]] constexpr PhQ::PlanarVector<NumericType> Value() const noexcept {
+    return value;
+  }
+
+  /// \brief Value of this physical quantity expressed in a given unit of measure.
+  [[nodiscard]] PhQ::PlanarVector<NumericType> Value(const UnitType unit) const {
+    return PhQ::Convert(value, UnitValue, unit);
+  }
+
+  /// \brief Value of this physical quantity expressed in a given unit of measure. This method can
+  /// be evaluated statically at compile-time.
+  template <UnitType NewUnit>
+  [[nodiscard]] constexpr PhQ::PlanarVector<NumericType> StaticValue() const {
+    return PhQ::ConvertStatically<UnitType, UnitValue, NewUnit>(value);
+  }
+
+  /// \brief Returns the value of this physical quantity expressed in its unit of measure as a
+  /// mutable value.
+  [[nodiscard]] constexpr PhQ::PlanarVector<NumericType>& MutableValue() noexcept {
+    return value;
+  }
+
+  /// \brief Sets the value of this physical quantity expressed in its unit of measure to the given
+  /// value.
+  constexpr void SetValue(const PhQ::PlanarVector<NumericType>& value) noexcept {
+    this->value = value;
+  }
+
+  /// \brief Converts this physical quantity to a physical quantity of the same unit type stored in
+  /// the standard unit of measure, such as PhQ::PlanarVelocity<NumericType>. The unit conversion is
+  /// resolved at compile time.
+  /// \tparam Quantity Physical quantity type to convert to.
+  template <typename Quantity>
+  [[nodiscard]] constexpr Quantity ToQuantity() const {
+    static_assert(std::is_base_of_v<DimensionalPlanarVector<UnitType, NumericType>, Quantity>,
+                  "The Quantity template parameter of PhQ::StaticUnitPlanarVector::ToQuantity() "
+                  "must be a physical quantity of the same unit type and numeric type.");
+    return Quantity::template Create<UnitValue>(value);
+  }
+
+  /// \brief Prints this physical quantity as a string. This physical quantity's value is expressed
+  /// in its unit of measure.
+  [[nodiscard]] std::string Print() const {
+    return value.Print().append(" ").append(PhQ::Abbreviation(UnitValue));
+  }
+
+  constexpr StaticUnitPlanarVector<UnitValue, NumericType> operator+(
+      const StaticUnitPlanarVector<UnitValue, NumericType>& other) const {
+    return StaticUnitPlanarVector<UnitValue, NumericType>{value + other.value};
+  }
+
+  constexpr StaticUnitPlanarVector<UnitValue, NumericType> operator-(
+      const StaticUnitPlanarVector<UnitValue, NumericType>& other) const {
+    return StaticUnitPlanarVector<UnitValue, NumericType>{value - other.value};
+  }
+
+  constexpr StaticUnitPlanarVector<UnitValue, NumericType> operator*(
+      const NumericType number) const {
+    return StaticUnitPlanarVector<UnitValue, NumericType>{value * number};
+  }
+
+  constexpr StaticUnitPlanarVector<UnitValue, NumericType> operator/(
+      const NumericType number) const {
+    return StaticUnitPlanarVector<UnitValue, NumericType>{value / number};
+  }
+
+  constexpr void operator+=(const StaticUnitPlanarVector<UnitValue, NumericType>& other) noexcept {
+    value += other.value;
+  }
+
+  constexpr void operator-=(const StaticUnitPlanarVector<UnitValue, NumericType>& other) noexcept {
+    value -= other.value;
+  }
+
+  constexpr void operator*=(const NumericType number) noexcept {
+    value *= number;
+  }
+
+  constexpr void operator/=(const NumericType number) noexcept {
+    value /= number;
+  }
+
+private:
+  /// \brief Value of this physical quantity expressed in its unit of measure.
+  PhQ::PlanarVector<NumericType> value;
+};
+
+template <auto UnitValue, typename NumericType>
+inline constexpr bool operator==(
+    const StaticUnitPlanarVector<UnitValue, NumericType>& left,
+    const StaticUnitPlanarVector<UnitValue, NumericType>& right) noexcept {
+  return left.Value() == right.Value();
+}
+
+template <auto UnitValue, typename NumericType>
+inline constexpr bool operator!=(
+    const StaticUnitPlanarVector<UnitValue, NumericType>& left,
+    const StaticUnitPlanarVector<UnitValue, NumericType>& right) noexcept {
+  return left.Value() != right.Value();
+}
+
+template <auto UnitValue, typename NumericType>
+inline std::ostream& operator<<(
+    std::ostream& stream, const StaticUnitPlanarVector<UnitValue, NumericType>& quantity) {
+  stream << quantity.Print();
+  return stream;
+}
+
+template <auto UnitValue, typename NumericType>
+inline constexpr StaticUnitPlanarVector<UnitValue, NumericType> operator*(
+    const NumericType number, const StaticUnitPlanarVector<UnitValue, NumericType>& quantity) {
+  return quantity * number;
+}
+
+}  // namespace PhQ
+
+namespace std {
+
+template <auto UnitValue, typename NumericType>
+struct hash<PhQ::StaticUnitPlanarVector<UnitValue, NumericType>> {
+  inline size_t operator(
+      )(const PhQ::StaticUnitPlanarVector<UnitValue, NumericType>& quantity) const {
+    return hash<PhQ::PlanarVector<NumericType>>()(quantity.Value());
+  }
+};
+
+}  // namespace std
+
+#endif  // PHQ_STATIC_UNIT_PLANAR_VECTOR_HPP
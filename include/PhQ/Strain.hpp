@@ -31,6 +31,7 @@
 #include <ostream>
 
 #include "DimensionlessSymmetricDyad.hpp"
+#include "Direction.hpp"
 #include "ScalarStrain.hpp"
 #include "SymmetricDyad.hpp"
 
@@ -182,6 +183,29 @@ public:
     return ScalarStrain<NumericType>{this->value.zz()};
   }
 
+  /// \brief Returns the principal strains of this strain tensor, which are its eigenvalues,
+  /// sorted in decreasing order.
+  [[nodiscard]] std::array<ScalarStrain<NumericType>, 3> PrincipalStrains() const {
+    const std::array<NumericType, 3> eigenvalues{this->value.Eigenvalues()};
+    return {ScalarStrain<NumericType>{eigenvalues[0]}, ScalarStrain<NumericType>{eigenvalues[1]},
+            ScalarStrain<NumericType>{eigenvalues[2]}};
+  }
+
+  /// \brief Returns the principal directions of this strain tensor, which are its eigenvectors,
+  /// in the order of its principal strains. They form a right-handed orthonormal basis.
+  [[nodiscard]] std::array<Direction<NumericType>, 3> PrincipalDirections() const {
+    return this->value.Eigenvectors();
+  }
+
+  /// \brief Returns the maximum shear strain of this strain tensor, which is half the difference
+  /// between its largest and smallest principal strains. This is the tensorial shear component; the
+  /// engineering shear component is twice this value.
+  [[nodiscard]] ScalarStrain<NumericType> MaximumShearStrain() const {
+    const std::array<NumericType, 3> eigenvalues{this->value.Eigenvalues()};
+    return ScalarStrain<NumericType>{static_cast<NumericType>(0.5)
+                                     * (eigenvalues[0] - eigenvalues[2])};
+  }
+
   constexpr Strain<NumericType> operator+(const Strain<NumericType>& strain) const {
     return Strain<NumericType>{this->value + strain.value};
   }
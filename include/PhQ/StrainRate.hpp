@@ -31,6 +31,7 @@
 #include <ostream>
 
 #include "DimensionalSymmetricDyad.hpp"
+#include "Direction.hpp"
 #include "Frequency.hpp"
 #include "ScalarStrainRate.hpp"
 #include "Strain.hpp"
@@ -187,6 +188,31 @@ public:
     return ScalarStrainRate<NumericType>{this->value.zz()};
   }
 
+  /// \brief Returns the principal strain rates of this strain rate tensor, which are its
+  /// eigenvalues, sorted in decreasing order.
+  [[nodiscard]] std::array<ScalarStrainRate<NumericType>, 3> PrincipalStrainRates() const {
+    const std::array<NumericType, 3> eigenvalues{this->value.Eigenvalues()};
+    return {ScalarStrainRate<NumericType>{eigenvalues[0]},
+            ScalarStrainRate<NumericType>{eigenvalues[1]},
+            ScalarStrainRate<NumericType>{eigenvalues[2]}};
+  }
+
+  /// \brief Returns the principal directions of this strain rate tensor, which are its
+  /// eigenvectors, in the order of its principal strain rates. They form a right-handed orthonormal
+  /// basis.
+  [[nodiscard]] std::array<Direction<NumericType>, 3> PrincipalDirections() const {
+    return this->value.Eigenvectors();
+  }
+
+  /// \brief Returns the maximum shear strain rate of this strain rate tensor, which is half the
+  /// difference between its largest and smallest principal strain rates. This is the tensorial
+  /// shear component; the engineering shear component is twice this value.
+  [[nodiscard]] ScalarStrainRate<NumericType> MaximumShearStrainRate() const {
+    const std::array<NumericType, 3> eigenvalues{this->value.Eigenvalues()};
+    return ScalarStrainRate<NumericType>{
+        static_cast<NumericType>(0.5) * (eigenvalues[0] - eigenvalues[2])};
+  }
+
   constexpr StrainRate operator+(const StrainRate<NumericType>& strain_rate) const {
     return StrainRate<NumericType>{this->value + strain_rate.value};
   }
@@ -196,14 +196,44 @@ public:
   /// \brief Computes the von Mises stress of this stress tensor using the von Mises yield
   /// criterion.
   [[nodiscard]] constexpr ScalarStress<NumericType> VonMises() const {
+    const NumericType xx_yy{this->value.xx() - this->value.yy()};
+    const NumericType yy_zz{this->value.yy() - this->value.zz()};
+    const NumericType zz_xx{this->value.zz() - this->value.xx()};
+    const NumericType shear{this->value.xy() * this->value.xy()
+                            + this->value.xz() * this->value.xz()
+                            + this->value.yz() * this->value.yz()};
     return ScalarStress<NumericType>{std::sqrt(
-        0.5
-        * (std::pow(this->value.xx() - this->value.yy(), 2)
-           + std::pow(this->value.yy() - this->value.zz(), 2)
-           + std::pow(this->value.zz() - this->value.xx(), 2)
-           + 6.0
-                 * (std::pow(this->value.xy(), 2) + std::pow(this->value.xz(), 2)
-                    + std::pow(this->value.yz(), 2))))};
+        static_cast<NumericType>(0.5)
+        * (xx_yy * xx_yy + yy_zz * yy_zz + zz_xx * zz_xx + static_cast<NumericType>(6) * shear))};
+  }
+
+  /// \brief Returns the principal stresses of this stress tensor, which are its eigenvalues, sorted
+  /// in decreasing order.
+  [[nodiscard]] std::array<ScalarStress<NumericType>, 3> PrincipalStresses() const {
+    const std::array<NumericType, 3> eigenvalues{this->value.Eigenvalues()};
+    return {ScalarStress<NumericType>{eigenvalues[0]}, ScalarStress<NumericType>{eigenvalues[1]},
+            ScalarStress<NumericType>{eigenvalues[2]}};
+  }
+
+  /// \brief Returns the principal directions of this stress tensor, which are its eigenvectors, in
+  /// the order of its principal stresses. They form a right-handed orthonormal basis.
+  [[nodiscard]] std::array<Direction<NumericType>, 3> PrincipalDirections() const {
+    return this->value.Eigenvectors();
+  }
+
+  /// \brief Returns the maximum shear stress of this stress tensor, which is half the difference
+  /// between its largest and smallest principal stresses.
+  [[nodiscard]] ScalarStress<NumericType> MaximumShearStress() const {
+    const std::array<NumericType, 3> eigenvalues{this->value.Eigenvalues()};
+    return ScalarStress<NumericType>{static_cast<NumericType>(0.5)
+                                     * (eigenvalues[0] - eigenvalues[2])};
+  }
+
+  /// \brief Computes the Tresca stress of this stress tensor using the Tresca yield criterion,
+  /// which is the difference between its largest and smallest principal stresses.
+  [[nodiscard]] ScalarStress<NumericType> Tresca() const {
+    const std::array<NumericType, 3> eigenvalues{this->value.Eigenvalues()};
+    return ScalarStress<NumericType>{eigenvalues[0] - eigenvalues[2]};
   }
 
   constexpr Stress<NumericType> operator+(const Stress<NumericType>& stress) const {
@@ -26,6 +26,7 @@
 #define PHQ_SYMMETRIC_DYAD_HPP
 
 #include <array>
+#include <cmath>
 #include <cstddef>
 #include <functional>
 #include <optional>
@@ -39,6 +40,10 @@
 
 namespace PhQ {
 
+// Forward declaration for class PhQ::SymmetricDyad.
+template <typename NumericType>
+class Direction;
+
 /// \brief Symmetric three-dimensional Euclidean dyadic tensor. Contains six components in Cartesian
 /// coordinates: xx, xy = yx, xz = zx, yy, yz = zy, and zz. For the general case of a
 /// three-dimensional Euclidean dyadic tensor which may be symmetric or asymmetric, see PhQ::Dyad.
@@ -353,6 +358,18 @@ public:
   /// std::nullopt otherwise.
   [[nodiscard]] std::optional<SymmetricDyad<NumericType>> Inverse() const;
 
+  /// \brief Returns the eigenvalues of this three-dimensional symmetric dyadic tensor, also known
+  /// as its principal values, sorted in decreasing order. They are computed in closed form from
+  /// the invariants of this tensor without iterations, then refined, so that repeated and nearly
+  /// repeated eigenvalues remain accurate.
+  [[nodiscard]] std::array<NumericType, 3> Eigenvalues() const;
+
+  /// \brief Returns the eigenvectors of this three-dimensional symmetric dyadic tensor, also known
+  /// as its principal directions, in the order of its eigenvalues as returned by Eigenvalues(). The
+  /// directions are mutually orthogonal and form a right-handed basis, even when some eigenvalues
+  /// are repeated.
+  [[nodiscard]] std::array<PhQ::Direction<NumericType>, 3> Eigenvectors() const;
+
   /// \brief Prints this three-dimensional symmetric dyadic tensor as a string.
   [[nodiscard]] std::string Print() const {
     return "(" + PhQ::Print(xx_xy_xz_yy_yz_zz_[0]) + ", " + PhQ::Print(xx_xy_xz_yy_yz_zz_[1]) + ", "
@@ -360,30 +377,112 @@ public:
            + PhQ::Print(xx_xy_xz_yy_yz_zz_[4]) + "; " + PhQ::Print(xx_xy_xz_yy_yz_zz_[5]) + ")";
   }
 
+  /// \brief Serializes this three-dimensional symmetric dyadic tensor as a JSON message and appends
+  /// it to the given string.
+  template <typename String>
+  void AppendJSON(String& string) const {
+    string.append("{\"xx\":");
+    PhQ::AppendPrint(string, xx_xy_xz_yy_yz_zz_[0]);
+    string.append(",\"xy\":");
+    PhQ::AppendPrint(string, xx_xy_xz_yy_yz_zz_[1]);
+    string.append(",\"xz\":");
+    PhQ::AppendPrint(string, xx_xy_xz_yy_yz_zz_[2]);
+    string.append(",\"yy\":");
+    PhQ::AppendPrint(string, xx_xy_xz_yy_yz_zz_[3]);
+    string.append(",\"yz\":");
+    PhQ::AppendPrint(string, xx_xy_xz_yy_yz_zz_[4]);
+    string.append(",\"zz\":");
+    PhQ::AppendPrint(string, xx_xy_xz_yy_yz_zz_[5]);
+    string.append("}");
+  }
+
+  /// \brief Serializes this three-dimensional symmetric dyadic tensor as a JSON message and writes
+  /// it through the given output iterator. Returns the output iterator one past the last written
+  /// character.
+  template <typename OutputIterator>
+  OutputIterator WriteJSON(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendJSON(string);
+    return string.Output();
+  }
+
   /// \brief Serializes this three-dimensional symmetric dyadic tensor as a JSON message.
   [[nodiscard]] std::string JSON() const {
-    return "{\"xx\":" + PhQ::Print(xx_xy_xz_yy_yz_zz_[0]) + ",\"xy\":"
-           + PhQ::Print(xx_xy_xz_yy_yz_zz_[1]) + ",\"xz\":" + PhQ::Print(xx_xy_xz_yy_yz_zz_[2])
-           + ",\"yy\":" + PhQ::Print(xx_xy_xz_yy_yz_zz_[3])
-           + ",\"yz\":" + PhQ::Print(xx_xy_xz_yy_yz_zz_[4])
-           + ",\"zz\":" + PhQ::Print(xx_xy_xz_yy_yz_zz_[5]) + "}";
+    std::string string;
+    AppendJSON(string);
+    return string;
+  }
+
+  /// \brief Serializes this three-dimensional symmetric dyadic tensor as an XML message and appends
+  /// it to the given string.
+  template <typename String>
+  void AppendXML(String& string) const {
+    string.append("<xx>");
+    PhQ::AppendPrint(string, xx_xy_xz_yy_yz_zz_[0]);
+    string.append("</xx><xy>");
+    PhQ::AppendPrint(string, xx_xy_xz_yy_yz_zz_[1]);
+    string.append("</xy><xz>");
+    PhQ::AppendPrint(string, xx_xy_xz_yy_yz_zz_[2]);
+    string.append("</xz><yy>");
+    PhQ::AppendPrint(string, xx_xy_xz_yy_yz_zz_[3]);
+    string.append("</yy><yz>");
+    PhQ::AppendPrint(string, xx_xy_xz_yy_yz_zz_[4]);
+    string.append("</yz><zz>");
+    PhQ::AppendPrint(string, xx_xy_xz_yy_yz_zz_[5]);
+    string.append("</zz>");
+  }
+
+  /// \brief Serializes this three-dimensional symmetric dyadic tensor as an XML message and writes
+  /// it through the given output iterator. Returns the output iterator one past the last written
+  /// character.
+  template <typename OutputIterator>
+  OutputIterator WriteXML(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendXML(string);
+    return string.Output();
   }
 
   /// \brief Serializes this three-dimensional symmetric dyadic tensor as an XML message.
   [[nodiscard]] std::string XML() const {
-    return "<xx>" + PhQ::Print(xx_xy_xz_yy_yz_zz_[0]) + "</xx><xy>"
-           + PhQ::Print(xx_xy_xz_yy_yz_zz_[1]) + "</xy><xz>" + PhQ::Print(xx_xy_xz_yy_yz_zz_[2])
-           + "</xz><yy>" + PhQ::Print(xx_xy_xz_yy_yz_zz_[3]) + "</yy><yz>"
-           + PhQ::Print(xx_xy_xz_yy_yz_zz_[4]) + "</yz><zz>" + PhQ::Print(xx_xy_xz_yy_yz_zz_[5])
-           + "</zz>";
+    std::string string;
+    AppendXML(string);
+    return string;
+  }
+
+  /// \brief Serializes this three-dimensional symmetric dyadic tensor as a YAML message and appends
+  /// it to the given string.
+  template <typename String>
+  void AppendYAML(String& string) const {
+    string.append("{xx:");
+    PhQ::AppendPrint(string, xx_xy_xz_yy_yz_zz_[0]);
+    string.append(",xy:");
+    PhQ::AppendPrint(string, xx_xy_xz_yy_yz_zz_[1]);
+    string.append(",xz:");
+    PhQ::AppendPrint(string, xx_xy_xz_yy_yz_zz_[2]);
+    string.append(",yy:");
+    PhQ::AppendPrint(string, xx_xy_xz_yy_yz_zz_[3]);
+    string.append(",yz:");
+    PhQ::AppendPrint(string, xx_xy_xz_yy_yz_zz_[4]);
+    string.append(",zz:");
+    PhQ::AppendPrint(string, xx_xy_xz_yy_yz_zz_[5]);
+    string.append("}");
+  }
+
+  /// \brief Serializes this three-dimensional symmetric dyadic tensor as a YAML message and writes
+  /// it through the given output iterator. Returns the output iterator one past the last written
+  /// character.
+  template <typename OutputIterator>
+  OutputIterator WriteYAML(OutputIterator output) const {
+    Internal::OutputIteratorString<OutputIterator> string{output};
+    AppendYAML(string);
+    return string.Output();
   }
 
   /// \brief Serializes this three-dimensional symmetric dyadic tensor as a YAML message.
   [[nodiscard]] std::string YAML() const {
-    return "{xx:" + PhQ::Print(xx_xy_xz_yy_yz_zz_[0]) + ",xy:" + PhQ::Print(xx_xy_xz_yy_yz_zz_[1])
-           + ",xz:" + PhQ::Print(xx_xy_xz_yy_yz_zz_[2]) + ",yy:" + PhQ::Print(xx_xy_xz_yy_yz_zz_[3])
-           + ",yz:" + PhQ::Print(xx_xy_xz_yy_yz_zz_[4]) + ",zz:" + PhQ::Print(xx_xy_xz_yy_yz_zz_[5])
-           + "}";
+    std::string string;
+    AppendYAML(string);
+    return string;
   }
 
   /// \brief Adds another three-dimensional symmetric dyadic tensor to this one.
@@ -589,6 +688,197 @@ inline std::optional<SymmetricDyad<NumericType>> SymmetricDyad<NumericType>::Inv
   return std::nullopt;
 }
 
+namespace Internal {
+
+/// \brief Computes the eigenvalues, in decreasing order, and the corresponding eigenvectors of the
+/// three-dimensional symmetric dyadic tensor with the given xx, xy, xz, yy, yz, and zz Cartesian
+/// components. First, the trigonometric closed form for the roots of the characteristic polynomial
+/// estimates the eigenvalues. The eigenvalue that is farthest from the other two is accurate, so
+/// its eigenvector is computed as the largest cross product of two rows of the shifted tensor.
+/// Then, the other two eigenvalues and their eigenvectors are computed from the restriction of the
+/// tensor to the plane orthogonal to that eigenvector, which is a two-dimensional symmetric problem
+/// without cancellation. This remains accurate when eigenvalues are repeated or nearly repeated.
+/// The eigenvectors form a right-handed orthonormal basis; their components are written in the
+/// order first x, y, z, second x, y, z, and third x, y, z. The computation has no branches so that
+/// loops over many tensors can be vectorized. Internal implementation detail not intended to be
+/// used outside of the PhQ::SymmetricDyad class and the PhQ::SymmetricDyadField class.
+template <typename NumericType>
+PHQ_ALWAYS_INLINE inline void SymmetricDyadEigensystem(
+    const NumericType xx, const NumericType xy, const NumericType xz, const NumericType yy,
+    const NumericType yz, const NumericType zz, NumericType& first, NumericType& second,
+    NumericType& third, std::array<NumericType, 9>& eigenvectors) noexcept {
+  constexpr NumericType zero{static_cast<NumericType>(0)};
+  constexpr NumericType one{static_cast<NumericType>(1)};
+  constexpr NumericType half{static_cast<NumericType>(0.5)};
+
+  // The eigenvalues are estimated as mean + 2 * scale * cos(angle + 2 * k * pi / 3), where scale
+  // is the root-mean-square of the deviatoric part and angle is a third of the arccosine of the
+  // half determinant of the deviatoric part divided by the cube of scale.
+  const NumericType mean{(xx + yy + zz) / static_cast<NumericType>(3)};
+  const NumericType deviatoric_xx{xx - mean};
+  const NumericType deviatoric_yy{yy - mean};
+  const NumericType deviatoric_zz{zz - mean};
+  const NumericType squares{deviatoric_xx * deviatoric_xx + deviatoric_yy * deviatoric_yy
+                            + deviatoric_zz * deviatoric_zz
+                            + static_cast<NumericType>(2) * (xy * xy + xz * xz + yz * yz)};
+  const NumericType scale{std::sqrt(squares / static_cast<NumericType>(6))};
+  const NumericType inverse_scale{scale > zero ? one / scale : zero};
+  const NumericType determinant{deviatoric_xx * (deviatoric_yy * deviatoric_zz - yz * yz)
+                                + xy * (yz * xz - xy * deviatoric_zz)
+                                + xz * (xy * yz - deviatoric_yy * xz)};
+  NumericType half_determinant{
+      half * determinant * inverse_scale * inverse_scale * inverse_scale};
+  half_determinant = half_determinant < -one ? -one :
+                     half_determinant > one  ? one :
+                                               half_determinant;
+  const NumericType angle{std::acos(half_determinant) / static_cast<NumericType>(3)};
+  constexpr NumericType third_of_turn{
+      static_cast<NumericType>(2) * Pi<NumericType> / static_cast<NumericType>(3)};
+  const NumericType largest{mean + static_cast<NumericType>(2) * scale * std::cos(angle)};
+  const NumericType smallest{
+      mean + static_cast<NumericType>(2) * scale * std::cos(angle + third_of_turn)};
+  const bool is_first_distinct{half_determinant >= zero};
+  const NumericType distinct{is_first_distinct ? largest : smallest};
+
+  // Rows of the tensor minus the distinct eigenvalue and their pairwise cross products.
+  const NumericType row_xx{xx - distinct};
+  const NumericType row_yy{yy - distinct};
+  const NumericType row_zz{zz - distinct};
+  const NumericType cross_01_x{xy * yz - xz * row_yy};
+  const NumericType cross_01_y{xz * xy - row_xx * yz};
+  const NumericType cross_01_z{row_xx * row_yy - xy * xy};
+  const NumericType cross_02_x{xy * row_zz - xz * yz};
+  const NumericType cross_02_y{xz * xz - row_xx * row_zz};
+  const NumericType cross_02_z{row_xx * yz - xy * xz};
+  const NumericType cross_12_x{row_yy * row_zz - yz * yz};
+  const NumericType cross_12_y{yz * xz - xy * row_zz};
+  const NumericType cross_12_z{xy * yz - row_yy * xz};
+  const NumericType norm_01{
+      cross_01_x * cross_01_x + cross_01_y * cross_01_y + cross_01_z * cross_01_z};
+  const NumericType norm_02{
+      cross_02_x * cross_02_x + cross_02_y * cross_02_y + cross_02_z * cross_02_z};
+  const NumericType norm_12{
+      cross_12_x * cross_12_x + cross_12_y * cross_12_y + cross_12_z * cross_12_z};
+  const bool is_02_largest{norm_02 > norm_01};
+  NumericType largest_x{is_02_largest ? cross_02_x : cross_01_x};
+  NumericType largest_y{is_02_largest ? cross_02_y : cross_01_y};
+  NumericType largest_z{is_02_largest ? cross_02_z : cross_01_z};
+  NumericType largest_norm{is_02_largest ? norm_02 : norm_01};
+  const bool is_12_largest{norm_12 > largest_norm};
+  largest_x = is_12_largest ? cross_12_x : largest_x;
+  largest_y = is_12_largest ? cross_12_y : largest_y;
+  largest_z = is_12_largest ? cross_12_z : largest_z;
+  largest_norm = is_12_largest ? norm_12 : largest_norm;
+
+  // A tensor with three equal eigenvalues has no distinct eigenvector; any basis is valid.
+  const bool is_isotropic{largest_norm <= zero};
+  const NumericType inverse_largest{is_isotropic ? zero : one / std::sqrt(largest_norm)};
+  const NumericType distinct_x{is_isotropic ? one : largest_x * inverse_largest};
+  const NumericType distinct_y{is_isotropic ? zero : largest_y * inverse_largest};
+  const NumericType distinct_z{is_isotropic ? zero : largest_z * inverse_largest};
+
+  // Orthonormal basis u, v of the plane orthogonal to the distinct eigenvector.
+  const bool is_x_larger{std::abs(distinct_x) > std::abs(distinct_y)};
+  const NumericType u_x{is_x_larger ? -distinct_z : zero};
+  const NumericType u_y{is_x_larger ? zero : distinct_z};
+  const NumericType u_z{is_x_larger ? distinct_x : -distinct_y};
+  const NumericType inverse_u{one / std::sqrt(u_x * u_x + u_y * u_y + u_z * u_z)};
+  const NumericType unit_u_x{u_x * inverse_u};
+  const NumericType unit_u_y{u_y * inverse_u};
+  const NumericType unit_u_z{u_z * inverse_u};
+  const NumericType v_x{distinct_y * unit_u_z - distinct_z * unit_u_y};
+  const NumericType v_y{distinct_z * unit_u_x - distinct_x * unit_u_z};
+  const NumericType v_z{distinct_x * unit_u_y - distinct_y * unit_u_x};
+
+  // Rayleigh quotient of the distinct eigenvector and restriction of the tensor to the plane.
+  const NumericType tensor_d_x{xx * distinct_x + xy * distinct_y + xz * distinct_z};
+  const NumericType tensor_d_y{xy * distinct_x + yy * distinct_y + yz * distinct_z};
+  const NumericType tensor_d_z{xz * distinct_x + yz * distinct_y + zz * distinct_z};
+  const NumericType tensor_u_x{xx * unit_u_x + xy * unit_u_y + xz * unit_u_z};
+  const NumericType tensor_u_y{xy * unit_u_x + yy * unit_u_y + yz * unit_u_z};
+  const NumericType tensor_u_z{xz * unit_u_x + yz * unit_u_y + zz * unit_u_z};
+  const NumericType tensor_v_x{xx * v_x + xy * v_y + xz * v_z};
+  const NumericType tensor_v_y{xy * v_x + yy * v_y + yz * v_z};
+  const NumericType tensor_v_z{xz * v_x + yz * v_y + zz * v_z};
+  const NumericType refined_distinct{
+      distinct_x * tensor_d_x + distinct_y * tensor_d_y + distinct_z * tensor_d_z};
+  const NumericType plane_uu{
+      unit_u_x * tensor_u_x + unit_u_y * tensor_u_y + unit_u_z * tensor_u_z};
+  const NumericType plane_uv{unit_u_x * tensor_v_x + unit_u_y * tensor_v_y + unit_u_z * tensor_v_z};
+  const NumericType plane_vv{v_x * tensor_v_x + v_y * tensor_v_y + v_z * tensor_v_z};
+
+  // Eigenvalues of the restriction, which are the two other eigenvalues of the tensor.
+  const NumericType plane_mean{half * (plane_uu + plane_vv)};
+  const NumericType plane_difference{half * (plane_uu - plane_vv)};
+  const NumericType plane_radius{
+      std::sqrt(plane_difference * plane_difference + plane_uv * plane_uv)};
+  const NumericType plane_high{plane_mean + plane_radius};
+  const NumericType plane_low{plane_mean - plane_radius};
+  const NumericType middle{is_first_distinct ? plane_high : plane_low};
+  first = is_first_distinct ? refined_distinct : plane_high;
+  second = middle;
+  third = is_first_distinct ? plane_low : refined_distinct;
+  // Rounding can otherwise break the order when all three eigenvalues nearly coincide.
+  second = second > first ? first : second;
+  third = third > second ? second : third;
+
+  // The middle eigenvector is orthogonal to the larger row of the restriction minus the middle
+  // eigenvalue.
+  const NumericType m_uu{plane_uu - middle};
+  const NumericType m_vv{plane_vv - middle};
+  const bool is_uu_larger{std::abs(m_uu) >= std::abs(m_vv)};
+  const NumericType coefficient_u{is_uu_larger ? plane_uv : m_vv};
+  const NumericType coefficient_v{is_uu_larger ? m_uu : plane_uv};
+  const NumericType coefficient_norm{
+      coefficient_u * coefficient_u + coefficient_v * coefficient_v};
+  const bool is_degenerate{coefficient_norm <= zero};
+  const NumericType inverse_coefficient{
+      is_degenerate ? zero : one / std::sqrt(coefficient_norm)};
+  const NumericType middle_u{is_degenerate ? one : coefficient_u * inverse_coefficient};
+  const NumericType middle_v{is_degenerate ? zero : -coefficient_v * inverse_coefficient};
+  const NumericType middle_x{middle_u * unit_u_x + middle_v * v_x};
+  const NumericType middle_y{middle_u * unit_u_y + middle_v * v_y};
+  const NumericType middle_z{middle_u * unit_u_z + middle_v * v_z};
+
+  // Complete a right-handed basis in the order of decreasing eigenvalues.
+  const NumericType cross_x{distinct_y * middle_z - distinct_z * middle_y};
+  const NumericType cross_y{distinct_z * middle_x - distinct_x * middle_z};
+  const NumericType cross_z{distinct_x * middle_y - distinct_y * middle_x};
+  eigenvectors[0] = is_first_distinct ? distinct_x : -cross_x;
+  eigenvectors[1] = is_first_distinct ? distinct_y : -cross_y;
+  eigenvectors[2] = is_first_distinct ? distinct_z : -cross_z;
+  eigenvectors[3] = middle_x;
+  eigenvectors[4] = middle_y;
+  eigenvectors[5] = middle_z;
+  eigenvectors[6] = is_first_distinct ? cross_x : distinct_x;
+  eigenvectors[7] = is_first_distinct ? cross_y : distinct_y;
+  eigenvectors[8] = is_first_distinct ? cross_z : distinct_z;
+}
+
+/// \brief Computes the eigenvalues, in decreasing order, of the three-dimensional symmetric dyadic
+/// tensor with the given xx, xy, xz, yy, yz, and zz Cartesian components. This is
+/// PhQ::Internal::SymmetricDyadEigensystem without the eigenvectors, whose computation the compiler
+/// removes. Internal implementation detail not intended to be used outside of the
+/// PhQ::SymmetricDyad class and the PhQ::SymmetricDyadField class.
+template <typename NumericType>
+PHQ_ALWAYS_INLINE inline void SymmetricDyadEigenvalues(
+    const NumericType xx, const NumericType xy, const NumericType xz, const NumericType yy,
+    const NumericType yz, const NumericType zz, NumericType& first, NumericType& second,
+    NumericType& third) noexcept {
+  std::array<NumericType, 9> eigenvectors;
+  SymmetricDyadEigensystem(xx, xy, xz, yy, yz, zz, first, second, third, eigenvectors);
+}
+
+}  // namespace Internal
+
+template <typename NumericType>
+inline std::array<NumericType, 3> SymmetricDyad<NumericType>::Eigenvalues() const {
+  std::array<NumericType, 3> eigenvalues;
+  Internal::SymmetricDyadEigenvalues(
+      xx(), xy(), xz(), yy(), yz(), zz(), eigenvalues[0], eigenvalues[1], eigenvalues[2]);
+  return eigenvalues;
+}
+
 template <typename NumericType>
 inline std::ostream& operator<<(std::ostream& stream, const SymmetricDyad<NumericType>& symmetric) {
   stream << symmetric.Print();
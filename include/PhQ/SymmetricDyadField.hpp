@@ -0,0 +1,897 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_SYMMETRIC_DYAD_FIELD_HPP
+#define PHQ_SYMMETRIC_DYAD_FIELD_HPP
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "AlignedAllocator.hpp"
+#include "DimensionalSymmetricDyad.hpp"
+#include "DimensionlessSymmetricDyad.hpp"
+#include "Direction.hpp"
+#include "QuantityTraits.hpp"
+#include "Simd.hpp"
+#include "StaticPressure.hpp"
+#include "SymmetricDyad.hpp"
+#include "Unit/Pressure.hpp"
+#include "VectorField.hpp"
+
+namespace PhQ {
+
+namespace Internal {
+
+/// \brief Properties of an element of a PhQ::SymmetricDyadField. The unit of measure type is void
+/// for dimensionless elements. Internal implementation detail not intended to be used outside of
+/// the PhQ::SymmetricDyadField class.
+template <typename Unit, typename Numeric>
+struct SymmetricDyadFieldTraits {
+  using UnitType = Unit;
+
+  using NumericType = Numeric;
+};
+
+// The following functions are only declared. They are used in unevaluated contexts to deduce the
+// properties of an element of a symmetric dyadic tensor field from its base class.
+
+template <typename UnitType, typename NumericType>
+SymmetricDyadFieldTraits<UnitType, NumericType> DeduceSymmetricDyadFieldTraits(
+    const DimensionalSymmetricDyad<UnitType, NumericType>*);
+
+template <typename NumericType>
+SymmetricDyadFieldTraits<void, NumericType> DeduceSymmetricDyadFieldTraits(
+    const DimensionlessSymmetricDyad<NumericType>*);
+
+template <typename NumericType>
+SymmetricDyadFieldTraits<void, NumericType> DeduceSymmetricDyadFieldTraits(
+    const SymmetricDyad<NumericType>*);
+
+/// \brief Conversions between an element of a PhQ::SymmetricDyadField and its xx, xy, xz, yy, yz,
+/// and zz Cartesian components. Handles physical quantities derived from
+/// PhQ::DimensionalSymmetricDyad or PhQ::DimensionlessSymmetricDyad, and PhQ::SymmetricDyad itself.
+/// Internal implementation detail not intended to be used outside of the PhQ::SymmetricDyadField
+/// class.
+template <typename Type>
+struct SymmetricDyadFieldElement {
+  using Traits = decltype(DeduceSymmetricDyadFieldTraits(static_cast<const Type*>(nullptr)));
+
+  using UnitType = typename Traits::UnitType;
+
+  using NumericType = typename Traits::NumericType;
+
+  [[nodiscard]] static constexpr Type Make(
+      const NumericType xx, const NumericType xy, const NumericType xz, const NumericType yy,
+      const NumericType yz, const NumericType zz) {
+    if constexpr (std::is_same_v<Type, SymmetricDyad<NumericType>>) {
+      return SymmetricDyad<NumericType>{xx, xy, xz, yy, yz, zz};
+    } else if constexpr (std::is_void_v<UnitType>) {
+      return Type{SymmetricDyad<NumericType>{xx, xy, xz, yy, yz, zz}};
+    } else {
+      return Type::template Create<Standard<UnitType>>(xx, xy, xz, yy, yz, zz);
+    }
+  }
+
+  [[nodiscard]] static constexpr const SymmetricDyad<NumericType>& Value(
+      const Type& element) noexcept {
+    if constexpr (std::is_same_v<Type, SymmetricDyad<NumericType>>) {
+      return element;
+    } else {
+      return element.Value();
+    }
+  }
+};
+
+/// \brief Computes the traces of a given number of symmetric dyadic tensors stored as component
+/// arrays, multiplied by a given number. The output must not overlap the inputs. Internal
+/// implementation detail not intended to be used outside of the PhQ::SymmetricDyadField class.
+template <typename NumericType>
+PHQ_ALWAYS_INLINE inline void TraceKernel(
+    const NumericType* PHQ_RESTRICT xx, const NumericType* PHQ_RESTRICT yy,
+    const NumericType* PHQ_RESTRICT zz, const NumericType number, NumericType* PHQ_RESTRICT output,
+    const std::size_t size) noexcept {
+  for (std::size_t index = 0; index < size; ++index) {
+    output[index] = number * (xx[index] + yy[index] + zz[index]);
+  }
+}
+
+/// \brief Computes the determinants of a given number of symmetric dyadic tensors stored as
+/// component arrays. The output must not overlap the inputs. Internal implementation detail not
+/// intended to be used outside of the PhQ::SymmetricDyadField class.
+template <typename NumericType>
+PHQ_ALWAYS_INLINE inline void DeterminantKernel(
+    const NumericType* PHQ_RESTRICT xx, const NumericType* PHQ_RESTRICT xy,
+    const NumericType* PHQ_RESTRICT xz, const NumericType* PHQ_RESTRICT yy,
+    const NumericType* PHQ_RESTRICT yz, const NumericType* PHQ_RESTRICT zz,
+    NumericType* PHQ_RESTRICT output, const std::size_t size) noexcept {
+  for (std::size_t index = 0; index < size; ++index) {
+    output[index] = xx[index] * (yy[index] * zz[index] - yz[index] * yz[index])
+                    + xy[index] * (yz[index] * xz[index] - xy[index] * zz[index])
+                    + xz[index] * (xy[index] * yz[index] - yy[index] * xz[index]);
+  }
+}
+
+/// \brief Computes the diagonal components of the deviatoric parts of a given number of symmetric
+/// dyadic tensors stored as component arrays. The off-diagonal components of the deviatoric part
+/// are those of the tensor. The outputs must not overlap the inputs. Internal implementation detail
+/// not intended to be used outside of the PhQ::SymmetricDyadField class.
+template <typename NumericType>
+PHQ_ALWAYS_INLINE inline void DeviatoricKernel(
+    const NumericType* PHQ_RESTRICT xx, const NumericType* PHQ_RESTRICT yy,
+    const NumericType* PHQ_RESTRICT zz, NumericType* PHQ_RESTRICT result_xx,
+    NumericType* PHQ_RESTRICT result_yy, NumericType* PHQ_RESTRICT result_zz,
+    const std::size_t size) noexcept {
+  constexpr NumericType third{static_cast<NumericType>(1) / static_cast<NumericType>(3)};
+  for (std::size_t index = 0; index < size; ++index) {
+    const NumericType mean{third * (xx[index] + yy[index] + zz[index])};
+    result_xx[index] = xx[index] - mean;
+    result_yy[index] = yy[index] - mean;
+    result_zz[index] = zz[index] - mean;
+  }
+}
+
+/// \brief Computes the von Mises equivalents of a given number of symmetric dyadic tensors stored
+/// as component arrays. The output must not overlap the inputs. Internal implementation detail not
+/// intended to be used outside of the PhQ::SymmetricDyadField class.
+template <typename NumericType>
+PHQ_ALWAYS_INLINE inline void VonMisesKernel(
+    const NumericType* PHQ_RESTRICT xx, const NumericType* PHQ_RESTRICT xy,
+    const NumericType* PHQ_RESTRICT xz, const NumericType* PHQ_RESTRICT yy,
+    const NumericType* PHQ_RESTRICT yz, const NumericType* PHQ_RESTRICT zz,
+    NumericType* PHQ_RESTRICT output, const std::size_t size) noexcept {
+  for (std::size_t index = 0; index < size; ++index) {
+    const NumericType xx_yy{xx[index] - yy[index]};
+    const NumericType yy_zz{yy[index] - zz[index]};
+    const NumericType zz_xx{zz[index] - xx[index]};
+    const NumericType shear{xy[index] * xy[index] + xz[index] * xz[index] + yz[index] * yz[index]};
+    output[index] = std::sqrt(
+        static_cast<NumericType>(0.5)
+        * (xx_yy * xx_yy + yy_zz * yy_zz + zz_xx * zz_xx + static_cast<NumericType>(6) * shear));
+  }
+}
+
+/// \brief Computes the Frobenius norms of a given number of symmetric dyadic tensors stored as
+/// component arrays. The off-diagonal components count twice. The output must not overlap the
+/// inputs. Internal implementation detail not intended to be used outside of the
+/// PhQ::SymmetricDyadField class.
+template <typename NumericType>
+PHQ_ALWAYS_INLINE inline void FrobeniusNormKernel(
+    const NumericType* PHQ_RESTRICT xx, const NumericType* PHQ_RESTRICT xy,
+    const NumericType* PHQ_RESTRICT xz, const NumericType* PHQ_RESTRICT yy,
+    const NumericType* PHQ_RESTRICT yz, const NumericType* PHQ_RESTRICT zz,
+    NumericType* PHQ_RESTRICT output, const std::size_t size) noexcept {
+  for (std::size_t index = 0; index < size; ++index) {
+    const NumericType shear{xy[index] * xy[index] + xz[index] * xz[index] + yz[index] * yz[index]};
+    output[index] =
+        std::sqrt(xx[index] * xx[index] + yy[index] * yy[index] + zz[index] * zz[index]
+                  + static_cast<NumericType>(2) * shear);
+  }
+}
+
+/// \brief Computes the eigenvalues, in decreasing order, of a given number of symmetric dyadic
+/// tensors stored as component arrays. The outputs must not overlap the inputs. Internal
+/// implementation detail not intended to be used outside of the PhQ::SymmetricDyadField class.
+template <typename NumericType>
+PHQ_ALWAYS_INLINE inline void EigenvaluesKernel(
+    const NumericType* PHQ_RESTRICT xx, const NumericType* PHQ_RESTRICT xy,
+    const NumericType* PHQ_RESTRICT xz, const NumericType* PHQ_RESTRICT yy,
+    const NumericType* PHQ_RESTRICT yz, const NumericType* PHQ_RESTRICT zz,
+    NumericType* PHQ_RESTRICT first, NumericType* PHQ_RESTRICT second,
+    NumericType* PHQ_RESTRICT third, const std::size_t size) noexcept {
+  for (std::size_t index = 0; index < size; ++index) {
+    NumericType first_value;
+    NumericType second_value;
+    NumericType third_value;
+    SymmetricDyadEigenvalues(xx[index], xy[index], xz[index], yy[index], yz[index], zz[index],
+                             first_value, second_value, third_value);
+    first[index] = first_value;
+    second[index] = second_value;
+    third[index] = third_value;
+  }
+}
+
+/// \brief Computes the differences between the largest and smallest eigenvalues of a given number
+/// of symmetric dyadic tensors stored as component arrays, multiplied by a given number. The output
+/// must not overlap the inputs. Internal implementation detail not intended to be used outside of
+/// the PhQ::SymmetricDyadField class.
+template <typename NumericType>
+PHQ_ALWAYS_INLINE inline void EigenvalueRangeKernel(
+    const NumericType* PHQ_RESTRICT xx, const NumericType* PHQ_RESTRICT xy,
+    const NumericType* PHQ_RESTRICT xz, const NumericType* PHQ_RESTRICT yy,
+    const NumericType* PHQ_RESTRICT yz, const NumericType* PHQ_RESTRICT zz,
+    const NumericType number, NumericType* PHQ_RESTRICT output, const std::size_t size) noexcept {
+  for (std::size_t index = 0; index < size; ++index) {
+    NumericType first;
+    NumericType second;
+    NumericType third;
+    SymmetricDyadEigenvalues(
+        xx[index], xy[index], xz[index], yy[index], yz[index], zz[index], first, second, third);
+    output[index] = number * (first - third);
+  }
+}
+
+/// \brief Computes the eigenvectors, in the order of decreasing eigenvalues, of a given number of
+/// symmetric dyadic tensors stored as component arrays. The outputs are the x, y, and z Cartesian
+/// components of the three eigenvectors and must not overlap the inputs. Internal implementation
+/// detail not intended to be used outside of the PhQ::SymmetricDyadField class.
+template <typename NumericType>
+PHQ_ALWAYS_INLINE inline void EigenvectorsKernel(
+    const NumericType* PHQ_RESTRICT xx, const NumericType* PHQ_RESTRICT xy,
+    const NumericType* PHQ_RESTRICT xz, const NumericType* PHQ_RESTRICT yy,
+    const NumericType* PHQ_RESTRICT yz, const NumericType* PHQ_RESTRICT zz,
+    NumericType* PHQ_RESTRICT first_x, NumericType* PHQ_RESTRICT first_y,
+    NumericType* PHQ_RESTRICT first_z, NumericType* PHQ_RESTRICT second_x,
+    NumericType* PHQ_RESTRICT second_y, NumericType* PHQ_RESTRICT second_z,
+    NumericType* PHQ_RESTRICT third_x, NumericType* PHQ_RESTRICT third_y,
+    NumericType* PHQ_RESTRICT third_z, const std::size_t size) noexcept {
+  for (std::size_t index = 0; index < size; ++index) {
+    NumericType first;
+    NumericType second;
+    NumericType third;
+    std::array<NumericType, 9> eigenvectors;
+    SymmetricDyadEigensystem(xx[index], xy[index], xz[index], yy[index], yz[index], zz[index],
+                             first, second, third, eigenvectors);
+    first_x[index] = eigenvectors[0];
+    first_y[index] = eigenvectors[1];
+    first_z[index] = eigenvectors[2];
+    second_x[index] = eigenvectors[3];
+    second_y[index] = eigenvectors[4];
+    second_z[index] = eigenvectors[5];
+    third_x[index] = eigenvectors[6];
+    third_y[index] = eigenvectors[7];
+    third_z[index] = eigenvectors[8];
+  }
+}
+
+}  // namespace Internal
+
+/// \brief Field of three-dimensional symmetric dyadic tensors stored as a structure of arrays: the
+/// xx, xy, xz, yy, yz, and zz Cartesian components of all elements are stored in six separate
+/// contiguous arrays aligned to cache lines, expressed in the standard unit of measure. Compared to
+/// a std::vector of physical quantities, which interleaves the components of each element, this
+/// layout lets field-wide invariants such as traces, determinants, deviatoric parts, von Mises
+/// stresses, hydrostatic pressures, Frobenius norms, and principal values and directions process
+/// consecutive elements with full-width SIMD instructions. Individual elements are accessed
+/// through a proxy that behaves like the physical quantity.
+/// \tparam Quantity Type of the elements: a physical quantity derived from
+/// PhQ::DimensionalSymmetricDyad or PhQ::DimensionlessSymmetricDyad, such as PhQ::Stress<double>,
+/// PhQ::Strain<double>, or PhQ::StrainRate<double>, or PhQ::SymmetricDyad.
+template <typename Quantity>
+class SymmetricDyadField {
+  using Element = Internal::SymmetricDyadFieldElement<Quantity>;
+
+public:
+  /// \brief Floating-point numeric type of the components of this field.
+  using NumericType = typename Element::NumericType;
+
+  /// \brief Type of a component of an element of this field, such as PhQ::ScalarStress<double> for
+  /// a field of PhQ::Stress<double>.
+  using ScalarType = std::decay_t<decltype(std::declval<const Quantity&>().xx())>;
+
+  /// \brief Proxy to an element of a mutable field. It converts to the physical quantity and can be
+  /// assigned from one.
+  class Reference {
+  public:
+    /// \brief Returns the element as a physical quantity.
+    operator Quantity() const {
+      const SymmetricDyad<NumericType> value{Value()};
+      return Element::Make(value.xx(), value.xy(), value.xz(), value.yy(), value.yz(), value.zz());
+    }
+
+    /// \brief Assigns a given physical quantity to the element.
+    Reference& operator=(const Quantity& quantity) noexcept {
+      const std::array<NumericType, 6>& value{Element::Value(quantity).xx_xy_xz_yy_yz_zz()};
+      for (std::size_t component = 0; component < 6; ++component) {
+        field_->components_[component][index_] = value[component];
+      }
+      return *this;
+    }
+
+    /// \brief Assigns the element referenced by another proxy to the element.
+    Reference& operator=(const Reference& other) noexcept {
+      return *this = static_cast<Quantity>(other);
+    }
+
+    /// \brief Returns the value of the element expressed in the standard unit of measure.
+    [[nodiscard]] SymmetricDyad<NumericType> Value() const noexcept {
+      return SymmetricDyad<NumericType>{
+          field_->components_[0][index_], field_->components_[1][index_],
+          field_->components_[2][index_], field_->components_[3][index_],
+          field_->components_[4][index_], field_->components_[5][index_]};
+    }
+
+    Reference& operator+=(const Quantity& quantity) noexcept {
+      const std::array<NumericType, 6>& value{Element::Value(quantity).xx_xy_xz_yy_yz_zz()};
+      for (std::size_t component = 0; component < 6; ++component) {
+        field_->components_[component][index_] += value[component];
+      }
+      return *this;
+    }
+
+    Reference& operator-=(const Quantity& quantity) noexcept {
+      const std::array<NumericType, 6>& value{Element::Value(quantity).xx_xy_xz_yy_yz_zz()};
+      for (std::size_t component = 0; component < 6; ++component) {
+        field_->components_[component][index_] -= value[component];
+      }
+      return *this;
+    }
+
+    Reference& operator*=(const NumericType number) noexcept {
+      for (std::size_t component = 0; component < 6; ++component) {
+        field_->components_[component][index_] *= number;
+      }
+      return *this;
+    }
+
+    Reference& operator/=(const NumericType number) noexcept {
+      for (std::size_t component = 0; component < 6; ++component) {
+        field_->components_[component][index_] /= number;
+      }
+      return *this;
+    }
+
+    friend bool operator==(const Reference& left, const Quantity& right) noexcept {
+      return left.Value() == Element::Value(right);
+    }
+
+    friend bool operator==(const Quantity& left, const Reference& right) noexcept {
+      return Element::Value(left) == right.Value();
+    }
+
+    friend bool operator!=(const Reference& left, const Quantity& right) noexcept {
+      return left.Value() != Element::Value(right);
+    }
+
+    friend bool operator!=(const Quantity& left, const Reference& right) noexcept {
+      return Element::Value(left) != right.Value();
+    }
+
+  private:
+    Reference(SymmetricDyadField* const field, const std::size_t index) noexcept
+      : field_(field), index_(index) {}
+
+    SymmetricDyadField* field_;
+
+    std::size_t index_;
+
+    friend class SymmetricDyadField;
+  };
+
+  /// \brief Default constructor. Constructs an empty field.
+  SymmetricDyadField() = default;
+
+  /// \brief Constructor. Constructs a field of a given number of elements of zero.
+  explicit SymmetricDyadField(const std::size_t size) {
+    Resize(size);
+  }
+
+  /// \brief Constructor. Constructs a field of a given number of copies of a given element.
+  SymmetricDyadField(const std::size_t size, const Quantity& quantity) {
+    const std::array<NumericType, 6>& value{Element::Value(quantity).xx_xy_xz_yy_yz_zz()};
+    for (std::size_t component = 0; component < 6; ++component) {
+      components_[component].assign(size, value[component]);
+    }
+  }
+
+  /// \brief Constructor. Constructs a field from a contiguous sequence of a given number of
+  /// elements.
+  SymmetricDyadField(const Quantity* const quantities, const std::size_t size) {
+    Resize(size);
+    for (std::size_t index = 0; index < size; ++index) {
+      const std::array<NumericType, 6>& value{
+          Element::Value(quantities[index]).xx_xy_xz_yy_yz_zz()};
+      for (std::size_t component = 0; component < 6; ++component) {
+        components_[component][index] = value[component];
+      }
+    }
+  }
+
+  /// \brief Constructor. Constructs a field from a std::vector of elements.
+  explicit SymmetricDyadField(const std::vector<Quantity>& quantities)
+    : SymmetricDyadField(quantities.data(), quantities.size()) {}
+
+  /// \brief Returns the number of elements of this field.
+  [[nodiscard]] std::size_t Size() const noexcept {
+    return components_[0].size();
+  }
+
+  /// \brief Returns whether this field has no elements.
+  [[nodiscard]] bool Empty() const noexcept {
+    return components_[0].empty();
+  }
+
+  /// \brief Resizes this field to a given number of elements. New elements are zero.
+  void Resize(const std::size_t size) {
+    for (Internal::AlignedVector<NumericType>& values : components_) {
+      values.resize(size);
+    }
+  }
+
+  /// \brief Reserves storage for a given number of elements.
+  void Reserve(const std::size_t size) {
+    for (Internal::AlignedVector<NumericType>& values : components_) {
+      values.reserve(size);
+    }
+  }
+
+  /// \brief Removes all elements of this field.
+  void Clear() noexcept {
+    for (Internal::AlignedVector<NumericType>& values : components_) {
+      values.clear();
+    }
+  }
+
+  /// \brief Appends a given element to the end of this field.
+  void PushBack(const Quantity& quantity) {
+    const std::array<NumericType, 6>& value{Element::Value(quantity).xx_xy_xz_yy_yz_zz()};
+    for (std::size_t component = 0; component < 6; ++component) {
+      components_[component].push_back(value[component]);
+    }
+  }
+
+  /// \brief Returns a pointer to the contiguous xx Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure.
+  [[nodiscard]] const NumericType* xx() const noexcept {
+    return components_[0].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous xx Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure, as mutable values.
+  [[nodiscard]] NumericType* xx() noexcept {
+    return components_[0].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous xy = yx Cartesian components of the elements of
+  /// this field, expressed in the standard unit of measure.
+  [[nodiscard]] const NumericType* xy() const noexcept {
+    return components_[1].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous xy = yx Cartesian components of the elements of
+  /// this field, expressed in the standard unit of measure, as mutable values.
+  [[nodiscard]] NumericType* xy() noexcept {
+    return components_[1].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous xz = zx Cartesian components of the elements of
+  /// this field, expressed in the standard unit of measure.
+  [[nodiscard]] const NumericType* xz() const noexcept {
+    return components_[2].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous xz = zx Cartesian components of the elements of
+  /// this field, expressed in the standard unit of measure, as mutable values.
+  [[nodiscard]] NumericType* xz() noexcept {
+    return components_[2].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous yy Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure.
+  [[nodiscard]] const NumericType* yy() const noexcept {
+    return components_[3].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous yy Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure, as mutable values.
+  [[nodiscard]] NumericType* yy() noexcept {
+    return components_[3].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous yz = zy Cartesian components of the elements of
+  /// this field, expressed in the standard unit of measure.
+  [[nodiscard]] const NumericType* yz() const noexcept {
+    return components_[4].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous yz = zy Cartesian components of the elements of
+  /// this field, expressed in the standard unit of measure, as mutable values.
+  [[nodiscard]] NumericType* yz() noexcept {
+    return components_[4].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous zz Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure.
+  [[nodiscard]] const NumericType* zz() const noexcept {
+    return components_[5].data();
+  }
+
+  /// \brief Returns a pointer to the contiguous zz Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure, as mutable values.
+  [[nodiscard]] NumericType* zz() noexcept {
+    return components_[5].data();
+  }
+
+  /// \brief Returns the element at a given index. The index must be less than Size().
+  [[nodiscard]] Quantity operator[](const std::size_t index) const {
+    return Element::Make(components_[0][index], components_[1][index], components_[2][index],
+                         components_[3][index], components_[4][index], components_[5][index]);
+  }
+
+  /// \brief Returns a proxy to the element at a given index. The index must be less than Size().
+  [[nodiscard]] Reference operator[](const std::size_t index) noexcept {
+    return Reference{this, index};
+  }
+
+  /// \brief Returns the elements of this field as a std::vector of elements.
+  [[nodiscard]] std::vector<Quantity> Quantities() const {
+    std::vector<Quantity> quantities;
+    quantities.reserve(Size());
+    for (std::size_t index = 0; index < Size(); ++index) {
+      quantities.push_back((*this)[index]);
+    }
+    return quantities;
+  }
+
+  /// \brief Computes the traces of the elements of this field into a caller-provided contiguous
+  /// sequence of Size() scalars.
+  void Trace(ScalarType* const traces) const noexcept {
+    Trace(static_cast<NumericType>(1), Internal::ScalarComponents<ScalarType, NumericType>(traces));
+  }
+
+  /// \brief Returns the traces of the elements of this field.
+  [[nodiscard]] std::vector<ScalarType> Trace() const {
+    std::vector<ScalarType> traces(Size());
+    Trace(traces.data());
+    return traces;
+  }
+
+  /// \brief Computes the determinants of the elements of this field into a caller-provided
+  /// contiguous sequence of Size() values. The determinants are expressed in the cube of the
+  /// standard unit of measure of this field.
+  void Determinant(NumericType* const output) const noexcept {
+    const NumericType* const xx{components_[0].data()};
+    const NumericType* const xy{components_[1].data()};
+    const NumericType* const xz{components_[2].data()};
+    const NumericType* const yy{components_[3].data()};
+    const NumericType* const yz{components_[4].data()};
+    const NumericType* const zz{components_[5].data()};
+    const std::size_t size{Size()};
+    Internal::RunKernel(
+        [=]() PHQ_ALWAYS_INLINE {
+          Internal::DeterminantKernel(xx, xy, xz, yy, yz, zz, output, size);
+        },
+        size);
+  }
+
+  /// \brief Returns the determinants of the elements of this field, expressed in the cube of the
+  /// standard unit of measure of this field.
+  [[nodiscard]] std::vector<NumericType> Determinant() const {
+    std::vector<NumericType> output(Size());
+    Determinant(output.data());
+    return output;
+  }
+
+  /// \brief Returns the deviatoric parts of the elements of this field, which are the elements
+  /// minus their mean normal components on their diagonals.
+  [[nodiscard]] SymmetricDyadField<Quantity> Deviatoric() const {
+    SymmetricDyadField<Quantity> result{*this};
+    const NumericType* const xx{components_[0].data()};
+    const NumericType* const yy{components_[3].data()};
+    const NumericType* const zz{components_[5].data()};
+    NumericType* const result_xx{result.xx()};
+    NumericType* const result_yy{result.yy()};
+    NumericType* const result_zz{result.zz()};
+    const std::size_t size{Size()};
+    Internal::RunKernel(
+        [=]() PHQ_ALWAYS_INLINE {
+          Internal::DeviatoricKernel(xx, yy, zz, result_xx, result_yy, result_zz, size);
+        },
+        size);
+    return result;
+  }
+
+  /// \brief Computes the von Mises stresses of the elements of this stress field using the von
+  /// Mises yield criterion into a caller-provided contiguous sequence of Size() scalar stresses.
+  /// Only available for fields of PhQ::Stress.
+  void VonMises(ScalarType* const von_mises) const noexcept {
+    static_assert(std::is_same_v<typename Element::UnitType, Unit::Pressure>,
+                  "The von Mises stress is only defined for a field of stress tensors.");
+    NumericType* const output{Internal::ScalarComponents<ScalarType, NumericType>(von_mises)};
+    const NumericType* const xx{components_[0].data()};
+    const NumericType* const xy{components_[1].data()};
+    const NumericType* const xz{components_[2].data()};
+    const NumericType* const yy{components_[3].data()};
+    const NumericType* const yz{components_[4].data()};
+    const NumericType* const zz{components_[5].data()};
+    const std::size_t size{Size()};
+    Internal::RunKernel(
+        [=]() PHQ_ALWAYS_INLINE { Internal::VonMisesKernel(xx, xy, xz, yy, yz, zz, output, size); },
+        size);
+  }
+
+  /// \brief Returns the von Mises stresses of the elements of this stress field using the von Mises
+  /// yield criterion. Only available for fields of PhQ::Stress.
+  [[nodiscard]] std::vector<ScalarType> VonMises() const {
+    std::vector<ScalarType> von_mises(Size());
+    VonMises(von_mises.data());
+    return von_mises;
+  }
+
+  /// \brief Computes the hydrostatic pressures of the elements of this stress field, which are the
+  /// negatives of their mean normal stresses, into a caller-provided contiguous sequence of Size()
+  /// static pressures. Only available for fields of PhQ::Stress.
+  void HydrostaticPressure(StaticPressure<NumericType>* const pressures) const noexcept {
+    static_assert(std::is_same_v<typename Element::UnitType, Unit::Pressure>,
+                  "The hydrostatic pressure is only defined for a field of stress tensors.");
+    Trace(static_cast<NumericType>(-1) / static_cast<NumericType>(3),
+          Internal::ScalarComponents<StaticPressure<NumericType>, NumericType>(pressures));
+  }
+
+  /// \brief Returns the hydrostatic pressures of the elements of this stress field, which are the
+  /// negatives of their mean normal stresses. Only available for fields of PhQ::Stress.
+  [[nodiscard]] std::vector<StaticPressure<NumericType>> HydrostaticPressure() const {
+    std::vector<StaticPressure<NumericType>> pressures(Size());
+    HydrostaticPressure(pressures.data());
+    return pressures;
+  }
+
+  /// \brief Computes the Frobenius norms of the elements of this field into a caller-provided
+  /// contiguous sequence of Size() scalars. The off-diagonal components of an element count twice
+  /// since they appear twice in the full tensor.
+  void FrobeniusNorm(ScalarType* const norms) const noexcept {
+    NumericType* const output{Internal::ScalarComponents<ScalarType, NumericType>(norms)};
+    const NumericType* const xx{components_[0].data()};
+    const NumericType* const xy{components_[1].data()};
+    const NumericType* const xz{components_[2].data()};
+    const NumericType* const yy{components_[3].data()};
+    const NumericType* const yz{components_[4].data()};
+    const NumericType* const zz{components_[5].data()};
+    const std::size_t size{Size()};
+    Internal::RunKernel(
+        [=]() PHQ_ALWAYS_INLINE {
+          Internal::FrobeniusNormKernel(xx, xy, xz, yy, yz, zz, output, size);
+        },
+        size);
+  }
+
+  /// \brief Returns the Frobenius norms of the elements of this field. The off-diagonal components
+  /// of an element count twice since they appear twice in the full tensor.
+  [[nodiscard]] std::vector<ScalarType> FrobeniusNorm() const {
+    std::vector<ScalarType> norms(Size());
+    FrobeniusNorm(norms.data());
+    return norms;
+  }
+
+  /// \brief Computes the principal values of the elements of this field, which are their
+  /// eigenvalues, into three caller-provided contiguous sequences of Size() scalars that receive
+  /// the largest, middle, and smallest principal values of each element, respectively.
+  void PrincipalValues(ScalarType* const first, ScalarType* const second,
+                       ScalarType* const third) const noexcept {
+    NumericType* const first_values{Internal::ScalarComponents<ScalarType, NumericType>(first)};
+    NumericType* const second_values{Internal::ScalarComponents<ScalarType, NumericType>(second)};
+    NumericType* const third_values{Internal::ScalarComponents<ScalarType, NumericType>(third)};
+    const NumericType* const xx{components_[0].data()};
+    const NumericType* const xy{components_[1].data()};
+    const NumericType* const xz{components_[2].data()};
+    const NumericType* const yy{components_[3].data()};
+    const NumericType* const yz{components_[4].data()};
+    const NumericType* const zz{components_[5].data()};
+    const std::size_t size{Size()};
+    Internal::RunKernel(
+        [=]() PHQ_ALWAYS_INLINE {
+          Internal::EigenvaluesKernel(
+              xx, xy, xz, yy, yz, zz, first_values, second_values, third_values, size);
+        },
+        size);
+  }
+
+  /// \brief Returns the principal values of the elements of this field, which are their
+  /// eigenvalues, as three sequences that hold the largest, middle, and smallest principal values
+  /// of each element, respectively.
+  [[nodiscard]] std::array<std::vector<ScalarType>, 3> PrincipalValues() const {
+    std::array<std::vector<ScalarType>, 3> principal_values{std::vector<ScalarType>(Size()),
+                                                            std::vector<ScalarType>(Size()),
+                                                            std::vector<ScalarType>(Size())};
+    PrincipalValues(
+        principal_values[0].data(), principal_values[1].data(), principal_values[2].data());
+    return principal_values;
+  }
+
+  /// \brief Returns the principal directions of the elements of this field, which are their
+  /// eigenvectors, as three fields of directions that correspond to the largest, middle, and
+  /// smallest principal values of each element, respectively. The three principal directions of an
+  /// element form a right-handed orthonormal basis.
+  [[nodiscard]] std::array<VectorField<PhQ::Direction<NumericType>>, 3>
+  PrincipalDirections() const {
+    const std::size_t size{Size()};
+    std::array<VectorField<PhQ::Direction<NumericType>>, 3> directions{
+        VectorField<PhQ::Direction<NumericType>>(size),
+        VectorField<PhQ::Direction<NumericType>>(size),
+        VectorField<PhQ::Direction<NumericType>>(size)};
+    const NumericType* const xx{components_[0].data()};
+    const NumericType* const xy{components_[1].data()};
+    const NumericType* const xz{components_[2].data()};
+    const NumericType* const yy{components_[3].data()};
+    const NumericType* const yz{components_[4].data()};
+    const NumericType* const zz{components_[5].data()};
+    NumericType* const first_x{directions[0].x()};
+    NumericType* const first_y{directions[0].y()};
+    NumericType* const first_z{directions[0].z()};
+    NumericType* const second_x{directions[1].x()};
+    NumericType* const second_y{directions[1].y()};
+    NumericType* const second_z{directions[1].z()};
+    NumericType* const third_x{directions[2].x()};
+    NumericType* const third_y{directions[2].y()};
+    NumericType* const third_z{directions[2].z()};
+    Internal::RunKernel(
+        [=]() PHQ_ALWAYS_INLINE {
+          Internal::EigenvectorsKernel(xx, xy, xz, yy, yz, zz, first_x, first_y, first_z, second_x,
+                                       second_y, second_z, third_x, third_y, third_z, size);
+        },
+        size);
+    return directions;
+  }
+
+  /// \brief Computes the maximum shear components of the elements of this field, which are half the
+  /// differences between their largest and smallest principal values, into a caller-provided
+  /// contiguous sequence of Size() scalars.
+  void MaximumShear(ScalarType* const maximum_shears) const noexcept {
+    EigenvalueRange(static_cast<NumericType>(0.5),
+                    Internal::ScalarComponents<ScalarType, NumericType>(maximum_shears));
+  }
+
+  /// \brief Returns the maximum shear components of the elements of this field, which are half the
+  /// differences between their largest and smallest principal values.
+  [[nodiscard]] std::vector<ScalarType> MaximumShear() const {
+    std::vector<ScalarType> maximum_shears(Size());
+    MaximumShear(maximum_shears.data());
+    return maximum_shears;
+  }
+
+  /// \brief Computes the Tresca stresses of the elements of this stress field using the Tresca
+  /// yield criterion, which are the differences between their largest and smallest principal
+  /// stresses, into a caller-provided contiguous sequence of Size() scalar stresses. Only available
+  /// for fields of PhQ::Stress.
+  void Tresca(ScalarType* const tresca) const noexcept {
+    static_assert(std::is_same_v<typename Element::UnitType, Unit::Pressure>,
+                  "The Tresca stress is only defined for a field of stress tensors.");
+    EigenvalueRange(
+        static_cast<NumericType>(1), Internal::ScalarComponents<ScalarType, NumericType>(tresca));
+  }
+
+  /// \brief Returns the Tresca stresses of the elements of this stress field using the Tresca yield
+  /// criterion, which are the differences between their largest and smallest principal stresses.
+  /// Only available for fields of PhQ::Stress.
+  [[nodiscard]] std::vector<ScalarType> Tresca() const {
+    std::vector<ScalarType> tresca(Size());
+    Tresca(tresca.data());
+    return tresca;
+  }
+
+  /// \brief Adds the elements of another field of the same size, multiplied by a given number, to
+  /// the elements of this field in place.
+  void AddScaled(const NumericType number, const SymmetricDyadField<Quantity>& other) noexcept {
+    const std::size_t size{Size()};
+    for (std::size_t component = 0; component < 6; ++component) {
+      NumericType* const values{components_[component].data()};
+      const NumericType* const other_values{other.components_[component].data()};
+      Internal::RunKernel(
+          [=]() PHQ_ALWAYS_INLINE {
+            Internal::AddScaledKernel(values, number, other_values, size);
+          },
+          size);
+    }
+  }
+
+  SymmetricDyadField<Quantity> operator+(const SymmetricDyadField<Quantity>& other) const {
+    SymmetricDyadField<Quantity> result{*this};
+    result += other;
+    return result;
+  }
+
+  SymmetricDyadField<Quantity> operator-(const SymmetricDyadField<Quantity>& other) const {
+    SymmetricDyadField<Quantity> result{*this};
+    result -= other;
+    return result;
+  }
+
+  SymmetricDyadField<Quantity> operator*(const NumericType number) const {
+    SymmetricDyadField<Quantity> result{*this};
+    result *= number;
+    return result;
+  }
+
+  SymmetricDyadField<Quantity> operator/(const NumericType number) const {
+    SymmetricDyadField<Quantity> result{*this};
+    result /= number;
+    return result;
+  }
+
+  void operator+=(const SymmetricDyadField<Quantity>& other) noexcept {
+    AddScaled(static_cast<NumericType>(1), other);
+  }
+
+  void operator-=(const SymmetricDyadField<Quantity>& other) noexcept {
+    AddScaled(static_cast<NumericType>(-1), other);
+  }
+
+  void operator*=(const NumericType number) noexcept {
+    const std::size_t size{Size()};
+    for (Internal::AlignedVector<NumericType>& component : components_) {
+      NumericType* const values{component.data()};
+      Internal::RunKernel(
+          [=]() PHQ_ALWAYS_INLINE { Internal::ScaleKernel(values, number, size); }, size);
+    }
+  }
+
+  void operator/=(const NumericType number) noexcept {
+    *this *= static_cast<NumericType>(1) / number;
+  }
+
+  bool operator==(const SymmetricDyadField<Quantity>& other) const noexcept {
+    return components_ == other.components_;
+  }
+
+  bool operator!=(const SymmetricDyadField<Quantity>& other) const noexcept {
+    return !(*this == other);
+  }
+
+private:
+  // Computes the traces of the elements of this field, multiplied by a given number, into a given
+  // contiguous sequence of Size() values.
+  void Trace(const NumericType number, NumericType* const output) const noexcept {
+    const NumericType* const xx{components_[0].data()};
+    const NumericType* const yy{components_[3].data()};
+    const NumericType* const zz{components_[5].data()};
+    const std::size_t size{Size()};
+    Internal::RunKernel(
+        [=]() PHQ_ALWAYS_INLINE { Internal::TraceKernel(xx, yy, zz, number, output, size); },
+        size);
+  }
+
+  // Computes the differences between the largest and smallest principal values of the elements of
+  // this field, multiplied by a given number, into a given contiguous sequence of Size() values.
+  void EigenvalueRange(const NumericType number, NumericType* const output) const noexcept {
+    const NumericType* const xx{components_[0].data()};
+    const NumericType* const xy{components_[1].data()};
+    const NumericType* const xz{components_[2].data()};
+    const NumericType* const yy{components_[3].data()};
+    const NumericType* const yz{components_[4].data()};
+    const NumericType* const zz{components_[5].data()};
+    const std::size_t size{Size()};
+    Internal::RunKernel(
+        [=]() PHQ_ALWAYS_INLINE {
+          Internal::EigenvalueRangeKernel(xx, xy, xz, yy, yz, zz, number, output, size);
+        },
+        size);
+  }
+
+  // Component arrays in the order xx, xy, xz, yy, yz, and zz, as in PhQ::SymmetricDyad.
+  std::array<Internal::AlignedVector<NumericType>, 6> components_;
+};
+
+template <typename Quantity>
+inline SymmetricDyadField<Quantity> operator*(
+    const typename SymmetricDyadField<Quantity>::NumericType number,
+    const SymmetricDyadField<Quantity>& field) {
+  return field * number;
+}
+
+}  // namespace PhQ
+
+#endif  // PHQ_SYMMETRIC_DYAD_FIELD_HPP
@@ -25,13 +25,22 @@
 #ifndef PHQ_UNIT_HPP
 #define PHQ_UNIT_HPP
 
-#include <functional>
+#include <algorithm>
+#include <array>
+#include <cstddef>
 #include <type_traits>
+#include <utility>
 #include <vector>
 
+#if __cplusplus >= 202002L
+  #include <span>
+#endif
+
 #include "Dimensions.hpp"
 #include "Dyad.hpp"
+#include "Parallel.hpp"
 #include "PlanarVector.hpp"
+#include "Simd.hpp"
 #include "SymmetricDyad.hpp"
 #include "UnitSystem.hpp"
 #include "Vector.hpp"
@@ -67,9 +76,232 @@ public:
   static inline constexpr void ToStandard(NumericType& value) noexcept;
 };
 
-/// \brief Abstract class for converting a sequence of values expressed in a unit of measure to or
-/// from the standard unit of measure of that type. Internal implementation detail not intended to
+/// \brief Number of units of measure of a given type. Units of measure are enumerations whose
+/// enumerators are numbered consecutively starting from zero, so this is also the size of any
+/// table indexed by a unit of measure of that type. Internal implementation detail not intended to
 /// be used outside of the PhQ::ConvertInPlace, PhQ::Convert, and PhQ::ConvertStatically functions.
+template <typename Unit>
+inline constexpr const std::size_t NumberOfUnits;
+
+/// \brief Affine map that converts a value expressed in one unit of measure to another unit of
+/// measure of the same type. The converted value is computed as `scale * value + offset`. All
+/// units of measure in the library are related to one another by such affine maps; the offset is
+/// zero except for units such as the degree Celsius and the degree Fahrenheit. Internal
+/// implementation detail not intended to be used outside of the PhQ::ConvertInPlace, PhQ::Convert,
+/// and PhQ::ConvertStatically functions.
+template <typename NumericType>
+class AffineConversion {
+public:
+  /// \brief Default constructor. Constructs the identity affine map.
+  constexpr AffineConversion() noexcept : scale_(static_cast<NumericType>(1)), offset_() {}
+
+  /// \brief Constructor. Constructs an affine map from a given scale and a given offset.
+  constexpr AffineConversion(const NumericType scale, const NumericType offset) noexcept
+    : scale_(scale), offset_(offset) {}
+
+  /// \brief Multiplicative coefficient of this affine map.
+  [[nodiscard]] constexpr NumericType Scale() const noexcept {
+    return scale_;
+  }
+
+  /// \brief Additive coefficient of this affine map.
+  [[nodiscard]] constexpr NumericType Offset() const noexcept {
+    return offset_;
+  }
+
+  /// \brief Applies this affine map to a given value. The conversion is performed in-place.
+  constexpr void Apply(NumericType& value) const noexcept {
+    value = scale_ * value + offset_;
+  }
+
+  /// \brief Applies this affine map to a sequence of values. The conversion is performed in-place.
+  constexpr void Apply(NumericType* values, const std::size_t size) const noexcept {
+    Apply(values, values, size);
+  }
+
+  /// \brief Applies this affine map to a sequence of input values and writes the results to a
+  /// sequence of output values of the same size in a single pass. The input and output sequences
+  /// must either be the same sequence or not overlap. Long sequences of single-precision or
+  /// double-precision values are converted by an explicitly vectorized kernel.
+  constexpr void Apply(
+      const NumericType* input, NumericType* output, const std::size_t size) const noexcept {
+    if (IsConstantEvaluated()) {
+      AffineKernelScalar(input, output, size, scale_, offset_);
+    } else {
+      AffineKernel(input, output, size, scale_, offset_);
+    }
+  }
+
+private:
+  NumericType scale_;
+
+  NumericType offset_;
+};
+
+/// \brief Computes the affine map that corresponds to a given conversion function. Purely
+/// multiplicative conversion functions are evaluated at one in the given numeric type, which
+/// reproduces exactly the factor that they apply. Other conversion functions are evaluated in
+/// extended precision at zero, which yields the offset, and at a large power of two, which yields
+/// the scale without being polluted by the rounding error of the offset. Internal implementation
+/// detail not intended to be used outside of the PhQ::ConvertInPlace, PhQ::Convert, and
+/// PhQ::ConvertStatically functions.
+template <typename NumericType, typename Function, typename ExtendedFunction>
+[[nodiscard]] inline constexpr AffineConversion<NumericType> MakeAffineConversion(
+    const Function function, const ExtendedFunction extended_function) noexcept {
+  long double offset{0.0L};
+  extended_function(offset);
+  if (offset == 0.0L) {
+    NumericType scale{static_cast<NumericType>(1)};
+    function(scale);
+    return {scale, static_cast<NumericType>(0)};
+  }
+  constexpr long double abscissa{1048576.0L};
+  long double scale{abscissa};
+  extended_function(scale);
+  scale = (scale - offset) / abscissa;
+  return {static_cast<NumericType>(scale), static_cast<NumericType>(offset)};
+}
+
+/// \brief Builds the table of affine maps that convert values expressed in the standard unit of
+/// measure of a given type to each unit of measure of that type. Internal implementation detail
+/// not intended to be used outside of the PhQ::ConvertInPlace, PhQ::Convert, and
+/// PhQ::ConvertStatically functions.
+template <typename Unit, typename NumericType, std::size_t... Indices>
+[[nodiscard]] inline constexpr std::array<AffineConversion<NumericType>, sizeof...(Indices)>
+MakeArrayOfConversionsFromStandard(std::index_sequence<Indices...> /*indices*/) noexcept {
+  return {MakeAffineConversion<NumericType>(
+      Conversion<Unit, static_cast<Unit>(Indices)>::template FromStandard<NumericType>,
+      Conversion<Unit, static_cast<Unit>(Indices)>::template FromStandard<long double>)...};
+}
+
+/// \brief Builds the table of affine maps that convert values expressed in each unit of measure of
+/// a given type to the standard unit of measure of that type. Internal implementation detail not
+/// intended to be used outside of the PhQ::ConvertInPlace, PhQ::Convert, and
+/// PhQ::ConvertStatically functions.
+template <typename Unit, typename NumericType, std::size_t... Indices>
+[[nodiscard]] inline constexpr std::array<AffineConversion<NumericType>, sizeof...(Indices)>
+MakeArrayOfConversionsToStandard(std::index_sequence<Indices...> /*indices*/) noexcept {
+  return {MakeAffineConversion<NumericType>(
+      Conversion<Unit, static_cast<Unit>(Indices)>::template ToStandard<NumericType>,
+      Conversion<Unit, static_cast<Unit>(Indices)>::template ToStandard<long double>)...};
+}
+
+/// \brief Table of affine maps for converting values expressed in the standard unit of measure of
+/// a given type to any given unit of measure of that type. The table is indexed by the units of
+/// measure's underlying values and is generated at compile time from the PhQ::Internal::Conversion
+/// specializations. Internal implementation detail not intended to be used outside of the
+/// PhQ::ConvertInPlace, PhQ::Convert, and PhQ::ConvertStatically functions.
+template <typename Unit, typename NumericType>
+inline constexpr const std::array<AffineConversion<NumericType>, NumberOfUnits<Unit>>
+    ArrayOfConversionsFromStandard{MakeArrayOfConversionsFromStandard<Unit, NumericType>(
+        std::make_index_sequence<NumberOfUnits<Unit>>{})};
+
+/// \brief Table of affine maps for converting values expressed in any given unit of measure of a
+/// given type to the standard unit of measure of that type. The table is indexed by the units of
+/// measure's underlying values and is generated at compile time from the
+/// PhQ::Internal::Conversion specializations. Internal implementation detail not intended to be
+/// used outside of the PhQ::ConvertInPlace, PhQ::Convert, and PhQ::ConvertStatically functions.
+template <typename Unit, typename NumericType>
+inline constexpr const std::array<AffineConversion<NumericType>, NumberOfUnits<Unit>>
+    ArrayOfConversionsToStandard{MakeArrayOfConversionsToStandard<Unit, NumericType>(
+        std::make_index_sequence<NumberOfUnits<Unit>>{})};
+
+/// \brief Composes two affine maps: the resulting affine map applies the first one and then the
+/// second one. Internal implementation detail not intended to be used outside of the
+/// PhQ::ConvertInPlace, PhQ::Convert, and PhQ::ConvertStatically functions.
+template <typename NumericType>
+[[nodiscard]] inline constexpr AffineConversion<NumericType> Compose(
+    const AffineConversion<long double>& first,
+    const AffineConversion<long double>& second) noexcept {
+  return {static_cast<NumericType>(second.Scale() * first.Scale()),
+          static_cast<NumericType>(second.Scale() * first.Offset() + second.Offset())};
+}
+
+/// \brief Computes the affine map that converts values expressed in a given original unit of
+/// measure directly to a given new unit of measure. When either unit of measure is the standard
+/// one, this is the corresponding entry of the conversion tables to or from the standard unit of
+/// measure, so that conversions to or from the standard unit of measure are unaffected by the
+/// fusion. Otherwise, it is the composition of a conversion to the standard unit of measure and of
+/// a conversion from the standard unit of measure, computed in extended precision so that only one
+/// rounding occurs. Internal implementation detail not intended to be used outside of the
+/// PhQ::ConvertInPlace, PhQ::Convert, and PhQ::ConvertStatically functions.
+template <typename Unit, typename NumericType>
+[[nodiscard]] inline constexpr AffineConversion<NumericType> MakeConversionBetween(
+    const std::size_t original_index, const std::size_t new_index) noexcept {
+  constexpr std::size_t standard_index{static_cast<std::size_t>(Standard<Unit>)};
+  if (original_index == new_index) {
+    return {};
+  }
+  if (original_index == standard_index) {
+    return ArrayOfConversionsFromStandard<Unit, NumericType>[new_index];
+  }
+  if (new_index == standard_index) {
+    return ArrayOfConversionsToStandard<Unit, NumericType>[original_index];
+  }
+  return Compose<NumericType>(ArrayOfConversionsToStandard<Unit, long double>[original_index],
+                              ArrayOfConversionsFromStandard<Unit, long double>[new_index]);
+}
+
+/// \brief Builds the matrix of affine maps that convert values expressed in any unit of measure of
+/// a given type directly to any other unit of measure of that type. Internal implementation detail
+/// not intended to be used outside of the PhQ::ConvertInPlace, PhQ::Convert, and
+/// PhQ::ConvertStatically functions.
+template <typename Unit, typename NumericType, std::size_t... Indices>
+[[nodiscard]] inline constexpr std::array<AffineConversion<NumericType>, sizeof...(Indices)>
+MakeMatrixOfConversions(std::index_sequence<Indices...> /*indices*/) noexcept {
+  return {MakeConversionBetween<Unit, NumericType>(
+      Indices / NumberOfUnits<Unit>, Indices % NumberOfUnits<Unit>)...};
+}
+
+/// \brief Matrix of affine maps for converting values expressed in any given unit of measure of a
+/// given type directly to any other given unit of measure of that type in a single step. The
+/// matrix is stored in row-major order: rows correspond to original units of measure and columns
+/// correspond to new units of measure. Internal implementation detail not intended to be used
+/// outside of the PhQ::ConvertInPlace, PhQ::Convert, and PhQ::ConvertStatically functions.
+template <typename Unit, typename NumericType>
+inline constexpr const std::array<AffineConversion<NumericType>,
+                                  NumberOfUnits<Unit> * NumberOfUnits<Unit>>
+    MatrixOfConversions{MakeMatrixOfConversions<Unit, NumericType>(
+        std::make_index_sequence<NumberOfUnits<Unit> * NumberOfUnits<Unit>>{})};
+
+/// \brief Returns the affine map for converting values expressed in the standard unit of measure of
+/// a given type to a given unit of measure of that type. Internal implementation detail not
+/// intended to be used outside of the PhQ::ConvertInPlace, PhQ::Convert, and
+/// PhQ::ConvertStatically functions.
+template <typename NumericType, typename Unit>
+[[nodiscard]] inline constexpr const AffineConversion<NumericType>& ConversionFromStandard(
+    const Unit unit) noexcept {
+  return ArrayOfConversionsFromStandard<Unit, NumericType>[static_cast<std::size_t>(unit)];
+}
+
+/// \brief Returns the affine map for converting values expressed in a given unit of measure of a
+/// given type to the standard unit of measure of that type. Internal implementation detail not
+/// intended to be used outside of the PhQ::ConvertInPlace, PhQ::Convert, and
+/// PhQ::ConvertStatically functions.
+template <typename NumericType, typename Unit>
+[[nodiscard]] inline constexpr const AffineConversion<NumericType>& ConversionToStandard(
+    const Unit unit) noexcept {
+  return ArrayOfConversionsToStandard<Unit, NumericType>[static_cast<std::size_t>(unit)];
+}
+
+/// \brief Returns the affine map for converting values expressed in a given unit of measure of a
+/// given type directly to another given unit of measure of that type. Internal implementation
+/// detail not intended to be used outside of the PhQ::ConvertInPlace, PhQ::Convert, and
+/// PhQ::ConvertStatically functions.
+template <typename NumericType, typename Unit>
+[[nodiscard]] inline constexpr const AffineConversion<NumericType>& ConversionBetween(
+    const Unit original_unit, const Unit new_unit) noexcept {
+  return MatrixOfConversions<Unit, NumericType>[
+      static_cast<std::size_t>(original_unit) * NumberOfUnits<Unit>
+      + static_cast<std::size_t>(new_unit)];
+}
+
+/// \brief Abstract class for converting a sequence of values expressed in a unit of measure to or
+/// from the standard unit of measure of that type. In constant-evaluated contexts, each value is
+/// converted by PhQ::Internal::Conversion. Otherwise, the sequence is converted by an explicitly
+/// vectorized kernel that multiplies by the precomputed coefficients of the unit of measure rather
+/// than dividing. Internal implementation detail not intended to be used outside of the
+/// PhQ::ConvertInPlace, PhQ::Convert, and PhQ::ConvertStatically functions.
 template <typename Unit, Unit UnitValue>
 class Conversions {
 public:
@@ -82,9 +314,13 @@ public:
     static_assert(std::is_floating_point<NumericType>::value,
                   "The NumericType template parameter of PhQ::Conversions::FromStandard must be a "
                   "numeric floating-point type: float, double, or long double.");
-    const NumericType* const end{values + size};
-    for (; values < end; ++values) {
-      Conversion<Unit, UnitValue>::FromStandard(*values);
+    if (IsConstantEvaluated()) {
+      const NumericType* const end{values + size};
+      for (; values < end; ++values) {
+        Conversion<Unit, UnitValue>::FromStandard(*values);
+      }
+    } else {
+      ConversionFromStandard<NumericType>(UnitValue).Apply(values, size);
     }
   }
 
@@ -97,28 +333,61 @@ public:
     static_assert(std::is_floating_point<NumericType>::value,
                   "The NumericType template parameter of PhQ::Conversions::ToStandard must be a "
                   "numeric floating-point type: float, double, or long double.");
-    const NumericType* const end{values + size};
-    for (; values < end; ++values) {
-      Conversion<Unit, UnitValue>::ToStandard(*values);
+    if (IsConstantEvaluated()) {
+      const NumericType* const end{values + size};
+      for (; values < end; ++values) {
+        Conversion<Unit, UnitValue>::ToStandard(*values);
+      }
+    } else {
+      ConversionToStandard<NumericType>(UnitValue).Apply(values, size);
     }
   }
 };
 
-/// \brief Abstract map of functions for converting a sequence of values expressed in the standard
-/// unit of measure of a given type to any given unit of measure of that type. Internal
-/// implementation detail not intended to be used outside of the PhQ::ConvertInPlace, PhQ::Convert,
-/// and PhQ::ConvertStatically functions.
-template <typename Unit, typename NumericType>
-inline const std::map<Unit, std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard;
+/// \brief Number of numeric components of a two-dimensional or three-dimensional mathematical type:
+/// 2 for a planar vector, 3 for a vector, 6 for a symmetric dyadic tensor, and 9 for a dyadic
+/// tensor. Internal implementation detail not intended to be used outside of the
+/// PhQ::ConvertInPlace and PhQ::Convert functions and the bulk operations on fields of physical
+/// quantities.
+template <typename Type>
+inline constexpr const std::size_t NumberOfComponents{0};
+
+template <typename NumericType>
+inline constexpr const std::size_t NumberOfComponents<PlanarVector<NumericType>>{2};
+
+template <typename NumericType>
+inline constexpr const std::size_t NumberOfComponents<Vector<NumericType>>{3};
+
+template <typename NumericType>
+inline constexpr const std::size_t NumberOfComponents<SymmetricDyad<NumericType>>{6};
+
+template <typename NumericType>
+inline constexpr const std::size_t NumberOfComponents<Dyad<NumericType>>{9};
+
+/// \brief Returns a pointer to the first numeric component of a contiguous sequence of planar
+/// vectors, vectors, symmetric dyadic tensors, or dyadic tensors. These types hold nothing but a
+/// std::array of their components, so a contiguous sequence of them is a contiguous sequence of
+/// components. Internal implementation detail not intended to be used outside of the
+/// PhQ::ConvertInPlace and PhQ::Convert functions and the bulk operations on fields of physical
+/// quantities.
+template <template <typename> class Type, typename NumericType>
+[[nodiscard]] inline NumericType* Components(Type<NumericType>* const values) noexcept {
+  static_assert(NumberOfComponents<Type<NumericType>> > 0
+                    && sizeof(Type<NumericType>)
+                           == NumberOfComponents<Type<NumericType>> * sizeof(NumericType),
+                "The components of a sequence of PhQ::PlanarVector, PhQ::Vector, "
+                "PhQ::SymmetricDyad, or PhQ::Dyad objects must be contiguous.");
+  return reinterpret_cast<NumericType*>(values);
+}
 
-/// \brief Abstract map of functions for converting a sequence of values expressed in any given unit
-/// of measure of a given type to the standard unit of measure of that type. Internal implementation
-/// detail not intended to be used outside of the PhQ::ConvertInPlace, PhQ::Convert, and
-/// PhQ::ConvertStatically functions.
-template <typename Unit, typename NumericType>
-inline const std::map<Unit, std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsToStandard;
+/// \brief Returns a pointer to the first numeric component of a contiguous sequence of planar
+/// vectors, vectors, symmetric dyadic tensors, or dyadic tensors. Internal implementation detail
+/// not intended to be used outside of the PhQ::ConvertInPlace and PhQ::Convert functions and the
+/// bulk operations on fields of physical quantities.
+template <template <typename> class Type, typename NumericType>
+[[nodiscard]] inline const NumericType* Components(const Type<NumericType>* const values) noexcept {
+  return Components(const_cast<Type<NumericType>*>(values));
+}
 
 }  // namespace Internal
 
@@ -129,11 +398,8 @@ inline void ConvertInPlace(NumericType& value, const Unit original_unit, const U
   static_assert(std::is_floating_point<NumericType>::value,
                 "The NumericType template parameter of PhQ::ConvertInPlace must be a numeric "
                 "floating-point type: float, double, or long double.");
-  if (original_unit != Standard<Unit>) {
-    Internal::MapOfConversionsToStandard<Unit, NumericType>.find(original_unit)->second(&value, 1);
-  }
-  if (new_unit != Standard<Unit>) {
-    Internal::MapOfConversionsFromStandard<Unit, NumericType>.find(new_unit)->second(&value, 1);
+  if (original_unit != new_unit) {
+    Internal::ConversionBetween<NumericType>(original_unit, new_unit).Apply(value);
   }
 }
 
@@ -145,12 +411,8 @@ inline void ConvertInPlace(
   static_assert(std::is_floating_point<NumericType>::value,
                 "The NumericType template parameter of PhQ::ConvertInPlace must be a numeric "
                 "floating-point type: float, double, or long double.");
-  if (original_unit != Standard<Unit>) {
-    Internal::MapOfConversionsToStandard<Unit, NumericType>.find(original_unit)->second(values.data(), Size);
-  }
-  if (new_unit != Standard<Unit>) {
-    Internal::MapOfConversionsFromStandard<Unit, NumericType>.find(new_unit)->second(
-        values.data(), Size);
+  if (original_unit != new_unit) {
+    Internal::ConversionBetween<NumericType>(original_unit, new_unit).Apply(values.data(), Size);
   }
 }
 
@@ -162,15 +424,77 @@ inline void ConvertInPlace(
   static_assert(std::is_floating_point<NumericType>::value,
                 "The NumericType template parameter of PhQ::ConvertInPlace must be a numeric "
                 "floating-point type: float, double, or long double.");
-  if (original_unit != Standard<Unit>) {
-    Internal::MapOfConversionsToStandard<Unit, NumericType>.find(original_unit)->second(values.data(), values.size());
+  if (original_unit != new_unit) {
+    Internal::ConversionBetween<NumericType>(original_unit, new_unit)
+        .Apply(values.data(), values.size());
   }
-  if (new_unit != Standard<Unit>) {
-    Internal::MapOfConversionsFromStandard<Unit, NumericType>.find(new_unit)->second(
-        values.data(), values.size());
+}
+
+/// \brief Converts a buffer of a given number of values expressed in a given unit of measure to a
+/// new unit of measure. The conversion is performed in-place.
+template <typename Unit, typename NumericType>
+inline void ConvertInPlace(NumericType* const values, const std::size_t size,
+                           const Unit original_unit, const Unit new_unit) {
+  static_assert(std::is_floating_point<NumericType>::value,
+                "The NumericType template parameter of PhQ::ConvertInPlace must be a numeric "
+                "floating-point type: float, double, or long double.");
+  if (original_unit != new_unit) {
+    Internal::ConversionBetween<NumericType>(original_unit, new_unit).Apply(values, size);
+  }
+}
+
+/// \brief Converts a buffer of a given number of values expressed in a given unit of measure to a
+/// new unit of measure using up to a given number of threads. The conversion is performed in-place.
+/// The buffer is split into cache-sized chunks that are converted concurrently. Buffers that are
+/// too short to benefit from threading are converted on the calling thread.
+template <typename Unit, typename NumericType>
+inline void ConvertInPlace(NumericType* const values, const std::size_t size,
+                           const Unit original_unit, const Unit new_unit,
+                           const std::size_t thread_count) {
+  static_assert(std::is_floating_point<NumericType>::value,
+                "The NumericType template parameter of PhQ::ConvertInPlace must be a numeric "
+                "floating-point type: float, double, or long double.");
+  if (original_unit != new_unit) {
+    const Internal::AffineConversion<NumericType>& conversion{
+        Internal::ConversionBetween<NumericType>(original_unit, new_unit)};
+    Internal::ParallelForEachChunk(
+        values, size, thread_count,
+        [&conversion](NumericType* const chunk_values, const std::size_t chunk_size) {
+          conversion.Apply(chunk_values, chunk_size);
+        });
   }
 }
 
+/// \brief Converts a buffer of a given number of values expressed in a given unit of measure to a
+/// new unit of measure using a given execution policy. The conversion is performed in-place.
+template <typename Unit, typename NumericType>
+inline void ConvertInPlace(NumericType* const values, const std::size_t size,
+                           const Unit original_unit, const Unit new_unit,
+                           const ExecutionPolicy policy) {
+  ConvertInPlace<Unit, NumericType>(
+      values, size, original_unit, new_unit, Internal::ThreadCount(policy));
+}
+
+/// \brief Converts a vector of values expressed in a given unit of measure to a new unit of
+/// measure using up to a given number of threads. The conversion is performed in-place. The vector
+/// is split into cache-sized chunks that are converted concurrently. Vectors that are too short to
+/// benefit from threading are converted on the calling thread.
+template <typename Unit, typename NumericType>
+inline void ConvertInPlace(std::vector<NumericType>& values, const Unit original_unit,
+                           const Unit new_unit, const std::size_t thread_count) {
+  ConvertInPlace<Unit, NumericType>(
+      values.data(), values.size(), original_unit, new_unit, thread_count);
+}
+
+/// \brief Converts a vector of values expressed in a given unit of measure to a new unit of
+/// measure using a given execution policy. The conversion is performed in-place.
+template <typename Unit, typename NumericType>
+inline void ConvertInPlace(std::vector<NumericType>& values, const Unit original_unit,
+                           const Unit new_unit, const ExecutionPolicy policy) {
+  ConvertInPlace<Unit, NumericType>(
+      values.data(), values.size(), original_unit, new_unit, Internal::ThreadCount(policy));
+}
+
 /// \brief Converts a two-dimensional Euclidean planar vector in the XY plane expressed in a given
 /// unit of measure to a new unit of measure. The conversion is performed in-place.
 template <typename Unit, typename NumericType>
@@ -204,6 +528,54 @@ inline void ConvertInPlace(Dyad<NumericType>& dyad, const Unit original_unit, co
       dyad.Mutable_xx_xy_xz_yx_yy_yz_zx_zy_zz(), original_unit, new_unit);
 }
 
+/// \brief Converts a vector of two-dimensional Euclidean planar vectors in the XY plane expressed
+/// in a given unit of measure to a new unit of measure. The conversion is performed in-place. The
+/// conversion between the two units is resolved once and the components of all elements are
+/// converted in a single vectorized pass.
+template <typename Unit, typename NumericType>
+inline void ConvertInPlace(
+    std::vector<PlanarVector<NumericType>>& values, const Unit original_unit, const Unit new_unit) {
+  constexpr std::size_t components{Internal::NumberOfComponents<PlanarVector<NumericType>>};
+  ConvertInPlace<Unit, NumericType>(
+      Internal::Components(values.data()), components * values.size(), original_unit, new_unit);
+}
+
+/// \brief Converts a vector of three-dimensional Euclidean vectors expressed in a given unit of
+/// measure to a new unit of measure. The conversion is performed in-place. The conversion between
+/// the two units is resolved once and the components of all elements are converted in a single
+/// vectorized pass.
+template <typename Unit, typename NumericType>
+inline void ConvertInPlace(
+    std::vector<Vector<NumericType>>& values, const Unit original_unit, const Unit new_unit) {
+  constexpr std::size_t components{Internal::NumberOfComponents<Vector<NumericType>>};
+  ConvertInPlace<Unit, NumericType>(
+      Internal::Components(values.data()), components * values.size(), original_unit, new_unit);
+}
+
+/// \brief Converts a vector of three-dimensional Euclidean symmetric dyadic tensors expressed in a
+/// given unit of measure to a new unit of measure. The conversion is performed in-place. The
+/// conversion between the two units is resolved once and the components of all elements are
+/// converted in a single vectorized pass.
+template <typename Unit, typename NumericType>
+inline void ConvertInPlace(std::vector<SymmetricDyad<NumericType>>& values,
+                           const Unit original_unit, const Unit new_unit) {
+  constexpr std::size_t components{Internal::NumberOfComponents<SymmetricDyad<NumericType>>};
+  ConvertInPlace<Unit, NumericType>(
+      Internal::Components(values.data()), components * values.size(), original_unit, new_unit);
+}
+
+/// \brief Converts a vector of three-dimensional Euclidean dyadic tensors expressed in a given unit
+/// of measure to a new unit of measure. The conversion is performed in-place. The conversion
+/// between the two units is resolved once and the components of all elements are converted in a
+/// single vectorized pass.
+template <typename Unit, typename NumericType>
+inline void ConvertInPlace(
+    std::vector<Dyad<NumericType>>& values, const Unit original_unit, const Unit new_unit) {
+  constexpr std::size_t components{Internal::NumberOfComponents<Dyad<NumericType>>};
+  ConvertInPlace<Unit, NumericType>(
+      Internal::Components(values.data()), components * values.size(), original_unit, new_unit);
+}
+
 /// \brief Converts a value expressed in a given unit of measure to a new unit of measure. Returns
 /// the converted value. The original value remains unchanged.
 template <typename Unit, typename NumericType>
@@ -234,6 +606,44 @@ template <typename Unit, typename NumericType>
   return result;
 }
 
+/// \brief Converts a buffer of a given number of values expressed in a given unit of measure to a
+/// new unit of measure and writes the converted values to a caller-provided output buffer of the
+/// same size. The input values are read and the output values are written in a single pass with no
+/// heap allocation. The input and output buffers must either be the same buffer or not overlap. The
+/// original values remain unchanged unless the two buffers are the same buffer.
+template <typename Unit, typename NumericType>
+inline void Convert(const NumericType* const input, NumericType* const output,
+                    const std::size_t size, const Unit original_unit, const Unit new_unit) {
+  static_assert(std::is_floating_point<NumericType>::value,
+                "The NumericType template parameter of PhQ::Convert must be a numeric "
+                "floating-point type: float, double, or long double.");
+  if (original_unit != new_unit) {
+    Internal::ConversionBetween<NumericType>(original_unit, new_unit).Apply(input, output, size);
+  } else if (input != output) {
+    std::copy(input, input + size, output);
+  }
+}
+
+#if __cplusplus >= 202002L
+
+/// \brief Converts a span of values expressed in a given unit of measure to a new unit of measure
+/// and writes the converted values to a caller-provided output span. The input values are read and
+/// the output values are written in a single pass with no heap allocation. The input and output
+/// spans must either be the same span or not overlap. Returns true if the values are converted, or
+/// false without modifying the output span if the input and output spans differ in size.
+template <typename Unit, typename NumericType>
+[[nodiscard]] inline bool Convert(
+    const std::span<const NumericType> input, const std::span<NumericType> output,
+    const Unit original_unit, const Unit new_unit) {
+  if (input.size() != output.size()) {
+    return false;
+  }
+  Convert<Unit, NumericType>(input.data(), output.data(), input.size(), original_unit, new_unit);
+  return true;
+}
+
+#endif  // __cplusplus >= 202002L
+
 /// \brief Converts a two-dimensional Euclidean planar vector in the XY plane expressed in a given
 /// unit of measure to a new unit of measure. Returns the converted vector. The original vector
 /// remains unchanged.
@@ -271,6 +681,68 @@ template <typename Unit, typename NumericType>
       Convert<Unit, 9, NumericType>(dyad.xx_xy_xz_yx_yy_yz_zx_zy_zz(), original_unit, new_unit)};
 }
 
+/// \brief Converts a vector of two-dimensional Euclidean planar vectors in the XY plane expressed
+/// in a given unit of measure to a new unit of measure. Returns the converted elements. The
+/// original elements remain unchanged. The conversion between the two units is resolved once and
+/// the components of all elements are converted in a single vectorized pass.
+template <typename Unit, typename NumericType>
+[[nodiscard]] inline std::vector<PlanarVector<NumericType>> Convert(
+    const std::vector<PlanarVector<NumericType>>& values, const Unit original_unit,
+    const Unit new_unit) {
+  constexpr std::size_t components{Internal::NumberOfComponents<PlanarVector<NumericType>>};
+  std::vector<PlanarVector<NumericType>> result(values.size());
+  Convert<Unit, NumericType>(Internal::Components(values.data()),
+                             Internal::Components(result.data()), components * values.size(),
+                             original_unit, new_unit);
+  return result;
+}
+
+/// \brief Converts a vector of three-dimensional Euclidean vectors expressed in a given unit of
+/// measure to a new unit of measure. Returns the converted elements. The original elements remain
+/// unchanged. The conversion between the two units is resolved once and the components of all
+/// elements are converted in a single vectorized pass.
+template <typename Unit, typename NumericType>
+[[nodiscard]] inline std::vector<Vector<NumericType>> Convert(
+    const std::vector<Vector<NumericType>>& values, const Unit original_unit, const Unit new_unit) {
+  constexpr std::size_t components{Internal::NumberOfComponents<Vector<NumericType>>};
+  std::vector<Vector<NumericType>> result(values.size());
+  Convert<Unit, NumericType>(Internal::Components(values.data()),
+                             Internal::Components(result.data()), components * values.size(),
+                             original_unit, new_unit);
+  return result;
+}
+
+/// \brief Converts a vector of three-dimensional Euclidean symmetric dyadic tensors expressed in a
+/// given unit of measure to a new unit of measure. Returns the converted elements. The original
+/// elements remain unchanged. The conversion between the two units is resolved once and the
+/// components of all elements are converted in a single vectorized pass.
+template <typename Unit, typename NumericType>
+[[nodiscard]] inline std::vector<SymmetricDyad<NumericType>> Convert(
+    const std::vector<SymmetricDyad<NumericType>>& values, const Unit original_unit,
+    const Unit new_unit) {
+  constexpr std::size_t components{Internal::NumberOfComponents<SymmetricDyad<NumericType>>};
+  std::vector<SymmetricDyad<NumericType>> result(values.size());
+  Convert<Unit, NumericType>(Internal::Components(values.data()),
+                             Internal::Components(result.data()), components * values.size(),
+                             original_unit, new_unit);
+  return result;
+}
+
+/// \brief Converts a vector of three-dimensional Euclidean dyadic tensors expressed in a given unit
+/// of measure to a new unit of measure. Returns the converted elements. The original elements
+/// remain unchanged. The conversion between the two units is resolved once and the components of
+/// all elements are converted in a single vectorized pass.
+template <typename Unit, typename NumericType>
+[[nodiscard]] inline std::vector<Dyad<NumericType>> Convert(
+    const std::vector<Dyad<NumericType>>& values, const Unit original_unit, const Unit new_unit) {
+  constexpr std::size_t components{Internal::NumberOfComponents<Dyad<NumericType>>};
+  std::vector<Dyad<NumericType>> result(values.size());
+  Convert<Unit, NumericType>(Internal::Components(values.data()),
+                             Internal::Components(result.data()), components * values.size(),
+                             original_unit, new_unit);
+  return result;
+}
+
 /// \brief Converts a value expressed in a given unit of measure to a new unit of measure. Returns
 /// the converted value. The original value remains unchanged. This function can be evaluated at
 /// compile time.
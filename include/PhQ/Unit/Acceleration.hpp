@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_ACCELERATION_HPP
 #define PHQ_UNIT_ACCELERATION_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -192,232 +191,236 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Acceleration u
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::Acceleration> ConsistentUnits<Unit::Acceleration>{
-    {UnitSystem::MetreKilogramSecondKelvin,  Unit::Acceleration::MetrePerSquareSecond     },
-    {UnitSystem::MillimetreGramSecondKelvin, Unit::Acceleration::MillimetrePerSquareSecond},
-    {UnitSystem::FootPoundSecondRankine,     Unit::Acceleration::FootPerSquareSecond      },
-    {UnitSystem::InchPoundSecondRankine,     Unit::Acceleration::InchPerSquareSecond      },
-};
+inline constexpr std::array<std::pair<UnitSystem, Unit::Acceleration>, 4>
+    ConsistentUnits<Unit::Acceleration>{{
+        {UnitSystem::MetreKilogramSecondKelvin,  Unit::Acceleration::MetrePerSquareSecond     },
+        {UnitSystem::MillimetreGramSecondKelvin, Unit::Acceleration::MillimetrePerSquareSecond},
+        {UnitSystem::FootPoundSecondRankine,     Unit::Acceleration::FootPerSquareSecond      },
+        {UnitSystem::InchPoundSecondRankine,     Unit::Acceleration::InchPerSquareSecond      },
+}};
 
 template <>
-inline const std::map<Unit::Acceleration, UnitSystem> RelatedUnitSystems<Unit::Acceleration>{
-    {Unit::Acceleration::MetrePerSquareSecond,      UnitSystem::MetreKilogramSecondKelvin },
-    {Unit::Acceleration::MillimetrePerSquareSecond, UnitSystem::MillimetreGramSecondKelvin},
-    {Unit::Acceleration::FootPerSquareSecond,       UnitSystem::FootPoundSecondRankine    },
-    {Unit::Acceleration::InchPerSquareSecond,       UnitSystem::InchPoundSecondRankine    },
-};
+inline constexpr std::array<std::pair<Unit::Acceleration, UnitSystem>, 4>
+    RelatedUnitSystems<Unit::Acceleration>{{
+        {Unit::Acceleration::MetrePerSquareSecond,      UnitSystem::MetreKilogramSecondKelvin },
+        {Unit::Acceleration::FootPerSquareSecond,       UnitSystem::FootPoundSecondRankine    },
+        {Unit::Acceleration::InchPerSquareSecond,       UnitSystem::InchPoundSecondRankine    },
+        {Unit::Acceleration::MillimetrePerSquareSecond, UnitSystem::MillimetreGramSecondKelvin},
+}};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::Acceleration, std::string_view> Abbreviations<Unit::Acceleration>{
-    {Unit::Acceleration::NauticalMilePerSquareSecond, "nmi/s^2"  },
-    {Unit::Acceleration::NauticalMilePerSquareMinute, "nmi/min^2"},
-    {Unit::Acceleration::KnotPerHour,                 "kn/hr"    },
-    {Unit::Acceleration::MilePerSquareSecond,         "mi/s^2"   },
-    {Unit::Acceleration::MilePerSquareMinute,         "mi/min^2" },
-    {Unit::Acceleration::MilePerSquareHour,           "mi/hr^2"  },
-    {Unit::Acceleration::KilometrePerSquareSecond,    "km/s^2"   },
-    {Unit::Acceleration::KilometrePerSquareMinute,    "km/min^2" },
-    {Unit::Acceleration::KilometrePerSquareHour,      "km/hr^2"  },
-    {Unit::Acceleration::YardPerSquareSecond,         "yd/s^2"   },
-    {Unit::Acceleration::YardPerSquareMinute,         "yd/min^2" },
-    {Unit::Acceleration::YardPerSquareHour,           "yd/hr^2"  },
-    {Unit::Acceleration::MetrePerSquareSecond,        "m/s^2"    },
-    {Unit::Acceleration::MetrePerSquareMinute,        "m/min^2"  },
-    {Unit::Acceleration::MetrePerSquareHour,          "m/hr^2"   },
-    {Unit::Acceleration::FootPerSquareSecond,         "ft/s^2"   },
-    {Unit::Acceleration::FootPerSquareMinute,         "ft/min^2" },
-    {Unit::Acceleration::FootPerSquareHour,           "ft/hr^2"  },
-    {Unit::Acceleration::DecimetrePerSquareSecond,    "dm/s^2"   },
-    {Unit::Acceleration::DecimetrePerSquareMinute,    "dm/min^2" },
-    {Unit::Acceleration::DecimetrePerSquareHour,      "dm/hr^2"  },
-    {Unit::Acceleration::InchPerSquareSecond,         "in/s^2"   },
-    {Unit::Acceleration::InchPerSquareMinute,         "in/min^2" },
-    {Unit::Acceleration::InchPerSquareHour,           "in/hr^2"  },
-    {Unit::Acceleration::CentimetrePerSquareSecond,   "cm/s^2"   },
-    {Unit::Acceleration::CentimetrePerSquareMinute,   "cm/min^2" },
-    {Unit::Acceleration::CentimetrePerSquareHour,     "cm/hr^2"  },
-    {Unit::Acceleration::MillimetrePerSquareSecond,   "mm/s^2"   },
-    {Unit::Acceleration::MillimetrePerSquareMinute,   "mm/min^2" },
-    {Unit::Acceleration::MillimetrePerSquareHour,     "mm/hr^2"  },
-    {Unit::Acceleration::MilliinchPerSquareSecond,    "mil/s^2"  },
-    {Unit::Acceleration::MilliinchPerSquareMinute,    "mil/min^2"},
-    {Unit::Acceleration::MilliinchPerSquareHour,      "mil/hr^2" },
-    {Unit::Acceleration::MicrometrePerSquareSecond,   "μm/s^2"   },
-    {Unit::Acceleration::MicrometrePerSquareMinute,   "μm/min^2" },
-    {Unit::Acceleration::MicrometrePerSquareHour,     "μm/hr^2"  },
-    {Unit::Acceleration::MicroinchPerSquareSecond,    "μin/s^2"  },
-    {Unit::Acceleration::MicroinchPerSquareMinute,    "μin/min^2"},
-    {Unit::Acceleration::MicroinchPerSquareHour,      "μin/hr^2" },
-};
-
-template <>
-inline const std::unordered_map<std::string_view, Unit::Acceleration> Spellings<Unit::Acceleration>{
-    {"nmi/s^2",           Unit::Acceleration::NauticalMilePerSquareSecond},
-    {"nmi/s2",            Unit::Acceleration::NauticalMilePerSquareSecond},
-    {"nmi/s/s",           Unit::Acceleration::NauticalMilePerSquareSecond},
-    {"nmi/min^2",         Unit::Acceleration::NauticalMilePerSquareMinute},
-    {"nmi/min2",          Unit::Acceleration::NauticalMilePerSquareMinute},
-    {"nmi/min/min",       Unit::Acceleration::NauticalMilePerSquareMinute},
-    {"kn/hr",             Unit::Acceleration::KnotPerHour                },
-    {"nmi/hr^2",          Unit::Acceleration::KnotPerHour                },
-    {"nmi/hr2",           Unit::Acceleration::KnotPerHour                },
-    {"nmi/hr/hr",         Unit::Acceleration::KnotPerHour                },
-    {"mi/s^2",            Unit::Acceleration::MilePerSquareSecond        },
-    {"mi/s2",             Unit::Acceleration::MilePerSquareSecond        },
-    {"mi/s/s",            Unit::Acceleration::MilePerSquareSecond        },
-    {"mi/min^2",          Unit::Acceleration::MilePerSquareMinute        },
-    {"mi/min2",           Unit::Acceleration::MilePerSquareMinute        },
-    {"mi/min/min",        Unit::Acceleration::MilePerSquareMinute        },
-    {"mi/hr^2",           Unit::Acceleration::MilePerSquareHour          },
-    {"mi/hr2",            Unit::Acceleration::MilePerSquareHour          },
-    {"mi/hr/hr",          Unit::Acceleration::MilePerSquareHour          },
-    {"km/s^2",            Unit::Acceleration::KilometrePerSquareSecond   },
-    {"km/s2",             Unit::Acceleration::KilometrePerSquareSecond   },
-    {"km/s/s",            Unit::Acceleration::KilometrePerSquareSecond   },
-    {"km/min^2",          Unit::Acceleration::KilometrePerSquareMinute   },
-    {"km/min2",           Unit::Acceleration::KilometrePerSquareMinute   },
-    {"km/min/min",        Unit::Acceleration::KilometrePerSquareMinute   },
-    {"km/hr^2",           Unit::Acceleration::KilometrePerSquareHour     },
-    {"km/hr2",            Unit::Acceleration::KilometrePerSquareHour     },
-    {"km/hr/hr",          Unit::Acceleration::KilometrePerSquareHour     },
-    {"yd/s^2",            Unit::Acceleration::YardPerSquareSecond        },
-    {"yd/s2",             Unit::Acceleration::YardPerSquareSecond        },
-    {"yd/s/s",            Unit::Acceleration::YardPerSquareSecond        },
-    {"yd/min^2",          Unit::Acceleration::YardPerSquareMinute        },
-    {"yd/min2",           Unit::Acceleration::YardPerSquareMinute        },
-    {"yd/min/min",        Unit::Acceleration::YardPerSquareMinute        },
-    {"yd/hr^2",           Unit::Acceleration::YardPerSquareHour          },
-    {"yd/hr2",            Unit::Acceleration::YardPerSquareHour          },
-    {"yd/hr/hr",          Unit::Acceleration::YardPerSquareHour          },
-    {"m/s^2",             Unit::Acceleration::MetrePerSquareSecond       },
-    {"m/s2",              Unit::Acceleration::MetrePerSquareSecond       },
-    {"m/s/s",             Unit::Acceleration::MetrePerSquareSecond       },
-    {"m/min^2",           Unit::Acceleration::MetrePerSquareMinute       },
-    {"m/min2",            Unit::Acceleration::MetrePerSquareMinute       },
-    {"m/min/min",         Unit::Acceleration::MetrePerSquareMinute       },
-    {"m/hr^2",            Unit::Acceleration::MetrePerSquareHour         },
-    {"m/hr2",             Unit::Acceleration::MetrePerSquareHour         },
-    {"m/hr/hr",           Unit::Acceleration::MetrePerSquareHour         },
-    {"ft/s^2",            Unit::Acceleration::FootPerSquareSecond        },
-    {"ft/s2",             Unit::Acceleration::FootPerSquareSecond        },
-    {"ft/s/s",            Unit::Acceleration::FootPerSquareSecond        },
-    {"ft/min^2",          Unit::Acceleration::FootPerSquareMinute        },
-    {"ft/min2",           Unit::Acceleration::FootPerSquareMinute        },
-    {"ft/min/min",        Unit::Acceleration::FootPerSquareMinute        },
-    {"ft/hr^2",           Unit::Acceleration::FootPerSquareHour          },
-    {"ft/hr2",            Unit::Acceleration::FootPerSquareHour          },
-    {"ft/hr/hr",          Unit::Acceleration::FootPerSquareHour          },
-    {"dm/s^2",            Unit::Acceleration::DecimetrePerSquareSecond   },
-    {"dm/s2",             Unit::Acceleration::DecimetrePerSquareSecond   },
-    {"dm/s/s",            Unit::Acceleration::DecimetrePerSquareSecond   },
-    {"dm/min^2",          Unit::Acceleration::DecimetrePerSquareMinute   },
-    {"dm/min2",           Unit::Acceleration::DecimetrePerSquareMinute   },
-    {"dm/min/min",        Unit::Acceleration::DecimetrePerSquareMinute   },
-    {"dm/hr^2",           Unit::Acceleration::DecimetrePerSquareHour     },
-    {"dm/hr2",            Unit::Acceleration::DecimetrePerSquareHour     },
-    {"dm/hr/hr",          Unit::Acceleration::DecimetrePerSquareHour     },
-    {"in/s^2",            Unit::Acceleration::InchPerSquareSecond        },
-    {"in/s2",             Unit::Acceleration::InchPerSquareSecond        },
-    {"in/s/s",            Unit::Acceleration::InchPerSquareSecond        },
-    {"in/min^2",          Unit::Acceleration::InchPerSquareMinute        },
-    {"in/min2",           Unit::Acceleration::InchPerSquareMinute        },
-    {"in/min/min",        Unit::Acceleration::InchPerSquareMinute        },
-    {"in/hr^2",           Unit::Acceleration::InchPerSquareHour          },
-    {"in/hr2",            Unit::Acceleration::InchPerSquareHour          },
-    {"in/hr/hr",          Unit::Acceleration::InchPerSquareHour          },
-    {"cm/s^2",            Unit::Acceleration::CentimetrePerSquareSecond  },
-    {"cm/s2",             Unit::Acceleration::CentimetrePerSquareSecond  },
-    {"cm/s/s",            Unit::Acceleration::CentimetrePerSquareSecond  },
-    {"cm/min^2",          Unit::Acceleration::CentimetrePerSquareMinute  },
-    {"cm/min2",           Unit::Acceleration::CentimetrePerSquareMinute  },
-    {"cm/min/min",        Unit::Acceleration::CentimetrePerSquareMinute  },
-    {"cm/hr^2",           Unit::Acceleration::CentimetrePerSquareHour    },
-    {"cm/hr2",            Unit::Acceleration::CentimetrePerSquareHour    },
-    {"cm/hr/hr",          Unit::Acceleration::CentimetrePerSquareHour    },
-    {"mm/s^2",            Unit::Acceleration::MillimetrePerSquareSecond  },
-    {"mm/s2",             Unit::Acceleration::MillimetrePerSquareSecond  },
-    {"mm/s/s",            Unit::Acceleration::MillimetrePerSquareSecond  },
-    {"mm/min^2",          Unit::Acceleration::MillimetrePerSquareMinute  },
-    {"mm/min2",           Unit::Acceleration::MillimetrePerSquareMinute  },
-    {"mm/min/min",        Unit::Acceleration::MillimetrePerSquareMinute  },
-    {"mm/hr^2",           Unit::Acceleration::MillimetrePerSquareHour    },
-    {"mm/hr2",            Unit::Acceleration::MillimetrePerSquareHour    },
-    {"mm/hr/hr",          Unit::Acceleration::MillimetrePerSquareHour    },
-    {"milin/s^2",         Unit::Acceleration::MilliinchPerSquareSecond   },
-    {"milin/s2",          Unit::Acceleration::MilliinchPerSquareSecond   },
-    {"milin/s/s",         Unit::Acceleration::MilliinchPerSquareSecond   },
-    {"milliinch/s^2",     Unit::Acceleration::MilliinchPerSquareSecond   },
-    {"milliinch/s2",      Unit::Acceleration::MilliinchPerSquareSecond   },
-    {"milliinch/s/s",     Unit::Acceleration::MilliinchPerSquareSecond   },
-    {"mil/s^2",           Unit::Acceleration::MilliinchPerSquareSecond   },
-    {"mil/s2",            Unit::Acceleration::MilliinchPerSquareSecond   },
-    {"mil/s/s",           Unit::Acceleration::MilliinchPerSquareSecond   },
-    {"thou/s^2",          Unit::Acceleration::MilliinchPerSquareSecond   },
-    {"thou/s2",           Unit::Acceleration::MilliinchPerSquareSecond   },
-    {"thou/s/s",          Unit::Acceleration::MilliinchPerSquareSecond   },
-    {"milin/min^2",       Unit::Acceleration::MilliinchPerSquareMinute   },
-    {"milin/min2",        Unit::Acceleration::MilliinchPerSquareMinute   },
-    {"milin/min/min",     Unit::Acceleration::MilliinchPerSquareMinute   },
-    {"milliinch/min^2",   Unit::Acceleration::MilliinchPerSquareMinute   },
-    {"milliinch/min2",    Unit::Acceleration::MilliinchPerSquareMinute   },
-    {"milliinch/min/min", Unit::Acceleration::MilliinchPerSquareMinute   },
-    {"mil/min^2",         Unit::Acceleration::MilliinchPerSquareMinute   },
-    {"mil/min2",          Unit::Acceleration::MilliinchPerSquareMinute   },
-    {"mil/min/min",       Unit::Acceleration::MilliinchPerSquareMinute   },
-    {"thou/min^2",        Unit::Acceleration::MilliinchPerSquareMinute   },
-    {"thou/min2",         Unit::Acceleration::MilliinchPerSquareMinute   },
-    {"thou/min/min",      Unit::Acceleration::MilliinchPerSquareMinute   },
-    {"milin/hr^2",        Unit::Acceleration::MilliinchPerSquareHour     },
-    {"milin/hr2",         Unit::Acceleration::MilliinchPerSquareHour     },
-    {"milin/hr/hr",       Unit::Acceleration::MilliinchPerSquareHour     },
-    {"milliinch/hr^2",    Unit::Acceleration::MilliinchPerSquareHour     },
-    {"milliinch/hr2",     Unit::Acceleration::MilliinchPerSquareHour     },
-    {"milliinch/hr/hr",   Unit::Acceleration::MilliinchPerSquareHour     },
-    {"mil/hr^2",          Unit::Acceleration::MilliinchPerSquareHour     },
-    {"mil/hr2",           Unit::Acceleration::MilliinchPerSquareHour     },
-    {"mil/hr/hr",         Unit::Acceleration::MilliinchPerSquareHour     },
-    {"thou/hr^2",         Unit::Acceleration::MilliinchPerSquareHour     },
-    {"thou/hr2",          Unit::Acceleration::MilliinchPerSquareHour     },
-    {"thou/hr/hr",        Unit::Acceleration::MilliinchPerSquareHour     },
-    {"μm/s^2",            Unit::Acceleration::MicrometrePerSquareSecond  },
-    {"μm/s2",             Unit::Acceleration::MicrometrePerSquareSecond  },
-    {"μm/s/s",            Unit::Acceleration::MicrometrePerSquareSecond  },
-    {"um/s^2",            Unit::Acceleration::MicrometrePerSquareSecond  },
-    {"um/s2",             Unit::Acceleration::MicrometrePerSquareSecond  },
-    {"um/s/s",            Unit::Acceleration::MicrometrePerSquareSecond  },
-    {"μm/min^2",          Unit::Acceleration::MicrometrePerSquareMinute  },
-    {"μm/min2",           Unit::Acceleration::MicrometrePerSquareMinute  },
-    {"μm/min/min",        Unit::Acceleration::MicrometrePerSquareMinute  },
-    {"um/min^2",          Unit::Acceleration::MicrometrePerSquareMinute  },
-    {"um/min2",           Unit::Acceleration::MicrometrePerSquareMinute  },
-    {"um/min/min",        Unit::Acceleration::MicrometrePerSquareMinute  },
-    {"μm/hr^2",           Unit::Acceleration::MicrometrePerSquareHour    },
-    {"μm/hr2",            Unit::Acceleration::MicrometrePerSquareHour    },
-    {"μm/hr/hr",          Unit::Acceleration::MicrometrePerSquareHour    },
-    {"um/hr^2",           Unit::Acceleration::MicrometrePerSquareHour    },
-    {"um/hr2",            Unit::Acceleration::MicrometrePerSquareHour    },
-    {"um/hr/hr",          Unit::Acceleration::MicrometrePerSquareHour    },
-    {"μin/s^2",           Unit::Acceleration::MicroinchPerSquareSecond   },
-    {"μin/s2",            Unit::Acceleration::MicroinchPerSquareSecond   },
-    {"μin/s/s",           Unit::Acceleration::MicroinchPerSquareSecond   },
-    {"uin/s^2",           Unit::Acceleration::MicroinchPerSquareSecond   },
-    {"uin/s2",            Unit::Acceleration::MicroinchPerSquareSecond   },
-    {"uin/s/s",           Unit::Acceleration::MicroinchPerSquareSecond   },
-    {"μin/min^2",         Unit::Acceleration::MicroinchPerSquareMinute   },
-    {"μin/min2",          Unit::Acceleration::MicroinchPerSquareMinute   },
-    {"μin/min/min",       Unit::Acceleration::MicroinchPerSquareMinute   },
-    {"uin/min^2",         Unit::Acceleration::MicroinchPerSquareMinute   },
-    {"uin/min2",          Unit::Acceleration::MicroinchPerSquareMinute   },
-    {"uin/min/min",       Unit::Acceleration::MicroinchPerSquareMinute   },
-    {"μin/hr^2",          Unit::Acceleration::MicroinchPerSquareHour     },
-    {"μin/hr2",           Unit::Acceleration::MicroinchPerSquareHour     },
-    {"μin/hr/hr",         Unit::Acceleration::MicroinchPerSquareHour     },
-    {"uin/hr^2",          Unit::Acceleration::MicroinchPerSquareHour     },
-    {"uin/hr2",           Unit::Acceleration::MicroinchPerSquareHour     },
-    {"uin/hr/hr",         Unit::Acceleration::MicroinchPerSquareHour     },
-};
+inline constexpr std::array<std::pair<Unit::Acceleration, std::string_view>, 39>
+    Abbreviations<Unit::Acceleration>{{
+        {Unit::Acceleration::NauticalMilePerSquareSecond, "nmi/s^2"  },
+        {Unit::Acceleration::NauticalMilePerSquareMinute, "nmi/min^2"},
+        {Unit::Acceleration::KnotPerHour,                 "kn/hr"    },
+        {Unit::Acceleration::MilePerSquareSecond,         "mi/s^2"   },
+        {Unit::Acceleration::MilePerSquareMinute,         "mi/min^2" },
+        {Unit::Acceleration::MilePerSquareHour,           "mi/hr^2"  },
+        {Unit::Acceleration::KilometrePerSquareSecond,    "km/s^2"   },
+        {Unit::Acceleration::KilometrePerSquareMinute,    "km/min^2" },
+        {Unit::Acceleration::KilometrePerSquareHour,      "km/hr^2"  },
+        {Unit::Acceleration::MetrePerSquareSecond,        "m/s^2"    },
+        {Unit::Acceleration::MetrePerSquareMinute,        "m/min^2"  },
+        {Unit::Acceleration::MetrePerSquareHour,          "m/hr^2"   },
+        {Unit::Acceleration::YardPerSquareSecond,         "yd/s^2"   },
+        {Unit::Acceleration::YardPerSquareMinute,         "yd/min^2" },
+        {Unit::Acceleration::YardPerSquareHour,           "yd/hr^2"  },
+        {Unit::Acceleration::FootPerSquareSecond,         "ft/s^2"   },
+        {Unit::Acceleration::FootPerSquareMinute,         "ft/min^2" },
+        {Unit::Acceleration::FootPerSquareHour,           "ft/hr^2"  },
+        {Unit::Acceleration::DecimetrePerSquareSecond,    "dm/s^2"   },
+        {Unit::Acceleration::DecimetrePerSquareMinute,    "dm/min^2" },
+        {Unit::Acceleration::DecimetrePerSquareHour,      "dm/hr^2"  },
+        {Unit::Acceleration::InchPerSquareSecond,         "in/s^2"   },
+        {Unit::Acceleration::InchPerSquareMinute,         "in/min^2" },
+        {Unit::Acceleration::InchPerSquareHour,           "in/hr^2"  },
+        {Unit::Acceleration::CentimetrePerSquareSecond,   "cm/s^2"   },
+        {Unit::Acceleration::CentimetrePerSquareMinute,   "cm/min^2" },
+        {Unit::Acceleration::CentimetrePerSquareHour,     "cm/hr^2"  },
+        {Unit::Acceleration::MillimetrePerSquareSecond,   "mm/s^2"   },
+        {Unit::Acceleration::MillimetrePerSquareMinute,   "mm/min^2" },
+        {Unit::Acceleration::MillimetrePerSquareHour,     "mm/hr^2"  },
+        {Unit::Acceleration::MilliinchPerSquareSecond,    "mil/s^2"  },
+        {Unit::Acceleration::MilliinchPerSquareMinute,    "mil/min^2"},
+        {Unit::Acceleration::MilliinchPerSquareHour,      "mil/hr^2" },
+        {Unit::Acceleration::MicrometrePerSquareSecond,   "μm/s^2"   },
+        {Unit::Acceleration::MicrometrePerSquareMinute,   "μm/min^2" },
+        {Unit::Acceleration::MicrometrePerSquareHour,     "μm/hr^2"  },
+        {Unit::Acceleration::MicroinchPerSquareSecond,    "μin/s^2"  },
+        {Unit::Acceleration::MicroinchPerSquareMinute,    "μin/min^2"},
+        {Unit::Acceleration::MicroinchPerSquareHour,      "μin/hr^2" },
+}};
+
+template <>
+inline constexpr std::array<std::pair<std::string_view, Unit::Acceleration>, 163>
+    Spellings<Unit::Acceleration>{{
+        {"cm/hr/hr",          Unit::Acceleration::CentimetrePerSquareHour    },
+        {"cm/hr2",            Unit::Acceleration::CentimetrePerSquareHour    },
+        {"cm/hr^2",           Unit::Acceleration::CentimetrePerSquareHour    },
+        {"cm/min/min",        Unit::Acceleration::CentimetrePerSquareMinute  },
+        {"cm/min2",           Unit::Acceleration::CentimetrePerSquareMinute  },
+        {"cm/min^2",          Unit::Acceleration::CentimetrePerSquareMinute  },
+        {"cm/s/s",            Unit::Acceleration::CentimetrePerSquareSecond  },
+        {"cm/s2",             Unit::Acceleration::CentimetrePerSquareSecond  },
+        {"cm/s^2",            Unit::Acceleration::CentimetrePerSquareSecond  },
+        {"dm/hr/hr",          Unit::Acceleration::DecimetrePerSquareHour     },
+        {"dm/hr2",            Unit::Acceleration::DecimetrePerSquareHour     },
+        {"dm/hr^2",           Unit::Acceleration::DecimetrePerSquareHour     },
+        {"dm/min/min",        Unit::Acceleration::DecimetrePerSquareMinute   },
+        {"dm/min2",           Unit::Acceleration::DecimetrePerSquareMinute   },
+        {"dm/min^2",          Unit::Acceleration::DecimetrePerSquareMinute   },
+        {"dm/s/s",            Unit::Acceleration::DecimetrePerSquareSecond   },
+        {"dm/s2",             Unit::Acceleration::DecimetrePerSquareSecond   },
+        {"dm/s^2",            Unit::Acceleration::DecimetrePerSquareSecond   },
+        {"ft/hr/hr",          Unit::Acceleration::FootPerSquareHour          },
+        {"ft/hr2",            Unit::Acceleration::FootPerSquareHour          },
+        {"ft/hr^2",           Unit::Acceleration::FootPerSquareHour          },
+        {"ft/min/min",        Unit::Acceleration::FootPerSquareMinute        },
+        {"ft/min2",           Unit::Acceleration::FootPerSquareMinute        },
+        {"ft/min^2",          Unit::Acceleration::FootPerSquareMinute        },
+        {"ft/s/s",            Unit::Acceleration::FootPerSquareSecond        },
+        {"ft/s2",             Unit::Acceleration::FootPerSquareSecond        },
+        {"ft/s^2",            Unit::Acceleration::FootPerSquareSecond        },
+        {"in/hr/hr",          Unit::Acceleration::InchPerSquareHour          },
+        {"in/hr2",            Unit::Acceleration::InchPerSquareHour          },
+        {"in/hr^2",           Unit::Acceleration::InchPerSquareHour          },
+        {"in/min/min",        Unit::Acceleration::InchPerSquareMinute        },
+        {"in/min2",           Unit::Acceleration::InchPerSquareMinute        },
+        {"in/min^2",          Unit::Acceleration::InchPerSquareMinute        },
+        {"in/s/s",            Unit::Acceleration::InchPerSquareSecond        },
+        {"in/s2",             Unit::Acceleration::InchPerSquareSecond        },
+        {"in/s^2",            Unit::Acceleration::InchPerSquareSecond        },
+        {"km/hr/hr",          Unit::Acceleration::KilometrePerSquareHour     },
+        {"km/hr2",            Unit::Acceleration::KilometrePerSquareHour     },
+        {"km/hr^2",           Unit::Acceleration::KilometrePerSquareHour     },
+        {"km/min/min",        Unit::Acceleration::KilometrePerSquareMinute   },
+        {"km/min2",           Unit::Acceleration::KilometrePerSquareMinute   },
+        {"km/min^2",          Unit::Acceleration::KilometrePerSquareMinute   },
+        {"km/s/s",            Unit::Acceleration::KilometrePerSquareSecond   },
+        {"km/s2",             Unit::Acceleration::KilometrePerSquareSecond   },
+        {"km/s^2",            Unit::Acceleration::KilometrePerSquareSecond   },
+        {"kn/hr",             Unit::Acceleration::KnotPerHour                },
+        {"m/hr/hr",           Unit::Acceleration::MetrePerSquareHour         },
+        {"m/hr2",             Unit::Acceleration::MetrePerSquareHour         },
+        {"m/hr^2",            Unit::Acceleration::MetrePerSquareHour         },
+        {"m/min/min",         Unit::Acceleration::MetrePerSquareMinute       },
+        {"m/min2",            Unit::Acceleration::MetrePerSquareMinute       },
+        {"m/min^2",           Unit::Acceleration::MetrePerSquareMinute       },
+        {"m/s/s",             Unit::Acceleration::MetrePerSquareSecond       },
+        {"m/s2",              Unit::Acceleration::MetrePerSquareSecond       },
+        {"m/s^2",             Unit::Acceleration::MetrePerSquareSecond       },
+        {"mi/hr/hr",          Unit::Acceleration::MilePerSquareHour          },
+        {"mi/hr2",            Unit::Acceleration::MilePerSquareHour          },
+        {"mi/hr^2",           Unit::Acceleration::MilePerSquareHour          },
+        {"mi/min/min",        Unit::Acceleration::MilePerSquareMinute        },
+        {"mi/min2",           Unit::Acceleration::MilePerSquareMinute        },
+        {"mi/min^2",          Unit::Acceleration::MilePerSquareMinute        },
+        {"mi/s/s",            Unit::Acceleration::MilePerSquareSecond        },
+        {"mi/s2",             Unit::Acceleration::MilePerSquareSecond        },
+        {"mi/s^2",            Unit::Acceleration::MilePerSquareSecond        },
+        {"mil/hr/hr",         Unit::Acceleration::MilliinchPerSquareHour     },
+        {"mil/hr2",           Unit::Acceleration::MilliinchPerSquareHour     },
+        {"mil/hr^2",          Unit::Acceleration::MilliinchPerSquareHour     },
+        {"mil/min/min",       Unit::Acceleration::MilliinchPerSquareMinute   },
+        {"mil/min2",          Unit::Acceleration::MilliinchPerSquareMinute   },
+        {"mil/min^2",         Unit::Acceleration::MilliinchPerSquareMinute   },
+        {"mil/s/s",           Unit::Acceleration::MilliinchPerSquareSecond   },
+        {"mil/s2",            Unit::Acceleration::MilliinchPerSquareSecond   },
+        {"mil/s^2",           Unit::Acceleration::MilliinchPerSquareSecond   },
+        {"milin/hr/hr",       Unit::Acceleration::MilliinchPerSquareHour     },
+        {"milin/hr2",         Unit::Acceleration::MilliinchPerSquareHour     },
+        {"milin/hr^2",        Unit::Acceleration::MilliinchPerSquareHour     },
+        {"milin/min/min",     Unit::Acceleration::MilliinchPerSquareMinute   },
+        {"milin/min2",        Unit::Acceleration::MilliinchPerSquareMinute   },
+        {"milin/min^2",       Unit::Acceleration::MilliinchPerSquareMinute   },
+        {"milin/s/s",         Unit::Acceleration::MilliinchPerSquareSecond   },
+        {"milin/s2",          Unit::Acceleration::MilliinchPerSquareSecond   },
+        {"milin/s^2",         Unit::Acceleration::MilliinchPerSquareSecond   },
+        {"milliinch/hr/hr",   Unit::Acceleration::MilliinchPerSquareHour     },
+        {"milliinch/hr2",     Unit::Acceleration::MilliinchPerSquareHour     },
+        {"milliinch/hr^2",    Unit::Acceleration::MilliinchPerSquareHour     },
+        {"milliinch/min/min", Unit::Acceleration::MilliinchPerSquareMinute   },
+        {"milliinch/min2",    Unit::Acceleration::MilliinchPerSquareMinute   },
+        {"milliinch/min^2",   Unit::Acceleration::MilliinchPerSquareMinute   },
+        {"milliinch/s/s",     Unit::Acceleration::MilliinchPerSquareSecond   },
+        {"milliinch/s2",      Unit::Acceleration::MilliinchPerSquareSecond   },
+        {"milliinch/s^2",     Unit::Acceleration::MilliinchPerSquareSecond   },
+        {"mm/hr/hr",          Unit::Acceleration::MillimetrePerSquareHour    },
+        {"mm/hr2",            Unit::Acceleration::MillimetrePerSquareHour    },
+        {"mm/hr^2",           Unit::Acceleration::MillimetrePerSquareHour    },
+        {"mm/min/min",        Unit::Acceleration::MillimetrePerSquareMinute  },
+        {"mm/min2",           Unit::Acceleration::MillimetrePerSquareMinute  },
+        {"mm/min^2",          Unit::Acceleration::MillimetrePerSquareMinute  },
+        {"mm/s/s",            Unit::Acceleration::MillimetrePerSquareSecond  },
+        {"mm/s2",             Unit::Acceleration::MillimetrePerSquareSecond  },
+        {"mm/s^2",            Unit::Acceleration::MillimetrePerSquareSecond  },
+        {"nmi/hr/hr",         Unit::Acceleration::KnotPerHour                },
+        {"nmi/hr2",           Unit::Acceleration::KnotPerHour                },
+        {"nmi/hr^2",          Unit::Acceleration::KnotPerHour                },
+        {"nmi/min/min",       Unit::Acceleration::NauticalMilePerSquareMinute},
+        {"nmi/min2",          Unit::Acceleration::NauticalMilePerSquareMinute},
+        {"nmi/min^2",         Unit::Acceleration::NauticalMilePerSquareMinute},
+        {"nmi/s/s",           Unit::Acceleration::NauticalMilePerSquareSecond},
+        {"nmi/s2",            Unit::Acceleration::NauticalMilePerSquareSecond},
+        {"nmi/s^2",           Unit::Acceleration::NauticalMilePerSquareSecond},
+        {"thou/hr/hr",        Unit::Acceleration::MilliinchPerSquareHour     },
+        {"thou/hr2",          Unit::Acceleration::MilliinchPerSquareHour     },
+        {"thou/hr^2",         Unit::Acceleration::MilliinchPerSquareHour     },
+        {"thou/min/min",      Unit::Acceleration::MilliinchPerSquareMinute   },
+        {"thou/min2",         Unit::Acceleration::MilliinchPerSquareMinute   },
+        {"thou/min^2",        Unit::Acceleration::MilliinchPerSquareMinute   },
+        {"thou/s/s",          Unit::Acceleration::MilliinchPerSquareSecond   },
+        {"thou/s2",           Unit::Acceleration::MilliinchPerSquareSecond   },
+        {"thou/s^2",          Unit::Acceleration::MilliinchPerSquareSecond   },
+        {"uin/hr/hr",         Unit::Acceleration::MicroinchPerSquareHour     },
+        {"uin/hr2",           Unit::Acceleration::MicroinchPerSquareHour     },
+        {"uin/hr^2",          Unit::Acceleration::MicroinchPerSquareHour     },
+        {"uin/min/min",       Unit::Acceleration::MicroinchPerSquareMinute   },
+        {"uin/min2",          Unit::Acceleration::MicroinchPerSquareMinute   },
+        {"uin/min^2",         Unit::Acceleration::MicroinchPerSquareMinute   },
+        {"uin/s/s",           Unit::Acceleration::MicroinchPerSquareSecond   },
+        {"uin/s2",            Unit::Acceleration::MicroinchPerSquareSecond   },
+        {"uin/s^2",           Unit::Acceleration::MicroinchPerSquareSecond   },
+        {"um/hr/hr",          Unit::Acceleration::MicrometrePerSquareHour    },
+        {"um/hr2",            Unit::Acceleration::MicrometrePerSquareHour    },
+        {"um/hr^2",           Unit::Acceleration::MicrometrePerSquareHour    },
+        {"um/min/min",        Unit::Acceleration::MicrometrePerSquareMinute  },
+        {"um/min2",           Unit::Acceleration::MicrometrePerSquareMinute  },
+        {"um/min^2",          Unit::Acceleration::MicrometrePerSquareMinute  },
+        {"um/s/s",            Unit::Acceleration::MicrometrePerSquareSecond  },
+        {"um/s2",             Unit::Acceleration::MicrometrePerSquareSecond  },
+        {"um/s^2",            Unit::Acceleration::MicrometrePerSquareSecond  },
+        {"yd/hr/hr",          Unit::Acceleration::YardPerSquareHour          },
+        {"yd/hr2",            Unit::Acceleration::YardPerSquareHour          },
+        {"yd/hr^2",           Unit::Acceleration::YardPerSquareHour          },
+        {"yd/min/min",        Unit::Acceleration::YardPerSquareMinute        },
+        {"yd/min2",           Unit::Acceleration::YardPerSquareMinute        },
+        {"yd/min^2",          Unit::Acceleration::YardPerSquareMinute        },
+        {"yd/s/s",            Unit::Acceleration::YardPerSquareSecond        },
+        {"yd/s2",             Unit::Acceleration::YardPerSquareSecond        },
+        {"yd/s^2",            Unit::Acceleration::YardPerSquareSecond        },
+        {"μin/hr/hr",         Unit::Acceleration::MicroinchPerSquareHour     },
+        {"μin/hr2",           Unit::Acceleration::MicroinchPerSquareHour     },
+        {"μin/hr^2",          Unit::Acceleration::MicroinchPerSquareHour     },
+        {"μin/min/min",       Unit::Acceleration::MicroinchPerSquareMinute   },
+        {"μin/min2",          Unit::Acceleration::MicroinchPerSquareMinute   },
+        {"μin/min^2",         Unit::Acceleration::MicroinchPerSquareMinute   },
+        {"μin/s/s",           Unit::Acceleration::MicroinchPerSquareSecond   },
+        {"μin/s2",            Unit::Acceleration::MicroinchPerSquareSecond   },
+        {"μin/s^2",           Unit::Acceleration::MicroinchPerSquareSecond   },
+        {"μm/hr/hr",          Unit::Acceleration::MicrometrePerSquareHour    },
+        {"μm/hr2",            Unit::Acceleration::MicrometrePerSquareHour    },
+        {"μm/hr^2",           Unit::Acceleration::MicrometrePerSquareHour    },
+        {"μm/min/min",        Unit::Acceleration::MicrometrePerSquareMinute  },
+        {"μm/min2",           Unit::Acceleration::MicrometrePerSquareMinute  },
+        {"μm/min^2",          Unit::Acceleration::MicrometrePerSquareMinute  },
+        {"μm/s/s",            Unit::Acceleration::MicrometrePerSquareSecond  },
+        {"μm/s2",             Unit::Acceleration::MicrometrePerSquareSecond  },
+        {"μm/s^2",            Unit::Acceleration::MicrometrePerSquareSecond  },
+}};
 
 // clang-format on
 
@@ -1039,250 +1042,8 @@ Conversion<Unit::Acceleration, Unit::Acceleration::MicroinchPerSquareHour>::ToSt
   value *= static_cast<NumericType>(0.0000000254L) / static_cast<NumericType>(12960000.0L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::Acceleration,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Acceleration, NumericType>{
-        {Unit::Acceleration::NauticalMilePerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::NauticalMilePerSquareSecond>::FromStandard<NumericType>},
-        {Unit::Acceleration::NauticalMilePerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::NauticalMilePerSquareMinute>::FromStandard<NumericType>},
-        {Unit::Acceleration::KnotPerHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::KnotPerHour>::FromStandard<NumericType>                },
-        {Unit::Acceleration::MilePerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MilePerSquareSecond>::FromStandard<NumericType>        },
-        {Unit::Acceleration::MilePerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MilePerSquareMinute>::FromStandard<NumericType>        },
-        {Unit::Acceleration::MilePerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MilePerSquareHour>::FromStandard<NumericType>          },
-        {Unit::Acceleration::KilometrePerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::KilometrePerSquareSecond>::FromStandard<NumericType>   },
-        {Unit::Acceleration::KilometrePerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::KilometrePerSquareMinute>::FromStandard<NumericType>   },
-        {Unit::Acceleration::KilometrePerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::KilometrePerSquareHour>::FromStandard<NumericType>     },
-        {Unit::Acceleration::MetrePerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MetrePerSquareSecond>::FromStandard<NumericType>       },
-        {Unit::Acceleration::MetrePerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MetrePerSquareMinute>::FromStandard<NumericType>       },
-        {Unit::Acceleration::MetrePerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MetrePerSquareHour>::FromStandard<NumericType>         },
-        {Unit::Acceleration::YardPerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::YardPerSquareSecond>::FromStandard<NumericType>        },
-        {Unit::Acceleration::YardPerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::YardPerSquareMinute>::FromStandard<NumericType>        },
-        {Unit::Acceleration::YardPerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::YardPerSquareHour>::FromStandard<NumericType>          },
-        {Unit::Acceleration::FootPerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::FootPerSquareSecond>::FromStandard<NumericType>        },
-        {Unit::Acceleration::FootPerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::FootPerSquareMinute>::FromStandard<NumericType>        },
-        {Unit::Acceleration::FootPerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::FootPerSquareHour>::FromStandard<NumericType>          },
-        {Unit::Acceleration::DecimetrePerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::DecimetrePerSquareSecond>::FromStandard<NumericType>   },
-        {Unit::Acceleration::DecimetrePerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::DecimetrePerSquareMinute>::FromStandard<NumericType>   },
-        {Unit::Acceleration::DecimetrePerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::DecimetrePerSquareHour>::FromStandard<NumericType>     },
-        {Unit::Acceleration::InchPerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::InchPerSquareSecond>::FromStandard<NumericType>        },
-        {Unit::Acceleration::InchPerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::InchPerSquareMinute>::FromStandard<NumericType>        },
-        {Unit::Acceleration::InchPerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::InchPerSquareHour>::FromStandard<NumericType>          },
-        {Unit::Acceleration::CentimetrePerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::CentimetrePerSquareSecond>::FromStandard<NumericType>  },
-        {Unit::Acceleration::CentimetrePerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::CentimetrePerSquareMinute>::FromStandard<NumericType>  },
-        {Unit::Acceleration::CentimetrePerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::CentimetrePerSquareHour>::FromStandard<NumericType>    },
-        {Unit::Acceleration::MillimetrePerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MillimetrePerSquareSecond>::FromStandard<NumericType>  },
-        {Unit::Acceleration::MillimetrePerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MillimetrePerSquareMinute>::FromStandard<NumericType>  },
-        {Unit::Acceleration::MillimetrePerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MillimetrePerSquareHour>::FromStandard<NumericType>    },
-        {Unit::Acceleration::MilliinchPerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MilliinchPerSquareSecond>::FromStandard<NumericType>   },
-        {Unit::Acceleration::MilliinchPerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MilliinchPerSquareMinute>::FromStandard<NumericType>   },
-        {Unit::Acceleration::MilliinchPerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MilliinchPerSquareHour>::FromStandard<NumericType>     },
-        {Unit::Acceleration::MicrometrePerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MicrometrePerSquareSecond>::FromStandard<NumericType>  },
-        {Unit::Acceleration::MicrometrePerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MicrometrePerSquareMinute>::FromStandard<NumericType>  },
-        {Unit::Acceleration::MicrometrePerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MicrometrePerSquareHour>::FromStandard<NumericType>    },
-        {Unit::Acceleration::MicroinchPerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MicroinchPerSquareSecond>::FromStandard<NumericType>   },
-        {Unit::Acceleration::MicroinchPerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MicroinchPerSquareMinute>::FromStandard<NumericType>   },
-        {Unit::Acceleration::MicroinchPerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MicroinchPerSquareHour>::FromStandard<NumericType>     },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Acceleration,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Acceleration, NumericType>{
-        {Unit::Acceleration::NauticalMilePerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::NauticalMilePerSquareSecond>::ToStandard<NumericType>                },
-        {Unit::Acceleration::NauticalMilePerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::NauticalMilePerSquareMinute>::ToStandard<NumericType>                },
-        {Unit::Acceleration::KnotPerHour,
-         Conversions<Unit::Acceleration, Unit::Acceleration::KnotPerHour>::ToStandard<NumericType>},
-        {Unit::Acceleration::MilePerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MilePerSquareSecond>::ToStandard<NumericType>                        },
-        {Unit::Acceleration::MilePerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MilePerSquareMinute>::ToStandard<NumericType>                        },
-        {Unit::Acceleration::MilePerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MilePerSquareHour>::ToStandard<NumericType>                          },
-        {Unit::Acceleration::KilometrePerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::KilometrePerSquareSecond>::ToStandard<NumericType>                   },
-        {Unit::Acceleration::KilometrePerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::KilometrePerSquareMinute>::ToStandard<NumericType>                   },
-        {Unit::Acceleration::KilometrePerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::KilometrePerSquareHour>::ToStandard<NumericType>                     },
-        {Unit::Acceleration::MetrePerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MetrePerSquareSecond>::ToStandard<NumericType>                       },
-        {Unit::Acceleration::MetrePerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MetrePerSquareMinute>::ToStandard<NumericType>                       },
-        {Unit::Acceleration::MetrePerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MetrePerSquareHour>::ToStandard<NumericType>                         },
-        {Unit::Acceleration::YardPerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::YardPerSquareSecond>::ToStandard<NumericType>                        },
-        {Unit::Acceleration::YardPerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::YardPerSquareMinute>::ToStandard<NumericType>                        },
-        {Unit::Acceleration::YardPerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::YardPerSquareHour>::ToStandard<NumericType>                          },
-        {Unit::Acceleration::FootPerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::FootPerSquareSecond>::ToStandard<NumericType>                        },
-        {Unit::Acceleration::FootPerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::FootPerSquareMinute>::ToStandard<NumericType>                        },
-        {Unit::Acceleration::FootPerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::FootPerSquareHour>::ToStandard<NumericType>                          },
-        {Unit::Acceleration::DecimetrePerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::DecimetrePerSquareSecond>::ToStandard<NumericType>                   },
-        {Unit::Acceleration::DecimetrePerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::DecimetrePerSquareMinute>::ToStandard<NumericType>                   },
-        {Unit::Acceleration::DecimetrePerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::DecimetrePerSquareHour>::ToStandard<NumericType>                     },
-        {Unit::Acceleration::InchPerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::InchPerSquareSecond>::ToStandard<NumericType>                        },
-        {Unit::Acceleration::InchPerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::InchPerSquareMinute>::ToStandard<NumericType>                        },
-        {Unit::Acceleration::InchPerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::InchPerSquareHour>::ToStandard<NumericType>                          },
-        {Unit::Acceleration::CentimetrePerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::CentimetrePerSquareSecond>::ToStandard<NumericType>                  },
-        {Unit::Acceleration::CentimetrePerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::CentimetrePerSquareMinute>::ToStandard<NumericType>                  },
-        {Unit::Acceleration::CentimetrePerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::CentimetrePerSquareHour>::ToStandard<NumericType>                    },
-        {Unit::Acceleration::MillimetrePerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MillimetrePerSquareSecond>::ToStandard<NumericType>                  },
-        {Unit::Acceleration::MillimetrePerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MillimetrePerSquareMinute>::ToStandard<NumericType>                  },
-        {Unit::Acceleration::MillimetrePerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MillimetrePerSquareHour>::ToStandard<NumericType>                    },
-        {Unit::Acceleration::MilliinchPerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MilliinchPerSquareSecond>::ToStandard<NumericType>                   },
-        {Unit::Acceleration::MilliinchPerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MilliinchPerSquareMinute>::ToStandard<NumericType>                   },
-        {Unit::Acceleration::MilliinchPerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MilliinchPerSquareHour>::ToStandard<NumericType>                     },
-        {Unit::Acceleration::MicrometrePerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MicrometrePerSquareSecond>::ToStandard<NumericType>                  },
-        {Unit::Acceleration::MicrometrePerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MicrometrePerSquareMinute>::ToStandard<NumericType>                  },
-        {Unit::Acceleration::MicrometrePerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MicrometrePerSquareHour>::ToStandard<NumericType>                    },
-        {Unit::Acceleration::MicroinchPerSquareSecond,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MicroinchPerSquareSecond>::ToStandard<NumericType>                   },
-        {Unit::Acceleration::MicroinchPerSquareMinute,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MicroinchPerSquareMinute>::ToStandard<NumericType>                   },
-        {Unit::Acceleration::MicroinchPerSquareHour,
-         Conversions<Unit::Acceleration,
-         Unit::Acceleration::MicroinchPerSquareHour>::ToStandard<NumericType>                     },
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Acceleration>{39};
 
 }  // namespace Internal
 
@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_ANGLE_HPP
 #define PHQ_UNIT_ANGLE_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -85,51 +84,53 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Angle unit) {
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::Angle> ConsistentUnits<Unit::Angle>{
+inline constexpr std::array<std::pair<UnitSystem, Unit::Angle>, 4> ConsistentUnits<Unit::Angle>{{
     {UnitSystem::MetreKilogramSecondKelvin,  Unit::Angle::Radian},
     {UnitSystem::MillimetreGramSecondKelvin, Unit::Angle::Radian},
     {UnitSystem::FootPoundSecondRankine,     Unit::Angle::Radian},
     {UnitSystem::InchPoundSecondRankine,     Unit::Angle::Radian},
-};
+}};
 
 template <>
-inline const std::map<Unit::Angle, UnitSystem> RelatedUnitSystems<Unit::Angle>{};
+inline constexpr std::array<std::pair<Unit::Angle, UnitSystem>, 0>
+    RelatedUnitSystems<Unit::Angle>{};
 
 template <>
-inline const std::map<Unit::Angle, std::string_view> Abbreviations<Unit::Angle>{
-    {Unit::Angle::Radian,     "rad"   },
-    {Unit::Angle::Degree,     "deg"   },
-    {Unit::Angle::Arcminute,  "arcmin"},
-    {Unit::Angle::Arcsecond,  "arcsec"},
-    {Unit::Angle::Revolution, "rev"   },
-};
+inline constexpr std::array<std::pair<Unit::Angle, std::string_view>, 5>
+    Abbreviations<Unit::Angle>{{
+        {Unit::Angle::Radian,     "rad"   },
+        {Unit::Angle::Degree,     "deg"   },
+        {Unit::Angle::Arcminute,  "arcmin"},
+        {Unit::Angle::Arcsecond,  "arcsec"},
+        {Unit::Angle::Revolution, "rev"   },
+}};
 
 // clang-format off
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Angle> Spellings<Unit::Angle>{
-    {"rad",         Unit::Angle::Radian    },
-    {"radian",      Unit::Angle::Radian    },
-    {"radians",     Unit::Angle::Radian    },
-    {"deg",         Unit::Angle::Degree    },
-    {"degree",      Unit::Angle::Degree    },
-    {"degrees",     Unit::Angle::Degree    },
-    {"°",           Unit::Angle::Degree    },
+inline constexpr std::array<std::pair<std::string_view, Unit::Angle>, 21> Spellings<Unit::Angle>{{
+    {"\"",          Unit::Angle::Arcsecond },
     {"'",           Unit::Angle::Arcminute },
     {"am",          Unit::Angle::Arcminute },
     {"arcmin",      Unit::Angle::Arcminute },
     {"arcminute",   Unit::Angle::Arcminute },
     {"arcminutes",  Unit::Angle::Arcminute },
-    {"\"",          Unit::Angle::Arcsecond },
-    {"as",          Unit::Angle::Arcsecond },
     {"arcs",        Unit::Angle::Arcsecond },
     {"arcsec",      Unit::Angle::Arcsecond },
     {"arcsecond",   Unit::Angle::Arcsecond },
     {"arcseconds",  Unit::Angle::Arcsecond },
+    {"as",          Unit::Angle::Arcsecond },
+    {"deg",         Unit::Angle::Degree    },
+    {"degree",      Unit::Angle::Degree    },
+    {"degrees",     Unit::Angle::Degree    },
+    {"rad",         Unit::Angle::Radian    },
+    {"radian",      Unit::Angle::Radian    },
+    {"radians",     Unit::Angle::Radian    },
     {"rev",         Unit::Angle::Revolution},
     {"revolution",  Unit::Angle::Revolution},
     {"revolutions", Unit::Angle::Revolution},
-};
+    {"°",           Unit::Angle::Degree    },
+}};
 
 // clang-format on
 
@@ -199,36 +200,8 @@ inline constexpr void Conversion<Unit::Angle, Unit::Angle::Revolution>::ToStanda
   value *= static_cast<NumericType>(2.0L) * Pi<NumericType>;
 }
 
-template <typename NumericType>
-inline const std::map<Unit::Angle, std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Angle, NumericType>{
-        {Unit::Angle::Radian,
-         Conversions<Unit::Angle, Unit::Angle::Radian>::FromStandard<NumericType>    },
-        {Unit::Angle::Degree,
-         Conversions<Unit::Angle, Unit::Angle::Degree>::FromStandard<NumericType>    },
-        {Unit::Angle::Arcminute,
-         Conversions<Unit::Angle, Unit::Angle::Arcminute>::FromStandard<NumericType> },
-        {Unit::Angle::Arcsecond,
-         Conversions<Unit::Angle, Unit::Angle::Arcsecond>::FromStandard<NumericType> },
-        {Unit::Angle::Revolution,
-         Conversions<Unit::Angle, Unit::Angle::Revolution>::FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Angle,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Angle, NumericType>{
-        {Unit::Angle::Radian,
-         Conversions<Unit::Angle, Unit::Angle::Radian>::ToStandard<NumericType>    },
-        {Unit::Angle::Degree,
-         Conversions<Unit::Angle, Unit::Angle::Degree>::ToStandard<NumericType>    },
-        {Unit::Angle::Arcminute,
-         Conversions<Unit::Angle, Unit::Angle::Arcminute>::ToStandard<NumericType> },
-        {Unit::Angle::Arcsecond,
-         Conversions<Unit::Angle, Unit::Angle::Arcsecond>::ToStandard<NumericType> },
-        {Unit::Angle::Revolution,
-         Conversions<Unit::Angle, Unit::Angle::Revolution>::ToStandard<NumericType>},
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Angle>{5};
 
 }  // namespace Internal
 
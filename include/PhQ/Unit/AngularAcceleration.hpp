@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_ANGULAR_ACCELERATION_HPP
 #define PHQ_UNIT_ANGULAR_ACCELERATION_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -120,21 +119,21 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::AngularAcceler
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::AngularAcceleration>
-    ConsistentUnits<Unit::AngularAcceleration>{
+inline constexpr std::array<std::pair<UnitSystem, Unit::AngularAcceleration>, 4>
+    ConsistentUnits<Unit::AngularAcceleration>{{
         {UnitSystem::MetreKilogramSecondKelvin,  Unit::AngularAcceleration::RadianPerSquareSecond},
         {UnitSystem::MillimetreGramSecondKelvin, Unit::AngularAcceleration::RadianPerSquareSecond},
         {UnitSystem::FootPoundSecondRankine,     Unit::AngularAcceleration::RadianPerSquareSecond},
         {UnitSystem::InchPoundSecondRankine,     Unit::AngularAcceleration::RadianPerSquareSecond},
-};
+}};
 
 template <>
-inline const std::map<Unit::AngularAcceleration, UnitSystem>
+inline constexpr std::array<std::pair<Unit::AngularAcceleration, UnitSystem>, 0>
     RelatedUnitSystems<Unit::AngularAcceleration>{};
 
 template <>
-inline const std::map<Unit::AngularAcceleration, std::string_view>
-    Abbreviations<Unit::AngularAcceleration>{
+inline constexpr std::array<std::pair<Unit::AngularAcceleration, std::string_view>, 15>
+    Abbreviations<Unit::AngularAcceleration>{{
         {Unit::AngularAcceleration::RadianPerSquareSecond,     "rad/s^2"     },
         {Unit::AngularAcceleration::RadianPerSquareMinute,     "rad/min^2"   },
         {Unit::AngularAcceleration::RadianPerSquareHour,       "rad/hr^2"    },
@@ -150,68 +149,68 @@ inline const std::map<Unit::AngularAcceleration, std::string_view>
         {Unit::AngularAcceleration::RevolutionPerSquareSecond, "rev/s^2"     },
         {Unit::AngularAcceleration::RevolutionPerSquareMinute, "rev/min^2"   },
         {Unit::AngularAcceleration::RevolutionPerSquareHour,   "rev/hr^2"    },
-};
+}};
 
 // clang-format off
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::AngularAcceleration> Spellings<
-    Unit::AngularAcceleration>{
-    {"rad/s^2",        Unit::AngularAcceleration::RadianPerSquareSecond    },
-    {"rad/s2",         Unit::AngularAcceleration::RadianPerSquareSecond    },
-    {"rad/s/s",        Unit::AngularAcceleration::RadianPerSquareSecond    },
-    {"rad/min^2",      Unit::AngularAcceleration::RadianPerSquareMinute    },
-    {"rad/min2",       Unit::AngularAcceleration::RadianPerSquareMinute    },
-    {"rad/min/min",    Unit::AngularAcceleration::RadianPerSquareMinute    },
-    {"rad/hr^2",       Unit::AngularAcceleration::RadianPerSquareHour      },
-    {"rad/hr2",        Unit::AngularAcceleration::RadianPerSquareHour      },
-    {"rad/hr/hr",      Unit::AngularAcceleration::RadianPerSquareHour      },
-    {"°/s^2",          Unit::AngularAcceleration::DegreePerSquareSecond    },
-    {"°/s2",           Unit::AngularAcceleration::DegreePerSquareSecond    },
-    {"°/s/s",          Unit::AngularAcceleration::DegreePerSquareSecond    },
-    {"deg/s^2",        Unit::AngularAcceleration::DegreePerSquareSecond    },
-    {"deg/s2",         Unit::AngularAcceleration::DegreePerSquareSecond    },
-    {"deg/s/s",        Unit::AngularAcceleration::DegreePerSquareSecond    },
-    {"°/min^2",        Unit::AngularAcceleration::DegreePerSquareMinute    },
-    {"°/min2",         Unit::AngularAcceleration::DegreePerSquareMinute    },
-    {"°/min/min",      Unit::AngularAcceleration::DegreePerSquareMinute    },
-    {"deg/min^2",      Unit::AngularAcceleration::DegreePerSquareMinute    },
-    {"deg/min2",       Unit::AngularAcceleration::DegreePerSquareMinute    },
-    {"deg/min/min",    Unit::AngularAcceleration::DegreePerSquareMinute    },
-    {"°/hr^2",         Unit::AngularAcceleration::DegreePerSquareHour      },
-    {"°/hr2",          Unit::AngularAcceleration::DegreePerSquareHour      },
-    {"°/hr/hr",        Unit::AngularAcceleration::DegreePerSquareHour      },
-    {"deg/hr^2",       Unit::AngularAcceleration::DegreePerSquareHour      },
-    {"deg/hr2",        Unit::AngularAcceleration::DegreePerSquareHour      },
-    {"deg/hr/hr",      Unit::AngularAcceleration::DegreePerSquareHour      },
-    {"arcmin/s^2",     Unit::AngularAcceleration::ArcminutePerSquareSecond },
-    {"arcmin/s2",      Unit::AngularAcceleration::ArcminutePerSquareSecond },
-    {"arcmin/s/s",     Unit::AngularAcceleration::ArcminutePerSquareSecond },
-    {"arcmin/min^2",   Unit::AngularAcceleration::ArcminutePerSquareMinute },
-    {"arcmin/min2",    Unit::AngularAcceleration::ArcminutePerSquareMinute },
-    {"arcmin/min/min", Unit::AngularAcceleration::ArcminutePerSquareMinute },
-    {"arcmin/hr^2",    Unit::AngularAcceleration::ArcminutePerSquareHour   },
-    {"arcmin/hr2",     Unit::AngularAcceleration::ArcminutePerSquareHour   },
-    {"arcmin/hr/hr",   Unit::AngularAcceleration::ArcminutePerSquareHour   },
-    {"arcsec/s^2",     Unit::AngularAcceleration::ArcsecondPerSquareSecond },
-    {"arcsec/s2",      Unit::AngularAcceleration::ArcsecondPerSquareSecond },
-    {"arcsec/s/s",     Unit::AngularAcceleration::ArcsecondPerSquareSecond },
-    {"arcsec/min^2",   Unit::AngularAcceleration::ArcsecondPerSquareMinute },
-    {"arcsec/min2",    Unit::AngularAcceleration::ArcsecondPerSquareMinute },
-    {"arcsec/min/min", Unit::AngularAcceleration::ArcsecondPerSquareMinute },
-    {"arcsec/hr^2",    Unit::AngularAcceleration::ArcsecondPerSquareHour   },
-    {"arcsec/hr2",     Unit::AngularAcceleration::ArcsecondPerSquareHour   },
-    {"arcsec/hr/hr",   Unit::AngularAcceleration::ArcsecondPerSquareHour   },
-    {"rev/s^2",        Unit::AngularAcceleration::RevolutionPerSquareSecond},
-    {"rev/s2",         Unit::AngularAcceleration::RevolutionPerSquareSecond},
-    {"rev/s/s",        Unit::AngularAcceleration::RevolutionPerSquareSecond},
-    {"rev/min^2",      Unit::AngularAcceleration::RevolutionPerSquareMinute},
-    {"rev/min2",       Unit::AngularAcceleration::RevolutionPerSquareMinute},
-    {"rev/min/min",    Unit::AngularAcceleration::RevolutionPerSquareMinute},
-    {"rev/hr^2",       Unit::AngularAcceleration::RevolutionPerSquareHour  },
-    {"rev/hr2",        Unit::AngularAcceleration::RevolutionPerSquareHour  },
-    {"rev/hr/hr",      Unit::AngularAcceleration::RevolutionPerSquareHour  },
-};
+inline constexpr std::array<std::pair<std::string_view, Unit::AngularAcceleration>, 54>
+    Spellings<Unit::AngularAcceleration>{{
+        {"arcmin/hr/hr",   Unit::AngularAcceleration::ArcminutePerSquareHour   },
+        {"arcmin/hr2",     Unit::AngularAcceleration::ArcminutePerSquareHour   },
+        {"arcmin/hr^2",    Unit::AngularAcceleration::ArcminutePerSquareHour   },
+        {"arcmin/min/min", Unit::AngularAcceleration::ArcminutePerSquareMinute },
+        {"arcmin/min2",    Unit::AngularAcceleration::ArcminutePerSquareMinute },
+        {"arcmin/min^2",   Unit::AngularAcceleration::ArcminutePerSquareMinute },
+        {"arcmin/s/s",     Unit::AngularAcceleration::ArcminutePerSquareSecond },
+        {"arcmin/s2",      Unit::AngularAcceleration::ArcminutePerSquareSecond },
+        {"arcmin/s^2",     Unit::AngularAcceleration::ArcminutePerSquareSecond },
+        {"arcsec/hr/hr",   Unit::AngularAcceleration::ArcsecondPerSquareHour   },
+        {"arcsec/hr2",     Unit::AngularAcceleration::ArcsecondPerSquareHour   },
+        {"arcsec/hr^2",    Unit::AngularAcceleration::ArcsecondPerSquareHour   },
+        {"arcsec/min/min", Unit::AngularAcceleration::ArcsecondPerSquareMinute },
+        {"arcsec/min2",    Unit::AngularAcceleration::ArcsecondPerSquareMinute },
+        {"arcsec/min^2",   Unit::AngularAcceleration::ArcsecondPerSquareMinute },
+        {"arcsec/s/s",     Unit::AngularAcceleration::ArcsecondPerSquareSecond },
+        {"arcsec/s2",      Unit::AngularAcceleration::ArcsecondPerSquareSecond },
+        {"arcsec/s^2",     Unit::AngularAcceleration::ArcsecondPerSquareSecond },
+        {"deg/hr/hr",      Unit::AngularAcceleration::DegreePerSquareHour      },
+        {"deg/hr2",        Unit::AngularAcceleration::DegreePerSquareHour      },
+        {"deg/hr^2",       Unit::AngularAcceleration::DegreePerSquareHour      },
+        {"deg/min/min",    Unit::AngularAcceleration::DegreePerSquareMinute    },
+        {"deg/min2",       Unit::AngularAcceleration::DegreePerSquareMinute    },
+        {"deg/min^2",      Unit::AngularAcceleration::DegreePerSquareMinute    },
+        {"deg/s/s",        Unit::AngularAcceleration::DegreePerSquareSecond    },
+        {"deg/s2",         Unit::AngularAcceleration::DegreePerSquareSecond    },
+        {"deg/s^2",        Unit::AngularAcceleration::DegreePerSquareSecond    },
+        {"rad/hr/hr",      Unit::AngularAcceleration::RadianPerSquareHour      },
+        {"rad/hr2",        Unit::AngularAcceleration::RadianPerSquareHour      },
+        {"rad/hr^2",       Unit::AngularAcceleration::RadianPerSquareHour      },
+        {"rad/min/min",    Unit::AngularAcceleration::RadianPerSquareMinute    },
+        {"rad/min2",       Unit::AngularAcceleration::RadianPerSquareMinute    },
+        {"rad/min^2",      Unit::AngularAcceleration::RadianPerSquareMinute    },
+        {"rad/s/s",        Unit::AngularAcceleration::RadianPerSquareSecond    },
+        {"rad/s2",         Unit::AngularAcceleration::RadianPerSquareSecond    },
+        {"rad/s^2",        Unit::AngularAcceleration::RadianPerSquareSecond    },
+        {"rev/hr/hr",      Unit::AngularAcceleration::RevolutionPerSquareHour  },
+        {"rev/hr2",        Unit::AngularAcceleration::RevolutionPerSquareHour  },
+        {"rev/hr^2",       Unit::AngularAcceleration::RevolutionPerSquareHour  },
+        {"rev/min/min",    Unit::AngularAcceleration::RevolutionPerSquareMinute},
+        {"rev/min2",       Unit::AngularAcceleration::RevolutionPerSquareMinute},
+        {"rev/min^2",      Unit::AngularAcceleration::RevolutionPerSquareMinute},
+        {"rev/s/s",        Unit::AngularAcceleration::RevolutionPerSquareSecond},
+        {"rev/s2",         Unit::AngularAcceleration::RevolutionPerSquareSecond},
+        {"rev/s^2",        Unit::AngularAcceleration::RevolutionPerSquareSecond},
+        {"°/hr/hr",        Unit::AngularAcceleration::DegreePerSquareHour      },
+        {"°/hr2",          Unit::AngularAcceleration::DegreePerSquareHour      },
+        {"°/hr^2",         Unit::AngularAcceleration::DegreePerSquareHour      },
+        {"°/min/min",      Unit::AngularAcceleration::DegreePerSquareMinute    },
+        {"°/min2",         Unit::AngularAcceleration::DegreePerSquareMinute    },
+        {"°/min^2",        Unit::AngularAcceleration::DegreePerSquareMinute    },
+        {"°/s/s",          Unit::AngularAcceleration::DegreePerSquareSecond    },
+        {"°/s2",           Unit::AngularAcceleration::DegreePerSquareSecond    },
+        {"°/s^2",          Unit::AngularAcceleration::DegreePerSquareSecond    },
+}};
 
 // clang-format on
 
@@ -451,116 +450,8 @@ Conversion<Unit::AngularAcceleration, Unit::AngularAcceleration::RevolutionPerSq
   value *= Pi<NumericType> / static_cast<NumericType>(6480000.0L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::AngularAcceleration,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::AngularAcceleration, NumericType>{
-        {Unit::AngularAcceleration::RadianPerSquareSecond,
-         Conversions<Unit::AngularAcceleration,
-         Unit::AngularAcceleration::RadianPerSquareSecond>::FromStandard<NumericType>    },
-        {Unit::AngularAcceleration::RadianPerSquareMinute,
-         Conversions<Unit::AngularAcceleration,
-         Unit::AngularAcceleration::RadianPerSquareMinute>::FromStandard<NumericType>    },
-        {Unit::AngularAcceleration::RadianPerSquareHour,
-         Conversions<Unit::AngularAcceleration,
-         Unit::AngularAcceleration::RadianPerSquareHour>::FromStandard<NumericType>      },
-        {Unit::AngularAcceleration::DegreePerSquareSecond,
-         Conversions<Unit::AngularAcceleration,
-         Unit::AngularAcceleration::DegreePerSquareSecond>::FromStandard<NumericType>    },
-        {Unit::AngularAcceleration::DegreePerSquareMinute,
-         Conversions<Unit::AngularAcceleration,
-         Unit::AngularAcceleration::DegreePerSquareMinute>::FromStandard<NumericType>    },
-        {Unit::AngularAcceleration::DegreePerSquareHour,
-         Conversions<Unit::AngularAcceleration,
-         Unit::AngularAcceleration::DegreePerSquareHour>::FromStandard<NumericType>      },
-        {Unit::AngularAcceleration::ArcminutePerSquareSecond,
-         Conversions<
-             Unit::AngularAcceleration,
-         Unit::AngularAcceleration::ArcminutePerSquareSecond>::FromStandard<NumericType> },
-        {Unit::AngularAcceleration::ArcminutePerSquareMinute,
-         Conversions<
-             Unit::AngularAcceleration,
-         Unit::AngularAcceleration::ArcminutePerSquareMinute>::FromStandard<NumericType> },
-        {Unit::AngularAcceleration::ArcminutePerSquareHour,
-         Conversions<Unit::AngularAcceleration,
-         Unit::AngularAcceleration::ArcminutePerSquareHour>::FromStandard<NumericType>   },
-        {Unit::AngularAcceleration::ArcsecondPerSquareSecond,
-         Conversions<
-             Unit::AngularAcceleration,
-         Unit::AngularAcceleration::ArcsecondPerSquareSecond>::FromStandard<NumericType> },
-        {Unit::AngularAcceleration::ArcsecondPerSquareMinute,
-         Conversions<
-             Unit::AngularAcceleration,
-         Unit::AngularAcceleration::ArcsecondPerSquareMinute>::FromStandard<NumericType> },
-        {Unit::AngularAcceleration::ArcsecondPerSquareHour,
-         Conversions<Unit::AngularAcceleration,
-         Unit::AngularAcceleration::ArcsecondPerSquareHour>::FromStandard<NumericType>   },
-        {Unit::AngularAcceleration::RevolutionPerSquareSecond,
-         Conversions<
-             Unit::AngularAcceleration,
-         Unit::AngularAcceleration::RevolutionPerSquareSecond>::FromStandard<NumericType>},
-        {Unit::AngularAcceleration::RevolutionPerSquareMinute,
-         Conversions<
-             Unit::AngularAcceleration,
-         Unit::AngularAcceleration::RevolutionPerSquareMinute>::FromStandard<NumericType>},
-        {Unit::AngularAcceleration::RevolutionPerSquareHour,
-         Conversions<
-             Unit::AngularAcceleration,
-         Unit::AngularAcceleration::RevolutionPerSquareHour>::FromStandard<NumericType>  },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::AngularAcceleration,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::AngularAcceleration, NumericType>{
-        {Unit::AngularAcceleration::RadianPerSquareSecond,
-         Conversions<Unit::AngularAcceleration,
-         Unit::AngularAcceleration::RadianPerSquareSecond>::ToStandard<NumericType>    },
-        {Unit::AngularAcceleration::RadianPerSquareMinute,
-         Conversions<Unit::AngularAcceleration,
-         Unit::AngularAcceleration::RadianPerSquareMinute>::ToStandard<NumericType>    },
-        {Unit::AngularAcceleration::RadianPerSquareHour,
-         Conversions<Unit::AngularAcceleration,
-         Unit::AngularAcceleration::RadianPerSquareHour>::ToStandard<NumericType>      },
-        {Unit::AngularAcceleration::DegreePerSquareSecond,
-         Conversions<Unit::AngularAcceleration,
-         Unit::AngularAcceleration::DegreePerSquareSecond>::ToStandard<NumericType>    },
-        {Unit::AngularAcceleration::DegreePerSquareMinute,
-         Conversions<Unit::AngularAcceleration,
-         Unit::AngularAcceleration::DegreePerSquareMinute>::ToStandard<NumericType>    },
-        {Unit::AngularAcceleration::DegreePerSquareHour,
-         Conversions<Unit::AngularAcceleration,
-         Unit::AngularAcceleration::DegreePerSquareHour>::ToStandard<NumericType>      },
-        {Unit::AngularAcceleration::ArcminutePerSquareSecond,
-         Conversions<Unit::AngularAcceleration,
-         Unit::AngularAcceleration::ArcminutePerSquareSecond>::ToStandard<NumericType> },
-        {Unit::AngularAcceleration::ArcminutePerSquareMinute,
-         Conversions<Unit::AngularAcceleration,
-         Unit::AngularAcceleration::ArcminutePerSquareMinute>::ToStandard<NumericType> },
-        {Unit::AngularAcceleration::ArcminutePerSquareHour,
-         Conversions<Unit::AngularAcceleration,
-         Unit::AngularAcceleration::ArcminutePerSquareHour>::ToStandard<NumericType>   },
-        {Unit::AngularAcceleration::ArcsecondPerSquareSecond,
-         Conversions<Unit::AngularAcceleration,
-         Unit::AngularAcceleration::ArcsecondPerSquareSecond>::ToStandard<NumericType> },
-        {Unit::AngularAcceleration::ArcsecondPerSquareMinute,
-         Conversions<Unit::AngularAcceleration,
-         Unit::AngularAcceleration::ArcsecondPerSquareMinute>::ToStandard<NumericType> },
-        {Unit::AngularAcceleration::ArcsecondPerSquareHour,
-         Conversions<Unit::AngularAcceleration,
-         Unit::AngularAcceleration::ArcsecondPerSquareHour>::ToStandard<NumericType>   },
-        {Unit::AngularAcceleration::RevolutionPerSquareSecond,
-         Conversions<
-             Unit::AngularAcceleration,
-         Unit::AngularAcceleration::RevolutionPerSquareSecond>::ToStandard<NumericType>},
-        {Unit::AngularAcceleration::RevolutionPerSquareMinute,
-         Conversions<
-             Unit::AngularAcceleration,
-         Unit::AngularAcceleration::RevolutionPerSquareMinute>::ToStandard<NumericType>},
-        {Unit::AngularAcceleration::RevolutionPerSquareHour,
-         Conversions<Unit::AngularAcceleration,
-         Unit::AngularAcceleration::RevolutionPerSquareHour>::ToStandard<NumericType>  },
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::AngularAcceleration>{15};
 
 }  // namespace Internal
 
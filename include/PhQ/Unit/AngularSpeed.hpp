@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_ANGULAR_SPEED_HPP
 #define PHQ_UNIT_ANGULAR_SPEED_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -120,58 +119,62 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::AngularSpeed u
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::AngularSpeed> ConsistentUnits<Unit::AngularSpeed>{
-    {UnitSystem::MetreKilogramSecondKelvin,  Unit::AngularSpeed::RadianPerSecond},
-    {UnitSystem::MillimetreGramSecondKelvin, Unit::AngularSpeed::RadianPerSecond},
-    {UnitSystem::FootPoundSecondRankine,     Unit::AngularSpeed::RadianPerSecond},
-    {UnitSystem::InchPoundSecondRankine,     Unit::AngularSpeed::RadianPerSecond},
-};
-
-template <>
-inline const std::map<Unit::AngularSpeed, UnitSystem> RelatedUnitSystems<Unit::AngularSpeed>{};
-
-template <>
-inline const std::map<Unit::AngularSpeed, std::string_view> Abbreviations<Unit::AngularSpeed>{
-    {Unit::AngularSpeed::RadianPerSecond,     "rad/s"     },
-    {Unit::AngularSpeed::RadianPerMinute,     "rad/min"   },
-    {Unit::AngularSpeed::RadianPerHour,       "rad/hr"    },
-    {Unit::AngularSpeed::DegreePerSecond,     "deg/s"     },
-    {Unit::AngularSpeed::DegreePerMinute,     "deg/min"   },
-    {Unit::AngularSpeed::DegreePerHour,       "deg/hr"    },
-    {Unit::AngularSpeed::ArcminutePerSecond,  "arcmin/s"  },
-    {Unit::AngularSpeed::ArcminutePerMinute,  "arcmin/min"},
-    {Unit::AngularSpeed::ArcminutePerHour,    "arcmin/hr" },
-    {Unit::AngularSpeed::ArcsecondPerSecond,  "arcsec/s"  },
-    {Unit::AngularSpeed::ArcsecondPerMinute,  "arcsec/min"},
-    {Unit::AngularSpeed::ArcsecondPerHour,    "arcsec/hr" },
-    {Unit::AngularSpeed::RevolutionPerSecond, "rev/s"     },
-    {Unit::AngularSpeed::RevolutionPerMinute, "rev/min"   },
-    {Unit::AngularSpeed::RevolutionPerHour,   "rev/hr"    },
-};
+inline constexpr std::array<std::pair<UnitSystem, Unit::AngularSpeed>, 4>
+    ConsistentUnits<Unit::AngularSpeed>{{
+        {UnitSystem::MetreKilogramSecondKelvin,  Unit::AngularSpeed::RadianPerSecond},
+        {UnitSystem::MillimetreGramSecondKelvin, Unit::AngularSpeed::RadianPerSecond},
+        {UnitSystem::FootPoundSecondRankine,     Unit::AngularSpeed::RadianPerSecond},
+        {UnitSystem::InchPoundSecondRankine,     Unit::AngularSpeed::RadianPerSecond},
+}};
+
+template <>
+inline constexpr std::array<std::pair<Unit::AngularSpeed, UnitSystem>, 0>
+    RelatedUnitSystems<Unit::AngularSpeed>{};
+
+template <>
+inline constexpr std::array<std::pair<Unit::AngularSpeed, std::string_view>, 15>
+    Abbreviations<Unit::AngularSpeed>{{
+        {Unit::AngularSpeed::RadianPerSecond,     "rad/s"     },
+        {Unit::AngularSpeed::RadianPerMinute,     "rad/min"   },
+        {Unit::AngularSpeed::RadianPerHour,       "rad/hr"    },
+        {Unit::AngularSpeed::DegreePerSecond,     "deg/s"     },
+        {Unit::AngularSpeed::DegreePerMinute,     "deg/min"   },
+        {Unit::AngularSpeed::DegreePerHour,       "deg/hr"    },
+        {Unit::AngularSpeed::ArcminutePerSecond,  "arcmin/s"  },
+        {Unit::AngularSpeed::ArcminutePerMinute,  "arcmin/min"},
+        {Unit::AngularSpeed::ArcminutePerHour,    "arcmin/hr" },
+        {Unit::AngularSpeed::ArcsecondPerSecond,  "arcsec/s"  },
+        {Unit::AngularSpeed::ArcsecondPerMinute,  "arcsec/min"},
+        {Unit::AngularSpeed::ArcsecondPerHour,    "arcsec/hr" },
+        {Unit::AngularSpeed::RevolutionPerSecond, "rev/s"     },
+        {Unit::AngularSpeed::RevolutionPerMinute, "rev/min"   },
+        {Unit::AngularSpeed::RevolutionPerHour,   "rev/hr"    },
+}};
 
 // clang-format off
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::AngularSpeed> Spellings<Unit::AngularSpeed>{
-    {"rad/s",      Unit::AngularSpeed::RadianPerSecond    },
-    {"rad/min",    Unit::AngularSpeed::RadianPerMinute    },
-    {"rad/hr",     Unit::AngularSpeed::RadianPerHour      },
-    {"°/s",        Unit::AngularSpeed::DegreePerSecond    },
-    {"deg/s",      Unit::AngularSpeed::DegreePerSecond    },
-    {"°/min",      Unit::AngularSpeed::DegreePerMinute    },
-    {"deg/min",    Unit::AngularSpeed::DegreePerMinute    },
-    {"°/hr",       Unit::AngularSpeed::DegreePerHour      },
-    {"deg/hr",     Unit::AngularSpeed::DegreePerHour      },
-    {"arcmin/s",   Unit::AngularSpeed::ArcminutePerSecond },
-    {"arcmin/min", Unit::AngularSpeed::ArcminutePerMinute },
-    {"arcmin/hr",  Unit::AngularSpeed::ArcminutePerHour   },
-    {"arcsec/s",   Unit::AngularSpeed::ArcsecondPerSecond },
-    {"arcsec/min", Unit::AngularSpeed::ArcsecondPerMinute },
-    {"arcsec/hr",  Unit::AngularSpeed::ArcsecondPerHour   },
-    {"rev/s",      Unit::AngularSpeed::RevolutionPerSecond},
-    {"rev/min",    Unit::AngularSpeed::RevolutionPerMinute},
-    {"rev/hr",     Unit::AngularSpeed::RevolutionPerHour  },
-};
+inline constexpr std::array<std::pair<std::string_view, Unit::AngularSpeed>, 18>
+    Spellings<Unit::AngularSpeed>{{
+        {"arcmin/hr",  Unit::AngularSpeed::ArcminutePerHour   },
+        {"arcmin/min", Unit::AngularSpeed::ArcminutePerMinute },
+        {"arcmin/s",   Unit::AngularSpeed::ArcminutePerSecond },
+        {"arcsec/hr",  Unit::AngularSpeed::ArcsecondPerHour   },
+        {"arcsec/min", Unit::AngularSpeed::ArcsecondPerMinute },
+        {"arcsec/s",   Unit::AngularSpeed::ArcsecondPerSecond },
+        {"deg/hr",     Unit::AngularSpeed::DegreePerHour      },
+        {"deg/min",    Unit::AngularSpeed::DegreePerMinute    },
+        {"deg/s",      Unit::AngularSpeed::DegreePerSecond    },
+        {"rad/hr",     Unit::AngularSpeed::RadianPerHour      },
+        {"rad/min",    Unit::AngularSpeed::RadianPerMinute    },
+        {"rad/s",      Unit::AngularSpeed::RadianPerSecond    },
+        {"rev/hr",     Unit::AngularSpeed::RevolutionPerHour  },
+        {"rev/min",    Unit::AngularSpeed::RevolutionPerMinute},
+        {"rev/s",      Unit::AngularSpeed::RevolutionPerSecond},
+        {"°/hr",       Unit::AngularSpeed::DegreePerHour      },
+        {"°/min",      Unit::AngularSpeed::DegreePerMinute    },
+        {"°/s",        Unit::AngularSpeed::DegreePerSecond    },
+}};
 
 // clang-format on
 
@@ -409,107 +412,8 @@ Conversion<Unit::AngularSpeed, Unit::AngularSpeed::RevolutionPerHour>::ToStandar
   value *= Pi<NumericType> / static_cast<NumericType>(1800.0L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::AngularSpeed,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::AngularSpeed, NumericType>{
-        {Unit::AngularSpeed::RadianPerSecond,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::RadianPerSecond>::FromStandard<NumericType>    },
-        {Unit::AngularSpeed::RadianPerMinute,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::RadianPerMinute>::FromStandard<NumericType>    },
-        {Unit::AngularSpeed::RadianPerHour,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::RadianPerHour>::FromStandard<NumericType>      },
-        {Unit::AngularSpeed::DegreePerSecond,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::DegreePerSecond>::FromStandard<NumericType>    },
-        {Unit::AngularSpeed::DegreePerMinute,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::DegreePerMinute>::FromStandard<NumericType>    },
-        {Unit::AngularSpeed::DegreePerHour,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::DegreePerHour>::FromStandard<NumericType>      },
-        {Unit::AngularSpeed::ArcminutePerSecond,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::ArcminutePerSecond>::FromStandard<NumericType> },
-        {Unit::AngularSpeed::ArcminutePerMinute,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::ArcminutePerMinute>::FromStandard<NumericType> },
-        {Unit::AngularSpeed::ArcminutePerHour,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::ArcminutePerHour>::FromStandard<NumericType>   },
-        {Unit::AngularSpeed::ArcsecondPerSecond,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::ArcsecondPerSecond>::FromStandard<NumericType> },
-        {Unit::AngularSpeed::ArcsecondPerMinute,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::ArcsecondPerMinute>::FromStandard<NumericType> },
-        {Unit::AngularSpeed::ArcsecondPerHour,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::ArcsecondPerHour>::FromStandard<NumericType>   },
-        {Unit::AngularSpeed::RevolutionPerSecond,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::RevolutionPerSecond>::FromStandard<NumericType>},
-        {Unit::AngularSpeed::RevolutionPerMinute,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::RevolutionPerMinute>::FromStandard<NumericType>},
-        {Unit::AngularSpeed::RevolutionPerHour,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::RevolutionPerHour>::FromStandard<NumericType>  },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::AngularSpeed,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::AngularSpeed, NumericType>{
-        {Unit::AngularSpeed::RadianPerSecond,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::RadianPerSecond>::ToStandard<NumericType>    },
-        {Unit::AngularSpeed::RadianPerMinute,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::RadianPerMinute>::ToStandard<NumericType>    },
-        {Unit::AngularSpeed::RadianPerHour,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::RadianPerHour>::ToStandard<NumericType>      },
-        {Unit::AngularSpeed::DegreePerSecond,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::DegreePerSecond>::ToStandard<NumericType>    },
-        {Unit::AngularSpeed::DegreePerMinute,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::DegreePerMinute>::ToStandard<NumericType>    },
-        {Unit::AngularSpeed::DegreePerHour,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::DegreePerHour>::ToStandard<NumericType>      },
-        {Unit::AngularSpeed::ArcminutePerSecond,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::ArcminutePerSecond>::ToStandard<NumericType> },
-        {Unit::AngularSpeed::ArcminutePerMinute,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::ArcminutePerMinute>::ToStandard<NumericType> },
-        {Unit::AngularSpeed::ArcminutePerHour,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::ArcminutePerHour>::ToStandard<NumericType>   },
-        {Unit::AngularSpeed::ArcsecondPerSecond,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::ArcsecondPerSecond>::ToStandard<NumericType> },
-        {Unit::AngularSpeed::ArcsecondPerMinute,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::ArcsecondPerMinute>::ToStandard<NumericType> },
-        {Unit::AngularSpeed::ArcsecondPerHour,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::ArcsecondPerHour>::ToStandard<NumericType>   },
-        {Unit::AngularSpeed::RevolutionPerSecond,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::RevolutionPerSecond>::ToStandard<NumericType>},
-        {Unit::AngularSpeed::RevolutionPerMinute,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::RevolutionPerMinute>::ToStandard<NumericType>},
-        {Unit::AngularSpeed::RevolutionPerHour,
-         Conversions<Unit::AngularSpeed,
-         Unit::AngularSpeed::RevolutionPerHour>::ToStandard<NumericType>  },
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::AngularSpeed>{15};
 
 }  // namespace Internal
 
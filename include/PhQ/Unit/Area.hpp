@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_AREA_HPP
 #define PHQ_UNIT_AREA_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -119,25 +118,25 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Area unit) {
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::Area> ConsistentUnits<Unit::Area>{
+inline constexpr std::array<std::pair<UnitSystem, Unit::Area>, 4> ConsistentUnits<Unit::Area>{{
     {UnitSystem::MetreKilogramSecondKelvin,  Unit::Area::SquareMetre     },
     {UnitSystem::MillimetreGramSecondKelvin, Unit::Area::SquareMillimetre},
     {UnitSystem::FootPoundSecondRankine,     Unit::Area::SquareFoot      },
     {UnitSystem::InchPoundSecondRankine,     Unit::Area::SquareInch      },
-};
+}};
 
 template <>
-inline const std::map<Unit::Area, UnitSystem> RelatedUnitSystems<Unit::Area>{
+inline constexpr std::array<std::pair<Unit::Area, UnitSystem>, 4> RelatedUnitSystems<Unit::Area>{{
     {Unit::Area::SquareMetre,      UnitSystem::MetreKilogramSecondKelvin },
-    {Unit::Area::SquareMillimetre, UnitSystem::MillimetreGramSecondKelvin},
     {Unit::Area::SquareFoot,       UnitSystem::FootPoundSecondRankine    },
     {Unit::Area::SquareInch,       UnitSystem::InchPoundSecondRankine    },
-};
+    {Unit::Area::SquareMillimetre, UnitSystem::MillimetreGramSecondKelvin},
+}};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::Area, std::string_view> Abbreviations<Unit::Area>{
+inline constexpr std::array<std::pair<Unit::Area, std::string_view>, 15> Abbreviations<Unit::Area>{{
     {Unit::Area::SquareNauticalMile, "nmi^2"},
     {Unit::Area::SquareMile,         "mi^2" },
     {Unit::Area::SquareKilometre,    "km^2" },
@@ -153,51 +152,51 @@ inline const std::map<Unit::Area, std::string_view> Abbreviations<Unit::Area>{
     {Unit::Area::SquareMilliinch,    "mil^2"},
     {Unit::Area::SquareMicrometre,   "μm^2" },
     {Unit::Area::SquareMicroinch,    "μin^2"},
-};
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Area> Spellings<Unit::Area>{
-    {"nmi^2",       Unit::Area::SquareNauticalMile},
-    {"nmi2",        Unit::Area::SquareNauticalMile},
-    {"NM^2",        Unit::Area::SquareNauticalMile},
+inline constexpr std::array<std::pair<std::string_view, Unit::Area>, 40> Spellings<Unit::Area>{{
     {"NM",          Unit::Area::SquareNauticalMile},
-    {"mi^2",        Unit::Area::SquareMile        },
-    {"mi2",         Unit::Area::SquareMile        },
-    {"km^2",        Unit::Area::SquareKilometre   },
-    {"km2",         Unit::Area::SquareKilometre   },
-    {"ha",          Unit::Area::Hectare           },
+    {"NM^2",        Unit::Area::SquareNauticalMile},
     {"ac",          Unit::Area::Acre              },
-    {"m^2",         Unit::Area::SquareMetre       },
-    {"m2",          Unit::Area::SquareMetre       },
-    {"yd^2",        Unit::Area::SquareYard        },
-    {"yd2",         Unit::Area::SquareYard        },
-    {"ft^2",        Unit::Area::SquareFoot        },
-    {"ft2",         Unit::Area::SquareFoot        },
-    {"dm^2",        Unit::Area::SquareDecimetre   },
+    {"cm2",         Unit::Area::SquareCentimetre  },
+    {"cm^2",        Unit::Area::SquareCentimetre  },
     {"dm2",         Unit::Area::SquareDecimetre   },
-    {"in^2",        Unit::Area::SquareInch        },
+    {"dm^2",        Unit::Area::SquareDecimetre   },
+    {"ft2",         Unit::Area::SquareFoot        },
+    {"ft^2",        Unit::Area::SquareFoot        },
+    {"ha",          Unit::Area::Hectare           },
     {"in2",         Unit::Area::SquareInch        },
-    {"cm^2",        Unit::Area::SquareCentimetre  },
-    {"cm2",         Unit::Area::SquareCentimetre  },
-    {"mm^2",        Unit::Area::SquareMillimetre  },
-    {"mm2",         Unit::Area::SquareMillimetre  },
-    {"millinch^2",  Unit::Area::SquareMilliinch   },
-    {"millinch2",   Unit::Area::SquareMilliinch   },
-    {"milliinch^2", Unit::Area::SquareMilliinch   },
-    {"milliinch2",  Unit::Area::SquareMilliinch   },
-    {"mil^2",       Unit::Area::SquareMilliinch   },
+    {"in^2",        Unit::Area::SquareInch        },
+    {"km2",         Unit::Area::SquareKilometre   },
+    {"km^2",        Unit::Area::SquareKilometre   },
+    {"m2",          Unit::Area::SquareMetre       },
+    {"m^2",         Unit::Area::SquareMetre       },
+    {"mi2",         Unit::Area::SquareMile        },
+    {"mi^2",        Unit::Area::SquareMile        },
     {"mil2",        Unit::Area::SquareMilliinch   },
-    {"thou^2",      Unit::Area::SquareMilliinch   },
+    {"mil^2",       Unit::Area::SquareMilliinch   },
+    {"milliinch2",  Unit::Area::SquareMilliinch   },
+    {"milliinch^2", Unit::Area::SquareMilliinch   },
+    {"millinch2",   Unit::Area::SquareMilliinch   },
+    {"millinch^2",  Unit::Area::SquareMilliinch   },
+    {"mm2",         Unit::Area::SquareMillimetre  },
+    {"mm^2",        Unit::Area::SquareMillimetre  },
+    {"nmi2",        Unit::Area::SquareNauticalMile},
+    {"nmi^2",       Unit::Area::SquareNauticalMile},
     {"thou2",       Unit::Area::SquareMilliinch   },
-    {"μm^2",        Unit::Area::SquareMicrometre  },
-    {"μm2",         Unit::Area::SquareMicrometre  },
-    {"um^2",        Unit::Area::SquareMicrometre  },
+    {"thou^2",      Unit::Area::SquareMilliinch   },
+    {"uin2",        Unit::Area::SquareMicroinch   },
+    {"uin^2",       Unit::Area::SquareMicroinch   },
     {"um2",         Unit::Area::SquareMicrometre  },
-    {"μin^2",       Unit::Area::SquareMicroinch   },
+    {"um^2",        Unit::Area::SquareMicrometre  },
+    {"yd2",         Unit::Area::SquareYard        },
+    {"yd^2",        Unit::Area::SquareYard        },
     {"μin2",        Unit::Area::SquareMicroinch   },
-    {"uin^2",       Unit::Area::SquareMicroinch   },
-    {"uin2",        Unit::Area::SquareMicroinch   },
-};
+    {"μin^2",       Unit::Area::SquareMicroinch   },
+    {"μm2",         Unit::Area::SquareMicrometre  },
+    {"μm^2",        Unit::Area::SquareMicrometre  },
+}};
 
 // clang-format on
 
@@ -409,73 +408,8 @@ inline constexpr void Conversion<Unit::Area, Unit::Area::SquareMicroinch>::ToSta
   value *= static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::Area, std::function<void(NumericType* const, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Area, NumericType>{
-        {Unit::Area::SquareNauticalMile,
-         Conversions<Unit::Area,                                 Unit::Area::SquareNauticalMile>::FromStandard<NumericType>},
-        {Unit::Area::SquareMile,
-         Conversions<Unit::Area,                                 Unit::Area::SquareMile>::FromStandard<NumericType>        },
-        {Unit::Area::SquareKilometre,
-         Conversions<Unit::Area,                                 Unit::Area::SquareKilometre>::FromStandard<NumericType>   },
-        {Unit::Area::Hectare,
-         Conversions<Unit::Area,                                 Unit::Area::Hectare>::FromStandard<NumericType>           },
-        {Unit::Area::Acre,               Conversions<Unit::Area, Unit::Area::Acre>::FromStandard<NumericType>              },
-        {Unit::Area::SquareMetre,
-         Conversions<Unit::Area,                                 Unit::Area::SquareMetre>::FromStandard<NumericType>       },
-        {Unit::Area::SquareYard,
-         Conversions<Unit::Area,                                 Unit::Area::SquareYard>::FromStandard<NumericType>        },
-        {Unit::Area::SquareFoot,
-         Conversions<Unit::Area,                                 Unit::Area::SquareFoot>::FromStandard<NumericType>        },
-        {Unit::Area::SquareDecimetre,
-         Conversions<Unit::Area,                                 Unit::Area::SquareDecimetre>::FromStandard<NumericType>   },
-        {Unit::Area::SquareInch,
-         Conversions<Unit::Area,                                 Unit::Area::SquareInch>::FromStandard<NumericType>        },
-        {Unit::Area::SquareCentimetre,
-         Conversions<Unit::Area,                                 Unit::Area::SquareCentimetre>::FromStandard<NumericType>  },
-        {Unit::Area::SquareMillimetre,
-         Conversions<Unit::Area,                                 Unit::Area::SquareMillimetre>::FromStandard<NumericType>  },
-        {Unit::Area::SquareMilliinch,
-         Conversions<Unit::Area,                                 Unit::Area::SquareMilliinch>::FromStandard<NumericType>   },
-        {Unit::Area::SquareMicrometre,
-         Conversions<Unit::Area,                                 Unit::Area::SquareMicrometre>::FromStandard<NumericType>  },
-        {Unit::Area::SquareMicroinch,
-         Conversions<Unit::Area,                                 Unit::Area::SquareMicroinch>::FromStandard<NumericType>   },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Area, std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Area, NumericType>{
-        {Unit::Area::SquareNauticalMile,
-         Conversions<Unit::Area,                                 Unit::Area::SquareNauticalMile>::ToStandard<NumericType>},
-        {Unit::Area::SquareMile,
-         Conversions<Unit::Area,                                 Unit::Area::SquareMile>::ToStandard<NumericType>        },
-        {Unit::Area::SquareKilometre,
-         Conversions<Unit::Area,                                 Unit::Area::SquareKilometre>::ToStandard<NumericType>   },
-        {Unit::Area::Hectare,
-         Conversions<Unit::Area,                                 Unit::Area::Hectare>::ToStandard<NumericType>           },
-        {Unit::Area::Acre,               Conversions<Unit::Area, Unit::Area::Acre>::ToStandard<NumericType>              },
-        {Unit::Area::SquareMetre,
-         Conversions<Unit::Area,                                 Unit::Area::SquareMetre>::ToStandard<NumericType>       },
-        {Unit::Area::SquareYard,
-         Conversions<Unit::Area,                                 Unit::Area::SquareYard>::ToStandard<NumericType>        },
-        {Unit::Area::SquareFoot,
-         Conversions<Unit::Area,                                 Unit::Area::SquareFoot>::ToStandard<NumericType>        },
-        {Unit::Area::SquareDecimetre,
-         Conversions<Unit::Area,                                 Unit::Area::SquareDecimetre>::ToStandard<NumericType>   },
-        {Unit::Area::SquareInch,
-         Conversions<Unit::Area,                                 Unit::Area::SquareInch>::ToStandard<NumericType>        },
-        {Unit::Area::SquareCentimetre,
-         Conversions<Unit::Area,                                 Unit::Area::SquareCentimetre>::ToStandard<NumericType>  },
-        {Unit::Area::SquareMillimetre,
-         Conversions<Unit::Area,                                 Unit::Area::SquareMillimetre>::ToStandard<NumericType>  },
-        {Unit::Area::SquareMilliinch,
-         Conversions<Unit::Area,                                 Unit::Area::SquareMilliinch>::ToStandard<NumericType>   },
-        {Unit::Area::SquareMicrometre,
-         Conversions<Unit::Area,                                 Unit::Area::SquareMicrometre>::ToStandard<NumericType>  },
-        {Unit::Area::SquareMicroinch,
-         Conversions<Unit::Area,                                 Unit::Area::SquareMicroinch>::ToStandard<NumericType>   },
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Area>{15};
 
 }  // namespace Internal
 
@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_DIFFUSIVITY_HPP
 #define PHQ_UNIT_DIFFUSIVITY_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -120,83 +119,87 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Diffusivity un
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::Diffusivity> ConsistentUnits<Unit::Diffusivity>{
-    {UnitSystem::MetreKilogramSecondKelvin,  Unit::Diffusivity::SquareMetrePerSecond     },
-    {UnitSystem::MillimetreGramSecondKelvin, Unit::Diffusivity::SquareMillimetrePerSecond},
-    {UnitSystem::FootPoundSecondRankine,     Unit::Diffusivity::SquareFootPerSecond      },
-    {UnitSystem::InchPoundSecondRankine,     Unit::Diffusivity::SquareInchPerSecond      },
-};
+inline constexpr std::array<std::pair<UnitSystem, Unit::Diffusivity>, 4>
+    ConsistentUnits<Unit::Diffusivity>{{
+        {UnitSystem::MetreKilogramSecondKelvin,  Unit::Diffusivity::SquareMetrePerSecond     },
+        {UnitSystem::MillimetreGramSecondKelvin, Unit::Diffusivity::SquareMillimetrePerSecond},
+        {UnitSystem::FootPoundSecondRankine,     Unit::Diffusivity::SquareFootPerSecond      },
+        {UnitSystem::InchPoundSecondRankine,     Unit::Diffusivity::SquareInchPerSecond      },
+}};
 
 template <>
-inline const std::map<Unit::Diffusivity, UnitSystem> RelatedUnitSystems<Unit::Diffusivity>{
-    {Unit::Diffusivity::SquareMetrePerSecond,      UnitSystem::MetreKilogramSecondKelvin },
-    {Unit::Diffusivity::SquareMillimetrePerSecond, UnitSystem::MillimetreGramSecondKelvin},
-    {Unit::Diffusivity::SquareFootPerSecond,       UnitSystem::FootPoundSecondRankine    },
-    {Unit::Diffusivity::SquareInchPerSecond,       UnitSystem::InchPoundSecondRankine    },
-};
+inline constexpr std::array<std::pair<Unit::Diffusivity, UnitSystem>, 4>
+    RelatedUnitSystems<Unit::Diffusivity>{{
+        {Unit::Diffusivity::SquareMetrePerSecond,      UnitSystem::MetreKilogramSecondKelvin },
+        {Unit::Diffusivity::SquareFootPerSecond,       UnitSystem::FootPoundSecondRankine    },
+        {Unit::Diffusivity::SquareInchPerSecond,       UnitSystem::InchPoundSecondRankine    },
+        {Unit::Diffusivity::SquareMillimetrePerSecond, UnitSystem::MillimetreGramSecondKelvin},
+}};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::Diffusivity, std::string_view> Abbreviations<Unit::Diffusivity>{
-    {Unit::Diffusivity::SquareNauticalMilePerSecond, "nmi^2/s"},
-    {Unit::Diffusivity::SquareMilePerSecond,         "mi^2/s" },
-    {Unit::Diffusivity::SquareKilometrePerSecond,    "km^2/s" },
-    {Unit::Diffusivity::HectarePerSecond,            "ha/s"   },
-    {Unit::Diffusivity::AcrePerSecond,               "ac/s"   },
-    {Unit::Diffusivity::SquareMetrePerSecond,        "m^2/s"  },
-    {Unit::Diffusivity::SquareYardPerSecond,         "yd^2/s" },
-    {Unit::Diffusivity::SquareFootPerSecond,         "ft^2/s" },
-    {Unit::Diffusivity::SquareDecimetrePerSecond,    "dm^2/s" },
-    {Unit::Diffusivity::SquareInchPerSecond,         "in^2/s" },
-    {Unit::Diffusivity::SquareCentimetrePerSecond,   "cm^2/s" },
-    {Unit::Diffusivity::SquareMillimetrePerSecond,   "mm^2/s" },
-    {Unit::Diffusivity::SquareMilliinchPerSecond,    "mil^2/s"},
-    {Unit::Diffusivity::SquareMicrometrePerSecond,   "μm^2/s" },
-    {Unit::Diffusivity::SquareMicroinchPerSecond,    "μin^2/s"},
-};
-
-template <>
-inline const std::unordered_map<std::string_view, Unit::Diffusivity> Spellings<Unit::Diffusivity>{
-    {"nmi^2/s",       Unit::Diffusivity::SquareNauticalMilePerSecond},
-    {"nmi2/s",        Unit::Diffusivity::SquareNauticalMilePerSecond},
-    {"mi^2/s",        Unit::Diffusivity::SquareMilePerSecond        },
-    {"mi2/s",         Unit::Diffusivity::SquareMilePerSecond        },
-    {"km^2/s",        Unit::Diffusivity::SquareKilometrePerSecond   },
-    {"km2/s",         Unit::Diffusivity::SquareKilometrePerSecond   },
-    {"ha/s",          Unit::Diffusivity::HectarePerSecond           },
-    {"ac/s",          Unit::Diffusivity::AcrePerSecond              },
-    {"m^2/s",         Unit::Diffusivity::SquareMetrePerSecond       },
-    {"m2/s",          Unit::Diffusivity::SquareMetrePerSecond       },
-    {"yd^2/s",        Unit::Diffusivity::SquareYardPerSecond        },
-    {"yd2/s",         Unit::Diffusivity::SquareYardPerSecond        },
-    {"ft^2/s",        Unit::Diffusivity::SquareFootPerSecond        },
-    {"ft2/s",         Unit::Diffusivity::SquareFootPerSecond        },
-    {"dm^2/s",        Unit::Diffusivity::SquareDecimetrePerSecond   },
-    {"dm2/s",         Unit::Diffusivity::SquareDecimetrePerSecond   },
-    {"in^2/s",        Unit::Diffusivity::SquareInchPerSecond        },
-    {"in2/s",         Unit::Diffusivity::SquareInchPerSecond        },
-    {"cm^2/s",        Unit::Diffusivity::SquareCentimetrePerSecond  },
-    {"cm2/s",         Unit::Diffusivity::SquareCentimetrePerSecond  },
-    {"mm^2/s",        Unit::Diffusivity::SquareMillimetrePerSecond  },
-    {"mm2/s",         Unit::Diffusivity::SquareMillimetrePerSecond  },
-    {"millinch^2/s",  Unit::Diffusivity::SquareMilliinchPerSecond   },
-    {"millinch2/s",   Unit::Diffusivity::SquareMilliinchPerSecond   },
-    {"milliinch^2/s", Unit::Diffusivity::SquareMilliinchPerSecond   },
-    {"milliinch2/s",  Unit::Diffusivity::SquareMilliinchPerSecond   },
-    {"mil^2/s",       Unit::Diffusivity::SquareMilliinchPerSecond   },
-    {"mil2/s",        Unit::Diffusivity::SquareMilliinchPerSecond   },
-    {"thou^2/s",      Unit::Diffusivity::SquareMilliinchPerSecond   },
-    {"thou2/s",       Unit::Diffusivity::SquareMilliinchPerSecond   },
-    {"μm^2/s",        Unit::Diffusivity::SquareMicrometrePerSecond  },
-    {"μm2/s",         Unit::Diffusivity::SquareMicrometrePerSecond  },
-    {"um^2/s",        Unit::Diffusivity::SquareMicrometrePerSecond  },
-    {"um2/s",         Unit::Diffusivity::SquareMicrometrePerSecond  },
-    {"μin^2/s",       Unit::Diffusivity::SquareMicroinchPerSecond   },
-    {"μin2/s",        Unit::Diffusivity::SquareMicroinchPerSecond   },
-    {"uin^2/s",       Unit::Diffusivity::SquareMicroinchPerSecond   },
-    {"uin2/s",        Unit::Diffusivity::SquareMicroinchPerSecond   },
-};
+inline constexpr std::array<std::pair<Unit::Diffusivity, std::string_view>, 15>
+    Abbreviations<Unit::Diffusivity>{{
+        {Unit::Diffusivity::SquareNauticalMilePerSecond, "nmi^2/s"},
+        {Unit::Diffusivity::SquareMilePerSecond,         "mi^2/s" },
+        {Unit::Diffusivity::SquareKilometrePerSecond,    "km^2/s" },
+        {Unit::Diffusivity::HectarePerSecond,            "ha/s"   },
+        {Unit::Diffusivity::AcrePerSecond,               "ac/s"   },
+        {Unit::Diffusivity::SquareMetrePerSecond,        "m^2/s"  },
+        {Unit::Diffusivity::SquareYardPerSecond,         "yd^2/s" },
+        {Unit::Diffusivity::SquareFootPerSecond,         "ft^2/s" },
+        {Unit::Diffusivity::SquareDecimetrePerSecond,    "dm^2/s" },
+        {Unit::Diffusivity::SquareInchPerSecond,         "in^2/s" },
+        {Unit::Diffusivity::SquareCentimetrePerSecond,   "cm^2/s" },
+        {Unit::Diffusivity::SquareMillimetrePerSecond,   "mm^2/s" },
+        {Unit::Diffusivity::SquareMilliinchPerSecond,    "mil^2/s"},
+        {Unit::Diffusivity::SquareMicrometrePerSecond,   "μm^2/s" },
+        {Unit::Diffusivity::SquareMicroinchPerSecond,    "μin^2/s"},
+}};
+
+template <>
+inline constexpr std::array<std::pair<std::string_view, Unit::Diffusivity>, 38>
+    Spellings<Unit::Diffusivity>{{
+        {"ac/s",          Unit::Diffusivity::AcrePerSecond              },
+        {"cm2/s",         Unit::Diffusivity::SquareCentimetrePerSecond  },
+        {"cm^2/s",        Unit::Diffusivity::SquareCentimetrePerSecond  },
+        {"dm2/s",         Unit::Diffusivity::SquareDecimetrePerSecond   },
+        {"dm^2/s",        Unit::Diffusivity::SquareDecimetrePerSecond   },
+        {"ft2/s",         Unit::Diffusivity::SquareFootPerSecond        },
+        {"ft^2/s",        Unit::Diffusivity::SquareFootPerSecond        },
+        {"ha/s",          Unit::Diffusivity::HectarePerSecond           },
+        {"in2/s",         Unit::Diffusivity::SquareInchPerSecond        },
+        {"in^2/s",        Unit::Diffusivity::SquareInchPerSecond        },
+        {"km2/s",         Unit::Diffusivity::SquareKilometrePerSecond   },
+        {"km^2/s",        Unit::Diffusivity::SquareKilometrePerSecond   },
+        {"m2/s",          Unit::Diffusivity::SquareMetrePerSecond       },
+        {"m^2/s",         Unit::Diffusivity::SquareMetrePerSecond       },
+        {"mi2/s",         Unit::Diffusivity::SquareMilePerSecond        },
+        {"mi^2/s",        Unit::Diffusivity::SquareMilePerSecond        },
+        {"mil2/s",        Unit::Diffusivity::SquareMilliinchPerSecond   },
+        {"mil^2/s",       Unit::Diffusivity::SquareMilliinchPerSecond   },
+        {"milliinch2/s",  Unit::Diffusivity::SquareMilliinchPerSecond   },
+        {"milliinch^2/s", Unit::Diffusivity::SquareMilliinchPerSecond   },
+        {"millinch2/s",   Unit::Diffusivity::SquareMilliinchPerSecond   },
+        {"millinch^2/s",  Unit::Diffusivity::SquareMilliinchPerSecond   },
+        {"mm2/s",         Unit::Diffusivity::SquareMillimetrePerSecond  },
+        {"mm^2/s",        Unit::Diffusivity::SquareMillimetrePerSecond  },
+        {"nmi2/s",        Unit::Diffusivity::SquareNauticalMilePerSecond},
+        {"nmi^2/s",       Unit::Diffusivity::SquareNauticalMilePerSecond},
+        {"thou2/s",       Unit::Diffusivity::SquareMilliinchPerSecond   },
+        {"thou^2/s",      Unit::Diffusivity::SquareMilliinchPerSecond   },
+        {"uin2/s",        Unit::Diffusivity::SquareMicroinchPerSecond   },
+        {"uin^2/s",       Unit::Diffusivity::SquareMicroinchPerSecond   },
+        {"um2/s",         Unit::Diffusivity::SquareMicrometrePerSecond  },
+        {"um^2/s",        Unit::Diffusivity::SquareMicrometrePerSecond  },
+        {"yd2/s",         Unit::Diffusivity::SquareYardPerSecond        },
+        {"yd^2/s",        Unit::Diffusivity::SquareYardPerSecond        },
+        {"μin2/s",        Unit::Diffusivity::SquareMicroinchPerSecond   },
+        {"μin^2/s",       Unit::Diffusivity::SquareMicroinchPerSecond   },
+        {"μm2/s",         Unit::Diffusivity::SquareMicrometrePerSecond  },
+        {"μm^2/s",        Unit::Diffusivity::SquareMicrometrePerSecond  },
+}};
 
 // clang-format on
 
@@ -436,106 +439,8 @@ Conversion<Unit::Diffusivity, Unit::Diffusivity::SquareMicroinchPerSecond>::ToSt
   value *= static_cast<NumericType>(0.0000000254L) * static_cast<NumericType>(0.0000000254L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::Diffusivity,
-                      std::function<void(NumericType* const, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Diffusivity, NumericType>{
-        {Unit::Diffusivity::SquareNauticalMilePerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareNauticalMilePerSecond>::FromStandard<NumericType>},
-        {Unit::Diffusivity::SquareMilePerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareMilePerSecond>::FromStandard<NumericType>        },
-        {Unit::Diffusivity::SquareKilometrePerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareKilometrePerSecond>::FromStandard<NumericType>   },
-        {Unit::Diffusivity::HectarePerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::HectarePerSecond>::FromStandard<NumericType>           },
-        {Unit::Diffusivity::AcrePerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::AcrePerSecond>::FromStandard<NumericType>              },
-        {Unit::Diffusivity::SquareMetrePerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareMetrePerSecond>::FromStandard<NumericType>       },
-        {Unit::Diffusivity::SquareYardPerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareYardPerSecond>::FromStandard<NumericType>        },
-        {Unit::Diffusivity::SquareFootPerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareFootPerSecond>::FromStandard<NumericType>        },
-        {Unit::Diffusivity::SquareDecimetrePerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareDecimetrePerSecond>::FromStandard<NumericType>   },
-        {Unit::Diffusivity::SquareInchPerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareInchPerSecond>::FromStandard<NumericType>        },
-        {Unit::Diffusivity::SquareCentimetrePerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareCentimetrePerSecond>::FromStandard<NumericType>  },
-        {Unit::Diffusivity::SquareMillimetrePerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareMillimetrePerSecond>::FromStandard<NumericType>  },
-        {Unit::Diffusivity::SquareMilliinchPerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareMilliinchPerSecond>::FromStandard<NumericType>   },
-        {Unit::Diffusivity::SquareMicrometrePerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareMicrometrePerSecond>::FromStandard<NumericType>  },
-        {Unit::Diffusivity::SquareMicroinchPerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareMicroinchPerSecond>::FromStandard<NumericType>   },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Diffusivity,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Diffusivity, NumericType>{
-        {Unit::Diffusivity::SquareNauticalMilePerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareNauticalMilePerSecond>::ToStandard<NumericType>                 },
-        {Unit::Diffusivity::SquareMilePerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareMilePerSecond>::ToStandard<NumericType>                         },
-        {Unit::Diffusivity::SquareKilometrePerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareKilometrePerSecond>::ToStandard<NumericType>                    },
-        {Unit::Diffusivity::HectarePerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::HectarePerSecond>::ToStandard<NumericType>                            },
-        {Unit::Diffusivity::AcrePerSecond,
-         Conversions<Unit::Diffusivity, Unit::Diffusivity::AcrePerSecond>::ToStandard<NumericType>},
-        {Unit::Diffusivity::SquareMetrePerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareMetrePerSecond>::ToStandard<NumericType>                        },
-        {Unit::Diffusivity::SquareYardPerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareYardPerSecond>::ToStandard<NumericType>                         },
-        {Unit::Diffusivity::SquareFootPerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareFootPerSecond>::ToStandard<NumericType>                         },
-        {Unit::Diffusivity::SquareDecimetrePerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareDecimetrePerSecond>::ToStandard<NumericType>                    },
-        {Unit::Diffusivity::SquareInchPerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareInchPerSecond>::ToStandard<NumericType>                         },
-        {Unit::Diffusivity::SquareCentimetrePerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareCentimetrePerSecond>::ToStandard<NumericType>                   },
-        {Unit::Diffusivity::SquareMillimetrePerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareMillimetrePerSecond>::ToStandard<NumericType>                   },
-        {Unit::Diffusivity::SquareMilliinchPerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareMilliinchPerSecond>::ToStandard<NumericType>                    },
-        {Unit::Diffusivity::SquareMicrometrePerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareMicrometrePerSecond>::ToStandard<NumericType>                   },
-        {Unit::Diffusivity::SquareMicroinchPerSecond,
-         Conversions<Unit::Diffusivity,
-         Unit::Diffusivity::SquareMicroinchPerSecond>::ToStandard<NumericType>                    },
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Diffusivity>{15};
 
 }  // namespace Internal
 
@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_DYNAMIC_VISCOSITY_HPP
 #define PHQ_UNIT_DYNAMIC_VISCOSITY_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -96,25 +95,26 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::DynamicViscosi
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::DynamicViscosity> ConsistentUnits<Unit::DynamicViscosity>{
-    {UnitSystem::MetreKilogramSecondKelvin,  Unit::DynamicViscosity::PascalSecond            },
-    {UnitSystem::MillimetreGramSecondKelvin, Unit::DynamicViscosity::PascalSecond            },
-    {UnitSystem::FootPoundSecondRankine,     Unit::DynamicViscosity::PoundSecondPerSquareFoot},
-    {UnitSystem::InchPoundSecondRankine,     Unit::DynamicViscosity::PoundSecondPerSquareInch},
-};
+inline constexpr std::array<std::pair<UnitSystem, Unit::DynamicViscosity>, 4>
+    ConsistentUnits<Unit::DynamicViscosity>{{
+        {UnitSystem::MetreKilogramSecondKelvin,  Unit::DynamicViscosity::PascalSecond            },
+        {UnitSystem::MillimetreGramSecondKelvin, Unit::DynamicViscosity::PascalSecond            },
+        {UnitSystem::FootPoundSecondRankine,     Unit::DynamicViscosity::PoundSecondPerSquareFoot},
+        {UnitSystem::InchPoundSecondRankine,     Unit::DynamicViscosity::PoundSecondPerSquareInch},
+}};
 
 template <>
-inline const std::map<Unit::DynamicViscosity, UnitSystem>
-    RelatedUnitSystems<Unit::DynamicViscosity>{
+inline constexpr std::array<std::pair<Unit::DynamicViscosity, UnitSystem>, 2>
+    RelatedUnitSystems<Unit::DynamicViscosity>{{
         {Unit::DynamicViscosity::PoundSecondPerSquareFoot, UnitSystem::FootPoundSecondRankine},
         {Unit::DynamicViscosity::PoundSecondPerSquareInch, UnitSystem::InchPoundSecondRankine},
-};
+}};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::DynamicViscosity, std::string_view>
-    Abbreviations<Unit::DynamicViscosity>{
+inline constexpr std::array<std::pair<Unit::DynamicViscosity, std::string_view>, 7>
+    Abbreviations<Unit::DynamicViscosity>{{
         {Unit::DynamicViscosity::PascalSecond,             "Pa·s"      },
         {Unit::DynamicViscosity::KilopascalSecond,         "kPa·s"     },
         {Unit::DynamicViscosity::MegapascalSecond,         "MPa·s"     },
@@ -122,68 +122,66 @@ inline const std::map<Unit::DynamicViscosity, std::string_view>
         {Unit::DynamicViscosity::Poise,                    "P"         },
         {Unit::DynamicViscosity::PoundSecondPerSquareFoot, "lbf·s/ft^2"},
         {Unit::DynamicViscosity::PoundSecondPerSquareInch, "lbf·s/in^2"},
-};
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::DynamicViscosity> Spellings<
-    Unit::DynamicViscosity>{
-    {"Pa·s",       Unit::DynamicViscosity::PascalSecond            },
-    {"Pa*s",       Unit::DynamicViscosity::PascalSecond            },
-    {"N·s/m^2",    Unit::DynamicViscosity::PascalSecond            },
-    {"N·s/m2",     Unit::DynamicViscosity::PascalSecond            },
-    {"N*s/m^2",    Unit::DynamicViscosity::PascalSecond            },
-    {"N*s/m2",     Unit::DynamicViscosity::PascalSecond            },
-    {"kg/(m·s)",   Unit::DynamicViscosity::PascalSecond            },
-    {"kg/(m*s)",   Unit::DynamicViscosity::PascalSecond            },
-    {"kg/m/s",     Unit::DynamicViscosity::PascalSecond            },
-    {"kPa·s",      Unit::DynamicViscosity::KilopascalSecond        },
-    {"kPa*s",      Unit::DynamicViscosity::KilopascalSecond        },
-    {"kN·s/m^2",   Unit::DynamicViscosity::KilopascalSecond        },
-    {"kN·s/m2",    Unit::DynamicViscosity::KilopascalSecond        },
-    {"kN*s/m^2",   Unit::DynamicViscosity::KilopascalSecond        },
-    {"kN*s/m2",    Unit::DynamicViscosity::KilopascalSecond        },
-    {"MPa·s",      Unit::DynamicViscosity::MegapascalSecond        },
-    {"MPa*s",      Unit::DynamicViscosity::MegapascalSecond        },
-    {"N·s/mm^2",   Unit::DynamicViscosity::MegapascalSecond        },
-    {"N·s/mm^2",   Unit::DynamicViscosity::MegapascalSecond        },
-    {"N*s/mm2",    Unit::DynamicViscosity::MegapascalSecond        },
-    {"N*s/mm2",    Unit::DynamicViscosity::MegapascalSecond        },
-    {"MN·s/m^2",   Unit::DynamicViscosity::MegapascalSecond        },
-    {"MN·s/m2",    Unit::DynamicViscosity::MegapascalSecond        },
-    {"MN*s/m^2",   Unit::DynamicViscosity::MegapascalSecond        },
-    {"MN*s/m2",    Unit::DynamicViscosity::MegapascalSecond        },
-    {"GPa·s",      Unit::DynamicViscosity::GigapascalSecond        },
-    {"GPa*s",      Unit::DynamicViscosity::GigapascalSecond        },
-    {"GN·s/m^2",   Unit::DynamicViscosity::GigapascalSecond        },
-    {"GN·s/m2",    Unit::DynamicViscosity::GigapascalSecond        },
-    {"GN*s/m^2",   Unit::DynamicViscosity::GigapascalSecond        },
-    {"GN*s/m2",    Unit::DynamicViscosity::GigapascalSecond        },
-    {"kN·s/mm^2",  Unit::DynamicViscosity::GigapascalSecond        },
-    {"kN·s/mm2",   Unit::DynamicViscosity::GigapascalSecond        },
-    {"kN*s/mm^2",  Unit::DynamicViscosity::GigapascalSecond        },
-    {"kN*s/mm2",   Unit::DynamicViscosity::GigapascalSecond        },
-    {"P",          Unit::DynamicViscosity::Poise                   },
-    {"lbf·s/ft^2", Unit::DynamicViscosity::PoundSecondPerSquareFoot},
-    {"lbf·s/ft2",  Unit::DynamicViscosity::PoundSecondPerSquareFoot},
-    {"lbf*s/ft^2", Unit::DynamicViscosity::PoundSecondPerSquareFoot},
-    {"lbf*s/ft2",  Unit::DynamicViscosity::PoundSecondPerSquareFoot},
-    {"lb·s/ft^2",  Unit::DynamicViscosity::PoundSecondPerSquareFoot},
-    {"lb·s/ft2",   Unit::DynamicViscosity::PoundSecondPerSquareFoot},
-    {"lb*s/ft^2",  Unit::DynamicViscosity::PoundSecondPerSquareFoot},
-    {"lb*s/ft2",   Unit::DynamicViscosity::PoundSecondPerSquareFoot},
-    {"psf·s",      Unit::DynamicViscosity::PoundSecondPerSquareFoot},
-    {"psf*s",      Unit::DynamicViscosity::PoundSecondPerSquareFoot},
-    {"lbf·s/in^2", Unit::DynamicViscosity::PoundSecondPerSquareInch},
-    {"lbf·s/in2",  Unit::DynamicViscosity::PoundSecondPerSquareInch},
-    {"lbf*s/in^2", Unit::DynamicViscosity::PoundSecondPerSquareInch},
-    {"lbf*s/in2",  Unit::DynamicViscosity::PoundSecondPerSquareInch},
-    {"lb·s/in^2",  Unit::DynamicViscosity::PoundSecondPerSquareInch},
-    {"lb·s/in2",   Unit::DynamicViscosity::PoundSecondPerSquareInch},
-    {"lb*s/in^2",  Unit::DynamicViscosity::PoundSecondPerSquareInch},
-    {"lb*s/in2",   Unit::DynamicViscosity::PoundSecondPerSquareInch},
-    {"psi·s",      Unit::DynamicViscosity::PoundSecondPerSquareInch},
-    {"psi*s",      Unit::DynamicViscosity::PoundSecondPerSquareInch},
-};
+inline constexpr std::array<std::pair<std::string_view, Unit::DynamicViscosity>, 54>
+    Spellings<Unit::DynamicViscosity>{{
+        {"GN*s/m2",    Unit::DynamicViscosity::GigapascalSecond        },
+        {"GN*s/m^2",   Unit::DynamicViscosity::GigapascalSecond        },
+        {"GN·s/m2",    Unit::DynamicViscosity::GigapascalSecond        },
+        {"GN·s/m^2",   Unit::DynamicViscosity::GigapascalSecond        },
+        {"GPa*s",      Unit::DynamicViscosity::GigapascalSecond        },
+        {"GPa·s",      Unit::DynamicViscosity::GigapascalSecond        },
+        {"MN*s/m2",    Unit::DynamicViscosity::MegapascalSecond        },
+        {"MN*s/m^2",   Unit::DynamicViscosity::MegapascalSecond        },
+        {"MN·s/m2",    Unit::DynamicViscosity::MegapascalSecond        },
+        {"MN·s/m^2",   Unit::DynamicViscosity::MegapascalSecond        },
+        {"MPa*s",      Unit::DynamicViscosity::MegapascalSecond        },
+        {"MPa·s",      Unit::DynamicViscosity::MegapascalSecond        },
+        {"N*s/m2",     Unit::DynamicViscosity::PascalSecond            },
+        {"N*s/m^2",    Unit::DynamicViscosity::PascalSecond            },
+        {"N*s/mm2",    Unit::DynamicViscosity::MegapascalSecond        },
+        {"N·s/m2",     Unit::DynamicViscosity::PascalSecond            },
+        {"N·s/m^2",    Unit::DynamicViscosity::PascalSecond            },
+        {"N·s/mm^2",   Unit::DynamicViscosity::MegapascalSecond        },
+        {"P",          Unit::DynamicViscosity::Poise                   },
+        {"Pa*s",       Unit::DynamicViscosity::PascalSecond            },
+        {"Pa·s",       Unit::DynamicViscosity::PascalSecond            },
+        {"kN*s/m2",    Unit::DynamicViscosity::KilopascalSecond        },
+        {"kN*s/m^2",   Unit::DynamicViscosity::KilopascalSecond        },
+        {"kN*s/mm2",   Unit::DynamicViscosity::GigapascalSecond        },
+        {"kN*s/mm^2",  Unit::DynamicViscosity::GigapascalSecond        },
+        {"kN·s/m2",    Unit::DynamicViscosity::KilopascalSecond        },
+        {"kN·s/m^2",   Unit::DynamicViscosity::KilopascalSecond        },
+        {"kN·s/mm2",   Unit::DynamicViscosity::GigapascalSecond        },
+        {"kN·s/mm^2",  Unit::DynamicViscosity::GigapascalSecond        },
+        {"kPa*s",      Unit::DynamicViscosity::KilopascalSecond        },
+        {"kPa·s",      Unit::DynamicViscosity::KilopascalSecond        },
+        {"kg/(m*s)",   Unit::DynamicViscosity::PascalSecond            },
+        {"kg/(m·s)",   Unit::DynamicViscosity::PascalSecond            },
+        {"kg/m/s",     Unit::DynamicViscosity::PascalSecond            },
+        {"lb*s/ft2",   Unit::DynamicViscosity::PoundSecondPerSquareFoot},
+        {"lb*s/ft^2",  Unit::DynamicViscosity::PoundSecondPerSquareFoot},
+        {"lb*s/in2",   Unit::DynamicViscosity::PoundSecondPerSquareInch},
+        {"lb*s/in^2",  Unit::DynamicViscosity::PoundSecondPerSquareInch},
+        {"lbf*s/ft2",  Unit::DynamicViscosity::PoundSecondPerSquareFoot},
+        {"lbf*s/ft^2", Unit::DynamicViscosity::PoundSecondPerSquareFoot},
+        {"lbf*s/in2",  Unit::DynamicViscosity::PoundSecondPerSquareInch},
+        {"lbf*s/in^2", Unit::DynamicViscosity::PoundSecondPerSquareInch},
+        {"lbf·s/ft2",  Unit::DynamicViscosity::PoundSecondPerSquareFoot},
+        {"lbf·s/ft^2", Unit::DynamicViscosity::PoundSecondPerSquareFoot},
+        {"lbf·s/in2",  Unit::DynamicViscosity::PoundSecondPerSquareInch},
+        {"lbf·s/in^2", Unit::DynamicViscosity::PoundSecondPerSquareInch},
+        {"lb·s/ft2",   Unit::DynamicViscosity::PoundSecondPerSquareFoot},
+        {"lb·s/ft^2",  Unit::DynamicViscosity::PoundSecondPerSquareFoot},
+        {"lb·s/in2",   Unit::DynamicViscosity::PoundSecondPerSquareInch},
+        {"lb·s/in^2",  Unit::DynamicViscosity::PoundSecondPerSquareInch},
+        {"psf*s",      Unit::DynamicViscosity::PoundSecondPerSquareFoot},
+        {"psf·s",      Unit::DynamicViscosity::PoundSecondPerSquareFoot},
+        {"psi*s",      Unit::DynamicViscosity::PoundSecondPerSquareInch},
+        {"psi·s",      Unit::DynamicViscosity::PoundSecondPerSquareInch},
+}};
 
 // clang-format on
 
@@ -298,59 +296,8 @@ Conversion<Unit::DynamicViscosity, Unit::DynamicViscosity::PoundSecondPerSquareI
            / (static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L));
 }
 
-template <typename NumericType>
-inline const std::map<Unit::DynamicViscosity,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::DynamicViscosity, NumericType>{
-        {Unit::DynamicViscosity::PascalSecond,
-         Conversions<Unit::DynamicViscosity,
-         Unit::DynamicViscosity::PascalSecond>::FromStandard<NumericType>            },
-        {Unit::DynamicViscosity::KilopascalSecond,
-         Conversions<Unit::DynamicViscosity,
-         Unit::DynamicViscosity::KilopascalSecond>::FromStandard<NumericType>        },
-        {Unit::DynamicViscosity::MegapascalSecond,
-         Conversions<Unit::DynamicViscosity,
-         Unit::DynamicViscosity::MegapascalSecond>::FromStandard<NumericType>        },
-        {Unit::DynamicViscosity::GigapascalSecond,
-         Conversions<Unit::DynamicViscosity,
-         Unit::DynamicViscosity::GigapascalSecond>::FromStandard<NumericType>        },
-        {Unit::DynamicViscosity::Poise,
-         Conversions<Unit::DynamicViscosity,
-         Unit::DynamicViscosity::Poise>::FromStandard<NumericType>                   },
-        {Unit::DynamicViscosity::PoundSecondPerSquareFoot,
-         Conversions<Unit::DynamicViscosity,
-         Unit::DynamicViscosity::PoundSecondPerSquareFoot>::FromStandard<NumericType>},
-        {Unit::DynamicViscosity::PoundSecondPerSquareInch,
-         Conversions<Unit::DynamicViscosity,
-         Unit::DynamicViscosity::PoundSecondPerSquareInch>::FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::DynamicViscosity,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::DynamicViscosity, NumericType>{
-        {Unit::DynamicViscosity::PascalSecond,
-         Conversions<Unit::DynamicViscosity,
-         Unit::DynamicViscosity::PascalSecond>::ToStandard<NumericType>            },
-        {Unit::DynamicViscosity::KilopascalSecond,
-         Conversions<Unit::DynamicViscosity,
-         Unit::DynamicViscosity::KilopascalSecond>::ToStandard<NumericType>        },
-        {Unit::DynamicViscosity::MegapascalSecond,
-         Conversions<Unit::DynamicViscosity,
-         Unit::DynamicViscosity::MegapascalSecond>::ToStandard<NumericType>        },
-        {Unit::DynamicViscosity::GigapascalSecond,
-         Conversions<Unit::DynamicViscosity,
-         Unit::DynamicViscosity::GigapascalSecond>::ToStandard<NumericType>        },
-        {Unit::DynamicViscosity::Poise,
-         Conversions<Unit::DynamicViscosity,
-         Unit::DynamicViscosity::Poise>::ToStandard<NumericType>                   },
-        {Unit::DynamicViscosity::PoundSecondPerSquareFoot,
-         Conversions<Unit::DynamicViscosity,
-         Unit::DynamicViscosity::PoundSecondPerSquareFoot>::ToStandard<NumericType>},
-        {Unit::DynamicViscosity::PoundSecondPerSquareInch,
-         Conversions<Unit::DynamicViscosity,
-         Unit::DynamicViscosity::PoundSecondPerSquareInch>::ToStandard<NumericType>},
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::DynamicViscosity>{7};
 
 }  // namespace Internal
 
@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_ELECTRIC_CHARGE_HPP
 #define PHQ_UNIT_ELECTRIC_CHARGE_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -150,97 +149,100 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::ElectricCharge
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::ElectricCharge> ConsistentUnits<Unit::ElectricCharge>{
-    {UnitSystem::MetreKilogramSecondKelvin,  Unit::ElectricCharge::Coulomb},
-    {UnitSystem::MillimetreGramSecondKelvin, Unit::ElectricCharge::Coulomb},
-    {UnitSystem::FootPoundSecondRankine,     Unit::ElectricCharge::Coulomb},
-    {UnitSystem::InchPoundSecondRankine,     Unit::ElectricCharge::Coulomb},
-};
+inline constexpr std::array<std::pair<UnitSystem, Unit::ElectricCharge>, 4>
+    ConsistentUnits<Unit::ElectricCharge>{{
+        {UnitSystem::MetreKilogramSecondKelvin,  Unit::ElectricCharge::Coulomb},
+        {UnitSystem::MillimetreGramSecondKelvin, Unit::ElectricCharge::Coulomb},
+        {UnitSystem::FootPoundSecondRankine,     Unit::ElectricCharge::Coulomb},
+        {UnitSystem::InchPoundSecondRankine,     Unit::ElectricCharge::Coulomb},
+}};
 
 template <>
-inline const std::map<Unit::ElectricCharge, UnitSystem> RelatedUnitSystems<Unit::ElectricCharge>{};
+inline constexpr std::array<std::pair<Unit::ElectricCharge, UnitSystem>, 0>
+    RelatedUnitSystems<Unit::ElectricCharge>{};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::ElectricCharge, std::string_view> Abbreviations<Unit::ElectricCharge>{
-    {Unit::ElectricCharge::Coulomb,           "C"     },
-    {Unit::ElectricCharge::Kilocoulomb,       "kC"    },
-    {Unit::ElectricCharge::Megacoulomb,       "MC"    },
-    {Unit::ElectricCharge::Gigacoulomb,       "GC"    },
-    {Unit::ElectricCharge::Teracoulomb,       "TC"    },
-    {Unit::ElectricCharge::Millicoulomb,      "mC"    },
-    {Unit::ElectricCharge::Microcoulomb,      "μC"    },
-    {Unit::ElectricCharge::Nanocoulomb,       "nC"    },
-    {Unit::ElectricCharge::ElementaryCharge,  "e"     },
-    {Unit::ElectricCharge::AmpereMinute,      "A·min" },
-    {Unit::ElectricCharge::AmpereHour,        "A·hr"  },
-    {Unit::ElectricCharge::KiloampereMinute,  "kA·min"},
-    {Unit::ElectricCharge::KiloampereHour,    "kA·hr" },
-    {Unit::ElectricCharge::MegaampereMinute,  "MA·min"},
-    {Unit::ElectricCharge::MegaampereHour,    "MA·hr" },
-    {Unit::ElectricCharge::GigaampereMinute,  "GA·min"},
-    {Unit::ElectricCharge::GigaampereHour,    "GA·hr" },
-    {Unit::ElectricCharge::TeraampereMinute,  "TA·min"},
-    {Unit::ElectricCharge::TeraampereHour,    "TA·hr" },
-    {Unit::ElectricCharge::MilliampereMinute, "mA·min"},
-    {Unit::ElectricCharge::MilliampereHour,   "mA·hr" },
-    {Unit::ElectricCharge::MicroampereMinute, "μA·min"},
-    {Unit::ElectricCharge::MicroampereHour,   "μA·hr" },
-    {Unit::ElectricCharge::NanoampereMinute,  "nA·min"},
-    {Unit::ElectricCharge::NanoampereHour,    "nA·hr" },
-};
-
-template <>
-inline const std::unordered_map<std::string_view, Unit::ElectricCharge> Spellings<
-    Unit::ElectricCharge>{
-    {"C",      Unit::ElectricCharge::Coulomb          },
-    {"kC",     Unit::ElectricCharge::Kilocoulomb      },
-    {"MC",     Unit::ElectricCharge::Megacoulomb      },
-    {"GC",     Unit::ElectricCharge::Gigacoulomb      },
-    {"TC",     Unit::ElectricCharge::Teracoulomb      },
-    {"mC",     Unit::ElectricCharge::Millicoulomb     },
-    {"μC",     Unit::ElectricCharge::Microcoulomb     },
-    {"uC",     Unit::ElectricCharge::Microcoulomb     },
-    {"nC",     Unit::ElectricCharge::Nanocoulomb      },
-    {"e",      Unit::ElectricCharge::ElementaryCharge },
-    {"A·min",  Unit::ElectricCharge::AmpereMinute     },
-    {"A*min",  Unit::ElectricCharge::AmpereMinute     },
-    {"A·hr",   Unit::ElectricCharge::AmpereHour       },
-    {"A*hr",   Unit::ElectricCharge::AmpereHour       },
-    {"kA·min", Unit::ElectricCharge::KiloampereMinute },
-    {"kA*min", Unit::ElectricCharge::KiloampereMinute },
-    {"kA·hr",  Unit::ElectricCharge::KiloampereHour   },
-    {"kA*hr",  Unit::ElectricCharge::KiloampereHour   },
-    {"MA·min", Unit::ElectricCharge::MegaampereMinute },
-    {"MA*min", Unit::ElectricCharge::MegaampereMinute },
-    {"MA·hr",  Unit::ElectricCharge::MegaampereHour   },
-    {"MA*hr",  Unit::ElectricCharge::MegaampereHour   },
-    {"GA·min", Unit::ElectricCharge::GigaampereMinute },
-    {"GA*min", Unit::ElectricCharge::GigaampereMinute },
-    {"GA·hr",  Unit::ElectricCharge::GigaampereHour   },
-    {"GA*hr",  Unit::ElectricCharge::GigaampereHour   },
-    {"TA·min", Unit::ElectricCharge::TeraampereMinute },
-    {"TA*min", Unit::ElectricCharge::TeraampereMinute },
-    {"TA·hr",  Unit::ElectricCharge::TeraampereHour   },
-    {"TA*hr",  Unit::ElectricCharge::TeraampereHour   },
-    {"mA·min", Unit::ElectricCharge::MilliampereMinute},
-    {"mA*min", Unit::ElectricCharge::MilliampereMinute},
-    {"mA·hr",  Unit::ElectricCharge::MilliampereHour  },
-    {"mA*hr",  Unit::ElectricCharge::MilliampereHour  },
-    {"μA·min", Unit::ElectricCharge::MicroampereMinute},
-    {"μA*min", Unit::ElectricCharge::MicroampereMinute},
-    {"uA·min", Unit::ElectricCharge::MicroampereMinute},
-    {"uA*min", Unit::ElectricCharge::MicroampereMinute},
-    {"μA·hr",  Unit::ElectricCharge::MicroampereHour  },
-    {"μA*hr",  Unit::ElectricCharge::MicroampereHour  },
-    {"uA·hr",  Unit::ElectricCharge::MicroampereHour  },
-    {"uA*hr",  Unit::ElectricCharge::MicroampereHour  },
-    {"nA·min", Unit::ElectricCharge::NanoampereMinute },
-    {"nA*min", Unit::ElectricCharge::NanoampereMinute },
-    {"nA·hr",  Unit::ElectricCharge::NanoampereHour   },
-    {"nA*hr",  Unit::ElectricCharge::NanoampereHour   },
-};
+inline constexpr std::array<std::pair<Unit::ElectricCharge, std::string_view>, 25>
+    Abbreviations<Unit::ElectricCharge>{{
+        {Unit::ElectricCharge::Coulomb,           "C"     },
+        {Unit::ElectricCharge::Kilocoulomb,       "kC"    },
+        {Unit::ElectricCharge::Megacoulomb,       "MC"    },
+        {Unit::ElectricCharge::Gigacoulomb,       "GC"    },
+        {Unit::ElectricCharge::Teracoulomb,       "TC"    },
+        {Unit::ElectricCharge::Millicoulomb,      "mC"    },
+        {Unit::ElectricCharge::Microcoulomb,      "μC"    },
+        {Unit::ElectricCharge::Nanocoulomb,       "nC"    },
+        {Unit::ElectricCharge::ElementaryCharge,  "e"     },
+        {Unit::ElectricCharge::AmpereMinute,      "A·min" },
+        {Unit::ElectricCharge::AmpereHour,        "A·hr"  },
+        {Unit::ElectricCharge::KiloampereMinute,  "kA·min"},
+        {Unit::ElectricCharge::KiloampereHour,    "kA·hr" },
+        {Unit::ElectricCharge::MegaampereMinute,  "MA·min"},
+        {Unit::ElectricCharge::MegaampereHour,    "MA·hr" },
+        {Unit::ElectricCharge::GigaampereMinute,  "GA·min"},
+        {Unit::ElectricCharge::GigaampereHour,    "GA·hr" },
+        {Unit::ElectricCharge::TeraampereMinute,  "TA·min"},
+        {Unit::ElectricCharge::TeraampereHour,    "TA·hr" },
+        {Unit::ElectricCharge::MilliampereMinute, "mA·min"},
+        {Unit::ElectricCharge::MilliampereHour,   "mA·hr" },
+        {Unit::ElectricCharge::MicroampereMinute, "μA·min"},
+        {Unit::ElectricCharge::MicroampereHour,   "μA·hr" },
+        {Unit::ElectricCharge::NanoampereMinute,  "nA·min"},
+        {Unit::ElectricCharge::NanoampereHour,    "nA·hr" },
+}};
+
+template <>
+inline constexpr std::array<std::pair<std::string_view, Unit::ElectricCharge>, 46>
+    Spellings<Unit::ElectricCharge>{{
+        {"A*hr",   Unit::ElectricCharge::AmpereHour       },
+        {"A*min",  Unit::ElectricCharge::AmpereMinute     },
+        {"A·hr",   Unit::ElectricCharge::AmpereHour       },
+        {"A·min",  Unit::ElectricCharge::AmpereMinute     },
+        {"C",      Unit::ElectricCharge::Coulomb          },
+        {"GA*hr",  Unit::ElectricCharge::GigaampereHour   },
+        {"GA*min", Unit::ElectricCharge::GigaampereMinute },
+        {"GA·hr",  Unit::ElectricCharge::GigaampereHour   },
+        {"GA·min", Unit::ElectricCharge::GigaampereMinute },
+        {"GC",     Unit::ElectricCharge::Gigacoulomb      },
+        {"MA*hr",  Unit::ElectricCharge::MegaampereHour   },
+        {"MA*min", Unit::ElectricCharge::MegaampereMinute },
+        {"MA·hr",  Unit::ElectricCharge::MegaampereHour   },
+        {"MA·min", Unit::ElectricCharge::MegaampereMinute },
+        {"MC",     Unit::ElectricCharge::Megacoulomb      },
+        {"TA*hr",  Unit::ElectricCharge::TeraampereHour   },
+        {"TA*min", Unit::ElectricCharge::TeraampereMinute },
+        {"TA·hr",  Unit::ElectricCharge::TeraampereHour   },
+        {"TA·min", Unit::ElectricCharge::TeraampereMinute },
+        {"TC",     Unit::ElectricCharge::Teracoulomb      },
+        {"e",      Unit::ElectricCharge::ElementaryCharge },
+        {"kA*hr",  Unit::ElectricCharge::KiloampereHour   },
+        {"kA*min", Unit::ElectricCharge::KiloampereMinute },
+        {"kA·hr",  Unit::ElectricCharge::KiloampereHour   },
+        {"kA·min", Unit::ElectricCharge::KiloampereMinute },
+        {"kC",     Unit::ElectricCharge::Kilocoulomb      },
+        {"mA*hr",  Unit::ElectricCharge::MilliampereHour  },
+        {"mA*min", Unit::ElectricCharge::MilliampereMinute},
+        {"mA·hr",  Unit::ElectricCharge::MilliampereHour  },
+        {"mA·min", Unit::ElectricCharge::MilliampereMinute},
+        {"mC",     Unit::ElectricCharge::Millicoulomb     },
+        {"nA*hr",  Unit::ElectricCharge::NanoampereHour   },
+        {"nA*min", Unit::ElectricCharge::NanoampereMinute },
+        {"nA·hr",  Unit::ElectricCharge::NanoampereHour   },
+        {"nA·min", Unit::ElectricCharge::NanoampereMinute },
+        {"nC",     Unit::ElectricCharge::Nanocoulomb      },
+        {"uA*hr",  Unit::ElectricCharge::MicroampereHour  },
+        {"uA*min", Unit::ElectricCharge::MicroampereMinute},
+        {"uA·hr",  Unit::ElectricCharge::MicroampereHour  },
+        {"uA·min", Unit::ElectricCharge::MicroampereMinute},
+        {"uC",     Unit::ElectricCharge::Microcoulomb     },
+        {"μA*hr",  Unit::ElectricCharge::MicroampereHour  },
+        {"μA*min", Unit::ElectricCharge::MicroampereMinute},
+        {"μA·hr",  Unit::ElectricCharge::MicroampereHour  },
+        {"μA·min", Unit::ElectricCharge::MicroampereMinute},
+        {"μC",     Unit::ElectricCharge::Microcoulomb     },
+}};
 
 // clang-format on
 
@@ -638,166 +640,8 @@ Conversion<Unit::ElectricCharge, Unit::ElectricCharge::NanoampereHour>::ToStanda
   value *= static_cast<NumericType>(3.6E-6L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::ElectricCharge,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::ElectricCharge, NumericType>{
-        {Unit::ElectricCharge::Coulomb,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::Coulomb>::FromStandard<NumericType>          },
-        {Unit::ElectricCharge::Kilocoulomb,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::Kilocoulomb>::FromStandard<NumericType>      },
-        {Unit::ElectricCharge::Megacoulomb,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::Megacoulomb>::FromStandard<NumericType>      },
-        {Unit::ElectricCharge::Gigacoulomb,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::Gigacoulomb>::FromStandard<NumericType>      },
-        {Unit::ElectricCharge::Teracoulomb,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::Teracoulomb>::FromStandard<NumericType>      },
-        {Unit::ElectricCharge::Millicoulomb,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::Millicoulomb>::FromStandard<NumericType>     },
-        {Unit::ElectricCharge::Microcoulomb,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::Microcoulomb>::FromStandard<NumericType>     },
-        {Unit::ElectricCharge::Nanocoulomb,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::Nanocoulomb>::FromStandard<NumericType>      },
-        {Unit::ElectricCharge::ElementaryCharge,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::ElementaryCharge>::FromStandard<NumericType> },
-        {Unit::ElectricCharge::AmpereMinute,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::AmpereMinute>::FromStandard<NumericType>     },
-        {Unit::ElectricCharge::AmpereHour,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::AmpereHour>::FromStandard<NumericType>       },
-        {Unit::ElectricCharge::KiloampereMinute,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::KiloampereMinute>::FromStandard<NumericType> },
-        {Unit::ElectricCharge::KiloampereHour,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::KiloampereHour>::FromStandard<NumericType>   },
-        {Unit::ElectricCharge::MegaampereMinute,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::MegaampereMinute>::FromStandard<NumericType> },
-        {Unit::ElectricCharge::MegaampereHour,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::MegaampereHour>::FromStandard<NumericType>   },
-        {Unit::ElectricCharge::GigaampereMinute,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::GigaampereMinute>::FromStandard<NumericType> },
-        {Unit::ElectricCharge::GigaampereHour,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::GigaampereHour>::FromStandard<NumericType>   },
-        {Unit::ElectricCharge::TeraampereMinute,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::TeraampereMinute>::FromStandard<NumericType> },
-        {Unit::ElectricCharge::TeraampereHour,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::TeraampereHour>::FromStandard<NumericType>   },
-        {Unit::ElectricCharge::MilliampereMinute,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::MilliampereMinute>::FromStandard<NumericType>},
-        {Unit::ElectricCharge::MilliampereHour,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::MilliampereHour>::FromStandard<NumericType>  },
-        {Unit::ElectricCharge::MicroampereMinute,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::MicroampereMinute>::FromStandard<NumericType>},
-        {Unit::ElectricCharge::MicroampereHour,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::MicroampereHour>::FromStandard<NumericType>  },
-        {Unit::ElectricCharge::NanoampereMinute,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::NanoampereMinute>::FromStandard<NumericType> },
-        {Unit::ElectricCharge::NanoampereHour,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::NanoampereHour>::FromStandard<NumericType>   },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::ElectricCharge,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::ElectricCharge, NumericType>{
-        {Unit::ElectricCharge::Coulomb,
-         Conversions<Unit::ElectricCharge, Unit::ElectricCharge::Coulomb>::ToStandard<NumericType>},
-        {Unit::ElectricCharge::Kilocoulomb,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::Kilocoulomb>::ToStandard<NumericType>                              },
-        {Unit::ElectricCharge::Megacoulomb,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::Megacoulomb>::ToStandard<NumericType>                              },
-        {Unit::ElectricCharge::Gigacoulomb,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::Gigacoulomb>::ToStandard<NumericType>                              },
-        {Unit::ElectricCharge::Teracoulomb,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::Teracoulomb>::ToStandard<NumericType>                              },
-        {Unit::ElectricCharge::Millicoulomb,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::Millicoulomb>::ToStandard<NumericType>                             },
-        {Unit::ElectricCharge::Microcoulomb,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::Microcoulomb>::ToStandard<NumericType>                             },
-        {Unit::ElectricCharge::Nanocoulomb,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::Nanocoulomb>::ToStandard<NumericType>                              },
-        {Unit::ElectricCharge::ElementaryCharge,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::ElementaryCharge>::ToStandard<NumericType>                         },
-        {Unit::ElectricCharge::AmpereMinute,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::AmpereMinute>::ToStandard<NumericType>                             },
-        {Unit::ElectricCharge::AmpereHour,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::AmpereHour>::ToStandard<NumericType>                               },
-        {Unit::ElectricCharge::KiloampereMinute,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::KiloampereMinute>::ToStandard<NumericType>                         },
-        {Unit::ElectricCharge::KiloampereHour,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::KiloampereHour>::ToStandard<NumericType>                           },
-        {Unit::ElectricCharge::MegaampereMinute,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::MegaampereMinute>::ToStandard<NumericType>                         },
-        {Unit::ElectricCharge::MegaampereHour,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::MegaampereHour>::ToStandard<NumericType>                           },
-        {Unit::ElectricCharge::GigaampereMinute,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::GigaampereMinute>::ToStandard<NumericType>                         },
-        {Unit::ElectricCharge::GigaampereHour,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::GigaampereHour>::ToStandard<NumericType>                           },
-        {Unit::ElectricCharge::TeraampereMinute,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::TeraampereMinute>::ToStandard<NumericType>                         },
-        {Unit::ElectricCharge::TeraampereHour,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::TeraampereHour>::ToStandard<NumericType>                           },
-        {Unit::ElectricCharge::MilliampereMinute,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::MilliampereMinute>::ToStandard<NumericType>                        },
-        {Unit::ElectricCharge::MilliampereHour,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::MilliampereHour>::ToStandard<NumericType>                          },
-        {Unit::ElectricCharge::MicroampereMinute,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::MicroampereMinute>::ToStandard<NumericType>                        },
-        {Unit::ElectricCharge::MicroampereHour,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::MicroampereHour>::ToStandard<NumericType>                          },
-        {Unit::ElectricCharge::NanoampereMinute,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::NanoampereMinute>::ToStandard<NumericType>                         },
-        {Unit::ElectricCharge::NanoampereHour,
-         Conversions<Unit::ElectricCharge,
-         Unit::ElectricCharge::NanoampereHour>::ToStandard<NumericType>                           },
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::ElectricCharge>{25};
 
 }  // namespace Internal
 
@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_ELECTRIC_CURRENT_HPP
 #define PHQ_UNIT_ELECTRIC_CURRENT_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -108,50 +107,52 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::ElectricCurren
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::ElectricCurrent> ConsistentUnits<Unit::ElectricCurrent>{
-    {UnitSystem::MetreKilogramSecondKelvin,  Unit::ElectricCurrent::Ampere},
-    {UnitSystem::MillimetreGramSecondKelvin, Unit::ElectricCurrent::Ampere},
-    {UnitSystem::FootPoundSecondRankine,     Unit::ElectricCurrent::Ampere},
-    {UnitSystem::InchPoundSecondRankine,     Unit::ElectricCurrent::Ampere},
-};
+inline constexpr std::array<std::pair<UnitSystem, Unit::ElectricCurrent>, 4>
+    ConsistentUnits<Unit::ElectricCurrent>{{
+        {UnitSystem::MetreKilogramSecondKelvin,  Unit::ElectricCurrent::Ampere},
+        {UnitSystem::MillimetreGramSecondKelvin, Unit::ElectricCurrent::Ampere},
+        {UnitSystem::FootPoundSecondRankine,     Unit::ElectricCurrent::Ampere},
+        {UnitSystem::InchPoundSecondRankine,     Unit::ElectricCurrent::Ampere},
+}};
 
 template <>
-inline const std::map<Unit::ElectricCurrent, UnitSystem>
+inline constexpr std::array<std::pair<Unit::ElectricCurrent, UnitSystem>, 0>
     RelatedUnitSystems<Unit::ElectricCurrent>{};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::ElectricCurrent, std::string_view> Abbreviations<Unit::ElectricCurrent>{
-    {Unit::ElectricCurrent::Ampere,                    "A"    },
-    {Unit::ElectricCurrent::Kiloampere,                "kA"   },
-    {Unit::ElectricCurrent::Megaampere,                "MA"   },
-    {Unit::ElectricCurrent::Gigaampere,                "GA"   },
-    {Unit::ElectricCurrent::Teraampere,                "TA"   },
-    {Unit::ElectricCurrent::Milliampere,               "mA"   },
-    {Unit::ElectricCurrent::Microampere,               "μA"   },
-    {Unit::ElectricCurrent::Nanoampere,                "nA"   },
-    {Unit::ElectricCurrent::ElementaryChargePerSecond, "e/s"  },
-    {Unit::ElectricCurrent::ElementaryChargePerMinute, "e/min"},
-    {Unit::ElectricCurrent::ElementaryChargePerHour,   "e/hr" },
-};
+inline constexpr std::array<std::pair<Unit::ElectricCurrent, std::string_view>, 11>
+    Abbreviations<Unit::ElectricCurrent>{{
+        {Unit::ElectricCurrent::Ampere,                    "A"    },
+        {Unit::ElectricCurrent::Kiloampere,                "kA"   },
+        {Unit::ElectricCurrent::Megaampere,                "MA"   },
+        {Unit::ElectricCurrent::Gigaampere,                "GA"   },
+        {Unit::ElectricCurrent::Teraampere,                "TA"   },
+        {Unit::ElectricCurrent::Milliampere,               "mA"   },
+        {Unit::ElectricCurrent::Microampere,               "μA"   },
+        {Unit::ElectricCurrent::Nanoampere,                "nA"   },
+        {Unit::ElectricCurrent::ElementaryChargePerSecond, "e/s"  },
+        {Unit::ElectricCurrent::ElementaryChargePerMinute, "e/min"},
+        {Unit::ElectricCurrent::ElementaryChargePerHour,   "e/hr" },
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::ElectricCurrent>
-    Spellings<Unit::ElectricCurrent>{
+inline constexpr std::array<std::pair<std::string_view, Unit::ElectricCurrent>, 12>
+    Spellings<Unit::ElectricCurrent>{{
         {"A",     Unit::ElectricCurrent::Ampere                   },
-        {"kA",    Unit::ElectricCurrent::Kiloampere               },
-        {"MA",    Unit::ElectricCurrent::Megaampere               },
         {"GA",    Unit::ElectricCurrent::Gigaampere               },
+        {"MA",    Unit::ElectricCurrent::Megaampere               },
         {"TA",    Unit::ElectricCurrent::Teraampere               },
+        {"e/hr",  Unit::ElectricCurrent::ElementaryChargePerHour  },
+        {"e/min", Unit::ElectricCurrent::ElementaryChargePerMinute},
+        {"e/s",   Unit::ElectricCurrent::ElementaryChargePerSecond},
+        {"kA",    Unit::ElectricCurrent::Kiloampere               },
         {"mA",    Unit::ElectricCurrent::Milliampere              },
-        {"μA",    Unit::ElectricCurrent::Microampere              },
-        {"uA",    Unit::ElectricCurrent::Microampere              },
         {"nA",    Unit::ElectricCurrent::Nanoampere               },
-        {"e/s",   Unit::ElectricCurrent::ElementaryChargePerSecond},
-        {"e/min", Unit::ElectricCurrent::ElementaryChargePerMinute},
-        {"e/hr",  Unit::ElectricCurrent::ElementaryChargePerHour  },
-};
+        {"uA",    Unit::ElectricCurrent::Microampere              },
+        {"μA",    Unit::ElectricCurrent::Microampere              },
+}};
 
 // clang-format on
 
@@ -326,83 +327,8 @@ Conversion<Unit::ElectricCurrent, Unit::ElectricCurrent::ElementaryChargePerHour
   value *= static_cast<NumericType>(1.602176634E-19L) / static_cast<NumericType>(3600.0L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::ElectricCurrent,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::ElectricCurrent, NumericType>{
-        {Unit::ElectricCurrent::Ampere,
-         Conversions<Unit::ElectricCurrent,
-         Unit::ElectricCurrent::Ampere>::FromStandard<NumericType>                   },
-        {Unit::ElectricCurrent::Kiloampere,
-         Conversions<Unit::ElectricCurrent,
-         Unit::ElectricCurrent::Kiloampere>::FromStandard<NumericType>               },
-        {Unit::ElectricCurrent::Megaampere,
-         Conversions<Unit::ElectricCurrent,
-         Unit::ElectricCurrent::Megaampere>::FromStandard<NumericType>               },
-        {Unit::ElectricCurrent::Gigaampere,
-         Conversions<Unit::ElectricCurrent,
-         Unit::ElectricCurrent::Gigaampere>::FromStandard<NumericType>               },
-        {Unit::ElectricCurrent::Teraampere,
-         Conversions<Unit::ElectricCurrent,
-         Unit::ElectricCurrent::Teraampere>::FromStandard<NumericType>               },
-        {Unit::ElectricCurrent::Milliampere,
-         Conversions<Unit::ElectricCurrent,
-         Unit::ElectricCurrent::Milliampere>::FromStandard<NumericType>              },
-        {Unit::ElectricCurrent::Microampere,
-         Conversions<Unit::ElectricCurrent,
-         Unit::ElectricCurrent::Microampere>::FromStandard<NumericType>              },
-        {Unit::ElectricCurrent::Nanoampere,
-         Conversions<Unit::ElectricCurrent,
-         Unit::ElectricCurrent::Nanoampere>::FromStandard<NumericType>               },
-        {Unit::ElectricCurrent::ElementaryChargePerSecond,
-         Conversions<Unit::ElectricCurrent,
-         Unit::ElectricCurrent::ElementaryChargePerSecond>::FromStandard<NumericType>},
-        {Unit::ElectricCurrent::ElementaryChargePerMinute,
-         Conversions<Unit::ElectricCurrent,
-         Unit::ElectricCurrent::ElementaryChargePerMinute>::FromStandard<NumericType>},
-        {Unit::ElectricCurrent::ElementaryChargePerHour,
-         Conversions<Unit::ElectricCurrent,
-         Unit::ElectricCurrent::ElementaryChargePerHour>::FromStandard<NumericType>  },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::ElectricCurrent,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::ElectricCurrent, NumericType>{
-        {Unit::ElectricCurrent::Ampere,
-         Conversions<Unit::ElectricCurrent,
-         Unit::ElectricCurrent::Ampere>::ToStandard<NumericType>                   },
-        {Unit::ElectricCurrent::Kiloampere,
-         Conversions<Unit::ElectricCurrent,
-         Unit::ElectricCurrent::Kiloampere>::ToStandard<NumericType>               },
-        {Unit::ElectricCurrent::Megaampere,
-         Conversions<Unit::ElectricCurrent,
-         Unit::ElectricCurrent::Megaampere>::ToStandard<NumericType>               },
-        {Unit::ElectricCurrent::Gigaampere,
-         Conversions<Unit::ElectricCurrent,
-         Unit::ElectricCurrent::Gigaampere>::ToStandard<NumericType>               },
-        {Unit::ElectricCurrent::Teraampere,
-         Conversions<Unit::ElectricCurrent,
-         Unit::ElectricCurrent::Teraampere>::ToStandard<NumericType>               },
-        {Unit::ElectricCurrent::Milliampere,
-         Conversions<Unit::ElectricCurrent,
-         Unit::ElectricCurrent::Milliampere>::ToStandard<NumericType>              },
-        {Unit::ElectricCurrent::Microampere,
-         Conversions<Unit::ElectricCurrent,
-         Unit::ElectricCurrent::Microampere>::ToStandard<NumericType>              },
-        {Unit::ElectricCurrent::Nanoampere,
-         Conversions<Unit::ElectricCurrent,
-         Unit::ElectricCurrent::Nanoampere>::ToStandard<NumericType>               },
-        {Unit::ElectricCurrent::ElementaryChargePerSecond,
-         Conversions<Unit::ElectricCurrent,
-         Unit::ElectricCurrent::ElementaryChargePerSecond>::ToStandard<NumericType>},
-        {Unit::ElectricCurrent::ElementaryChargePerMinute,
-         Conversions<Unit::ElectricCurrent,
-         Unit::ElectricCurrent::ElementaryChargePerMinute>::ToStandard<NumericType>},
-        {Unit::ElectricCurrent::ElementaryChargePerHour,
-         Conversions<Unit::ElectricCurrent,
-         Unit::ElectricCurrent::ElementaryChargePerHour>::ToStandard<NumericType>  },
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::ElectricCurrent>{11};
 
 }  // namespace Internal
 
@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_ENERGY_HPP
 #define PHQ_UNIT_ENERGY_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -170,129 +169,131 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Energy unit) {
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::Energy> ConsistentUnits<Unit::Energy>{
+inline constexpr std::array<std::pair<UnitSystem, Unit::Energy>, 4> ConsistentUnits<Unit::Energy>{{
     {UnitSystem::MetreKilogramSecondKelvin,  Unit::Energy::Joule    },
     {UnitSystem::MillimetreGramSecondKelvin, Unit::Energy::Nanojoule},
     {UnitSystem::FootPoundSecondRankine,     Unit::Energy::FootPound},
     {UnitSystem::InchPoundSecondRankine,     Unit::Energy::InchPound},
-};
+}};
 
 template <>
-inline const std::map<Unit::Energy, UnitSystem> RelatedUnitSystems<Unit::Energy>{
-    {Unit::Energy::Joule,     UnitSystem::MetreKilogramSecondKelvin },
-    {Unit::Energy::Nanojoule, UnitSystem::MillimetreGramSecondKelvin},
-    {Unit::Energy::FootPound, UnitSystem::FootPoundSecondRankine    },
-    {Unit::Energy::InchPound, UnitSystem::InchPoundSecondRankine    },
-};
+inline constexpr std::array<std::pair<Unit::Energy, UnitSystem>, 4>
+    RelatedUnitSystems<Unit::Energy>{{
+        {Unit::Energy::Joule,     UnitSystem::MetreKilogramSecondKelvin },
+        {Unit::Energy::Nanojoule, UnitSystem::MillimetreGramSecondKelvin},
+        {Unit::Energy::FootPound, UnitSystem::FootPoundSecondRankine    },
+        {Unit::Energy::InchPound, UnitSystem::InchPoundSecondRankine    },
+}};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::Energy, std::string_view> Abbreviations<Unit::Energy>{
-    {Unit::Energy::Joule,              "J"     },
-    {Unit::Energy::Millijoule,         "mJ"    },
-    {Unit::Energy::Microjoule,         "μJ"    },
-    {Unit::Energy::Nanojoule,          "nJ"    },
-    {Unit::Energy::Kilojoule,          "kJ"    },
-    {Unit::Energy::Megajoule,          "MJ"    },
-    {Unit::Energy::Gigajoule,          "GJ"    },
-    {Unit::Energy::WattMinute,         "W·min" },
-    {Unit::Energy::WattHour,           "W·hr"  },
-    {Unit::Energy::KilowattMinute,     "kW·min"},
-    {Unit::Energy::KilowattHour,       "kW·hr" },
-    {Unit::Energy::MegawattMinute,     "MW·min"},
-    {Unit::Energy::MegawattHour,       "MW·hr" },
-    {Unit::Energy::GigawattMinute,     "GW·min"},
-    {Unit::Energy::GigawattHour,       "GW·hr" },
-    {Unit::Energy::FootPound,          "ft·lbf"},
-    {Unit::Energy::InchPound,          "in·lbf"},
-    {Unit::Energy::Calorie,            "cal"   },
-    {Unit::Energy::Millicalorie,       "mcal"  },
-    {Unit::Energy::Microcalorie,       "μcal"  },
-    {Unit::Energy::Nanocalorie,        "ncal"  },
-    {Unit::Energy::Kilocalorie,        "kcal"  },
-    {Unit::Energy::Megacalorie,        "Mcal"  },
-    {Unit::Energy::Gigacalorie,        "Gcal"  },
-    {Unit::Energy::Electronvolt,       "eV"    },
-    {Unit::Energy::Millielectronvolt,  "meV"   },
-    {Unit::Energy::Microelectronvolt,  "μeV"   },
-    {Unit::Energy::Nanoelectronvolt,   "neV"   },
-    {Unit::Energy::Kiloelectronvolt,   "keV"   },
-    {Unit::Energy::Megaelectronvolt,   "MeV"   },
-    {Unit::Energy::Gigaelectronvolt,   "GeV"   },
-    {Unit::Energy::BritishThermalUnit, "BTU"   },
-};
-
-template <>
-inline const std::unordered_map<std::string_view, Unit::Energy> Spellings<Unit::Energy>{
+inline constexpr std::array<std::pair<Unit::Energy, std::string_view>, 32>
+    Abbreviations<Unit::Energy>{{
+        {Unit::Energy::Joule,              "J"     },
+        {Unit::Energy::Millijoule,         "mJ"    },
+        {Unit::Energy::Microjoule,         "μJ"    },
+        {Unit::Energy::Nanojoule,          "nJ"    },
+        {Unit::Energy::Kilojoule,          "kJ"    },
+        {Unit::Energy::Megajoule,          "MJ"    },
+        {Unit::Energy::Gigajoule,          "GJ"    },
+        {Unit::Energy::WattMinute,         "W·min" },
+        {Unit::Energy::WattHour,           "W·hr"  },
+        {Unit::Energy::KilowattMinute,     "kW·min"},
+        {Unit::Energy::KilowattHour,       "kW·hr" },
+        {Unit::Energy::MegawattMinute,     "MW·min"},
+        {Unit::Energy::MegawattHour,       "MW·hr" },
+        {Unit::Energy::GigawattMinute,     "GW·min"},
+        {Unit::Energy::GigawattHour,       "GW·hr" },
+        {Unit::Energy::FootPound,          "ft·lbf"},
+        {Unit::Energy::InchPound,          "in·lbf"},
+        {Unit::Energy::Calorie,            "cal"   },
+        {Unit::Energy::Millicalorie,       "mcal"  },
+        {Unit::Energy::Microcalorie,       "μcal"  },
+        {Unit::Energy::Nanocalorie,        "ncal"  },
+        {Unit::Energy::Kilocalorie,        "kcal"  },
+        {Unit::Energy::Megacalorie,        "Mcal"  },
+        {Unit::Energy::Gigacalorie,        "Gcal"  },
+        {Unit::Energy::Electronvolt,       "eV"    },
+        {Unit::Energy::Millielectronvolt,  "meV"   },
+        {Unit::Energy::Microelectronvolt,  "μeV"   },
+        {Unit::Energy::Nanoelectronvolt,   "neV"   },
+        {Unit::Energy::Kiloelectronvolt,   "keV"   },
+        {Unit::Energy::Megaelectronvolt,   "MeV"   },
+        {Unit::Energy::Gigaelectronvolt,   "GeV"   },
+        {Unit::Energy::BritishThermalUnit, "BTU"   },
+}};
+
+template <>
+inline constexpr std::array<std::pair<std::string_view, Unit::Energy>, 67> Spellings<Unit::Energy>{{
+    {"BTU",        Unit::Energy::BritishThermalUnit},
+    {"Cal",        Unit::Energy::Kilocalorie       },
+    {"GJ",         Unit::Energy::Gigajoule         },
+    {"GW*hr",      Unit::Energy::GigawattHour      },
+    {"GW*min",     Unit::Energy::GigawattMinute    },
+    {"GW·hr",      Unit::Energy::GigawattHour      },
+    {"GW·min",     Unit::Energy::GigawattMinute    },
+    {"Gcal",       Unit::Energy::Gigacalorie       },
+    {"GeV",        Unit::Energy::Gigaelectronvolt  },
     {"J",          Unit::Energy::Joule             },
-    {"N·m",        Unit::Energy::Joule             },
-    {"N*m",        Unit::Energy::Joule             },
-    {"kg·m^2/s^2", Unit::Energy::Joule             },
-    {"kg*m^2/s^2", Unit::Energy::Joule             },
-    {"kg·m2/s2",   Unit::Energy::Joule             },
-    {"kg*m2/s2",   Unit::Energy::Joule             },
-    {"W·s",        Unit::Energy::Joule             },
-    {"W*s",        Unit::Energy::Joule             },
-    {"mJ",         Unit::Energy::Millijoule        },
-    {"μJ",         Unit::Energy::Microjoule        },
-    {"uJ",         Unit::Energy::Microjoule        },
-    {"nJ",         Unit::Energy::Nanojoule         },
-    {"μN·mm",      Unit::Energy::Nanojoule         },
-    {"μN*mm",      Unit::Energy::Nanojoule         },
-    {"uN·mm",      Unit::Energy::Nanojoule         },
-    {"uN*mm",      Unit::Energy::Nanojoule         },
-    {"g·mm^2/s^2", Unit::Energy::Nanojoule         },
-    {"g*mm^2/s^2", Unit::Energy::Nanojoule         },
-    {"g·mm2/s2",   Unit::Energy::Nanojoule         },
-    {"g*mm2/s2",   Unit::Energy::Nanojoule         },
-    {"kJ",         Unit::Energy::Kilojoule         },
     {"MJ",         Unit::Energy::Megajoule         },
-    {"GJ",         Unit::Energy::Gigajoule         },
-    {"W·min",      Unit::Energy::WattMinute        },
-    {"W*min",      Unit::Energy::WattMinute        },
-    {"W·hr",       Unit::Energy::WattHour          },
-    {"W*hr",       Unit::Energy::WattHour          },
-    {"kW·min",     Unit::Energy::KilowattMinute    },
-    {"kW*min",     Unit::Energy::KilowattMinute    },
-    {"kW·hr",      Unit::Energy::KilowattHour      },
-    {"kW*hr",      Unit::Energy::KilowattHour      },
-    {"MW·min",     Unit::Energy::MegawattMinute    },
+    {"MW*hr",      Unit::Energy::MegawattHour      },
     {"MW*min",     Unit::Energy::MegawattMinute    },
     {"MW·hr",      Unit::Energy::MegawattHour      },
-    {"MW*hr",      Unit::Energy::MegawattHour      },
-    {"GW·min",     Unit::Energy::GigawattMinute    },
-    {"GW*min",     Unit::Energy::GigawattMinute    },
-    {"GW·hr",      Unit::Energy::GigawattHour      },
-    {"GW*hr",      Unit::Energy::GigawattHour      },
-    {"ft·lbf",     Unit::Energy::FootPound         },
+    {"MW·min",     Unit::Energy::MegawattMinute    },
+    {"Mcal",       Unit::Energy::Megacalorie       },
+    {"MeV",        Unit::Energy::Megaelectronvolt  },
+    {"N*m",        Unit::Energy::Joule             },
+    {"N·m",        Unit::Energy::Joule             },
+    {"W*hr",       Unit::Energy::WattHour          },
+    {"W*min",      Unit::Energy::WattMinute        },
+    {"W*s",        Unit::Energy::Joule             },
+    {"W·hr",       Unit::Energy::WattHour          },
+    {"W·min",      Unit::Energy::WattMinute        },
+    {"W·s",        Unit::Energy::Joule             },
+    {"btu",        Unit::Energy::BritishThermalUnit},
+    {"cal",        Unit::Energy::Calorie           },
+    {"eV",         Unit::Energy::Electronvolt      },
+    {"ft*lb",      Unit::Energy::FootPound         },
     {"ft*lbf",     Unit::Energy::FootPound         },
     {"ft·lb",      Unit::Energy::FootPound         },
-    {"ft*lb",      Unit::Energy::FootPound         },
-    {"in·lbf",     Unit::Energy::InchPound         },
+    {"ft·lbf",     Unit::Energy::FootPound         },
+    {"g*mm2/s2",   Unit::Energy::Nanojoule         },
+    {"g*mm^2/s^2", Unit::Energy::Nanojoule         },
+    {"g·mm2/s2",   Unit::Energy::Nanojoule         },
+    {"g·mm^2/s^2", Unit::Energy::Nanojoule         },
+    {"in*lb",      Unit::Energy::InchPound         },
     {"in*lbf",     Unit::Energy::InchPound         },
     {"in·lb",      Unit::Energy::InchPound         },
-    {"in*lb",      Unit::Energy::InchPound         },
-    {"cal",        Unit::Energy::Calorie           },
-    {"mcal",       Unit::Energy::Millicalorie      },
-    {"μcal",       Unit::Energy::Microcalorie      },
-    {"ucal",       Unit::Energy::Microcalorie      },
-    {"ncal",       Unit::Energy::Nanocalorie       },
+    {"in·lbf",     Unit::Energy::InchPound         },
+    {"kJ",         Unit::Energy::Kilojoule         },
+    {"kW*hr",      Unit::Energy::KilowattHour      },
+    {"kW*min",     Unit::Energy::KilowattMinute    },
+    {"kW·hr",      Unit::Energy::KilowattHour      },
+    {"kW·min",     Unit::Energy::KilowattMinute    },
     {"kcal",       Unit::Energy::Kilocalorie       },
-    {"Cal",        Unit::Energy::Kilocalorie       },
-    {"Mcal",       Unit::Energy::Megacalorie       },
-    {"Gcal",       Unit::Energy::Gigacalorie       },
-    {"eV",         Unit::Energy::Electronvolt      },
+    {"keV",        Unit::Energy::Kiloelectronvolt  },
+    {"kg*m2/s2",   Unit::Energy::Joule             },
+    {"kg*m^2/s^2", Unit::Energy::Joule             },
+    {"kg·m2/s2",   Unit::Energy::Joule             },
+    {"kg·m^2/s^2", Unit::Energy::Joule             },
+    {"mJ",         Unit::Energy::Millijoule        },
+    {"mcal",       Unit::Energy::Millicalorie      },
     {"meV",        Unit::Energy::Millielectronvolt },
-    {"μeV",        Unit::Energy::Microelectronvolt },
-    {"ueV",        Unit::Energy::Microelectronvolt },
+    {"nJ",         Unit::Energy::Nanojoule         },
+    {"ncal",       Unit::Energy::Nanocalorie       },
     {"neV",        Unit::Energy::Nanoelectronvolt  },
-    {"keV",        Unit::Energy::Kiloelectronvolt  },
-    {"MeV",        Unit::Energy::Megaelectronvolt  },
-    {"GeV",        Unit::Energy::Gigaelectronvolt  },
-    {"BTU",        Unit::Energy::BritishThermalUnit},
-    {"btu",        Unit::Energy::BritishThermalUnit},
-};
+    {"uJ",         Unit::Energy::Microjoule        },
+    {"uN*mm",      Unit::Energy::Nanojoule         },
+    {"uN·mm",      Unit::Energy::Nanojoule         },
+    {"ucal",       Unit::Energy::Microcalorie      },
+    {"ueV",        Unit::Energy::Microelectronvolt },
+    {"μJ",         Unit::Energy::Microjoule        },
+    {"μN*mm",      Unit::Energy::Nanojoule         },
+    {"μN·mm",      Unit::Energy::Nanojoule         },
+    {"μcal",       Unit::Energy::Microcalorie      },
+    {"μeV",        Unit::Energy::Microelectronvolt },
+}};
 
 // clang-format on
 
@@ -746,145 +747,8 @@ inline constexpr void Conversion<Unit::Energy, Unit::Energy::BritishThermalUnit>
            / static_cast<NumericType>(1.8L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::Energy,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Energy, NumericType>{
-        {Unit::Energy::Joule,
-         Conversions<Unit::Energy, Unit::Energy::Joule>::FromStandard<NumericType>             },
-        {Unit::Energy::Millijoule,
-         Conversions<Unit::Energy, Unit::Energy::Millijoule>::FromStandard<NumericType>        },
-        {Unit::Energy::Microjoule,
-         Conversions<Unit::Energy, Unit::Energy::Microjoule>::FromStandard<NumericType>        },
-        {Unit::Energy::Nanojoule,
-         Conversions<Unit::Energy, Unit::Energy::Nanojoule>::FromStandard<NumericType>         },
-        {Unit::Energy::Kilojoule,
-         Conversions<Unit::Energy, Unit::Energy::Kilojoule>::FromStandard<NumericType>         },
-        {Unit::Energy::Megajoule,
-         Conversions<Unit::Energy, Unit::Energy::Megajoule>::FromStandard<NumericType>         },
-        {Unit::Energy::Gigajoule,
-         Conversions<Unit::Energy, Unit::Energy::Gigajoule>::FromStandard<NumericType>         },
-        {Unit::Energy::WattMinute,
-         Conversions<Unit::Energy, Unit::Energy::WattMinute>::FromStandard<NumericType>        },
-        {Unit::Energy::WattHour,
-         Conversions<Unit::Energy, Unit::Energy::WattHour>::FromStandard<NumericType>          },
-        {Unit::Energy::KilowattMinute,
-         Conversions<Unit::Energy, Unit::Energy::KilowattMinute>::FromStandard<NumericType>    },
-        {Unit::Energy::KilowattHour,
-         Conversions<Unit::Energy, Unit::Energy::KilowattHour>::FromStandard<NumericType>      },
-        {Unit::Energy::MegawattMinute,
-         Conversions<Unit::Energy, Unit::Energy::MegawattMinute>::FromStandard<NumericType>    },
-        {Unit::Energy::MegawattHour,
-         Conversions<Unit::Energy, Unit::Energy::MegawattHour>::FromStandard<NumericType>      },
-        {Unit::Energy::GigawattMinute,
-         Conversions<Unit::Energy, Unit::Energy::GigawattMinute>::FromStandard<NumericType>    },
-        {Unit::Energy::GigawattHour,
-         Conversions<Unit::Energy, Unit::Energy::GigawattHour>::FromStandard<NumericType>      },
-        {Unit::Energy::FootPound,
-         Conversions<Unit::Energy, Unit::Energy::FootPound>::FromStandard<NumericType>         },
-        {Unit::Energy::InchPound,
-         Conversions<Unit::Energy, Unit::Energy::InchPound>::FromStandard<NumericType>         },
-        {Unit::Energy::Calorie,
-         Conversions<Unit::Energy, Unit::Energy::Calorie>::FromStandard<NumericType>           },
-        {Unit::Energy::Millicalorie,
-         Conversions<Unit::Energy, Unit::Energy::Millicalorie>::FromStandard<NumericType>      },
-        {Unit::Energy::Microcalorie,
-         Conversions<Unit::Energy, Unit::Energy::Microcalorie>::FromStandard<NumericType>      },
-        {Unit::Energy::Nanocalorie,
-         Conversions<Unit::Energy, Unit::Energy::Nanocalorie>::FromStandard<NumericType>       },
-        {Unit::Energy::Kilocalorie,
-         Conversions<Unit::Energy, Unit::Energy::Kilocalorie>::FromStandard<NumericType>       },
-        {Unit::Energy::Megacalorie,
-         Conversions<Unit::Energy, Unit::Energy::Megacalorie>::FromStandard<NumericType>       },
-        {Unit::Energy::Gigacalorie,
-         Conversions<Unit::Energy, Unit::Energy::Gigacalorie>::FromStandard<NumericType>       },
-        {Unit::Energy::Electronvolt,
-         Conversions<Unit::Energy, Unit::Energy::Electronvolt>::FromStandard<NumericType>      },
-        {Unit::Energy::Millielectronvolt,
-         Conversions<Unit::Energy, Unit::Energy::Millielectronvolt>::FromStandard<NumericType> },
-        {Unit::Energy::Microelectronvolt,
-         Conversions<Unit::Energy, Unit::Energy::Microelectronvolt>::FromStandard<NumericType> },
-        {Unit::Energy::Nanoelectronvolt,
-         Conversions<Unit::Energy, Unit::Energy::Nanoelectronvolt>::FromStandard<NumericType>  },
-        {Unit::Energy::Kiloelectronvolt,
-         Conversions<Unit::Energy, Unit::Energy::Kiloelectronvolt>::FromStandard<NumericType>  },
-        {Unit::Energy::Megaelectronvolt,
-         Conversions<Unit::Energy, Unit::Energy::Megaelectronvolt>::FromStandard<NumericType>  },
-        {Unit::Energy::Gigaelectronvolt,
-         Conversions<Unit::Energy, Unit::Energy::Gigaelectronvolt>::FromStandard<NumericType>  },
-        {Unit::Energy::BritishThermalUnit,
-         Conversions<Unit::Energy, Unit::Energy::BritishThermalUnit>::FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Energy,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Energy, NumericType>{
-        {Unit::Energy::Joule,
-         Conversions<Unit::Energy, Unit::Energy::Joule>::ToStandard<NumericType>             },
-        {Unit::Energy::Millijoule,
-         Conversions<Unit::Energy, Unit::Energy::Millijoule>::ToStandard<NumericType>        },
-        {Unit::Energy::Microjoule,
-         Conversions<Unit::Energy, Unit::Energy::Microjoule>::ToStandard<NumericType>        },
-        {Unit::Energy::Nanojoule,
-         Conversions<Unit::Energy, Unit::Energy::Nanojoule>::ToStandard<NumericType>         },
-        {Unit::Energy::Kilojoule,
-         Conversions<Unit::Energy, Unit::Energy::Kilojoule>::ToStandard<NumericType>         },
-        {Unit::Energy::Megajoule,
-         Conversions<Unit::Energy, Unit::Energy::Megajoule>::ToStandard<NumericType>         },
-        {Unit::Energy::Gigajoule,
-         Conversions<Unit::Energy, Unit::Energy::Gigajoule>::ToStandard<NumericType>         },
-        {Unit::Energy::WattMinute,
-         Conversions<Unit::Energy, Unit::Energy::WattMinute>::ToStandard<NumericType>        },
-        {Unit::Energy::WattHour,
-         Conversions<Unit::Energy, Unit::Energy::WattHour>::ToStandard<NumericType>          },
-        {Unit::Energy::KilowattMinute,
-         Conversions<Unit::Energy, Unit::Energy::KilowattMinute>::ToStandard<NumericType>    },
-        {Unit::Energy::KilowattHour,
-         Conversions<Unit::Energy, Unit::Energy::KilowattHour>::ToStandard<NumericType>      },
-        {Unit::Energy::MegawattMinute,
-         Conversions<Unit::Energy, Unit::Energy::MegawattMinute>::ToStandard<NumericType>    },
-        {Unit::Energy::MegawattHour,
-         Conversions<Unit::Energy, Unit::Energy::MegawattHour>::ToStandard<NumericType>      },
-        {Unit::Energy::GigawattMinute,
-         Conversions<Unit::Energy, Unit::Energy::GigawattMinute>::ToStandard<NumericType>    },
-        {Unit::Energy::GigawattHour,
-         Conversions<Unit::Energy, Unit::Energy::GigawattHour>::ToStandard<NumericType>      },
-        {Unit::Energy::FootPound,
-         Conversions<Unit::Energy, Unit::Energy::FootPound>::ToStandard<NumericType>         },
-        {Unit::Energy::InchPound,
-         Conversions<Unit::Energy, Unit::Energy::InchPound>::ToStandard<NumericType>         },
-        {Unit::Energy::Calorie,
-         Conversions<Unit::Energy, Unit::Energy::Calorie>::ToStandard<NumericType>           },
-        {Unit::Energy::Millicalorie,
-         Conversions<Unit::Energy, Unit::Energy::Millicalorie>::ToStandard<NumericType>      },
-        {Unit::Energy::Microcalorie,
-         Conversions<Unit::Energy, Unit::Energy::Microcalorie>::ToStandard<NumericType>      },
-        {Unit::Energy::Nanocalorie,
-         Conversions<Unit::Energy, Unit::Energy::Nanocalorie>::ToStandard<NumericType>       },
-        {Unit::Energy::Kilocalorie,
-         Conversions<Unit::Energy, Unit::Energy::Kilocalorie>::ToStandard<NumericType>       },
-        {Unit::Energy::Megacalorie,
-         Conversions<Unit::Energy, Unit::Energy::Megacalorie>::ToStandard<NumericType>       },
-        {Unit::Energy::Gigacalorie,
-         Conversions<Unit::Energy, Unit::Energy::Gigacalorie>::ToStandard<NumericType>       },
-        {Unit::Energy::Electronvolt,
-         Conversions<Unit::Energy, Unit::Energy::Electronvolt>::ToStandard<NumericType>      },
-        {Unit::Energy::Millielectronvolt,
-         Conversions<Unit::Energy, Unit::Energy::Millielectronvolt>::ToStandard<NumericType> },
-        {Unit::Energy::Microelectronvolt,
-         Conversions<Unit::Energy, Unit::Energy::Microelectronvolt>::ToStandard<NumericType> },
-        {Unit::Energy::Nanoelectronvolt,
-         Conversions<Unit::Energy, Unit::Energy::Nanoelectronvolt>::ToStandard<NumericType>  },
-        {Unit::Energy::Kiloelectronvolt,
-         Conversions<Unit::Energy, Unit::Energy::Kiloelectronvolt>::ToStandard<NumericType>  },
-        {Unit::Energy::Megaelectronvolt,
-         Conversions<Unit::Energy, Unit::Energy::Megaelectronvolt>::ToStandard<NumericType>  },
-        {Unit::Energy::Gigaelectronvolt,
-         Conversions<Unit::Energy, Unit::Energy::Gigaelectronvolt>::ToStandard<NumericType>  },
-        {Unit::Energy::BritishThermalUnit,
-         Conversions<Unit::Energy, Unit::Energy::BritishThermalUnit>::ToStandard<NumericType>},
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Energy>{32};
 
 }  // namespace Internal
 
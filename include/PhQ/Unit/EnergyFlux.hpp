@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_ENERGY_FLUX_HPP
 #define PHQ_UNIT_ENERGY_FLUX_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -87,89 +86,93 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::EnergyFlux uni
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::EnergyFlux> ConsistentUnits<Unit::EnergyFlux>{
-    {UnitSystem::MetreKilogramSecondKelvin,  Unit::EnergyFlux::WattPerSquareMetre             },
-    {UnitSystem::MillimetreGramSecondKelvin, Unit::EnergyFlux::NanowattPerSquareMillimetre    },
-    {UnitSystem::FootPoundSecondRankine,     Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
-    {UnitSystem::InchPoundSecondRankine,     Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
-};
+inline constexpr std::array<std::pair<UnitSystem, Unit::EnergyFlux>, 4>
+    ConsistentUnits<Unit::EnergyFlux>{{
+        {UnitSystem::MetreKilogramSecondKelvin,  Unit::EnergyFlux::WattPerSquareMetre             },
+        {UnitSystem::MillimetreGramSecondKelvin, Unit::EnergyFlux::NanowattPerSquareMillimetre    },
+        {UnitSystem::FootPoundSecondRankine,     Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
+        {UnitSystem::InchPoundSecondRankine,     Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
+}};
 
 template <>
-inline const std::map<Unit::EnergyFlux, UnitSystem> RelatedUnitSystems<Unit::EnergyFlux>{
-    {Unit::EnergyFlux::WattPerSquareMetre,              UnitSystem::MetreKilogramSecondKelvin },
-    {Unit::EnergyFlux::NanowattPerSquareMillimetre,     UnitSystem::MillimetreGramSecondKelvin},
-    {Unit::EnergyFlux::FootPoundPerSquareFootPerSecond, UnitSystem::FootPoundSecondRankine    },
-    {Unit::EnergyFlux::InchPoundPerSquareInchPerSecond, UnitSystem::InchPoundSecondRankine    },
-};
+inline constexpr std::array<std::pair<Unit::EnergyFlux, UnitSystem>, 4>
+    RelatedUnitSystems<Unit::EnergyFlux>{{
+        {Unit::EnergyFlux::WattPerSquareMetre,              UnitSystem::MetreKilogramSecondKelvin },
+        {Unit::EnergyFlux::NanowattPerSquareMillimetre,     UnitSystem::MillimetreGramSecondKelvin},
+        {Unit::EnergyFlux::FootPoundPerSquareFootPerSecond, UnitSystem::FootPoundSecondRankine    },
+        {Unit::EnergyFlux::InchPoundPerSquareInchPerSecond, UnitSystem::InchPoundSecondRankine    },
+}};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::EnergyFlux, std::string_view> Abbreviations<Unit::EnergyFlux>{
-    {Unit::EnergyFlux::WattPerSquareMetre,              "W/m^2"        },
-    {Unit::EnergyFlux::NanowattPerSquareMillimetre,     "nW/mm^2"      },
-    {Unit::EnergyFlux::FootPoundPerSquareFootPerSecond, "ft·lbf/ft^2/s"},
-    {Unit::EnergyFlux::InchPoundPerSquareInchPerSecond, "in·lbf/in^2/s"},
-};
+inline constexpr std::array<std::pair<Unit::EnergyFlux, std::string_view>, 4>
+    Abbreviations<Unit::EnergyFlux>{{
+        {Unit::EnergyFlux::WattPerSquareMetre,              "W/m^2"        },
+        {Unit::EnergyFlux::NanowattPerSquareMillimetre,     "nW/mm^2"      },
+        {Unit::EnergyFlux::FootPoundPerSquareFootPerSecond, "ft·lbf/ft^2/s"},
+        {Unit::EnergyFlux::InchPoundPerSquareInchPerSecond, "in·lbf/in^2/s"},
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::EnergyFlux> Spellings<Unit::EnergyFlux>{
-    {"W/m^2",           Unit::EnergyFlux::WattPerSquareMetre             },
-    {"W/m2",            Unit::EnergyFlux::WattPerSquareMetre             },
-    {"J/(m^2·s)",       Unit::EnergyFlux::WattPerSquareMetre             },
-    {"J/(m^2*s)",       Unit::EnergyFlux::WattPerSquareMetre             },
-    {"J/(m2·s)",        Unit::EnergyFlux::WattPerSquareMetre             },
-    {"J/(m2*s)",        Unit::EnergyFlux::WattPerSquareMetre             },
-    {"J/m^2/s",         Unit::EnergyFlux::WattPerSquareMetre             },
-    {"J/m2/s",          Unit::EnergyFlux::WattPerSquareMetre             },
-    {"N/(m·s)",         Unit::EnergyFlux::WattPerSquareMetre             },
-    {"N/(m*s)",         Unit::EnergyFlux::WattPerSquareMetre             },
-    {"N/m/s",           Unit::EnergyFlux::WattPerSquareMetre             },
-    {"kg/s^3",          Unit::EnergyFlux::WattPerSquareMetre             },
-    {"kg/s3",           Unit::EnergyFlux::WattPerSquareMetre             },
-    {"nW/mm^2",         Unit::EnergyFlux::NanowattPerSquareMillimetre    },
-    {"nW/mm2",          Unit::EnergyFlux::NanowattPerSquareMillimetre    },
-    {"nJ/(mm^2·s)",     Unit::EnergyFlux::NanowattPerSquareMillimetre    },
-    {"nJ/(mm^2*s)",     Unit::EnergyFlux::NanowattPerSquareMillimetre    },
-    {"nJ/(mm2·s)",      Unit::EnergyFlux::NanowattPerSquareMillimetre    },
-    {"nJ/(mm2*s)",      Unit::EnergyFlux::NanowattPerSquareMillimetre    },
-    {"nJ/mm^2/s",       Unit::EnergyFlux::NanowattPerSquareMillimetre    },
-    {"nJ/mm2/s",        Unit::EnergyFlux::NanowattPerSquareMillimetre    },
-    {"μN/(mm·s)",       Unit::EnergyFlux::NanowattPerSquareMillimetre    },
-    {"μN/(mm*s)",       Unit::EnergyFlux::NanowattPerSquareMillimetre    },
-    {"μN/mm/s",         Unit::EnergyFlux::NanowattPerSquareMillimetre    },
-    {"uN/(mm·s)",       Unit::EnergyFlux::NanowattPerSquareMillimetre    },
-    {"uN/(mm*s)",       Unit::EnergyFlux::NanowattPerSquareMillimetre    },
-    {"uN/mm/s",         Unit::EnergyFlux::NanowattPerSquareMillimetre    },
-    {"g/s^3",           Unit::EnergyFlux::NanowattPerSquareMillimetre    },
-    {"g/s3",            Unit::EnergyFlux::NanowattPerSquareMillimetre    },
-    {"ft·lbf/(ft^2·s)", Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
-    {"ft·lbf/(ft2·s)",  Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
-    {"ft*lbf/(ft^2*s)", Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
-    {"ft*lbf/(ft2*s)",  Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
-    {"ft·lbf/ft^2/s",   Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
-    {"ft·lbf/ft2/s",    Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
-    {"ft*lbf/ft^2/s",   Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
-    {"ft*lbf/ft2/s",    Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
-    {"lbf/(ft·s)",      Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
-    {"lbf/(ft*s)",      Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
-    {"lbf/ft/s",        Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
-    {"slug/s^3",        Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
-    {"slug/s3",         Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
-    {"in·lbf/(in^2·s)", Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
-    {"in·lbf/(in2·s)",  Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
-    {"in*lbf/(in^2*s)", Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
-    {"in*lbf/(in2*s)",  Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
-    {"in·lbf/in^2/s",   Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
-    {"in·lbf/in2/s",    Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
-    {"in*lbf/in^2/s",   Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
-    {"in*lbf/in2/s",    Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
-    {"lbf/(in·s)",      Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
-    {"lbf/(in*s)",      Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
-    {"lbf/in/s",        Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
-    {"slinch/s^3",      Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
-    {"slinch/s3",       Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
-};
+inline constexpr std::array<std::pair<std::string_view, Unit::EnergyFlux>, 55>
+    Spellings<Unit::EnergyFlux>{{
+        {"J/(m2*s)",        Unit::EnergyFlux::WattPerSquareMetre             },
+        {"J/(m2·s)",        Unit::EnergyFlux::WattPerSquareMetre             },
+        {"J/(m^2*s)",       Unit::EnergyFlux::WattPerSquareMetre             },
+        {"J/(m^2·s)",       Unit::EnergyFlux::WattPerSquareMetre             },
+        {"J/m2/s",          Unit::EnergyFlux::WattPerSquareMetre             },
+        {"J/m^2/s",         Unit::EnergyFlux::WattPerSquareMetre             },
+        {"N/(m*s)",         Unit::EnergyFlux::WattPerSquareMetre             },
+        {"N/(m·s)",         Unit::EnergyFlux::WattPerSquareMetre             },
+        {"N/m/s",           Unit::EnergyFlux::WattPerSquareMetre             },
+        {"W/m2",            Unit::EnergyFlux::WattPerSquareMetre             },
+        {"W/m^2",           Unit::EnergyFlux::WattPerSquareMetre             },
+        {"ft*lbf/(ft2*s)",  Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
+        {"ft*lbf/(ft^2*s)", Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
+        {"ft*lbf/ft2/s",    Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
+        {"ft*lbf/ft^2/s",   Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
+        {"ft·lbf/(ft2·s)",  Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
+        {"ft·lbf/(ft^2·s)", Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
+        {"ft·lbf/ft2/s",    Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
+        {"ft·lbf/ft^2/s",   Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
+        {"g/s3",            Unit::EnergyFlux::NanowattPerSquareMillimetre    },
+        {"g/s^3",           Unit::EnergyFlux::NanowattPerSquareMillimetre    },
+        {"in*lbf/(in2*s)",  Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
+        {"in*lbf/(in^2*s)", Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
+        {"in*lbf/in2/s",    Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
+        {"in*lbf/in^2/s",   Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
+        {"in·lbf/(in2·s)",  Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
+        {"in·lbf/(in^2·s)", Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
+        {"in·lbf/in2/s",    Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
+        {"in·lbf/in^2/s",   Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
+        {"kg/s3",           Unit::EnergyFlux::WattPerSquareMetre             },
+        {"kg/s^3",          Unit::EnergyFlux::WattPerSquareMetre             },
+        {"lbf/(ft*s)",      Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
+        {"lbf/(ft·s)",      Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
+        {"lbf/(in*s)",      Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
+        {"lbf/(in·s)",      Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
+        {"lbf/ft/s",        Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
+        {"lbf/in/s",        Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
+        {"nJ/(mm2*s)",      Unit::EnergyFlux::NanowattPerSquareMillimetre    },
+        {"nJ/(mm2·s)",      Unit::EnergyFlux::NanowattPerSquareMillimetre    },
+        {"nJ/(mm^2*s)",     Unit::EnergyFlux::NanowattPerSquareMillimetre    },
+        {"nJ/(mm^2·s)",     Unit::EnergyFlux::NanowattPerSquareMillimetre    },
+        {"nJ/mm2/s",        Unit::EnergyFlux::NanowattPerSquareMillimetre    },
+        {"nJ/mm^2/s",       Unit::EnergyFlux::NanowattPerSquareMillimetre    },
+        {"nW/mm2",          Unit::EnergyFlux::NanowattPerSquareMillimetre    },
+        {"nW/mm^2",         Unit::EnergyFlux::NanowattPerSquareMillimetre    },
+        {"slinch/s3",       Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
+        {"slinch/s^3",      Unit::EnergyFlux::InchPoundPerSquareInchPerSecond},
+        {"slug/s3",         Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
+        {"slug/s^3",        Unit::EnergyFlux::FootPoundPerSquareFootPerSecond},
+        {"uN/(mm*s)",       Unit::EnergyFlux::NanowattPerSquareMillimetre    },
+        {"uN/(mm·s)",       Unit::EnergyFlux::NanowattPerSquareMillimetre    },
+        {"uN/mm/s",         Unit::EnergyFlux::NanowattPerSquareMillimetre    },
+        {"μN/(mm*s)",       Unit::EnergyFlux::NanowattPerSquareMillimetre    },
+        {"μN/(mm·s)",       Unit::EnergyFlux::NanowattPerSquareMillimetre    },
+        {"μN/mm/s",         Unit::EnergyFlux::NanowattPerSquareMillimetre    },
+}};
 
 // clang-format on
 
@@ -237,41 +240,8 @@ Conversion<Unit::EnergyFlux, Unit::EnergyFlux::InchPoundPerSquareInchPerSecond>:
            / static_cast<NumericType>(0.0254L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::EnergyFlux,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::EnergyFlux, NumericType>{
-        {Unit::EnergyFlux::WattPerSquareMetre,
-         Conversions<Unit::EnergyFlux,
-         Unit::EnergyFlux::WattPerSquareMetre>::FromStandard<NumericType>             },
-        {Unit::EnergyFlux::NanowattPerSquareMillimetre,
-         Conversions<Unit::EnergyFlux,
-         Unit::EnergyFlux::NanowattPerSquareMillimetre>::FromStandard<NumericType>    },
-        {Unit::EnergyFlux::FootPoundPerSquareFootPerSecond,
-         Conversions<Unit::EnergyFlux,
-         Unit::EnergyFlux::FootPoundPerSquareFootPerSecond>::FromStandard<NumericType>},
-        {Unit::EnergyFlux::InchPoundPerSquareInchPerSecond,
-         Conversions<Unit::EnergyFlux,
-         Unit::EnergyFlux::InchPoundPerSquareInchPerSecond>::FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::EnergyFlux,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::EnergyFlux, NumericType>{
-        {Unit::EnergyFlux::WattPerSquareMetre,
-         Conversions<Unit::EnergyFlux,
-         Unit::EnergyFlux::WattPerSquareMetre>::ToStandard<NumericType>             },
-        {Unit::EnergyFlux::NanowattPerSquareMillimetre,
-         Conversions<Unit::EnergyFlux,
-         Unit::EnergyFlux::NanowattPerSquareMillimetre>::ToStandard<NumericType>    },
-        {Unit::EnergyFlux::FootPoundPerSquareFootPerSecond,
-         Conversions<Unit::EnergyFlux,
-         Unit::EnergyFlux::FootPoundPerSquareFootPerSecond>::ToStandard<NumericType>},
-        {Unit::EnergyFlux::InchPoundPerSquareInchPerSecond,
-         Conversions<Unit::EnergyFlux,
-         Unit::EnergyFlux::InchPoundPerSquareInchPerSecond>::ToStandard<NumericType>},
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::EnergyFlux>{4};
 
 }  // namespace Internal
 
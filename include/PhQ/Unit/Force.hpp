@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_FORCE_HPP
 #define PHQ_UNIT_FORCE_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -101,59 +100,60 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Force unit) {
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::Force> ConsistentUnits<Unit::Force>{
+inline constexpr std::array<std::pair<UnitSystem, Unit::Force>, 4> ConsistentUnits<Unit::Force>{{
     {UnitSystem::MetreKilogramSecondKelvin,  Unit::Force::Newton     },
     {UnitSystem::MillimetreGramSecondKelvin, Unit::Force::Micronewton},
     {UnitSystem::FootPoundSecondRankine,     Unit::Force::Pound      },
     {UnitSystem::InchPoundSecondRankine,     Unit::Force::Pound      },
-};
+}};
 
 template <>
-inline const std::map<Unit::Force, UnitSystem> RelatedUnitSystems<Unit::Force>{
+inline constexpr std::array<std::pair<Unit::Force, UnitSystem>, 2> RelatedUnitSystems<Unit::Force>{{
     {Unit::Force::Newton,      UnitSystem::MetreKilogramSecondKelvin },
     {Unit::Force::Micronewton, UnitSystem::MillimetreGramSecondKelvin},
-};
+}};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::Force, std::string_view> Abbreviations<Unit::Force>{
-    {Unit::Force::Newton,      "N"  },
-    {Unit::Force::Kilonewton,  "kN" },
-    {Unit::Force::Meganewton,  "MN" },
-    {Unit::Force::Giganewton,  "GN" },
-    {Unit::Force::Millinewton, "mN" },
-    {Unit::Force::Micronewton, "μN" },
-    {Unit::Force::Nanonewton,  "nN" },
-    {Unit::Force::Dyne,        "dyn"},
-    {Unit::Force::Pound,       "lbf"},
-};
+inline constexpr std::array<std::pair<Unit::Force, std::string_view>, 9>
+    Abbreviations<Unit::Force>{{
+        {Unit::Force::Newton,      "N"  },
+        {Unit::Force::Kilonewton,  "kN" },
+        {Unit::Force::Meganewton,  "MN" },
+        {Unit::Force::Giganewton,  "GN" },
+        {Unit::Force::Millinewton, "mN" },
+        {Unit::Force::Micronewton, "μN" },
+        {Unit::Force::Nanonewton,  "nN" },
+        {Unit::Force::Dyne,        "dyn"},
+        {Unit::Force::Pound,       "lbf"},
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Force> Spellings<Unit::Force>{
-    {"N",        Unit::Force::Newton     },
+inline constexpr std::array<std::pair<std::string_view, Unit::Force>, 22> Spellings<Unit::Force>{{
+    {"GN",       Unit::Force::Giganewton },
     {"J/m",      Unit::Force::Newton     },
+    {"MN",       Unit::Force::Meganewton },
+    {"N",        Unit::Force::Newton     },
+    {"dyn",      Unit::Force::Dyne       },
+    {"g*mm/s2",  Unit::Force::Micronewton},
+    {"g*mm/s^2", Unit::Force::Micronewton},
+    {"g·mm/s2",  Unit::Force::Micronewton},
+    {"g·mm/s^2", Unit::Force::Micronewton},
     {"kJ/km",    Unit::Force::Newton     },
-    {"kg·m/s^2", Unit::Force::Newton     },
+    {"kN",       Unit::Force::Kilonewton },
+    {"kg*m/s2",  Unit::Force::Newton     },
     {"kg*m/s^2", Unit::Force::Newton     },
     {"kg·m/s2",  Unit::Force::Newton     },
-    {"kg*m/s2",  Unit::Force::Newton     },
-    {"kN",       Unit::Force::Kilonewton },
-    {"MN",       Unit::Force::Meganewton },
-    {"GN",       Unit::Force::Giganewton },
+    {"kg·m/s^2", Unit::Force::Newton     },
+    {"lb",       Unit::Force::Pound      },
+    {"lbf",      Unit::Force::Pound      },
     {"mN",       Unit::Force::Millinewton},
-    {"μN",       Unit::Force::Micronewton},
-    {"uN",       Unit::Force::Micronewton},
     {"nJ/mm",    Unit::Force::Micronewton},
-    {"g·mm/s^2", Unit::Force::Micronewton},
-    {"g*mm/s^2", Unit::Force::Micronewton},
-    {"g·mm/s2",  Unit::Force::Micronewton},
-    {"g*mm/s2",  Unit::Force::Micronewton},
     {"nN",       Unit::Force::Nanonewton },
-    {"dyn",      Unit::Force::Dyne       },
-    {"lbf",      Unit::Force::Pound      },
-    {"lb",       Unit::Force::Pound      },
-};
+    {"uN",       Unit::Force::Micronewton},
+    {"μN",       Unit::Force::Micronewton},
+}};
 
 // clang-format on
 
@@ -279,49 +279,8 @@ inline constexpr void Conversion<Unit::Force, Unit::Force::Pound>::ToStandard(
   value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::Force, std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Force, NumericType>{
-        {Unit::Force::Newton,
-         Conversions<Unit::Force,                           Unit::Force::Newton>::FromStandard<NumericType>     },
-        {Unit::Force::Kilonewton,
-         Conversions<Unit::Force,                           Unit::Force::Kilonewton>::FromStandard<NumericType> },
-        {Unit::Force::Meganewton,
-         Conversions<Unit::Force,                           Unit::Force::Meganewton>::FromStandard<NumericType> },
-        {Unit::Force::Giganewton,
-         Conversions<Unit::Force,                           Unit::Force::Giganewton>::FromStandard<NumericType> },
-        {Unit::Force::Millinewton,
-         Conversions<Unit::Force,                           Unit::Force::Millinewton>::FromStandard<NumericType>},
-        {Unit::Force::Micronewton,
-         Conversions<Unit::Force,                           Unit::Force::Micronewton>::FromStandard<NumericType>},
-        {Unit::Force::Nanonewton,
-         Conversions<Unit::Force,                           Unit::Force::Nanonewton>::FromStandard<NumericType> },
-        {Unit::Force::Dyne,        Conversions<Unit::Force, Unit::Force::Dyne>::FromStandard<NumericType>       },
-        {Unit::Force::Pound,
-         Conversions<Unit::Force,                           Unit::Force::Pound>::FromStandard<NumericType>      },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Force,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Force, NumericType>{
-        {Unit::Force::Newton,
-         Conversions<Unit::Force,                           Unit::Force::Newton>::ToStandard<NumericType>     },
-        {Unit::Force::Kilonewton,
-         Conversions<Unit::Force,                           Unit::Force::Kilonewton>::ToStandard<NumericType> },
-        {Unit::Force::Meganewton,
-         Conversions<Unit::Force,                           Unit::Force::Meganewton>::ToStandard<NumericType> },
-        {Unit::Force::Giganewton,
-         Conversions<Unit::Force,                           Unit::Force::Giganewton>::ToStandard<NumericType> },
-        {Unit::Force::Millinewton,
-         Conversions<Unit::Force,                           Unit::Force::Millinewton>::ToStandard<NumericType>},
-        {Unit::Force::Micronewton,
-         Conversions<Unit::Force,                           Unit::Force::Micronewton>::ToStandard<NumericType>},
-        {Unit::Force::Nanonewton,
-         Conversions<Unit::Force,                           Unit::Force::Nanonewton>::ToStandard<NumericType> },
-        {Unit::Force::Dyne,        Conversions<Unit::Force, Unit::Force::Dyne>::ToStandard<NumericType>       },
-        {Unit::Force::Pound,       Conversions<Unit::Force, Unit::Force::Pound>::ToStandard<NumericType>      },
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Force>{9};
 
 }  // namespace Internal
 
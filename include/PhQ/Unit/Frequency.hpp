@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_FREQUENCY_HPP
 #define PHQ_UNIT_FREQUENCY_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -92,39 +91,43 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Frequency unit
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::Frequency> ConsistentUnits<Unit::Frequency>{
-    {UnitSystem::MetreKilogramSecondKelvin,  Unit::Frequency::Hertz},
-    {UnitSystem::MillimetreGramSecondKelvin, Unit::Frequency::Hertz},
-    {UnitSystem::FootPoundSecondRankine,     Unit::Frequency::Hertz},
-    {UnitSystem::InchPoundSecondRankine,     Unit::Frequency::Hertz},
-};
+inline constexpr std::array<std::pair<UnitSystem, Unit::Frequency>, 4>
+    ConsistentUnits<Unit::Frequency>{{
+        {UnitSystem::MetreKilogramSecondKelvin,  Unit::Frequency::Hertz},
+        {UnitSystem::MillimetreGramSecondKelvin, Unit::Frequency::Hertz},
+        {UnitSystem::FootPoundSecondRankine,     Unit::Frequency::Hertz},
+        {UnitSystem::InchPoundSecondRankine,     Unit::Frequency::Hertz},
+}};
 
 template <>
-inline const std::map<Unit::Frequency, UnitSystem> RelatedUnitSystems<Unit::Frequency>{};
+inline constexpr std::array<std::pair<Unit::Frequency, UnitSystem>, 0>
+    RelatedUnitSystems<Unit::Frequency>{};
 
 template <>
-inline const std::map<Unit::Frequency, std::string_view> Abbreviations<Unit::Frequency>{
-    {Unit::Frequency::Hertz,     "Hz"  },
-    {Unit::Frequency::Kilohertz, "kHz" },
-    {Unit::Frequency::Megahertz, "MHz" },
-    {Unit::Frequency::Gigahertz, "GHz" },
-    {Unit::Frequency::PerMinute, "/min"},
-    {Unit::Frequency::PerHour,   "/hr" },
-};
+inline constexpr std::array<std::pair<Unit::Frequency, std::string_view>, 6>
+    Abbreviations<Unit::Frequency>{{
+        {Unit::Frequency::Hertz,     "Hz"  },
+        {Unit::Frequency::Kilohertz, "kHz" },
+        {Unit::Frequency::Megahertz, "MHz" },
+        {Unit::Frequency::Gigahertz, "GHz" },
+        {Unit::Frequency::PerMinute, "/min"},
+        {Unit::Frequency::PerHour,   "/hr" },
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Frequency> Spellings<Unit::Frequency>{
-    {"Hz",    Unit::Frequency::Hertz    },
-    {"/s",    Unit::Frequency::Hertz    },
-    {"1/s",   Unit::Frequency::Hertz    },
-    {"kHz",   Unit::Frequency::Kilohertz},
-    {"MHz",   Unit::Frequency::Megahertz},
-    {"GHz",   Unit::Frequency::Gigahertz},
-    {"/min",  Unit::Frequency::PerMinute},
-    {"1/min", Unit::Frequency::PerMinute},
-    {"/hr",   Unit::Frequency::PerHour  },
-    {"1/hr",  Unit::Frequency::PerHour  },
-};
+inline constexpr std::array<std::pair<std::string_view, Unit::Frequency>, 10>
+    Spellings<Unit::Frequency>{{
+        {"/hr",   Unit::Frequency::PerHour  },
+        {"/min",  Unit::Frequency::PerMinute},
+        {"/s",    Unit::Frequency::Hertz    },
+        {"1/hr",  Unit::Frequency::PerHour  },
+        {"1/min", Unit::Frequency::PerMinute},
+        {"1/s",   Unit::Frequency::Hertz    },
+        {"GHz",   Unit::Frequency::Gigahertz},
+        {"Hz",    Unit::Frequency::Hertz    },
+        {"MHz",   Unit::Frequency::Megahertz},
+        {"kHz",   Unit::Frequency::Kilohertz},
+}};
 
 template <>
 template <typename NumericType>
@@ -206,41 +209,8 @@ inline constexpr void Conversion<Unit::Frequency, Unit::Frequency::PerHour>::ToS
   value /= static_cast<NumericType>(3600.0L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::Frequency,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Frequency, NumericType>{
-        {Unit::Frequency::Hertz,
-         Conversions<Unit::Frequency, Unit::Frequency::Hertz>::FromStandard<NumericType>    },
-        {Unit::Frequency::Kilohertz,
-         Conversions<Unit::Frequency, Unit::Frequency::Kilohertz>::FromStandard<NumericType>},
-        {Unit::Frequency::Megahertz,
-         Conversions<Unit::Frequency, Unit::Frequency::Megahertz>::FromStandard<NumericType>},
-        {Unit::Frequency::Gigahertz,
-         Conversions<Unit::Frequency, Unit::Frequency::Gigahertz>::FromStandard<NumericType>},
-        {Unit::Frequency::PerMinute,
-         Conversions<Unit::Frequency, Unit::Frequency::PerMinute>::FromStandard<NumericType>},
-        {Unit::Frequency::PerHour,
-         Conversions<Unit::Frequency, Unit::Frequency::PerHour>::FromStandard<NumericType>  },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Frequency,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Frequency, NumericType>{
-        {Unit::Frequency::Hertz,
-         Conversions<Unit::Frequency, Unit::Frequency::Hertz>::ToStandard<NumericType>    },
-        {Unit::Frequency::Kilohertz,
-         Conversions<Unit::Frequency, Unit::Frequency::Kilohertz>::ToStandard<NumericType>},
-        {Unit::Frequency::Megahertz,
-         Conversions<Unit::Frequency, Unit::Frequency::Megahertz>::ToStandard<NumericType>},
-        {Unit::Frequency::Gigahertz,
-         Conversions<Unit::Frequency, Unit::Frequency::Gigahertz>::ToStandard<NumericType>},
-        {Unit::Frequency::PerMinute,
-         Conversions<Unit::Frequency, Unit::Frequency::PerMinute>::ToStandard<NumericType>},
-        {Unit::Frequency::PerHour,
-         Conversions<Unit::Frequency, Unit::Frequency::PerHour>::ToStandard<NumericType>  },
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Frequency>{6};
 
 }  // namespace Internal
 
@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_HEAT_CAPACITY_HPP
 #define PHQ_UNIT_HEAT_CAPACITY_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -87,74 +86,78 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::HeatCapacity u
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::HeatCapacity> ConsistentUnits<Unit::HeatCapacity>{
-    {UnitSystem::MetreKilogramSecondKelvin,  Unit::HeatCapacity::JoulePerKelvin     },
-    {UnitSystem::MillimetreGramSecondKelvin, Unit::HeatCapacity::NanojoulePerKelvin },
-    {UnitSystem::FootPoundSecondRankine,     Unit::HeatCapacity::FootPoundPerRankine},
-    {UnitSystem::InchPoundSecondRankine,     Unit::HeatCapacity::InchPoundPerRankine},
-};
+inline constexpr std::array<std::pair<UnitSystem, Unit::HeatCapacity>, 4>
+    ConsistentUnits<Unit::HeatCapacity>{{
+        {UnitSystem::MetreKilogramSecondKelvin,  Unit::HeatCapacity::JoulePerKelvin     },
+        {UnitSystem::MillimetreGramSecondKelvin, Unit::HeatCapacity::NanojoulePerKelvin },
+        {UnitSystem::FootPoundSecondRankine,     Unit::HeatCapacity::FootPoundPerRankine},
+        {UnitSystem::InchPoundSecondRankine,     Unit::HeatCapacity::InchPoundPerRankine},
+}};
 
 template <>
-inline const std::map<Unit::HeatCapacity, UnitSystem> RelatedUnitSystems<Unit::HeatCapacity>{
-    {Unit::HeatCapacity::JoulePerKelvin,      UnitSystem::MetreKilogramSecondKelvin },
-    {Unit::HeatCapacity::NanojoulePerKelvin,  UnitSystem::MillimetreGramSecondKelvin},
-    {Unit::HeatCapacity::FootPoundPerRankine, UnitSystem::FootPoundSecondRankine    },
-    {Unit::HeatCapacity::InchPoundPerRankine, UnitSystem::InchPoundSecondRankine    },
-};
+inline constexpr std::array<std::pair<Unit::HeatCapacity, UnitSystem>, 4>
+    RelatedUnitSystems<Unit::HeatCapacity>{{
+        {Unit::HeatCapacity::JoulePerKelvin,      UnitSystem::MetreKilogramSecondKelvin },
+        {Unit::HeatCapacity::NanojoulePerKelvin,  UnitSystem::MillimetreGramSecondKelvin},
+        {Unit::HeatCapacity::FootPoundPerRankine, UnitSystem::FootPoundSecondRankine    },
+        {Unit::HeatCapacity::InchPoundPerRankine, UnitSystem::InchPoundSecondRankine    },
+}};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::HeatCapacity, std::string_view> Abbreviations<Unit::HeatCapacity>{
-    {Unit::HeatCapacity::JoulePerKelvin,      "J/K"      },
-    {Unit::HeatCapacity::NanojoulePerKelvin,  "nJ/K"     },
-    {Unit::HeatCapacity::FootPoundPerRankine, "ft·lbf/°R"},
-    {Unit::HeatCapacity::InchPoundPerRankine, "in·lbf/°R"},
-};
+inline constexpr std::array<std::pair<Unit::HeatCapacity, std::string_view>, 4>
+    Abbreviations<Unit::HeatCapacity>{{
+        {Unit::HeatCapacity::JoulePerKelvin,      "J/K"      },
+        {Unit::HeatCapacity::NanojoulePerKelvin,  "nJ/K"     },
+        {Unit::HeatCapacity::FootPoundPerRankine, "ft·lbf/°R"},
+        {Unit::HeatCapacity::InchPoundPerRankine, "in·lbf/°R"},
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::HeatCapacity> Spellings<Unit::HeatCapacity>{
-    {"J/K",            Unit::HeatCapacity::JoulePerKelvin     },
-    {"N·m/K",          Unit::HeatCapacity::JoulePerKelvin     },
-    {"N*m/K",          Unit::HeatCapacity::JoulePerKelvin     },
-    {"kg·m^2/s^2/K",   Unit::HeatCapacity::JoulePerKelvin     },
-    {"kg*m^2/s^2/K",   Unit::HeatCapacity::JoulePerKelvin     },
-    {"kg·m2/s2/K",     Unit::HeatCapacity::JoulePerKelvin     },
-    {"kg*m2/s2/K",     Unit::HeatCapacity::JoulePerKelvin     },
-    {"kg·m^2/(s^2·K)", Unit::HeatCapacity::JoulePerKelvin     },
-    {"kg*m^2/(s^2*K)", Unit::HeatCapacity::JoulePerKelvin     },
-    {"kg·m2/(s2·K)",   Unit::HeatCapacity::JoulePerKelvin     },
-    {"kg*m2/(s2*K)",   Unit::HeatCapacity::JoulePerKelvin     },
-    {"nJ/K",           Unit::HeatCapacity::NanojoulePerKelvin },
-    {"μN·mm/K",        Unit::HeatCapacity::NanojoulePerKelvin },
-    {"μN*mm/K",        Unit::HeatCapacity::NanojoulePerKelvin },
-    {"uN·mm/K",        Unit::HeatCapacity::NanojoulePerKelvin },
-    {"uN*mm/K",        Unit::HeatCapacity::NanojoulePerKelvin },
-    {"g·mm^2/s^2/K",   Unit::HeatCapacity::NanojoulePerKelvin },
-    {"g*mm^2/s^2/K",   Unit::HeatCapacity::NanojoulePerKelvin },
-    {"g·mm2/s2/K",     Unit::HeatCapacity::NanojoulePerKelvin },
-    {"g*mm2/s2/K",     Unit::HeatCapacity::NanojoulePerKelvin },
-    {"g·mm^2/(s^2·K)", Unit::HeatCapacity::NanojoulePerKelvin },
-    {"g*mm^2/(s^2*K)", Unit::HeatCapacity::NanojoulePerKelvin },
-    {"g·mm2/(s2·K)",   Unit::HeatCapacity::NanojoulePerKelvin },
-    {"g*mm2/(s2*K)",   Unit::HeatCapacity::NanojoulePerKelvin },
-    {"ft·lbf/°R",      Unit::HeatCapacity::FootPoundPerRankine},
-    {"ft·lbf/R",       Unit::HeatCapacity::FootPoundPerRankine},
-    {"ft*lbf/°R",      Unit::HeatCapacity::FootPoundPerRankine},
-    {"ft*lbf/R",       Unit::HeatCapacity::FootPoundPerRankine},
-    {"ft·lb/°R",       Unit::HeatCapacity::FootPoundPerRankine},
-    {"ft·lb/R",        Unit::HeatCapacity::FootPoundPerRankine},
-    {"ft*lb/°R",       Unit::HeatCapacity::FootPoundPerRankine},
-    {"ft*lb/R",        Unit::HeatCapacity::FootPoundPerRankine},
-    {"in·lbf/°R",      Unit::HeatCapacity::InchPoundPerRankine},
-    {"in·lbf/R",       Unit::HeatCapacity::InchPoundPerRankine},
-    {"in*lbf/°R",      Unit::HeatCapacity::InchPoundPerRankine},
-    {"in*lbf/R",       Unit::HeatCapacity::InchPoundPerRankine},
-    {"in·lb/°R",       Unit::HeatCapacity::InchPoundPerRankine},
-    {"in·lb/R",        Unit::HeatCapacity::InchPoundPerRankine},
-    {"in*lb/°R",       Unit::HeatCapacity::InchPoundPerRankine},
-    {"in*lb/R",        Unit::HeatCapacity::InchPoundPerRankine},
-};
+inline constexpr std::array<std::pair<std::string_view, Unit::HeatCapacity>, 40>
+    Spellings<Unit::HeatCapacity>{{
+        {"J/K",            Unit::HeatCapacity::JoulePerKelvin     },
+        {"N*m/K",          Unit::HeatCapacity::JoulePerKelvin     },
+        {"N·m/K",          Unit::HeatCapacity::JoulePerKelvin     },
+        {"ft*lb/R",        Unit::HeatCapacity::FootPoundPerRankine},
+        {"ft*lb/°R",       Unit::HeatCapacity::FootPoundPerRankine},
+        {"ft*lbf/R",       Unit::HeatCapacity::FootPoundPerRankine},
+        {"ft*lbf/°R",      Unit::HeatCapacity::FootPoundPerRankine},
+        {"ft·lb/R",        Unit::HeatCapacity::FootPoundPerRankine},
+        {"ft·lb/°R",       Unit::HeatCapacity::FootPoundPerRankine},
+        {"ft·lbf/R",       Unit::HeatCapacity::FootPoundPerRankine},
+        {"ft·lbf/°R",      Unit::HeatCapacity::FootPoundPerRankine},
+        {"g*mm2/(s2*K)",   Unit::HeatCapacity::NanojoulePerKelvin },
+        {"g*mm2/s2/K",     Unit::HeatCapacity::NanojoulePerKelvin },
+        {"g*mm^2/(s^2*K)", Unit::HeatCapacity::NanojoulePerKelvin },
+        {"g*mm^2/s^2/K",   Unit::HeatCapacity::NanojoulePerKelvin },
+        {"g·mm2/(s2·K)",   Unit::HeatCapacity::NanojoulePerKelvin },
+        {"g·mm2/s2/K",     Unit::HeatCapacity::NanojoulePerKelvin },
+        {"g·mm^2/(s^2·K)", Unit::HeatCapacity::NanojoulePerKelvin },
+        {"g·mm^2/s^2/K",   Unit::HeatCapacity::NanojoulePerKelvin },
+        {"in*lb/R",        Unit::HeatCapacity::InchPoundPerRankine},
+        {"in*lb/°R",       Unit::HeatCapacity::InchPoundPerRankine},
+        {"in*lbf/R",       Unit::HeatCapacity::InchPoundPerRankine},
+        {"in*lbf/°R",      Unit::HeatCapacity::InchPoundPerRankine},
+        {"in·lb/R",        Unit::HeatCapacity::InchPoundPerRankine},
+        {"in·lb/°R",       Unit::HeatCapacity::InchPoundPerRankine},
+        {"in·lbf/R",       Unit::HeatCapacity::InchPoundPerRankine},
+        {"in·lbf/°R",      Unit::HeatCapacity::InchPoundPerRankine},
+        {"kg*m2/(s2*K)",   Unit::HeatCapacity::JoulePerKelvin     },
+        {"kg*m2/s2/K",     Unit::HeatCapacity::JoulePerKelvin     },
+        {"kg*m^2/(s^2*K)", Unit::HeatCapacity::JoulePerKelvin     },
+        {"kg*m^2/s^2/K",   Unit::HeatCapacity::JoulePerKelvin     },
+        {"kg·m2/(s2·K)",   Unit::HeatCapacity::JoulePerKelvin     },
+        {"kg·m2/s2/K",     Unit::HeatCapacity::JoulePerKelvin     },
+        {"kg·m^2/(s^2·K)", Unit::HeatCapacity::JoulePerKelvin     },
+        {"kg·m^2/s^2/K",   Unit::HeatCapacity::JoulePerKelvin     },
+        {"nJ/K",           Unit::HeatCapacity::NanojoulePerKelvin },
+        {"uN*mm/K",        Unit::HeatCapacity::NanojoulePerKelvin },
+        {"uN·mm/K",        Unit::HeatCapacity::NanojoulePerKelvin },
+        {"μN*mm/K",        Unit::HeatCapacity::NanojoulePerKelvin },
+        {"μN·mm/K",        Unit::HeatCapacity::NanojoulePerKelvin },
+}};
 
 // clang-format on
 
@@ -222,41 +225,8 @@ Conversion<Unit::HeatCapacity, Unit::HeatCapacity::InchPoundPerRankine>::ToStand
            * static_cast<NumericType>(9.80665L) * static_cast<NumericType>(1.8L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::HeatCapacity,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::HeatCapacity, NumericType>{
-        {Unit::HeatCapacity::JoulePerKelvin,
-         Conversions<Unit::HeatCapacity,
-         Unit::HeatCapacity::JoulePerKelvin>::FromStandard<NumericType>     },
-        {Unit::HeatCapacity::NanojoulePerKelvin,
-         Conversions<Unit::HeatCapacity,
-         Unit::HeatCapacity::NanojoulePerKelvin>::FromStandard<NumericType> },
-        {Unit::HeatCapacity::FootPoundPerRankine,
-         Conversions<Unit::HeatCapacity,
-         Unit::HeatCapacity::FootPoundPerRankine>::FromStandard<NumericType>},
-        {Unit::HeatCapacity::InchPoundPerRankine,
-         Conversions<Unit::HeatCapacity,
-         Unit::HeatCapacity::InchPoundPerRankine>::FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::HeatCapacity,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::HeatCapacity, NumericType>{
-        {Unit::HeatCapacity::JoulePerKelvin,
-         Conversions<Unit::HeatCapacity,
-         Unit::HeatCapacity::JoulePerKelvin>::ToStandard<NumericType>     },
-        {Unit::HeatCapacity::NanojoulePerKelvin,
-         Conversions<Unit::HeatCapacity,
-         Unit::HeatCapacity::NanojoulePerKelvin>::ToStandard<NumericType> },
-        {Unit::HeatCapacity::FootPoundPerRankine,
-         Conversions<Unit::HeatCapacity,
-         Unit::HeatCapacity::FootPoundPerRankine>::ToStandard<NumericType>},
-        {Unit::HeatCapacity::InchPoundPerRankine,
-         Conversions<Unit::HeatCapacity,
-         Unit::HeatCapacity::InchPoundPerRankine>::ToStandard<NumericType>},
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::HeatCapacity>{4};
 
 }  // namespace Internal
 
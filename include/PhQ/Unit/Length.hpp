@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_LENGTH_HPP
 #define PHQ_UNIT_LENGTH_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -113,105 +112,107 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Length unit) {
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::Length> ConsistentUnits<Unit::Length>{
+inline constexpr std::array<std::pair<UnitSystem, Unit::Length>, 4> ConsistentUnits<Unit::Length>{{
     {UnitSystem::MetreKilogramSecondKelvin,  Unit::Length::Metre     },
     {UnitSystem::MillimetreGramSecondKelvin, Unit::Length::Millimetre},
     {UnitSystem::FootPoundSecondRankine,     Unit::Length::Foot      },
     {UnitSystem::InchPoundSecondRankine,     Unit::Length::Inch      },
-};
+}};
 
 template <>
-inline const std::map<Unit::Length, UnitSystem> RelatedUnitSystems<Unit::Length>{
-    {Unit::Length::Metre,      UnitSystem::MetreKilogramSecondKelvin },
-    {Unit::Length::Millimetre, UnitSystem::MillimetreGramSecondKelvin},
-    {Unit::Length::Foot,       UnitSystem::FootPoundSecondRankine    },
-    {Unit::Length::Inch,       UnitSystem::InchPoundSecondRankine    },
-};
+inline constexpr std::array<std::pair<Unit::Length, UnitSystem>, 4>
+    RelatedUnitSystems<Unit::Length>{{
+        {Unit::Length::Metre,      UnitSystem::MetreKilogramSecondKelvin },
+        {Unit::Length::Foot,       UnitSystem::FootPoundSecondRankine    },
+        {Unit::Length::Inch,       UnitSystem::InchPoundSecondRankine    },
+        {Unit::Length::Millimetre, UnitSystem::MillimetreGramSecondKelvin},
+}};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::Length, std::string_view> Abbreviations<Unit::Length>{
-    {Unit::Length::NauticalMile, "nmi"},
-    {Unit::Length::Mile,         "mi" },
-    {Unit::Length::Kilometre,    "km" },
-    {Unit::Length::Metre,        "m"  },
-    {Unit::Length::Yard,         "yd" },
-    {Unit::Length::Foot,         "ft" },
-    {Unit::Length::Decimetre,    "dm" },
-    {Unit::Length::Inch,         "in" },
-    {Unit::Length::Centimetre,   "cm" },
-    {Unit::Length::Millimetre,   "mm" },
-    {Unit::Length::Milliinch,    "mil"},
-    {Unit::Length::Micrometre,   "μm" },
-    {Unit::Length::Microinch,    "μin"},
-};
-
-template <>
-inline const std::unordered_map<std::string_view, Unit::Length> Spellings<Unit::Length>{
-    {"nmi",            Unit::Length::NauticalMile},
+inline constexpr std::array<std::pair<Unit::Length, std::string_view>, 13>
+    Abbreviations<Unit::Length>{{
+        {Unit::Length::NauticalMile, "nmi"},
+        {Unit::Length::Mile,         "mi" },
+        {Unit::Length::Kilometre,    "km" },
+        {Unit::Length::Metre,        "m"  },
+        {Unit::Length::Yard,         "yd" },
+        {Unit::Length::Foot,         "ft" },
+        {Unit::Length::Decimetre,    "dm" },
+        {Unit::Length::Inch,         "in" },
+        {Unit::Length::Centimetre,   "cm" },
+        {Unit::Length::Millimetre,   "mm" },
+        {Unit::Length::Milliinch,    "mil"},
+        {Unit::Length::Micrometre,   "μm" },
+        {Unit::Length::Microinch,    "μin"},
+}};
+
+template <>
+inline constexpr std::array<std::pair<std::string_view, Unit::Length>, 62> Spellings<Unit::Length>{{
+    {"Micrometre",     Unit::Length::Micrometre  },
+    {"Micrometres",    Unit::Length::Micrometre  },
     {"NM",             Unit::Length::NauticalMile},
-    {"nautical mile",  Unit::Length::NauticalMile},
-    {"nautical miles", Unit::Length::NauticalMile},
-    {"mi",             Unit::Length::Mile        },
-    {"mile",           Unit::Length::Mile        },
-    {"miles",          Unit::Length::Mile        },
-    {"km",             Unit::Length::Kilometre   },
+    {"centimeter",     Unit::Length::Centimetre  },
+    {"centimeters",    Unit::Length::Centimetre  },
+    {"centimetre",     Unit::Length::Centimetre  },
+    {"centimetres",    Unit::Length::Centimetre  },
+    {"cm",             Unit::Length::Centimetre  },
+    {"decimeter",      Unit::Length::Decimetre   },
+    {"decimeters",     Unit::Length::Decimetre   },
+    {"decimetre",      Unit::Length::Decimetre   },
+    {"decimetres",     Unit::Length::Decimetre   },
+    {"dm",             Unit::Length::Decimetre   },
+    {"feet",           Unit::Length::Foot        },
+    {"foot",           Unit::Length::Foot        },
+    {"ft",             Unit::Length::Foot        },
+    {"in",             Unit::Length::Inch        },
+    {"inch",           Unit::Length::Inch        },
+    {"inches",         Unit::Length::Inch        },
     {"kilometer",      Unit::Length::Kilometre   },
     {"kilometers",     Unit::Length::Kilometre   },
     {"kilometre",      Unit::Length::Kilometre   },
     {"kilometres",     Unit::Length::Kilometre   },
+    {"km",             Unit::Length::Kilometre   },
     {"m",              Unit::Length::Metre       },
     {"meter",          Unit::Length::Metre       },
     {"meters",         Unit::Length::Metre       },
     {"metre",          Unit::Length::Metre       },
     {"metres",         Unit::Length::Metre       },
-    {"yd",             Unit::Length::Yard        },
-    {"yard",           Unit::Length::Yard        },
-    {"yards",          Unit::Length::Yard        },
-    {"ft",             Unit::Length::Foot        },
-    {"foot",           Unit::Length::Foot        },
-    {"feet",           Unit::Length::Foot        },
-    {"dm",             Unit::Length::Decimetre   },
-    {"decimeter",      Unit::Length::Decimetre   },
-    {"decimeters",     Unit::Length::Decimetre   },
-    {"decimetre",      Unit::Length::Decimetre   },
-    {"decimetres",     Unit::Length::Decimetre   },
-    {"in",             Unit::Length::Inch        },
-    {"inch",           Unit::Length::Inch        },
-    {"inches",         Unit::Length::Inch        },
-    {"cm",             Unit::Length::Centimetre  },
-    {"centimeter",     Unit::Length::Centimetre  },
-    {"centimeters",    Unit::Length::Centimetre  },
-    {"centimetre",     Unit::Length::Centimetre  },
-    {"centimetres",    Unit::Length::Centimetre  },
-    {"mm",             Unit::Length::Millimetre  },
+    {"mi",             Unit::Length::Mile        },
+    {"microinch",      Unit::Length::Microinch   },
+    {"microinches",    Unit::Length::Microinch   },
+    {"micrometer",     Unit::Length::Micrometre  },
+    {"micrometers",    Unit::Length::Micrometre  },
+    {"micron",         Unit::Length::Micrometre  },
+    {"microns",        Unit::Length::Micrometre  },
+    {"mil",            Unit::Length::Milliinch   },
+    {"mile",           Unit::Length::Mile        },
+    {"miles",          Unit::Length::Mile        },
+    {"milin",          Unit::Length::Milliinch   },
+    {"milliinch",      Unit::Length::Milliinch   },
+    {"milliinches",    Unit::Length::Milliinch   },
     {"millimeter",     Unit::Length::Millimetre  },
     {"millimeters",    Unit::Length::Millimetre  },
     {"millimetre",     Unit::Length::Millimetre  },
     {"millimetres",    Unit::Length::Millimetre  },
-    {"milin",          Unit::Length::Milliinch   },
-    {"milliinch",      Unit::Length::Milliinch   },
-    {"milliinches",    Unit::Length::Milliinch   },
-    {"mil",            Unit::Length::Milliinch   },
     {"mils",           Unit::Length::Milliinch   },
+    {"mm",             Unit::Length::Millimetre  },
+    {"nautical mile",  Unit::Length::NauticalMile},
+    {"nautical miles", Unit::Length::NauticalMile},
+    {"nmi",            Unit::Length::NauticalMile},
     {"thou",           Unit::Length::Milliinch   },
     {"thous",          Unit::Length::Milliinch   },
     {"thousandth",     Unit::Length::Milliinch   },
     {"thousandths",    Unit::Length::Milliinch   },
-    {"μm",             Unit::Length::Micrometre  },
+    {"uin",            Unit::Length::Microinch   },
     {"um",             Unit::Length::Micrometre  },
-    {"micrometer",     Unit::Length::Micrometre  },
-    {"micrometers",    Unit::Length::Micrometre  },
-    {"Micrometre",     Unit::Length::Micrometre  },
-    {"Micrometres",    Unit::Length::Micrometre  },
-    {"micron",         Unit::Length::Micrometre  },
-    {"microns",        Unit::Length::Micrometre  },
+    {"yard",           Unit::Length::Yard        },
+    {"yards",          Unit::Length::Yard        },
+    {"yd",             Unit::Length::Yard        },
     {"μin",            Unit::Length::Microinch   },
-    {"uin",            Unit::Length::Microinch   },
-    {"microinch",      Unit::Length::Microinch   },
-    {"microinches",    Unit::Length::Microinch   },
-};
+    {"μm",             Unit::Length::Micrometre  },
+}};
 
 // clang-format on
 
@@ -393,69 +394,8 @@ inline constexpr void Conversion<Unit::Length, Unit::Length::Microinch>::ToStand
   value *= static_cast<NumericType>(0.0000000254L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::Length,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Length, NumericType>{
-        {Unit::Length::NauticalMile,
-         Conversions<Unit::Length, Unit::Length::NauticalMile>::FromStandard<NumericType>},
-        {Unit::Length::Mile,
-         Conversions<Unit::Length, Unit::Length::Mile>::FromStandard<NumericType>        },
-        {Unit::Length::Kilometre,
-         Conversions<Unit::Length, Unit::Length::Kilometre>::FromStandard<NumericType>   },
-        {Unit::Length::Metre,
-         Conversions<Unit::Length, Unit::Length::Metre>::FromStandard<NumericType>       },
-        {Unit::Length::Yard,
-         Conversions<Unit::Length, Unit::Length::Yard>::FromStandard<NumericType>        },
-        {Unit::Length::Foot,
-         Conversions<Unit::Length, Unit::Length::Foot>::FromStandard<NumericType>        },
-        {Unit::Length::Decimetre,
-         Conversions<Unit::Length, Unit::Length::Decimetre>::FromStandard<NumericType>   },
-        {Unit::Length::Inch,
-         Conversions<Unit::Length, Unit::Length::Inch>::FromStandard<NumericType>        },
-        {Unit::Length::Centimetre,
-         Conversions<Unit::Length, Unit::Length::Centimetre>::FromStandard<NumericType>  },
-        {Unit::Length::Millimetre,
-         Conversions<Unit::Length, Unit::Length::Millimetre>::FromStandard<NumericType>  },
-        {Unit::Length::Milliinch,
-         Conversions<Unit::Length, Unit::Length::Milliinch>::FromStandard<NumericType>   },
-        {Unit::Length::Micrometre,
-         Conversions<Unit::Length, Unit::Length::Micrometre>::FromStandard<NumericType>  },
-        {Unit::Length::Microinch,
-         Conversions<Unit::Length, Unit::Length::Microinch>::FromStandard<NumericType>   },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Length,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Length, NumericType>{
-        {Unit::Length::NauticalMile,
-         Conversions<Unit::Length, Unit::Length::NauticalMile>::ToStandard<NumericType>},
-        {Unit::Length::Mile,
-         Conversions<Unit::Length, Unit::Length::Mile>::ToStandard<NumericType>        },
-        {Unit::Length::Kilometre,
-         Conversions<Unit::Length, Unit::Length::Kilometre>::ToStandard<NumericType>   },
-        {Unit::Length::Metre,
-         Conversions<Unit::Length, Unit::Length::Metre>::ToStandard<NumericType>       },
-        {Unit::Length::Yard,
-         Conversions<Unit::Length, Unit::Length::Yard>::ToStandard<NumericType>        },
-        {Unit::Length::Foot,
-         Conversions<Unit::Length, Unit::Length::Foot>::ToStandard<NumericType>        },
-        {Unit::Length::Decimetre,
-         Conversions<Unit::Length, Unit::Length::Decimetre>::ToStandard<NumericType>   },
-        {Unit::Length::Inch,
-         Conversions<Unit::Length, Unit::Length::Inch>::ToStandard<NumericType>        },
-        {Unit::Length::Centimetre,
-         Conversions<Unit::Length, Unit::Length::Centimetre>::ToStandard<NumericType>  },
-        {Unit::Length::Millimetre,
-         Conversions<Unit::Length, Unit::Length::Millimetre>::ToStandard<NumericType>  },
-        {Unit::Length::Milliinch,
-         Conversions<Unit::Length, Unit::Length::Milliinch>::ToStandard<NumericType>   },
-        {Unit::Length::Micrometre,
-         Conversions<Unit::Length, Unit::Length::Micrometre>::ToStandard<NumericType>  },
-        {Unit::Length::Microinch,
-         Conversions<Unit::Length, Unit::Length::Microinch>::ToStandard<NumericType>   },
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Length>{13};
 
 }  // namespace Internal
 
@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_MASS_HPP
 #define PHQ_UNIT_MASS_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -89,39 +88,39 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Mass unit) {
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::Mass> ConsistentUnits<Unit::Mass>{
+inline constexpr std::array<std::pair<UnitSystem, Unit::Mass>, 4> ConsistentUnits<Unit::Mass>{{
     {UnitSystem::MetreKilogramSecondKelvin,  Unit::Mass::Kilogram},
     {UnitSystem::MillimetreGramSecondKelvin, Unit::Mass::Gram    },
     {UnitSystem::FootPoundSecondRankine,     Unit::Mass::Slug    },
     {UnitSystem::InchPoundSecondRankine,     Unit::Mass::Slinch  },
-};
+}};
 
 template <>
-inline const std::map<Unit::Mass, UnitSystem> RelatedUnitSystems<Unit::Mass>{
+inline constexpr std::array<std::pair<Unit::Mass, UnitSystem>, 4> RelatedUnitSystems<Unit::Mass>{{
     {Unit::Mass::Kilogram, UnitSystem::MetreKilogramSecondKelvin },
     {Unit::Mass::Gram,     UnitSystem::MillimetreGramSecondKelvin},
     {Unit::Mass::Slug,     UnitSystem::FootPoundSecondRankine    },
     {Unit::Mass::Slinch,   UnitSystem::InchPoundSecondRankine    },
-};
+}};
 
 template <>
-inline const std::map<Unit::Mass, std::string_view> Abbreviations<Unit::Mass>{
+inline constexpr std::array<std::pair<Unit::Mass, std::string_view>, 5> Abbreviations<Unit::Mass>{{
     {Unit::Mass::Kilogram, "kg"    },
     {Unit::Mass::Gram,     "g"     },
     {Unit::Mass::Slug,     "slug"  },
     {Unit::Mass::Slinch,   "slinch"},
     {Unit::Mass::Pound,    "lbm"   },
-};
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Mass> Spellings<Unit::Mass>{
-    {"kg",     Unit::Mass::Kilogram},
+inline constexpr std::array<std::pair<std::string_view, Unit::Mass>, 6> Spellings<Unit::Mass>{{
     {"g",      Unit::Mass::Gram    },
-    {"slug",   Unit::Mass::Slug    },
-    {"slinch", Unit::Mass::Slinch  },
-    {"lbm",    Unit::Mass::Pound   },
+    {"kg",     Unit::Mass::Kilogram},
     {"lb",     Unit::Mass::Pound   },
-};
+    {"lbm",    Unit::Mass::Pound   },
+    {"slinch", Unit::Mass::Slinch  },
+    {"slug",   Unit::Mass::Slug    },
+}};
 
 template <>
 template <typename NumericType>
@@ -193,29 +192,8 @@ inline constexpr void Conversion<Unit::Mass, Unit::Mass::Pound>::ToStandard(
   value *= static_cast<NumericType>(0.45359237L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::Mass, std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Mass, NumericType>{
-        {Unit::Mass::Kilogram,
-         Conversions<Unit::Mass,                       Unit::Mass::Kilogram>::FromStandard<NumericType>},
-        {Unit::Mass::Gram,     Conversions<Unit::Mass, Unit::Mass::Gram>::FromStandard<NumericType>    },
-        {Unit::Mass::Slug,     Conversions<Unit::Mass, Unit::Mass::Slug>::FromStandard<NumericType>    },
-        {Unit::Mass::Slinch,
-         Conversions<Unit::Mass,                       Unit::Mass::Slinch>::FromStandard<NumericType>  },
-        {Unit::Mass::Pound,    Conversions<Unit::Mass, Unit::Mass::Pound>::FromStandard<NumericType>   },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Mass,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Mass, NumericType>{
-        {Unit::Mass::Kilogram,
-         Conversions<Unit::Mass,                       Unit::Mass::Kilogram>::ToStandard<NumericType>},
-        {Unit::Mass::Gram,     Conversions<Unit::Mass, Unit::Mass::Gram>::ToStandard<NumericType>    },
-        {Unit::Mass::Slug,     Conversions<Unit::Mass, Unit::Mass::Slug>::ToStandard<NumericType>    },
-        {Unit::Mass::Slinch,   Conversions<Unit::Mass, Unit::Mass::Slinch>::ToStandard<NumericType>  },
-        {Unit::Mass::Pound,    Conversions<Unit::Mass, Unit::Mass::Pound>::ToStandard<NumericType>   },
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Mass>{5};
 
 }  // namespace Internal
 
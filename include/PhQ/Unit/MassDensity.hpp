@@ -25,14 +25,12 @@
 #ifndef PHQ_UNIT_MASS_DENSITY_HPP
 #define PHQ_UNIT_MASS_DENSITY_HPP
 
-#include <cmath>
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -94,58 +92,62 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::MassDensity un
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::MassDensity> ConsistentUnits<Unit::MassDensity>{
-    {UnitSystem::MetreKilogramSecondKelvin,  Unit::MassDensity::KilogramPerCubicMetre },
-    {UnitSystem::MillimetreGramSecondKelvin, Unit::MassDensity::GramPerCubicMillimetre},
-    {UnitSystem::FootPoundSecondRankine,     Unit::MassDensity::SlugPerCubicFoot      },
-    {UnitSystem::InchPoundSecondRankine,     Unit::MassDensity::SlinchPerCubicInch    },
-};
+inline constexpr std::array<std::pair<UnitSystem, Unit::MassDensity>, 4>
+    ConsistentUnits<Unit::MassDensity>{{
+        {UnitSystem::MetreKilogramSecondKelvin,  Unit::MassDensity::KilogramPerCubicMetre },
+        {UnitSystem::MillimetreGramSecondKelvin, Unit::MassDensity::GramPerCubicMillimetre},
+        {UnitSystem::FootPoundSecondRankine,     Unit::MassDensity::SlugPerCubicFoot      },
+        {UnitSystem::InchPoundSecondRankine,     Unit::MassDensity::SlinchPerCubicInch    },
+}};
 
 template <>
-inline const std::map<Unit::MassDensity, UnitSystem> RelatedUnitSystems<Unit::MassDensity>{
-    {Unit::MassDensity::KilogramPerCubicMetre,  UnitSystem::MetreKilogramSecondKelvin },
-    {Unit::MassDensity::GramPerCubicMillimetre, UnitSystem::MillimetreGramSecondKelvin},
-    {Unit::MassDensity::SlugPerCubicFoot,       UnitSystem::FootPoundSecondRankine    },
-    {Unit::MassDensity::SlinchPerCubicInch,     UnitSystem::InchPoundSecondRankine    },
-};
+inline constexpr std::array<std::pair<Unit::MassDensity, UnitSystem>, 4>
+    RelatedUnitSystems<Unit::MassDensity>{{
+        {Unit::MassDensity::KilogramPerCubicMetre,  UnitSystem::MetreKilogramSecondKelvin },
+        {Unit::MassDensity::GramPerCubicMillimetre, UnitSystem::MillimetreGramSecondKelvin},
+        {Unit::MassDensity::SlugPerCubicFoot,       UnitSystem::FootPoundSecondRankine    },
+        {Unit::MassDensity::SlinchPerCubicInch,     UnitSystem::InchPoundSecondRankine    },
+}};
 
 template <>
-inline const std::map<Unit::MassDensity, std::string_view> Abbreviations<Unit::MassDensity>{
-    {Unit::MassDensity::KilogramPerCubicMetre,  "kg/m^3"     },
-    {Unit::MassDensity::GramPerCubicMillimetre, "g/mm^3"     },
-    {Unit::MassDensity::SlugPerCubicFoot,       "slug/ft^3"  },
-    {Unit::MassDensity::SlinchPerCubicInch,     "slinch/in^3"},
-    {Unit::MassDensity::PoundPerCubicFoot,      "lbm/ft^3"   },
-    {Unit::MassDensity::PoundPerCubicInch,      "lbm/in^3"   },
-};
+inline constexpr std::array<std::pair<Unit::MassDensity, std::string_view>, 6>
+    Abbreviations<Unit::MassDensity>{{
+        {Unit::MassDensity::KilogramPerCubicMetre,  "kg/m^3"     },
+        {Unit::MassDensity::GramPerCubicMillimetre, "g/mm^3"     },
+        {Unit::MassDensity::SlugPerCubicFoot,       "slug/ft^3"  },
+        {Unit::MassDensity::SlinchPerCubicInch,     "slinch/in^3"},
+        {Unit::MassDensity::PoundPerCubicFoot,      "lbm/ft^3"   },
+        {Unit::MassDensity::PoundPerCubicInch,      "lbm/in^3"   },
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::MassDensity> Spellings<Unit::MassDensity>{
-    {"kg/m^3",          Unit::MassDensity::KilogramPerCubicMetre },
-    {"kg/m3",           Unit::MassDensity::KilogramPerCubicMetre },
-    {"kg/m/m/m",        Unit::MassDensity::KilogramPerCubicMetre },
-    {"g/mm^3",          Unit::MassDensity::GramPerCubicMillimetre},
-    {"g/mm3",           Unit::MassDensity::GramPerCubicMillimetre},
-    {"g/mm/mm/mm",      Unit::MassDensity::GramPerCubicMillimetre},
-    {"slug/ft^3",       Unit::MassDensity::SlugPerCubicFoot      },
-    {"slug/ft3",        Unit::MassDensity::SlugPerCubicFoot      },
-    {"slug/ft/ft/ft",   Unit::MassDensity::SlugPerCubicFoot      },
-    {"slinch/in^3",     Unit::MassDensity::SlinchPerCubicInch    },
-    {"slinch/in3",      Unit::MassDensity::SlinchPerCubicInch    },
-    {"slinch/in/in/in", Unit::MassDensity::SlinchPerCubicInch    },
-    {"lbm/ft^3",        Unit::MassDensity::PoundPerCubicFoot     },
-    {"lbm/ft3",         Unit::MassDensity::PoundPerCubicFoot     },
-    {"lbm/ft/ft/ft",    Unit::MassDensity::PoundPerCubicFoot     },
-    {"lb/ft^3",         Unit::MassDensity::PoundPerCubicFoot     },
-    {"lb/ft3",          Unit::MassDensity::PoundPerCubicFoot     },
-    {"lb/ft/ft/ft",     Unit::MassDensity::PoundPerCubicFoot     },
-    {"lbm/in^3",        Unit::MassDensity::PoundPerCubicInch     },
-    {"lbm/in3",         Unit::MassDensity::PoundPerCubicInch     },
-    {"lbm/in/in/in",    Unit::MassDensity::PoundPerCubicInch     },
-    {"lb/in^3",         Unit::MassDensity::PoundPerCubicInch     },
-    {"lb/in3",          Unit::MassDensity::PoundPerCubicInch     },
-    {"lb/in/in/in",     Unit::MassDensity::PoundPerCubicInch     },
-};
+inline constexpr std::array<std::pair<std::string_view, Unit::MassDensity>, 24>
+    Spellings<Unit::MassDensity>{{
+        {"g/mm/mm/mm",      Unit::MassDensity::GramPerCubicMillimetre},
+        {"g/mm3",           Unit::MassDensity::GramPerCubicMillimetre},
+        {"g/mm^3",          Unit::MassDensity::GramPerCubicMillimetre},
+        {"kg/m/m/m",        Unit::MassDensity::KilogramPerCubicMetre },
+        {"kg/m3",           Unit::MassDensity::KilogramPerCubicMetre },
+        {"kg/m^3",          Unit::MassDensity::KilogramPerCubicMetre },
+        {"lb/ft/ft/ft",     Unit::MassDensity::PoundPerCubicFoot     },
+        {"lb/ft3",          Unit::MassDensity::PoundPerCubicFoot     },
+        {"lb/ft^3",         Unit::MassDensity::PoundPerCubicFoot     },
+        {"lb/in/in/in",     Unit::MassDensity::PoundPerCubicInch     },
+        {"lb/in3",          Unit::MassDensity::PoundPerCubicInch     },
+        {"lb/in^3",         Unit::MassDensity::PoundPerCubicInch     },
+        {"lbm/ft/ft/ft",    Unit::MassDensity::PoundPerCubicFoot     },
+        {"lbm/ft3",         Unit::MassDensity::PoundPerCubicFoot     },
+        {"lbm/ft^3",        Unit::MassDensity::PoundPerCubicFoot     },
+        {"lbm/in/in/in",    Unit::MassDensity::PoundPerCubicInch     },
+        {"lbm/in3",         Unit::MassDensity::PoundPerCubicInch     },
+        {"lbm/in^3",        Unit::MassDensity::PoundPerCubicInch     },
+        {"slinch/in/in/in", Unit::MassDensity::SlinchPerCubicInch    },
+        {"slinch/in3",      Unit::MassDensity::SlinchPerCubicInch    },
+        {"slinch/in^3",     Unit::MassDensity::SlinchPerCubicInch    },
+        {"slug/ft/ft/ft",   Unit::MassDensity::SlugPerCubicFoot      },
+        {"slug/ft3",        Unit::MassDensity::SlugPerCubicFoot      },
+        {"slug/ft^3",       Unit::MassDensity::SlugPerCubicFoot      },
+}};
 
 template <>
 template <typename NumericType>
@@ -191,7 +193,8 @@ inline constexpr void
 Conversion<Unit::MassDensity, Unit::MassDensity::SlugPerCubicFoot>::ToStandard(
     NumericType& value) noexcept {
   value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
-           / std::pow(static_cast<NumericType>(0.3048L), 4);
+           / (static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
+              * static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L));
 }
 
 template <>
@@ -210,7 +213,8 @@ inline constexpr void
 Conversion<Unit::MassDensity, Unit::MassDensity::SlinchPerCubicInch>::ToStandard(
     NumericType& value) noexcept {
   value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L)
-           / std::pow(static_cast<NumericType>(0.0254L), 4);
+           / (static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
+              * static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L));
 }
 
 template <>
@@ -227,7 +231,9 @@ template <typename NumericType>
 inline constexpr void
 Conversion<Unit::MassDensity, Unit::MassDensity::PoundPerCubicFoot>::ToStandard(
     NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) / std::pow(static_cast<NumericType>(0.3048L), 3);
+  value *= static_cast<NumericType>(0.45359237L)
+           / (static_cast<NumericType>(0.3048L) * static_cast<NumericType>(0.3048L)
+              * static_cast<NumericType>(0.3048L));
 }
 
 template <>
@@ -244,56 +250,13 @@ template <typename NumericType>
 inline constexpr void
 Conversion<Unit::MassDensity, Unit::MassDensity::PoundPerCubicInch>::ToStandard(
     NumericType& value) noexcept {
-  value *= static_cast<NumericType>(0.45359237L) / std::pow(static_cast<NumericType>(0.0254L), 3);
+  value *= static_cast<NumericType>(0.45359237L)
+           / (static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L)
+              * static_cast<NumericType>(0.0254L));
 }
 
-template <typename NumericType>
-inline const std::map<Unit::MassDensity,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::MassDensity, NumericType>{
-        {Unit::MassDensity::KilogramPerCubicMetre,
-         Conversions<Unit::MassDensity,
-         Unit::MassDensity::KilogramPerCubicMetre>::FromStandard<NumericType> },
-        {Unit::MassDensity::GramPerCubicMillimetre,
-         Conversions<Unit::MassDensity,
-         Unit::MassDensity::GramPerCubicMillimetre>::FromStandard<NumericType>},
-        {Unit::MassDensity::SlugPerCubicFoot,
-         Conversions<Unit::MassDensity,
-         Unit::MassDensity::SlugPerCubicFoot>::FromStandard<NumericType>      },
-        {Unit::MassDensity::SlinchPerCubicInch,
-         Conversions<Unit::MassDensity,
-         Unit::MassDensity::SlinchPerCubicInch>::FromStandard<NumericType>    },
-        {Unit::MassDensity::PoundPerCubicFoot,
-         Conversions<Unit::MassDensity,
-         Unit::MassDensity::PoundPerCubicFoot>::FromStandard<NumericType>     },
-        {Unit::MassDensity::PoundPerCubicInch,
-         Conversions<Unit::MassDensity,
-         Unit::MassDensity::PoundPerCubicInch>::FromStandard<NumericType>     },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::MassDensity,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::MassDensity, NumericType>{
-        {Unit::MassDensity::KilogramPerCubicMetre,
-         Conversions<Unit::MassDensity,
-         Unit::MassDensity::KilogramPerCubicMetre>::ToStandard<NumericType> },
-        {Unit::MassDensity::GramPerCubicMillimetre,
-         Conversions<Unit::MassDensity,
-         Unit::MassDensity::GramPerCubicMillimetre>::ToStandard<NumericType>},
-        {Unit::MassDensity::SlugPerCubicFoot,
-         Conversions<Unit::MassDensity,
-         Unit::MassDensity::SlugPerCubicFoot>::ToStandard<NumericType>      },
-        {Unit::MassDensity::SlinchPerCubicInch,
-         Conversions<Unit::MassDensity,
-         Unit::MassDensity::SlinchPerCubicInch>::ToStandard<NumericType>    },
-        {Unit::MassDensity::PoundPerCubicFoot,
-         Conversions<Unit::MassDensity,
-         Unit::MassDensity::PoundPerCubicFoot>::ToStandard<NumericType>     },
-        {Unit::MassDensity::PoundPerCubicInch,
-         Conversions<Unit::MassDensity,
-         Unit::MassDensity::PoundPerCubicInch>::ToStandard<NumericType>     },
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::MassDensity>{6};
 
 }  // namespace Internal
 
@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_MASS_RATE_HPP
 #define PHQ_UNIT_MASS_RATE_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -119,61 +118,65 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::MassRate unit)
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::MassRate> ConsistentUnits<Unit::MassRate>{
-    {UnitSystem::MetreKilogramSecondKelvin,  Unit::MassRate::KilogramPerSecond},
-    {UnitSystem::MillimetreGramSecondKelvin, Unit::MassRate::GramPerSecond    },
-    {UnitSystem::FootPoundSecondRankine,     Unit::MassRate::SlugPerSecond    },
-    {UnitSystem::InchPoundSecondRankine,     Unit::MassRate::SlinchPerSecond  },
-};
-
-template <>
-inline const std::map<Unit::MassRate, UnitSystem> RelatedUnitSystems<Unit::MassRate>{
-    {Unit::MassRate::KilogramPerSecond, UnitSystem::MetreKilogramSecondKelvin },
-    {Unit::MassRate::GramPerSecond,     UnitSystem::MillimetreGramSecondKelvin},
-    {Unit::MassRate::SlugPerSecond,     UnitSystem::FootPoundSecondRankine    },
-    {Unit::MassRate::SlinchPerSecond,   UnitSystem::InchPoundSecondRankine    },
-};
-
-template <>
-inline const std::map<Unit::MassRate, std::string_view> Abbreviations<Unit::MassRate>{
-    {Unit::MassRate::KilogramPerSecond, "kg/s"      },
-    {Unit::MassRate::GramPerSecond,     "g/s"       },
-    {Unit::MassRate::SlugPerSecond,     "slug/s"    },
-    {Unit::MassRate::SlinchPerSecond,   "slinch/s"  },
-    {Unit::MassRate::PoundPerSecond,    "lbm/s"     },
-    {Unit::MassRate::KilogramPerMinute, "kg/min"    },
-    {Unit::MassRate::GramPerMinute,     "g/min"     },
-    {Unit::MassRate::SlugPerMinute,     "slug/min"  },
-    {Unit::MassRate::SlinchPerMinute,   "slinch/min"},
-    {Unit::MassRate::PoundPerMinute,    "lbm/min"   },
-    {Unit::MassRate::KilogramPerHour,   "kg/hr"     },
-    {Unit::MassRate::GramPerHour,       "g/hr"      },
-    {Unit::MassRate::SlugPerHour,       "slug/hr"   },
-    {Unit::MassRate::SlinchPerHour,     "slinch/hr" },
-    {Unit::MassRate::PoundPerHour,      "lbm/hr"    },
-};
-
-template <>
-inline const std::unordered_map<std::string_view, Unit::MassRate> Spellings<Unit::MassRate>{
-    {"kg/s",       Unit::MassRate::KilogramPerSecond},
-    {"g/s",        Unit::MassRate::GramPerSecond    },
-    {"slug/s",     Unit::MassRate::SlugPerSecond    },
-    {"slinch/s",   Unit::MassRate::SlinchPerSecond  },
-    {"lbm/s",      Unit::MassRate::PoundPerSecond   },
-    {"lb/s",       Unit::MassRate::PoundPerSecond   },
-    {"kg/min",     Unit::MassRate::KilogramPerMinute},
-    {"g/min",      Unit::MassRate::GramPerMinute    },
-    {"slug/min",   Unit::MassRate::SlugPerMinute    },
-    {"slinch/min", Unit::MassRate::SlinchPerMinute  },
-    {"lbm/min",    Unit::MassRate::PoundPerMinute   },
-    {"lb/min",     Unit::MassRate::PoundPerMinute   },
-    {"kg/hr",      Unit::MassRate::KilogramPerHour  },
-    {"g/hr",       Unit::MassRate::GramPerHour      },
-    {"slug/hr",    Unit::MassRate::SlugPerHour      },
-    {"slinch/hr",  Unit::MassRate::SlinchPerHour    },
-    {"lbm/hr",     Unit::MassRate::PoundPerHour     },
-    {"lb/hr",      Unit::MassRate::PoundPerHour     },
-};
+inline constexpr std::array<std::pair<UnitSystem, Unit::MassRate>, 4>
+    ConsistentUnits<Unit::MassRate>{{
+        {UnitSystem::MetreKilogramSecondKelvin,  Unit::MassRate::KilogramPerSecond},
+        {UnitSystem::MillimetreGramSecondKelvin, Unit::MassRate::GramPerSecond    },
+        {UnitSystem::FootPoundSecondRankine,     Unit::MassRate::SlugPerSecond    },
+        {UnitSystem::InchPoundSecondRankine,     Unit::MassRate::SlinchPerSecond  },
+}};
+
+template <>
+inline constexpr std::array<std::pair<Unit::MassRate, UnitSystem>, 4>
+    RelatedUnitSystems<Unit::MassRate>{{
+        {Unit::MassRate::KilogramPerSecond, UnitSystem::MetreKilogramSecondKelvin },
+        {Unit::MassRate::GramPerSecond,     UnitSystem::MillimetreGramSecondKelvin},
+        {Unit::MassRate::SlugPerSecond,     UnitSystem::FootPoundSecondRankine    },
+        {Unit::MassRate::SlinchPerSecond,   UnitSystem::InchPoundSecondRankine    },
+}};
+
+template <>
+inline constexpr std::array<std::pair<Unit::MassRate, std::string_view>, 15>
+    Abbreviations<Unit::MassRate>{{
+        {Unit::MassRate::KilogramPerSecond, "kg/s"      },
+        {Unit::MassRate::GramPerSecond,     "g/s"       },
+        {Unit::MassRate::SlugPerSecond,     "slug/s"    },
+        {Unit::MassRate::SlinchPerSecond,   "slinch/s"  },
+        {Unit::MassRate::PoundPerSecond,    "lbm/s"     },
+        {Unit::MassRate::KilogramPerMinute, "kg/min"    },
+        {Unit::MassRate::GramPerMinute,     "g/min"     },
+        {Unit::MassRate::SlugPerMinute,     "slug/min"  },
+        {Unit::MassRate::SlinchPerMinute,   "slinch/min"},
+        {Unit::MassRate::PoundPerMinute,    "lbm/min"   },
+        {Unit::MassRate::KilogramPerHour,   "kg/hr"     },
+        {Unit::MassRate::GramPerHour,       "g/hr"      },
+        {Unit::MassRate::SlugPerHour,       "slug/hr"   },
+        {Unit::MassRate::SlinchPerHour,     "slinch/hr" },
+        {Unit::MassRate::PoundPerHour,      "lbm/hr"    },
+}};
+
+template <>
+inline constexpr std::array<std::pair<std::string_view, Unit::MassRate>, 18>
+    Spellings<Unit::MassRate>{{
+        {"g/hr",       Unit::MassRate::GramPerHour      },
+        {"g/min",      Unit::MassRate::GramPerMinute    },
+        {"g/s",        Unit::MassRate::GramPerSecond    },
+        {"kg/hr",      Unit::MassRate::KilogramPerHour  },
+        {"kg/min",     Unit::MassRate::KilogramPerMinute},
+        {"kg/s",       Unit::MassRate::KilogramPerSecond},
+        {"lb/hr",      Unit::MassRate::PoundPerHour     },
+        {"lb/min",     Unit::MassRate::PoundPerMinute   },
+        {"lb/s",       Unit::MassRate::PoundPerSecond   },
+        {"lbm/hr",     Unit::MassRate::PoundPerHour     },
+        {"lbm/min",    Unit::MassRate::PoundPerMinute   },
+        {"lbm/s",      Unit::MassRate::PoundPerSecond   },
+        {"slinch/hr",  Unit::MassRate::SlinchPerHour    },
+        {"slinch/min", Unit::MassRate::SlinchPerMinute  },
+        {"slinch/s",   Unit::MassRate::SlinchPerSecond  },
+        {"slug/hr",    Unit::MassRate::SlugPerHour      },
+        {"slug/min",   Unit::MassRate::SlugPerMinute    },
+        {"slug/s",     Unit::MassRate::SlugPerSecond    },
+}};
 
 template <>
 template <typename NumericType>
@@ -393,77 +396,8 @@ inline constexpr void Conversion<Unit::MassRate, Unit::MassRate::PoundPerHour>::
   value *= static_cast<NumericType>(0.45359237L) / static_cast<NumericType>(3600.0L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::MassRate,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::MassRate, NumericType>{
-        {Unit::MassRate::KilogramPerSecond,
-         Conversions<Unit::MassRate, Unit::MassRate::KilogramPerSecond>::FromStandard<NumericType>},
-        {Unit::MassRate::GramPerSecond,
-         Conversions<Unit::MassRate, Unit::MassRate::GramPerSecond>::FromStandard<NumericType>    },
-        {Unit::MassRate::SlugPerSecond,
-         Conversions<Unit::MassRate, Unit::MassRate::SlugPerSecond>::FromStandard<NumericType>    },
-        {Unit::MassRate::SlinchPerSecond,
-         Conversions<Unit::MassRate, Unit::MassRate::SlinchPerSecond>::FromStandard<NumericType>  },
-        {Unit::MassRate::PoundPerSecond,
-         Conversions<Unit::MassRate, Unit::MassRate::PoundPerSecond>::FromStandard<NumericType>   },
-        {Unit::MassRate::KilogramPerMinute,
-         Conversions<Unit::MassRate, Unit::MassRate::KilogramPerMinute>::FromStandard<NumericType>},
-        {Unit::MassRate::GramPerMinute,
-         Conversions<Unit::MassRate, Unit::MassRate::GramPerMinute>::FromStandard<NumericType>    },
-        {Unit::MassRate::SlugPerMinute,
-         Conversions<Unit::MassRate, Unit::MassRate::SlugPerMinute>::FromStandard<NumericType>    },
-        {Unit::MassRate::SlinchPerMinute,
-         Conversions<Unit::MassRate, Unit::MassRate::SlinchPerMinute>::FromStandard<NumericType>  },
-        {Unit::MassRate::PoundPerMinute,
-         Conversions<Unit::MassRate, Unit::MassRate::PoundPerMinute>::FromStandard<NumericType>   },
-        {Unit::MassRate::KilogramPerHour,
-         Conversions<Unit::MassRate, Unit::MassRate::KilogramPerHour>::FromStandard<NumericType>  },
-        {Unit::MassRate::GramPerHour,
-         Conversions<Unit::MassRate, Unit::MassRate::GramPerHour>::FromStandard<NumericType>      },
-        {Unit::MassRate::SlugPerHour,
-         Conversions<Unit::MassRate, Unit::MassRate::SlugPerHour>::FromStandard<NumericType>      },
-        {Unit::MassRate::SlinchPerHour,
-         Conversions<Unit::MassRate, Unit::MassRate::SlinchPerHour>::FromStandard<NumericType>    },
-        {Unit::MassRate::PoundPerHour,
-         Conversions<Unit::MassRate, Unit::MassRate::PoundPerHour>::FromStandard<NumericType>     },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::MassRate,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::MassRate, NumericType>{
-        {Unit::MassRate::KilogramPerSecond,
-         Conversions<Unit::MassRate, Unit::MassRate::KilogramPerSecond>::ToStandard<NumericType>},
-        {Unit::MassRate::GramPerSecond,
-         Conversions<Unit::MassRate, Unit::MassRate::GramPerSecond>::ToStandard<NumericType>    },
-        {Unit::MassRate::SlugPerSecond,
-         Conversions<Unit::MassRate, Unit::MassRate::SlugPerSecond>::ToStandard<NumericType>    },
-        {Unit::MassRate::SlinchPerSecond,
-         Conversions<Unit::MassRate, Unit::MassRate::SlinchPerSecond>::ToStandard<NumericType>  },
-        {Unit::MassRate::PoundPerSecond,
-         Conversions<Unit::MassRate, Unit::MassRate::PoundPerSecond>::ToStandard<NumericType>   },
-        {Unit::MassRate::KilogramPerMinute,
-         Conversions<Unit::MassRate, Unit::MassRate::KilogramPerMinute>::ToStandard<NumericType>},
-        {Unit::MassRate::GramPerMinute,
-         Conversions<Unit::MassRate, Unit::MassRate::GramPerMinute>::ToStandard<NumericType>    },
-        {Unit::MassRate::SlugPerMinute,
-         Conversions<Unit::MassRate, Unit::MassRate::SlugPerMinute>::ToStandard<NumericType>    },
-        {Unit::MassRate::SlinchPerMinute,
-         Conversions<Unit::MassRate, Unit::MassRate::SlinchPerMinute>::ToStandard<NumericType>  },
-        {Unit::MassRate::PoundPerMinute,
-         Conversions<Unit::MassRate, Unit::MassRate::PoundPerMinute>::ToStandard<NumericType>   },
-        {Unit::MassRate::KilogramPerHour,
-         Conversions<Unit::MassRate, Unit::MassRate::KilogramPerHour>::ToStandard<NumericType>  },
-        {Unit::MassRate::GramPerHour,
-         Conversions<Unit::MassRate, Unit::MassRate::GramPerHour>::ToStandard<NumericType>      },
-        {Unit::MassRate::SlugPerHour,
-         Conversions<Unit::MassRate, Unit::MassRate::SlugPerHour>::ToStandard<NumericType>      },
-        {Unit::MassRate::SlinchPerHour,
-         Conversions<Unit::MassRate, Unit::MassRate::SlinchPerHour>::ToStandard<NumericType>    },
-        {Unit::MassRate::PoundPerHour,
-         Conversions<Unit::MassRate, Unit::MassRate::PoundPerHour>::ToStandard<NumericType>     },
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::MassRate>{15};
 
 }  // namespace Internal
 
@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_MEMORY_HPP
 #define PHQ_UNIT_MEMORY_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -136,111 +135,113 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Memory unit) {
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::Memory> ConsistentUnits<Unit::Memory>{
+inline constexpr std::array<std::pair<UnitSystem, Unit::Memory>, 4> ConsistentUnits<Unit::Memory>{{
     {UnitSystem::MetreKilogramSecondKelvin,  Unit::Memory::Bit},
     {UnitSystem::MillimetreGramSecondKelvin, Unit::Memory::Bit},
     {UnitSystem::FootPoundSecondRankine,     Unit::Memory::Bit},
     {UnitSystem::InchPoundSecondRankine,     Unit::Memory::Bit},
-};
-
-template <>
-inline const std::map<Unit::Memory, UnitSystem> RelatedUnitSystems<Unit::Memory>{};
-
-template <>
-inline const std::map<Unit::Memory, std::string_view> Abbreviations<Unit::Memory>{
-    {Unit::Memory::Bit,      "b"  },
-    {Unit::Memory::Byte,     "B"  },
-    {Unit::Memory::Kilobit,  "kb" },
-    {Unit::Memory::Kibibit,  "kib"},
-    {Unit::Memory::Kilobyte, "kB" },
-    {Unit::Memory::Kibibyte, "kiB"},
-    {Unit::Memory::Megabit,  "Mb" },
-    {Unit::Memory::Mebibit,  "Mib"},
-    {Unit::Memory::Megabyte, "MB" },
-    {Unit::Memory::Mebibyte, "MiB"},
-    {Unit::Memory::Gigabit,  "Gb" },
-    {Unit::Memory::Gibibit,  "Gib"},
-    {Unit::Memory::Gigabyte, "GB" },
-    {Unit::Memory::Gibibyte, "GiB"},
-    {Unit::Memory::Terabit,  "Tb" },
-    {Unit::Memory::Tebibit,  "Tib"},
-    {Unit::Memory::Terabyte, "TB" },
-    {Unit::Memory::Tebibyte, "TiB"},
-    {Unit::Memory::Petabit,  "Pb" },
-    {Unit::Memory::Pebibit,  "Pib"},
-    {Unit::Memory::Petabyte, "PB" },
-    {Unit::Memory::Pebibyte, "PiB"},
-};
-
-template <>
-inline const std::unordered_map<std::string_view, Unit::Memory> Spellings<Unit::Memory>{
+}};
+
+template <>
+inline constexpr std::array<std::pair<Unit::Memory, UnitSystem>, 0>
+    RelatedUnitSystems<Unit::Memory>{};
+
+template <>
+inline constexpr std::array<std::pair<Unit::Memory, std::string_view>, 22>
+    Abbreviations<Unit::Memory>{{
+        {Unit::Memory::Bit,      "b"  },
+        {Unit::Memory::Byte,     "B"  },
+        {Unit::Memory::Kilobit,  "kb" },
+        {Unit::Memory::Kibibit,  "kib"},
+        {Unit::Memory::Kilobyte, "kB" },
+        {Unit::Memory::Kibibyte, "kiB"},
+        {Unit::Memory::Megabit,  "Mb" },
+        {Unit::Memory::Mebibit,  "Mib"},
+        {Unit::Memory::Megabyte, "MB" },
+        {Unit::Memory::Mebibyte, "MiB"},
+        {Unit::Memory::Gigabit,  "Gb" },
+        {Unit::Memory::Gibibit,  "Gib"},
+        {Unit::Memory::Gigabyte, "GB" },
+        {Unit::Memory::Gibibyte, "GiB"},
+        {Unit::Memory::Terabit,  "Tb" },
+        {Unit::Memory::Tebibit,  "Tib"},
+        {Unit::Memory::Terabyte, "TB" },
+        {Unit::Memory::Tebibyte, "TiB"},
+        {Unit::Memory::Petabit,  "Pb" },
+        {Unit::Memory::Pebibit,  "Pib"},
+        {Unit::Memory::Petabyte, "PB" },
+        {Unit::Memory::Pebibyte, "PiB"},
+}};
+
+template <>
+inline constexpr std::array<std::pair<std::string_view, Unit::Memory>, 66> Spellings<Unit::Memory>{{
+    {"B",         Unit::Memory::Byte    },
+    {"GB",        Unit::Memory::Gigabyte},
+    {"Gb",        Unit::Memory::Gigabit },
+    {"GiB",       Unit::Memory::Gibibyte},
+    {"Gib",       Unit::Memory::Gibibit },
+    {"MB",        Unit::Memory::Megabyte},
+    {"Mb",        Unit::Memory::Megabit },
+    {"MiB",       Unit::Memory::Mebibyte},
+    {"Mib",       Unit::Memory::Mebibit },
+    {"PB",        Unit::Memory::Petabyte},
+    {"Pb",        Unit::Memory::Petabit },
+    {"PiB",       Unit::Memory::Pebibyte},
+    {"Pib",       Unit::Memory::Pebibit },
+    {"TB",        Unit::Memory::Terabyte},
+    {"Tb",        Unit::Memory::Terabit },
+    {"TiB",       Unit::Memory::Tebibyte},
+    {"Tib",       Unit::Memory::Tebibit },
     {"b",         Unit::Memory::Bit     },
     {"bit",       Unit::Memory::Bit     },
     {"bits",      Unit::Memory::Bit     },
-    {"B",         Unit::Memory::Byte    },
     {"byte",      Unit::Memory::Byte    },
     {"bytes",     Unit::Memory::Byte    },
+    {"gibibit",   Unit::Memory::Gibibit },
+    {"gibibits",  Unit::Memory::Gibibit },
+    {"gibibyte",  Unit::Memory::Gibibyte},
+    {"gibibytes", Unit::Memory::Gibibyte},
+    {"gigabit",   Unit::Memory::Gigabit },
+    {"gigabits",  Unit::Memory::Gigabit },
+    {"gigabyte",  Unit::Memory::Gigabyte},
+    {"gigabytes", Unit::Memory::Gigabyte},
+    {"kB",        Unit::Memory::Kilobyte},
     {"kb",        Unit::Memory::Kilobit },
-    {"kilobit",   Unit::Memory::Kilobit },
-    {"kilobits",  Unit::Memory::Kilobit },
+    {"kiB",       Unit::Memory::Kibibyte},
     {"kib",       Unit::Memory::Kibibit },
     {"kibibit",   Unit::Memory::Kibibit },
     {"kibibits",  Unit::Memory::Kibibit },
-    {"kB",        Unit::Memory::Kilobyte},
-    {"kilobyte",  Unit::Memory::Kilobyte},
-    {"kilobytes", Unit::Memory::Kilobyte},
-    {"kiB",       Unit::Memory::Kibibyte},
     {"kibibyte",  Unit::Memory::Kibibyte},
     {"kibibytes", Unit::Memory::Kibibyte},
-    {"Mb",        Unit::Memory::Megabit },
-    {"megabit",   Unit::Memory::Megabit },
-    {"megabits",  Unit::Memory::Megabit },
-    {"Mib",       Unit::Memory::Mebibit },
+    {"kilobit",   Unit::Memory::Kilobit },
+    {"kilobits",  Unit::Memory::Kilobit },
+    {"kilobyte",  Unit::Memory::Kilobyte},
+    {"kilobytes", Unit::Memory::Kilobyte},
     {"mebibit",   Unit::Memory::Mebibit },
     {"mebibits",  Unit::Memory::Mebibit },
-    {"MB",        Unit::Memory::Megabyte},
-    {"megabyte",  Unit::Memory::Megabyte},
-    {"megabytes", Unit::Memory::Megabyte},
-    {"MiB",       Unit::Memory::Mebibyte},
     {"mebibyte",  Unit::Memory::Mebibyte},
     {"mebibytes", Unit::Memory::Mebibyte},
-    {"Gb",        Unit::Memory::Gigabit },
-    {"gigabit",   Unit::Memory::Gigabit },
-    {"gigabits",  Unit::Memory::Gigabit },
-    {"Gib",       Unit::Memory::Gibibit },
-    {"gibibit",   Unit::Memory::Gibibit },
-    {"gibibits",  Unit::Memory::Gibibit },
-    {"GB",        Unit::Memory::Gigabyte},
-    {"gigabyte",  Unit::Memory::Gigabyte},
-    {"gigabytes", Unit::Memory::Gigabyte},
-    {"GiB",       Unit::Memory::Gibibyte},
-    {"gibibyte",  Unit::Memory::Gibibyte},
-    {"gibibytes", Unit::Memory::Gibibyte},
-    {"Tb",        Unit::Memory::Terabit },
-    {"terabit",   Unit::Memory::Terabit },
-    {"terabits",  Unit::Memory::Terabit },
-    {"Tib",       Unit::Memory::Tebibit },
-    {"tebibit",   Unit::Memory::Tebibit },
-    {"tebibits",  Unit::Memory::Tebibit },
-    {"TB",        Unit::Memory::Terabyte},
-    {"terabyte",  Unit::Memory::Terabyte},
-    {"terabytes", Unit::Memory::Terabyte},
-    {"TiB",       Unit::Memory::Tebibyte},
-    {"tebibyte",  Unit::Memory::Tebibyte},
-    {"tebibytes", Unit::Memory::Tebibyte},
-    {"Pb",        Unit::Memory::Petabit },
-    {"petabit",   Unit::Memory::Petabit },
-    {"petabits",  Unit::Memory::Petabit },
-    {"Pib",       Unit::Memory::Pebibit },
+    {"megabit",   Unit::Memory::Megabit },
+    {"megabits",  Unit::Memory::Megabit },
+    {"megabyte",  Unit::Memory::Megabyte},
+    {"megabytes", Unit::Memory::Megabyte},
     {"pebibit",   Unit::Memory::Pebibit },
     {"pebibits",  Unit::Memory::Pebibit },
-    {"PB",        Unit::Memory::Petabyte},
-    {"petabyte",  Unit::Memory::Petabyte},
-    {"petabytes", Unit::Memory::Petabyte},
-    {"PiB",       Unit::Memory::Pebibyte},
     {"pebibyte",  Unit::Memory::Pebibyte},
     {"pebibytes", Unit::Memory::Pebibyte},
-};
+    {"petabit",   Unit::Memory::Petabit },
+    {"petabits",  Unit::Memory::Petabit },
+    {"petabyte",  Unit::Memory::Petabyte},
+    {"petabytes", Unit::Memory::Petabyte},
+    {"tebibit",   Unit::Memory::Tebibit },
+    {"tebibits",  Unit::Memory::Tebibit },
+    {"tebibyte",  Unit::Memory::Tebibyte},
+    {"tebibytes", Unit::Memory::Tebibyte},
+    {"terabit",   Unit::Memory::Terabit },
+    {"terabits",  Unit::Memory::Terabit },
+    {"terabyte",  Unit::Memory::Terabyte},
+    {"terabytes", Unit::Memory::Terabyte},
+}};
 
 template <>
 template <typename NumericType>
@@ -566,104 +567,8 @@ inline constexpr void Conversion<Unit::Memory, Unit::Memory::Pebibyte>::ToStanda
            * static_cast<NumericType>(1024.0L) * static_cast<NumericType>(1024.0L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::Memory,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Memory, NumericType>{
-        {Unit::Memory::Bit,
-         Conversions<Unit::Memory, Unit::Memory::Bit>::FromStandard<NumericType>     },
-        {Unit::Memory::Byte,
-         Conversions<Unit::Memory, Unit::Memory::Byte>::FromStandard<NumericType>    },
-        {Unit::Memory::Kilobit,
-         Conversions<Unit::Memory, Unit::Memory::Kilobit>::FromStandard<NumericType> },
-        {Unit::Memory::Kibibit,
-         Conversions<Unit::Memory, Unit::Memory::Kibibit>::FromStandard<NumericType> },
-        {Unit::Memory::Kilobyte,
-         Conversions<Unit::Memory, Unit::Memory::Kilobyte>::FromStandard<NumericType>},
-        {Unit::Memory::Kibibyte,
-         Conversions<Unit::Memory, Unit::Memory::Kibibyte>::FromStandard<NumericType>},
-        {Unit::Memory::Megabit,
-         Conversions<Unit::Memory, Unit::Memory::Megabit>::FromStandard<NumericType> },
-        {Unit::Memory::Mebibit,
-         Conversions<Unit::Memory, Unit::Memory::Mebibit>::FromStandard<NumericType> },
-        {Unit::Memory::Megabyte,
-         Conversions<Unit::Memory, Unit::Memory::Megabyte>::FromStandard<NumericType>},
-        {Unit::Memory::Mebibyte,
-         Conversions<Unit::Memory, Unit::Memory::Mebibyte>::FromStandard<NumericType>},
-        {Unit::Memory::Gigabit,
-         Conversions<Unit::Memory, Unit::Memory::Gigabit>::FromStandard<NumericType> },
-        {Unit::Memory::Gibibit,
-         Conversions<Unit::Memory, Unit::Memory::Gibibit>::FromStandard<NumericType> },
-        {Unit::Memory::Gigabyte,
-         Conversions<Unit::Memory, Unit::Memory::Gigabyte>::FromStandard<NumericType>},
-        {Unit::Memory::Gibibyte,
-         Conversions<Unit::Memory, Unit::Memory::Gibibyte>::FromStandard<NumericType>},
-        {Unit::Memory::Terabit,
-         Conversions<Unit::Memory, Unit::Memory::Terabit>::FromStandard<NumericType> },
-        {Unit::Memory::Tebibit,
-         Conversions<Unit::Memory, Unit::Memory::Tebibit>::FromStandard<NumericType> },
-        {Unit::Memory::Terabyte,
-         Conversions<Unit::Memory, Unit::Memory::Terabyte>::FromStandard<NumericType>},
-        {Unit::Memory::Tebibyte,
-         Conversions<Unit::Memory, Unit::Memory::Tebibyte>::FromStandard<NumericType>},
-        {Unit::Memory::Petabit,
-         Conversions<Unit::Memory, Unit::Memory::Petabit>::FromStandard<NumericType> },
-        {Unit::Memory::Pebibit,
-         Conversions<Unit::Memory, Unit::Memory::Pebibit>::FromStandard<NumericType> },
-        {Unit::Memory::Petabyte,
-         Conversions<Unit::Memory, Unit::Memory::Petabyte>::FromStandard<NumericType>},
-        {Unit::Memory::Pebibyte,
-         Conversions<Unit::Memory, Unit::Memory::Pebibyte>::FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Memory,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Memory, NumericType>{
-        {Unit::Memory::Bit,      Conversions<Unit::Memory, Unit::Memory::Bit>::ToStandard<NumericType>     },
-        {Unit::Memory::Byte,
-         Conversions<Unit::Memory,                         Unit::Memory::Byte>::ToStandard<NumericType>    },
-        {Unit::Memory::Kilobit,
-         Conversions<Unit::Memory,                         Unit::Memory::Kilobit>::ToStandard<NumericType> },
-        {Unit::Memory::Kibibit,
-         Conversions<Unit::Memory,                         Unit::Memory::Kibibit>::ToStandard<NumericType> },
-        {Unit::Memory::Kilobyte,
-         Conversions<Unit::Memory,                         Unit::Memory::Kilobyte>::ToStandard<NumericType>},
-        {Unit::Memory::Kibibyte,
-         Conversions<Unit::Memory,                         Unit::Memory::Kibibyte>::ToStandard<NumericType>},
-        {Unit::Memory::Megabit,
-         Conversions<Unit::Memory,                         Unit::Memory::Megabit>::ToStandard<NumericType> },
-        {Unit::Memory::Mebibit,
-         Conversions<Unit::Memory,                         Unit::Memory::Mebibit>::ToStandard<NumericType> },
-        {Unit::Memory::Megabyte,
-         Conversions<Unit::Memory,                         Unit::Memory::Megabyte>::ToStandard<NumericType>},
-        {Unit::Memory::Mebibyte,
-         Conversions<Unit::Memory,                         Unit::Memory::Mebibyte>::ToStandard<NumericType>},
-        {Unit::Memory::Gigabit,
-         Conversions<Unit::Memory,                         Unit::Memory::Gigabit>::ToStandard<NumericType> },
-        {Unit::Memory::Gibibit,
-         Conversions<Unit::Memory,                         Unit::Memory::Gibibit>::ToStandard<NumericType> },
-        {Unit::Memory::Gigabyte,
-         Conversions<Unit::Memory,                         Unit::Memory::Gigabyte>::ToStandard<NumericType>},
-        {Unit::Memory::Gibibyte,
-         Conversions<Unit::Memory,                         Unit::Memory::Gibibyte>::ToStandard<NumericType>},
-        {Unit::Memory::Terabit,
-         Conversions<Unit::Memory,                         Unit::Memory::Terabit>::ToStandard<NumericType> },
-        {Unit::Memory::Tebibit,
-         Conversions<Unit::Memory,                         Unit::Memory::Tebibit>::ToStandard<NumericType> },
-        {Unit::Memory::Terabyte,
-         Conversions<Unit::Memory,                         Unit::Memory::Terabyte>::ToStandard<NumericType>},
-        {Unit::Memory::Tebibyte,
-         Conversions<Unit::Memory,                         Unit::Memory::Tebibyte>::ToStandard<NumericType>},
-        {Unit::Memory::Petabit,
-         Conversions<Unit::Memory,                         Unit::Memory::Petabit>::ToStandard<NumericType> },
-        {Unit::Memory::Pebibit,
-         Conversions<Unit::Memory,                         Unit::Memory::Pebibit>::ToStandard<NumericType> },
-        {Unit::Memory::Petabyte,
-         Conversions<Unit::Memory,                         Unit::Memory::Petabyte>::ToStandard<NumericType>},
-        {Unit::Memory::Pebibyte,
-         Conversions<Unit::Memory,                         Unit::Memory::Pebibyte>::ToStandard<NumericType>},
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Memory>{22};
 
 }  // namespace Internal
 
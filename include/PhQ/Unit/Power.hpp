@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_POWER_HPP
 #define PHQ_UNIT_POWER_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -101,77 +100,78 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Power unit) {
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::Power> ConsistentUnits<Unit::Power>{
+inline constexpr std::array<std::pair<UnitSystem, Unit::Power>, 4> ConsistentUnits<Unit::Power>{{
     {UnitSystem::MetreKilogramSecondKelvin,  Unit::Power::Watt              },
     {UnitSystem::MillimetreGramSecondKelvin, Unit::Power::Nanowatt          },
     {UnitSystem::FootPoundSecondRankine,     Unit::Power::FootPoundPerSecond},
     {UnitSystem::InchPoundSecondRankine,     Unit::Power::InchPoundPerSecond},
-};
+}};
 
 template <>
-inline const std::map<Unit::Power, UnitSystem> RelatedUnitSystems<Unit::Power>{
+inline constexpr std::array<std::pair<Unit::Power, UnitSystem>, 4> RelatedUnitSystems<Unit::Power>{{
     {Unit::Power::Watt,               UnitSystem::MetreKilogramSecondKelvin },
     {Unit::Power::Nanowatt,           UnitSystem::MillimetreGramSecondKelvin},
     {Unit::Power::FootPoundPerSecond, UnitSystem::FootPoundSecondRankine    },
     {Unit::Power::InchPoundPerSecond, UnitSystem::InchPoundSecondRankine    },
-};
+}};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::Power, std::string_view> Abbreviations<Unit::Power>{
-    {Unit::Power::Watt,               "W"       },
-    {Unit::Power::Milliwatt,          "mW"      },
-    {Unit::Power::Microwatt,          "μW"      },
-    {Unit::Power::Nanowatt,           "nW"      },
-    {Unit::Power::Kilowatt,           "kW"      },
-    {Unit::Power::Megawatt,           "MW"      },
-    {Unit::Power::Gigawatt,           "GW"      },
-    {Unit::Power::FootPoundPerSecond, "ft·lbf/s"},
-    {Unit::Power::InchPoundPerSecond, "in·lbf/s"},
-};
+inline constexpr std::array<std::pair<Unit::Power, std::string_view>, 9>
+    Abbreviations<Unit::Power>{{
+        {Unit::Power::Watt,               "W"       },
+        {Unit::Power::Milliwatt,          "mW"      },
+        {Unit::Power::Microwatt,          "μW"      },
+        {Unit::Power::Nanowatt,           "nW"      },
+        {Unit::Power::Kilowatt,           "kW"      },
+        {Unit::Power::Megawatt,           "MW"      },
+        {Unit::Power::Gigawatt,           "GW"      },
+        {Unit::Power::FootPoundPerSecond, "ft·lbf/s"},
+        {Unit::Power::InchPoundPerSecond, "in·lbf/s"},
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Power> Spellings<Unit::Power>{
-    {"W",          Unit::Power::Watt              },
+inline constexpr std::array<std::pair<std::string_view, Unit::Power>, 38> Spellings<Unit::Power>{{
+    {"GJ/s",       Unit::Power::Gigawatt          },
+    {"GW",         Unit::Power::Gigawatt          },
     {"J/s",        Unit::Power::Watt              },
-    {"N·m/s",      Unit::Power::Watt              },
+    {"MJ/s",       Unit::Power::Megawatt          },
+    {"MW",         Unit::Power::Megawatt          },
     {"N*m/s",      Unit::Power::Watt              },
-    {"kg·m^2/s^3", Unit::Power::Watt              },
+    {"N·m/s",      Unit::Power::Watt              },
+    {"W",          Unit::Power::Watt              },
+    {"ft*lb/s",    Unit::Power::FootPoundPerSecond},
+    {"ft*lbf/s",   Unit::Power::FootPoundPerSecond},
+    {"ft·lb/s",    Unit::Power::FootPoundPerSecond},
+    {"ft·lbf/s",   Unit::Power::FootPoundPerSecond},
+    {"g*mm2/s3",   Unit::Power::Nanowatt          },
+    {"g*mm^2/s^3", Unit::Power::Nanowatt          },
+    {"g·mm2/s3",   Unit::Power::Nanowatt          },
+    {"g·mm^2/s^3", Unit::Power::Nanowatt          },
+    {"in*lb/s",    Unit::Power::InchPoundPerSecond},
+    {"in*lbf/s",   Unit::Power::InchPoundPerSecond},
+    {"in·lb/s",    Unit::Power::InchPoundPerSecond},
+    {"in·lbf/s",   Unit::Power::InchPoundPerSecond},
+    {"kJ/s",       Unit::Power::Kilowatt          },
+    {"kW",         Unit::Power::Kilowatt          },
+    {"kg*m2/s3",   Unit::Power::Watt              },
     {"kg*m^2/s^3", Unit::Power::Watt              },
     {"kg·m2/s3",   Unit::Power::Watt              },
-    {"kg*m2/s3",   Unit::Power::Watt              },
-    {"mW",         Unit::Power::Milliwatt         },
+    {"kg·m^2/s^3", Unit::Power::Watt              },
     {"mJ/s",       Unit::Power::Milliwatt         },
-    {"μW",         Unit::Power::Microwatt         },
-    {"μJ/s",       Unit::Power::Microwatt         },
-    {"uW",         Unit::Power::Microwatt         },
-    {"uJ/s",       Unit::Power::Microwatt         },
-    {"nW",         Unit::Power::Nanowatt          },
+    {"mW",         Unit::Power::Milliwatt         },
     {"nJ/s",       Unit::Power::Nanowatt          },
-    {"μN·mm/s",    Unit::Power::Nanowatt          },
-    {"μN*mm/s",    Unit::Power::Nanowatt          },
-    {"uN·mm/s",    Unit::Power::Nanowatt          },
+    {"nW",         Unit::Power::Nanowatt          },
+    {"uJ/s",       Unit::Power::Microwatt         },
     {"uN*mm/s",    Unit::Power::Nanowatt          },
-    {"g·mm^2/s^3", Unit::Power::Nanowatt          },
-    {"g*mm^2/s^3", Unit::Power::Nanowatt          },
-    {"g·mm2/s3",   Unit::Power::Nanowatt          },
-    {"g*mm2/s3",   Unit::Power::Nanowatt          },
-    {"kW",         Unit::Power::Kilowatt          },
-    {"kJ/s",       Unit::Power::Kilowatt          },
-    {"MW",         Unit::Power::Megawatt          },
-    {"MJ/s",       Unit::Power::Megawatt          },
-    {"GW",         Unit::Power::Gigawatt          },
-    {"GJ/s",       Unit::Power::Gigawatt          },
-    {"ft·lbf/s",   Unit::Power::FootPoundPerSecond},
-    {"ft*lbf/s",   Unit::Power::FootPoundPerSecond},
-    {"ft·lb/s",    Unit::Power::FootPoundPerSecond},
-    {"ft*lb/s",    Unit::Power::FootPoundPerSecond},
-    {"in·lbf/s",   Unit::Power::InchPoundPerSecond},
-    {"in*lbf/s",   Unit::Power::InchPoundPerSecond},
-    {"in·lb/s",    Unit::Power::InchPoundPerSecond},
-    {"in*lb/s",    Unit::Power::InchPoundPerSecond},
-};
+    {"uN·mm/s",    Unit::Power::Nanowatt          },
+    {"uW",         Unit::Power::Microwatt         },
+    {"μJ/s",       Unit::Power::Microwatt         },
+    {"μN*mm/s",    Unit::Power::Nanowatt          },
+    {"μN·mm/s",    Unit::Power::Nanowatt          },
+    {"μW",         Unit::Power::Microwatt         },
+}};
 
 // clang-format on
 
@@ -301,50 +301,8 @@ inline constexpr void Conversion<Unit::Power, Unit::Power::InchPoundPerSecond>::
            * static_cast<NumericType>(9.80665L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::Power, std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Power, NumericType>{
-        {Unit::Power::Watt,               Conversions<Unit::Power, Unit::Power::Watt>::FromStandard<NumericType>              },
-        {Unit::Power::Milliwatt,
-         Conversions<Unit::Power,                                  Unit::Power::Milliwatt>::FromStandard<NumericType>         },
-        {Unit::Power::Microwatt,
-         Conversions<Unit::Power,                                  Unit::Power::Microwatt>::FromStandard<NumericType>         },
-        {Unit::Power::Nanowatt,
-         Conversions<Unit::Power,                                  Unit::Power::Nanowatt>::FromStandard<NumericType>          },
-        {Unit::Power::Kilowatt,
-         Conversions<Unit::Power,                                  Unit::Power::Kilowatt>::FromStandard<NumericType>          },
-        {Unit::Power::Megawatt,
-         Conversions<Unit::Power,                                  Unit::Power::Megawatt>::FromStandard<NumericType>          },
-        {Unit::Power::Gigawatt,
-         Conversions<Unit::Power,                                  Unit::Power::Gigawatt>::FromStandard<NumericType>          },
-        {Unit::Power::FootPoundPerSecond,
-         Conversions<Unit::Power,                                  Unit::Power::FootPoundPerSecond>::FromStandard<NumericType>},
-        {Unit::Power::InchPoundPerSecond,
-         Conversions<Unit::Power,                                  Unit::Power::InchPoundPerSecond>::FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Power,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Power, NumericType>{
-        {Unit::Power::Watt,               Conversions<Unit::Power, Unit::Power::Watt>::ToStandard<NumericType>              },
-        {Unit::Power::Milliwatt,
-         Conversions<Unit::Power,                                  Unit::Power::Milliwatt>::ToStandard<NumericType>         },
-        {Unit::Power::Microwatt,
-         Conversions<Unit::Power,                                  Unit::Power::Microwatt>::ToStandard<NumericType>         },
-        {Unit::Power::Nanowatt,
-         Conversions<Unit::Power,                                  Unit::Power::Nanowatt>::ToStandard<NumericType>          },
-        {Unit::Power::Kilowatt,
-         Conversions<Unit::Power,                                  Unit::Power::Kilowatt>::ToStandard<NumericType>          },
-        {Unit::Power::Megawatt,
-         Conversions<Unit::Power,                                  Unit::Power::Megawatt>::ToStandard<NumericType>          },
-        {Unit::Power::Gigawatt,
-         Conversions<Unit::Power,                                  Unit::Power::Gigawatt>::ToStandard<NumericType>          },
-        {Unit::Power::FootPoundPerSecond,
-         Conversions<Unit::Power,                                  Unit::Power::FootPoundPerSecond>::ToStandard<NumericType>},
-        {Unit::Power::InchPoundPerSecond,
-         Conversions<Unit::Power,                                  Unit::Power::InchPoundPerSecond>::ToStandard<NumericType>},
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Power>{9};
 
 }  // namespace Internal
 
@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_PRESSURE_HPP
 #define PHQ_UNIT_PRESSURE_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -98,71 +97,75 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Pressure unit)
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::Pressure> ConsistentUnits<Unit::Pressure>{
-    {UnitSystem::MetreKilogramSecondKelvin,  Unit::Pressure::Pascal            },
-    {UnitSystem::MillimetreGramSecondKelvin, Unit::Pressure::Pascal            },
-    {UnitSystem::FootPoundSecondRankine,     Unit::Pressure::PoundPerSquareFoot},
-    {UnitSystem::InchPoundSecondRankine,     Unit::Pressure::PoundPerSquareInch},
-};
+inline constexpr std::array<std::pair<UnitSystem, Unit::Pressure>, 4>
+    ConsistentUnits<Unit::Pressure>{{
+        {UnitSystem::MetreKilogramSecondKelvin,  Unit::Pressure::Pascal            },
+        {UnitSystem::MillimetreGramSecondKelvin, Unit::Pressure::Pascal            },
+        {UnitSystem::FootPoundSecondRankine,     Unit::Pressure::PoundPerSquareFoot},
+        {UnitSystem::InchPoundSecondRankine,     Unit::Pressure::PoundPerSquareInch},
+}};
 
 template <>
-inline const std::map<Unit::Pressure, UnitSystem> RelatedUnitSystems<Unit::Pressure>{
-    {Unit::Pressure::PoundPerSquareFoot, UnitSystem::FootPoundSecondRankine},
-    {Unit::Pressure::PoundPerSquareInch, UnitSystem::InchPoundSecondRankine},
-};
+inline constexpr std::array<std::pair<Unit::Pressure, UnitSystem>, 2>
+    RelatedUnitSystems<Unit::Pressure>{{
+        {Unit::Pressure::PoundPerSquareFoot, UnitSystem::FootPoundSecondRankine},
+        {Unit::Pressure::PoundPerSquareInch, UnitSystem::InchPoundSecondRankine},
+}};
 
 template <>
-inline const std::map<Unit::Pressure, std::string_view> Abbreviations<Unit::Pressure>{
-    {Unit::Pressure::Pascal,             "Pa"      },
-    {Unit::Pressure::Kilopascal,         "kPa"     },
-    {Unit::Pressure::Megapascal,         "MPa"     },
-    {Unit::Pressure::Gigapascal,         "GPa"     },
-    {Unit::Pressure::Bar,                "bar"     },
-    {Unit::Pressure::Atmosphere,         "atm"     },
-    {Unit::Pressure::PoundPerSquareFoot, "lbf/ft^2"},
-    {Unit::Pressure::PoundPerSquareInch, "lbf/in^2"},
-};
+inline constexpr std::array<std::pair<Unit::Pressure, std::string_view>, 8>
+    Abbreviations<Unit::Pressure>{{
+        {Unit::Pressure::Pascal,             "Pa"      },
+        {Unit::Pressure::Kilopascal,         "kPa"     },
+        {Unit::Pressure::Megapascal,         "MPa"     },
+        {Unit::Pressure::Gigapascal,         "GPa"     },
+        {Unit::Pressure::Bar,                "bar"     },
+        {Unit::Pressure::Atmosphere,         "atm"     },
+        {Unit::Pressure::PoundPerSquareFoot, "lbf/ft^2"},
+        {Unit::Pressure::PoundPerSquareInch, "lbf/in^2"},
+}};
 
 // clang-format off
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Pressure> Spellings<Unit::Pressure>{
-    {"Pa",         Unit::Pressure::Pascal            },
-    {"N/m^2",      Unit::Pressure::Pascal            },
-    {"N/m2",       Unit::Pressure::Pascal            },
-    {"kg/(m·s^2)", Unit::Pressure::Pascal            },
-    {"kg/(m·s2)",  Unit::Pressure::Pascal            },
-    {"kg/(m*s^2)", Unit::Pressure::Pascal            },
-    {"kg/(m*s2)",  Unit::Pressure::Pascal            },
-    {"kg/m/s^2",   Unit::Pressure::Pascal            },
-    {"kg/m/s2",    Unit::Pressure::Pascal            },
-    {"kPa",        Unit::Pressure::Kilopascal        },
-    {"kN/m^2",     Unit::Pressure::Kilopascal        },
-    {"kN/m2",      Unit::Pressure::Kilopascal        },
-    {"MPa",        Unit::Pressure::Megapascal        },
-    {"N/mm^2",     Unit::Pressure::Megapascal        },
-    {"N/mm2",      Unit::Pressure::Megapascal        },
-    {"MN/m^2",     Unit::Pressure::Megapascal        },
-    {"MN/m2",      Unit::Pressure::Megapascal        },
-    {"GPa",        Unit::Pressure::Gigapascal        },
-    {"GN/m^2",     Unit::Pressure::Gigapascal        },
-    {"GN/m2",      Unit::Pressure::Gigapascal        },
-    {"kN/mm^2",    Unit::Pressure::Gigapascal        },
-    {"kN/mm2",     Unit::Pressure::Gigapascal        },
-    {"bar",        Unit::Pressure::Bar               },
-    {"atm",        Unit::Pressure::Atmosphere        },
-    {"atmosphere", Unit::Pressure::Atmosphere        },
-    {"lbf/ft^2",   Unit::Pressure::PoundPerSquareFoot},
-    {"lbf/ft2",    Unit::Pressure::PoundPerSquareFoot},
-    {"lb/ft^2",    Unit::Pressure::PoundPerSquareFoot},
-    {"lb/ft2",     Unit::Pressure::PoundPerSquareFoot},
-    {"psf",        Unit::Pressure::PoundPerSquareFoot},
-    {"lbf/in^2",   Unit::Pressure::PoundPerSquareInch},
-    {"lbf/in2",    Unit::Pressure::PoundPerSquareInch},
-    {"lb/in^2",    Unit::Pressure::PoundPerSquareInch},
-    {"lb/in2",     Unit::Pressure::PoundPerSquareInch},
-    {"psi",        Unit::Pressure::PoundPerSquareInch},
-};
+inline constexpr std::array<std::pair<std::string_view, Unit::Pressure>, 35>
+    Spellings<Unit::Pressure>{{
+        {"GN/m2",      Unit::Pressure::Gigapascal        },
+        {"GN/m^2",     Unit::Pressure::Gigapascal        },
+        {"GPa",        Unit::Pressure::Gigapascal        },
+        {"MN/m2",      Unit::Pressure::Megapascal        },
+        {"MN/m^2",     Unit::Pressure::Megapascal        },
+        {"MPa",        Unit::Pressure::Megapascal        },
+        {"N/m2",       Unit::Pressure::Pascal            },
+        {"N/m^2",      Unit::Pressure::Pascal            },
+        {"N/mm2",      Unit::Pressure::Megapascal        },
+        {"N/mm^2",     Unit::Pressure::Megapascal        },
+        {"Pa",         Unit::Pressure::Pascal            },
+        {"atm",        Unit::Pressure::Atmosphere        },
+        {"atmosphere", Unit::Pressure::Atmosphere        },
+        {"bar",        Unit::Pressure::Bar               },
+        {"kN/m2",      Unit::Pressure::Kilopascal        },
+        {"kN/m^2",     Unit::Pressure::Kilopascal        },
+        {"kN/mm2",     Unit::Pressure::Gigapascal        },
+        {"kN/mm^2",    Unit::Pressure::Gigapascal        },
+        {"kPa",        Unit::Pressure::Kilopascal        },
+        {"kg/(m*s2)",  Unit::Pressure::Pascal            },
+        {"kg/(m*s^2)", Unit::Pressure::Pascal            },
+        {"kg/(m·s2)",  Unit::Pressure::Pascal            },
+        {"kg/(m·s^2)", Unit::Pressure::Pascal            },
+        {"kg/m/s2",    Unit::Pressure::Pascal            },
+        {"kg/m/s^2",   Unit::Pressure::Pascal            },
+        {"lb/ft2",     Unit::Pressure::PoundPerSquareFoot},
+        {"lb/ft^2",    Unit::Pressure::PoundPerSquareFoot},
+        {"lb/in2",     Unit::Pressure::PoundPerSquareInch},
+        {"lb/in^2",    Unit::Pressure::PoundPerSquareInch},
+        {"lbf/ft2",    Unit::Pressure::PoundPerSquareFoot},
+        {"lbf/ft^2",   Unit::Pressure::PoundPerSquareFoot},
+        {"lbf/in2",    Unit::Pressure::PoundPerSquareInch},
+        {"lbf/in^2",   Unit::Pressure::PoundPerSquareInch},
+        {"psf",        Unit::Pressure::PoundPerSquareFoot},
+        {"psi",        Unit::Pressure::PoundPerSquareInch},
+}};
 
 // clang-format on
 
@@ -278,51 +281,8 @@ inline constexpr void Conversion<Unit::Pressure, Unit::Pressure::PoundPerSquareI
            / (static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L));
 }
 
-template <typename NumericType>
-inline const std::map<Unit::Pressure,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Pressure, NumericType>{
-        {Unit::Pressure::Pascal,
-         Conversions<Unit::Pressure, Unit::Pressure::Pascal>::FromStandard<NumericType>    },
-        {Unit::Pressure::Kilopascal,
-         Conversions<Unit::Pressure, Unit::Pressure::Kilopascal>::FromStandard<NumericType>},
-        {Unit::Pressure::Megapascal,
-         Conversions<Unit::Pressure, Unit::Pressure::Megapascal>::FromStandard<NumericType>},
-        {Unit::Pressure::Gigapascal,
-         Conversions<Unit::Pressure, Unit::Pressure::Gigapascal>::FromStandard<NumericType>},
-        {Unit::Pressure::Bar,
-         Conversions<Unit::Pressure, Unit::Pressure::Bar>::FromStandard<NumericType>       },
-        {Unit::Pressure::Atmosphere,
-         Conversions<Unit::Pressure, Unit::Pressure::Atmosphere>::FromStandard<NumericType>},
-        {Unit::Pressure::PoundPerSquareFoot,
-         Conversions<Unit::Pressure,
-         Unit::Pressure::PoundPerSquareFoot>::FromStandard<NumericType>                    },
-        {Unit::Pressure::PoundPerSquareInch,
-         Conversions<Unit::Pressure,
-         Unit::Pressure::PoundPerSquareInch>::FromStandard<NumericType>                    },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Pressure,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Pressure, NumericType>{
-        {Unit::Pressure::Pascal,
-         Conversions<Unit::Pressure, Unit::Pressure::Pascal>::ToStandard<NumericType>            },
-        {Unit::Pressure::Kilopascal,
-         Conversions<Unit::Pressure, Unit::Pressure::Kilopascal>::ToStandard<NumericType>        },
-        {Unit::Pressure::Megapascal,
-         Conversions<Unit::Pressure, Unit::Pressure::Megapascal>::ToStandard<NumericType>        },
-        {Unit::Pressure::Gigapascal,
-         Conversions<Unit::Pressure, Unit::Pressure::Gigapascal>::ToStandard<NumericType>        },
-        {Unit::Pressure::Bar,
-         Conversions<Unit::Pressure, Unit::Pressure::Bar>::ToStandard<NumericType>               },
-        {Unit::Pressure::Atmosphere,
-         Conversions<Unit::Pressure, Unit::Pressure::Atmosphere>::ToStandard<NumericType>        },
-        {Unit::Pressure::PoundPerSquareFoot,
-         Conversions<Unit::Pressure, Unit::Pressure::PoundPerSquareFoot>::ToStandard<NumericType>},
-        {Unit::Pressure::PoundPerSquareInch,
-         Conversions<Unit::Pressure, Unit::Pressure::PoundPerSquareInch>::ToStandard<NumericType>},
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Pressure>{8};
 
 }  // namespace Internal
 
@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_SOLID_ANGLE_HPP
 #define PHQ_UNIT_SOLID_ANGLE_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -84,66 +83,70 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::SolidAngle uni
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::SolidAngle> ConsistentUnits<Unit::SolidAngle>{
-    {UnitSystem::MetreKilogramSecondKelvin,  Unit::SolidAngle::Steradian},
-    {UnitSystem::MillimetreGramSecondKelvin, Unit::SolidAngle::Steradian},
-    {UnitSystem::FootPoundSecondRankine,     Unit::SolidAngle::Steradian},
-    {UnitSystem::InchPoundSecondRankine,     Unit::SolidAngle::Steradian},
-};
+inline constexpr std::array<std::pair<UnitSystem, Unit::SolidAngle>, 4>
+    ConsistentUnits<Unit::SolidAngle>{{
+        {UnitSystem::MetreKilogramSecondKelvin,  Unit::SolidAngle::Steradian},
+        {UnitSystem::MillimetreGramSecondKelvin, Unit::SolidAngle::Steradian},
+        {UnitSystem::FootPoundSecondRankine,     Unit::SolidAngle::Steradian},
+        {UnitSystem::InchPoundSecondRankine,     Unit::SolidAngle::Steradian},
+}};
 
 template <>
-inline const std::map<Unit::SolidAngle, UnitSystem> RelatedUnitSystems<Unit::SolidAngle>{};
+inline constexpr std::array<std::pair<Unit::SolidAngle, UnitSystem>, 0>
+    RelatedUnitSystems<Unit::SolidAngle>{};
 
 template <>
-inline const std::map<Unit::SolidAngle, std::string_view> Abbreviations<Unit::SolidAngle>{
-    {Unit::SolidAngle::Steradian,       "sr"      },
-    {Unit::SolidAngle::SquareDegree,    "deg^2"   },
-    {Unit::SolidAngle::SquareArcminute, "arcmin^2"},
-    {Unit::SolidAngle::SquareArcsecond, "arcsec^2"},
-};
+inline constexpr std::array<std::pair<Unit::SolidAngle, std::string_view>, 4>
+    Abbreviations<Unit::SolidAngle>{{
+        {Unit::SolidAngle::Steradian,       "sr"      },
+        {Unit::SolidAngle::SquareDegree,    "deg^2"   },
+        {Unit::SolidAngle::SquareArcminute, "arcmin^2"},
+        {Unit::SolidAngle::SquareArcsecond, "arcsec^2"},
+}};
 
 // clang-format off
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::SolidAngle> Spellings<Unit::SolidAngle>{
-    {"sr",           Unit::SolidAngle::Steradian      },
-    {"rad^2",        Unit::SolidAngle::SquareDegree   },
-    {"rad2",         Unit::SolidAngle::SquareDegree   },
-    {"radian^2",     Unit::SolidAngle::SquareDegree   },
-    {"radian2",      Unit::SolidAngle::SquareDegree   },
-    {"radians^2",    Unit::SolidAngle::SquareDegree   },
-    {"radians2",     Unit::SolidAngle::SquareDegree   },
-    {"deg^2",        Unit::SolidAngle::SquareDegree   },
-    {"deg2",         Unit::SolidAngle::SquareDegree   },
-    {"degree^2",     Unit::SolidAngle::SquareDegree   },
-    {"degree2",      Unit::SolidAngle::SquareDegree   },
-    {"degrees^2",    Unit::SolidAngle::SquareDegree   },
-    {"degrees2",     Unit::SolidAngle::SquareDegree   },
-    {"°^2",          Unit::SolidAngle::SquareDegree   },
-    {"°2",           Unit::SolidAngle::SquareDegree   },
-    {"'^2",          Unit::SolidAngle::SquareArcminute},
-    {"'2",           Unit::SolidAngle::SquareArcminute},
-    {"am^2",         Unit::SolidAngle::SquareArcminute},
-    {"am2",          Unit::SolidAngle::SquareArcminute},
-    {"arcmin^2",     Unit::SolidAngle::SquareArcminute},
-    {"arcmin2",      Unit::SolidAngle::SquareArcminute},
-    {"arcminute^2",  Unit::SolidAngle::SquareArcminute},
-    {"arcminute2",   Unit::SolidAngle::SquareArcminute},
-    {"arcminutes^2", Unit::SolidAngle::SquareArcminute},
-    {"arcminutes2",  Unit::SolidAngle::SquareArcminute},
-    {"\"^2",         Unit::SolidAngle::SquareArcsecond},
-    {"\"2",          Unit::SolidAngle::SquareArcsecond},
-    {"as",           Unit::SolidAngle::SquareArcsecond},
-    {"as^2",         Unit::SolidAngle::SquareArcsecond},
-    {"arcs^2",       Unit::SolidAngle::SquareArcsecond},
-    {"arcs2",        Unit::SolidAngle::SquareArcsecond},
-    {"arcsec^2",     Unit::SolidAngle::SquareArcsecond},
-    {"arcsec2",      Unit::SolidAngle::SquareArcsecond},
-    {"arcsecond^2",  Unit::SolidAngle::SquareArcsecond},
-    {"arcsecond2",   Unit::SolidAngle::SquareArcsecond},
-    {"arcseconds^2", Unit::SolidAngle::SquareArcsecond},
-    {"arcseconds2",  Unit::SolidAngle::SquareArcsecond},
-};
+inline constexpr std::array<std::pair<std::string_view, Unit::SolidAngle>, 37>
+    Spellings<Unit::SolidAngle>{{
+        {"\"2",          Unit::SolidAngle::SquareArcsecond},
+        {"\"^2",         Unit::SolidAngle::SquareArcsecond},
+        {"'2",           Unit::SolidAngle::SquareArcminute},
+        {"'^2",          Unit::SolidAngle::SquareArcminute},
+        {"am2",          Unit::SolidAngle::SquareArcminute},
+        {"am^2",         Unit::SolidAngle::SquareArcminute},
+        {"arcmin2",      Unit::SolidAngle::SquareArcminute},
+        {"arcmin^2",     Unit::SolidAngle::SquareArcminute},
+        {"arcminute2",   Unit::SolidAngle::SquareArcminute},
+        {"arcminute^2",  Unit::SolidAngle::SquareArcminute},
+        {"arcminutes2",  Unit::SolidAngle::SquareArcminute},
+        {"arcminutes^2", Unit::SolidAngle::SquareArcminute},
+        {"arcs2",        Unit::SolidAngle::SquareArcsecond},
+        {"arcs^2",       Unit::SolidAngle::SquareArcsecond},
+        {"arcsec2",      Unit::SolidAngle::SquareArcsecond},
+        {"arcsec^2",     Unit::SolidAngle::SquareArcsecond},
+        {"arcsecond2",   Unit::SolidAngle::SquareArcsecond},
+        {"arcsecond^2",  Unit::SolidAngle::SquareArcsecond},
+        {"arcseconds2",  Unit::SolidAngle::SquareArcsecond},
+        {"arcseconds^2", Unit::SolidAngle::SquareArcsecond},
+        {"as",           Unit::SolidAngle::SquareArcsecond},
+        {"as^2",         Unit::SolidAngle::SquareArcsecond},
+        {"deg2",         Unit::SolidAngle::SquareDegree   },
+        {"deg^2",        Unit::SolidAngle::SquareDegree   },
+        {"degree2",      Unit::SolidAngle::SquareDegree   },
+        {"degree^2",     Unit::SolidAngle::SquareDegree   },
+        {"degrees2",     Unit::SolidAngle::SquareDegree   },
+        {"degrees^2",    Unit::SolidAngle::SquareDegree   },
+        {"rad2",         Unit::SolidAngle::SquareDegree   },
+        {"rad^2",        Unit::SolidAngle::SquareDegree   },
+        {"radian2",      Unit::SolidAngle::SquareDegree   },
+        {"radian^2",     Unit::SolidAngle::SquareDegree   },
+        {"radians2",     Unit::SolidAngle::SquareDegree   },
+        {"radians^2",    Unit::SolidAngle::SquareDegree   },
+        {"sr",           Unit::SolidAngle::Steradian      },
+        {"°2",           Unit::SolidAngle::SquareDegree   },
+        {"°^2",          Unit::SolidAngle::SquareDegree   },
+}};
 
 // clang-format on
 
@@ -205,35 +208,8 @@ inline constexpr void Conversion<Unit::SolidAngle, Unit::SolidAngle::SquareArcse
       Pi<NumericType> * Pi<NumericType> / (static_cast<NumericType>(648000.0L) * static_cast<NumericType>(648000.0L));
 }
 
-template <typename NumericType>
-inline const std::map<Unit::SolidAngle,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::SolidAngle, NumericType>{
-        {Unit::SolidAngle::Steradian,
-         Conversions<Unit::SolidAngle, Unit::SolidAngle::Steradian>::FromStandard<NumericType>   },
-        {Unit::SolidAngle::SquareDegree,
-         Conversions<Unit::SolidAngle, Unit::SolidAngle::SquareDegree>::FromStandard<NumericType>},
-        {Unit::SolidAngle::SquareArcminute,
-         Conversions<Unit::SolidAngle,
-         Unit::SolidAngle::SquareArcminute>::FromStandard<NumericType>                           },
-        {Unit::SolidAngle::SquareArcsecond,
-         Conversions<Unit::SolidAngle,
-         Unit::SolidAngle::SquareArcsecond>::FromStandard<NumericType>                           },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::SolidAngle,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::SolidAngle, NumericType>{
-        {Unit::SolidAngle::Steradian,
-         Conversions<Unit::SolidAngle, Unit::SolidAngle::Steradian>::ToStandard<NumericType>      },
-        {Unit::SolidAngle::SquareDegree,
-         Conversions<Unit::SolidAngle, Unit::SolidAngle::SquareDegree>::ToStandard<NumericType>   },
-        {Unit::SolidAngle::SquareArcminute,
-         Conversions<Unit::SolidAngle, Unit::SolidAngle::SquareArcminute>::ToStandard<NumericType>},
-        {Unit::SolidAngle::SquareArcsecond,
-         Conversions<Unit::SolidAngle, Unit::SolidAngle::SquareArcsecond>::ToStandard<NumericType>},
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::SolidAngle>{4};
 
 }  // namespace Internal
 
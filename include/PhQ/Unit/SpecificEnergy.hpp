@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_SPECIFIC_ENERGY_HPP
 #define PHQ_UNIT_SPECIFIC_ENERGY_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -87,73 +86,76 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::SpecificEnergy
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::SpecificEnergy> ConsistentUnits<Unit::SpecificEnergy>{
-    {UnitSystem::MetreKilogramSecondKelvin,  Unit::SpecificEnergy::JoulePerKilogram  },
-    {UnitSystem::MillimetreGramSecondKelvin, Unit::SpecificEnergy::NanojoulePerGram  },
-    {UnitSystem::FootPoundSecondRankine,     Unit::SpecificEnergy::FootPoundPerSlug  },
-    {UnitSystem::InchPoundSecondRankine,     Unit::SpecificEnergy::InchPoundPerSlinch},
-};
+inline constexpr std::array<std::pair<UnitSystem, Unit::SpecificEnergy>, 4>
+    ConsistentUnits<Unit::SpecificEnergy>{{
+        {UnitSystem::MetreKilogramSecondKelvin,  Unit::SpecificEnergy::JoulePerKilogram  },
+        {UnitSystem::MillimetreGramSecondKelvin, Unit::SpecificEnergy::NanojoulePerGram  },
+        {UnitSystem::FootPoundSecondRankine,     Unit::SpecificEnergy::FootPoundPerSlug  },
+        {UnitSystem::InchPoundSecondRankine,     Unit::SpecificEnergy::InchPoundPerSlinch},
+}};
 
 template <>
-inline const std::map<Unit::SpecificEnergy, UnitSystem> RelatedUnitSystems<Unit::SpecificEnergy>{
-    {Unit::SpecificEnergy::JoulePerKilogram,   UnitSystem::MetreKilogramSecondKelvin },
-    {Unit::SpecificEnergy::NanojoulePerGram,   UnitSystem::MillimetreGramSecondKelvin},
-    {Unit::SpecificEnergy::FootPoundPerSlug,   UnitSystem::FootPoundSecondRankine    },
-    {Unit::SpecificEnergy::InchPoundPerSlinch, UnitSystem::InchPoundSecondRankine    },
-};
+inline constexpr std::array<std::pair<Unit::SpecificEnergy, UnitSystem>, 4>
+    RelatedUnitSystems<Unit::SpecificEnergy>{{
+        {Unit::SpecificEnergy::JoulePerKilogram,   UnitSystem::MetreKilogramSecondKelvin },
+        {Unit::SpecificEnergy::NanojoulePerGram,   UnitSystem::MillimetreGramSecondKelvin},
+        {Unit::SpecificEnergy::FootPoundPerSlug,   UnitSystem::FootPoundSecondRankine    },
+        {Unit::SpecificEnergy::InchPoundPerSlinch, UnitSystem::InchPoundSecondRankine    },
+}};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::SpecificEnergy, std::string_view> Abbreviations<Unit::SpecificEnergy>{
-    {Unit::SpecificEnergy::JoulePerKilogram,   "J/kg"         },
-    {Unit::SpecificEnergy::NanojoulePerGram,   "nJ/g"         },
-    {Unit::SpecificEnergy::FootPoundPerSlug,   "ft·lbf/slug"  },
-    {Unit::SpecificEnergy::InchPoundPerSlinch, "in·lbf/slinch"},
-};
+inline constexpr std::array<std::pair<Unit::SpecificEnergy, std::string_view>, 4>
+    Abbreviations<Unit::SpecificEnergy>{{
+        {Unit::SpecificEnergy::JoulePerKilogram,   "J/kg"         },
+        {Unit::SpecificEnergy::NanojoulePerGram,   "nJ/g"         },
+        {Unit::SpecificEnergy::FootPoundPerSlug,   "ft·lbf/slug"  },
+        {Unit::SpecificEnergy::InchPoundPerSlinch, "in·lbf/slinch"},
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::SpecificEnergy> Spellings<
-    Unit::SpecificEnergy>{
-    {"J/kg",          Unit::SpecificEnergy::JoulePerKilogram  },
-    {"N·m/kg",        Unit::SpecificEnergy::JoulePerKilogram  },
-    {"N*m/kg",        Unit::SpecificEnergy::JoulePerKilogram  },
-    {"m·N/kg",        Unit::SpecificEnergy::JoulePerKilogram  },
-    {"m*N/kg",        Unit::SpecificEnergy::JoulePerKilogram  },
-    {"m^2/s^2",       Unit::SpecificEnergy::JoulePerKilogram  },
-    {"m2/s2",         Unit::SpecificEnergy::JoulePerKilogram  },
-    {"nJ/g",          Unit::SpecificEnergy::NanojoulePerGram  },
-    {"μN·mm/g",       Unit::SpecificEnergy::NanojoulePerGram  },
-    {"μN*mm/g",       Unit::SpecificEnergy::NanojoulePerGram  },
-    {"uN·mm/g",       Unit::SpecificEnergy::NanojoulePerGram  },
-    {"uN*mm/g",       Unit::SpecificEnergy::NanojoulePerGram  },
-    {"mm·μN/g",       Unit::SpecificEnergy::NanojoulePerGram  },
-    {"mm*μN/g",       Unit::SpecificEnergy::NanojoulePerGram  },
-    {"mm·uN/g",       Unit::SpecificEnergy::NanojoulePerGram  },
-    {"mm*uN/g",       Unit::SpecificEnergy::NanojoulePerGram  },
-    {"mm^2/s^2",      Unit::SpecificEnergy::NanojoulePerGram  },
-    {"mm2/s2",        Unit::SpecificEnergy::NanojoulePerGram  },
-    {"ft·lbf/slug",   Unit::SpecificEnergy::FootPoundPerSlug  },
-    {"ft*lbf/slug",   Unit::SpecificEnergy::FootPoundPerSlug  },
-    {"lbf·ft/slug",   Unit::SpecificEnergy::FootPoundPerSlug  },
-    {"lbf*ft/slug",   Unit::SpecificEnergy::FootPoundPerSlug  },
-    {"ft·lb/slug",    Unit::SpecificEnergy::FootPoundPerSlug  },
-    {"ft*lb/slug",    Unit::SpecificEnergy::FootPoundPerSlug  },
-    {"lb·ft/slug",    Unit::SpecificEnergy::FootPoundPerSlug  },
-    {"lb*ft/slug",    Unit::SpecificEnergy::FootPoundPerSlug  },
-    {"ft^2/s^2",      Unit::SpecificEnergy::FootPoundPerSlug  },
-    {"ft2/s2",        Unit::SpecificEnergy::FootPoundPerSlug  },
-    {"in·lbf/slinch", Unit::SpecificEnergy::InchPoundPerSlinch},
-    {"in*lbf/slinch", Unit::SpecificEnergy::InchPoundPerSlinch},
-    {"lbf·in/slinch", Unit::SpecificEnergy::InchPoundPerSlinch},
-    {"lbf*in/slinch", Unit::SpecificEnergy::InchPoundPerSlinch},
-    {"in·lb/slinch",  Unit::SpecificEnergy::InchPoundPerSlinch},
-    {"in*lb/slinch",  Unit::SpecificEnergy::InchPoundPerSlinch},
-    {"lb·in/slinch",  Unit::SpecificEnergy::InchPoundPerSlinch},
-    {"lb*in/slinch",  Unit::SpecificEnergy::InchPoundPerSlinch},
-    {"in^2/s^2",      Unit::SpecificEnergy::InchPoundPerSlinch},
-    {"in2/s2",        Unit::SpecificEnergy::InchPoundPerSlinch},
-};
+inline constexpr std::array<std::pair<std::string_view, Unit::SpecificEnergy>, 38>
+    Spellings<Unit::SpecificEnergy>{{
+        {"J/kg",          Unit::SpecificEnergy::JoulePerKilogram  },
+        {"N*m/kg",        Unit::SpecificEnergy::JoulePerKilogram  },
+        {"N·m/kg",        Unit::SpecificEnergy::JoulePerKilogram  },
+        {"ft*lb/slug",    Unit::SpecificEnergy::FootPoundPerSlug  },
+        {"ft*lbf/slug",   Unit::SpecificEnergy::FootPoundPerSlug  },
+        {"ft2/s2",        Unit::SpecificEnergy::FootPoundPerSlug  },
+        {"ft^2/s^2",      Unit::SpecificEnergy::FootPoundPerSlug  },
+        {"ft·lb/slug",    Unit::SpecificEnergy::FootPoundPerSlug  },
+        {"ft·lbf/slug",   Unit::SpecificEnergy::FootPoundPerSlug  },
+        {"in*lb/slinch",  Unit::SpecificEnergy::InchPoundPerSlinch},
+        {"in*lbf/slinch", Unit::SpecificEnergy::InchPoundPerSlinch},
+        {"in2/s2",        Unit::SpecificEnergy::InchPoundPerSlinch},
+        {"in^2/s^2",      Unit::SpecificEnergy::InchPoundPerSlinch},
+        {"in·lb/slinch",  Unit::SpecificEnergy::InchPoundPerSlinch},
+        {"in·lbf/slinch", Unit::SpecificEnergy::InchPoundPerSlinch},
+        {"lb*ft/slug",    Unit::SpecificEnergy::FootPoundPerSlug  },
+        {"lb*in/slinch",  Unit::SpecificEnergy::InchPoundPerSlinch},
+        {"lbf*ft/slug",   Unit::SpecificEnergy::FootPoundPerSlug  },
+        {"lbf*in/slinch", Unit::SpecificEnergy::InchPoundPerSlinch},
+        {"lbf·ft/slug",   Unit::SpecificEnergy::FootPoundPerSlug  },
+        {"lbf·in/slinch", Unit::SpecificEnergy::InchPoundPerSlinch},
+        {"lb·ft/slug",    Unit::SpecificEnergy::FootPoundPerSlug  },
+        {"lb·in/slinch",  Unit::SpecificEnergy::InchPoundPerSlinch},
+        {"m*N/kg",        Unit::SpecificEnergy::JoulePerKilogram  },
+        {"m2/s2",         Unit::SpecificEnergy::JoulePerKilogram  },
+        {"m^2/s^2",       Unit::SpecificEnergy::JoulePerKilogram  },
+        {"mm*uN/g",       Unit::SpecificEnergy::NanojoulePerGram  },
+        {"mm*μN/g",       Unit::SpecificEnergy::NanojoulePerGram  },
+        {"mm2/s2",        Unit::SpecificEnergy::NanojoulePerGram  },
+        {"mm^2/s^2",      Unit::SpecificEnergy::NanojoulePerGram  },
+        {"mm·uN/g",       Unit::SpecificEnergy::NanojoulePerGram  },
+        {"mm·μN/g",       Unit::SpecificEnergy::NanojoulePerGram  },
+        {"m·N/kg",        Unit::SpecificEnergy::JoulePerKilogram  },
+        {"nJ/g",          Unit::SpecificEnergy::NanojoulePerGram  },
+        {"uN*mm/g",       Unit::SpecificEnergy::NanojoulePerGram  },
+        {"uN·mm/g",       Unit::SpecificEnergy::NanojoulePerGram  },
+        {"μN*mm/g",       Unit::SpecificEnergy::NanojoulePerGram  },
+        {"μN·mm/g",       Unit::SpecificEnergy::NanojoulePerGram  },
+}};
 
 // clang-format on
 
@@ -217,41 +219,8 @@ Conversion<Unit::SpecificEnergy, Unit::SpecificEnergy::InchPoundPerSlinch>::ToSt
   value *= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::SpecificEnergy,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::SpecificEnergy, NumericType>{
-        {Unit::SpecificEnergy::JoulePerKilogram,
-         Conversions<Unit::SpecificEnergy,
-         Unit::SpecificEnergy::JoulePerKilogram>::FromStandard<NumericType>  },
-        {Unit::SpecificEnergy::NanojoulePerGram,
-         Conversions<Unit::SpecificEnergy,
-         Unit::SpecificEnergy::NanojoulePerGram>::FromStandard<NumericType>  },
-        {Unit::SpecificEnergy::FootPoundPerSlug,
-         Conversions<Unit::SpecificEnergy,
-         Unit::SpecificEnergy::FootPoundPerSlug>::FromStandard<NumericType>  },
-        {Unit::SpecificEnergy::InchPoundPerSlinch,
-         Conversions<Unit::SpecificEnergy,
-         Unit::SpecificEnergy::InchPoundPerSlinch>::FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::SpecificEnergy,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::SpecificEnergy, NumericType>{
-        {Unit::SpecificEnergy::JoulePerKilogram,
-         Conversions<Unit::SpecificEnergy,
-         Unit::SpecificEnergy::JoulePerKilogram>::ToStandard<NumericType>  },
-        {Unit::SpecificEnergy::NanojoulePerGram,
-         Conversions<Unit::SpecificEnergy,
-         Unit::SpecificEnergy::NanojoulePerGram>::ToStandard<NumericType>  },
-        {Unit::SpecificEnergy::FootPoundPerSlug,
-         Conversions<Unit::SpecificEnergy,
-         Unit::SpecificEnergy::FootPoundPerSlug>::ToStandard<NumericType>  },
-        {Unit::SpecificEnergy::InchPoundPerSlinch,
-         Conversions<Unit::SpecificEnergy,
-         Unit::SpecificEnergy::InchPoundPerSlinch>::ToStandard<NumericType>},
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::SpecificEnergy>{4};
 
 }  // namespace Internal
 
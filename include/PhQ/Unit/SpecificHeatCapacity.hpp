@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_SPECIFIC_HEAT_CAPACITY_HPP
 #define PHQ_UNIT_SPECIFIC_HEAT_CAPACITY_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -88,340 +87,340 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::SpecificHeatCa
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::SpecificHeatCapacity> ConsistentUnits<
-    Unit::SpecificHeatCapacity>{
-    {UnitSystem::MetreKilogramSecondKelvin,  Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {UnitSystem::MillimetreGramSecondKelvin, Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {UnitSystem::FootPoundSecondRankine,     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {UnitSystem::InchPoundSecondRankine,     Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-};
+inline constexpr std::array<std::pair<UnitSystem, Unit::SpecificHeatCapacity>, 4>
+    ConsistentUnits<Unit::SpecificHeatCapacity>{{
+        {UnitSystem::MetreKilogramSecondKelvin,  Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {UnitSystem::MillimetreGramSecondKelvin, Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {UnitSystem::FootPoundSecondRankine,     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {UnitSystem::InchPoundSecondRankine,     Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+}};
 
 template <>
-inline const std::map<Unit::SpecificHeatCapacity, UnitSystem> RelatedUnitSystems<
-    Unit::SpecificHeatCapacity>{
-    {Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin,    UnitSystem::MetreKilogramSecondKelvin },
-    {Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin,    UnitSystem::MillimetreGramSecondKelvin},
-    {Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine,   UnitSystem::FootPoundSecondRankine    },
-    {Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine, UnitSystem::InchPoundSecondRankine    },
-};
+inline constexpr std::array<std::pair<Unit::SpecificHeatCapacity, UnitSystem>, 4>
+    RelatedUnitSystems<Unit::SpecificHeatCapacity>{{
+        {Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin,    UnitSystem::MetreKilogramSecondKelvin },
+        {Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin,    UnitSystem::MillimetreGramSecondKelvin},
+        {Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine,   UnitSystem::FootPoundSecondRankine    },
+        {Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine, UnitSystem::InchPoundSecondRankine    },
+}};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::SpecificHeatCapacity, std::string_view>
-    Abbreviations<Unit::SpecificHeatCapacity>{
+inline constexpr std::array<std::pair<Unit::SpecificHeatCapacity, std::string_view>, 4>
+    Abbreviations<Unit::SpecificHeatCapacity>{{
         {Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin,    "J/kg/K"          },
         {Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin,    "nJ/g/K"          },
         {Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine,   "ft·lbf/slug/°R"  },
         {Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine, "in·lbf/slinch/°R"},
-};
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::SpecificHeatCapacity> Spellings<
-    Unit::SpecificHeatCapacity>{
-    {"J/kg/K",             Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"J/(kg·K)",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"J/(kg*K)",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"N·m/kg/K",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"N·m/(kg·K)",         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"N*m/kg/K",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"N*m/(kg*K)",         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m·N/kg/K",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m·N/(kg·K)",         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m*N/kg/K",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m*N/(kg*K)",         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m^2/s^2/K",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m^2/(s^2·K)",        Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m^2/(s^2*K)",        Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m2/s2/K",            Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m2/(s2·K)",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m2/(s2*K)",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"J/kg/°C",            Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"J/(kg·°C)",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"J/(kg*°C)",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"N·m/kg/°C",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"N·m/(kg·°C)",        Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"N*m/kg/°C",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"N*m/(kg*°C)",        Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m·N/kg/°C",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m·N/(kg·°C)",        Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m*N/kg/°C",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m*N/(kg*°C)",        Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m^2/s^2/°C",         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m^2/(s^2·°C)",       Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m^2/(s^2*°C)",       Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m2/s2/°C",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m2/(s2·°C)",         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m2/(s2*°C)",         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"J/kg/C",             Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"J/(kg·C)",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"J/(kg*C)",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"N·m/kg/C",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"N·m/(kg·C)",         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"N*m/kg/C",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"N*m/(kg*C)",         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m·N/kg/C",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m·N/(kg·C)",         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m*N/kg/C",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m*N/(kg*C)",         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m^2/s^2/C",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m^2/(s^2·C)",        Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m^2/(s^2*C)",        Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m2/s2/C",            Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m2/(s2·C)",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"m2/(s2*C)",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
-    {"nJ/g/K",             Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"nJ/(g*K)",           Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"nJ/(g·K)",           Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"μN·mm/g/K",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"μN·mm/(g·K)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"μN*mm/g/K",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"μN*mm/(g*K)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"uN·mm/g/K",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"uN·mm/(g·K)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"uN*mm/g/K",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"uN*mm/(g*K)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm·μN/g/K",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm·μN/(g·K)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm*μN/g/K",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm*μN/(g*K)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm·uN/g/K",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm·uN/(g·K)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm*uN/g/K",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm*uN/(g*K)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm^2/s^2/K",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm^2/(s^2·K)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm^2/(s^2*K)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm2/s2/K",           Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm2/(s2·K)",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm2/(s2*K)",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"nJ/g/°C",            Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"nJ/(g*°C)",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"nJ/(g·°C)",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"μN·mm/g/°C",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"μN·mm/(g·°C)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"μN*mm/g/°C",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"μN*mm/(g*°C)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"uN·mm/g/°C",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"uN·mm/(g·°C)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"uN*mm/g/°C",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"uN*mm/(g*°C)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm·μN/g/°C",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm·μN/(g·°C)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm*μN/g/°C",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm*μN/(g*°C)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm·uN/g/°C",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm·uN/(g·°C)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm*uN/g/°C",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm*uN/(g*°C)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm^2/s^2/°C",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm^2/(s^2·°C)",      Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm^2/(s^2*°C)",      Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm2/s2/°C",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm2/(s2·°C)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm2/(s2*°C)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"nJ/g/C",             Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"nJ/(g*C)",           Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"nJ/(g·C)",           Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"μN·mm/g/C",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"μN·mm/(g·C)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"μN*mm/g/C",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"μN*mm/(g*C)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"uN·mm/g/C",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"uN·mm/(g·C)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"uN*mm/g/C",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"uN*mm/(g*C)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm·μN/g/C",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm·μN/(g·C)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm*μN/g/C",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm*μN/(g*C)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm·uN/g/C",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm·uN/(g·C)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm*uN/g/C",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm*uN/(g*C)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm^2/s^2/C",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm^2/(s^2·C)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm^2/(s^2*C)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm2/s2/C",           Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm2/(s2·C)",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"mm2/(s2*C)",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
-    {"ft·lbf/slug/°R",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft·lbf/(slug·°R)",   Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft*lbf/slug/°R",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft*lbf/(slug*°R)",   Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lbf·ft/slug/°R",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lbf·ft/(slug·°R)",   Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lbf*ft/slug/°R",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lbf*ft/(slug*°R)",   Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft·lb/slug/°R",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft·lb/(slug·°R)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft*lb/slug/°R",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft*lb/(slug*°R)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lb·ft/slug/°R",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lb·ft/(slug·°R)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lb*ft/slug/°R",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lb*ft/(slug*°R)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft^2/s^2/°R",        Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft^2/(s^2·°R)",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft^2/(s^2*°R)",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft2/s2/°R",          Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft2/(s2·°R)",        Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft2/(s2*°R)",        Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft·lbf/slug/R",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft·lbf/(slug·R)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft*lbf/slug/R",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft*lbf/(slug*R)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lbf·ft/slug/R",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lbf·ft/(slug·R)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lbf*ft/slug/R",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lbf*ft/(slug*R)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft·lb/slug/R",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft·lb/(slug·R)",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft*lb/slug/R",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft*lb/(slug*R)",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lb·ft/slug/R",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lb·ft/(slug·R)",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lb*ft/slug/R",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lb*ft/(slug*R)",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft^2/s^2/R",         Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft^2/(s^2·R)",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft^2/(s^2*R)",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft2/s2/R",           Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft2/(s2·R)",         Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft2/(s2*R)",         Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft·lbf/slug/°F",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft·lbf/(slug·°F)",   Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft*lbf/slug/°F",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft*lbf/(slug*°F)",   Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lbf·ft/slug/°F",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lbf·ft/(slug·°F)",   Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lbf*ft/slug/°F",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lbf*ft/(slug*°F)",   Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft·lb/slug/°F",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft·lb/(slug·°F)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft*lb/slug/°F",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft*lb/(slug*°F)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lb·ft/slug/°F",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lb·ft/(slug·°F)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lb*ft/slug/°F",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lb*ft/(slug*°F)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft^2/s^2/°F",        Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft^2/(s^2·°F)",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft^2/(s^2*°F)",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft2/s2/°F",          Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft2/(s2·°F)",        Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft2/(s2*°F)",        Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft·lbf/slug/F",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft·lbf/(slug·F)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft*lbf/slug/F",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft*lbf/(slug*F)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lbf·ft/slug/F",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lbf·ft/(slug·F)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lbf*ft/slug/F",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lbf*ft/(slug*F)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft·lb/slug/F",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft·lb/(slug·F)",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft*lb/slug/F",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft*lb/(slug*F)",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lb·ft/slug/F",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lb·ft/(slug·F)",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lb*ft/slug/F",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"lb*ft/(slug*F)",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft^2/s^2/F",         Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft^2/(s^2·F)",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft^2/(s^2*F)",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft2/s2/F",           Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft2/(s2·F)",         Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"ft2/(s2*F)",         Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
-    {"in·lbf/slinch/°R",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in·lbf/(slinch·°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in*lbf/slinch/°R",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in*lbf/(slinch*°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lbf·in/slinch/°R",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lbf·in/(slinch·°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lbf*in/slinch/°R",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lbf*in/(slinch*°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in·lb/slinch/°R",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in·lb/(slinch·°R)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in*lb/slinch/°R",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in*lb/(slinch*°R)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lb·in/slinch/°R",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lb·in/(slinch·°R)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lb*in/slinch/°R",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lb*in/(slinch*°R)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in^2/s^2/°R",        Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in^2/(s^2·°R)",      Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in^2/(s^2*°R)",      Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in2/s2/°R",          Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in2/(s2·°R)",        Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in2/(s2*°R)",        Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in·lbf/slinch/R",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in·lbf/(slinch·R)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in*lbf/slinch/R",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in*lbf/(slinch*R)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lbf·in/slinch/R",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lbf·in/(slinch·R)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lbf*in/slinch/R",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lbf*in/(slinch*R)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in·lb/slinch/R",     Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in·lb/(slinch·R)",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in*lb/slinch/R",     Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in*lb/(slinch*R)",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lb·in/slinch/R",     Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lb·in/(slinch·R)",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lb*in/slinch/R",     Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lb*in/(slinch*R)",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in^2/s^2/R",         Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in^2/(s^2·R)",       Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in^2/(s^2*R)",       Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in2/s2/R",           Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in2/(s2·R)",         Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in2/(s2*R)",         Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in·lbf/slinch/°F",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in·lbf/(slinch·°F)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in*lbf/slinch/°F",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in*lbf/(slinch*°F)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lbf·in/slinch/°F",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lbf·in/(slinch·°F)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lbf*in/slinch/°F",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lbf*in/(slinch*°F)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in·lb/slinch/°F",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in·lb/(slinch·°F)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in*lb/slinch/°F",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in*lb/(slinch*°F)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lb·in/slinch/°F",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lb·in/(slinch·°F)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lb*in/slinch/°F",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lb*in/(slinch*°F)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in^2/s^2/°F",        Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in^2/(s^2·°F)",      Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in^2/(s^2*°F)",      Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in2/s2/°F",          Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in2/(s2·°F)",        Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in2/(s2*°F)",        Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in·lbf/slinch/F",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in·lbf/(slinch·F)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in*lbf/slinch/F",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in*lbf/(slinch*F)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lbf·in/slinch/F",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lbf·in/(slinch·F)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lbf*in/slinch/F",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lbf*in/(slinch*F)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in·lb/slinch/F",     Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in·lb/(slinch·F)",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in*lb/slinch/F",     Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in*lb/(slinch*F)",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lb·in/slinch/F",     Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lb·in/(slinch·F)",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lb*in/slinch/F",     Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"lb*in/(slinch*F)",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in^2/s^2/F",         Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in^2/(s^2·F)",       Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in^2/(s^2*F)",       Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in2/s2/F",           Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in2/(s2·F)",         Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-    {"in2/(s2*F)",         Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
-};
+inline constexpr std::array<std::pair<std::string_view, Unit::SpecificHeatCapacity>, 302>
+    Spellings<Unit::SpecificHeatCapacity>{{
+        {"J/(kg*C)",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"J/(kg*K)",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"J/(kg*°C)",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"J/(kg·C)",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"J/(kg·K)",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"J/(kg·°C)",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"J/kg/C",             Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"J/kg/K",             Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"J/kg/°C",            Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"N*m/(kg*C)",         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"N*m/(kg*K)",         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"N*m/(kg*°C)",        Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"N*m/kg/C",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"N*m/kg/K",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"N*m/kg/°C",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"N·m/(kg·C)",         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"N·m/(kg·K)",         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"N·m/(kg·°C)",        Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"N·m/kg/C",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"N·m/kg/K",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"N·m/kg/°C",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"ft*lb/(slug*F)",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft*lb/(slug*R)",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft*lb/(slug*°F)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft*lb/(slug*°R)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft*lb/slug/F",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft*lb/slug/R",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft*lb/slug/°F",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft*lb/slug/°R",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft*lbf/(slug*F)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft*lbf/(slug*R)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft*lbf/(slug*°F)",   Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft*lbf/(slug*°R)",   Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft*lbf/slug/F",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft*lbf/slug/R",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft*lbf/slug/°F",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft*lbf/slug/°R",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft2/(s2*F)",         Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft2/(s2*R)",         Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft2/(s2*°F)",        Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft2/(s2*°R)",        Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft2/(s2·F)",         Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft2/(s2·R)",         Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft2/(s2·°F)",        Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft2/(s2·°R)",        Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft2/s2/F",           Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft2/s2/R",           Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft2/s2/°F",          Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft2/s2/°R",          Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft^2/(s^2*F)",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft^2/(s^2*R)",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft^2/(s^2*°F)",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft^2/(s^2*°R)",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft^2/(s^2·F)",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft^2/(s^2·R)",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft^2/(s^2·°F)",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft^2/(s^2·°R)",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft^2/s^2/F",         Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft^2/s^2/R",         Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft^2/s^2/°F",        Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft^2/s^2/°R",        Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft·lb/(slug·F)",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft·lb/(slug·R)",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft·lb/(slug·°F)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft·lb/(slug·°R)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft·lb/slug/F",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft·lb/slug/R",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft·lb/slug/°F",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft·lb/slug/°R",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft·lbf/(slug·F)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft·lbf/(slug·R)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft·lbf/(slug·°F)",   Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft·lbf/(slug·°R)",   Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft·lbf/slug/F",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft·lbf/slug/R",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft·lbf/slug/°F",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"ft·lbf/slug/°R",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"in*lb/(slinch*F)",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in*lb/(slinch*R)",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in*lb/(slinch*°F)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in*lb/(slinch*°R)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in*lb/slinch/F",     Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in*lb/slinch/R",     Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in*lb/slinch/°F",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in*lb/slinch/°R",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in*lbf/(slinch*F)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in*lbf/(slinch*R)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in*lbf/(slinch*°F)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in*lbf/(slinch*°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in*lbf/slinch/F",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in*lbf/slinch/R",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in*lbf/slinch/°F",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in*lbf/slinch/°R",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in2/(s2*F)",         Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in2/(s2*R)",         Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in2/(s2*°F)",        Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in2/(s2*°R)",        Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in2/(s2·F)",         Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in2/(s2·R)",         Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in2/(s2·°F)",        Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in2/(s2·°R)",        Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in2/s2/F",           Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in2/s2/R",           Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in2/s2/°F",          Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in2/s2/°R",          Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in^2/(s^2*F)",       Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in^2/(s^2*R)",       Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in^2/(s^2*°F)",      Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in^2/(s^2*°R)",      Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in^2/(s^2·F)",       Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in^2/(s^2·R)",       Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in^2/(s^2·°F)",      Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in^2/(s^2·°R)",      Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in^2/s^2/F",         Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in^2/s^2/R",         Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in^2/s^2/°F",        Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in^2/s^2/°R",        Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in·lb/(slinch·F)",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in·lb/(slinch·R)",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in·lb/(slinch·°F)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in·lb/(slinch·°R)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in·lb/slinch/F",     Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in·lb/slinch/R",     Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in·lb/slinch/°F",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in·lb/slinch/°R",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in·lbf/(slinch·F)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in·lbf/(slinch·R)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in·lbf/(slinch·°F)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in·lbf/(slinch·°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in·lbf/slinch/F",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in·lbf/slinch/R",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in·lbf/slinch/°F",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"in·lbf/slinch/°R",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lb*ft/(slug*F)",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lb*ft/(slug*R)",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lb*ft/(slug*°F)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lb*ft/(slug*°R)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lb*ft/slug/F",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lb*ft/slug/R",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lb*ft/slug/°F",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lb*ft/slug/°R",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lb*in/(slinch*F)",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lb*in/(slinch*R)",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lb*in/(slinch*°F)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lb*in/(slinch*°R)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lb*in/slinch/F",     Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lb*in/slinch/R",     Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lb*in/slinch/°F",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lb*in/slinch/°R",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lbf*ft/(slug*F)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lbf*ft/(slug*R)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lbf*ft/(slug*°F)",   Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lbf*ft/(slug*°R)",   Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lbf*ft/slug/F",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lbf*ft/slug/R",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lbf*ft/slug/°F",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lbf*ft/slug/°R",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lbf*in/(slinch*F)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lbf*in/(slinch*R)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lbf*in/(slinch*°F)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lbf*in/(slinch*°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lbf*in/slinch/F",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lbf*in/slinch/R",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lbf*in/slinch/°F",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lbf*in/slinch/°R",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lbf·ft/(slug·F)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lbf·ft/(slug·R)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lbf·ft/(slug·°F)",   Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lbf·ft/(slug·°R)",   Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lbf·ft/slug/F",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lbf·ft/slug/R",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lbf·ft/slug/°F",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lbf·ft/slug/°R",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lbf·in/(slinch·F)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lbf·in/(slinch·R)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lbf·in/(slinch·°F)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lbf·in/(slinch·°R)", Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lbf·in/slinch/F",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lbf·in/slinch/R",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lbf·in/slinch/°F",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lbf·in/slinch/°R",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lb·ft/(slug·F)",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lb·ft/(slug·R)",     Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lb·ft/(slug·°F)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lb·ft/(slug·°R)",    Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lb·ft/slug/F",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lb·ft/slug/R",       Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lb·ft/slug/°F",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lb·ft/slug/°R",      Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine  },
+        {"lb·in/(slinch·F)",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lb·in/(slinch·R)",   Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lb·in/(slinch·°F)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lb·in/(slinch·°R)",  Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lb·in/slinch/F",     Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lb·in/slinch/R",     Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lb·in/slinch/°F",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"lb·in/slinch/°R",    Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine},
+        {"m*N/(kg*C)",         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m*N/(kg*K)",         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m*N/(kg*°C)",        Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m*N/kg/C",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m*N/kg/K",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m*N/kg/°C",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m2/(s2*C)",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m2/(s2*K)",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m2/(s2*°C)",         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m2/(s2·C)",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m2/(s2·K)",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m2/(s2·°C)",         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m2/s2/C",            Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m2/s2/K",            Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m2/s2/°C",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m^2/(s^2*C)",        Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m^2/(s^2*K)",        Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m^2/(s^2*°C)",       Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m^2/(s^2·C)",        Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m^2/(s^2·K)",        Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m^2/(s^2·°C)",       Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m^2/s^2/C",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m^2/s^2/K",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m^2/s^2/°C",         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"mm*uN/(g*C)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm*uN/(g*K)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm*uN/(g*°C)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm*uN/g/C",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm*uN/g/K",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm*uN/g/°C",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm*μN/(g*C)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm*μN/(g*K)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm*μN/(g*°C)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm*μN/g/C",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm*μN/g/K",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm*μN/g/°C",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm2/(s2*C)",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm2/(s2*K)",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm2/(s2*°C)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm2/(s2·C)",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm2/(s2·K)",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm2/(s2·°C)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm2/s2/C",           Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm2/s2/K",           Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm2/s2/°C",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm^2/(s^2*C)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm^2/(s^2*K)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm^2/(s^2*°C)",      Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm^2/(s^2·C)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm^2/(s^2·K)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm^2/(s^2·°C)",      Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm^2/s^2/C",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm^2/s^2/K",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm^2/s^2/°C",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm·uN/(g·C)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm·uN/(g·K)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm·uN/(g·°C)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm·uN/g/C",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm·uN/g/K",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm·uN/g/°C",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm·μN/(g·C)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm·μN/(g·K)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm·μN/(g·°C)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm·μN/g/C",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm·μN/g/K",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"mm·μN/g/°C",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"m·N/(kg·C)",         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m·N/(kg·K)",         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m·N/(kg·°C)",        Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m·N/kg/C",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m·N/kg/K",           Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"m·N/kg/°C",          Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin   },
+        {"nJ/(g*C)",           Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"nJ/(g*K)",           Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"nJ/(g*°C)",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"nJ/(g·C)",           Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"nJ/(g·K)",           Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"nJ/(g·°C)",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"nJ/g/C",             Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"nJ/g/K",             Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"nJ/g/°C",            Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"uN*mm/(g*C)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"uN*mm/(g*K)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"uN*mm/(g*°C)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"uN*mm/g/C",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"uN*mm/g/K",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"uN*mm/g/°C",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"uN·mm/(g·C)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"uN·mm/(g·K)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"uN·mm/(g·°C)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"uN·mm/g/C",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"uN·mm/g/K",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"uN·mm/g/°C",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"μN*mm/(g*C)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"μN*mm/(g*K)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"μN*mm/(g*°C)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"μN*mm/g/C",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"μN*mm/g/K",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"μN*mm/g/°C",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"μN·mm/(g·C)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"μN·mm/(g·K)",        Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"μN·mm/(g·°C)",       Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"μN·mm/g/C",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"μN·mm/g/K",          Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+        {"μN·mm/g/°C",         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin   },
+}};
 
 // clang-format on
 
@@ -489,49 +488,8 @@ Conversion<Unit::SpecificHeatCapacity, Unit::SpecificHeatCapacity::InchPoundPerS
            * static_cast<NumericType>(0.0254L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::SpecificHeatCapacity,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::SpecificHeatCapacity, NumericType>{
-        {Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin,
-         Conversions<
-             Unit::SpecificHeatCapacity,
-         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin>::FromStandard<NumericType>   },
-        {Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin,
-         Conversions<
-             Unit::SpecificHeatCapacity,
-         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin>::FromStandard<NumericType>   },
-        {Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine,
-         Conversions<
-             Unit::SpecificHeatCapacity,
-         Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine>::FromStandard<NumericType>  },
-        {Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine,
-         Conversions<
-             Unit::SpecificHeatCapacity,
-         Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine>::FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::SpecificHeatCapacity,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::SpecificHeatCapacity, NumericType>{
-        {Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin,
-         Conversions<
-             Unit::SpecificHeatCapacity,
-         Unit::SpecificHeatCapacity::JoulePerKilogramPerKelvin>::ToStandard<NumericType>   },
-        {Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin,
-         Conversions<
-             Unit::SpecificHeatCapacity,
-         Unit::SpecificHeatCapacity::NanojoulePerGramPerKelvin>::ToStandard<NumericType>   },
-        {Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine,
-         Conversions<
-             Unit::SpecificHeatCapacity,
-         Unit::SpecificHeatCapacity::FootPoundPerSlugPerRankine>::ToStandard<NumericType>  },
-        {Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine,
-         Conversions<
-             Unit::SpecificHeatCapacity,
-         Unit::SpecificHeatCapacity::InchPoundPerSlinchPerRankine>::ToStandard<NumericType>},
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::SpecificHeatCapacity>{4};
 
 }  // namespace Internal
 
@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_SPECIFIC_POWER_HPP
 #define PHQ_UNIT_SPECIFIC_POWER_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -87,157 +86,160 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::SpecificPower
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::SpecificPower> ConsistentUnits<Unit::SpecificPower>{
-    {UnitSystem::MetreKilogramSecondKelvin,  Unit::SpecificPower::WattPerKilogram            },
-    {UnitSystem::MillimetreGramSecondKelvin, Unit::SpecificPower::NanowattPerGram            },
-    {UnitSystem::FootPoundSecondRankine,     Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {UnitSystem::InchPoundSecondRankine,     Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-};
+inline constexpr std::array<std::pair<UnitSystem, Unit::SpecificPower>, 4>
+    ConsistentUnits<Unit::SpecificPower>{{
+        {UnitSystem::MetreKilogramSecondKelvin,  Unit::SpecificPower::WattPerKilogram            },
+        {UnitSystem::MillimetreGramSecondKelvin, Unit::SpecificPower::NanowattPerGram            },
+        {UnitSystem::FootPoundSecondRankine,     Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {UnitSystem::InchPoundSecondRankine,     Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+}};
 
 template <>
-inline const std::map<Unit::SpecificPower, UnitSystem> RelatedUnitSystems<Unit::SpecificPower>{
-    {Unit::SpecificPower::WattPerKilogram,             UnitSystem::MetreKilogramSecondKelvin },
-    {Unit::SpecificPower::NanowattPerGram,             UnitSystem::MillimetreGramSecondKelvin},
-    {Unit::SpecificPower::FootPoundPerSlugPerSecond,   UnitSystem::FootPoundSecondRankine    },
-    {Unit::SpecificPower::InchPoundPerSlinchPerSecond, UnitSystem::InchPoundSecondRankine    },
-};
+inline constexpr std::array<std::pair<Unit::SpecificPower, UnitSystem>, 4>
+    RelatedUnitSystems<Unit::SpecificPower>{{
+        {Unit::SpecificPower::WattPerKilogram,             UnitSystem::MetreKilogramSecondKelvin },
+        {Unit::SpecificPower::NanowattPerGram,             UnitSystem::MillimetreGramSecondKelvin},
+        {Unit::SpecificPower::FootPoundPerSlugPerSecond,   UnitSystem::FootPoundSecondRankine    },
+        {Unit::SpecificPower::InchPoundPerSlinchPerSecond, UnitSystem::InchPoundSecondRankine    },
+}};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::SpecificPower, std::string_view> Abbreviations<Unit::SpecificPower>{
-    {Unit::SpecificPower::WattPerKilogram,             "W/kg"           },
-    {Unit::SpecificPower::NanowattPerGram,             "nW/g"           },
-    {Unit::SpecificPower::FootPoundPerSlugPerSecond,   "ft·lbf/slug/s"  },
-    {Unit::SpecificPower::InchPoundPerSlinchPerSecond, "in·lbf/slinch/s"},
-};
+inline constexpr std::array<std::pair<Unit::SpecificPower, std::string_view>, 4>
+    Abbreviations<Unit::SpecificPower>{{
+        {Unit::SpecificPower::WattPerKilogram,             "W/kg"           },
+        {Unit::SpecificPower::NanowattPerGram,             "nW/g"           },
+        {Unit::SpecificPower::FootPoundPerSlugPerSecond,   "ft·lbf/slug/s"  },
+        {Unit::SpecificPower::InchPoundPerSlinchPerSecond, "in·lbf/slinch/s"},
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::SpecificPower> Spellings<
-    Unit::SpecificPower>{
-    {"W/kg",              Unit::SpecificPower::WattPerKilogram            },
-    {"N·m/kg/s",          Unit::SpecificPower::WattPerKilogram            },
-    {"N*m/kg/s",          Unit::SpecificPower::WattPerKilogram            },
-    {"N·m/(kg·s)",        Unit::SpecificPower::WattPerKilogram            },
-    {"N*m/(kg*s)",        Unit::SpecificPower::WattPerKilogram            },
-    {"N·m/s/kg",          Unit::SpecificPower::WattPerKilogram            },
-    {"N*m/s/kg",          Unit::SpecificPower::WattPerKilogram            },
-    {"N·m/(s·kg)",        Unit::SpecificPower::WattPerKilogram            },
-    {"N*m/(s*kg)",        Unit::SpecificPower::WattPerKilogram            },
-    {"m·N/kg/s",          Unit::SpecificPower::WattPerKilogram            },
-    {"m*N/kg/s",          Unit::SpecificPower::WattPerKilogram            },
-    {"m·N/(kg·s)",        Unit::SpecificPower::WattPerKilogram            },
-    {"m*N/(kg*s)",        Unit::SpecificPower::WattPerKilogram            },
-    {"m·N/s/kg",          Unit::SpecificPower::WattPerKilogram            },
-    {"m*N/s/kg",          Unit::SpecificPower::WattPerKilogram            },
-    {"m·N/(s·kg)",        Unit::SpecificPower::WattPerKilogram            },
-    {"m*N/(s*kg)",        Unit::SpecificPower::WattPerKilogram            },
-    {"m^2/s^3",           Unit::SpecificPower::WattPerKilogram            },
-    {"m2/s3",             Unit::SpecificPower::WattPerKilogram            },
-    {"nW/g",              Unit::SpecificPower::NanowattPerGram            },
-    {"μN·mm/g/s",         Unit::SpecificPower::NanowattPerGram            },
-    {"μN*mm/g/s",         Unit::SpecificPower::NanowattPerGram            },
-    {"μN·mm/(g·s)",       Unit::SpecificPower::NanowattPerGram            },
-    {"μN*mm/(g*s)",       Unit::SpecificPower::NanowattPerGram            },
-    {"uN·mm/g/s",         Unit::SpecificPower::NanowattPerGram            },
-    {"uN*mm/g/s",         Unit::SpecificPower::NanowattPerGram            },
-    {"uN·mm/(g·s)",       Unit::SpecificPower::NanowattPerGram            },
-    {"uN*mm/(g*s)",       Unit::SpecificPower::NanowattPerGram            },
-    {"μN·mm/s/g",         Unit::SpecificPower::NanowattPerGram            },
-    {"μN*mm/s/g",         Unit::SpecificPower::NanowattPerGram            },
-    {"μN·mm/(s·g)",       Unit::SpecificPower::NanowattPerGram            },
-    {"μN*mm/(s*g)",       Unit::SpecificPower::NanowattPerGram            },
-    {"uN·mm/s/g",         Unit::SpecificPower::NanowattPerGram            },
-    {"uN*mm/s/g",         Unit::SpecificPower::NanowattPerGram            },
-    {"uN·mm/(s·g)",       Unit::SpecificPower::NanowattPerGram            },
-    {"uN*mm/(s*g)",       Unit::SpecificPower::NanowattPerGram            },
-    {"mm·μN/g/s",         Unit::SpecificPower::NanowattPerGram            },
-    {"mm*μN/g/s",         Unit::SpecificPower::NanowattPerGram            },
-    {"mm·μN/(g·s)",       Unit::SpecificPower::NanowattPerGram            },
-    {"mm*μN/(g*s)",       Unit::SpecificPower::NanowattPerGram            },
-    {"mm·uN/g/s",         Unit::SpecificPower::NanowattPerGram            },
-    {"mm*uN/g/s",         Unit::SpecificPower::NanowattPerGram            },
-    {"mm·uN/(g·s)",       Unit::SpecificPower::NanowattPerGram            },
-    {"mm*uN/(g*s)",       Unit::SpecificPower::NanowattPerGram            },
-    {"mm·μN/s/g",         Unit::SpecificPower::NanowattPerGram            },
-    {"mm*μN/s/g",         Unit::SpecificPower::NanowattPerGram            },
-    {"mm·μN/(s·g)",       Unit::SpecificPower::NanowattPerGram            },
-    {"mm*μN/(s*g)",       Unit::SpecificPower::NanowattPerGram            },
-    {"mm·uN/s/g",         Unit::SpecificPower::NanowattPerGram            },
-    {"mm*uN/s/g",         Unit::SpecificPower::NanowattPerGram            },
-    {"mm·uN/(s·g)",       Unit::SpecificPower::NanowattPerGram            },
-    {"mm*uN/(s*g)",       Unit::SpecificPower::NanowattPerGram            },
-    {"mm^2/s^3",          Unit::SpecificPower::NanowattPerGram            },
-    {"mm2/s3",            Unit::SpecificPower::NanowattPerGram            },
-    {"ft·lbf/slug/s",     Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"ft*lbf/slug/s",     Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"ft·lbf/(slug·s)",   Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"ft*lbf/(slug*s)",   Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"ft·lbf/s/slug",     Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"ft*lbf/s/slug",     Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"ft·lbf/(s·slug)",   Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"ft*lbf/(s*slug)",   Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"lbf·ft/slug/s",     Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"lbf*ft/slug/s",     Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"lbf·ft/(slug·s)",   Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"lbf*ft/(slug*s)",   Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"lbf·ft/s/slug",     Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"lbf*ft/s/slug",     Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"lbf·ft/(s·slug)",   Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"lbf*ft/(s*slug)",   Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"ft·lb/slug/s",      Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"ft*lb/slug/s",      Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"ft·lb/(slug·s)",    Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"ft*lb/(slug*s)",    Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"ft·lb/s/slug",      Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"ft*lb/s/slug",      Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"ft·lb/(s·slug)",    Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"ft*lb/(s*slug)",    Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"lb·ft/slug/s",      Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"lb*ft/slug/s",      Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"lb·ft/(slug·s)",    Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"lb*ft/(slug*s)",    Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"lb·ft/s/slug",      Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"lb*ft/s/slug",      Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"lb·ft/(s·slug)",    Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"lb*ft/(s*slug)",    Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"ft^2/s^3",          Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"ft2/s3",            Unit::SpecificPower::FootPoundPerSlugPerSecond  },
-    {"in·lbf/slinch/s",   Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"in*lbf/slinch/s",   Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"in·lbf/(slinch·s)", Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"in*lbf/(slinch*s)", Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"in·lbf/s/slinch",   Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"in*lbf/s/slinch",   Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"in·lbf/(s·slinch)", Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"in*lbf/(s*slinch)", Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"lbf·in/slinch/s",   Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"lbf*in/slinch/s",   Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"lbf·in/(slinch·s)", Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"lbf*in/(slinch*s)", Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"lbf·in/s/slinch",   Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"lbf*in/s/slinch",   Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"lbf·in/(s·slinch)", Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"lbf*in/(s*slinch)", Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"in·lb/slinch/s",    Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"in*lb/slinch/s",    Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"in·lb/(slinch·s)",  Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"in*lb/(slinch*s)",  Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"in·lb/s/slinch",    Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"in*lb/s/slinch",    Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"in·lb/(s·slinch)",  Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"in*lb/(s*slinch)",  Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"lb·in/slinch/s",    Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"lb*in/slinch/s",    Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"lb·in/(slinch·s)",  Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"lb*in/(slinch*s)",  Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"lb·in/s/slinch",    Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"lb*in/s/slinch",    Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"lb·in/(s·slinch)",  Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"lb*in/(s*slinch)",  Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"in^2/s^3",          Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-    {"in2/s3",            Unit::SpecificPower::InchPoundPerSlinchPerSecond},
-};
+inline constexpr std::array<std::pair<std::string_view, Unit::SpecificPower>, 122>
+    Spellings<Unit::SpecificPower>{{
+        {"N*m/(kg*s)",        Unit::SpecificPower::WattPerKilogram            },
+        {"N*m/(s*kg)",        Unit::SpecificPower::WattPerKilogram            },
+        {"N*m/kg/s",          Unit::SpecificPower::WattPerKilogram            },
+        {"N*m/s/kg",          Unit::SpecificPower::WattPerKilogram            },
+        {"N·m/(kg·s)",        Unit::SpecificPower::WattPerKilogram            },
+        {"N·m/(s·kg)",        Unit::SpecificPower::WattPerKilogram            },
+        {"N·m/kg/s",          Unit::SpecificPower::WattPerKilogram            },
+        {"N·m/s/kg",          Unit::SpecificPower::WattPerKilogram            },
+        {"W/kg",              Unit::SpecificPower::WattPerKilogram            },
+        {"ft*lb/(s*slug)",    Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"ft*lb/(slug*s)",    Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"ft*lb/s/slug",      Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"ft*lb/slug/s",      Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"ft*lbf/(s*slug)",   Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"ft*lbf/(slug*s)",   Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"ft*lbf/s/slug",     Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"ft*lbf/slug/s",     Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"ft2/s3",            Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"ft^2/s^3",          Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"ft·lb/(slug·s)",    Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"ft·lb/(s·slug)",    Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"ft·lb/s/slug",      Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"ft·lb/slug/s",      Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"ft·lbf/(slug·s)",   Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"ft·lbf/(s·slug)",   Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"ft·lbf/s/slug",     Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"ft·lbf/slug/s",     Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"in*lb/(s*slinch)",  Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"in*lb/(slinch*s)",  Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"in*lb/s/slinch",    Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"in*lb/slinch/s",    Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"in*lbf/(s*slinch)", Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"in*lbf/(slinch*s)", Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"in*lbf/s/slinch",   Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"in*lbf/slinch/s",   Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"in2/s3",            Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"in^2/s^3",          Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"in·lb/(slinch·s)",  Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"in·lb/(s·slinch)",  Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"in·lb/s/slinch",    Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"in·lb/slinch/s",    Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"in·lbf/(slinch·s)", Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"in·lbf/(s·slinch)", Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"in·lbf/s/slinch",   Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"in·lbf/slinch/s",   Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"lb*ft/(s*slug)",    Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"lb*ft/(slug*s)",    Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"lb*ft/s/slug",      Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"lb*ft/slug/s",      Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"lb*in/(s*slinch)",  Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"lb*in/(slinch*s)",  Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"lb*in/s/slinch",    Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"lb*in/slinch/s",    Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"lbf*ft/(s*slug)",   Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"lbf*ft/(slug*s)",   Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"lbf*ft/s/slug",     Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"lbf*ft/slug/s",     Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"lbf*in/(s*slinch)", Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"lbf*in/(slinch*s)", Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"lbf*in/s/slinch",   Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"lbf*in/slinch/s",   Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"lbf·ft/(slug·s)",   Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"lbf·ft/(s·slug)",   Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"lbf·ft/s/slug",     Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"lbf·ft/slug/s",     Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"lbf·in/(slinch·s)", Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"lbf·in/(s·slinch)", Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"lbf·in/s/slinch",   Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"lbf·in/slinch/s",   Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"lb·ft/(slug·s)",    Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"lb·ft/(s·slug)",    Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"lb·ft/s/slug",      Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"lb·ft/slug/s",      Unit::SpecificPower::FootPoundPerSlugPerSecond  },
+        {"lb·in/(slinch·s)",  Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"lb·in/(s·slinch)",  Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"lb·in/s/slinch",    Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"lb·in/slinch/s",    Unit::SpecificPower::InchPoundPerSlinchPerSecond},
+        {"m*N/(kg*s)",        Unit::SpecificPower::WattPerKilogram            },
+        {"m*N/(s*kg)",        Unit::SpecificPower::WattPerKilogram            },
+        {"m*N/kg/s",          Unit::SpecificPower::WattPerKilogram            },
+        {"m*N/s/kg",          Unit::SpecificPower::WattPerKilogram            },
+        {"m2/s3",             Unit::SpecificPower::WattPerKilogram            },
+        {"m^2/s^3",           Unit::SpecificPower::WattPerKilogram            },
+        {"mm*uN/(g*s)",       Unit::SpecificPower::NanowattPerGram            },
+        {"mm*uN/(s*g)",       Unit::SpecificPower::NanowattPerGram            },
+        {"mm*uN/g/s",         Unit::SpecificPower::NanowattPerGram            },
+        {"mm*uN/s/g",         Unit::SpecificPower::NanowattPerGram            },
+        {"mm*μN/(g*s)",       Unit::SpecificPower::NanowattPerGram            },
+        {"mm*μN/(s*g)",       Unit::SpecificPower::NanowattPerGram            },
+        {"mm*μN/g/s",         Unit::SpecificPower::NanowattPerGram            },
+        {"mm*μN/s/g",         Unit::SpecificPower::NanowattPerGram            },
+        {"mm2/s3",            Unit::SpecificPower::NanowattPerGram            },
+        {"mm^2/s^3",          Unit::SpecificPower::NanowattPerGram            },
+        {"mm·uN/(g·s)",       Unit::SpecificPower::NanowattPerGram            },
+        {"mm·uN/(s·g)",       Unit::SpecificPower::NanowattPerGram            },
+        {"mm·uN/g/s",         Unit::SpecificPower::NanowattPerGram            },
+        {"mm·uN/s/g",         Unit::SpecificPower::NanowattPerGram            },
+        {"mm·μN/(g·s)",       Unit::SpecificPower::NanowattPerGram            },
+        {"mm·μN/(s·g)",       Unit::SpecificPower::NanowattPerGram            },
+        {"mm·μN/g/s",         Unit::SpecificPower::NanowattPerGram            },
+        {"mm·μN/s/g",         Unit::SpecificPower::NanowattPerGram            },
+        {"m·N/(kg·s)",        Unit::SpecificPower::WattPerKilogram            },
+        {"m·N/(s·kg)",        Unit::SpecificPower::WattPerKilogram            },
+        {"m·N/kg/s",          Unit::SpecificPower::WattPerKilogram            },
+        {"m·N/s/kg",          Unit::SpecificPower::WattPerKilogram            },
+        {"nW/g",              Unit::SpecificPower::NanowattPerGram            },
+        {"uN*mm/(g*s)",       Unit::SpecificPower::NanowattPerGram            },
+        {"uN*mm/(s*g)",       Unit::SpecificPower::NanowattPerGram            },
+        {"uN*mm/g/s",         Unit::SpecificPower::NanowattPerGram            },
+        {"uN*mm/s/g",         Unit::SpecificPower::NanowattPerGram            },
+        {"uN·mm/(g·s)",       Unit::SpecificPower::NanowattPerGram            },
+        {"uN·mm/(s·g)",       Unit::SpecificPower::NanowattPerGram            },
+        {"uN·mm/g/s",         Unit::SpecificPower::NanowattPerGram            },
+        {"uN·mm/s/g",         Unit::SpecificPower::NanowattPerGram            },
+        {"μN*mm/(g*s)",       Unit::SpecificPower::NanowattPerGram            },
+        {"μN*mm/(s*g)",       Unit::SpecificPower::NanowattPerGram            },
+        {"μN*mm/g/s",         Unit::SpecificPower::NanowattPerGram            },
+        {"μN*mm/s/g",         Unit::SpecificPower::NanowattPerGram            },
+        {"μN·mm/(g·s)",       Unit::SpecificPower::NanowattPerGram            },
+        {"μN·mm/(s·g)",       Unit::SpecificPower::NanowattPerGram            },
+        {"μN·mm/g/s",         Unit::SpecificPower::NanowattPerGram            },
+        {"μN·mm/s/g",         Unit::SpecificPower::NanowattPerGram            },
+}};
 
 // clang-format on
 
@@ -301,41 +303,8 @@ Conversion<Unit::SpecificPower, Unit::SpecificPower::InchPoundPerSlinchPerSecond
   value *= static_cast<NumericType>(0.0254L) * static_cast<NumericType>(0.0254L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::SpecificPower,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::SpecificPower, NumericType>{
-        {Unit::SpecificPower::WattPerKilogram,
-         Conversions<Unit::SpecificPower,
-         Unit::SpecificPower::WattPerKilogram>::FromStandard<NumericType>            },
-        {Unit::SpecificPower::NanowattPerGram,
-         Conversions<Unit::SpecificPower,
-         Unit::SpecificPower::NanowattPerGram>::FromStandard<NumericType>            },
-        {Unit::SpecificPower::FootPoundPerSlugPerSecond,
-         Conversions<Unit::SpecificPower,
-         Unit::SpecificPower::FootPoundPerSlugPerSecond>::FromStandard<NumericType>  },
-        {Unit::SpecificPower::InchPoundPerSlinchPerSecond,
-         Conversions<Unit::SpecificPower,
-         Unit::SpecificPower::InchPoundPerSlinchPerSecond>::FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::SpecificPower,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::SpecificPower, NumericType>{
-        {Unit::SpecificPower::WattPerKilogram,
-         Conversions<Unit::SpecificPower,
-         Unit::SpecificPower::WattPerKilogram>::ToStandard<NumericType>            },
-        {Unit::SpecificPower::NanowattPerGram,
-         Conversions<Unit::SpecificPower,
-         Unit::SpecificPower::NanowattPerGram>::ToStandard<NumericType>            },
-        {Unit::SpecificPower::FootPoundPerSlugPerSecond,
-         Conversions<Unit::SpecificPower,
-         Unit::SpecificPower::FootPoundPerSlugPerSecond>::ToStandard<NumericType>  },
-        {Unit::SpecificPower::InchPoundPerSlinchPerSecond,
-         Conversions<Unit::SpecificPower,
-         Unit::SpecificPower::InchPoundPerSlinchPerSecond>::ToStandard<NumericType>},
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::SpecificPower>{4};
 
 }  // namespace Internal
 
@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_SPEED_HPP
 #define PHQ_UNIT_SPEED_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -191,126 +190,127 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Speed unit) {
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::Speed> ConsistentUnits<Unit::Speed>{
+inline constexpr std::array<std::pair<UnitSystem, Unit::Speed>, 4> ConsistentUnits<Unit::Speed>{{
     {UnitSystem::MetreKilogramSecondKelvin,  Unit::Speed::MetrePerSecond     },
     {UnitSystem::MillimetreGramSecondKelvin, Unit::Speed::MillimetrePerSecond},
     {UnitSystem::FootPoundSecondRankine,     Unit::Speed::FootPerSecond      },
     {UnitSystem::InchPoundSecondRankine,     Unit::Speed::InchPerSecond      },
-};
+}};
 
 template <>
-inline const std::map<Unit::Speed, UnitSystem> RelatedUnitSystems<Unit::Speed>{
+inline constexpr std::array<std::pair<Unit::Speed, UnitSystem>, 4> RelatedUnitSystems<Unit::Speed>{{
     {Unit::Speed::MetrePerSecond,      UnitSystem::MetreKilogramSecondKelvin },
-    {Unit::Speed::MillimetrePerSecond, UnitSystem::MillimetreGramSecondKelvin},
     {Unit::Speed::FootPerSecond,       UnitSystem::FootPoundSecondRankine    },
     {Unit::Speed::InchPerSecond,       UnitSystem::InchPoundSecondRankine    },
-};
+    {Unit::Speed::MillimetrePerSecond, UnitSystem::MillimetreGramSecondKelvin},
+}};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::Speed, std::string_view> Abbreviations<Unit::Speed>{
-    {Unit::Speed::NauticalMilePerSecond, "nmi/s"  },
-    {Unit::Speed::NauticalMilePerMinute, "nmi/min"},
-    {Unit::Speed::Knot,                  "kn"     },
-    {Unit::Speed::MilePerSecond,         "mi/s"   },
-    {Unit::Speed::MilePerMinute,         "mi/min" },
-    {Unit::Speed::MilePerHour,           "mi/hr"  },
-    {Unit::Speed::KilometrePerSecond,    "km/s"   },
-    {Unit::Speed::KilometrePerMinute,    "km/min" },
-    {Unit::Speed::KilometrePerHour,      "km/hr"  },
-    {Unit::Speed::MetrePerSecond,        "m/s"    },
-    {Unit::Speed::MetrePerMinute,        "m/min"  },
-    {Unit::Speed::MetrePerHour,          "m/hr"   },
-    {Unit::Speed::YardPerSecond,         "yd/s"   },
-    {Unit::Speed::YardPerMinute,         "yd/min" },
-    {Unit::Speed::YardPerHour,           "yd/hr"  },
-    {Unit::Speed::FootPerSecond,         "ft/s"   },
-    {Unit::Speed::FootPerMinute,         "ft/min" },
-    {Unit::Speed::FootPerHour,           "ft/hr"  },
-    {Unit::Speed::DecimetrePerSecond,    "dm/s"   },
-    {Unit::Speed::DecimetrePerMinute,    "dm/min" },
-    {Unit::Speed::DecimetrePerHour,      "dm/hr"  },
-    {Unit::Speed::InchPerSecond,         "in/s"   },
-    {Unit::Speed::InchPerMinute,         "in/min" },
-    {Unit::Speed::InchPerHour,           "in/hr"  },
-    {Unit::Speed::CentimetrePerSecond,   "cm/s"   },
-    {Unit::Speed::CentimetrePerMinute,   "cm/min" },
-    {Unit::Speed::CentimetrePerHour,     "cm/hr"  },
-    {Unit::Speed::MillimetrePerSecond,   "mm/s"   },
-    {Unit::Speed::MillimetrePerMinute,   "mm/min" },
-    {Unit::Speed::MillimetrePerHour,     "mm/hr"  },
-    {Unit::Speed::MilliinchPerSecond,    "mil/s"  },
-    {Unit::Speed::MilliinchPerMinute,    "mil/min"},
-    {Unit::Speed::MilliinchPerHour,      "mil/hr" },
-    {Unit::Speed::MicrometrePerSecond,   "μm/s"   },
-    {Unit::Speed::MicrometrePerMinute,   "μm/min" },
-    {Unit::Speed::MicrometrePerHour,     "μm/hr"  },
-    {Unit::Speed::MicroinchPerSecond,    "μin/s"  },
-    {Unit::Speed::MicroinchPerMinute,    "μin/min"},
-    {Unit::Speed::MicroinchPerHour,      "μin/hr" },
-};
-
-template <>
-inline const std::unordered_map<std::string_view, Unit::Speed> Spellings<Unit::Speed>{
-    {"nmi/s",         Unit::Speed::NauticalMilePerSecond},
-    {"nmi/min",       Unit::Speed::NauticalMilePerMinute},
+inline constexpr std::array<std::pair<Unit::Speed, std::string_view>, 39>
+    Abbreviations<Unit::Speed>{{
+        {Unit::Speed::NauticalMilePerSecond, "nmi/s"  },
+        {Unit::Speed::NauticalMilePerMinute, "nmi/min"},
+        {Unit::Speed::Knot,                  "kn"     },
+        {Unit::Speed::MilePerSecond,         "mi/s"   },
+        {Unit::Speed::MilePerMinute,         "mi/min" },
+        {Unit::Speed::MilePerHour,           "mi/hr"  },
+        {Unit::Speed::KilometrePerSecond,    "km/s"   },
+        {Unit::Speed::KilometrePerMinute,    "km/min" },
+        {Unit::Speed::KilometrePerHour,      "km/hr"  },
+        {Unit::Speed::MetrePerSecond,        "m/s"    },
+        {Unit::Speed::MetrePerMinute,        "m/min"  },
+        {Unit::Speed::MetrePerHour,          "m/hr"   },
+        {Unit::Speed::YardPerSecond,         "yd/s"   },
+        {Unit::Speed::YardPerMinute,         "yd/min" },
+        {Unit::Speed::YardPerHour,           "yd/hr"  },
+        {Unit::Speed::FootPerSecond,         "ft/s"   },
+        {Unit::Speed::FootPerMinute,         "ft/min" },
+        {Unit::Speed::FootPerHour,           "ft/hr"  },
+        {Unit::Speed::DecimetrePerSecond,    "dm/s"   },
+        {Unit::Speed::DecimetrePerMinute,    "dm/min" },
+        {Unit::Speed::DecimetrePerHour,      "dm/hr"  },
+        {Unit::Speed::InchPerSecond,         "in/s"   },
+        {Unit::Speed::InchPerMinute,         "in/min" },
+        {Unit::Speed::InchPerHour,           "in/hr"  },
+        {Unit::Speed::CentimetrePerSecond,   "cm/s"   },
+        {Unit::Speed::CentimetrePerMinute,   "cm/min" },
+        {Unit::Speed::CentimetrePerHour,     "cm/hr"  },
+        {Unit::Speed::MillimetrePerSecond,   "mm/s"   },
+        {Unit::Speed::MillimetrePerMinute,   "mm/min" },
+        {Unit::Speed::MillimetrePerHour,     "mm/hr"  },
+        {Unit::Speed::MilliinchPerSecond,    "mil/s"  },
+        {Unit::Speed::MilliinchPerMinute,    "mil/min"},
+        {Unit::Speed::MilliinchPerHour,      "mil/hr" },
+        {Unit::Speed::MicrometrePerSecond,   "μm/s"   },
+        {Unit::Speed::MicrometrePerMinute,   "μm/min" },
+        {Unit::Speed::MicrometrePerHour,     "μm/hr"  },
+        {Unit::Speed::MicroinchPerSecond,    "μin/s"  },
+        {Unit::Speed::MicroinchPerMinute,    "μin/min"},
+        {Unit::Speed::MicroinchPerHour,      "μin/hr" },
+}};
+
+template <>
+inline constexpr std::array<std::pair<std::string_view, Unit::Speed>, 57> Spellings<Unit::Speed>{{
+    {"cm/hr",         Unit::Speed::CentimetrePerHour    },
+    {"cm/min",        Unit::Speed::CentimetrePerMinute  },
+    {"cm/s",          Unit::Speed::CentimetrePerSecond  },
+    {"dm/hr",         Unit::Speed::DecimetrePerHour     },
+    {"dm/min",        Unit::Speed::DecimetrePerMinute   },
+    {"dm/s",          Unit::Speed::DecimetrePerSecond   },
+    {"ft/hr",         Unit::Speed::FootPerHour          },
+    {"ft/min",        Unit::Speed::FootPerMinute        },
+    {"ft/s",          Unit::Speed::FootPerSecond        },
+    {"in/hr",         Unit::Speed::InchPerHour          },
+    {"in/min",        Unit::Speed::InchPerMinute        },
+    {"in/s",          Unit::Speed::InchPerSecond        },
+    {"km/hr",         Unit::Speed::KilometrePerHour     },
+    {"km/min",        Unit::Speed::KilometrePerMinute   },
+    {"km/s",          Unit::Speed::KilometrePerSecond   },
     {"kn",            Unit::Speed::Knot                 },
     {"knot",          Unit::Speed::Knot                 },
     {"knots",         Unit::Speed::Knot                 },
-    {"nmi/hr",        Unit::Speed::Knot                 },
-    {"mi/s",          Unit::Speed::MilePerSecond        },
-    {"mi/min",        Unit::Speed::MilePerMinute        },
-    {"mi/hr",         Unit::Speed::MilePerHour          },
-    {"km/s",          Unit::Speed::KilometrePerSecond   },
-    {"km/min",        Unit::Speed::KilometrePerMinute   },
-    {"km/hr",         Unit::Speed::KilometrePerHour     },
-    {"m/s",           Unit::Speed::MetrePerSecond       },
-    {"m/min",         Unit::Speed::MetrePerMinute       },
     {"m/hr",          Unit::Speed::MetrePerHour         },
-    {"yd/s",          Unit::Speed::YardPerSecond        },
-    {"yd/min",        Unit::Speed::YardPerMinute        },
-    {"yd/hr",         Unit::Speed::YardPerHour          },
-    {"ft/s",          Unit::Speed::FootPerSecond        },
-    {"ft/min",        Unit::Speed::FootPerMinute        },
-    {"ft/hr",         Unit::Speed::FootPerHour          },
-    {"dm/s",          Unit::Speed::DecimetrePerSecond   },
-    {"dm/min",        Unit::Speed::DecimetrePerMinute   },
-    {"dm/hr",         Unit::Speed::DecimetrePerHour     },
-    {"in/s",          Unit::Speed::InchPerSecond        },
-    {"in/min",        Unit::Speed::InchPerMinute        },
-    {"in/hr",         Unit::Speed::InchPerHour          },
-    {"cm/s",          Unit::Speed::CentimetrePerSecond  },
-    {"cm/min",        Unit::Speed::CentimetrePerMinute  },
-    {"cm/hr",         Unit::Speed::CentimetrePerHour    },
-    {"mm/s",          Unit::Speed::MillimetrePerSecond  },
-    {"mm/min",        Unit::Speed::MillimetrePerMinute  },
-    {"mm/hr",         Unit::Speed::MillimetrePerHour    },
-    {"milin/s",       Unit::Speed::MilliinchPerSecond   },
-    {"milin/min",     Unit::Speed::MilliinchPerMinute   },
+    {"m/min",         Unit::Speed::MetrePerMinute       },
+    {"m/s",           Unit::Speed::MetrePerSecond       },
+    {"mi/hr",         Unit::Speed::MilePerHour          },
+    {"mi/min",        Unit::Speed::MilePerMinute        },
+    {"mi/s",          Unit::Speed::MilePerSecond        },
+    {"mil/hr",        Unit::Speed::MilliinchPerHour     },
+    {"mil/min",       Unit::Speed::MilliinchPerMinute   },
+    {"mil/s",         Unit::Speed::MilliinchPerSecond   },
     {"milin/hr",      Unit::Speed::MilliinchPerHour     },
-    {"milliinch/s",   Unit::Speed::MilliinchPerSecond   },
-    {"milliinch/min", Unit::Speed::MilliinchPerMinute   },
+    {"milin/min",     Unit::Speed::MilliinchPerMinute   },
+    {"milin/s",       Unit::Speed::MilliinchPerSecond   },
     {"milliinch/hr",  Unit::Speed::MilliinchPerHour     },
-    {"mil/s",         Unit::Speed::MilliinchPerSecond   },
-    {"mil/min",       Unit::Speed::MilliinchPerMinute   },
-    {"mil/hr",        Unit::Speed::MilliinchPerHour     },
-    {"thou/s",        Unit::Speed::MilliinchPerSecond   },
-    {"thou/min",      Unit::Speed::MilliinchPerMinute   },
+    {"milliinch/min", Unit::Speed::MilliinchPerMinute   },
+    {"milliinch/s",   Unit::Speed::MilliinchPerSecond   },
+    {"mm/hr",         Unit::Speed::MillimetrePerHour    },
+    {"mm/min",        Unit::Speed::MillimetrePerMinute  },
+    {"mm/s",          Unit::Speed::MillimetrePerSecond  },
+    {"nmi/hr",        Unit::Speed::Knot                 },
+    {"nmi/min",       Unit::Speed::NauticalMilePerMinute},
+    {"nmi/s",         Unit::Speed::NauticalMilePerSecond},
     {"thou/hr",       Unit::Speed::MilliinchPerHour     },
-    {"μm/s",          Unit::Speed::MicrometrePerSecond  },
-    {"μm/min",        Unit::Speed::MicrometrePerMinute  },
-    {"μm/hr",         Unit::Speed::MicrometrePerHour    },
-    {"um/s",          Unit::Speed::MicrometrePerSecond  },
-    {"um/min",        Unit::Speed::MicrometrePerMinute  },
+    {"thou/min",      Unit::Speed::MilliinchPerMinute   },
+    {"thou/s",        Unit::Speed::MilliinchPerSecond   },
+    {"uin/hr",        Unit::Speed::MicroinchPerHour     },
+    {"uin/min",       Unit::Speed::MicroinchPerMinute   },
+    {"uin/s",         Unit::Speed::MicroinchPerSecond   },
     {"um/hr",         Unit::Speed::MicrometrePerHour    },
-    {"μin/s",         Unit::Speed::MicroinchPerSecond   },
-    {"μin/min",       Unit::Speed::MicroinchPerMinute   },
+    {"um/min",        Unit::Speed::MicrometrePerMinute  },
+    {"um/s",          Unit::Speed::MicrometrePerSecond  },
+    {"yd/hr",         Unit::Speed::YardPerHour          },
+    {"yd/min",        Unit::Speed::YardPerMinute        },
+    {"yd/s",          Unit::Speed::YardPerSecond        },
     {"μin/hr",        Unit::Speed::MicroinchPerHour     },
-    {"uin/s",         Unit::Speed::MicroinchPerSecond   },
-    {"uin/min",       Unit::Speed::MicroinchPerMinute   },
-    {"uin/hr",        Unit::Speed::MicroinchPerHour     },
-};
+    {"μin/min",       Unit::Speed::MicroinchPerMinute   },
+    {"μin/s",         Unit::Speed::MicroinchPerSecond   },
+    {"μm/hr",         Unit::Speed::MicrometrePerHour    },
+    {"μm/min",        Unit::Speed::MicrometrePerMinute  },
+    {"μm/s",          Unit::Speed::MicrometrePerSecond  },
+}};
 
 // clang-format on
 
@@ -856,170 +856,8 @@ inline constexpr void Conversion<Unit::Speed, Unit::Speed::MicroinchPerHour>::To
   value *= static_cast<NumericType>(0.0000000254L) / static_cast<NumericType>(3600.0L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::Speed, std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Speed, NumericType>{
-        {Unit::Speed::NauticalMilePerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::NauticalMilePerSecond>::FromStandard<NumericType>},
-        {Unit::Speed::NauticalMilePerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::NauticalMilePerMinute>::FromStandard<NumericType>},
-        {Unit::Speed::Knot,                  Conversions<Unit::Speed, Unit::Speed::Knot>::FromStandard<NumericType>                 },
-        {Unit::Speed::MilePerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::MilePerSecond>::FromStandard<NumericType>        },
-        {Unit::Speed::MilePerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::MilePerMinute>::FromStandard<NumericType>        },
-        {Unit::Speed::MilePerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::MilePerHour>::FromStandard<NumericType>          },
-        {Unit::Speed::KilometrePerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::KilometrePerSecond>::FromStandard<NumericType>   },
-        {Unit::Speed::KilometrePerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::KilometrePerMinute>::FromStandard<NumericType>   },
-        {Unit::Speed::KilometrePerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::KilometrePerHour>::FromStandard<NumericType>     },
-        {Unit::Speed::MetrePerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::MetrePerSecond>::FromStandard<NumericType>       },
-        {Unit::Speed::MetrePerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::MetrePerMinute>::FromStandard<NumericType>       },
-        {Unit::Speed::MetrePerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::MetrePerHour>::FromStandard<NumericType>         },
-        {Unit::Speed::YardPerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::YardPerSecond>::FromStandard<NumericType>        },
-        {Unit::Speed::YardPerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::YardPerMinute>::FromStandard<NumericType>        },
-        {Unit::Speed::YardPerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::YardPerHour>::FromStandard<NumericType>          },
-        {Unit::Speed::FootPerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::FootPerSecond>::FromStandard<NumericType>        },
-        {Unit::Speed::FootPerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::FootPerMinute>::FromStandard<NumericType>        },
-        {Unit::Speed::FootPerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::FootPerHour>::FromStandard<NumericType>          },
-        {Unit::Speed::DecimetrePerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::DecimetrePerSecond>::FromStandard<NumericType>   },
-        {Unit::Speed::DecimetrePerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::DecimetrePerMinute>::FromStandard<NumericType>   },
-        {Unit::Speed::DecimetrePerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::DecimetrePerHour>::FromStandard<NumericType>     },
-        {Unit::Speed::InchPerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::InchPerSecond>::FromStandard<NumericType>        },
-        {Unit::Speed::InchPerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::InchPerMinute>::FromStandard<NumericType>        },
-        {Unit::Speed::InchPerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::InchPerHour>::FromStandard<NumericType>          },
-        {Unit::Speed::CentimetrePerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::CentimetrePerSecond>::FromStandard<NumericType>  },
-        {Unit::Speed::CentimetrePerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::CentimetrePerMinute>::FromStandard<NumericType>  },
-        {Unit::Speed::CentimetrePerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::CentimetrePerHour>::FromStandard<NumericType>    },
-        {Unit::Speed::MillimetrePerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::MillimetrePerSecond>::FromStandard<NumericType>  },
-        {Unit::Speed::MillimetrePerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::MillimetrePerMinute>::FromStandard<NumericType>  },
-        {Unit::Speed::MillimetrePerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::MillimetrePerHour>::FromStandard<NumericType>    },
-        {Unit::Speed::MilliinchPerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::MilliinchPerSecond>::FromStandard<NumericType>   },
-        {Unit::Speed::MilliinchPerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::MilliinchPerMinute>::FromStandard<NumericType>   },
-        {Unit::Speed::MilliinchPerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::MilliinchPerHour>::FromStandard<NumericType>     },
-        {Unit::Speed::MicrometrePerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::MicrometrePerSecond>::FromStandard<NumericType>  },
-        {Unit::Speed::MicrometrePerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::MicrometrePerMinute>::FromStandard<NumericType>  },
-        {Unit::Speed::MicrometrePerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::MicrometrePerHour>::FromStandard<NumericType>    },
-        {Unit::Speed::MicroinchPerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::MicroinchPerSecond>::FromStandard<NumericType>   },
-        {Unit::Speed::MicroinchPerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::MicroinchPerMinute>::FromStandard<NumericType>   },
-        {Unit::Speed::MicroinchPerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::MicroinchPerHour>::FromStandard<NumericType>     },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Speed,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Speed, NumericType>{
-        {Unit::Speed::NauticalMilePerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::NauticalMilePerSecond>::ToStandard<NumericType>},
-        {Unit::Speed::NauticalMilePerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::NauticalMilePerMinute>::ToStandard<NumericType>},
-        {Unit::Speed::Knot,                  Conversions<Unit::Speed, Unit::Speed::Knot>::ToStandard<NumericType>                 },
-        {Unit::Speed::MilePerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::MilePerSecond>::ToStandard<NumericType>        },
-        {Unit::Speed::MilePerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::MilePerMinute>::ToStandard<NumericType>        },
-        {Unit::Speed::MilePerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::MilePerHour>::ToStandard<NumericType>          },
-        {Unit::Speed::KilometrePerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::KilometrePerSecond>::ToStandard<NumericType>   },
-        {Unit::Speed::KilometrePerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::KilometrePerMinute>::ToStandard<NumericType>   },
-        {Unit::Speed::KilometrePerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::KilometrePerHour>::ToStandard<NumericType>     },
-        {Unit::Speed::MetrePerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::MetrePerSecond>::ToStandard<NumericType>       },
-        {Unit::Speed::MetrePerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::MetrePerMinute>::ToStandard<NumericType>       },
-        {Unit::Speed::MetrePerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::MetrePerHour>::ToStandard<NumericType>         },
-        {Unit::Speed::YardPerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::YardPerSecond>::ToStandard<NumericType>        },
-        {Unit::Speed::YardPerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::YardPerMinute>::ToStandard<NumericType>        },
-        {Unit::Speed::YardPerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::YardPerHour>::ToStandard<NumericType>          },
-        {Unit::Speed::FootPerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::FootPerSecond>::ToStandard<NumericType>        },
-        {Unit::Speed::FootPerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::FootPerMinute>::ToStandard<NumericType>        },
-        {Unit::Speed::FootPerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::FootPerHour>::ToStandard<NumericType>          },
-        {Unit::Speed::DecimetrePerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::DecimetrePerSecond>::ToStandard<NumericType>   },
-        {Unit::Speed::DecimetrePerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::DecimetrePerMinute>::ToStandard<NumericType>   },
-        {Unit::Speed::DecimetrePerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::DecimetrePerHour>::ToStandard<NumericType>     },
-        {Unit::Speed::InchPerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::InchPerSecond>::ToStandard<NumericType>        },
-        {Unit::Speed::InchPerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::InchPerMinute>::ToStandard<NumericType>        },
-        {Unit::Speed::InchPerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::InchPerHour>::ToStandard<NumericType>          },
-        {Unit::Speed::CentimetrePerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::CentimetrePerSecond>::ToStandard<NumericType>  },
-        {Unit::Speed::CentimetrePerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::CentimetrePerMinute>::ToStandard<NumericType>  },
-        {Unit::Speed::CentimetrePerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::CentimetrePerHour>::ToStandard<NumericType>    },
-        {Unit::Speed::MillimetrePerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::MillimetrePerSecond>::ToStandard<NumericType>  },
-        {Unit::Speed::MillimetrePerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::MillimetrePerMinute>::ToStandard<NumericType>  },
-        {Unit::Speed::MillimetrePerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::MillimetrePerHour>::ToStandard<NumericType>    },
-        {Unit::Speed::MilliinchPerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::MilliinchPerSecond>::ToStandard<NumericType>   },
-        {Unit::Speed::MilliinchPerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::MilliinchPerMinute>::ToStandard<NumericType>   },
-        {Unit::Speed::MilliinchPerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::MilliinchPerHour>::ToStandard<NumericType>     },
-        {Unit::Speed::MicrometrePerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::MicrometrePerSecond>::ToStandard<NumericType>  },
-        {Unit::Speed::MicrometrePerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::MicrometrePerMinute>::ToStandard<NumericType>  },
-        {Unit::Speed::MicrometrePerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::MicrometrePerHour>::ToStandard<NumericType>    },
-        {Unit::Speed::MicroinchPerSecond,
-         Conversions<Unit::Speed,                                     Unit::Speed::MicroinchPerSecond>::ToStandard<NumericType>   },
-        {Unit::Speed::MicroinchPerMinute,
-         Conversions<Unit::Speed,                                     Unit::Speed::MicroinchPerMinute>::ToStandard<NumericType>   },
-        {Unit::Speed::MicroinchPerHour,
-         Conversions<Unit::Speed,                                     Unit::Speed::MicroinchPerHour>::ToStandard<NumericType>     },
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Speed>{39};
 
 }  // namespace Internal
 
@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_SUBSTANCE_AMOUNT_HPP
 #define PHQ_UNIT_SUBSTANCE_AMOUNT_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -90,35 +89,37 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::SubstanceAmoun
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::SubstanceAmount> ConsistentUnits<Unit::SubstanceAmount>{
-    {UnitSystem::MetreKilogramSecondKelvin,  Unit::SubstanceAmount::Mole},
-    {UnitSystem::MillimetreGramSecondKelvin, Unit::SubstanceAmount::Mole},
-    {UnitSystem::FootPoundSecondRankine,     Unit::SubstanceAmount::Mole},
-    {UnitSystem::InchPoundSecondRankine,     Unit::SubstanceAmount::Mole},
-};
+inline constexpr std::array<std::pair<UnitSystem, Unit::SubstanceAmount>, 4>
+    ConsistentUnits<Unit::SubstanceAmount>{{
+        {UnitSystem::MetreKilogramSecondKelvin,  Unit::SubstanceAmount::Mole},
+        {UnitSystem::MillimetreGramSecondKelvin, Unit::SubstanceAmount::Mole},
+        {UnitSystem::FootPoundSecondRankine,     Unit::SubstanceAmount::Mole},
+        {UnitSystem::InchPoundSecondRankine,     Unit::SubstanceAmount::Mole},
+}};
 
 template <>
-inline const std::map<Unit::SubstanceAmount, UnitSystem>
+inline constexpr std::array<std::pair<Unit::SubstanceAmount, UnitSystem>, 0>
     RelatedUnitSystems<Unit::SubstanceAmount>{};
 
 template <>
-inline const std::map<Unit::SubstanceAmount, std::string_view> Abbreviations<Unit::SubstanceAmount>{
-    {Unit::SubstanceAmount::Mole,      "mol"      },
-    {Unit::SubstanceAmount::Kilomole,  "kmol"     },
-    {Unit::SubstanceAmount::Megamole,  "Mmol"     },
-    {Unit::SubstanceAmount::Gigamole,  "Gmol"     },
-    {Unit::SubstanceAmount::Particles, "particles"},
-};
+inline constexpr std::array<std::pair<Unit::SubstanceAmount, std::string_view>, 5>
+    Abbreviations<Unit::SubstanceAmount>{{
+        {Unit::SubstanceAmount::Mole,      "mol"      },
+        {Unit::SubstanceAmount::Kilomole,  "kmol"     },
+        {Unit::SubstanceAmount::Megamole,  "Mmol"     },
+        {Unit::SubstanceAmount::Gigamole,  "Gmol"     },
+        {Unit::SubstanceAmount::Particles, "particles"},
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::SubstanceAmount>
-    Spellings<Unit::SubstanceAmount>{
-        {"mol",       Unit::SubstanceAmount::Mole     },
-        {"kmol",      Unit::SubstanceAmount::Kilomole },
-        {"Mmol",      Unit::SubstanceAmount::Megamole },
+inline constexpr std::array<std::pair<std::string_view, Unit::SubstanceAmount>, 5>
+    Spellings<Unit::SubstanceAmount>{{
         {"Gmol",      Unit::SubstanceAmount::Gigamole },
+        {"Mmol",      Unit::SubstanceAmount::Megamole },
+        {"kmol",      Unit::SubstanceAmount::Kilomole },
+        {"mol",       Unit::SubstanceAmount::Mole     },
         {"particles", Unit::SubstanceAmount::Particles},
-};
+}};
 
 template <>
 template <typename NumericType>
@@ -194,46 +195,8 @@ Conversion<Unit::SubstanceAmount, Unit::SubstanceAmount::Particles>::ToStandard(
   value /= static_cast<NumericType>(6.02214076E23L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::SubstanceAmount,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::SubstanceAmount, NumericType>{
-        {Unit::SubstanceAmount::Mole,
-         Conversions<Unit::SubstanceAmount,
-         Unit::SubstanceAmount::Mole>::FromStandard<NumericType>     },
-        {Unit::SubstanceAmount::Kilomole,
-         Conversions<Unit::SubstanceAmount,
-         Unit::SubstanceAmount::Kilomole>::FromStandard<NumericType> },
-        {Unit::SubstanceAmount::Megamole,
-         Conversions<Unit::SubstanceAmount,
-         Unit::SubstanceAmount::Megamole>::FromStandard<NumericType> },
-        {Unit::SubstanceAmount::Gigamole,
-         Conversions<Unit::SubstanceAmount,
-         Unit::SubstanceAmount::Gigamole>::FromStandard<NumericType> },
-        {Unit::SubstanceAmount::Particles,
-         Conversions<Unit::SubstanceAmount,
-         Unit::SubstanceAmount::Particles>::FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::SubstanceAmount,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::SubstanceAmount, NumericType>{
-        {Unit::SubstanceAmount::Mole,
-         Conversions<Unit::SubstanceAmount, Unit::SubstanceAmount::Mole>::ToStandard<NumericType>},
-        {Unit::SubstanceAmount::Kilomole,
-         Conversions<Unit::SubstanceAmount,
-         Unit::SubstanceAmount::Kilomole>::ToStandard<NumericType>                               },
-        {Unit::SubstanceAmount::Megamole,
-         Conversions<Unit::SubstanceAmount,
-         Unit::SubstanceAmount::Megamole>::ToStandard<NumericType>                               },
-        {Unit::SubstanceAmount::Gigamole,
-         Conversions<Unit::SubstanceAmount,
-         Unit::SubstanceAmount::Gigamole>::ToStandard<NumericType>                               },
-        {Unit::SubstanceAmount::Particles,
-         Conversions<Unit::SubstanceAmount,
-         Unit::SubstanceAmount::Particles>::ToStandard<NumericType>                              },
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::SubstanceAmount>{5};
 
 }  // namespace Internal
 
@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_TEMPERATURE_HPP
 #define PHQ_UNIT_TEMPERATURE_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -88,41 +87,45 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Temperature un
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::Temperature> ConsistentUnits<Unit::Temperature>{
-    {UnitSystem::MetreKilogramSecondKelvin,  Unit::Temperature::Kelvin },
-    {UnitSystem::MillimetreGramSecondKelvin, Unit::Temperature::Kelvin },
-    {UnitSystem::FootPoundSecondRankine,     Unit::Temperature::Rankine},
-    {UnitSystem::InchPoundSecondRankine,     Unit::Temperature::Rankine},
-};
+inline constexpr std::array<std::pair<UnitSystem, Unit::Temperature>, 4>
+    ConsistentUnits<Unit::Temperature>{{
+        {UnitSystem::MetreKilogramSecondKelvin,  Unit::Temperature::Kelvin },
+        {UnitSystem::MillimetreGramSecondKelvin, Unit::Temperature::Kelvin },
+        {UnitSystem::FootPoundSecondRankine,     Unit::Temperature::Rankine},
+        {UnitSystem::InchPoundSecondRankine,     Unit::Temperature::Rankine},
+}};
 
 template <>
-inline const std::map<Unit::Temperature, UnitSystem> RelatedUnitSystems<Unit::Temperature>{};
+inline constexpr std::array<std::pair<Unit::Temperature, UnitSystem>, 0>
+    RelatedUnitSystems<Unit::Temperature>{};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::Temperature, std::string_view> Abbreviations<Unit::Temperature>{
-    {Unit::Temperature::Kelvin,     "K" },
-    {Unit::Temperature::Celsius,    "°C"},
-    {Unit::Temperature::Rankine,    "°R"},
-    {Unit::Temperature::Fahrenheit, "°F"},
-};
+inline constexpr std::array<std::pair<Unit::Temperature, std::string_view>, 4>
+    Abbreviations<Unit::Temperature>{{
+        {Unit::Temperature::Kelvin,     "K" },
+        {Unit::Temperature::Celsius,    "°C"},
+        {Unit::Temperature::Rankine,    "°R"},
+        {Unit::Temperature::Fahrenheit, "°F"},
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Temperature> Spellings<Unit::Temperature>{
-    {"K",    Unit::Temperature::Kelvin    },
-    {"°K",   Unit::Temperature::Kelvin    },
-    {"degK", Unit::Temperature::Kelvin    },
-    {"°C",   Unit::Temperature::Celsius   },
-    {"C",    Unit::Temperature::Celsius   },
-    {"degC", Unit::Temperature::Celsius   },
-    {"°R",   Unit::Temperature::Rankine   },
-    {"R",    Unit::Temperature::Rankine   },
-    {"degR", Unit::Temperature::Rankine   },
-    {"°F",   Unit::Temperature::Fahrenheit},
-    {"F",    Unit::Temperature::Fahrenheit},
-    {"degF", Unit::Temperature::Fahrenheit},
-};
+inline constexpr std::array<std::pair<std::string_view, Unit::Temperature>, 12>
+    Spellings<Unit::Temperature>{{
+        {"C",    Unit::Temperature::Celsius   },
+        {"F",    Unit::Temperature::Fahrenheit},
+        {"K",    Unit::Temperature::Kelvin    },
+        {"R",    Unit::Temperature::Rankine   },
+        {"degC", Unit::Temperature::Celsius   },
+        {"degF", Unit::Temperature::Fahrenheit},
+        {"degK", Unit::Temperature::Kelvin    },
+        {"degR", Unit::Temperature::Rankine   },
+        {"°C",   Unit::Temperature::Celsius   },
+        {"°F",   Unit::Temperature::Fahrenheit},
+        {"°K",   Unit::Temperature::Kelvin    },
+        {"°R",   Unit::Temperature::Rankine   },
+}};
 
 // clang-format on
 
@@ -178,33 +181,8 @@ inline constexpr void Conversion<Unit::Temperature, Unit::Temperature::Fahrenhei
   value = (value + static_cast<NumericType>(459.67L)) / static_cast<NumericType>(1.8L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::Temperature,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Temperature, NumericType>{
-        {Unit::Temperature::Kelvin,
-         Conversions<Unit::Temperature, Unit::Temperature::Kelvin>::FromStandard<NumericType>    },
-        {Unit::Temperature::Celsius,
-         Conversions<Unit::Temperature, Unit::Temperature::Celsius>::FromStandard<NumericType>   },
-        {Unit::Temperature::Rankine,
-         Conversions<Unit::Temperature, Unit::Temperature::Rankine>::FromStandard<NumericType>   },
-        {Unit::Temperature::Fahrenheit,
-         Conversions<Unit::Temperature, Unit::Temperature::Fahrenheit>::FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Temperature,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Temperature, NumericType>{
-        {Unit::Temperature::Kelvin,
-         Conversions<Unit::Temperature, Unit::Temperature::Kelvin>::ToStandard<NumericType>    },
-        {Unit::Temperature::Celsius,
-         Conversions<Unit::Temperature, Unit::Temperature::Celsius>::ToStandard<NumericType>   },
-        {Unit::Temperature::Rankine,
-         Conversions<Unit::Temperature, Unit::Temperature::Rankine>::ToStandard<NumericType>   },
-        {Unit::Temperature::Fahrenheit,
-         Conversions<Unit::Temperature, Unit::Temperature::Fahrenheit>::ToStandard<NumericType>},
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Temperature>{4};
 
 }  // namespace Internal
 
@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_TEMPERATURE_DIFFERENCE_HPP
 #define PHQ_UNIT_TEMPERATURE_DIFFERENCE_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -89,45 +88,45 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::TemperatureDif
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::TemperatureDifference>
-    ConsistentUnits<Unit::TemperatureDifference>{
+inline constexpr std::array<std::pair<UnitSystem, Unit::TemperatureDifference>, 4>
+    ConsistentUnits<Unit::TemperatureDifference>{{
         {UnitSystem::MetreKilogramSecondKelvin,  Unit::TemperatureDifference::Kelvin },
         {UnitSystem::MillimetreGramSecondKelvin, Unit::TemperatureDifference::Kelvin },
         {UnitSystem::FootPoundSecondRankine,     Unit::TemperatureDifference::Rankine},
         {UnitSystem::InchPoundSecondRankine,     Unit::TemperatureDifference::Rankine},
-};
+}};
 
 template <>
-inline const std::map<Unit::TemperatureDifference, UnitSystem>
+inline constexpr std::array<std::pair<Unit::TemperatureDifference, UnitSystem>, 0>
     RelatedUnitSystems<Unit::TemperatureDifference>{};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::TemperatureDifference, std::string_view>
-    Abbreviations<Unit::TemperatureDifference>{
+inline constexpr std::array<std::pair<Unit::TemperatureDifference, std::string_view>, 4>
+    Abbreviations<Unit::TemperatureDifference>{{
         {Unit::TemperatureDifference::Kelvin,     "K" },
         {Unit::TemperatureDifference::Celsius,    "°C"},
         {Unit::TemperatureDifference::Rankine,    "°R"},
         {Unit::TemperatureDifference::Fahrenheit, "°F"},
-};
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::TemperatureDifference>
-    Spellings<Unit::TemperatureDifference>{
-        {"K",    Unit::TemperatureDifference::Kelvin    },
-        {"°K",   Unit::TemperatureDifference::Kelvin    },
-        {"degK", Unit::TemperatureDifference::Kelvin    },
-        {"°C",   Unit::TemperatureDifference::Celsius   },
+inline constexpr std::array<std::pair<std::string_view, Unit::TemperatureDifference>, 12>
+    Spellings<Unit::TemperatureDifference>{{
         {"C",    Unit::TemperatureDifference::Celsius   },
-        {"degC", Unit::TemperatureDifference::Celsius   },
-        {"°R",   Unit::TemperatureDifference::Rankine   },
+        {"F",    Unit::TemperatureDifference::Fahrenheit},
+        {"K",    Unit::TemperatureDifference::Kelvin    },
         {"R",    Unit::TemperatureDifference::Rankine   },
+        {"degC", Unit::TemperatureDifference::Celsius   },
+        {"degF", Unit::TemperatureDifference::Fahrenheit},
+        {"degK", Unit::TemperatureDifference::Kelvin    },
         {"degR", Unit::TemperatureDifference::Rankine   },
+        {"°C",   Unit::TemperatureDifference::Celsius   },
         {"°F",   Unit::TemperatureDifference::Fahrenheit},
-        {"F",    Unit::TemperatureDifference::Fahrenheit},
-        {"degF", Unit::TemperatureDifference::Fahrenheit},
-};
+        {"°K",   Unit::TemperatureDifference::Kelvin    },
+        {"°R",   Unit::TemperatureDifference::Rankine   },
+}};
 
 // clang-format on
 
@@ -187,41 +186,8 @@ Conversion<Unit::TemperatureDifference, Unit::TemperatureDifference::Fahrenheit>
   value /= static_cast<NumericType>(1.8L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::TemperatureDifference,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::TemperatureDifference, NumericType>{
-        {Unit::TemperatureDifference::Kelvin,
-         Conversions<Unit::TemperatureDifference,
-         Unit::TemperatureDifference::Kelvin>::FromStandard<NumericType>    },
-        {Unit::TemperatureDifference::Celsius,
-         Conversions<Unit::TemperatureDifference,
-         Unit::TemperatureDifference::Celsius>::FromStandard<NumericType>   },
-        {Unit::TemperatureDifference::Rankine,
-         Conversions<Unit::TemperatureDifference,
-         Unit::TemperatureDifference::Rankine>::FromStandard<NumericType>   },
-        {Unit::TemperatureDifference::Fahrenheit,
-         Conversions<Unit::TemperatureDifference,
-         Unit::TemperatureDifference::Fahrenheit>::FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::TemperatureDifference,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::TemperatureDifference, NumericType>{
-        {Unit::TemperatureDifference::Kelvin,
-         Conversions<Unit::TemperatureDifference,
-         Unit::TemperatureDifference::Kelvin>::ToStandard<NumericType>    },
-        {Unit::TemperatureDifference::Celsius,
-         Conversions<Unit::TemperatureDifference,
-         Unit::TemperatureDifference::Celsius>::ToStandard<NumericType>   },
-        {Unit::TemperatureDifference::Rankine,
-         Conversions<Unit::TemperatureDifference,
-         Unit::TemperatureDifference::Rankine>::ToStandard<NumericType>   },
-        {Unit::TemperatureDifference::Fahrenheit,
-         Conversions<Unit::TemperatureDifference,
-         Unit::TemperatureDifference::Fahrenheit>::ToStandard<NumericType>},
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::TemperatureDifference>{4};
 
 }  // namespace Internal
 
@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_TEMPERATURE_GRADIENT_HPP
 #define PHQ_UNIT_TEMPERATURE_GRADIENT_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -99,66 +98,66 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::TemperatureGra
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::TemperatureGradient>
-    ConsistentUnits<Unit::TemperatureGradient>{
+inline constexpr std::array<std::pair<UnitSystem, Unit::TemperatureGradient>, 4>
+    ConsistentUnits<Unit::TemperatureGradient>{{
         {UnitSystem::MetreKilogramSecondKelvin,  Unit::TemperatureGradient::KelvinPerMetre     },
         {UnitSystem::MillimetreGramSecondKelvin, Unit::TemperatureGradient::KelvinPerMillimetre},
         {UnitSystem::FootPoundSecondRankine,     Unit::TemperatureGradient::RankinePerFoot     },
         {UnitSystem::InchPoundSecondRankine,     Unit::TemperatureGradient::RankinePerInch     },
-};
+}};
 
 template <>
-inline const std::map<Unit::TemperatureGradient, UnitSystem>
-    RelatedUnitSystems<Unit::TemperatureGradient>{
+inline constexpr std::array<std::pair<Unit::TemperatureGradient, UnitSystem>, 4>
+    RelatedUnitSystems<Unit::TemperatureGradient>{{
         {Unit::TemperatureGradient::KelvinPerMetre,      UnitSystem::MetreKilogramSecondKelvin },
         {Unit::TemperatureGradient::KelvinPerMillimetre, UnitSystem::MillimetreGramSecondKelvin},
         {Unit::TemperatureGradient::RankinePerFoot,      UnitSystem::FootPoundSecondRankine    },
         {Unit::TemperatureGradient::RankinePerInch,      UnitSystem::InchPoundSecondRankine    },
-};
+}};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::TemperatureGradient, std::string_view>
-    Abbreviations<Unit::TemperatureGradient>{
+inline constexpr std::array<std::pair<Unit::TemperatureGradient, std::string_view>, 8>
+    Abbreviations<Unit::TemperatureGradient>{{
         {Unit::TemperatureGradient::KelvinPerMetre,       "K/m"  },
-        {Unit::TemperatureGradient::CelsiusPerMetre,      "°C/m" },
         {Unit::TemperatureGradient::KelvinPerMillimetre,  "K/mm" },
+        {Unit::TemperatureGradient::CelsiusPerMetre,      "°C/m" },
         {Unit::TemperatureGradient::CelsiusPerMillimetre, "°C/mm"},
         {Unit::TemperatureGradient::RankinePerFoot,       "°R/ft"},
-        {Unit::TemperatureGradient::FahrenheitPerFoot,    "°F/ft"},
         {Unit::TemperatureGradient::RankinePerInch,       "°R/in"},
+        {Unit::TemperatureGradient::FahrenheitPerFoot,    "°F/ft"},
         {Unit::TemperatureGradient::FahrenheitPerInch,    "°F/in"},
-};
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::TemperatureGradient>
-    Spellings<Unit::TemperatureGradient>{
-        {"K/m",     Unit::TemperatureGradient::KelvinPerMetre      },
-        {"°K/m",    Unit::TemperatureGradient::KelvinPerMetre      },
-        {"degK/m",  Unit::TemperatureGradient::KelvinPerMetre      },
-        {"°C/m",    Unit::TemperatureGradient::CelsiusPerMetre     },
+inline constexpr std::array<std::pair<std::string_view, Unit::TemperatureGradient>, 24>
+    Spellings<Unit::TemperatureGradient>{{
         {"C/m",     Unit::TemperatureGradient::CelsiusPerMetre     },
-        {"degC/m",  Unit::TemperatureGradient::CelsiusPerMetre     },
-        {"K/mm",    Unit::TemperatureGradient::KelvinPerMillimetre },
-        {"°K/mm",   Unit::TemperatureGradient::KelvinPerMillimetre },
-        {"degK/mm", Unit::TemperatureGradient::KelvinPerMillimetre },
-        {"°C/mm",   Unit::TemperatureGradient::CelsiusPerMillimetre},
         {"C/mm",    Unit::TemperatureGradient::CelsiusPerMillimetre},
-        {"degC/mm", Unit::TemperatureGradient::CelsiusPerMillimetre},
-        {"°R/ft",   Unit::TemperatureGradient::RankinePerFoot      },
-        {"R/ft",    Unit::TemperatureGradient::RankinePerFoot      },
-        {"degR/ft", Unit::TemperatureGradient::RankinePerFoot      },
-        {"°F/ft",   Unit::TemperatureGradient::FahrenheitPerFoot   },
         {"F/ft",    Unit::TemperatureGradient::FahrenheitPerFoot   },
-        {"degF/ft", Unit::TemperatureGradient::FahrenheitPerFoot   },
-        {"°R/in",   Unit::TemperatureGradient::RankinePerInch      },
+        {"F/in",    Unit::TemperatureGradient::FahrenheitPerInch   },
+        {"K/m",     Unit::TemperatureGradient::KelvinPerMetre      },
+        {"K/mm",    Unit::TemperatureGradient::KelvinPerMillimetre },
+        {"R/ft",    Unit::TemperatureGradient::RankinePerFoot      },
         {"R/in",    Unit::TemperatureGradient::RankinePerInch      },
+        {"degC/m",  Unit::TemperatureGradient::CelsiusPerMetre     },
+        {"degC/mm", Unit::TemperatureGradient::CelsiusPerMillimetre},
+        {"degF/ft", Unit::TemperatureGradient::FahrenheitPerFoot   },
+        {"degF/in", Unit::TemperatureGradient::FahrenheitPerInch   },
+        {"degK/m",  Unit::TemperatureGradient::KelvinPerMetre      },
+        {"degK/mm", Unit::TemperatureGradient::KelvinPerMillimetre },
+        {"degR/ft", Unit::TemperatureGradient::RankinePerFoot      },
         {"degR/in", Unit::TemperatureGradient::RankinePerInch      },
+        {"°C/m",    Unit::TemperatureGradient::CelsiusPerMetre     },
+        {"°C/mm",   Unit::TemperatureGradient::CelsiusPerMillimetre},
+        {"°F/ft",   Unit::TemperatureGradient::FahrenheitPerFoot   },
         {"°F/in",   Unit::TemperatureGradient::FahrenheitPerInch   },
-        {"F/in",    Unit::TemperatureGradient::FahrenheitPerInch   },
-        {"degF/in", Unit::TemperatureGradient::FahrenheitPerInch   },
-};
+        {"°K/m",    Unit::TemperatureGradient::KelvinPerMetre      },
+        {"°K/mm",   Unit::TemperatureGradient::KelvinPerMillimetre },
+        {"°R/ft",   Unit::TemperatureGradient::RankinePerFoot      },
+        {"°R/in",   Unit::TemperatureGradient::RankinePerInch      },
+}};
 
 // clang-format on
 
@@ -282,65 +281,8 @@ Conversion<Unit::TemperatureGradient, Unit::TemperatureGradient::FahrenheitPerIn
   value /= (static_cast<NumericType>(1.8L) * static_cast<NumericType>(0.0254L));
 }
 
-template <typename NumericType>
-inline const std::map<Unit::TemperatureGradient,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::TemperatureGradient, NumericType>{
-        {Unit::TemperatureGradient::KelvinPerMetre,
-         Conversions<Unit::TemperatureGradient,
-         Unit::TemperatureGradient::KelvinPerMetre>::FromStandard<NumericType>      },
-        {Unit::TemperatureGradient::KelvinPerMillimetre,
-         Conversions<Unit::TemperatureGradient,
-         Unit::TemperatureGradient::KelvinPerMillimetre>::FromStandard<NumericType> },
-        {Unit::TemperatureGradient::CelsiusPerMetre,
-         Conversions<Unit::TemperatureGradient,
-         Unit::TemperatureGradient::CelsiusPerMetre>::FromStandard<NumericType>     },
-        {Unit::TemperatureGradient::CelsiusPerMillimetre,
-         Conversions<Unit::TemperatureGradient,
-         Unit::TemperatureGradient::CelsiusPerMillimetre>::FromStandard<NumericType>},
-        {Unit::TemperatureGradient::RankinePerFoot,
-         Conversions<Unit::TemperatureGradient,
-         Unit::TemperatureGradient::RankinePerFoot>::FromStandard<NumericType>      },
-        {Unit::TemperatureGradient::RankinePerInch,
-         Conversions<Unit::TemperatureGradient,
-         Unit::TemperatureGradient::RankinePerInch>::FromStandard<NumericType>      },
-        {Unit::TemperatureGradient::FahrenheitPerFoot,
-         Conversions<Unit::TemperatureGradient,
-         Unit::TemperatureGradient::FahrenheitPerFoot>::FromStandard<NumericType>   },
-        {Unit::TemperatureGradient::FahrenheitPerInch,
-         Conversions<Unit::TemperatureGradient,
-         Unit::TemperatureGradient::FahrenheitPerInch>::FromStandard<NumericType>   },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::TemperatureGradient,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::TemperatureGradient, NumericType>{
-        {Unit::TemperatureGradient::KelvinPerMetre,
-         Conversions<Unit::TemperatureGradient,
-         Unit::TemperatureGradient::KelvinPerMetre>::ToStandard<NumericType>      },
-        {Unit::TemperatureGradient::KelvinPerMillimetre,
-         Conversions<Unit::TemperatureGradient,
-         Unit::TemperatureGradient::KelvinPerMillimetre>::ToStandard<NumericType> },
-        {Unit::TemperatureGradient::CelsiusPerMetre,
-         Conversions<Unit::TemperatureGradient,
-         Unit::TemperatureGradient::CelsiusPerMetre>::ToStandard<NumericType>     },
-        {Unit::TemperatureGradient::CelsiusPerMillimetre,
-         Conversions<Unit::TemperatureGradient,
-         Unit::TemperatureGradient::CelsiusPerMillimetre>::ToStandard<NumericType>},
-        {Unit::TemperatureGradient::RankinePerFoot,
-         Conversions<Unit::TemperatureGradient,
-         Unit::TemperatureGradient::RankinePerFoot>::ToStandard<NumericType>      },
-        {Unit::TemperatureGradient::RankinePerInch,
-         Conversions<Unit::TemperatureGradient,
-         Unit::TemperatureGradient::RankinePerInch>::ToStandard<NumericType>      },
-        {Unit::TemperatureGradient::FahrenheitPerFoot,
-         Conversions<Unit::TemperatureGradient,
-         Unit::TemperatureGradient::FahrenheitPerFoot>::ToStandard<NumericType>   },
-        {Unit::TemperatureGradient::FahrenheitPerInch,
-         Conversions<Unit::TemperatureGradient,
-         Unit::TemperatureGradient::FahrenheitPerInch>::ToStandard<NumericType>   },
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::TemperatureGradient>{8};
 
 }  // namespace Internal
 
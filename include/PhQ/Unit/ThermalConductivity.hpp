@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_THERMAL_CONDUCTIVITY_HPP
 #define PHQ_UNIT_THERMAL_CONDUCTIVITY_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -84,157 +83,155 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::ThermalConduct
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::ThermalConductivity>
-    ConsistentUnits<Unit::ThermalConductivity>{
-        {UnitSystem::MetreKilogramSecondKelvin,  Unit::ThermalConductivity::WattPerMetrePerKelvin   },
-        {UnitSystem::MillimetreGramSecondKelvin,
-         Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin                                  },
-        {UnitSystem::FootPoundSecondRankine,     Unit::ThermalConductivity::PoundPerSecondPerRankine},
-        {UnitSystem::InchPoundSecondRankine,     Unit::ThermalConductivity::PoundPerSecondPerRankine},
-};
+inline constexpr std::array<std::pair<UnitSystem, Unit::ThermalConductivity>, 4>
+    ConsistentUnits<Unit::ThermalConductivity>{{
+        {UnitSystem::MetreKilogramSecondKelvin,  Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {UnitSystem::MillimetreGramSecondKelvin, Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {UnitSystem::FootPoundSecondRankine,     Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {UnitSystem::InchPoundSecondRankine,     Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+}};
 
 template <>
-inline const std::map<Unit::ThermalConductivity, UnitSystem>
-    RelatedUnitSystems<Unit::ThermalConductivity>{
-        {Unit::ThermalConductivity::WattPerMetrePerKelvin,          UnitSystem::MetreKilogramSecondKelvin},
-        {Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin,
-         UnitSystem::MillimetreGramSecondKelvin                                                          },
-};
+inline constexpr std::array<std::pair<Unit::ThermalConductivity, UnitSystem>, 2>
+    RelatedUnitSystems<Unit::ThermalConductivity>{{
+        {Unit::ThermalConductivity::WattPerMetrePerKelvin,          UnitSystem::MetreKilogramSecondKelvin },
+        {Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin, UnitSystem::MillimetreGramSecondKelvin},
+}};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::ThermalConductivity, std::string_view>
-    Abbreviations<Unit::ThermalConductivity>{
+inline constexpr std::array<std::pair<Unit::ThermalConductivity, std::string_view>, 3>
+    Abbreviations<Unit::ThermalConductivity>{{
         {Unit::ThermalConductivity::WattPerMetrePerKelvin,          "W/m/K"   },
         {Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin, "nW/mm/K" },
         {Unit::ThermalConductivity::PoundPerSecondPerRankine,       "lbf/s/°R"},
-};
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::ThermalConductivity> Spellings<
-    Unit::ThermalConductivity>{
-    {"W/m/K",           Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"W/m/°K",          Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"W/m/degK",        Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"W/m/°C",          Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"W/m/degC",        Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"W/m/C",           Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"W/(m·K)",         Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"W/(m·°K)",        Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"W/(m·degK)",      Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"W/(m·°C)",        Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"W/(m·degC)",      Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"W/(m·C)",         Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"W/(m*K)",         Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"W/(m*°K)",        Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"W/(m*degK)",      Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"W/(m*°C)",        Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"W/(m*degC)",      Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"W/(m*C)",         Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg*m/s^3/K",      Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg*m/s^3/°K",     Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg*m/s^3/degK",   Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg*m/s^3/C",      Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg*m/s^3/°C",     Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg*m/s^3/degC",   Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg·m/s^3/K",      Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg·m/s^3/°K",     Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg·m/s^3/degK",   Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg·m/s^3/C",      Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg·m/s^3/°C",     Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg·m/s^3/degC",   Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg·m/(s^3·K)",    Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg·m/(s^3·°K)",   Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg·m/(s^3·degK)", Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg·m/(s^3·C)",    Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg·m/(s^3·°C)",   Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg·m/(s^3·degC)", Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg*m/(s^3*K)",    Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg*m/(s^3*°K)",   Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg*m/(s^3*degK)", Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg*m/(s^3*C)",    Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg*m/(s^3*°C)",   Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"kg*m/(s^3*degC)", Unit::ThermalConductivity::WattPerMetrePerKelvin         },
-    {"nW/mm/K",         Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"nW/mm/°K",        Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"nW/mm/degK",      Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"nW/mm/°C",        Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"nW/mm/degC",      Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"nW/mm/C",         Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"nW/(mm·K)",       Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"nW/(mm·°K)",      Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"nW/(mm·degK)",    Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"nW/(mm·°C)",      Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"nW/(mm·degC)",    Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"nW/(mm·C)",       Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"nW/(mm*K)",       Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"nW/(mm*°K)",      Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"nW/(mm*degK)",    Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"nW/(mm*°C)",      Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"nW/(mm*degC)",    Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"nW/(mm*C)",       Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g·mm/s^3/K",      Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g·mm/s^3/°K",     Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g·mm/s^3/degK",   Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g·mm/s^3/C",      Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g·mm/s^3/°C",     Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g·mm/s^3/degC",   Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g*mm/s^3/K",      Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g*mm/s^3/°K",     Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g*mm/s^3/degK",   Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g*mm/s^3/C",      Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g*mm/s^3/°C",     Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g*mm/s^3/degC",   Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g·mm/(s^3·K)",    Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g·mm/(s^3·°K)",   Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g·mm/(s^3·degK)", Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g·mm/(s^3·C)",    Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g·mm/(s^3·°C)",   Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g·mm/(s^3·degC)", Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g*mm/(s^3*K)",    Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g*mm/(s^3*°K)",   Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g*mm/(s^3*degK)", Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g*mm/(s^3*C)",    Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g*mm/(s^3*°C)",   Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"g*mm/(s^3*degC)", Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
-    {"lbf/s/°R",        Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lbf/s/R",         Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lbf/s/degR",      Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lbf/s/°F",        Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lbf/s/F",         Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lbf/s/degF",      Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lbf/(s·°R)",      Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lbf/(s·R)",       Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lbf/(s·degR)",    Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lbf/(s·°F)",      Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lbf/(s·F)",       Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lbf/(s·degF)",    Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lbf/(s*°R)",      Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lbf/(s*R)",       Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lbf/(s*degR)",    Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lbf/(s*°F)",      Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lbf/(s*F)",       Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lbf/(s*degF)",    Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lb/s/°R",         Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lb/s/R",          Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lb/s/degR",       Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lb/s/°F",         Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lb/s/F",          Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lb/s/degF",       Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lb/(s·°R)",       Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lb/(s·R)",        Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lb/(s·degR)",     Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lb/(s·°F)",       Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lb/(s·F)",        Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lb/(s·degF)",     Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lb/(s*°R)",       Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lb/(s*R)",        Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lb/(s*degR)",     Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lb/(s*°F)",       Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lb/(s*F)",        Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-    {"lb/(s*degF)",     Unit::ThermalConductivity::PoundPerSecondPerRankine      },
-};
+inline constexpr std::array<std::pair<std::string_view, Unit::ThermalConductivity>, 120>
+    Spellings<Unit::ThermalConductivity>{{
+        {"W/(m*C)",         Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"W/(m*K)",         Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"W/(m*degC)",      Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"W/(m*degK)",      Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"W/(m*°C)",        Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"W/(m*°K)",        Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"W/(m·C)",         Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"W/(m·K)",         Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"W/(m·degC)",      Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"W/(m·degK)",      Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"W/(m·°C)",        Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"W/(m·°K)",        Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"W/m/C",           Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"W/m/K",           Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"W/m/degC",        Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"W/m/degK",        Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"W/m/°C",          Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"W/m/°K",          Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"g*mm/(s^3*C)",    Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g*mm/(s^3*K)",    Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g*mm/(s^3*degC)", Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g*mm/(s^3*degK)", Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g*mm/(s^3*°C)",   Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g*mm/(s^3*°K)",   Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g*mm/s^3/C",      Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g*mm/s^3/K",      Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g*mm/s^3/degC",   Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g*mm/s^3/degK",   Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g*mm/s^3/°C",     Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g*mm/s^3/°K",     Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g·mm/(s^3·C)",    Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g·mm/(s^3·K)",    Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g·mm/(s^3·degC)", Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g·mm/(s^3·degK)", Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g·mm/(s^3·°C)",   Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g·mm/(s^3·°K)",   Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g·mm/s^3/C",      Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g·mm/s^3/K",      Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g·mm/s^3/degC",   Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g·mm/s^3/degK",   Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g·mm/s^3/°C",     Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"g·mm/s^3/°K",     Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"kg*m/(s^3*C)",    Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg*m/(s^3*K)",    Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg*m/(s^3*degC)", Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg*m/(s^3*degK)", Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg*m/(s^3*°C)",   Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg*m/(s^3*°K)",   Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg*m/s^3/C",      Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg*m/s^3/K",      Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg*m/s^3/degC",   Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg*m/s^3/degK",   Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg*m/s^3/°C",     Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg*m/s^3/°K",     Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg·m/(s^3·C)",    Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg·m/(s^3·K)",    Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg·m/(s^3·degC)", Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg·m/(s^3·degK)", Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg·m/(s^3·°C)",   Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg·m/(s^3·°K)",   Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg·m/s^3/C",      Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg·m/s^3/K",      Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg·m/s^3/degC",   Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg·m/s^3/degK",   Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg·m/s^3/°C",     Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"kg·m/s^3/°K",     Unit::ThermalConductivity::WattPerMetrePerKelvin         },
+        {"lb/(s*F)",        Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lb/(s*R)",        Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lb/(s*degF)",     Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lb/(s*degR)",     Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lb/(s*°F)",       Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lb/(s*°R)",       Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lb/(s·F)",        Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lb/(s·R)",        Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lb/(s·degF)",     Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lb/(s·degR)",     Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lb/(s·°F)",       Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lb/(s·°R)",       Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lb/s/F",          Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lb/s/R",          Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lb/s/degF",       Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lb/s/degR",       Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lb/s/°F",         Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lb/s/°R",         Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lbf/(s*F)",       Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lbf/(s*R)",       Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lbf/(s*degF)",    Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lbf/(s*degR)",    Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lbf/(s*°F)",      Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lbf/(s*°R)",      Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lbf/(s·F)",       Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lbf/(s·R)",       Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lbf/(s·degF)",    Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lbf/(s·degR)",    Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lbf/(s·°F)",      Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lbf/(s·°R)",      Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lbf/s/F",         Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lbf/s/R",         Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lbf/s/degF",      Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lbf/s/degR",      Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lbf/s/°F",        Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"lbf/s/°R",        Unit::ThermalConductivity::PoundPerSecondPerRankine      },
+        {"nW/(mm*C)",       Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"nW/(mm*K)",       Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"nW/(mm*degC)",    Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"nW/(mm*degK)",    Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"nW/(mm*°C)",      Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"nW/(mm*°K)",      Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"nW/(mm·C)",       Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"nW/(mm·K)",       Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"nW/(mm·degC)",    Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"nW/(mm·degK)",    Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"nW/(mm·°C)",      Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"nW/(mm·°K)",      Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"nW/mm/C",         Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"nW/mm/K",         Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"nW/mm/degC",      Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"nW/mm/degK",      Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"nW/mm/°C",        Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+        {"nW/mm/°K",        Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin},
+}};
 
 // clang-format on
 
@@ -284,38 +281,8 @@ Conversion<Unit::ThermalConductivity, Unit::ThermalConductivity::PoundPerSecondP
            * static_cast<NumericType>(1.8L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::ThermalConductivity,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::ThermalConductivity, NumericType>{
-        {Unit::ThermalConductivity::WattPerMetrePerKelvin,
-         Conversions<Unit::ThermalConductivity,
-         Unit::ThermalConductivity::WattPerMetrePerKelvin>::FromStandard<NumericType>         },
-        {Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin,
-         Conversions<
-             Unit::ThermalConductivity,
-         Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin>::FromStandard<NumericType>},
-        {Unit::ThermalConductivity::PoundPerSecondPerRankine,
-         Conversions<
-             Unit::ThermalConductivity,
-         Unit::ThermalConductivity::PoundPerSecondPerRankine>::FromStandard<NumericType>      },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::ThermalConductivity,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::ThermalConductivity, NumericType>{
-        {Unit::ThermalConductivity::WattPerMetrePerKelvin,
-         Conversions<Unit::ThermalConductivity,
-         Unit::ThermalConductivity::WattPerMetrePerKelvin>::ToStandard<NumericType>         },
-        {Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin,
-         Conversions<
-             Unit::ThermalConductivity,
-         Unit::ThermalConductivity::NanowattPerMillimetrePerKelvin>::ToStandard<NumericType>},
-        {Unit::ThermalConductivity::PoundPerSecondPerRankine,
-         Conversions<Unit::ThermalConductivity,
-         Unit::ThermalConductivity::PoundPerSecondPerRankine>::ToStandard<NumericType>      },
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::ThermalConductivity>{3};
 
 }  // namespace Internal
 
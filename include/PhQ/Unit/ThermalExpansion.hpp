@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_THERMAL_EXPANSION_HPP
 #define PHQ_UNIT_THERMAL_EXPANSION_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -87,56 +86,57 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::ThermalExpansi
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::ThermalExpansion> ConsistentUnits<Unit::ThermalExpansion>{
-    {UnitSystem::MetreKilogramSecondKelvin,  Unit::ThermalExpansion::PerKelvin },
-    {UnitSystem::MillimetreGramSecondKelvin, Unit::ThermalExpansion::PerKelvin },
-    {UnitSystem::FootPoundSecondRankine,     Unit::ThermalExpansion::PerRankine},
-    {UnitSystem::InchPoundSecondRankine,     Unit::ThermalExpansion::PerRankine},
-};
+inline constexpr std::array<std::pair<UnitSystem, Unit::ThermalExpansion>, 4>
+    ConsistentUnits<Unit::ThermalExpansion>{{
+        {UnitSystem::MetreKilogramSecondKelvin,  Unit::ThermalExpansion::PerKelvin },
+        {UnitSystem::MillimetreGramSecondKelvin, Unit::ThermalExpansion::PerKelvin },
+        {UnitSystem::FootPoundSecondRankine,     Unit::ThermalExpansion::PerRankine},
+        {UnitSystem::InchPoundSecondRankine,     Unit::ThermalExpansion::PerRankine},
+}};
 
 template <>
-inline const std::map<Unit::ThermalExpansion, UnitSystem>
+inline constexpr std::array<std::pair<Unit::ThermalExpansion, UnitSystem>, 0>
     RelatedUnitSystems<Unit::ThermalExpansion>{};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::ThermalExpansion, std::string_view>
-    Abbreviations<Unit::ThermalExpansion>{
+inline constexpr std::array<std::pair<Unit::ThermalExpansion, std::string_view>, 4>
+    Abbreviations<Unit::ThermalExpansion>{{
         {Unit::ThermalExpansion::PerKelvin,     "/K" },
         {Unit::ThermalExpansion::PerCelsius,    "/°C"},
         {Unit::ThermalExpansion::PerRankine,    "/°R"},
         {Unit::ThermalExpansion::PerFahrenheit, "/°F"},
-};
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::ThermalExpansion>
-    Spellings<Unit::ThermalExpansion>{
-        {"1/K",    Unit::ThermalExpansion::PerKelvin    },
-        {"1/°K",   Unit::ThermalExpansion::PerKelvin    },
-        {"1/degK", Unit::ThermalExpansion::PerKelvin    },
+inline constexpr std::array<std::pair<std::string_view, Unit::ThermalExpansion>, 24>
+    Spellings<Unit::ThermalExpansion>{{
+        {"/C",     Unit::ThermalExpansion::PerCelsius   },
+        {"/F",     Unit::ThermalExpansion::PerFahrenheit},
         {"/K",     Unit::ThermalExpansion::PerKelvin    },
-        {"/°K",    Unit::ThermalExpansion::PerKelvin    },
+        {"/R",     Unit::ThermalExpansion::PerRankine   },
+        {"/degC",  Unit::ThermalExpansion::PerCelsius   },
+        {"/degF",  Unit::ThermalExpansion::PerFahrenheit},
         {"/degK",  Unit::ThermalExpansion::PerKelvin    },
-        {"1/°C",   Unit::ThermalExpansion::PerCelsius   },
-        {"1/C",    Unit::ThermalExpansion::PerCelsius   },
-        {"1/degC", Unit::ThermalExpansion::PerCelsius   },
+        {"/degR",  Unit::ThermalExpansion::PerRankine   },
         {"/°C",    Unit::ThermalExpansion::PerCelsius   },
-        {"/C",     Unit::ThermalExpansion::PerCelsius   },
-        {"/degC",  Unit::ThermalExpansion::PerCelsius   },
-        {"1/°R",   Unit::ThermalExpansion::PerRankine   },
-        {"1/R",    Unit::ThermalExpansion::PerRankine   },
-        {"1/degR", Unit::ThermalExpansion::PerRankine   },
+        {"/°F",    Unit::ThermalExpansion::PerFahrenheit},
+        {"/°K",    Unit::ThermalExpansion::PerKelvin    },
         {"/°R",    Unit::ThermalExpansion::PerRankine   },
-        {"/R",     Unit::ThermalExpansion::PerRankine   },
-        {"/degR",  Unit::ThermalExpansion::PerRankine   },
-        {"1/°F",   Unit::ThermalExpansion::PerFahrenheit},
+        {"1/C",    Unit::ThermalExpansion::PerCelsius   },
         {"1/F",    Unit::ThermalExpansion::PerFahrenheit},
+        {"1/K",    Unit::ThermalExpansion::PerKelvin    },
+        {"1/R",    Unit::ThermalExpansion::PerRankine   },
+        {"1/degC", Unit::ThermalExpansion::PerCelsius   },
         {"1/degF", Unit::ThermalExpansion::PerFahrenheit},
-        {"/°F",    Unit::ThermalExpansion::PerFahrenheit},
-        {"/F",     Unit::ThermalExpansion::PerFahrenheit},
-        {"/degF",  Unit::ThermalExpansion::PerFahrenheit},
-};
+        {"1/degK", Unit::ThermalExpansion::PerKelvin    },
+        {"1/degR", Unit::ThermalExpansion::PerRankine   },
+        {"1/°C",   Unit::ThermalExpansion::PerCelsius   },
+        {"1/°F",   Unit::ThermalExpansion::PerFahrenheit},
+        {"1/°K",   Unit::ThermalExpansion::PerKelvin    },
+        {"1/°R",   Unit::ThermalExpansion::PerRankine   },
+}};
 
 // clang-format on
 
@@ -196,41 +196,8 @@ Conversion<Unit::ThermalExpansion, Unit::ThermalExpansion::PerFahrenheit>::ToSta
   value *= static_cast<NumericType>(1.8L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::ThermalExpansion,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::ThermalExpansion, NumericType>{
-        {Unit::ThermalExpansion::PerKelvin,
-         Conversions<Unit::ThermalExpansion,
-         Unit::ThermalExpansion::PerKelvin>::FromStandard<NumericType>    },
-        {Unit::ThermalExpansion::PerCelsius,
-         Conversions<Unit::ThermalExpansion,
-         Unit::ThermalExpansion::PerCelsius>::FromStandard<NumericType>   },
-        {Unit::ThermalExpansion::PerRankine,
-         Conversions<Unit::ThermalExpansion,
-         Unit::ThermalExpansion::PerRankine>::FromStandard<NumericType>   },
-        {Unit::ThermalExpansion::PerFahrenheit,
-         Conversions<Unit::ThermalExpansion,
-         Unit::ThermalExpansion::PerFahrenheit>::FromStandard<NumericType>},
-};
-
-template <typename NumericType>
-inline const std::map<Unit::ThermalExpansion,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::ThermalExpansion, NumericType>{
-        {Unit::ThermalExpansion::PerKelvin,
-         Conversions<Unit::ThermalExpansion,
-         Unit::ThermalExpansion::PerKelvin>::ToStandard<NumericType>    },
-        {Unit::ThermalExpansion::PerCelsius,
-         Conversions<Unit::ThermalExpansion,
-         Unit::ThermalExpansion::PerCelsius>::ToStandard<NumericType>   },
-        {Unit::ThermalExpansion::PerRankine,
-         Conversions<Unit::ThermalExpansion,
-         Unit::ThermalExpansion::PerRankine>::ToStandard<NumericType>   },
-        {Unit::ThermalExpansion::PerFahrenheit,
-         Conversions<Unit::ThermalExpansion,
-         Unit::ThermalExpansion::PerFahrenheit>::ToStandard<NumericType>},
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::ThermalExpansion>{4};
 
 }  // namespace Internal
 
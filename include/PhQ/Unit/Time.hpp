@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_TIME_HPP
 #define PHQ_UNIT_TIME_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -92,52 +91,52 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Time unit) {
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::Time> ConsistentUnits<Unit::Time>{
+inline constexpr std::array<std::pair<UnitSystem, Unit::Time>, 4> ConsistentUnits<Unit::Time>{{
     {UnitSystem::MetreKilogramSecondKelvin,  Unit::Time::Second},
     {UnitSystem::MillimetreGramSecondKelvin, Unit::Time::Second},
     {UnitSystem::FootPoundSecondRankine,     Unit::Time::Second},
     {UnitSystem::InchPoundSecondRankine,     Unit::Time::Second},
-};
+}};
 
 template <>
-inline const std::map<Unit::Time, UnitSystem> RelatedUnitSystems<Unit::Time>{};
+inline constexpr std::array<std::pair<Unit::Time, UnitSystem>, 0> RelatedUnitSystems<Unit::Time>{};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::Time, std::string_view> Abbreviations<Unit::Time>{
+inline constexpr std::array<std::pair<Unit::Time, std::string_view>, 6> Abbreviations<Unit::Time>{{
     {Unit::Time::Nanosecond,  "ns" },
     {Unit::Time::Microsecond, "μs" },
     {Unit::Time::Millisecond, "ms" },
     {Unit::Time::Second,      "s"  },
     {Unit::Time::Minute,      "min"},
     {Unit::Time::Hour,        "hr" },
-};
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::Time> Spellings<Unit::Time>{
-    {"ns",           Unit::Time::Nanosecond },
-    {"nanosecond",   Unit::Time::Nanosecond },
-    {"nanoseconds",  Unit::Time::Nanosecond },
-    {"μs",           Unit::Time::Microsecond},
-    {"us",           Unit::Time::Microsecond},
+inline constexpr std::array<std::pair<std::string_view, Unit::Time>, 21> Spellings<Unit::Time>{{
+    {"hour",         Unit::Time::Hour       },
+    {"hours",        Unit::Time::Hour       },
+    {"hr",           Unit::Time::Hour       },
+    {"hrs",          Unit::Time::Hour       },
     {"microsecond",  Unit::Time::Microsecond},
     {"microseconds", Unit::Time::Microsecond},
-    {"ms",           Unit::Time::Millisecond},
     {"millisecond",  Unit::Time::Millisecond},
     {"milliseconds", Unit::Time::Millisecond},
-    {"s",            Unit::Time::Second     },
-    {"second",       Unit::Time::Second     },
-    {"seconds",      Unit::Time::Second     },
     {"min",          Unit::Time::Minute     },
     {"mins",         Unit::Time::Minute     },
     {"minute",       Unit::Time::Minute     },
     {"minutes",      Unit::Time::Minute     },
-    {"hr",           Unit::Time::Hour       },
-    {"hrs",          Unit::Time::Hour       },
-    {"hour",         Unit::Time::Hour       },
-    {"hours",        Unit::Time::Hour       },
-};
+    {"ms",           Unit::Time::Millisecond},
+    {"nanosecond",   Unit::Time::Nanosecond },
+    {"nanoseconds",  Unit::Time::Nanosecond },
+    {"ns",           Unit::Time::Nanosecond },
+    {"s",            Unit::Time::Second     },
+    {"second",       Unit::Time::Second     },
+    {"seconds",      Unit::Time::Second     },
+    {"us",           Unit::Time::Microsecond},
+    {"μs",           Unit::Time::Microsecond},
+}};
 
 // clang-format on
 
@@ -221,36 +220,8 @@ inline constexpr void Conversion<Unit::Time, Unit::Time::Hour>::ToStandard(
   value *= static_cast<NumericType>(3600.0L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::Time, std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Time, NumericType>{
-        {Unit::Time::Nanosecond,
-         Conversions<Unit::Time,                          Unit::Time::Nanosecond>::FromStandard<NumericType> },
-        {Unit::Time::Microsecond,
-         Conversions<Unit::Time,                          Unit::Time::Microsecond>::FromStandard<NumericType>},
-        {Unit::Time::Millisecond,
-         Conversions<Unit::Time,                          Unit::Time::Millisecond>::FromStandard<NumericType>},
-        {Unit::Time::Second,
-         Conversions<Unit::Time,                          Unit::Time::Second>::FromStandard<NumericType>     },
-        {Unit::Time::Minute,
-         Conversions<Unit::Time,                          Unit::Time::Minute>::FromStandard<NumericType>     },
-        {Unit::Time::Hour,        Conversions<Unit::Time, Unit::Time::Hour>::FromStandard<NumericType>       },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Time,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Time, NumericType>{
-        {Unit::Time::Nanosecond,
-         Conversions<Unit::Time,                          Unit::Time::Nanosecond>::ToStandard<NumericType> },
-        {Unit::Time::Microsecond,
-         Conversions<Unit::Time,                          Unit::Time::Microsecond>::ToStandard<NumericType>},
-        {Unit::Time::Millisecond,
-         Conversions<Unit::Time,                          Unit::Time::Millisecond>::ToStandard<NumericType>},
-        {Unit::Time::Second,      Conversions<Unit::Time, Unit::Time::Second>::ToStandard<NumericType>     },
-        {Unit::Time::Minute,      Conversions<Unit::Time, Unit::Time::Minute>::ToStandard<NumericType>     },
-        {Unit::Time::Hour,        Conversions<Unit::Time, Unit::Time::Hour>::ToStandard<NumericType>       },
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Time>{6};
 
 }  // namespace Internal
 
@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_TRANSPORT_ENERGY_CONSUMPTION_HPP
 #define PHQ_UNIT_TRANSPORT_ENERGY_CONSUMPTION_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -132,30 +131,28 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::TransportEnerg
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::TransportEnergyConsumption>
-    ConsistentUnits<Unit::TransportEnergyConsumption>{
-        {UnitSystem::MetreKilogramSecondKelvin,  Unit::TransportEnergyConsumption::JoulePerMetre   },
-        {UnitSystem::MillimetreGramSecondKelvin,
-         Unit::TransportEnergyConsumption::NanojoulePerMillimetre                                  },
-        {UnitSystem::FootPoundSecondRankine,     Unit::TransportEnergyConsumption::FootPoundPerFoot},
-        {UnitSystem::InchPoundSecondRankine,     Unit::TransportEnergyConsumption::InchPoundPerInch},
-};
+inline constexpr std::array<std::pair<UnitSystem, Unit::TransportEnergyConsumption>, 4>
+    ConsistentUnits<Unit::TransportEnergyConsumption>{{
+        {UnitSystem::MetreKilogramSecondKelvin,  Unit::TransportEnergyConsumption::JoulePerMetre         },
+        {UnitSystem::MillimetreGramSecondKelvin, Unit::TransportEnergyConsumption::NanojoulePerMillimetre},
+        {UnitSystem::FootPoundSecondRankine,     Unit::TransportEnergyConsumption::FootPoundPerFoot      },
+        {UnitSystem::InchPoundSecondRankine,     Unit::TransportEnergyConsumption::InchPoundPerInch      },
+}};
 
 template <>
-inline const std::map<Unit::TransportEnergyConsumption, UnitSystem>
-    RelatedUnitSystems<Unit::TransportEnergyConsumption>{
-        {Unit::TransportEnergyConsumption::JoulePerMetre,          UnitSystem::MetreKilogramSecondKelvin},
-        {Unit::TransportEnergyConsumption::NanojoulePerMillimetre,
-         UnitSystem::MillimetreGramSecondKelvin                                                         },
-        {Unit::TransportEnergyConsumption::FootPoundPerFoot,       UnitSystem::FootPoundSecondRankine   },
-        {Unit::TransportEnergyConsumption::InchPoundPerInch,       UnitSystem::InchPoundSecondRankine   },
-};
+inline constexpr std::array<std::pair<Unit::TransportEnergyConsumption, UnitSystem>, 4>
+    RelatedUnitSystems<Unit::TransportEnergyConsumption>{{
+        {Unit::TransportEnergyConsumption::JoulePerMetre,          UnitSystem::MetreKilogramSecondKelvin },
+        {Unit::TransportEnergyConsumption::NanojoulePerMillimetre, UnitSystem::MillimetreGramSecondKelvin},
+        {Unit::TransportEnergyConsumption::FootPoundPerFoot,       UnitSystem::FootPoundSecondRankine    },
+        {Unit::TransportEnergyConsumption::InchPoundPerInch,       UnitSystem::InchPoundSecondRankine    },
+}};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::TransportEnergyConsumption, std::string_view>
-    Abbreviations<Unit::TransportEnergyConsumption>{
+inline constexpr std::array<std::pair<Unit::TransportEnergyConsumption, std::string_view>, 19>
+    Abbreviations<Unit::TransportEnergyConsumption>{{
         {Unit::TransportEnergyConsumption::JoulePerMile,               "J/mi"     },
         {Unit::TransportEnergyConsumption::JoulePerKilometre,          "J/km"     },
         {Unit::TransportEnergyConsumption::JoulePerMetre,              "J/m"      },
@@ -175,45 +172,45 @@ inline const std::map<Unit::TransportEnergyConsumption, std::string_view>
         {Unit::TransportEnergyConsumption::KilowattHourPerMetre,       "kW·hr/m"  },
         {Unit::TransportEnergyConsumption::FootPoundPerFoot,           "ft·lbf/ft"},
         {Unit::TransportEnergyConsumption::InchPoundPerInch,           "in·lbf/in"},
-};
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, Unit::TransportEnergyConsumption>
-    Spellings<Unit::TransportEnergyConsumption>{
-        {"J/mi",      Unit::TransportEnergyConsumption::JoulePerMile              },
+inline constexpr std::array<std::pair<std::string_view, Unit::TransportEnergyConsumption>, 33>
+    Spellings<Unit::TransportEnergyConsumption>{{
         {"J/km",      Unit::TransportEnergyConsumption::JoulePerKilometre         },
         {"J/m",       Unit::TransportEnergyConsumption::JoulePerMetre             },
-        {"nJ/mm",     Unit::TransportEnergyConsumption::NanojoulePerMillimetre    },
-        {"kJ/mi",     Unit::TransportEnergyConsumption::KilojoulePerMile          },
-        {"W·min/mi",  Unit::TransportEnergyConsumption::WattMinutePerMile         },
-        {"W*min/mi",  Unit::TransportEnergyConsumption::WattMinutePerMile         },
-        {"W·hr/mi",   Unit::TransportEnergyConsumption::WattHourPerMile           },
+        {"J/mi",      Unit::TransportEnergyConsumption::JoulePerMile              },
+        {"W*hr/km",   Unit::TransportEnergyConsumption::WattHourPerKilometre      },
+        {"W*hr/m",    Unit::TransportEnergyConsumption::WattHourPerMetre          },
         {"W*hr/mi",   Unit::TransportEnergyConsumption::WattHourPerMile           },
-        {"W·min/km",  Unit::TransportEnergyConsumption::WattMinutePerKilometre    },
         {"W*min/km",  Unit::TransportEnergyConsumption::WattMinutePerKilometre    },
-        {"W·hr/km",   Unit::TransportEnergyConsumption::WattHourPerKilometre      },
-        {"W*hr/km",   Unit::TransportEnergyConsumption::WattHourPerKilometre      },
-        {"W·min/m",   Unit::TransportEnergyConsumption::WattMinutePerMetre        },
         {"W*min/m",   Unit::TransportEnergyConsumption::WattMinutePerMetre        },
+        {"W*min/mi",  Unit::TransportEnergyConsumption::WattMinutePerMile         },
+        {"W·hr/km",   Unit::TransportEnergyConsumption::WattHourPerKilometre      },
         {"W·hr/m",    Unit::TransportEnergyConsumption::WattHourPerMetre          },
-        {"W*hr/m",    Unit::TransportEnergyConsumption::WattHourPerMetre          },
-        {"kW·min/mi", Unit::TransportEnergyConsumption::KilowattMinutePerMile     },
-        {"kW*min/mi", Unit::TransportEnergyConsumption::KilowattMinutePerMile     },
-        {"kW·hr/mi",  Unit::TransportEnergyConsumption::KilowattHourPerMile       },
+        {"W·hr/mi",   Unit::TransportEnergyConsumption::WattHourPerMile           },
+        {"W·min/km",  Unit::TransportEnergyConsumption::WattMinutePerKilometre    },
+        {"W·min/m",   Unit::TransportEnergyConsumption::WattMinutePerMetre        },
+        {"W·min/mi",  Unit::TransportEnergyConsumption::WattMinutePerMile         },
+        {"ft·lb/ft",  Unit::TransportEnergyConsumption::FootPoundPerFoot          },
+        {"ft·lbf/ft", Unit::TransportEnergyConsumption::FootPoundPerFoot          },
+        {"in·lb/in",  Unit::TransportEnergyConsumption::InchPoundPerInch          },
+        {"in·lbf/in", Unit::TransportEnergyConsumption::InchPoundPerInch          },
+        {"kJ/mi",     Unit::TransportEnergyConsumption::KilojoulePerMile          },
+        {"kW*hr/km",  Unit::TransportEnergyConsumption::KilowattHourPerKilometre  },
+        {"kW*hr/m",   Unit::TransportEnergyConsumption::KilowattHourPerMetre      },
         {"kW*hr/mi",  Unit::TransportEnergyConsumption::KilowattHourPerMile       },
-        {"kW·min/km", Unit::TransportEnergyConsumption::KilowattMinutePerKilometre},
         {"kW*min/km", Unit::TransportEnergyConsumption::KilowattMinutePerKilometre},
-        {"kW·hr/km",  Unit::TransportEnergyConsumption::KilowattHourPerKilometre  },
-        {"kW*hr/km",  Unit::TransportEnergyConsumption::KilowattHourPerKilometre  },
-        {"kW·min/m",  Unit::TransportEnergyConsumption::KilowattMinutePerMetre    },
         {"kW*min/m",  Unit::TransportEnergyConsumption::KilowattMinutePerMetre    },
+        {"kW*min/mi", Unit::TransportEnergyConsumption::KilowattMinutePerMile     },
+        {"kW·hr/km",  Unit::TransportEnergyConsumption::KilowattHourPerKilometre  },
         {"kW·hr/m",   Unit::TransportEnergyConsumption::KilowattHourPerMetre      },
-        {"kW*hr/m",   Unit::TransportEnergyConsumption::KilowattHourPerMetre      },
-        {"ft·lbf/ft", Unit::TransportEnergyConsumption::FootPoundPerFoot          },
-        {"ft·lb/ft",  Unit::TransportEnergyConsumption::FootPoundPerFoot          },
-        {"in·lbf/in", Unit::TransportEnergyConsumption::InchPoundPerInch          },
-        {"in·lb/in",  Unit::TransportEnergyConsumption::InchPoundPerInch          },
-};
+        {"kW·hr/mi",  Unit::TransportEnergyConsumption::KilowattHourPerMile       },
+        {"kW·min/km", Unit::TransportEnergyConsumption::KilowattMinutePerKilometre},
+        {"kW·min/m",  Unit::TransportEnergyConsumption::KilowattMinutePerMetre    },
+        {"kW·min/mi", Unit::TransportEnergyConsumption::KilowattMinutePerMile     },
+        {"nJ/mm",     Unit::TransportEnergyConsumption::NanojoulePerMillimetre    },
+}};
 
 // clang-format on
 
@@ -520,157 +517,8 @@ Conversion<Unit::TransportEnergyConsumption, Unit::TransportEnergyConsumption::I
   value *= static_cast<NumericType>(0.45359237L) * static_cast<NumericType>(9.80665L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::TransportEnergyConsumption,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::TransportEnergyConsumption, NumericType>{
-        {Unit::TransportEnergyConsumption::JoulePerMile,
-         Conversions<Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::JoulePerMile>::FromStandard<NumericType>          },
-        {Unit::TransportEnergyConsumption::JoulePerKilometre,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::JoulePerKilometre>::FromStandard<NumericType>     },
-        {Unit::TransportEnergyConsumption::JoulePerMetre,
-         Conversions<Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::JoulePerMetre>::FromStandard<NumericType>         },
-        {Unit::TransportEnergyConsumption::NanojoulePerMillimetre,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::NanojoulePerMillimetre>::FromStandard<NumericType>},
-        {Unit::TransportEnergyConsumption::KilojoulePerMile,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::KilojoulePerMile>::FromStandard<NumericType>      },
-        {Unit::TransportEnergyConsumption::WattMinutePerMile,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::WattMinutePerMile>::FromStandard<NumericType>     },
-        {Unit::TransportEnergyConsumption::WattHourPerMile,
-         Conversions<Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::WattHourPerMile>::FromStandard<NumericType>       },
-        {Unit::TransportEnergyConsumption::WattMinutePerKilometre,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::WattMinutePerKilometre>::FromStandard<NumericType>},
-        {Unit::TransportEnergyConsumption::WattHourPerKilometre,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::WattHourPerKilometre>::FromStandard<NumericType>  },
-        {Unit::TransportEnergyConsumption::WattMinutePerMetre,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::WattMinutePerMetre>::FromStandard<NumericType>    },
-        {Unit::TransportEnergyConsumption::WattHourPerMetre,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::WattHourPerMetre>::FromStandard<NumericType>      },
-        {Unit::TransportEnergyConsumption::KilowattMinutePerMile,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::KilowattMinutePerMile>::FromStandard<NumericType> },
-        {Unit::TransportEnergyConsumption::KilowattHourPerMile,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::KilowattHourPerMile>::FromStandard<NumericType>   },
-        {Unit::TransportEnergyConsumption::KilowattMinutePerKilometre,
-         Conversions<Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::KilowattMinutePerKilometre>::
-             FromStandard<NumericType>                                                       },
-        {Unit::TransportEnergyConsumption::KilowattHourPerKilometre,
-         Conversions<Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::KilowattHourPerKilometre>::
-             FromStandard<NumericType>                                                       },
-        {Unit::TransportEnergyConsumption::KilowattMinutePerMetre,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::KilowattMinutePerMetre>::FromStandard<NumericType>},
-        {Unit::TransportEnergyConsumption::KilowattHourPerMetre,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::KilowattHourPerMetre>::FromStandard<NumericType>  },
-        {Unit::TransportEnergyConsumption::FootPoundPerFoot,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::FootPoundPerFoot>::FromStandard<NumericType>      },
-        {Unit::TransportEnergyConsumption::InchPoundPerInch,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::InchPoundPerInch>::FromStandard<NumericType>      },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::TransportEnergyConsumption,
-                      std::function<void(NumericType* const values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::TransportEnergyConsumption, NumericType>{
-        {Unit::TransportEnergyConsumption::JoulePerMile,
-         Conversions<Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::JoulePerMile>::ToStandard<NumericType>            },
-        {Unit::TransportEnergyConsumption::JoulePerKilometre,
-         Conversions<Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::JoulePerKilometre>::ToStandard<NumericType>       },
-        {Unit::TransportEnergyConsumption::JoulePerMetre,
-         Conversions<Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::JoulePerMetre>::ToStandard<NumericType>           },
-        {Unit::TransportEnergyConsumption::NanojoulePerMillimetre,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::NanojoulePerMillimetre>::ToStandard<NumericType>  },
-        {Unit::TransportEnergyConsumption::KilojoulePerMile,
-         Conversions<Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::KilojoulePerMile>::ToStandard<NumericType>        },
-        {Unit::TransportEnergyConsumption::WattMinutePerMile,
-         Conversions<Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::WattMinutePerMile>::ToStandard<NumericType>       },
-        {Unit::TransportEnergyConsumption::WattHourPerMile,
-         Conversions<Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::WattHourPerMile>::ToStandard<NumericType>         },
-        {Unit::TransportEnergyConsumption::WattMinutePerKilometre,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::WattMinutePerKilometre>::ToStandard<NumericType>  },
-        {Unit::TransportEnergyConsumption::WattHourPerKilometre,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::WattHourPerKilometre>::ToStandard<NumericType>    },
-        {Unit::TransportEnergyConsumption::WattMinutePerMetre,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::WattMinutePerMetre>::ToStandard<NumericType>      },
-        {Unit::TransportEnergyConsumption::WattHourPerMetre,
-         Conversions<Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::WattHourPerMetre>::ToStandard<NumericType>        },
-        {Unit::TransportEnergyConsumption::KilowattMinutePerMile,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::KilowattMinutePerMile>::ToStandard<NumericType>   },
-        {Unit::TransportEnergyConsumption::KilowattHourPerMile,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::KilowattHourPerMile>::ToStandard<NumericType>     },
-        {Unit::TransportEnergyConsumption::KilowattMinutePerKilometre,
-         Conversions<Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::KilowattMinutePerKilometre>::
-             ToStandard<NumericType>                                                         },
-        {Unit::TransportEnergyConsumption::KilowattHourPerKilometre,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::KilowattHourPerKilometre>::ToStandard<NumericType>},
-        {Unit::TransportEnergyConsumption::KilowattMinutePerMetre,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::KilowattMinutePerMetre>::ToStandard<NumericType>  },
-        {Unit::TransportEnergyConsumption::KilowattHourPerMetre,
-         Conversions<
-             Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::KilowattHourPerMetre>::ToStandard<NumericType>    },
-        {Unit::TransportEnergyConsumption::FootPoundPerFoot,
-         Conversions<Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::FootPoundPerFoot>::ToStandard<NumericType>        },
-        {Unit::TransportEnergyConsumption::InchPoundPerInch,
-         Conversions<Unit::TransportEnergyConsumption,
-         Unit::TransportEnergyConsumption::InchPoundPerInch>::ToStandard<NumericType>        },
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::TransportEnergyConsumption>{19};
 
 }  // namespace Internal
 
@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_VOLUME_HPP
 #define PHQ_UNIT_VOLUME_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -119,83 +118,85 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::Volume unit) {
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::Volume> ConsistentUnits<Unit::Volume>{
+inline constexpr std::array<std::pair<UnitSystem, Unit::Volume>, 4> ConsistentUnits<Unit::Volume>{{
     {UnitSystem::MetreKilogramSecondKelvin,  Unit::Volume::CubicMetre     },
     {UnitSystem::MillimetreGramSecondKelvin, Unit::Volume::CubicMillimetre},
     {UnitSystem::FootPoundSecondRankine,     Unit::Volume::CubicFoot      },
     {UnitSystem::InchPoundSecondRankine,     Unit::Volume::CubicInch      },
-};
+}};
 
 template <>
-inline const std::map<Unit::Volume, UnitSystem> RelatedUnitSystems<Unit::Volume>{
-    {Unit::Volume::CubicMetre,      UnitSystem::MetreKilogramSecondKelvin },
-    {Unit::Volume::CubicMillimetre, UnitSystem::MillimetreGramSecondKelvin},
-    {Unit::Volume::CubicFoot,       UnitSystem::FootPoundSecondRankine    },
-    {Unit::Volume::CubicInch,       UnitSystem::InchPoundSecondRankine    },
-};
+inline constexpr std::array<std::pair<Unit::Volume, UnitSystem>, 4>
+    RelatedUnitSystems<Unit::Volume>{{
+        {Unit::Volume::CubicMetre,      UnitSystem::MetreKilogramSecondKelvin },
+        {Unit::Volume::CubicFoot,       UnitSystem::FootPoundSecondRankine    },
+        {Unit::Volume::CubicInch,       UnitSystem::InchPoundSecondRankine    },
+        {Unit::Volume::CubicMillimetre, UnitSystem::MillimetreGramSecondKelvin},
+}};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::Volume, std::string_view> Abbreviations<Unit::Volume>{
-    {Unit::Volume::CubicNauticalMile, "nmi^3"},
-    {Unit::Volume::CubicMile,         "mi^3" },
-    {Unit::Volume::CubicKilometre,    "km^3" },
-    {Unit::Volume::CubicMetre,        "m^3"  },
-    {Unit::Volume::CubicYard,         "yd^3" },
-    {Unit::Volume::CubicFoot,         "ft^3" },
-    {Unit::Volume::CubicDecimetre,    "dm^3" },
-    {Unit::Volume::Litre,             "L"    },
-    {Unit::Volume::CubicInch,         "in^3" },
-    {Unit::Volume::CubicCentimetre,   "cm^3" },
-    {Unit::Volume::Millilitre,        "mL"   },
-    {Unit::Volume::CubicMillimetre,   "mm^3" },
-    {Unit::Volume::CubicMilliinch,    "mil^3"},
-    {Unit::Volume::CubicMicrometre,   "μm^3" },
-    {Unit::Volume::CubicMicroinch,    "μin^3"},
-};
-
-template <>
-inline const std::unordered_map<std::string_view, Unit::Volume> Spellings<Unit::Volume>{
-    {"nmi^3",       Unit::Volume::CubicNauticalMile},
-    {"nmi3",        Unit::Volume::CubicNauticalMile},
-    {"mi^3",        Unit::Volume::CubicMile        },
-    {"mi3",         Unit::Volume::CubicMile        },
-    {"km^3",        Unit::Volume::CubicKilometre   },
-    {"km3",         Unit::Volume::CubicKilometre   },
-    {"m^3",         Unit::Volume::CubicMetre       },
-    {"m3",          Unit::Volume::CubicMetre       },
-    {"yd^3",        Unit::Volume::CubicYard        },
-    {"yd3",         Unit::Volume::CubicYard        },
-    {"ft^3",        Unit::Volume::CubicFoot        },
-    {"ft3",         Unit::Volume::CubicFoot        },
-    {"dm^3",        Unit::Volume::CubicDecimetre   },
-    {"dm3",         Unit::Volume::CubicDecimetre   },
+inline constexpr std::array<std::pair<Unit::Volume, std::string_view>, 15>
+    Abbreviations<Unit::Volume>{{
+        {Unit::Volume::CubicNauticalMile, "nmi^3"},
+        {Unit::Volume::CubicMile,         "mi^3" },
+        {Unit::Volume::CubicKilometre,    "km^3" },
+        {Unit::Volume::CubicMetre,        "m^3"  },
+        {Unit::Volume::CubicYard,         "yd^3" },
+        {Unit::Volume::CubicFoot,         "ft^3" },
+        {Unit::Volume::CubicDecimetre,    "dm^3" },
+        {Unit::Volume::Litre,             "L"    },
+        {Unit::Volume::CubicInch,         "in^3" },
+        {Unit::Volume::CubicCentimetre,   "cm^3" },
+        {Unit::Volume::Millilitre,        "mL"   },
+        {Unit::Volume::CubicMillimetre,   "mm^3" },
+        {Unit::Volume::CubicMilliinch,    "mil^3"},
+        {Unit::Volume::CubicMicrometre,   "μm^3" },
+        {Unit::Volume::CubicMicroinch,    "μin^3"},
+}};
+
+template <>
+inline constexpr std::array<std::pair<std::string_view, Unit::Volume>, 38> Spellings<Unit::Volume>{{
     {"L",           Unit::Volume::Litre            },
-    {"in^3",        Unit::Volume::CubicInch        },
-    {"in3",         Unit::Volume::CubicInch        },
-    {"cm^3",        Unit::Volume::CubicCentimetre  },
     {"cm3",         Unit::Volume::CubicCentimetre  },
+    {"cm^3",        Unit::Volume::CubicCentimetre  },
+    {"dm3",         Unit::Volume::CubicDecimetre   },
+    {"dm^3",        Unit::Volume::CubicDecimetre   },
+    {"ft3",         Unit::Volume::CubicFoot        },
+    {"ft^3",        Unit::Volume::CubicFoot        },
+    {"in3",         Unit::Volume::CubicInch        },
+    {"in^3",        Unit::Volume::CubicInch        },
+    {"km3",         Unit::Volume::CubicKilometre   },
+    {"km^3",        Unit::Volume::CubicKilometre   },
+    {"m3",          Unit::Volume::CubicMetre       },
     {"mL",          Unit::Volume::Millilitre       },
-    {"mm^3",        Unit::Volume::CubicMillimetre  },
-    {"mm3",         Unit::Volume::CubicMillimetre  },
-    {"millinch^3",  Unit::Volume::CubicMilliinch   },
-    {"millinch3",   Unit::Volume::CubicMilliinch   },
-    {"milliinch^3", Unit::Volume::CubicMilliinch   },
-    {"milliinch3",  Unit::Volume::CubicMilliinch   },
-    {"mil^3",       Unit::Volume::CubicMilliinch   },
+    {"m^3",         Unit::Volume::CubicMetre       },
+    {"mi3",         Unit::Volume::CubicMile        },
+    {"mi^3",        Unit::Volume::CubicMile        },
     {"mil3",        Unit::Volume::CubicMilliinch   },
-    {"thou^3",      Unit::Volume::CubicMilliinch   },
+    {"mil^3",       Unit::Volume::CubicMilliinch   },
+    {"milliinch3",  Unit::Volume::CubicMilliinch   },
+    {"milliinch^3", Unit::Volume::CubicMilliinch   },
+    {"millinch3",   Unit::Volume::CubicMilliinch   },
+    {"millinch^3",  Unit::Volume::CubicMilliinch   },
+    {"mm3",         Unit::Volume::CubicMillimetre  },
+    {"mm^3",        Unit::Volume::CubicMillimetre  },
+    {"nmi3",        Unit::Volume::CubicNauticalMile},
+    {"nmi^3",       Unit::Volume::CubicNauticalMile},
     {"thou3",       Unit::Volume::CubicMilliinch   },
-    {"μm^3",        Unit::Volume::CubicMicrometre  },
-    {"μm3",         Unit::Volume::CubicMicrometre  },
-    {"um^3",        Unit::Volume::CubicMicrometre  },
+    {"thou^3",      Unit::Volume::CubicMilliinch   },
+    {"uin3",        Unit::Volume::CubicMicroinch   },
+    {"uin^3",       Unit::Volume::CubicMicroinch   },
     {"um3",         Unit::Volume::CubicMicrometre  },
-    {"μin^3",       Unit::Volume::CubicMicroinch   },
+    {"um^3",        Unit::Volume::CubicMicrometre  },
+    {"yd3",         Unit::Volume::CubicYard        },
+    {"yd^3",        Unit::Volume::CubicYard        },
     {"μin3",        Unit::Volume::CubicMicroinch   },
-    {"uin^3",       Unit::Volume::CubicMicroinch   },
-    {"uin3",        Unit::Volume::CubicMicroinch   },
-};
+    {"μin^3",       Unit::Volume::CubicMicroinch   },
+    {"μm3",         Unit::Volume::CubicMicrometre  },
+    {"μm^3",        Unit::Volume::CubicMicrometre  },
+}};
 
 // clang-format on
 
@@ -419,76 +420,8 @@ inline constexpr void Conversion<Unit::Volume, Unit::Volume::CubicMicroinch>::To
            * static_cast<NumericType>(0.0000000254L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::Volume, std::function<void(NumericType* const, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::Volume, NumericType>{
-        {Unit::Volume::CubicNauticalMile,
-         Conversions<Unit::Volume, Unit::Volume::CubicNauticalMile>::FromStandard<NumericType>},
-        {Unit::Volume::CubicMile,
-         Conversions<Unit::Volume, Unit::Volume::CubicMile>::FromStandard<NumericType>        },
-        {Unit::Volume::CubicKilometre,
-         Conversions<Unit::Volume, Unit::Volume::CubicKilometre>::FromStandard<NumericType>   },
-        {Unit::Volume::CubicMetre,
-         Conversions<Unit::Volume, Unit::Volume::CubicMetre>::FromStandard<NumericType>       },
-        {Unit::Volume::CubicYard,
-         Conversions<Unit::Volume, Unit::Volume::CubicYard>::FromStandard<NumericType>        },
-        {Unit::Volume::CubicFoot,
-         Conversions<Unit::Volume, Unit::Volume::CubicFoot>::FromStandard<NumericType>        },
-        {Unit::Volume::CubicDecimetre,
-         Conversions<Unit::Volume, Unit::Volume::CubicDecimetre>::FromStandard<NumericType>   },
-        {Unit::Volume::Litre,
-         Conversions<Unit::Volume, Unit::Volume::Litre>::FromStandard<NumericType>            },
-        {Unit::Volume::CubicInch,
-         Conversions<Unit::Volume, Unit::Volume::CubicInch>::FromStandard<NumericType>        },
-        {Unit::Volume::CubicCentimetre,
-         Conversions<Unit::Volume, Unit::Volume::CubicCentimetre>::FromStandard<NumericType>  },
-        {Unit::Volume::Millilitre,
-         Conversions<Unit::Volume, Unit::Volume::Millilitre>::FromStandard<NumericType>       },
-        {Unit::Volume::CubicMillimetre,
-         Conversions<Unit::Volume, Unit::Volume::CubicMillimetre>::FromStandard<NumericType>  },
-        {Unit::Volume::CubicMilliinch,
-         Conversions<Unit::Volume, Unit::Volume::CubicMilliinch>::FromStandard<NumericType>   },
-        {Unit::Volume::CubicMicrometre,
-         Conversions<Unit::Volume, Unit::Volume::CubicMicrometre>::FromStandard<NumericType>  },
-        {Unit::Volume::CubicMicroinch,
-         Conversions<Unit::Volume, Unit::Volume::CubicMicroinch>::FromStandard<NumericType>   },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::Volume,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::Volume, NumericType>{
-        {Unit::Volume::CubicNauticalMile,
-         Conversions<Unit::Volume, Unit::Volume::CubicNauticalMile>::ToStandard<NumericType>},
-        {Unit::Volume::CubicMile,
-         Conversions<Unit::Volume, Unit::Volume::CubicMile>::ToStandard<NumericType>        },
-        {Unit::Volume::CubicKilometre,
-         Conversions<Unit::Volume, Unit::Volume::CubicKilometre>::ToStandard<NumericType>   },
-        {Unit::Volume::CubicMetre,
-         Conversions<Unit::Volume, Unit::Volume::CubicMetre>::ToStandard<NumericType>       },
-        {Unit::Volume::CubicYard,
-         Conversions<Unit::Volume, Unit::Volume::CubicYard>::ToStandard<NumericType>        },
-        {Unit::Volume::CubicFoot,
-         Conversions<Unit::Volume, Unit::Volume::CubicFoot>::ToStandard<NumericType>        },
-        {Unit::Volume::CubicDecimetre,
-         Conversions<Unit::Volume, Unit::Volume::CubicDecimetre>::ToStandard<NumericType>   },
-        {Unit::Volume::Litre,
-         Conversions<Unit::Volume, Unit::Volume::Litre>::ToStandard<NumericType>            },
-        {Unit::Volume::CubicInch,
-         Conversions<Unit::Volume, Unit::Volume::CubicInch>::ToStandard<NumericType>        },
-        {Unit::Volume::CubicCentimetre,
-         Conversions<Unit::Volume, Unit::Volume::CubicCentimetre>::ToStandard<NumericType>  },
-        {Unit::Volume::Millilitre,
-         Conversions<Unit::Volume, Unit::Volume::Millilitre>::ToStandard<NumericType>       },
-        {Unit::Volume::CubicMillimetre,
-         Conversions<Unit::Volume, Unit::Volume::CubicMillimetre>::ToStandard<NumericType>  },
-        {Unit::Volume::CubicMilliinch,
-         Conversions<Unit::Volume, Unit::Volume::CubicMilliinch>::ToStandard<NumericType>   },
-        {Unit::Volume::CubicMicrometre,
-         Conversions<Unit::Volume, Unit::Volume::CubicMicrometre>::ToStandard<NumericType>  },
-        {Unit::Volume::CubicMicroinch,
-         Conversions<Unit::Volume, Unit::Volume::CubicMicroinch>::ToStandard<NumericType>   },
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::Volume>{15};
 
 }  // namespace Internal
 
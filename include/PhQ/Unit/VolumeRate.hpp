@@ -25,13 +25,12 @@
 #ifndef PHQ_UNIT_VOLUME_RATE_HPP
 #define PHQ_UNIT_VOLUME_RATE_HPP
 
+#include <array>
 #include <cstddef>
 #include <cstdint>
-#include <functional>
-#include <map>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "../Base.hpp"
 #include "../Dimension/ElectricCurrent.hpp"
@@ -210,189 +209,193 @@ inline std::ostream& operator<<(std::ostream& stream, const Unit::VolumeRate uni
 namespace Internal {
 
 template <>
-inline const std::map<UnitSystem, Unit::VolumeRate> ConsistentUnits<Unit::VolumeRate>{
-    {UnitSystem::MetreKilogramSecondKelvin,  Unit::VolumeRate::CubicMetrePerSecond     },
-    {UnitSystem::MillimetreGramSecondKelvin, Unit::VolumeRate::CubicMillimetrePerSecond},
-    {UnitSystem::FootPoundSecondRankine,     Unit::VolumeRate::CubicFootPerSecond      },
-    {UnitSystem::InchPoundSecondRankine,     Unit::VolumeRate::CubicInchPerSecond      },
-};
+inline constexpr std::array<std::pair<UnitSystem, Unit::VolumeRate>, 4>
+    ConsistentUnits<Unit::VolumeRate>{{
+        {UnitSystem::MetreKilogramSecondKelvin,  Unit::VolumeRate::CubicMetrePerSecond     },
+        {UnitSystem::MillimetreGramSecondKelvin, Unit::VolumeRate::CubicMillimetrePerSecond},
+        {UnitSystem::FootPoundSecondRankine,     Unit::VolumeRate::CubicFootPerSecond      },
+        {UnitSystem::InchPoundSecondRankine,     Unit::VolumeRate::CubicInchPerSecond      },
+}};
 
 template <>
-inline const std::map<Unit::VolumeRate, UnitSystem> RelatedUnitSystems<Unit::VolumeRate>{
-    {Unit::VolumeRate::CubicMetrePerSecond,      UnitSystem::MetreKilogramSecondKelvin },
-    {Unit::VolumeRate::CubicMillimetrePerSecond, UnitSystem::MillimetreGramSecondKelvin},
-    {Unit::VolumeRate::CubicFootPerSecond,       UnitSystem::FootPoundSecondRankine    },
-    {Unit::VolumeRate::CubicInchPerSecond,       UnitSystem::InchPoundSecondRankine    },
-};
+inline constexpr std::array<std::pair<Unit::VolumeRate, UnitSystem>, 4>
+    RelatedUnitSystems<Unit::VolumeRate>{{
+        {Unit::VolumeRate::CubicMetrePerSecond,      UnitSystem::MetreKilogramSecondKelvin },
+        {Unit::VolumeRate::CubicFootPerSecond,       UnitSystem::FootPoundSecondRankine    },
+        {Unit::VolumeRate::CubicInchPerSecond,       UnitSystem::InchPoundSecondRankine    },
+        {Unit::VolumeRate::CubicMillimetrePerSecond, UnitSystem::MillimetreGramSecondKelvin},
+}};
 
 // clang-format off
 
 template <>
-inline const std::map<Unit::VolumeRate, std::string_view> Abbreviations<Unit::VolumeRate>{
-    {Unit::VolumeRate::CubicNauticalMilePerSecond, "nmi^3/s"  },
-    {Unit::VolumeRate::CubicMilePerSecond,         "mi^3/s"   },
-    {Unit::VolumeRate::CubicKilometrePerSecond,    "km^3/s"   },
-    {Unit::VolumeRate::CubicMetrePerSecond,        "m^3/s"    },
-    {Unit::VolumeRate::CubicYardPerSecond,         "yd^3/s"   },
-    {Unit::VolumeRate::CubicFootPerSecond,         "ft^3/s"   },
-    {Unit::VolumeRate::CubicDecimetrePerSecond,    "dm^3/s"   },
-    {Unit::VolumeRate::LitrePerSecond,             "L/s"      },
-    {Unit::VolumeRate::CubicInchPerSecond,         "in^3/s"   },
-    {Unit::VolumeRate::CubicCentimetrePerSecond,   "cm^3/s"   },
-    {Unit::VolumeRate::MillilitrePerSecond,        "mL/s"     },
-    {Unit::VolumeRate::CubicMillimetrePerSecond,   "mm^3/s"   },
-    {Unit::VolumeRate::CubicMilliinchPerSecond,    "mil^3/s"  },
-    {Unit::VolumeRate::CubicMicrometrePerSecond,   "μm^3/s"   },
-    {Unit::VolumeRate::CubicMicroinchPerSecond,    "μin^3/s"  },
-    {Unit::VolumeRate::CubicNauticalMilePerMinute, "nmi^3/min"},
-    {Unit::VolumeRate::CubicMilePerMinute,         "mi^3/min" },
-    {Unit::VolumeRate::CubicKilometrePerMinute,    "km^3/min" },
-    {Unit::VolumeRate::CubicMetrePerMinute,        "m^3/min"  },
-    {Unit::VolumeRate::CubicYardPerMinute,         "yd^3/min" },
-    {Unit::VolumeRate::CubicFootPerMinute,         "ft^3/min" },
-    {Unit::VolumeRate::CubicDecimetrePerMinute,    "dm^3/min" },
-    {Unit::VolumeRate::LitrePerMinute,             "L/min"    },
-    {Unit::VolumeRate::CubicInchPerMinute,         "in^3/min" },
-    {Unit::VolumeRate::CubicCentimetrePerMinute,   "cm^3/min" },
-    {Unit::VolumeRate::MillilitrePerMinute,        "mL/min"   },
-    {Unit::VolumeRate::CubicMillimetrePerMinute,   "mm^3/min" },
-    {Unit::VolumeRate::CubicMilliinchPerMinute,    "mil^3/min"},
-    {Unit::VolumeRate::CubicMicrometrePerMinute,   "μm^3/min" },
-    {Unit::VolumeRate::CubicMicroinchPerMinute,    "μin^3/min"},
-    {Unit::VolumeRate::CubicNauticalMilePerHour,   "nmi^3/hr" },
-    {Unit::VolumeRate::CubicMilePerHour,           "mi^3/hr"  },
-    {Unit::VolumeRate::CubicKilometrePerHour,      "km^3/hr"  },
-    {Unit::VolumeRate::CubicMetrePerHour,          "m^3/hr"   },
-    {Unit::VolumeRate::CubicYardPerHour,           "yd^3/hr"  },
-    {Unit::VolumeRate::CubicFootPerHour,           "ft^3/hr"  },
-    {Unit::VolumeRate::CubicDecimetrePerHour,      "dm^3/hr"  },
-    {Unit::VolumeRate::LitrePerHour,               "L/hr"     },
-    {Unit::VolumeRate::CubicInchPerHour,           "in^3/hr"  },
-    {Unit::VolumeRate::CubicCentimetrePerHour,     "cm^3/hr"  },
-    {Unit::VolumeRate::MillilitrePerHour,          "mL/hr"    },
-    {Unit::VolumeRate::CubicMillimetrePerHour,     "mm^3/hr"  },
-    {Unit::VolumeRate::CubicMilliinchPerHour,      "mil^3/hr" },
-    {Unit::VolumeRate::CubicMicrometrePerHour,     "μm^3/hr"  },
-    {Unit::VolumeRate::CubicMicroinchPerHour,      "μin^3/hr" },
-};
-
-template <>
-inline const std::unordered_map<std::string_view, Unit::VolumeRate> Spellings<Unit::VolumeRate>{
-    {"nmi^3/s",         Unit::VolumeRate::CubicNauticalMilePerSecond},
-    {"nmi3/s",          Unit::VolumeRate::CubicNauticalMilePerSecond},
-    {"mi^3/s",          Unit::VolumeRate::CubicMilePerSecond        },
-    {"mi3/s",           Unit::VolumeRate::CubicMilePerSecond        },
-    {"km^3/s",          Unit::VolumeRate::CubicKilometrePerSecond   },
-    {"km3/s",           Unit::VolumeRate::CubicKilometrePerSecond   },
-    {"m^3/s",           Unit::VolumeRate::CubicMetrePerSecond       },
-    {"m3/s",            Unit::VolumeRate::CubicMetrePerSecond       },
-    {"yd^3/s",          Unit::VolumeRate::CubicYardPerSecond        },
-    {"yd3/s",           Unit::VolumeRate::CubicYardPerSecond        },
-    {"ft^3/s",          Unit::VolumeRate::CubicFootPerSecond        },
-    {"ft3/s",           Unit::VolumeRate::CubicFootPerSecond        },
-    {"dm^3/s",          Unit::VolumeRate::CubicDecimetrePerSecond   },
-    {"dm3/s",           Unit::VolumeRate::CubicDecimetrePerSecond   },
-    {"L/s",             Unit::VolumeRate::LitrePerSecond            },
-    {"in^3/s",          Unit::VolumeRate::CubicInchPerSecond        },
-    {"in3/s",           Unit::VolumeRate::CubicInchPerSecond        },
-    {"cm^3/s",          Unit::VolumeRate::CubicCentimetrePerSecond  },
-    {"cm3/s",           Unit::VolumeRate::CubicCentimetrePerSecond  },
-    {"mL/s",            Unit::VolumeRate::MillilitrePerSecond       },
-    {"mm^3/s",          Unit::VolumeRate::CubicMillimetrePerSecond  },
-    {"mm3/s",           Unit::VolumeRate::CubicMillimetrePerSecond  },
-    {"millinch^3/s",    Unit::VolumeRate::CubicMilliinchPerSecond   },
-    {"millinch3/s",     Unit::VolumeRate::CubicMilliinchPerSecond   },
-    {"milliinch^3/s",   Unit::VolumeRate::CubicMilliinchPerSecond   },
-    {"milliinch3/s",    Unit::VolumeRate::CubicMilliinchPerSecond   },
-    {"mil^3/s",         Unit::VolumeRate::CubicMilliinchPerSecond   },
-    {"mil3/s",          Unit::VolumeRate::CubicMilliinchPerSecond   },
-    {"thou^3/s",        Unit::VolumeRate::CubicMilliinchPerSecond   },
-    {"thou3/s",         Unit::VolumeRate::CubicMilliinchPerSecond   },
-    {"μm^3/s",          Unit::VolumeRate::CubicMicrometrePerSecond  },
-    {"μm3/s",           Unit::VolumeRate::CubicMicrometrePerSecond  },
-    {"um^3/s",          Unit::VolumeRate::CubicMicrometrePerSecond  },
-    {"um3/s",           Unit::VolumeRate::CubicMicrometrePerSecond  },
-    {"μin^3/s",         Unit::VolumeRate::CubicMicroinchPerSecond   },
-    {"μin3/s",          Unit::VolumeRate::CubicMicroinchPerSecond   },
-    {"uin^3/s",         Unit::VolumeRate::CubicMicroinchPerSecond   },
-    {"uin3/s",          Unit::VolumeRate::CubicMicroinchPerSecond   },
-    {"nmi^3/min",       Unit::VolumeRate::CubicNauticalMilePerMinute},
-    {"nmi3/min",        Unit::VolumeRate::CubicNauticalMilePerMinute},
-    {"mi^3/min",        Unit::VolumeRate::CubicMilePerMinute        },
-    {"mi3/min",         Unit::VolumeRate::CubicMilePerMinute        },
-    {"km^3/min",        Unit::VolumeRate::CubicKilometrePerMinute   },
-    {"km3/min",         Unit::VolumeRate::CubicKilometrePerMinute   },
-    {"m^3/min",         Unit::VolumeRate::CubicMetrePerMinute       },
-    {"m3/min",          Unit::VolumeRate::CubicMetrePerMinute       },
-    {"yd^3/min",        Unit::VolumeRate::CubicYardPerMinute        },
-    {"yd3/min",         Unit::VolumeRate::CubicYardPerMinute        },
-    {"ft^3/min",        Unit::VolumeRate::CubicFootPerMinute        },
-    {"ft3/min",         Unit::VolumeRate::CubicFootPerMinute        },
-    {"dm^3/min",        Unit::VolumeRate::CubicDecimetrePerMinute   },
-    {"dm3/min",         Unit::VolumeRate::CubicDecimetrePerMinute   },
-    {"L/min",           Unit::VolumeRate::LitrePerMinute            },
-    {"in^3/min",        Unit::VolumeRate::CubicInchPerMinute        },
-    {"in3/min",         Unit::VolumeRate::CubicInchPerMinute        },
-    {"cm^3/min",        Unit::VolumeRate::CubicCentimetrePerMinute  },
-    {"cm3/min",         Unit::VolumeRate::CubicCentimetrePerMinute  },
-    {"mL/min",          Unit::VolumeRate::MillilitrePerMinute       },
-    {"mm^3/min",        Unit::VolumeRate::CubicMillimetrePerMinute  },
-    {"mm3/min",         Unit::VolumeRate::CubicMillimetrePerMinute  },
-    {"millinch^3/min",  Unit::VolumeRate::CubicMilliinchPerMinute   },
-    {"millinch3/min",   Unit::VolumeRate::CubicMilliinchPerMinute   },
-    {"milliinch^3/min", Unit::VolumeRate::CubicMilliinchPerMinute   },
-    {"milliinch3/min",  Unit::VolumeRate::CubicMilliinchPerMinute   },
-    {"mil^3/min",       Unit::VolumeRate::CubicMilliinchPerMinute   },
-    {"mil3/min",        Unit::VolumeRate::CubicMilliinchPerMinute   },
-    {"thou^3/min",      Unit::VolumeRate::CubicMilliinchPerMinute   },
-    {"thou3/min",       Unit::VolumeRate::CubicMilliinchPerMinute   },
-    {"μm^3/min",        Unit::VolumeRate::CubicMicrometrePerMinute  },
-    {"μm3/min",         Unit::VolumeRate::CubicMicrometrePerMinute  },
-    {"um^3/min",        Unit::VolumeRate::CubicMicrometrePerMinute  },
-    {"um3/min",         Unit::VolumeRate::CubicMicrometrePerMinute  },
-    {"μin^3/min",       Unit::VolumeRate::CubicMicroinchPerMinute   },
-    {"μin3/min",        Unit::VolumeRate::CubicMicroinchPerMinute   },
-    {"uin^3/min",       Unit::VolumeRate::CubicMicroinchPerMinute   },
-    {"uin3/min",        Unit::VolumeRate::CubicMicroinchPerMinute   },
-    {"nmi^3/hr",        Unit::VolumeRate::CubicNauticalMilePerHour  },
-    {"nmi3/hr",         Unit::VolumeRate::CubicNauticalMilePerHour  },
-    {"mi^3/hr",         Unit::VolumeRate::CubicMilePerHour          },
-    {"mi3/hr",          Unit::VolumeRate::CubicMilePerHour          },
-    {"km^3/hr",         Unit::VolumeRate::CubicKilometrePerHour     },
-    {"km3/hr",          Unit::VolumeRate::CubicKilometrePerHour     },
-    {"m^3/hr",          Unit::VolumeRate::CubicMetrePerHour         },
-    {"m3/hr",           Unit::VolumeRate::CubicMetrePerHour         },
-    {"yd^3/hr",         Unit::VolumeRate::CubicYardPerHour          },
-    {"yd3/hr",          Unit::VolumeRate::CubicYardPerHour          },
-    {"ft^3/hr",         Unit::VolumeRate::CubicFootPerHour          },
-    {"ft3/hr",          Unit::VolumeRate::CubicFootPerHour          },
-    {"dm^3/hr",         Unit::VolumeRate::CubicDecimetrePerHour     },
-    {"dm3/hr",          Unit::VolumeRate::CubicDecimetrePerHour     },
-    {"L/hr",            Unit::VolumeRate::LitrePerHour              },
-    {"in^3/hr",         Unit::VolumeRate::CubicInchPerHour          },
-    {"in3/hr",          Unit::VolumeRate::CubicInchPerHour          },
-    {"cm^3/hr",         Unit::VolumeRate::CubicCentimetrePerHour    },
-    {"cm3/hr",          Unit::VolumeRate::CubicCentimetrePerHour    },
-    {"mL/hr",           Unit::VolumeRate::MillilitrePerHour         },
-    {"mm^3/hr",         Unit::VolumeRate::CubicMillimetrePerHour    },
-    {"mm3/hr",          Unit::VolumeRate::CubicMillimetrePerHour    },
-    {"millinch^3/hr",   Unit::VolumeRate::CubicMilliinchPerHour     },
-    {"millinch3/hr",    Unit::VolumeRate::CubicMilliinchPerHour     },
-    {"milliinch^3/hr",  Unit::VolumeRate::CubicMilliinchPerHour     },
-    {"milliinch3/hr",   Unit::VolumeRate::CubicMilliinchPerHour     },
-    {"mil^3/hr",        Unit::VolumeRate::CubicMilliinchPerHour     },
-    {"mil3/hr",         Unit::VolumeRate::CubicMilliinchPerHour     },
-    {"thou^3/hr",       Unit::VolumeRate::CubicMilliinchPerHour     },
-    {"thou3/hr",        Unit::VolumeRate::CubicMilliinchPerHour     },
-    {"μm^3/hr",         Unit::VolumeRate::CubicMicrometrePerHour    },
-    {"μm3/hr",          Unit::VolumeRate::CubicMicrometrePerHour    },
-    {"um^3/hr",         Unit::VolumeRate::CubicMicrometrePerHour    },
-    {"um3/hr",          Unit::VolumeRate::CubicMicrometrePerHour    },
-    {"μin^3/hr",        Unit::VolumeRate::CubicMicroinchPerHour     },
-    {"μin3/hr",         Unit::VolumeRate::CubicMicroinchPerHour     },
-    {"uin^3/hr",        Unit::VolumeRate::CubicMicroinchPerHour     },
-    {"uin3/hr",         Unit::VolumeRate::CubicMicroinchPerHour     },
-};
+inline constexpr std::array<std::pair<Unit::VolumeRate, std::string_view>, 45>
+    Abbreviations<Unit::VolumeRate>{{
+        {Unit::VolumeRate::CubicNauticalMilePerSecond, "nmi^3/s"  },
+        {Unit::VolumeRate::CubicMilePerSecond,         "mi^3/s"   },
+        {Unit::VolumeRate::CubicKilometrePerSecond,    "km^3/s"   },
+        {Unit::VolumeRate::CubicMetrePerSecond,        "m^3/s"    },
+        {Unit::VolumeRate::CubicYardPerSecond,         "yd^3/s"   },
+        {Unit::VolumeRate::CubicFootPerSecond,         "ft^3/s"   },
+        {Unit::VolumeRate::CubicDecimetrePerSecond,    "dm^3/s"   },
+        {Unit::VolumeRate::LitrePerSecond,             "L/s"      },
+        {Unit::VolumeRate::CubicInchPerSecond,         "in^3/s"   },
+        {Unit::VolumeRate::CubicCentimetrePerSecond,   "cm^3/s"   },
+        {Unit::VolumeRate::MillilitrePerSecond,        "mL/s"     },
+        {Unit::VolumeRate::CubicMillimetrePerSecond,   "mm^3/s"   },
+        {Unit::VolumeRate::CubicMilliinchPerSecond,    "mil^3/s"  },
+        {Unit::VolumeRate::CubicMicrometrePerSecond,   "μm^3/s"   },
+        {Unit::VolumeRate::CubicMicroinchPerSecond,    "μin^3/s"  },
+        {Unit::VolumeRate::CubicNauticalMilePerMinute, "nmi^3/min"},
+        {Unit::VolumeRate::CubicMilePerMinute,         "mi^3/min" },
+        {Unit::VolumeRate::CubicKilometrePerMinute,    "km^3/min" },
+        {Unit::VolumeRate::CubicMetrePerMinute,        "m^3/min"  },
+        {Unit::VolumeRate::CubicYardPerMinute,         "yd^3/min" },
+        {Unit::VolumeRate::CubicFootPerMinute,         "ft^3/min" },
+        {Unit::VolumeRate::CubicDecimetrePerMinute,    "dm^3/min" },
+        {Unit::VolumeRate::LitrePerMinute,             "L/min"    },
+        {Unit::VolumeRate::CubicInchPerMinute,         "in^3/min" },
+        {Unit::VolumeRate::CubicCentimetrePerMinute,   "cm^3/min" },
+        {Unit::VolumeRate::MillilitrePerMinute,        "mL/min"   },
+        {Unit::VolumeRate::CubicMillimetrePerMinute,   "mm^3/min" },
+        {Unit::VolumeRate::CubicMilliinchPerMinute,    "mil^3/min"},
+        {Unit::VolumeRate::CubicMicrometrePerMinute,   "μm^3/min" },
+        {Unit::VolumeRate::CubicMicroinchPerMinute,    "μin^3/min"},
+        {Unit::VolumeRate::CubicNauticalMilePerHour,   "nmi^3/hr" },
+        {Unit::VolumeRate::CubicMilePerHour,           "mi^3/hr"  },
+        {Unit::VolumeRate::CubicKilometrePerHour,      "km^3/hr"  },
+        {Unit::VolumeRate::CubicMetrePerHour,          "m^3/hr"   },
+        {Unit::VolumeRate::CubicYardPerHour,           "yd^3/hr"  },
+        {Unit::VolumeRate::CubicFootPerHour,           "ft^3/hr"  },
+        {Unit::VolumeRate::CubicDecimetrePerHour,      "dm^3/hr"  },
+        {Unit::VolumeRate::LitrePerHour,               "L/hr"     },
+        {Unit::VolumeRate::CubicInchPerHour,           "in^3/hr"  },
+        {Unit::VolumeRate::CubicCentimetrePerHour,     "cm^3/hr"  },
+        {Unit::VolumeRate::MillilitrePerHour,          "mL/hr"    },
+        {Unit::VolumeRate::CubicMillimetrePerHour,     "mm^3/hr"  },
+        {Unit::VolumeRate::CubicMilliinchPerHour,      "mil^3/hr" },
+        {Unit::VolumeRate::CubicMicrometrePerHour,     "μm^3/hr"  },
+        {Unit::VolumeRate::CubicMicroinchPerHour,      "μin^3/hr" },
+}};
+
+template <>
+inline constexpr std::array<std::pair<std::string_view, Unit::VolumeRate>, 114>
+    Spellings<Unit::VolumeRate>{{
+        {"L/hr",            Unit::VolumeRate::LitrePerHour              },
+        {"L/min",           Unit::VolumeRate::LitrePerMinute            },
+        {"L/s",             Unit::VolumeRate::LitrePerSecond            },
+        {"cm3/hr",          Unit::VolumeRate::CubicCentimetrePerHour    },
+        {"cm3/min",         Unit::VolumeRate::CubicCentimetrePerMinute  },
+        {"cm3/s",           Unit::VolumeRate::CubicCentimetrePerSecond  },
+        {"cm^3/hr",         Unit::VolumeRate::CubicCentimetrePerHour    },
+        {"cm^3/min",        Unit::VolumeRate::CubicCentimetrePerMinute  },
+        {"cm^3/s",          Unit::VolumeRate::CubicCentimetrePerSecond  },
+        {"dm3/hr",          Unit::VolumeRate::CubicDecimetrePerHour     },
+        {"dm3/min",         Unit::VolumeRate::CubicDecimetrePerMinute   },
+        {"dm3/s",           Unit::VolumeRate::CubicDecimetrePerSecond   },
+        {"dm^3/hr",         Unit::VolumeRate::CubicDecimetrePerHour     },
+        {"dm^3/min",        Unit::VolumeRate::CubicDecimetrePerMinute   },
+        {"dm^3/s",          Unit::VolumeRate::CubicDecimetrePerSecond   },
+        {"ft3/hr",          Unit::VolumeRate::CubicFootPerHour          },
+        {"ft3/min",         Unit::VolumeRate::CubicFootPerMinute        },
+        {"ft3/s",           Unit::VolumeRate::CubicFootPerSecond        },
+        {"ft^3/hr",         Unit::VolumeRate::CubicFootPerHour          },
+        {"ft^3/min",        Unit::VolumeRate::CubicFootPerMinute        },
+        {"ft^3/s",          Unit::VolumeRate::CubicFootPerSecond        },
+        {"in3/hr",          Unit::VolumeRate::CubicInchPerHour          },
+        {"in3/min",         Unit::VolumeRate::CubicInchPerMinute        },
+        {"in3/s",           Unit::VolumeRate::CubicInchPerSecond        },
+        {"in^3/hr",         Unit::VolumeRate::CubicInchPerHour          },
+        {"in^3/min",        Unit::VolumeRate::CubicInchPerMinute        },
+        {"in^3/s",          Unit::VolumeRate::CubicInchPerSecond        },
+        {"km3/hr",          Unit::VolumeRate::CubicKilometrePerHour     },
+        {"km3/min",         Unit::VolumeRate::CubicKilometrePerMinute   },
+        {"km3/s",           Unit::VolumeRate::CubicKilometrePerSecond   },
+        {"km^3/hr",         Unit::VolumeRate::CubicKilometrePerHour     },
+        {"km^3/min",        Unit::VolumeRate::CubicKilometrePerMinute   },
+        {"km^3/s",          Unit::VolumeRate::CubicKilometrePerSecond   },
+        {"m3/hr",           Unit::VolumeRate::CubicMetrePerHour         },
+        {"m3/min",          Unit::VolumeRate::CubicMetrePerMinute       },
+        {"m3/s",            Unit::VolumeRate::CubicMetrePerSecond       },
+        {"mL/hr",           Unit::VolumeRate::MillilitrePerHour         },
+        {"mL/min",          Unit::VolumeRate::MillilitrePerMinute       },
+        {"mL/s",            Unit::VolumeRate::MillilitrePerSecond       },
+        {"m^3/hr",          Unit::VolumeRate::CubicMetrePerHour         },
+        {"m^3/min",         Unit::VolumeRate::CubicMetrePerMinute       },
+        {"m^3/s",           Unit::VolumeRate::CubicMetrePerSecond       },
+        {"mi3/hr",          Unit::VolumeRate::CubicMilePerHour          },
+        {"mi3/min",         Unit::VolumeRate::CubicMilePerMinute        },
+        {"mi3/s",           Unit::VolumeRate::CubicMilePerSecond        },
+        {"mi^3/hr",         Unit::VolumeRate::CubicMilePerHour          },
+        {"mi^3/min",        Unit::VolumeRate::CubicMilePerMinute        },
+        {"mi^3/s",          Unit::VolumeRate::CubicMilePerSecond        },
+        {"mil3/hr",         Unit::VolumeRate::CubicMilliinchPerHour     },
+        {"mil3/min",        Unit::VolumeRate::CubicMilliinchPerMinute   },
+        {"mil3/s",          Unit::VolumeRate::CubicMilliinchPerSecond   },
+        {"mil^3/hr",        Unit::VolumeRate::CubicMilliinchPerHour     },
+        {"mil^3/min",       Unit::VolumeRate::CubicMilliinchPerMinute   },
+        {"mil^3/s",         Unit::VolumeRate::CubicMilliinchPerSecond   },
+        {"milliinch3/hr",   Unit::VolumeRate::CubicMilliinchPerHour     },
+        {"milliinch3/min",  Unit::VolumeRate::CubicMilliinchPerMinute   },
+        {"milliinch3/s",    Unit::VolumeRate::CubicMilliinchPerSecond   },
+        {"milliinch^3/hr",  Unit::VolumeRate::CubicMilliinchPerHour     },
+        {"milliinch^3/min", Unit::VolumeRate::CubicMilliinchPerMinute   },
+        {"milliinch^3/s",   Unit::VolumeRate::CubicMilliinchPerSecond   },
+        {"millinch3/hr",    Unit::VolumeRate::CubicMilliinchPerHour     },
+        {"millinch3/min",   Unit::VolumeRate::CubicMilliinchPerMinute   },
+        {"millinch3/s",     Unit::VolumeRate::CubicMilliinchPerSecond   },
+        {"millinch^3/hr",   Unit::VolumeRate::CubicMilliinchPerHour     },
+        {"millinch^3/min",  Unit::VolumeRate::CubicMilliinchPerMinute   },
+        {"millinch^3/s",    Unit::VolumeRate::CubicMilliinchPerSecond   },
+        {"mm3/hr",          Unit::VolumeRate::CubicMillimetrePerHour    },
+        {"mm3/min",         Unit::VolumeRate::CubicMillimetrePerMinute  },
+        {"mm3/s",           Unit::VolumeRate::CubicMillimetrePerSecond  },
+        {"mm^3/hr",         Unit::VolumeRate::CubicMillimetrePerHour    },
+        {"mm^3/min",        Unit::VolumeRate::CubicMillimetrePerMinute  },
+        {"mm^3/s",          Unit::VolumeRate::CubicMillimetrePerSecond  },
+        {"nmi3/hr",         Unit::VolumeRate::CubicNauticalMilePerHour  },
+        {"nmi3/min",        Unit::VolumeRate::CubicNauticalMilePerMinute},
+        {"nmi3/s",          Unit::VolumeRate::CubicNauticalMilePerSecond},
+        {"nmi^3/hr",        Unit::VolumeRate::CubicNauticalMilePerHour  },
+        {"nmi^3/min",       Unit::VolumeRate::CubicNauticalMilePerMinute},
+        {"nmi^3/s",         Unit::VolumeRate::CubicNauticalMilePerSecond},
+        {"thou3/hr",        Unit::VolumeRate::CubicMilliinchPerHour     },
+        {"thou3/min",       Unit::VolumeRate::CubicMilliinchPerMinute   },
+        {"thou3/s",         Unit::VolumeRate::CubicMilliinchPerSecond   },
+        {"thou^3/hr",       Unit::VolumeRate::CubicMilliinchPerHour     },
+        {"thou^3/min",      Unit::VolumeRate::CubicMilliinchPerMinute   },
+        {"thou^3/s",        Unit::VolumeRate::CubicMilliinchPerSecond   },
+        {"uin3/hr",         Unit::VolumeRate::CubicMicroinchPerHour     },
+        {"uin3/min",        Unit::VolumeRate::CubicMicroinchPerMinute   },
+        {"uin3/s",          Unit::VolumeRate::CubicMicroinchPerSecond   },
+        {"uin^3/hr",        Unit::VolumeRate::CubicMicroinchPerHour     },
+        {"uin^3/min",       Unit::VolumeRate::CubicMicroinchPerMinute   },
+        {"uin^3/s",         Unit::VolumeRate::CubicMicroinchPerSecond   },
+        {"um3/hr",          Unit::VolumeRate::CubicMicrometrePerHour    },
+        {"um3/min",         Unit::VolumeRate::CubicMicrometrePerMinute  },
+        {"um3/s",           Unit::VolumeRate::CubicMicrometrePerSecond  },
+        {"um^3/hr",         Unit::VolumeRate::CubicMicrometrePerHour    },
+        {"um^3/min",        Unit::VolumeRate::CubicMicrometrePerMinute  },
+        {"um^3/s",          Unit::VolumeRate::CubicMicrometrePerSecond  },
+        {"yd3/hr",          Unit::VolumeRate::CubicYardPerHour          },
+        {"yd3/min",         Unit::VolumeRate::CubicYardPerMinute        },
+        {"yd3/s",           Unit::VolumeRate::CubicYardPerSecond        },
+        {"yd^3/hr",         Unit::VolumeRate::CubicYardPerHour          },
+        {"yd^3/min",        Unit::VolumeRate::CubicYardPerMinute        },
+        {"yd^3/s",          Unit::VolumeRate::CubicYardPerSecond        },
+        {"μin3/hr",         Unit::VolumeRate::CubicMicroinchPerHour     },
+        {"μin3/min",        Unit::VolumeRate::CubicMicroinchPerMinute   },
+        {"μin3/s",          Unit::VolumeRate::CubicMicroinchPerSecond   },
+        {"μin^3/hr",        Unit::VolumeRate::CubicMicroinchPerHour     },
+        {"μin^3/min",       Unit::VolumeRate::CubicMicroinchPerMinute   },
+        {"μin^3/s",         Unit::VolumeRate::CubicMicroinchPerSecond   },
+        {"μm3/hr",          Unit::VolumeRate::CubicMicrometrePerHour    },
+        {"μm3/min",         Unit::VolumeRate::CubicMicrometrePerMinute  },
+        {"μm3/s",           Unit::VolumeRate::CubicMicrometrePerSecond  },
+        {"μm^3/hr",         Unit::VolumeRate::CubicMicrometrePerHour    },
+        {"μm^3/min",        Unit::VolumeRate::CubicMicrometrePerMinute  },
+        {"μm^3/s",          Unit::VolumeRate::CubicMicrometrePerSecond  },
+}};
 
 // clang-format on
 
@@ -1156,283 +1159,8 @@ Conversion<Unit::VolumeRate, Unit::VolumeRate::CubicMicroinchPerHour>::ToStandar
            * static_cast<NumericType>(0.0000000254L) / static_cast<NumericType>(3600.0L);
 }
 
-template <typename NumericType>
-inline const std::map<Unit::VolumeRate,
-                      std::function<void(NumericType* const, const std::size_t size)>>
-    MapOfConversionsFromStandard<Unit::VolumeRate, NumericType>{
-        {Unit::VolumeRate::CubicNauticalMilePerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicNauticalMilePerSecond>::FromStandard<NumericType>                },
-        {Unit::VolumeRate::CubicMilePerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMilePerSecond>::FromStandard<NumericType>                        },
-        {Unit::VolumeRate::CubicKilometrePerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicKilometrePerSecond>::FromStandard<NumericType>                   },
-        {Unit::VolumeRate::CubicMetrePerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMetrePerSecond>::FromStandard<NumericType>                       },
-        {Unit::VolumeRate::CubicYardPerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicYardPerSecond>::FromStandard<NumericType>                        },
-        {Unit::VolumeRate::CubicFootPerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicFootPerSecond>::FromStandard<NumericType>                        },
-        {Unit::VolumeRate::CubicDecimetrePerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicDecimetrePerSecond>::FromStandard<NumericType>                   },
-        {Unit::VolumeRate::LitrePerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::LitrePerSecond>::FromStandard<NumericType>                            },
-        {Unit::VolumeRate::CubicInchPerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicInchPerSecond>::FromStandard<NumericType>                        },
-        {Unit::VolumeRate::CubicCentimetrePerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicCentimetrePerSecond>::FromStandard<NumericType>                  },
-        {Unit::VolumeRate::MillilitrePerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::MillilitrePerSecond>::FromStandard<NumericType>                       },
-        {Unit::VolumeRate::CubicMillimetrePerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMillimetrePerSecond>::FromStandard<NumericType>                  },
-        {Unit::VolumeRate::CubicMilliinchPerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMilliinchPerSecond>::FromStandard<NumericType>                   },
-        {Unit::VolumeRate::CubicMicrometrePerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMicrometrePerSecond>::FromStandard<NumericType>                  },
-        {Unit::VolumeRate::CubicMicroinchPerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMicroinchPerSecond>::FromStandard<NumericType>                   },
-        {Unit::VolumeRate::CubicNauticalMilePerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicNauticalMilePerMinute>::FromStandard<NumericType>                },
-        {Unit::VolumeRate::CubicMilePerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMilePerMinute>::FromStandard<NumericType>                        },
-        {Unit::VolumeRate::CubicKilometrePerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicKilometrePerMinute>::FromStandard<NumericType>                   },
-        {Unit::VolumeRate::CubicMetrePerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMetrePerMinute>::FromStandard<NumericType>                       },
-        {Unit::VolumeRate::CubicYardPerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicYardPerMinute>::FromStandard<NumericType>                        },
-        {Unit::VolumeRate::CubicFootPerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicFootPerMinute>::FromStandard<NumericType>                        },
-        {Unit::VolumeRate::CubicDecimetrePerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicDecimetrePerMinute>::FromStandard<NumericType>                   },
-        {Unit::VolumeRate::LitrePerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::LitrePerMinute>::FromStandard<NumericType>                            },
-        {Unit::VolumeRate::CubicInchPerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicInchPerMinute>::FromStandard<NumericType>                        },
-        {Unit::VolumeRate::CubicCentimetrePerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicCentimetrePerMinute>::FromStandard<NumericType>                  },
-        {Unit::VolumeRate::MillilitrePerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::MillilitrePerMinute>::FromStandard<NumericType>                       },
-        {Unit::VolumeRate::CubicMillimetrePerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMillimetrePerMinute>::FromStandard<NumericType>                  },
-        {Unit::VolumeRate::CubicMilliinchPerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMilliinchPerMinute>::FromStandard<NumericType>                   },
-        {Unit::VolumeRate::CubicMicrometrePerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMicrometrePerMinute>::FromStandard<NumericType>                  },
-        {Unit::VolumeRate::CubicMicroinchPerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMicroinchPerMinute>::FromStandard<NumericType>                   },
-        {Unit::VolumeRate::CubicNauticalMilePerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicNauticalMilePerHour>::FromStandard<NumericType>                  },
-        {Unit::VolumeRate::CubicMilePerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMilePerHour>::FromStandard<NumericType>                          },
-        {Unit::VolumeRate::CubicKilometrePerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicKilometrePerHour>::FromStandard<NumericType>                     },
-        {Unit::VolumeRate::CubicMetrePerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMetrePerHour>::FromStandard<NumericType>                         },
-        {Unit::VolumeRate::CubicYardPerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicYardPerHour>::FromStandard<NumericType>                          },
-        {Unit::VolumeRate::CubicFootPerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicFootPerHour>::FromStandard<NumericType>                          },
-        {Unit::VolumeRate::CubicDecimetrePerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicDecimetrePerHour>::FromStandard<NumericType>                     },
-        {Unit::VolumeRate::LitrePerHour,
-         Conversions<Unit::VolumeRate, Unit::VolumeRate::LitrePerHour>::FromStandard<NumericType>},
-        {Unit::VolumeRate::CubicInchPerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicInchPerHour>::FromStandard<NumericType>                          },
-        {Unit::VolumeRate::CubicCentimetrePerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicCentimetrePerHour>::FromStandard<NumericType>                    },
-        {Unit::VolumeRate::MillilitrePerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::MillilitrePerHour>::FromStandard<NumericType>                         },
-        {Unit::VolumeRate::CubicMillimetrePerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMillimetrePerHour>::FromStandard<NumericType>                    },
-        {Unit::VolumeRate::CubicMilliinchPerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMilliinchPerHour>::FromStandard<NumericType>                     },
-        {Unit::VolumeRate::CubicMicrometrePerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMicrometrePerHour>::FromStandard<NumericType>                    },
-        {Unit::VolumeRate::CubicMicroinchPerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMicroinchPerHour>::FromStandard<NumericType>                     },
-};
-
-template <typename NumericType>
-inline const std::map<Unit::VolumeRate,
-                      std::function<void(NumericType* values, const std::size_t size)>>
-    MapOfConversionsToStandard<Unit::VolumeRate, NumericType>{
-        {Unit::VolumeRate::CubicNauticalMilePerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicNauticalMilePerSecond>::ToStandard<NumericType>                  },
-        {Unit::VolumeRate::CubicMilePerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMilePerSecond>::ToStandard<NumericType>                          },
-        {Unit::VolumeRate::CubicKilometrePerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicKilometrePerSecond>::ToStandard<NumericType>                     },
-        {Unit::VolumeRate::CubicMetrePerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMetrePerSecond>::ToStandard<NumericType>                         },
-        {Unit::VolumeRate::CubicYardPerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicYardPerSecond>::ToStandard<NumericType>                          },
-        {Unit::VolumeRate::CubicFootPerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicFootPerSecond>::ToStandard<NumericType>                          },
-        {Unit::VolumeRate::CubicDecimetrePerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicDecimetrePerSecond>::ToStandard<NumericType>                     },
-        {Unit::VolumeRate::LitrePerSecond,
-         Conversions<Unit::VolumeRate, Unit::VolumeRate::LitrePerSecond>::ToStandard<NumericType>},
-        {Unit::VolumeRate::CubicInchPerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicInchPerSecond>::ToStandard<NumericType>                          },
-        {Unit::VolumeRate::CubicCentimetrePerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicCentimetrePerSecond>::ToStandard<NumericType>                    },
-        {Unit::VolumeRate::MillilitrePerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::MillilitrePerSecond>::ToStandard<NumericType>                         },
-        {Unit::VolumeRate::CubicMillimetrePerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMillimetrePerSecond>::ToStandard<NumericType>                    },
-        {Unit::VolumeRate::CubicMilliinchPerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMilliinchPerSecond>::ToStandard<NumericType>                     },
-        {Unit::VolumeRate::CubicMicrometrePerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMicrometrePerSecond>::ToStandard<NumericType>                    },
-        {Unit::VolumeRate::CubicMicroinchPerSecond,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMicroinchPerSecond>::ToStandard<NumericType>                     },
-        {Unit::VolumeRate::CubicNauticalMilePerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicNauticalMilePerMinute>::ToStandard<NumericType>                  },
-        {Unit::VolumeRate::CubicMilePerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMilePerMinute>::ToStandard<NumericType>                          },
-        {Unit::VolumeRate::CubicKilometrePerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicKilometrePerMinute>::ToStandard<NumericType>                     },
-        {Unit::VolumeRate::CubicMetrePerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMetrePerMinute>::ToStandard<NumericType>                         },
-        {Unit::VolumeRate::CubicYardPerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicYardPerMinute>::ToStandard<NumericType>                          },
-        {Unit::VolumeRate::CubicFootPerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicFootPerMinute>::ToStandard<NumericType>                          },
-        {Unit::VolumeRate::CubicDecimetrePerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicDecimetrePerMinute>::ToStandard<NumericType>                     },
-        {Unit::VolumeRate::LitrePerMinute,
-         Conversions<Unit::VolumeRate, Unit::VolumeRate::LitrePerMinute>::ToStandard<NumericType>},
-        {Unit::VolumeRate::CubicInchPerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicInchPerMinute>::ToStandard<NumericType>                          },
-        {Unit::VolumeRate::CubicCentimetrePerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicCentimetrePerMinute>::ToStandard<NumericType>                    },
-        {Unit::VolumeRate::MillilitrePerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::MillilitrePerMinute>::ToStandard<NumericType>                         },
-        {Unit::VolumeRate::CubicMillimetrePerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMillimetrePerMinute>::ToStandard<NumericType>                    },
-        {Unit::VolumeRate::CubicMilliinchPerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMilliinchPerMinute>::ToStandard<NumericType>                     },
-        {Unit::VolumeRate::CubicMicrometrePerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMicrometrePerMinute>::ToStandard<NumericType>                    },
-        {Unit::VolumeRate::CubicMicroinchPerMinute,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMicroinchPerMinute>::ToStandard<NumericType>                     },
-        {Unit::VolumeRate::CubicNauticalMilePerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicNauticalMilePerHour>::ToStandard<NumericType>                    },
-        {Unit::VolumeRate::CubicMilePerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMilePerHour>::ToStandard<NumericType>                            },
-        {Unit::VolumeRate::CubicKilometrePerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicKilometrePerHour>::ToStandard<NumericType>                       },
-        {Unit::VolumeRate::CubicMetrePerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMetrePerHour>::ToStandard<NumericType>                           },
-        {Unit::VolumeRate::CubicYardPerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicYardPerHour>::ToStandard<NumericType>                            },
-        {Unit::VolumeRate::CubicFootPerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicFootPerHour>::ToStandard<NumericType>                            },
-        {Unit::VolumeRate::CubicDecimetrePerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicDecimetrePerHour>::ToStandard<NumericType>                       },
-        {Unit::VolumeRate::LitrePerHour,
-         Conversions<Unit::VolumeRate, Unit::VolumeRate::LitrePerHour>::ToStandard<NumericType>  },
-        {Unit::VolumeRate::CubicInchPerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicInchPerHour>::ToStandard<NumericType>                            },
-        {Unit::VolumeRate::CubicCentimetrePerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicCentimetrePerHour>::ToStandard<NumericType>                      },
-        {Unit::VolumeRate::MillilitrePerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::MillilitrePerHour>::ToStandard<NumericType>                           },
-        {Unit::VolumeRate::CubicMillimetrePerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMillimetrePerHour>::ToStandard<NumericType>                      },
-        {Unit::VolumeRate::CubicMilliinchPerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMilliinchPerHour>::ToStandard<NumericType>                       },
-        {Unit::VolumeRate::CubicMicrometrePerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMicrometrePerHour>::ToStandard<NumericType>                      },
-        {Unit::VolumeRate::CubicMicroinchPerHour,
-         Conversions<Unit::VolumeRate,
-         Unit::VolumeRate::CubicMicroinchPerHour>::ToStandard<NumericType>                       },
-};
+template <>
+inline constexpr const std::size_t NumberOfUnits<Unit::VolumeRate>{45};
 
 }  // namespace Internal
 
@@ -25,12 +25,12 @@
 #ifndef PHQ_UNIT_SYSTEM_HPP
 #define PHQ_UNIT_SYSTEM_HPP
 
+#include <array>
 #include <cstdint>
-#include <map>
 #include <optional>
 #include <ostream>
 #include <string_view>
-#include <unordered_map>
+#include <utility>
 
 #include "Base.hpp"
 
@@ -77,144 +77,146 @@ namespace Internal {
 // clang-format off
 
 template <>
-inline const std::map<UnitSystem, std::string_view> Abbreviations<UnitSystem>{
+inline constexpr std::array<std::pair<UnitSystem, std::string_view>, 4> Abbreviations<UnitSystem>{{
     {UnitSystem::MetreKilogramSecondKelvin,  "m·kg·s·K"   },
     {UnitSystem::MillimetreGramSecondKelvin, "mm·g·s·K"   },
     {UnitSystem::FootPoundSecondRankine,     "ft·lbf·s·°R"},
     {UnitSystem::InchPoundSecondRankine,     "in·lbf·s·°R"},
-};
+}};
 
 template <>
-inline const std::unordered_map<std::string_view, UnitSystem> Spellings<UnitSystem>{
-    {"m·kg·s·K",       UnitSystem::MetreKilogramSecondKelvin },
-    {"m-kg-s-K",       UnitSystem::MetreKilogramSecondKelvin },
-    {"m*kg*s*K",       UnitSystem::MetreKilogramSecondKelvin },
-    {"m kg s K",       UnitSystem::MetreKilogramSecondKelvin },
-    {"m, kg, s, K",    UnitSystem::MetreKilogramSecondKelvin },
-    {"m·kg·s",         UnitSystem::MetreKilogramSecondKelvin },
-    {"m-kg-s",         UnitSystem::MetreKilogramSecondKelvin },
-    {"m*kg*s",         UnitSystem::MetreKilogramSecondKelvin },
-    {"m kg s",         UnitSystem::MetreKilogramSecondKelvin },
-    {"m, kg, s",       UnitSystem::MetreKilogramSecondKelvin },
-    {"m·kg",           UnitSystem::MetreKilogramSecondKelvin },
-    {"m-kg",           UnitSystem::MetreKilogramSecondKelvin },
-    {"m*kg",           UnitSystem::MetreKilogramSecondKelvin },
-    {"m kg",           UnitSystem::MetreKilogramSecondKelvin },
-    {"m, kg",          UnitSystem::MetreKilogramSecondKelvin },
-    {"m",              UnitSystem::MetreKilogramSecondKelvin },
-    {"kg",             UnitSystem::MetreKilogramSecondKelvin },
-    {"mm·g·s·K",       UnitSystem::MillimetreGramSecondKelvin},
-    {"mm-g-s-K",       UnitSystem::MillimetreGramSecondKelvin},
-    {"mm*g*s*K",       UnitSystem::MillimetreGramSecondKelvin},
-    {"mm g s K",       UnitSystem::MillimetreGramSecondKelvin},
-    {"mm, g, s, K",    UnitSystem::MillimetreGramSecondKelvin},
-    {"mm·g·s",         UnitSystem::MillimetreGramSecondKelvin},
-    {"mm-g-s",         UnitSystem::MillimetreGramSecondKelvin},
-    {"mm*g*s",         UnitSystem::MillimetreGramSecondKelvin},
-    {"mm g s",         UnitSystem::MillimetreGramSecondKelvin},
-    {"mm, g, s",       UnitSystem::MillimetreGramSecondKelvin},
-    {"mm·g",           UnitSystem::MillimetreGramSecondKelvin},
-    {"mm-g",           UnitSystem::MillimetreGramSecondKelvin},
-    {"mm*g",           UnitSystem::MillimetreGramSecondKelvin},
-    {"mm g",           UnitSystem::MillimetreGramSecondKelvin},
-    {"mm, g",          UnitSystem::MillimetreGramSecondKelvin},
-    {"mm",             UnitSystem::MillimetreGramSecondKelvin},
-    {"g",              UnitSystem::MillimetreGramSecondKelvin},
-    {"ft·lbf·s·°R",    UnitSystem::FootPoundSecondRankine    },
-    {"ft-lbf-s-°R",    UnitSystem::FootPoundSecondRankine    },
-    {"ft*lbf*s*°R",    UnitSystem::FootPoundSecondRankine    },
-    {"ft lbf s °R",    UnitSystem::FootPoundSecondRankine    },
-    {"ft, lbf, s, °R", UnitSystem::FootPoundSecondRankine    },
-    {"ft·lb·s·°R",     UnitSystem::FootPoundSecondRankine    },
-    {"ft-lb-s-°R",     UnitSystem::FootPoundSecondRankine    },
-    {"ft*lb*s*°R",     UnitSystem::FootPoundSecondRankine    },
+inline constexpr std::array<std::pair<std::string_view, UnitSystem>, 116> Spellings<UnitSystem>{{
+    {"ft",             UnitSystem::FootPoundSecondRankine    },
+    {"ft lb",          UnitSystem::FootPoundSecondRankine    },
+    {"ft lb s",        UnitSystem::FootPoundSecondRankine    },
+    {"ft lb s R",      UnitSystem::FootPoundSecondRankine    },
     {"ft lb s °R",     UnitSystem::FootPoundSecondRankine    },
-    {"ft, lb, s, °R",  UnitSystem::FootPoundSecondRankine    },
-    {"ft·lbf·s·R",     UnitSystem::FootPoundSecondRankine    },
-    {"ft-lbf-s-R",     UnitSystem::FootPoundSecondRankine    },
-    {"ft*lbf*s*R",     UnitSystem::FootPoundSecondRankine    },
+    {"ft lbf",         UnitSystem::FootPoundSecondRankine    },
+    {"ft lbf s",       UnitSystem::FootPoundSecondRankine    },
     {"ft lbf s R",     UnitSystem::FootPoundSecondRankine    },
-    {"ft, lbf, s, R",  UnitSystem::FootPoundSecondRankine    },
-    {"ft·lb·s·R",      UnitSystem::FootPoundSecondRankine    },
-    {"ft-lb-s-R",      UnitSystem::FootPoundSecondRankine    },
+    {"ft lbf s °R",    UnitSystem::FootPoundSecondRankine    },
+    {"ft*lb",          UnitSystem::FootPoundSecondRankine    },
+    {"ft*lb*s",        UnitSystem::FootPoundSecondRankine    },
     {"ft*lb*s*R",      UnitSystem::FootPoundSecondRankine    },
-    {"ft lb s R",      UnitSystem::FootPoundSecondRankine    },
-    {"ft, lb, s, R",   UnitSystem::FootPoundSecondRankine    },
-    {"ft·lbf·s",       UnitSystem::FootPoundSecondRankine    },
-    {"ft-lbf-s",       UnitSystem::FootPoundSecondRankine    },
+    {"ft*lb*s*°R",     UnitSystem::FootPoundSecondRankine    },
+    {"ft*lbf",         UnitSystem::FootPoundSecondRankine    },
     {"ft*lbf*s",       UnitSystem::FootPoundSecondRankine    },
-    {"ft lbf s",       UnitSystem::FootPoundSecondRankine    },
+    {"ft*lbf*s*R",     UnitSystem::FootPoundSecondRankine    },
+    {"ft*lbf*s*°R",    UnitSystem::FootPoundSecondRankine    },
+    {"ft, lb",         UnitSystem::FootPoundSecondRankine    },
+    {"ft, lb, s",      UnitSystem::FootPoundSecondRankine    },
+    {"ft, lb, s, R",   UnitSystem::FootPoundSecondRankine    },
+    {"ft, lb, s, °R",  UnitSystem::FootPoundSecondRankine    },
+    {"ft, lbf",        UnitSystem::FootPoundSecondRankine    },
     {"ft, lbf, s",     UnitSystem::FootPoundSecondRankine    },
-    {"ft·lb·s",        UnitSystem::FootPoundSecondRankine    },
+    {"ft, lbf, s, R",  UnitSystem::FootPoundSecondRankine    },
+    {"ft, lbf, s, °R", UnitSystem::FootPoundSecondRankine    },
+    {"ft-lb",          UnitSystem::FootPoundSecondRankine    },
     {"ft-lb-s",        UnitSystem::FootPoundSecondRankine    },
-    {"ft*lb*s",        UnitSystem::FootPoundSecondRankine    },
-    {"ft lb s",        UnitSystem::FootPoundSecondRankine    },
-    {"ft, lb, s",      UnitSystem::FootPoundSecondRankine    },
-    {"ft·lbf",         UnitSystem::FootPoundSecondRankine    },
+    {"ft-lb-s-R",      UnitSystem::FootPoundSecondRankine    },
+    {"ft-lb-s-°R",     UnitSystem::FootPoundSecondRankine    },
     {"ft-lbf",         UnitSystem::FootPoundSecondRankine    },
-    {"ft*lbf",         UnitSystem::FootPoundSecondRankine    },
-    {"ft lbf",         UnitSystem::FootPoundSecondRankine    },
-    {"ft, lbf",        UnitSystem::FootPoundSecondRankine    },
+    {"ft-lbf-s",       UnitSystem::FootPoundSecondRankine    },
+    {"ft-lbf-s-R",     UnitSystem::FootPoundSecondRankine    },
+    {"ft-lbf-s-°R",    UnitSystem::FootPoundSecondRankine    },
     {"ft·lb",          UnitSystem::FootPoundSecondRankine    },
-    {"ft-lb",          UnitSystem::FootPoundSecondRankine    },
-    {"ft*lb",          UnitSystem::FootPoundSecondRankine    },
-    {"ft lb",          UnitSystem::FootPoundSecondRankine    },
-    {"ft, lb",         UnitSystem::FootPoundSecondRankine    },
-    {"ft",             UnitSystem::FootPoundSecondRankine    },
-    {"in·lbf·s·°R",    UnitSystem::InchPoundSecondRankine    },
-    {"in-lbf-s-°R",    UnitSystem::InchPoundSecondRankine    },
-    {"in*lbf*s*°R",    UnitSystem::InchPoundSecondRankine    },
-    {"in lbf s °R",    UnitSystem::InchPoundSecondRankine    },
-    {"in, lbf, s, °R", UnitSystem::InchPoundSecondRankine    },
-    {"in·lb·s·°R",     UnitSystem::InchPoundSecondRankine    },
-    {"in-lb-s-°R",     UnitSystem::InchPoundSecondRankine    },
-    {"in*lb*s*°R",     UnitSystem::InchPoundSecondRankine    },
+    {"ft·lbf",         UnitSystem::FootPoundSecondRankine    },
+    {"ft·lbf·s",       UnitSystem::FootPoundSecondRankine    },
+    {"ft·lbf·s·R",     UnitSystem::FootPoundSecondRankine    },
+    {"ft·lbf·s·°R",    UnitSystem::FootPoundSecondRankine    },
+    {"ft·lb·s",        UnitSystem::FootPoundSecondRankine    },
+    {"ft·lb·s·R",      UnitSystem::FootPoundSecondRankine    },
+    {"ft·lb·s·°R",     UnitSystem::FootPoundSecondRankine    },
+    {"g",              UnitSystem::MillimetreGramSecondKelvin},
+    {"in",             UnitSystem::InchPoundSecondRankine    },
+    {"in lb",          UnitSystem::InchPoundSecondRankine    },
+    {"in lb s",        UnitSystem::InchPoundSecondRankine    },
+    {"in lb s R",      UnitSystem::InchPoundSecondRankine    },
     {"in lb s °R",     UnitSystem::InchPoundSecondRankine    },
-    {"in, lb, s, °R",  UnitSystem::InchPoundSecondRankine    },
-    {"in·lbf·s·R",     UnitSystem::InchPoundSecondRankine    },
-    {"in-lbf-s-R",     UnitSystem::InchPoundSecondRankine    },
-    {"in*lbf*s*R",     UnitSystem::InchPoundSecondRankine    },
+    {"in lbf",         UnitSystem::InchPoundSecondRankine    },
+    {"in lbf s",       UnitSystem::InchPoundSecondRankine    },
     {"in lbf s R",     UnitSystem::InchPoundSecondRankine    },
-    {"in, lbf, s, R",  UnitSystem::InchPoundSecondRankine    },
-    {"in·lb·s·R",      UnitSystem::InchPoundSecondRankine    },
-    {"in-lb-s-R",      UnitSystem::InchPoundSecondRankine    },
+    {"in lbf s °R",    UnitSystem::InchPoundSecondRankine    },
+    {"in*lb",          UnitSystem::InchPoundSecondRankine    },
+    {"in*lb*s",        UnitSystem::InchPoundSecondRankine    },
     {"in*lb*s*R",      UnitSystem::InchPoundSecondRankine    },
-    {"in lb s R",      UnitSystem::InchPoundSecondRankine    },
-    {"in, lb, s, R",   UnitSystem::InchPoundSecondRankine    },
-    {"in·lbf·s",       UnitSystem::InchPoundSecondRankine    },
-    {"in-lbf-s",       UnitSystem::InchPoundSecondRankine    },
+    {"in*lb*s*°R",     UnitSystem::InchPoundSecondRankine    },
+    {"in*lbf",         UnitSystem::InchPoundSecondRankine    },
     {"in*lbf*s",       UnitSystem::InchPoundSecondRankine    },
-    {"in lbf s",       UnitSystem::InchPoundSecondRankine    },
+    {"in*lbf*s*R",     UnitSystem::InchPoundSecondRankine    },
+    {"in*lbf*s*°R",    UnitSystem::InchPoundSecondRankine    },
+    {"in, lb",         UnitSystem::InchPoundSecondRankine    },
+    {"in, lb, s",      UnitSystem::InchPoundSecondRankine    },
+    {"in, lb, s, R",   UnitSystem::InchPoundSecondRankine    },
+    {"in, lb, s, °R",  UnitSystem::InchPoundSecondRankine    },
+    {"in, lbf",        UnitSystem::InchPoundSecondRankine    },
     {"in, lbf, s",     UnitSystem::InchPoundSecondRankine    },
-    {"in·lb·s",        UnitSystem::InchPoundSecondRankine    },
+    {"in, lbf, s, R",  UnitSystem::InchPoundSecondRankine    },
+    {"in, lbf, s, °R", UnitSystem::InchPoundSecondRankine    },
+    {"in-lb",          UnitSystem::InchPoundSecondRankine    },
     {"in-lb-s",        UnitSystem::InchPoundSecondRankine    },
-    {"in*lb*s",        UnitSystem::InchPoundSecondRankine    },
-    {"in lb s",        UnitSystem::InchPoundSecondRankine    },
-    {"in, lb, s",      UnitSystem::InchPoundSecondRankine    },
-    {"in·lbf",         UnitSystem::InchPoundSecondRankine    },
+    {"in-lb-s-R",      UnitSystem::InchPoundSecondRankine    },
+    {"in-lb-s-°R",     UnitSystem::InchPoundSecondRankine    },
     {"in-lbf",         UnitSystem::InchPoundSecondRankine    },
-    {"in*lbf",         UnitSystem::InchPoundSecondRankine    },
-    {"in lbf",         UnitSystem::InchPoundSecondRankine    },
-    {"in, lbf",        UnitSystem::InchPoundSecondRankine    },
+    {"in-lbf-s",       UnitSystem::InchPoundSecondRankine    },
+    {"in-lbf-s-R",     UnitSystem::InchPoundSecondRankine    },
+    {"in-lbf-s-°R",    UnitSystem::InchPoundSecondRankine    },
     {"in·lb",          UnitSystem::InchPoundSecondRankine    },
-    {"in-lb",          UnitSystem::InchPoundSecondRankine    },
-    {"in*lb",          UnitSystem::InchPoundSecondRankine    },
-    {"in lb",          UnitSystem::InchPoundSecondRankine    },
-    {"in, lb",         UnitSystem::InchPoundSecondRankine    },
-    {"in",             UnitSystem::InchPoundSecondRankine    },
-};
+    {"in·lbf",         UnitSystem::InchPoundSecondRankine    },
+    {"in·lbf·s",       UnitSystem::InchPoundSecondRankine    },
+    {"in·lbf·s·R",     UnitSystem::InchPoundSecondRankine    },
+    {"in·lbf·s·°R",    UnitSystem::InchPoundSecondRankine    },
+    {"in·lb·s",        UnitSystem::InchPoundSecondRankine    },
+    {"in·lb·s·R",      UnitSystem::InchPoundSecondRankine    },
+    {"in·lb·s·°R",     UnitSystem::InchPoundSecondRankine    },
+    {"kg",             UnitSystem::MetreKilogramSecondKelvin },
+    {"m",              UnitSystem::MetreKilogramSecondKelvin },
+    {"m kg",           UnitSystem::MetreKilogramSecondKelvin },
+    {"m kg s",         UnitSystem::MetreKilogramSecondKelvin },
+    {"m kg s K",       UnitSystem::MetreKilogramSecondKelvin },
+    {"m*kg",           UnitSystem::MetreKilogramSecondKelvin },
+    {"m*kg*s",         UnitSystem::MetreKilogramSecondKelvin },
+    {"m*kg*s*K",       UnitSystem::MetreKilogramSecondKelvin },
+    {"m, kg",          UnitSystem::MetreKilogramSecondKelvin },
+    {"m, kg, s",       UnitSystem::MetreKilogramSecondKelvin },
+    {"m, kg, s, K",    UnitSystem::MetreKilogramSecondKelvin },
+    {"m-kg",           UnitSystem::MetreKilogramSecondKelvin },
+    {"m-kg-s",         UnitSystem::MetreKilogramSecondKelvin },
+    {"m-kg-s-K",       UnitSystem::MetreKilogramSecondKelvin },
+    {"mm",             UnitSystem::MillimetreGramSecondKelvin},
+    {"mm g",           UnitSystem::MillimetreGramSecondKelvin},
+    {"mm g s",         UnitSystem::MillimetreGramSecondKelvin},
+    {"mm g s K",       UnitSystem::MillimetreGramSecondKelvin},
+    {"mm*g",           UnitSystem::MillimetreGramSecondKelvin},
+    {"mm*g*s",         UnitSystem::MillimetreGramSecondKelvin},
+    {"mm*g*s*K",       UnitSystem::MillimetreGramSecondKelvin},
+    {"mm, g",          UnitSystem::MillimetreGramSecondKelvin},
+    {"mm, g, s",       UnitSystem::MillimetreGramSecondKelvin},
+    {"mm, g, s, K",    UnitSystem::MillimetreGramSecondKelvin},
+    {"mm-g",           UnitSystem::MillimetreGramSecondKelvin},
+    {"mm-g-s",         UnitSystem::MillimetreGramSecondKelvin},
+    {"mm-g-s-K",       UnitSystem::MillimetreGramSecondKelvin},
+    {"mm·g",           UnitSystem::MillimetreGramSecondKelvin},
+    {"mm·g·s",         UnitSystem::MillimetreGramSecondKelvin},
+    {"mm·g·s·K",       UnitSystem::MillimetreGramSecondKelvin},
+    {"m·kg",           UnitSystem::MetreKilogramSecondKelvin },
+    {"m·kg·s",         UnitSystem::MetreKilogramSecondKelvin },
+    {"m·kg·s·K",       UnitSystem::MetreKilogramSecondKelvin },
+}};
 
 // clang-format on
 
-/// \brief Map of unit systems to their corresponding units. This is an internal implementation
-/// detail and is not intended to be used except by the PhQ::ConsistentUnit function.
+/// \brief Table of unit systems and their corresponding units, sorted by unit system. This is an
+/// internal implementation detail and is not intended to be used except by the PhQ::ConsistentUnit
+/// function.
 template <typename Unit>
-inline const std::map<UnitSystem, Unit> ConsistentUnits;
+inline constexpr std::array<std::pair<UnitSystem, Unit>, 0> ConsistentUnits{};
 
-/// \brief Map of units to their corresponding unit systems. This is an internal implementation
-/// detail and is not intended to be used except by the PhQ::RelatedUnitSystem function.
+/// \brief Table of units and their corresponding unit systems, sorted by unit. This is an internal
+/// implementation detail and is not intended to be used except by the PhQ::RelatedUnitSystem
+/// function.
 template <typename Unit>
-inline const std::map<Unit, UnitSystem> RelatedUnitSystems;
+inline constexpr std::array<std::pair<Unit, UnitSystem>, 0> RelatedUnitSystems{};
 
 }  // namespace Internal
 
@@ -223,7 +225,9 @@ inline const std::map<Unit, UnitSystem> RelatedUnitSystems;
 /// PhQ::Unit::Force::Newton.
 template <typename Unit>
 inline Unit ConsistentUnit(const UnitSystem& system) {
-  return Internal::ConsistentUnits<Unit>.at(system);
+  static_assert(Internal::IsSortedByKey(Internal::ConsistentUnits<Unit>),
+                "The table of consistent units must be sorted by unit system.");
+  return Internal::Find(Internal::ConsistentUnits<Unit>, system)->second;
 }
 
 /// \brief Returns the unit system, if any, that corresponds to a given unit, or std::nullptr
@@ -231,9 +235,11 @@ inline Unit ConsistentUnit(const UnitSystem& system) {
 /// PhQ::UnitSystem::MillimetreGramSecondKelvin.
 template <typename Unit>
 inline std::optional<UnitSystem> RelatedUnitSystem(const Unit& unit) {
-  const typename std::map<Unit, UnitSystem>::const_iterator system{
-      Internal::RelatedUnitSystems<Unit>.find(unit)};
-  if (system != Internal::RelatedUnitSystems<Unit>.cend()) {
+  static_assert(Internal::IsSortedByKey(Internal::RelatedUnitSystems<Unit>),
+                "The table of related unit systems must be sorted by unit.");
+  const std::pair<Unit, UnitSystem>* const system{
+      Internal::Find(Internal::RelatedUnitSystems<Unit>, unit)};
+  if (system != nullptr) {
     return system->second;
   }
   return std::nullopt;
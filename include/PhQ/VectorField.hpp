@@ -0,0 +1,676 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_VECTOR_FIELD_HPP
+#define PHQ_VECTOR_FIELD_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "AlignedAllocator.hpp"
+#include "Direction.hpp"
+#include "QuantityTraits.hpp"
+#include "Simd.hpp"
+#include "Vector.hpp"
+
+namespace PhQ {
+
+namespace Internal {
+
+/// \brief Conversions between an element of a PhQ::VectorField and its x, y, and z Cartesian
+/// components. This primary template handles physical quantities derived from
+/// PhQ::DimensionalVector. Internal implementation detail not intended to be used outside of the
+/// PhQ::VectorField class.
+template <typename Type>
+struct VectorFieldElement {
+  using NumericType = typename QuantityTraitsOf<Type>::NumericType;
+
+  static_assert(QuantityTraitsOf<Type>::ComponentCount == 3,
+                "The elements of a vector field must be three-dimensional vectors.");
+
+  [[nodiscard]] static constexpr Type Make(
+      const NumericType x, const NumericType y, const NumericType z) {
+    return Type::template Create<Standard<typename QuantityTraitsOf<Type>::UnitType>>(x, y, z);
+  }
+
+  [[nodiscard]] static constexpr const Vector<NumericType>& Value(const Type& element) noexcept {
+    return element.Value();
+  }
+};
+
+template <typename Numeric>
+struct VectorFieldElement<Vector<Numeric>> {
+  using NumericType = Numeric;
+
+  [[nodiscard]] static constexpr Vector<NumericType> Make(
+      const NumericType x, const NumericType y, const NumericType z) {
+    return Vector<NumericType>{x, y, z};
+  }
+
+  [[nodiscard]] static constexpr const Vector<NumericType>& Value(
+      const Vector<NumericType>& element) noexcept {
+    return element;
+  }
+};
+
+template <typename Numeric>
+struct VectorFieldElement<Direction<Numeric>> {
+  using NumericType = Numeric;
+
+  [[nodiscard]] static Direction<NumericType> Make(
+      const NumericType x, const NumericType y, const NumericType z) {
+    return Direction<NumericType>{x, y, z};
+  }
+
+  [[nodiscard]] static constexpr const Vector<NumericType>& Value(
+      const Direction<NumericType>& element) noexcept {
+    return element.Value();
+  }
+};
+
+/// \brief Computes the magnitudes of a given number of three-dimensional vectors stored as three
+/// component arrays. The output must not overlap the inputs. Internal implementation detail not
+/// intended to be used outside of the PhQ::VectorField class.
+template <typename NumericType>
+PHQ_ALWAYS_INLINE inline void MagnitudeKernel(
+    const NumericType* PHQ_RESTRICT x, const NumericType* PHQ_RESTRICT y,
+    const NumericType* PHQ_RESTRICT z, NumericType* PHQ_RESTRICT output,
+    const std::size_t size) noexcept {
+  for (std::size_t index = 0; index < size; ++index) {
+    output[index] = std::sqrt(x[index] * x[index] + y[index] * y[index] + z[index] * z[index]);
+  }
+}
+
+/// \brief Computes the dot products of a given number of pairs of three-dimensional vectors stored
+/// as component arrays. The output must not overlap the inputs. Internal implementation detail not
+/// intended to be used outside of the PhQ::VectorField class.
+template <typename NumericType>
+PHQ_ALWAYS_INLINE inline void DotKernel(
+    const NumericType* PHQ_RESTRICT x, const NumericType* PHQ_RESTRICT y,
+    const NumericType* PHQ_RESTRICT z, const NumericType* PHQ_RESTRICT other_x,
+    const NumericType* PHQ_RESTRICT other_y, const NumericType* PHQ_RESTRICT other_z,
+    NumericType* PHQ_RESTRICT output, const std::size_t size) noexcept {
+  for (std::size_t index = 0; index < size; ++index) {
+    output[index] =
+        x[index] * other_x[index] + y[index] * other_y[index] + z[index] * other_z[index];
+  }
+}
+
+/// \brief Computes the dot products of a given number of three-dimensional vectors stored as
+/// component arrays and a given vector. The output must not overlap the inputs. Internal
+/// implementation detail not intended to be used outside of the PhQ::VectorField class.
+template <typename NumericType>
+PHQ_ALWAYS_INLINE inline void DotKernel(
+    const NumericType* PHQ_RESTRICT x, const NumericType* PHQ_RESTRICT y,
+    const NumericType* PHQ_RESTRICT z, const NumericType vector_x, const NumericType vector_y,
+    const NumericType vector_z, NumericType* PHQ_RESTRICT output, const std::size_t size) noexcept {
+  for (std::size_t index = 0; index < size; ++index) {
+    output[index] = x[index] * vector_x + y[index] * vector_y + z[index] * vector_z;
+  }
+}
+
+/// \brief Computes the cross products of a given number of pairs of three-dimensional vectors
+/// stored as component arrays. The outputs must not overlap the inputs. Internal implementation
+/// detail not intended to be used outside of the PhQ::VectorField class.
+template <typename NumericType>
+PHQ_ALWAYS_INLINE inline void CrossKernel(
+    const NumericType* PHQ_RESTRICT x, const NumericType* PHQ_RESTRICT y,
+    const NumericType* PHQ_RESTRICT z, const NumericType* PHQ_RESTRICT other_x,
+    const NumericType* PHQ_RESTRICT other_y, const NumericType* PHQ_RESTRICT other_z,
+    NumericType* PHQ_RESTRICT result_x, NumericType* PHQ_RESTRICT result_y,
+    NumericType* PHQ_RESTRICT result_z, const std::size_t size) noexcept {
+  for (std::size_t index = 0; index < size; ++index) {
+    result_x[index] = y[index] * other_z[index] - z[index] * other_y[index];
+    result_y[index] = z[index] * other_x[index] - x[index] * other_z[index];
+    result_z[index] = x[index] * other_y[index] - y[index] * other_x[index];
+  }
+}
+
+/// \brief Computes the cross products of a given number of three-dimensional vectors stored as
+/// component arrays and a given vector. The outputs must not overlap the inputs. Internal
+/// implementation detail not intended to be used outside of the PhQ::VectorField class.
+template <typename NumericType>
+PHQ_ALWAYS_INLINE inline void CrossKernel(
+    const NumericType* PHQ_RESTRICT x, const NumericType* PHQ_RESTRICT y,
+    const NumericType* PHQ_RESTRICT z, const NumericType vector_x, const NumericType vector_y,
+    const NumericType vector_z, NumericType* PHQ_RESTRICT result_x,
+    NumericType* PHQ_RESTRICT result_y, NumericType* PHQ_RESTRICT result_z,
+    const std::size_t size) noexcept {
+  for (std::size_t index = 0; index < size; ++index) {
+    result_x[index] = y[index] * vector_z - z[index] * vector_y;
+    result_y[index] = z[index] * vector_x - x[index] * vector_z;
+    result_z[index] = x[index] * vector_y - y[index] * vector_x;
+  }
+}
+
+/// \brief Computes the directions of a given number of three-dimensional vectors stored as
+/// component arrays. The direction of a vector of zero is zero. The outputs must not overlap the
+/// inputs. Internal implementation detail not intended to be used outside of the PhQ::VectorField
+/// class.
+template <typename NumericType>
+PHQ_ALWAYS_INLINE inline void DirectionKernel(
+    const NumericType* PHQ_RESTRICT x, const NumericType* PHQ_RESTRICT y,
+    const NumericType* PHQ_RESTRICT z, NumericType* PHQ_RESTRICT result_x,
+    NumericType* PHQ_RESTRICT result_y, NumericType* PHQ_RESTRICT result_z,
+    const std::size_t size) noexcept {
+  for (std::size_t index = 0; index < size; ++index) {
+    const NumericType magnitude{
+        std::sqrt(x[index] * x[index] + y[index] * y[index] + z[index] * z[index])};
+    const NumericType inverse{magnitude > static_cast<NumericType>(0) ?
+                                  static_cast<NumericType>(1) / magnitude :
+                                  static_cast<NumericType>(0)};
+    result_x[index] = x[index] * inverse;
+    result_y[index] = y[index] * inverse;
+    result_z[index] = z[index] * inverse;
+  }
+}
+
+}  // namespace Internal
+
+/// \brief Field of three-dimensional vectors stored as a structure of arrays: the x, y, and z
+/// Cartesian components of all elements are stored in three separate contiguous arrays aligned to
+/// cache lines, expressed in the standard unit of measure. Compared to a std::vector of physical
+/// quantities, which interleaves the components of each element, this layout lets field-wide
+/// operations such as magnitudes, dot products, cross products, directions, and scaled sums
+/// process consecutive elements with full-width SIMD instructions. Individual elements are accessed
+/// through a proxy that behaves like the physical quantity.
+/// \tparam Quantity Type of the elements: a physical quantity derived from PhQ::DimensionalVector,
+/// such as PhQ::Velocity<double>, or PhQ::Vector or PhQ::Direction.
+template <typename Quantity>
+class VectorField {
+  using Element = Internal::VectorFieldElement<Quantity>;
+
+public:
+  /// \brief Floating-point numeric type of the components of this field.
+  using NumericType = typename Element::NumericType;
+
+  /// \brief Type of the magnitude of an element of this field, such as PhQ::Speed<double> for a
+  /// field of PhQ::Velocity<double>.
+  using MagnitudeType = decltype(std::declval<const Quantity&>().Magnitude());
+
+  /// \brief Proxy to an element of a mutable field. It converts to the physical quantity and can be
+  /// assigned from one, and it offers the element-wise methods of the physical quantity.
+  class Reference {
+  public:
+    /// \brief Returns the element as a physical quantity.
+    operator Quantity() const {
+      return Element::Make(field_->x_[index_], field_->y_[index_], field_->z_[index_]);
+    }
+
+    /// \brief Assigns a given physical quantity to the element.
+    Reference& operator=(const Quantity& quantity) noexcept {
+      const Vector<NumericType>& value{Element::Value(quantity)};
+      field_->x_[index_] = value.x();
+      field_->y_[index_] = value.y();
+      field_->z_[index_] = value.z();
+      return *this;
+    }
+
+    /// \brief Assigns the element referenced by another proxy to the element.
+    Reference& operator=(const Reference& other) noexcept {
+      return *this = static_cast<Quantity>(other);
+    }
+
+    /// \brief Returns the value of the element expressed in the standard unit of measure.
+    [[nodiscard]] Vector<NumericType> Value() const noexcept {
+      return Vector<NumericType>{field_->x_[index_], field_->y_[index_], field_->z_[index_]};
+    }
+
+    /// \brief Returns the magnitude of the element.
+    [[nodiscard]] MagnitudeType Magnitude() const {
+      return static_cast<Quantity>(*this).Magnitude();
+    }
+
+    /// \brief Returns the direction of the element.
+    [[nodiscard]] PhQ::Direction<NumericType> Direction() const {
+      return Value().Direction();
+    }
+
+    Reference& operator+=(const Quantity& quantity) noexcept {
+      const Vector<NumericType>& value{Element::Value(quantity)};
+      field_->x_[index_] += value.x();
+      field_->y_[index_] += value.y();
+      field_->z_[index_] += value.z();
+      return *this;
+    }
+
+    Reference& operator-=(const Quantity& quantity) noexcept {
+      const Vector<NumericType>& value{Element::Value(quantity)};
+      field_->x_[index_] -= value.x();
+      field_->y_[index_] -= value.y();
+      field_->z_[index_] -= value.z();
+      return *this;
+    }
+
+    Reference& operator*=(const NumericType number) noexcept {
+      field_->x_[index_] *= number;
+      field_->y_[index_] *= number;
+      field_->z_[index_] *= number;
+      return *this;
+    }
+
+    Reference& operator/=(const NumericType number) noexcept {
+      field_->x_[index_] /= number;
+      field_->y_[index_] /= number;
+      field_->z_[index_] /= number;
+      return *this;
+    }
+
+    friend bool operator==(const Reference& left, const Quantity& right) noexcept {
+      return left.Value() == Element::Value(right);
+    }
+
+    friend bool operator==(const Quantity& left, const Reference& right) noexcept {
+      return Element::Value(left) == right.Value();
+    }
+
+    friend bool operator!=(const Reference& left, const Quantity& right) noexcept {
+      return left.Value() != Element::Value(right);
+    }
+
+    friend bool operator!=(const Quantity& left, const Reference& right) noexcept {
+      return Element::Value(left) != right.Value();
+    }
+
+  private:
+    Reference(VectorField* const field, const std::size_t index) noexcept
+      : field_(field), index_(index) {}
+
+    VectorField* field_;
+
+    std::size_t index_;
+
+    friend class VectorField;
+  };
+
+  /// \brief Default constructor. Constructs an empty field.
+  VectorField() = default;
+
+  /// \brief Constructor. Constructs a field of a given number of elements of zero.
+  explicit VectorField(const std::size_t size) : x_(size), y_(size), z_(size) {}
+
+  /// \brief Constructor. Constructs a field of a given number of copies of a given element.
+  VectorField(const std::size_t size, const Quantity& quantity)
+    : x_(size, Element::Value(quantity).x()), y_(size, Element::Value(quantity).y()),
+      z_(size, Element::Value(quantity).z()) {}
+
+  /// \brief Constructor. Constructs a field from a contiguous sequence of a given number of
+  /// elements.
+  VectorField(const Quantity* const quantities, const std::size_t size)
+    : x_(size), y_(size), z_(size) {
+    for (std::size_t index = 0; index < size; ++index) {
+      const Vector<NumericType>& value{Element::Value(quantities[index])};
+      x_[index] = value.x();
+      y_[index] = value.y();
+      z_[index] = value.z();
+    }
+  }
+
+  /// \brief Constructor. Constructs a field from a std::vector of elements.
+  explicit VectorField(const std::vector<Quantity>& quantities)
+    : VectorField(quantities.data(), quantities.size()) {}
+
+  /// \brief Returns the number of elements of this field.
+  [[nodiscard]] std::size_t Size() const noexcept {
+    return x_.size();
+  }
+
+  /// \brief Returns whether this field has no elements.
+  [[nodiscard]] bool Empty() const noexcept {
+    return x_.empty();
+  }
+
+  /// \brief Resizes this field to a given number of elements. New elements are zero.
+  void Resize(const std::size_t size) {
+    x_.resize(size);
+    y_.resize(size);
+    z_.resize(size);
+  }
+
+  /// \brief Reserves storage for a given number of elements.
+  void Reserve(const std::size_t size) {
+    x_.reserve(size);
+    y_.reserve(size);
+    z_.reserve(size);
+  }
+
+  /// \brief Removes all elements of this field.
+  void Clear() noexcept {
+    x_.clear();
+    y_.clear();
+    z_.clear();
+  }
+
+  /// \brief Appends a given element to the end of this field.
+  void PushBack(const Quantity& quantity) {
+    const Vector<NumericType>& value{Element::Value(quantity)};
+    x_.push_back(value.x());
+    y_.push_back(value.y());
+    z_.push_back(value.z());
+  }
+
+  /// \brief Returns a pointer to the contiguous x Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure.
+  [[nodiscard]] const NumericType* x() const noexcept {
+    return x_.data();
+  }
+
+  /// \brief Returns a pointer to the contiguous x Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure, as mutable values.
+  [[nodiscard]] NumericType* x() noexcept {
+    return x_.data();
+  }
+
+  /// \brief Returns a pointer to the contiguous y Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure.
+  [[nodiscard]] const NumericType* y() const noexcept {
+    return y_.data();
+  }
+
+  /// \brief Returns a pointer to the contiguous y Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure, as mutable values.
+  [[nodiscard]] NumericType* y() noexcept {
+    return y_.data();
+  }
+
+  /// \brief Returns a pointer to the contiguous z Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure.
+  [[nodiscard]] const NumericType* z() const noexcept {
+    return z_.data();
+  }
+
+  /// \brief Returns a pointer to the contiguous z Cartesian components of the elements of this
+  /// field, expressed in the standard unit of measure, as mutable values.
+  [[nodiscard]] NumericType* z() noexcept {
+    return z_.data();
+  }
+
+  /// \brief Returns the element at a given index. The index must be less than Size().
+  [[nodiscard]] Quantity operator[](const std::size_t index) const {
+    return Element::Make(x_[index], y_[index], z_[index]);
+  }
+
+  /// \brief Returns a proxy to the element at a given index. The index must be less than Size().
+  [[nodiscard]] Reference operator[](const std::size_t index) noexcept {
+    return Reference{this, index};
+  }
+
+  /// \brief Returns the elements of this field as a std::vector of elements.
+  [[nodiscard]] std::vector<Quantity> Quantities() const {
+    std::vector<Quantity> quantities;
+    quantities.reserve(Size());
+    for (std::size_t index = 0; index < Size(); ++index) {
+      quantities.push_back(Element::Make(x_[index], y_[index], z_[index]));
+    }
+    return quantities;
+  }
+
+  /// \brief Computes the magnitudes of the elements of this field into a caller-provided
+  /// contiguous sequence of Size() magnitudes.
+  void Magnitude(MagnitudeType* const magnitudes) const noexcept {
+    NumericType* const output{
+        Internal::ScalarComponents<MagnitudeType, NumericType>(magnitudes)};
+    const NumericType* const x{x_.data()};
+    const NumericType* const y{y_.data()};
+    const NumericType* const z{z_.data()};
+    const std::size_t size{Size()};
+    Internal::RunKernel(
+        [=]() PHQ_ALWAYS_INLINE { Internal::MagnitudeKernel(x, y, z, output, size); }, size);
+  }
+
+  /// \brief Returns the magnitudes of the elements of this field.
+  [[nodiscard]] std::vector<MagnitudeType> Magnitude() const {
+    std::vector<MagnitudeType> magnitudes(Size());
+    Magnitude(magnitudes.data());
+    return magnitudes;
+  }
+
+  /// \brief Computes the dot products of the elements of this field and the corresponding elements
+  /// of another field of the same size into a caller-provided contiguous sequence of Size() values.
+  /// The dot products are expressed in the product of the standard units of measure of both fields.
+  template <typename OtherQuantity>
+  void Dot(const VectorField<OtherQuantity>& other, NumericType* const output) const noexcept {
+    static_assert(std::is_same_v<NumericType, typename VectorField<OtherQuantity>::NumericType>,
+                  "Both fields must have the same numeric type.");
+    const NumericType* const x{x_.data()};
+    const NumericType* const y{y_.data()};
+    const NumericType* const z{z_.data()};
+    const NumericType* const other_x{other.x()};
+    const NumericType* const other_y{other.y()};
+    const NumericType* const other_z{other.z()};
+    const std::size_t size{Size()};
+    Internal::RunKernel(
+        [=]() PHQ_ALWAYS_INLINE {
+          Internal::DotKernel(x, y, z, other_x, other_y, other_z, output, size);
+        },
+        size);
+  }
+
+  /// \brief Returns the dot products of the elements of this field and the corresponding elements
+  /// of another field of the same size, expressed in the product of the standard units of measure
+  /// of both fields.
+  template <typename OtherQuantity>
+  [[nodiscard]] std::vector<NumericType> Dot(const VectorField<OtherQuantity>& other) const {
+    std::vector<NumericType> output(Size());
+    Dot(other, output.data());
+    return output;
+  }
+
+  /// \brief Computes the dot products of the elements of this field and a given vector into a
+  /// caller-provided contiguous sequence of Size() values.
+  void Dot(const Vector<NumericType>& vector, NumericType* const output) const noexcept {
+    const NumericType* const x{x_.data()};
+    const NumericType* const y{y_.data()};
+    const NumericType* const z{z_.data()};
+    const NumericType vector_x{vector.x()};
+    const NumericType vector_y{vector.y()};
+    const NumericType vector_z{vector.z()};
+    const std::size_t size{Size()};
+    Internal::RunKernel(
+        [=]() PHQ_ALWAYS_INLINE {
+          Internal::DotKernel(x, y, z, vector_x, vector_y, vector_z, output, size);
+        },
+        size);
+  }
+
+  /// \brief Returns the dot products of the elements of this field and a given vector.
+  [[nodiscard]] std::vector<NumericType> Dot(const Vector<NumericType>& vector) const {
+    std::vector<NumericType> output(Size());
+    Dot(vector, output.data());
+    return output;
+  }
+
+  /// \brief Returns the dot products of the elements of this field and a given direction, which are
+  /// the components of the elements along that direction.
+  [[nodiscard]] std::vector<NumericType> Dot(
+      const PhQ::Direction<NumericType>& direction) const {
+    return Dot(direction.Value());
+  }
+
+  /// \brief Returns the cross products of the elements of this field and the corresponding elements
+  /// of another field of the same size, expressed in the product of the standard units of measure
+  /// of both fields.
+  template <typename OtherQuantity>
+  [[nodiscard]] VectorField<Vector<NumericType>> Cross(
+      const VectorField<OtherQuantity>& other) const {
+    static_assert(std::is_same_v<NumericType, typename VectorField<OtherQuantity>::NumericType>,
+                  "Both fields must have the same numeric type.");
+    const std::size_t size{Size()};
+    VectorField<Vector<NumericType>> result(size);
+    const NumericType* const x{x_.data()};
+    const NumericType* const y{y_.data()};
+    const NumericType* const z{z_.data()};
+    const NumericType* const other_x{other.x()};
+    const NumericType* const other_y{other.y()};
+    const NumericType* const other_z{other.z()};
+    NumericType* const result_x{result.x()};
+    NumericType* const result_y{result.y()};
+    NumericType* const result_z{result.z()};
+    Internal::RunKernel(
+        [=]() PHQ_ALWAYS_INLINE {
+          Internal::CrossKernel(
+              x, y, z, other_x, other_y, other_z, result_x, result_y, result_z, size);
+        },
+        size);
+    return result;
+  }
+
+  /// \brief Returns the cross products of the elements of this field and a given vector.
+  [[nodiscard]] VectorField<Vector<NumericType>> Cross(const Vector<NumericType>& vector) const {
+    const std::size_t size{Size()};
+    VectorField<Vector<NumericType>> result(size);
+    const NumericType* const x{x_.data()};
+    const NumericType* const y{y_.data()};
+    const NumericType* const z{z_.data()};
+    const NumericType vector_x{vector.x()};
+    const NumericType vector_y{vector.y()};
+    const NumericType vector_z{vector.z()};
+    NumericType* const result_x{result.x()};
+    NumericType* const result_y{result.y()};
+    NumericType* const result_z{result.z()};
+    Internal::RunKernel(
+        [=]() PHQ_ALWAYS_INLINE {
+          Internal::CrossKernel(
+              x, y, z, vector_x, vector_y, vector_z, result_x, result_y, result_z, size);
+        },
+        size);
+    return result;
+  }
+
+  /// \brief Returns the directions of the elements of this field. The direction of an element of
+  /// zero is zero, as for PhQ::Direction.
+  [[nodiscard]] VectorField<PhQ::Direction<NumericType>> Direction() const {
+    const std::size_t size{Size()};
+    VectorField<PhQ::Direction<NumericType>> result(size);
+    const NumericType* const x{x_.data()};
+    const NumericType* const y{y_.data()};
+    const NumericType* const z{z_.data()};
+    NumericType* const result_x{result.x()};
+    NumericType* const result_y{result.y()};
+    NumericType* const result_z{result.z()};
+    Internal::RunKernel(
+        [=]() PHQ_ALWAYS_INLINE {
+          Internal::DirectionKernel(x, y, z, result_x, result_y, result_z, size);
+        },
+        size);
+    return result;
+  }
+
+  /// \brief Adds the elements of another field of the same size, multiplied by a given number, to
+  /// the elements of this field in place.
+  void AddScaled(const NumericType number, const VectorField<Quantity>& other) noexcept {
+    AddScaled(x_.data(), number, other.x());
+    AddScaled(y_.data(), number, other.y());
+    AddScaled(z_.data(), number, other.z());
+  }
+
+  VectorField<Quantity> operator+(const VectorField<Quantity>& other) const {
+    VectorField<Quantity> result{*this};
+    result += other;
+    return result;
+  }
+
+  VectorField<Quantity> operator-(const VectorField<Quantity>& other) const {
+    VectorField<Quantity> result{*this};
+    result -= other;
+    return result;
+  }
+
+  VectorField<Quantity> operator*(const NumericType number) const {
+    VectorField<Quantity> result{*this};
+    result *= number;
+    return result;
+  }
+
+  VectorField<Quantity> operator/(const NumericType number) const {
+    VectorField<Quantity> result{*this};
+    result /= number;
+    return result;
+  }
+
+  void operator+=(const VectorField<Quantity>& other) noexcept {
+    AddScaled(static_cast<NumericType>(1), other);
+  }
+
+  void operator-=(const VectorField<Quantity>& other) noexcept {
+    AddScaled(static_cast<NumericType>(-1), other);
+  }
+
+  void operator*=(const NumericType number) noexcept {
+    Scale(x_.data(), number);
+    Scale(y_.data(), number);
+    Scale(z_.data(), number);
+  }
+
+  void operator/=(const NumericType number) noexcept {
+    *this *= static_cast<NumericType>(1) / number;
+  }
+
+  bool operator==(const VectorField<Quantity>& other) const noexcept {
+    return x_ == other.x_ && y_ == other.y_ && z_ == other.z_;
+  }
+
+  bool operator!=(const VectorField<Quantity>& other) const noexcept {
+    return !(*this == other);
+  }
+
+private:
+  // Adds a component array of another field, multiplied by a given number, to a component array of
+  // this field.
+  void AddScaled(NumericType* const values, const NumericType number,
+                 const NumericType* const other_values) noexcept {
+    const std::size_t size{Size()};
+    Internal::RunKernel(
+        [=]() PHQ_ALWAYS_INLINE {
+          Internal::AddScaledKernel(values, number, other_values, size);
+        },
+        size);
+  }
+
+  // Multiplies a component array of this field by a given number.
+  void Scale(NumericType* const values, const NumericType number) noexcept {
+    const std::size_t size{Size()};
+    Internal::RunKernel(
+        [=]() PHQ_ALWAYS_INLINE { Internal::ScaleKernel(values, number, size); }, size);
+  }
+
+  Internal::AlignedVector<NumericType> x_;
+
+  Internal::AlignedVector<NumericType> y_;
+
+  Internal::AlignedVector<NumericType> z_;
+};
+
+template <typename Quantity>
+inline VectorField<Quantity> operator*(
+    const typename VectorField<Quantity>::NumericType number, const VectorField<Quantity>& field) {
+  return field * number;
+}
+
+}  // namespace PhQ
+
+#endif  // PHQ_VECTOR_FIELD_HPP
@@ -0,0 +1,348 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#ifndef PHQ_WRITER_HPP
+#define PHQ_WRITER_HPP
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#if __has_include(<unistd.h>)
+  #include <cerrno>
+  #include <unistd.h>
+#endif
+
+#include "Base.hpp"
+#include "ConversionPlan.hpp"
+#include "QuantityTraits.hpp"
+
+namespace PhQ {
+
+/// \brief Output formats of PhQ::Writer.
+enum class WriterFormat : int8_t {
+  /// \brief A single JSON array whose elements are the JSON messages of the physical quantities, in
+  /// the format produced by their JSON member method, such as
+  /// [{"value":{"x":1,"y":2,"z":3},"unit":"m/s"},...].
+  JSONArray,
+
+  /// \brief Newline-delimited JSON: one JSON message per physical quantity per line, in the format
+  /// produced by their JSON member method.
+  NDJSON,
+
+  /// \brief Comma-separated values: a header line that names each component and its unit of
+  /// measure, such as "x [m/s],y [m/s],z [m/s]", followed by one line of components per physical
+  /// quantity.
+  CSV,
+};
+
+/// \brief Streams sequences of physical quantities of a given type to a std::ostream or a POSIX
+/// file descriptor as a JSON array, as newline-delimited JSON, or as comma-separated values. The
+/// physical quantities are printed directly into a fixed-size output buffer that is written to its
+/// destination in large blocks whenever it fills, so no memory is allocated per physical quantity.
+/// The physical quantities are expressed either in their standard unit of measure or in a given
+/// unit of measure, in which case the conversion is resolved once and applied while printing. The
+/// output is completed when the writer is closed, either explicitly or by its destructor. Writing
+/// stops at the first failed write to the destination, after which Good() returns false.
+/// \tparam Quantity Type of the physical quantities, such as PhQ::Velocity<double>. This must be
+/// derived from PhQ::DimensionalScalar, PhQ::DimensionalPlanarVector, PhQ::DimensionalVector,
+/// PhQ::DimensionalSymmetricDyad, or PhQ::DimensionalDyad.
+template <typename Quantity>
+class Writer {
+  using Traits = Internal::QuantityTraitsOf<Quantity>;
+
+  using NumericType = typename Traits::NumericType;
+
+  static constexpr std::size_t ComponentCount{Traits::ComponentCount};
+
+public:
+  /// \brief Unit of measure type of the physical quantities.
+  using UnitType = typename Traits::UnitType;
+
+  /// \brief Default size in bytes of the output buffer of a writer.
+  static constexpr std::size_t DefaultBufferSize{1 << 16};
+
+  /// \brief Constructor. Constructs a writer to a given output stream in a given format. The
+  /// physical quantities are expressed in their standard unit of measure. The given output stream
+  /// must outlive this writer.
+  Writer(std::ostream& stream, const WriterFormat format,
+         const std::size_t buffer_size = DefaultBufferSize)
+    : Writer(&stream, -1, format, Standard<UnitType>, buffer_size) {}
+
+  /// \brief Constructor. Constructs a writer to a given output stream in a given format. The
+  /// physical quantities are expressed in a given unit of measure. The given output stream must
+  /// outlive this writer.
+  Writer(std::ostream& stream, const WriterFormat format, const UnitType unit,
+         const std::size_t buffer_size = DefaultBufferSize)
+    : Writer(&stream, -1, format, unit, buffer_size) {}
+
+#if __has_include(<unistd.h>)
+
+  /// \brief Constructor. Constructs a writer to a given open POSIX file descriptor in a given
+  /// format. The physical quantities are expressed in their standard unit of measure. The file
+  /// descriptor is not closed by this writer.
+  Writer(const int file_descriptor, const WriterFormat format,
+         const std::size_t buffer_size = DefaultBufferSize)
+    : Writer(nullptr, file_descriptor, format, Standard<UnitType>, buffer_size) {}
+
+  /// \brief Constructor. Constructs a writer to a given open POSIX file descriptor in a given
+  /// format. The physical quantities are expressed in a given unit of measure. The file descriptor
+  /// is not closed by this writer.
+  Writer(const int file_descriptor, const WriterFormat format, const UnitType unit,
+         const std::size_t buffer_size = DefaultBufferSize)
+    : Writer(nullptr, file_descriptor, format, unit, buffer_size) {}
+
+#endif  // __has_include(<unistd.h>)
+
+  /// \brief Destructor. Closes this writer.
+  ~Writer() noexcept {
+    Close();
+  }
+
+  /// \brief Deleted copy constructor.
+  Writer(const Writer<Quantity>& other) = delete;
+
+  /// \brief Deleted move constructor.
+  Writer(Writer<Quantity>&& other) = delete;
+
+  /// \brief Deleted copy assignment operator.
+  Writer<Quantity>& operator=(const Writer<Quantity>& other) = delete;
+
+  /// \brief Deleted move assignment operator.
+  Writer<Quantity>& operator=(Writer<Quantity>&& other) = delete;
+
+  /// \brief Format of this writer.
+  [[nodiscard]] WriterFormat Format() const noexcept {
+    return format_;
+  }
+
+  /// \brief Number of physical quantities written so far by this writer.
+  [[nodiscard]] std::size_t Count() const noexcept {
+    return count_;
+  }
+
+  /// \brief Whether all writes to the destination of this writer have succeeded so far.
+  [[nodiscard]] bool Good() const noexcept {
+    return good_;
+  }
+
+  /// \brief Writes a given physical quantity.
+  void Write(const Quantity& quantity) {
+    if (closed_) {
+      return;
+    }
+    if (buffer_.size() - size_ < record_size_) {
+      Flush();
+    }
+    char* cursor{buffer_.data() + size_};
+    if (format_ == WriterFormat::JSONArray && count_ > 0) {
+      *cursor++ = ',';
+    }
+    std::array<NumericType, ComponentCount> components;
+    conversion_plan_.Apply(
+        Internal::ComponentsOf(quantity.Value()), components.data(), ComponentCount);
+    for (std::size_t index = 0; index < ComponentCount; ++index) {
+      cursor = Append(cursor, fragments_[index]);
+      cursor = Print(cursor, cursor + PrintBufferSize, components[index]).ptr;
+    }
+    cursor = Append(cursor, fragments_[ComponentCount]);
+    size_ = static_cast<std::size_t>(cursor - buffer_.data());
+    ++count_;
+  }
+
+  /// \brief Writes the physical quantities in the range [first, last).
+  template <typename Iterator>
+  void Write(Iterator first, const Iterator last) {
+    for (; first != last; ++first) {
+      Write(*first);
+    }
+  }
+
+  /// \brief Writes a given vector of physical quantities.
+  void Write(const std::vector<Quantity>& quantities) {
+    Write(quantities.cbegin(), quantities.cend());
+  }
+
+  /// \brief Writes the contents of the output buffer of this writer to its destination and empties
+  /// the output buffer.
+  void Flush() {
+    if (size_ > 0 && good_) {
+      good_ = WriteToDestination(buffer_.data(), size_);
+    }
+    size_ = 0;
+  }
+
+  /// \brief Completes the output of this writer, such as by closing its JSON array, and flushes
+  /// it. Further physical quantities are ignored. Closing an already closed writer has no effect.
+  void Close() noexcept {
+    if (closed_) {
+      return;
+    }
+    closed_ = true;
+    try {
+      if (format_ == WriterFormat::JSONArray) {
+        if (buffer_.size() - size_ < 2) {
+          Flush();
+        }
+        size_ = static_cast<std::size_t>(Append(buffer_.data() + size_, "]\n") - buffer_.data());
+      }
+      Flush();
+    } catch (...) {
+      good_ = false;
+    }
+  }
+
+private:
+  /// \brief Main constructor. Exactly one of the given output stream and the given file descriptor
+  /// is used: the output stream if it is not null, or the file descriptor otherwise.
+  Writer(std::ostream* const stream, const int file_descriptor, const WriterFormat format,
+         const UnitType unit, const std::size_t buffer_size)
+    : stream_(stream), file_descriptor_(file_descriptor), format_(format),
+      conversion_plan_(Standard<UnitType>, unit) {
+    const std::string_view abbreviation{Abbreviation(unit)};
+    const std::array<std::string_view, ComponentCount>& names{
+        Internal::ComponentNames<ComponentCount>};
+    std::string header;
+    if (format_ == WriterFormat::CSV) {
+      for (std::size_t index = 0; index < ComponentCount; ++index) {
+        if (index > 0) {
+          header.push_back(',');
+          fragments_[index] = ",";
+        }
+        header.append(names[index]).append(" [").append(abbreviation).append("]");
+      }
+      header.push_back('\n');
+      fragments_[ComponentCount] = "\n";
+    } else {
+      if (format_ == WriterFormat::JSONArray) {
+        header = "[";
+      }
+      if constexpr (ComponentCount == 1) {
+        fragments_[0] = "{\"value\":";
+        fragments_[1] = "";
+      } else {
+        fragments_[0] = "{\"value\":{";
+        fragments_[ComponentCount] = "}";
+        for (std::size_t index = 0; index < ComponentCount; ++index) {
+          if (index > 0) {
+            fragments_[index] = ",";
+          }
+          fragments_[index].append("\"").append(names[index]).append("\":");
+        }
+      }
+      fragments_[ComponentCount].append(R"(,"unit":")").append(abbreviation).append("\"}");
+      if (format_ == WriterFormat::NDJSON) {
+        fragments_[ComponentCount].push_back('\n');
+      }
+    }
+    record_size_ = 1;
+    for (const std::string& fragment : fragments_) {
+      record_size_ += fragment.size();
+    }
+    record_size_ += ComponentCount * PrintBufferSize;
+    // The output buffer must hold the header, any single record, and the closing bracket.
+    std::size_t minimum_size{record_size_ + 2};
+    if (minimum_size < header.size()) {
+      minimum_size = header.size();
+    }
+    buffer_.resize(buffer_size < minimum_size ? minimum_size : buffer_size);
+    size_ = static_cast<std::size_t>(Append(buffer_.data(), header) - buffer_.data());
+  }
+
+  /// \brief Copies the given characters to the given position and returns the position one past
+  /// the last copied character.
+  static char* Append(char* const cursor, const std::string_view characters) noexcept {
+    return std::copy(characters.cbegin(), characters.cend(), cursor);
+  }
+
+  /// \brief Writes a given number of characters to the destination of this writer. Returns whether
+  /// the write succeeded.
+  bool WriteToDestination(const char* data, std::size_t size) {
+    if (stream_ != nullptr) {
+      stream_->write(data, static_cast<std::streamsize>(size));
+      return static_cast<bool>(*stream_);
+    }
+#if __has_include(<unistd.h>)
+    while (size > 0) {
+      const ssize_t written{::write(file_descriptor_, data, size)};
+      if (written < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return false;
+      }
+      data += written;
+      size -= static_cast<std::size_t>(written);
+    }
+    return true;
+#else
+    return false;
+#endif  // __has_include(<unistd.h>)
+  }
+
+  /// \brief Output stream to which this writer writes, or null if it writes to a file descriptor.
+  std::ostream* stream_;
+
+  /// \brief POSIX file descriptor to which this writer writes if it does not write to an output
+  /// stream.
+  int file_descriptor_;
+
+  /// \brief Format of this writer.
+  WriterFormat format_;
+
+  /// \brief Conversion from the standard unit of measure to the unit of measure of this writer.
+  ConversionPlan<UnitType, NumericType> conversion_plan_;
+
+  /// \brief Characters written before each component of a physical quantity and, last, after its
+  /// final component.
+  std::array<std::string, ComponentCount + 1> fragments_;
+
+  /// \brief Upper bound on the number of characters written for one physical quantity.
+  std::size_t record_size_{0};
+
+  /// \brief Output buffer of this writer.
+  std::vector<char> buffer_;
+
+  /// \brief Number of characters in the output buffer of this writer.
+  std::size_t size_{0};
+
+  /// \brief Number of physical quantities written so far by this writer.
+  std::size_t count_{0};
+
+  /// \brief Whether all writes to the destination of this writer have succeeded so far.
+  bool good_{true};
+
+  /// \brief Whether this writer has been closed.
+  bool closed_{false};
+};
+
+}  // namespace PhQ
+
+#endif  // PHQ_WRITER_HPP
@@ -24,11 +24,17 @@
 
 #include "../include/PhQ/Base.hpp"
 
+#include <array>
+#include <charconv>
 #include <cmath>
+#include <cstddef>
 #include <gtest/gtest.h>
 #include <numbers>
 #include <optional>
 #include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
 #include <vector>
 
 namespace PhQ {
@@ -40,6 +46,60 @@ TEST(Base, Lowercase) {
   EXPECT_EQ(Lowercase("AbCd123!?^-_"), "abcd123!?^-_");
 }
 
+TEST(Base, ParseNumberConsumed) {
+  double number{-1.0};
+  ParseNumberResult result{ParseNumber("", number)};
+  EXPECT_EQ(result.consumed, 0);
+  EXPECT_EQ(result.error, std::errc::invalid_argument);
+  EXPECT_EQ(number, -1.0);
+  result = ParseNumber(" 1.5", number);
+  EXPECT_EQ(result.consumed, 0);
+  EXPECT_EQ(result.error, std::errc::invalid_argument);
+  EXPECT_EQ(number, -1.0);
+  result = ParseNumber("+-1.5", number);
+  EXPECT_EQ(result.consumed, 0);
+  EXPECT_EQ(result.error, std::errc::invalid_argument);
+  EXPECT_EQ(number, -1.0);
+  result = ParseNumber("+1.5", number);
+  EXPECT_EQ(result.consumed, 4);
+  EXPECT_EQ(result.error, std::errc{});
+  EXPECT_EQ(number, 1.5);
+  result = ParseNumber("1.0e1000000,2.0", number);
+  EXPECT_EQ(result.consumed, 11);
+  EXPECT_EQ(result.error, std::errc::result_out_of_range);
+  EXPECT_EQ(number, 1.5);
+  float single{0.0F};
+  result = ParseNumber("-2.25e2 m", single);
+  EXPECT_EQ(result.consumed, 7);
+  EXPECT_EQ(result.error, std::errc{});
+  EXPECT_EQ(single, -225.0F);
+  result = ParseNumber("0x1.8p3 m", number);
+  EXPECT_EQ(result.consumed, 7);
+  EXPECT_EQ(result.error, std::errc{});
+  EXPECT_EQ(number, 12.0);
+  result = ParseNumber("0xg", number);
+  EXPECT_EQ(result.consumed, 1);
+  EXPECT_EQ(result.error, std::errc{});
+  EXPECT_EQ(number, 0.0);
+
+  // Parse a comma-separated sequence of numbers.
+  std::string_view stream{"1.25,-4,8e-1,x"};
+  std::vector<double> numbers;
+  while (true) {
+    result = ParseNumber(stream, number);
+    if (result.error != std::errc{}) {
+      break;
+    }
+    numbers.push_back(number);
+    stream.remove_prefix(result.consumed);
+    if (!stream.empty() && stream.front() == ',') {
+      stream.remove_prefix(1);
+    }
+  }
+  EXPECT_EQ(numbers, std::vector<double>({1.25, -4.0, 0.8}));
+  EXPECT_EQ(stream, "x");
+}
+
 TEST(Base, ParseNumberDefault) {
   EXPECT_EQ(ParseNumber<>(""), std::nullopt);
   EXPECT_EQ(ParseNumber<>("Hello world!"), std::nullopt);
@@ -63,6 +123,14 @@ TEST(Base, ParseNumberDefault) {
   EXPECT_EQ(ParseNumber<>("100"), 100.0);
   EXPECT_EQ(ParseNumber<>("1.23456789e12"), 1.23456789e12);
   EXPECT_EQ(ParseNumber<>("1.0e1000000"), std::nullopt);
+  EXPECT_EQ(ParseNumber<>(" \t+2.5 m"), 2.5);
+  EXPECT_EQ(ParseNumber<>("0x10"), 16.0);
+  EXPECT_EQ(ParseNumber<>("-0X1A"), -26.0);
+  EXPECT_EQ(ParseNumber<>("+0x.8"), 0.5);
+  EXPECT_EQ(ParseNumber<>("0x1p-2"), 0.25);
+  EXPECT_EQ(ParseNumber<>("0x"), 0.0);
+  EXPECT_EQ(ParseNumber<>(std::string_view{"3.5"}), 3.5);
+  EXPECT_EQ(ParseNumber<>(std::string{"4.5"}), 4.5);
 }
 
 TEST(Base, ParseNumberDouble) {
@@ -88,6 +156,7 @@ TEST(Base, ParseNumberDouble) {
   EXPECT_EQ(ParseNumber<double>("100"), 100.0);
   EXPECT_EQ(ParseNumber<double>("1.23456789e12"), 1.23456789e12);
   EXPECT_EQ(ParseNumber<double>("1.0e1000000"), std::nullopt);
+  EXPECT_EQ(ParseNumber<double>("-0x10"), -16.0);
 }
 
 TEST(Base, ParseNumberFloat) {
@@ -113,6 +182,7 @@ TEST(Base, ParseNumberFloat) {
   EXPECT_EQ(ParseNumber<float>("100"), 100.0F);
   EXPECT_EQ(ParseNumber<float>("1.23456789e12"), 1.23456789e12F);
   EXPECT_EQ(ParseNumber<float>("1.0e1000000"), std::nullopt);
+  EXPECT_EQ(ParseNumber<float>("-0x10"), -16.0F);
 }
 
 TEST(Base, ParseNumberLongDouble) {
@@ -141,6 +211,33 @@ TEST(Base, ParseNumberLongDouble) {
   EXPECT_EQ(ParseNumber<long double>("100"), 100.0L);
   EXPECT_EQ(ParseNumber<long double>("1.23456789e12"), 1.23456789e12L);
   EXPECT_EQ(ParseNumber<long double>("1.0e1000000"), std::nullopt);
+  EXPECT_EQ(ParseNumber<long double>("-0x10"), -16.0L);
+}
+
+TEST(Base, PerfectHash) {
+  constexpr std::array<std::pair<std::string_view, int>, 6> table{{
+      {"",          0},
+      {"a",         1},
+      {"ab",        2},
+      {"abcdefg",   3},
+      {"abcdefgh",  4},
+      {"abcdefghi", 5},
+  }};
+  constexpr Internal::PerfectHash<6> hash{table};
+  static_assert(hash.Valid());
+  static_assert(hash.Candidate("abcdefgh") == 4);
+  for (std::size_t index = 0; index < table.size(); ++index) {
+    EXPECT_EQ(hash.Candidate(table[index].first), index);
+  }
+  for (const std::string_view key : {"b", "ba", "abcdefgi", "Hello world!"}) {
+    const std::size_t candidate{hash.Candidate(key)};
+    EXPECT_TRUE(candidate == table.size() || table[candidate].first != key);
+  }
+
+  constexpr std::array<std::pair<std::string_view, int>, 0> empty_table{};
+  constexpr Internal::PerfectHash<0> empty_hash{empty_table};
+  static_assert(empty_hash.Valid());
+  EXPECT_EQ(empty_hash.Candidate("a"), 0);
 }
 
 TEST(Base, Pi) {
@@ -150,6 +247,23 @@ TEST(Base, Pi) {
   EXPECT_EQ(Pi<long double>, 3.141592653589793238462643383279502884L);
 }
 
+TEST(Base, PrintBuffer) {
+  char buffer[PrintBufferSize];
+  std::to_chars_result result{Print(buffer, buffer + PrintBufferSize, -0.125)};
+  EXPECT_EQ(result.ec, std::errc{});
+  EXPECT_EQ(std::string(buffer, result.ptr), "-0.125000000000000000");
+  result = Print(buffer, buffer + PrintBufferSize, 0.0F);
+  EXPECT_EQ(result.ec, std::errc{});
+  EXPECT_EQ(std::string(buffer, result.ptr), "0");
+  result = Print(buffer, buffer + PrintBufferSize, 16384.0L);
+  EXPECT_EQ(result.ec, std::errc{});
+  EXPECT_EQ(std::string(buffer, result.ptr), Print(16384.0L));
+  result = Print(buffer, buffer + 4, 1024.0);
+  EXPECT_EQ(result.ec, std::errc::value_too_large);
+  result = Print(buffer, buffer, 0.0);
+  EXPECT_EQ(result.ec, std::errc::value_too_large);
+}
+
 TEST(Base, PrintDouble) {
   EXPECT_EQ(Print(-16384.0), "-1.63840000000000000e+04");
   EXPECT_EQ(Print(-1024.0), "-1024.00000000000000");
@@ -221,6 +335,21 @@ TEST(Base, PrintLongDouble) {
   EXPECT_GE(Print(16384.0L).size(), Print(16384.0).size());
 }
 
+TEST(Base, PrintShortest) {
+  char buffer[PrintBufferSize];
+  std::to_chars_result result{PrintShortest(buffer, buffer + PrintBufferSize, -0.125)};
+  EXPECT_EQ(result.ec, std::errc{});
+  EXPECT_EQ(std::string(buffer, result.ptr), "-0.125");
+  result = PrintShortest(buffer, buffer + PrintBufferSize, 0.1F);
+  EXPECT_EQ(result.ec, std::errc{});
+  EXPECT_EQ(std::string(buffer, result.ptr), "0.1");
+  result = PrintShortest(buffer, buffer + PrintBufferSize, 1.0e-20);
+  EXPECT_EQ(result.ec, std::errc{});
+  EXPECT_EQ(std::string(buffer, result.ptr), "1e-20");
+  result = PrintShortest(buffer, buffer + 2, 1024.0);
+  EXPECT_EQ(result.ec, std::errc::value_too_large);
+}
+
 TEST(Base, SnakeCase) {
   EXPECT_EQ(SnakeCase(""), "");
   EXPECT_EQ(SnakeCase("Ab Cd 123   !?^-_"), "ab_cd_123___!?^-_");
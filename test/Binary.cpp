@@ -0,0 +1,193 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/Binary.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstring>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "../include/PhQ/Force.hpp"
+#include "../include/PhQ/MassDensity.hpp"
+#include "../include/PhQ/PlanarVelocity.hpp"
+#include "../include/PhQ/Stress.hpp"
+#include "../include/PhQ/Temperature.hpp"
+#include "../include/PhQ/Velocity.hpp"
+
+namespace PhQ {
+
+namespace {
+
+const std::vector<Stress<>> stresses{
+    Stress<>({1.0, -2.0, 3.0, -4.0, 5.0, -6.0}, Unit::Pressure::Pascal),
+    Stress<>({0.125, 1000.0, -0.001, 2.5, -7.0, 8.0}, Unit::Pressure::Kilopascal),
+};
+
+TEST(Binary, DecodeIntoSequence) {
+  const std::vector<std::byte> message{EncodeBinary(stresses)};
+  std::array<Stress<>, 2> decoded{Stress<>::Zero(), Stress<>::Zero()};
+  EXPECT_EQ(DecodeBinary(message.data(), message.size(), decoded.data(), decoded.size()),
+            BinaryError::None);
+  EXPECT_EQ(decoded[0], stresses[0]);
+  EXPECT_EQ(decoded[1], stresses[1]);
+  EXPECT_EQ(DecodeBinary(message.data(), message.size(), decoded.data(), 1),
+            BinaryError::PayloadSizeMismatch);
+}
+
+TEST(Binary, ErrorComponentCountMismatch) {
+  const std::vector<std::byte> message{
+      EncodeBinary(std::vector{PlanarVelocity<>({1.0, 2.0}, Unit::Speed::MetrePerSecond)})};
+  std::vector<Velocity<>> decoded;
+  EXPECT_EQ(DecodeBinary(message, decoded), BinaryError::ComponentCountMismatch);
+  const std::vector<std::byte> empty_message{EncodeBinary(std::vector<PlanarVelocity<>>{})};
+  EXPECT_EQ(DecodeBinary(empty_message, decoded), BinaryError::ComponentCountMismatch);
+}
+
+TEST(Binary, ErrorDimensionsMismatch) {
+  const std::vector<std::byte> message{
+      EncodeBinary(std::vector{Force<>({1.0, 2.0, 3.0}, Unit::Force::Newton)})};
+  std::vector<Velocity<>> decoded;
+  EXPECT_EQ(DecodeBinary(message, decoded), BinaryError::DimensionsMismatch);
+  EXPECT_TRUE(decoded.empty());
+}
+
+TEST(Binary, ErrorNumericTypeMismatch) {
+  const std::vector<std::byte> message{EncodeBinary(
+      std::vector{Velocity<float>({1.0F, 2.0F, 3.0F}, Unit::Speed::MetrePerSecond)})};
+  std::vector<Velocity<double>> decoded;
+  EXPECT_EQ(DecodeBinary(message, decoded), BinaryError::NumericTypeMismatch);
+  const std::vector<std::byte> empty_message{EncodeBinary(std::vector<Velocity<float>>{})};
+  EXPECT_EQ(DecodeBinary(empty_message, decoded), BinaryError::NumericTypeMismatch);
+}
+
+TEST(Binary, ErrorTruncatedHeader) {
+  const std::vector<std::byte> message{EncodeBinary(stresses)};
+  std::vector<Stress<>> decoded;
+  EXPECT_EQ(DecodeBinary(message.data(), 0, decoded), BinaryError::TruncatedHeader);
+  EXPECT_EQ(DecodeBinary(message.data(), BinaryHeaderSize - 1, decoded),
+            BinaryError::TruncatedHeader);
+  EXPECT_EQ(DecodeBinary(message.data(), message.size() - 1, decoded),
+            BinaryError::PayloadSizeMismatch);
+}
+
+TEST(Binary, ErrorUnknownUnit) {
+  std::vector<std::byte> message{EncodeBinary(stresses)};
+  message[2] = std::byte{255};
+  std::vector<Stress<>> decoded;
+  EXPECT_EQ(DecodeBinary(message, decoded), BinaryError::UnknownUnit);
+}
+
+TEST(Binary, ErrorUnsupportedVersion) {
+  std::vector<std::byte> message{EncodeBinary(stresses)};
+  message[0] = std::byte{BinaryFormatVersion + 1};
+  std::vector<Stress<>> decoded;
+  EXPECT_EQ(DecodeBinary(message, decoded), BinaryError::UnsupportedVersion);
+}
+
+TEST(Binary, Header) {
+  const std::vector<std::byte> message{EncodeBinary(
+      std::vector{Velocity<>({1.0, 2.0, 3.0}, Unit::Speed::MetrePerSecond)},
+      Unit::Speed::KilometrePerHour)};
+  ASSERT_EQ(message.size(), BinaryHeaderSize + 3 * sizeof(double));
+  EXPECT_EQ(message[0], std::byte{BinaryFormatVersion});
+  EXPECT_EQ(message[1], std::byte{0x33});
+  EXPECT_EQ(message[2], std::byte{static_cast<unsigned char>(Unit::Speed::KilometrePerHour)});
+  EXPECT_EQ(message[3], std::byte{0x1F});
+  EXPECT_EQ(message[4], std::byte{0x00});
+  EXPECT_EQ(message[5], std::byte{0x00});
+  EXPECT_EQ(message[6], std::byte{0x00});
+
+  const BinaryHeader header{BinaryHeader::Read(message.data())};
+  EXPECT_EQ(header.version, BinaryFormatVersion);
+  EXPECT_EQ(header.numeric_size, sizeof(double));
+  EXPECT_EQ(header.component_count, 3);
+  EXPECT_EQ(header.unit, static_cast<std::uint8_t>(Unit::Speed::KilometrePerHour));
+  EXPECT_EQ(header.dimensions, RelatedDimensions<Unit::Speed>);
+}
+
+TEST(Binary, HeaderWriteAndRead) {
+  const BinaryHeader header{
+      BinaryFormatVersion, sizeof(long double), 1, 7, RelatedDimensions<Unit::MassDensity>};
+  std::array<std::byte, BinaryHeaderSize> bytes;
+  header.Write(bytes.data());
+  const BinaryHeader read{BinaryHeader::Read(bytes.data())};
+  EXPECT_EQ(read.version, header.version);
+  EXPECT_EQ(read.numeric_size, header.numeric_size);
+  EXPECT_EQ(read.component_count, header.component_count);
+  EXPECT_EQ(read.unit, header.unit);
+  EXPECT_EQ(read.dimensions, RelatedDimensions<Unit::MassDensity>);
+}
+
+TEST(Binary, Payload) {
+  const std::vector<std::byte> message{EncodeBinary(stresses)};
+  ASSERT_EQ(message.size(), BinarySize<Stress<>>(2));
+  std::array<double, 12> components;
+  std::memcpy(components.data(), message.data() + BinaryHeaderSize, sizeof(components));
+  if constexpr (Internal::IsLittleEndian) {
+    EXPECT_EQ(components[0], stresses[0].Value().xx());
+    EXPECT_EQ(components[5], stresses[0].Value().zz());
+    EXPECT_EQ(components[6], stresses[1].Value().xx());
+    EXPECT_EQ(components[11], stresses[1].Value().zz());
+  }
+}
+
+TEST(Binary, RoundTrip) {
+  const std::vector<std::byte> message{EncodeBinary(stresses)};
+  std::vector<Stress<>> decoded;
+  EXPECT_EQ(DecodeBinary(message, decoded), BinaryError::None);
+  EXPECT_EQ(decoded, stresses);
+
+  const std::vector<Velocity<float>> velocities{
+      Velocity<float>({1.0F, -2.0F, 3.0F}, Unit::Speed::MetrePerSecond)};
+  std::vector<Velocity<float>> decoded_velocities;
+  EXPECT_EQ(DecodeBinary(EncodeBinary(velocities), decoded_velocities), BinaryError::None);
+  EXPECT_EQ(decoded_velocities, velocities);
+
+  std::vector<Stress<>> empty{stresses};
+  EXPECT_EQ(DecodeBinary(EncodeBinary(std::vector<Stress<>>{}), empty), BinaryError::None);
+  EXPECT_TRUE(empty.empty());
+}
+
+TEST(Binary, RoundTripUnit) {
+  const std::vector<Temperature<>> temperatures{
+      Temperature<>(300.0, Unit::Temperature::Kelvin),
+      Temperature<>(-40.0, Unit::Temperature::Celsius)};
+  const std::vector<std::byte> message{EncodeBinary(temperatures, Unit::Temperature::Celsius)};
+  double component;
+  std::memcpy(&component, message.data() + BinaryHeaderSize, sizeof(double));
+  if constexpr (Internal::IsLittleEndian) {
+    EXPECT_EQ(component, temperatures[0].Value(Unit::Temperature::Celsius));
+  }
+  std::vector<Temperature<>> decoded;
+  EXPECT_EQ(DecodeBinary(message, decoded), BinaryError::None);
+  ASSERT_EQ(decoded.size(), 2);
+  EXPECT_DOUBLE_EQ(decoded[0].Value(), 300.0);
+  EXPECT_DOUBLE_EQ(decoded[1].Value(), 233.15);
+}
+
+}  // namespace
+
+}  // namespace PhQ
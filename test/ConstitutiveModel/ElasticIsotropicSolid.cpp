@@ -28,6 +28,7 @@
 #include <gtest/gtest.h>
 #include <memory>
 #include <sstream>
+#include <string>
 #include <utility>
 
 #include "../../include/PhQ/ConstitutiveModel.hpp"
@@ -196,6 +197,19 @@ TEST(ConstitutiveModelElasticIsotropicSolid, JSON) {
             "{\"type\":\"elastic_isotropic_solid\",\"shear_modulus\":"
                 + ShearModulus(4.0, Unit::Pressure::Pascal).JSON() + ",\"lame_first_modulus\":"
                 + LameFirstModulus(1.0, Unit::Pressure::Pascal).JSON() + "}");
+  const ConstitutiveModel::ElasticIsotropicSolid<float> concrete_model{
+      ShearModulus(4.0F, Unit::Pressure::Pascal), LameFirstModulus(1.0F, Unit::Pressure::Pascal)};
+  const ConstitutiveModel& base_model{concrete_model};
+  std::string string{"prefix:"};
+  base_model.AppendJSON(string);
+  EXPECT_EQ(string,
+            R"(prefix:{"type":"elastic_isotropic_solid","shear_modulus":{"value":4.000000000,)"
+            R"("unit":"Pa"},"lame_first_modulus":{"value":1.000000000,"unit":"Pa"}})");
+  char buffer[256];
+  char* const end{concrete_model.WriteJSON(buffer)};
+  EXPECT_EQ(std::string(buffer, end),
+            R"({"type":"elastic_isotropic_solid","shear_modulus":{"value":4.000000000,)"
+            R"("unit":"Pa"},"lame_first_modulus":{"value":1.000000000,"unit":"Pa"}})");
 }
 
 TEST(ConstitutiveModelElasticIsotropicSolid, MoveAssignmentOperator) {
@@ -322,6 +336,21 @@ TEST(ConstitutiveModelElasticIsotropicSolid, XML) {
       "<type>elastic_isotropic_solid</type><shear_modulus>"
           + ShearModulus(4.0, Unit::Pressure::Pascal).XML() + "</shear_modulus><lame_first_modulus>"
           + LameFirstModulus(1.0, Unit::Pressure::Pascal).XML() + "</lame_first_modulus>");
+  const ConstitutiveModel::ElasticIsotropicSolid<float> concrete_model{
+      ShearModulus(4.0F, Unit::Pressure::Pascal), LameFirstModulus(1.0F, Unit::Pressure::Pascal)};
+  const ConstitutiveModel& base_model{concrete_model};
+  std::string string{"prefix:"};
+  base_model.AppendXML(string);
+  EXPECT_EQ(string,
+            R"(prefix:<type>elastic_isotropic_solid</type><shear_modulus><value>4.000000000)"
+            R"(</value><unit>Pa</unit></shear_modulus><lame_first_modulus><value>1.000000000)"
+            R"(</value><unit>Pa</unit></lame_first_modulus>)");
+  char buffer[256];
+  char* const end{concrete_model.WriteXML(buffer)};
+  EXPECT_EQ(std::string(buffer, end),
+            R"(<type>elastic_isotropic_solid</type><shear_modulus><value>4.000000000</value>)"
+            R"(<unit>Pa</unit></shear_modulus><lame_first_modulus><value>1.000000000</value>)"
+            R"(<unit>Pa</unit></lame_first_modulus>)");
 }
 
 TEST(ConstitutiveModelElasticIsotropicSolid, YAML) {
@@ -333,6 +362,19 @@ TEST(ConstitutiveModelElasticIsotropicSolid, YAML) {
             "{type:\"elastic_isotropic_solid\",shear_modulus:"
                 + ShearModulus(4.0, Unit::Pressure::Pascal).YAML() + ",lame_first_modulus:"
                 + LameFirstModulus(1.0, Unit::Pressure::Pascal).YAML() + "}");
+  const ConstitutiveModel::ElasticIsotropicSolid<float> concrete_model{
+      ShearModulus(4.0F, Unit::Pressure::Pascal), LameFirstModulus(1.0F, Unit::Pressure::Pascal)};
+  const ConstitutiveModel& base_model{concrete_model};
+  std::string string{"prefix:"};
+  base_model.AppendYAML(string);
+  EXPECT_EQ(string,
+            R"(prefix:{type:"elastic_isotropic_solid",shear_modulus:{value:4.000000000,)"
+            R"(unit:"Pa"},lame_first_modulus:{value:1.000000000,unit:"Pa"}})");
+  char buffer[128];
+  char* const end{concrete_model.WriteYAML(buffer)};
+  EXPECT_EQ(std::string(buffer, end),
+            R"({type:"elastic_isotropic_solid",shear_modulus:{value:4.000000000,unit:"Pa"},)"
+            R"(lame_first_modulus:{value:1.000000000,unit:"Pa"}})");
 }
 
 }  // namespace
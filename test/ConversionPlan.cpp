@@ -0,0 +1,217 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/ConversionPlan.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <vector>
+
+#if __cplusplus >= 202002L
+  #include <span>
+#endif
+
+#include "../include/PhQ/Dyad.hpp"
+#include "../include/PhQ/PlanarVector.hpp"
+#include "../include/PhQ/SymmetricDyad.hpp"
+#include "../include/PhQ/Unit/Length.hpp"
+#include "../include/PhQ/Unit/Temperature.hpp"
+#include "../include/PhQ/Vector.hpp"
+
+namespace PhQ {
+
+namespace {
+
+TEST(ConversionPlan, ApplyBuffer) {
+  const ConversionPlan<Unit::Length> plan{Unit::Length::Kilometre, Unit::Length::Metre};
+  std::vector<double> values{1.0, -2.0, 3.0};
+  plan.Apply(values.data(), values.size());
+  EXPECT_EQ(values, std::vector<double>({1000.0, -2000.0, 3000.0}));
+
+  const std::vector<double> input{1.0, -2.0, 3.0};
+  std::vector<double> output(input.size());
+  plan.Apply(input.data(), output.data(), input.size());
+  EXPECT_EQ(output, std::vector<double>({1000.0, -2000.0, 3000.0}));
+  EXPECT_EQ(input, std::vector<double>({1.0, -2.0, 3.0}));
+
+  const ConversionPlan<Unit::Length> identity{Unit::Length::Foot, Unit::Length::Foot};
+  identity.Apply(input.data(), output.data(), input.size());
+  EXPECT_EQ(output, input);
+}
+
+TEST(ConversionPlan, ApplyDyad) {
+  const ConversionPlan<Unit::Length> plan{Unit::Length::Kilometre, Unit::Length::Metre};
+  Dyad dyad{1.0, -2.0, 3.0, -4.0, 5.0, -6.0, 7.0, -8.0, 9.0};
+  plan.Apply(dyad);
+  EXPECT_EQ(dyad, Dyad(1000.0, -2000.0, 3000.0, -4000.0, 5000.0, -6000.0, 7000.0, -8000.0,
+                       9000.0));
+
+  std::vector<Dyad<>> dyads(3, Dyad(1.0, -2.0, 3.0, -4.0, 5.0, -6.0, 7.0, -8.0, 9.0));
+  plan.Apply(dyads);
+  EXPECT_EQ(dyads, std::vector<Dyad<>>(3, dyad));
+}
+
+TEST(ConversionPlan, ApplyPlanarVector) {
+  const ConversionPlan<Unit::Length> plan{Unit::Length::Kilometre, Unit::Length::Metre};
+  PlanarVector planar_vector{1.0, -2.0};
+  plan.Apply(planar_vector);
+  EXPECT_EQ(planar_vector, PlanarVector(1000.0, -2000.0));
+
+  std::vector<PlanarVector<>> planar_vectors(3, PlanarVector(1.0, -2.0));
+  plan.Apply(planar_vectors);
+  EXPECT_EQ(planar_vectors, std::vector<PlanarVector<>>(3, PlanarVector(1000.0, -2000.0)));
+}
+
+TEST(ConversionPlan, ApplyScalar) {
+  const ConversionPlan<Unit::Temperature> plan{
+      Unit::Temperature::Celsius, Unit::Temperature::Fahrenheit};
+  double value{100.0};
+  plan.Apply(value);
+  EXPECT_DOUBLE_EQ(value, 212.0);
+  EXPECT_DOUBLE_EQ(
+      value, Convert(100.0, Unit::Temperature::Celsius, Unit::Temperature::Fahrenheit));
+
+  const ConversionPlan<Unit::Temperature, float> single_precision_plan{
+      Unit::Temperature::Kelvin, Unit::Temperature::Celsius};
+  float single_precision_value{300.0F};
+  single_precision_plan.Apply(single_precision_value);
+  EXPECT_FLOAT_EQ(single_precision_value, 26.85F);
+}
+
+#if __cplusplus >= 202002L
+
+TEST(ConversionPlan, ApplySpan) {
+  const ConversionPlan<Unit::Length> plan{Unit::Length::Kilometre, Unit::Length::Metre};
+  std::vector<double> values{1.0, -2.0, 3.0};
+  plan.Apply(std::span<double>{values});
+  EXPECT_EQ(values, std::vector<double>({1000.0, -2000.0, 3000.0}));
+
+  const std::vector<double> input{1.0, -2.0, 3.0};
+  std::vector<double> output(input.size());
+  EXPECT_TRUE(plan.Apply(std::span<const double>{input}, std::span<double>{output}));
+  EXPECT_EQ(output, std::vector<double>({1000.0, -2000.0, 3000.0}));
+}
+
+TEST(ConversionPlan, ApplySpanSizeMismatch) {
+  const ConversionPlan<Unit::Length> plan{Unit::Length::Kilometre, Unit::Length::Metre};
+  const std::vector<double> input{1.0, -2.0, 3.0};
+
+  std::vector<double> shorter_output(2, 0.0);
+  EXPECT_FALSE(plan.Apply(std::span<const double>{input}, std::span<double>{shorter_output}));
+  EXPECT_EQ(shorter_output, std::vector<double>(2, 0.0));
+
+  std::vector<double> longer_output(4, 0.0);
+  EXPECT_FALSE(plan.Apply(std::span<const double>{input}, std::span<double>{longer_output}));
+  EXPECT_EQ(longer_output, std::vector<double>(4, 0.0));
+}
+
+#endif  // __cplusplus >= 202002L
+
+TEST(ConversionPlan, ApplyStdVector) {
+  const ConversionPlan<Unit::Length> plan{Unit::Length::Mile, Unit::Length::Foot};
+  std::vector<double> values(100, 1.0);
+  plan.Apply(values);
+  EXPECT_EQ(values, std::vector<double>(100, 5280.0));
+}
+
+TEST(ConversionPlan, ApplySymmetricDyad) {
+  const ConversionPlan<Unit::Length> plan{Unit::Length::Kilometre, Unit::Length::Metre};
+  SymmetricDyad symmetric_dyad{1.0, -2.0, 3.0, -4.0, 5.0, -6.0};
+  plan.Apply(symmetric_dyad);
+  EXPECT_EQ(symmetric_dyad, SymmetricDyad(1000.0, -2000.0, 3000.0, -4000.0, 5000.0, -6000.0));
+
+  std::vector<SymmetricDyad<>> symmetric_dyads(3, SymmetricDyad(1.0, -2.0, 3.0, -4.0, 5.0, -6.0));
+  plan.Apply(symmetric_dyads);
+  EXPECT_EQ(symmetric_dyads, std::vector<SymmetricDyad<>>(3, symmetric_dyad));
+}
+
+TEST(ConversionPlan, ApplyVector) {
+  const ConversionPlan<Unit::Length> plan{Unit::Length::Kilometre, Unit::Length::Metre};
+  Vector vector{1.0, -2.0, 3.0};
+  plan.Apply(vector);
+  EXPECT_EQ(vector, Vector(1000.0, -2000.0, 3000.0));
+
+  std::vector<Vector<>> vectors(3, Vector(1.0, -2.0, 3.0));
+  plan.Apply(vectors);
+  EXPECT_EQ(vectors, std::vector<Vector<>>(3, Vector(1000.0, -2000.0, 3000.0)));
+}
+
+TEST(ConversionPlan, Coefficients) {
+  constexpr ConversionPlan<Unit::Temperature> plan{
+      Unit::Temperature::Celsius, Unit::Temperature::Fahrenheit};
+  EXPECT_DOUBLE_EQ(plan.Scale(), 1.8);
+  EXPECT_DOUBLE_EQ(plan.Offset(), 32.0);
+}
+
+TEST(ConversionPlan, Constexpr) {
+  constexpr double value{[]() {
+    constexpr ConversionPlan<Unit::Length> plan{Unit::Length::Kilometre, Unit::Length::Metre};
+    Vector vector{1.0, -2.0, 3.0};
+    plan.Apply(vector);
+    return vector.x() + vector.y() + vector.z();
+  }()};
+  EXPECT_EQ(value, 2000.0);
+}
+
+TEST(ConversionPlan, DefaultConstructor) {
+  constexpr ConversionPlan<Unit::Length> plan;
+  EXPECT_EQ(plan.OriginalUnit(), Standard<Unit::Length>);
+  EXPECT_EQ(plan.NewUnit(), Standard<Unit::Length>);
+  EXPECT_TRUE(plan.IsIdentity());
+  double value{1.25};
+  plan.Apply(value);
+  EXPECT_EQ(value, 1.25);
+}
+
+TEST(ConversionPlan, Inverse) {
+  const ConversionPlan<Unit::Length> plan{Unit::Length::Foot, Unit::Length::Metre};
+  const ConversionPlan<Unit::Length> inverse{plan.Inverse()};
+  EXPECT_EQ(inverse.OriginalUnit(), Unit::Length::Metre);
+  EXPECT_EQ(inverse.NewUnit(), Unit::Length::Foot);
+  EXPECT_FALSE(inverse.IsIdentity());
+  double value{0.3048};
+  inverse.Apply(value);
+  EXPECT_DOUBLE_EQ(value, 1.0);
+}
+
+TEST(ConversionPlan, MatchesConvert) {
+  constexpr std::size_t count{Internal::NumberOfUnits<Unit::Length>};
+  for (std::size_t original = 0; original < count; ++original) {
+    for (std::size_t updated = 0; updated < count; ++updated) {
+      const Unit::Length original_unit{static_cast<Unit::Length>(original)};
+      const Unit::Length new_unit{static_cast<Unit::Length>(updated)};
+      const ConversionPlan<Unit::Length> plan{original_unit, new_unit};
+      EXPECT_EQ(plan.OriginalUnit(), original_unit);
+      EXPECT_EQ(plan.NewUnit(), new_unit);
+      EXPECT_EQ(plan.IsIdentity(), original == updated);
+      double value{1.234567};
+      plan.Apply(value);
+      EXPECT_EQ(value, Convert(1.234567, original_unit, new_unit));
+    }
+  }
+}
+
+}  // namespace
+
+}  // namespace PhQ
@@ -28,6 +28,7 @@
 #include <functional>
 #include <gtest/gtest.h>
 #include <sstream>
+#include <string>
 #include <utility>
 
 #include "../include/PhQ/Dimension/ElectricCurrent.hpp"
@@ -303,6 +304,14 @@ TEST(Dimensions, JSON) {
                 .JSON(),
             "{\"time\":1,\"length\":-1,\"mass\":2,\"electric_current\":-2,\"temperature\":3,"
             "\"substance_amount\":-3,\"luminous_intensity\":4}");
+  const Dimensions dimensions(Dimension::Time(-2), Dimension::Length(2), Dimension::Mass(1),
+                              Dimension::ElectricCurrent(0), Dimension::Temperature(-1), {}, {});
+  std::string string{"prefix:"};
+  dimensions.AppendJSON(string);
+  EXPECT_EQ(string, R"(prefix:{"time":-2,"length":2,"mass":1,"temperature":-1})");
+  char buffer[64];
+  char* const end{dimensions.WriteJSON(buffer)};
+  EXPECT_EQ(std::string(buffer, end), R"({"time":-2,"length":2,"mass":1,"temperature":-1})");
 }
 
 TEST(Dimensions, MoveAssignmentOperator) {
@@ -382,6 +391,17 @@ TEST(Dimensions, XML) {
             "<time>1</time><length>-1</length><mass>2</mass><electric_current>-2</"
             "electric_current><temperature>3</temperature><substance_amount>-3</"
             "substance_amount><luminous_intensity>4</luminous_intensity>");
+  const Dimensions dimensions(Dimension::Time(-2), Dimension::Length(2), Dimension::Mass(1),
+                              Dimension::ElectricCurrent(0), Dimension::Temperature(-1), {}, {});
+  std::string string{"prefix:"};
+  dimensions.AppendXML(string);
+  EXPECT_EQ(string,
+            R"(prefix:<time>-2</time><length>2</length><mass>1</mass><temperature>-1)"
+            R"(</temperature>)");
+  char buffer[128];
+  char* const end{dimensions.WriteXML(buffer)};
+  EXPECT_EQ(std::string(buffer, end),
+            R"(<time>-2</time><length>2</length><mass>1</mass><temperature>-1</temperature>)");
 }
 
 TEST(Dimensions, YAML) {
@@ -400,6 +420,14 @@ TEST(Dimensions, YAML) {
                 .YAML(),
             "{time:1,length:-1,mass:2,electric_current:-2,temperature:3,substance_amount:-3,"
             "luminous_intensity:4}");
+  const Dimensions dimensions(Dimension::Time(-2), Dimension::Length(2), Dimension::Mass(1),
+                              Dimension::ElectricCurrent(0), Dimension::Temperature(-1), {}, {});
+  std::string string{"prefix:"};
+  dimensions.AppendYAML(string);
+  EXPECT_EQ(string, R"(prefix:{time:-2,length:2,mass:1,temperature:-1})");
+  char buffer[64];
+  char* const end{dimensions.WriteYAML(buffer)};
+  EXPECT_EQ(std::string(buffer, end), R"({time:-2,length:2,mass:1,temperature:-1})");
 }
 
 }  // namespace
@@ -29,6 +29,7 @@
 #include <gtest/gtest.h>
 #include <optional>
 #include <sstream>
+#include <string>
 #include <utility>
 
 #include "../include/PhQ/Base.hpp"
@@ -682,6 +683,19 @@ TEST(Dyad, JSON) {
       "{\"xx\":" + Print(1.0L) + ",\"xy\":" + Print(-2.0L) + ",\"xz\":" + Print(3.0L)
           + ",\"yx\":" + Print(-4.0L) + ",\"yy\":" + Print(5.0L) + ",\"yz\":" + Print(-6.0L)
           + ",\"zx\":" + Print(7.0L) + ",\"zy\":" + Print(-8.0L) + ",\"zz\":" + Print(9.0L) + "}");
+  const Dyad dyad(1.0F, -2.0F, 3.0F, -4.0F, 5.0F, -6.0F, 7.0F, -8.0F, 9.0F);
+  std::string string{"prefix:"};
+  dyad.AppendJSON(string);
+  EXPECT_EQ(string,
+            R"(prefix:{"xx":1.000000000,"xy":-2.000000000,"xz":3.000000000,"yx":-4.000000000,)"
+            R"("yy":5.000000000,"yz":-6.000000000,"zx":7.000000000,"zy":-8.000000000,)"
+            R"("zz":9.000000000})");
+  char buffer[256];
+  char* const end{dyad.WriteJSON(buffer)};
+  EXPECT_EQ(std::string(buffer, end),
+            R"({"xx":1.000000000,"xy":-2.000000000,"xz":3.000000000,"yx":-4.000000000,)"
+            R"("yy":5.000000000,"yz":-6.000000000,"zx":7.000000000,"zy":-8.000000000,)"
+            R"("zz":9.000000000})");
 }
 
 TEST(Dyad, MoveAssignmentOperator) {
@@ -987,6 +1001,19 @@ TEST(Dyad, XML) {
       "<xx>" + Print(1.0L) + "</xx><xy>" + Print(-2.0L) + "</xy><xz>" + Print(3.0L) + "</xz><yx>"
           + Print(-4.0L) + "</yx><yy>" + Print(5.0L) + "</yy><yz>" + Print(-6.0L) + "</yz><zx>"
           + Print(7.0L) + "</zx><zy>" + Print(-8.0L) + "</zy><zz>" + Print(9.0L) + "</zz>");
+  const Dyad dyad(1.0F, -2.0F, 3.0F, -4.0F, 5.0F, -6.0F, 7.0F, -8.0F, 9.0F);
+  std::string string{"prefix:"};
+  dyad.AppendXML(string);
+  EXPECT_EQ(string,
+            R"(prefix:<xx>1.000000000</xx><xy>-2.000000000</xy><xz>3.000000000</xz>)"
+            R"(<yx>-4.000000000</yx><yy>5.000000000</yy><yz>-6.000000000</yz><zx>7.000000000)"
+            R"(</zx><zy>-8.000000000</zy><zz>9.000000000</zz>)");
+  char buffer[256];
+  char* const end{dyad.WriteXML(buffer)};
+  EXPECT_EQ(std::string(buffer, end),
+            R"(<xx>1.000000000</xx><xy>-2.000000000</xy><xz>3.000000000</xz><yx>-4.000000000)"
+            R"(</yx><yy>5.000000000</yy><yz>-6.000000000</yz><zx>7.000000000</zx>)"
+            R"(<zy>-8.000000000</zy><zz>9.000000000</zz>)");
 }
 
 TEST(Dyad, YAML) {
@@ -1002,6 +1029,17 @@ TEST(Dyad, YAML) {
             "{xx:" + Print(1.0L) + ",xy:" + Print(-2.0L) + ",xz:" + Print(3.0L)
                 + ",yx:" + Print(-4.0L) + ",yy:" + Print(5.0L) + ",yz:" + Print(-6.0L)
                 + ",zx:" + Print(7.0L) + ",zy:" + Print(-8.0L) + ",zz:" + Print(9.0L) + "}");
+  const Dyad dyad(1.0F, -2.0F, 3.0F, -4.0F, 5.0F, -6.0F, 7.0F, -8.0F, 9.0F);
+  std::string string{"prefix:"};
+  dyad.AppendYAML(string);
+  EXPECT_EQ(string,
+            R"(prefix:{xx:1.000000000,xy:-2.000000000,xz:3.000000000,yx:-4.000000000,)"
+            R"(yy:5.000000000,yz:-6.000000000,zx:7.000000000,zy:-8.000000000,zz:9.000000000})");
+  char buffer[256];
+  char* const end{dyad.WriteYAML(buffer)};
+  EXPECT_EQ(std::string(buffer, end),
+            R"({xx:1.000000000,xy:-2.000000000,xz:3.000000000,yx:-4.000000000,yy:5.000000000,)"
+            R"(yz:-6.000000000,zx:7.000000000,zy:-8.000000000,zz:9.000000000})");
 }
 
 TEST(Dyad, Zero) {
@@ -0,0 +1,319 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/DyadField.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <optional>
+#include <vector>
+
+#include "../include/PhQ/Displacement.hpp"
+#include "../include/PhQ/DisplacementGradient.hpp"
+#include "../include/PhQ/Dyad.hpp"
+#include "../include/PhQ/Vector.hpp"
+#include "../include/PhQ/VectorField.hpp"
+#include "../include/PhQ/VelocityGradient.hpp"
+
+namespace PhQ {
+
+namespace {
+
+const std::vector<VelocityGradient<>> velocity_gradients{
+    VelocityGradient<>({2.0, 1.0, 0.0, 0.0, 3.0, 1.0, 1.0, 0.0, 4.0}, Unit::Frequency::Hertz),
+    VelocityGradient<>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, Unit::Frequency::Hertz),
+    VelocityGradient<>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0}, Unit::Frequency::Kilohertz),
+    VelocityGradient<>({-0.5, 0.25, 0.0, 2.0, -1.0, 0.75, 0.0, 0.5, 1.0}, Unit::Frequency::Hertz),
+};
+
+const Dyad<> identity{1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0};
+
+void ExpectNear(const Dyad<>& first, const Dyad<>& second) {
+  for (std::size_t index = 0; index < 9; ++index) {
+    EXPECT_NEAR(first.xx_xy_xz_yx_yy_yz_zx_zy_zz()[index],
+                second.xx_xy_xz_yx_yy_yz_zx_zy_zz()[index], 1.0E-12);
+  }
+}
+
+TEST(DyadField, AddScaled) {
+  DyadField<VelocityGradient<>> field{velocity_gradients};
+  const DyadField<VelocityGradient<>> other{velocity_gradients};
+  field.AddScaled(2.0, other);
+  for (std::size_t index = 0; index < velocity_gradients.size(); ++index) {
+    EXPECT_EQ(field[index], velocity_gradients[index] * 3.0);
+  }
+}
+
+TEST(DyadField, Alignment) {
+  const DyadField<VelocityGradient<>> field{velocity_gradients};
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(field.xx()) % Internal::FieldAlignment, 0);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(field.xy()) % Internal::FieldAlignment, 0);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(field.xz()) % Internal::FieldAlignment, 0);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(field.yx()) % Internal::FieldAlignment, 0);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(field.yy()) % Internal::FieldAlignment, 0);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(field.yz()) % Internal::FieldAlignment, 0);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(field.zx()) % Internal::FieldAlignment, 0);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(field.zy()) % Internal::FieldAlignment, 0);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(field.zz()) % Internal::FieldAlignment, 0);
+}
+
+TEST(DyadField, ArithmeticOperators) {
+  const DyadField<VelocityGradient<>> field{velocity_gradients};
+  const DyadField<VelocityGradient<>> sum{field + field};
+  const DyadField<VelocityGradient<>> difference{field - field};
+  const DyadField<VelocityGradient<>> product{field * 2.0};
+  const DyadField<VelocityGradient<>> reversed_product{2.0 * field};
+  const DyadField<VelocityGradient<>> quotient{field / 2.0};
+  for (std::size_t index = 0; index < velocity_gradients.size(); ++index) {
+    EXPECT_EQ(sum[index], velocity_gradients[index] + velocity_gradients[index]);
+    EXPECT_EQ(difference[index], VelocityGradient<>::Zero());
+    EXPECT_EQ(product[index], velocity_gradients[index] * 2.0);
+    EXPECT_EQ(reversed_product[index], velocity_gradients[index] * 2.0);
+    EXPECT_EQ(quotient[index], velocity_gradients[index] / 2.0);
+  }
+}
+
+TEST(DyadField, ComparisonOperators) {
+  const DyadField<VelocityGradient<>> first{velocity_gradients};
+  DyadField<VelocityGradient<>> second{velocity_gradients};
+  EXPECT_EQ(first, second);
+  second[1] = VelocityGradient<>(
+      {1.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, Unit::Frequency::Hertz);
+  EXPECT_NE(first, second);
+}
+
+TEST(DyadField, Components) {
+  const DyadField<VelocityGradient<>> field{velocity_gradients};
+  EXPECT_EQ(field.xx()[2], 1000.0);
+  EXPECT_EQ(field.xy()[2], 2000.0);
+  EXPECT_EQ(field.xz()[2], 3000.0);
+  EXPECT_EQ(field.yx()[2], 4000.0);
+  EXPECT_EQ(field.yy()[0], 3.0);
+  EXPECT_EQ(field.yz()[0], 1.0);
+  EXPECT_EQ(field.zx()[0], 1.0);
+  EXPECT_EQ(field.zy()[3], 0.5);
+  EXPECT_EQ(field.zz()[3], 1.0);
+}
+
+TEST(DyadField, Constructors) {
+  const DyadField<VelocityGradient<>> empty;
+  EXPECT_TRUE(empty.Empty());
+  const DyadField<VelocityGradient<>> zeros(3);
+  EXPECT_EQ(zeros.Size(), 3);
+  EXPECT_EQ(zeros[2], VelocityGradient<>::Zero());
+  const DyadField<VelocityGradient<>> copies(2, velocity_gradients[0]);
+  EXPECT_EQ(copies[1], velocity_gradients[0]);
+  const DyadField<VelocityGradient<>> field{velocity_gradients.data(), velocity_gradients.size()};
+  EXPECT_EQ(field.Quantities(), velocity_gradients);
+}
+
+TEST(DyadField, Determinant) {
+  const DyadField<VelocityGradient<>> field{velocity_gradients};
+  const std::vector<double> determinants{field.Determinant()};
+  ASSERT_EQ(determinants.size(), velocity_gradients.size());
+  EXPECT_DOUBLE_EQ(determinants[0], 25.0);
+  EXPECT_EQ(determinants[1], 0.0);
+  EXPECT_EQ(determinants[2], 0.0);
+  EXPECT_DOUBLE_EQ(determinants[3], 0.1875);
+  for (std::size_t index = 0; index < velocity_gradients.size(); ++index) {
+    EXPECT_DOUBLE_EQ(determinants[index], velocity_gradients[index].Value().Determinant());
+  }
+}
+
+TEST(DyadField, DyadProduct) {
+  const DyadField<VelocityGradient<>> velocity_gradient_field{velocity_gradients};
+  const DyadField<DisplacementGradient<>> displacement_gradient_field{std::vector{
+      DisplacementGradient<>(1.0, 0.0, 0.0, 0.0, 1.0, 0.0, 0.0, 0.0, 1.0),
+      DisplacementGradient<>(1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0),
+      DisplacementGradient<>(0.0, 1.0, 0.0, 1.0, 0.0, 0.0, 0.0, 0.0, 1.0),
+      DisplacementGradient<>(2.0, -1.0, 0.5, 0.0, 3.0, -2.0, 1.0, 1.0, -1.0),
+  }};
+  const DyadField<VelocityGradient<>> products{
+      displacement_gradient_field * velocity_gradient_field};
+  const DyadField<Dyad<>> squares{velocity_gradient_field * velocity_gradient_field};
+  ASSERT_EQ(products.Size(), velocity_gradients.size());
+  for (std::size_t index = 0; index < velocity_gradients.size(); ++index) {
+    ExpectNear(products[index].Value(), displacement_gradient_field[index].Value()
+                                            * velocity_gradients[index].Value());
+    ExpectNear(squares[index],
+               velocity_gradients[index].Value() * velocity_gradients[index].Value());
+  }
+  EXPECT_EQ(products[0], velocity_gradients[0]);
+
+  DyadField<VelocityGradient<>> caller_provided(velocity_gradients.size());
+  displacement_gradient_field.Multiply(velocity_gradient_field, caller_provided);
+  EXPECT_EQ(caller_provided, products);
+}
+
+TEST(DyadField, Inverse) {
+  const DyadField<VelocityGradient<>> field{velocity_gradients};
+  DyadField<Dyad<>> inverses;
+  const std::vector<std::uint64_t> singular{field.Inverse(inverses)};
+  ASSERT_EQ(inverses.Size(), velocity_gradients.size());
+  ASSERT_EQ(singular.size(), 1);
+  EXPECT_EQ(singular[0], 0b0110);
+  EXPECT_EQ(inverses[1], Dyad<>::Zero());
+  EXPECT_EQ(inverses[2], Dyad<>::Zero());
+  for (const std::size_t index : {0, 3}) {
+    const std::optional<Dyad<>> expected{velocity_gradients[index].Value().Inverse()};
+    ASSERT_TRUE(expected.has_value());
+    ExpectNear(inverses[index], expected.value());
+    ExpectNear(inverses[index].Value() * velocity_gradients[index].Value(), identity);
+  }
+
+  DyadField<Dyad<>> caller_provided(velocity_gradients.size());
+  std::uint64_t mask{0};
+  field.Inverse(caller_provided, &mask);
+  EXPECT_EQ(mask, 0b0110);
+  EXPECT_EQ(caller_provided, inverses);
+}
+
+TEST(DyadField, LargeField) {
+  std::vector<DisplacementGradient<>> many;
+  for (std::size_t index = 0; index < 1001; ++index) {
+    const double value{static_cast<double>(index)};
+    if (index % 7 == 0) {
+      many.emplace_back(value, 1.0, 2.0, value, 1.0, 2.0, 0.5, -value, 3.0);
+    } else {
+      many.emplace_back(value, 1.0, 2.0, -0.5 * value, 4.0, 0.25, 1.0, 0.0, 3.0 + value);
+    }
+  }
+  const DyadField<DisplacementGradient<>> field{many};
+  const std::vector<double> determinants{field.Determinant()};
+  DyadField<Dyad<>> inverses;
+  const std::vector<std::uint64_t> singular{field.Inverse(inverses)};
+  ASSERT_EQ(singular.size(), 16);
+  for (std::size_t index = 0; index < many.size(); ++index) {
+    EXPECT_DOUBLE_EQ(determinants[index], many[index].Value().Determinant());
+    const bool is_singular{((singular[index / 64] >> (index % 64)) & 1U) != 0};
+    const std::optional<Dyad<>> expected{many[index].Value().Inverse()};
+    EXPECT_EQ(is_singular, !expected.has_value());
+    EXPECT_EQ(is_singular, index % 7 == 0);
+    if (expected.has_value()) {
+      ExpectNear(inverses[index].Value(), expected.value());
+      ExpectNear(inverses[index].Value() * many[index].Value(), identity);
+    }
+  }
+  EXPECT_EQ(singular[15] >> (1001 % 64), 0);
+}
+
+TEST(DyadField, Modifiers) {
+  DyadField<VelocityGradient<>> field;
+  field.Reserve(2);
+  field.PushBack(velocity_gradients[0]);
+  field.PushBack(velocity_gradients[2]);
+  EXPECT_EQ(field.Size(), 2);
+  EXPECT_EQ(field[1], velocity_gradients[2]);
+  field.Resize(3);
+  EXPECT_EQ(field[2], VelocityGradient<>::Zero());
+  field.Clear();
+  EXPECT_TRUE(field.Empty());
+}
+
+TEST(DyadField, OutputIsInput) {
+  std::vector<DisplacementGradient<>> gradients;
+  std::vector<Dyad<>> dyads;
+  std::vector<Displacement<>> displacements;
+  for (std::size_t index = 0; index < 1000; ++index) {
+    const double value{static_cast<double>(index)};
+    gradients.emplace_back(1.0 + value, 0.5, -0.25, 0.125 * value, 2.0, 0.75, -1.0, 0.25, 3.0);
+    dyads.push_back(gradients.back().Value());
+    displacements.push_back(Displacement<>({value, -0.5 * value, 1.0}, Unit::Length::Metre));
+  }
+  const DyadField<DisplacementGradient<>> gradient_field{gradients};
+
+  VectorField<Displacement<>> vectors{displacements};
+  const VectorField<Displacement<>> expected_vectors{gradient_field * vectors};
+  gradient_field.Multiply(vectors, vectors);
+  EXPECT_EQ(vectors, expected_vectors);
+
+  const DyadField<DisplacementGradient<>> expected_squares{gradient_field * gradient_field};
+  DyadField<DisplacementGradient<>> squares{gradient_field};
+  squares.Multiply(squares, squares);
+  EXPECT_EQ(squares, expected_squares);
+  DyadField<DisplacementGradient<>> other{gradient_field};
+  gradient_field.Multiply(other, other);
+  EXPECT_EQ(other, expected_squares);
+
+  DyadField<Dyad<>> dyad_field{dyads};
+  DyadField<Dyad<>> expected_inverses;
+  const std::vector<std::uint64_t> expected_singular{dyad_field.Inverse(expected_inverses)};
+  std::vector<std::uint64_t> singular(expected_singular.size());
+  dyad_field.Inverse(dyad_field, singular.data());
+  EXPECT_EQ(dyad_field, expected_inverses);
+  EXPECT_EQ(singular, expected_singular);
+}
+
+TEST(DyadField, Reference) {
+  DyadField<VelocityGradient<>> field{velocity_gradients};
+  const VelocityGradient<> velocity_gradient{field[0]};
+  EXPECT_EQ(velocity_gradient, velocity_gradients[0]);
+  EXPECT_EQ(field[0].Value(), velocity_gradients[0].Value());
+  field[1] = velocity_gradients[3];
+  EXPECT_EQ(field[1], velocity_gradients[3]);
+  field[1] = field[0];
+  EXPECT_EQ(velocity_gradients[0], field[1]);
+  field[0] += velocity_gradients[0];
+  EXPECT_EQ(field[0], velocity_gradients[0] * 2.0);
+  field[0] -= velocity_gradients[0];
+  EXPECT_EQ(field[0], velocity_gradients[0]);
+  field[0] *= 4.0;
+  EXPECT_EQ(field[0], velocity_gradients[0] * 4.0);
+  field[0] /= 4.0;
+  EXPECT_EQ(field[0], velocity_gradients[0]);
+  EXPECT_NE(field[0], velocity_gradients[2]);
+}
+
+TEST(DyadField, VectorProduct) {
+  const VectorField<Displacement<>> displacements{std::vector{
+      Displacement<>({1.0, 0.0, 0.0}, Unit::Length::Metre),
+      Displacement<>({1.0, 2.0, 3.0}, Unit::Length::Metre),
+      Displacement<>({0.0, 1.0, -1.0}, Unit::Length::Millimetre),
+      Displacement<>({-2.0, 0.5, 4.0}, Unit::Length::Metre),
+  }};
+  const DyadField<VelocityGradient<>> velocity_gradient_field{velocity_gradients};
+  const VectorField<Vector<>> velocities{velocity_gradient_field * displacements};
+  ASSERT_EQ(velocities.Size(), velocity_gradients.size());
+  for (std::size_t index = 0; index < velocity_gradients.size(); ++index) {
+    EXPECT_EQ(velocities[index],
+              velocity_gradients[index].Value() * displacements[index].Value());
+  }
+
+  const DyadField<DisplacementGradient<>> displacement_gradient_field(
+      4, DisplacementGradient<>(2.0, 0.0, 0.0, 0.0, 2.0, 0.0, 0.0, 0.0, 2.0));
+  const VectorField<Displacement<>> scaled{displacement_gradient_field * displacements};
+  for (std::size_t index = 0; index < velocity_gradients.size(); ++index) {
+    EXPECT_EQ(scaled[index], displacements[index] * 2.0);
+  }
+
+  VectorField<Vector<>> caller_provided(velocity_gradients.size());
+  velocity_gradient_field.Multiply(displacements, caller_provided);
+  EXPECT_EQ(caller_provided, velocities);
+}
+
+}  // namespace
+
+}  // namespace PhQ
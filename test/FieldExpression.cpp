@@ -0,0 +1,192 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/FieldExpression.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "../include/PhQ/Acceleration.hpp"
+#include "../include/PhQ/Displacement.hpp"
+#include "../include/PhQ/DisplacementGradient.hpp"
+#include "../include/PhQ/DyadField.hpp"
+#include "../include/PhQ/Length.hpp"
+#include "../include/PhQ/Position.hpp"
+#include "../include/PhQ/Speed.hpp"
+#include "../include/PhQ/Stress.hpp"
+#include "../include/PhQ/SymmetricDyadField.hpp"
+#include "../include/PhQ/Time.hpp"
+#include "../include/PhQ/VectorField.hpp"
+#include "../include/PhQ/Velocity.hpp"
+#include "../include/PhQ/VelocityGradient.hpp"
+
+namespace PhQ {
+
+namespace {
+
+// Sequences of physical quantities that are long enough to be processed with SIMD instructions.
+constexpr std::size_t size{101};
+
+const Time<> time_step{0.5, Unit::Time::Second};
+
+std::vector<Position<>> MakePositions() {
+  std::vector<Position<>> positions;
+  for (std::size_t index = 0; index < size; ++index) {
+    const double value{static_cast<double>(index)};
+    positions.emplace_back(Vector<>{value, -2.0 * value, 1.0}, Unit::Length::Metre);
+  }
+  return positions;
+}
+
+std::vector<Velocity<>> MakeVelocities() {
+  std::vector<Velocity<>> velocities;
+  for (std::size_t index = 0; index < size; ++index) {
+    const double value{static_cast<double>(index)};
+    velocities.emplace_back(Vector<>{1.0, value, -0.25 * value}, Unit::Speed::MetrePerSecond);
+  }
+  return velocities;
+}
+
+std::vector<Acceleration<>> MakeAccelerations() {
+  std::vector<Acceleration<>> accelerations;
+  for (std::size_t index = 0; index < size; ++index) {
+    const double value{static_cast<double>(index)};
+    accelerations.emplace_back(
+        Vector<>{-value, 2.0, 0.5 * value}, Unit::Acceleration::MetrePerSquareSecond);
+  }
+  return accelerations;
+}
+
+std::vector<Stress<>> MakeStresses(const double factor) {
+  std::vector<Stress<>> stresses;
+  for (std::size_t index = 0; index < size; ++index) {
+    const double value{factor * static_cast<double>(index + 1)};
+    stresses.emplace_back(
+        SymmetricDyad<>{value, -0.5 * value, 0.25 * value, 2.0 * value, 0.125, -value},
+        Unit::Pressure::Kilopascal);
+  }
+  return stresses;
+}
+
+TEST(FieldExpression, ConstantQuantities) {
+  const std::vector<Velocity<>> velocities{MakeVelocities()};
+  const VectorField<Velocity<>> field{velocities};
+  const Acceleration<> gravity({0.0, 0.0, -9.8}, Unit::Acceleration::MetrePerSquareSecond);
+  const VectorField<Velocity<>> result{Evaluate(Lazy(field) + gravity * time_step)};
+  ASSERT_EQ(result.Size(), size);
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(result[index], velocities[index] + gravity * time_step);
+  }
+}
+
+TEST(FieldExpression, DyadFields) {
+  std::vector<VelocityGradient<>> velocity_gradients;
+  for (std::size_t index = 0; index < size; ++index) {
+    const double value{static_cast<double>(index)};
+    velocity_gradients.emplace_back(
+        Dyad<>{value, 1.0, 0.0, -value, 3.0, 1.0, 1.0, 0.5 * value, 4.0}, Unit::Frequency::Hertz);
+  }
+  const DyadField<VelocityGradient<>> field{velocity_gradients};
+  const auto result{Evaluate(Lazy(field) * time_step)};
+  static_assert(std::is_same_v<decltype(result), const DyadField<DisplacementGradient<>>>);
+  ASSERT_EQ(result.Size(), size);
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(result[index], velocity_gradients[index] * time_step);
+  }
+}
+
+TEST(FieldExpression, InPlace) {
+  std::vector<Position<>> positions{MakePositions()};
+  const std::vector<Velocity<>> velocities{MakeVelocities()};
+  VectorField<Position<>> field{positions};
+  const VectorField<Velocity<>> velocity_field{velocities};
+  Evaluate(Lazy(field) + Lazy(velocity_field) * time_step, field);
+  ASSERT_EQ(field.Size(), size);
+  for (std::size_t index = 0; index < size; ++index) {
+    positions[index] += velocities[index] * time_step;
+    EXPECT_EQ(std::as_const(field)[index], positions[index]);
+  }
+}
+
+TEST(FieldExpression, Kinematics) {
+  const std::vector<Position<>> positions{MakePositions()};
+  const std::vector<Velocity<>> velocities{MakeVelocities()};
+  const std::vector<Acceleration<>> accelerations{MakeAccelerations()};
+  const VectorField<Position<>> position_field{positions};
+  const VectorField<Velocity<>> velocity_field{velocities};
+  const VectorField<Acceleration<>> acceleration_field{accelerations};
+  const auto result{Evaluate(Lazy(position_field) + Lazy(velocity_field) * time_step
+                             + 0.5 * Lazy(acceleration_field) * time_step * time_step)};
+  static_assert(std::is_same_v<decltype(result), const VectorField<Position<>>>);
+  ASSERT_EQ(result.Size(), size);
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(result[index], positions[index] + velocities[index] * time_step
+                                 + 0.5 * accelerations[index] * time_step * time_step);
+  }
+}
+
+TEST(FieldExpression, ScalarSequences) {
+  std::vector<Time<>> times;
+  std::vector<Length<>> lengths;
+  for (std::size_t index = 0; index < size; ++index) {
+    const double value{static_cast<double>(index)};
+    times.emplace_back(0.25 * (value + 1.0), Unit::Time::Second);
+    lengths.emplace_back(3.0 * value, Unit::Length::Metre);
+  }
+  const std::vector<Velocity<>> velocities{MakeVelocities()};
+  const VectorField<Velocity<>> velocity_field{velocities};
+  const auto displacements{Evaluate(Lazy(times) * Lazy(velocity_field))};
+  static_assert(std::is_same_v<decltype(displacements), const VectorField<Displacement<>>>);
+  const auto speeds{Evaluate(Lazy(lengths) / Lazy(times))};
+  static_assert(std::is_same_v<decltype(speeds), const std::vector<Speed<>>>);
+  ASSERT_EQ(displacements.Size(), size);
+  ASSERT_EQ(speeds.size(), size);
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(displacements[index], times[index] * velocities[index]);
+    EXPECT_EQ(speeds[index], lengths[index] / times[index]);
+  }
+}
+
+TEST(FieldExpression, SymmetricDyadFields) {
+  const std::vector<Stress<>> first{MakeStresses(1.0)};
+  const std::vector<Stress<>> second{MakeStresses(-2.0)};
+  const std::vector<Stress<>> third{MakeStresses(0.5)};
+  const SymmetricDyadField<Stress<>> first_field{first};
+  const SymmetricDyadField<Stress<>> second_field{second};
+  const SymmetricDyadField<Stress<>> third_field{third};
+  const auto result{
+      Evaluate((Lazy(first_field) + Lazy(second_field)) * 0.5 - Lazy(third_field) / 4.0)};
+  static_assert(std::is_same_v<decltype(result), const SymmetricDyadField<Stress<>>>);
+  ASSERT_EQ(result.Size(), size);
+  for (std::size_t index = 0; index < size; ++index) {
+    EXPECT_EQ(result[index], (first[index] + second[index]) * 0.5 - third[index] / 4.0);
+  }
+}
+
+}  // namespace
+
+}  // namespace PhQ
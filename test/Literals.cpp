@@ -0,0 +1,795 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/Literals.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../include/PhQ/Length.hpp"
+#include "../include/PhQ/Memory.hpp"
+#include "../include/PhQ/ScalarAcceleration.hpp"
+#include "../include/PhQ/ScalarStress.hpp"
+#include "../include/PhQ/Speed.hpp"
+#include "../include/PhQ/StaticPressure.hpp"
+#include "../include/PhQ/Temperature.hpp"
+#include "../include/PhQ/Time.hpp"
+
+namespace PhQ {
+
+namespace {
+
+using namespace Literals;
+
+// Suffix of the literal of a unit of measure, derived from the unit's abbreviation by the rules
+// documented in the PhQ::Literals namespace.
+std::string ExpectedSuffix(const std::string_view abbreviation) {
+  std::string suffix;
+  for (std::size_t index = 0; index < abbreviation.size();) {
+    if (abbreviation.compare(index, 2, "μ") == 0) {
+      suffix += "u";
+      index += 2;
+    } else if (abbreviation.compare(index, 2, "°") == 0) {
+      suffix += "deg";
+      index += 2;
+    } else if (abbreviation.compare(index, 2, "·") == 0) {
+      suffix += "_";
+      index += 2;
+    } else if (abbreviation[index] == '/') {
+      suffix += "_per_";
+      ++index;
+    } else if (abbreviation[index] == '^') {
+      ++index;
+    } else {
+      suffix += abbreviation[index];
+      ++index;
+    }
+  }
+  return suffix.front() == '_' ? suffix : "_" + suffix;
+}
+
+// Unit and suffix of a literal. Verifies that the floating-point and integer overloads of the
+// literal share the same unit.
+template <typename UnitType>
+std::pair<UnitType, std::string_view> Literal(const UnitType floating_point_unit,
+                                              const UnitType integer_unit,
+                                              const std::string_view suffix) {
+  EXPECT_EQ(floating_point_unit, integer_unit) << suffix;
+  return {floating_point_unit, suffix};
+}
+
+#define PHQ_LITERAL(suffix) Literal((1.0##suffix).Unit(), (1##suffix).Unit(), #suffix)
+
+// Verifies that every unit of a given unit type has exactly one literal and that the literal's
+// suffix is derived from the unit's abbreviation.
+template <typename UnitType>
+void ExpectOneLiteralPerUnit(const std::vector<std::pair<UnitType, std::string_view>>& literals) {
+  EXPECT_EQ(literals.size(), Internal::Abbreviations<UnitType>.size());
+  for (const std::pair<UnitType, std::string_view>& unit_and_abbreviation :
+       Internal::Abbreviations<UnitType>) {
+    std::size_t count{0};
+    for (const std::pair<UnitType, std::string_view>& literal : literals) {
+      if (literal.first == unit_and_abbreviation.first) {
+        ++count;
+        EXPECT_EQ(literal.second, ExpectedSuffix(unit_and_abbreviation.second));
+      }
+    }
+    EXPECT_EQ(count, 1) << unit_and_abbreviation.second;
+  }
+}
+
+TEST(Literals, Constexpr) {
+  constexpr Length<> length = 12.5_km;
+  static_assert(length.Value() == 12500.0);
+  constexpr StaticPressure<> static_pressure = 3.0_MPa;
+  static_assert(static_pressure.Value() == 3000000.0);
+  constexpr Time<float> time = 2_hr;
+  static_assert(time.Value() == 7200.0F);
+  EXPECT_EQ(length.Value(), 12500.0);
+}
+
+TEST(Literals, EveryUnitHasOneLiteral) {
+  // Temperature difference units share their abbreviations with temperature units, so their
+  // literals resolve to PhQ::Unit::Temperature only.
+  ExpectOneLiteralPerUnit<Unit::Acceleration>({
+      PHQ_LITERAL(_nmi_per_s2),
+      PHQ_LITERAL(_nmi_per_min2),
+      PHQ_LITERAL(_kn_per_hr),
+      PHQ_LITERAL(_mi_per_s2),
+      PHQ_LITERAL(_mi_per_min2),
+      PHQ_LITERAL(_mi_per_hr2),
+      PHQ_LITERAL(_km_per_s2),
+      PHQ_LITERAL(_km_per_min2),
+      PHQ_LITERAL(_km_per_hr2),
+      PHQ_LITERAL(_m_per_s2),
+      PHQ_LITERAL(_m_per_min2),
+      PHQ_LITERAL(_m_per_hr2),
+      PHQ_LITERAL(_yd_per_s2),
+      PHQ_LITERAL(_yd_per_min2),
+      PHQ_LITERAL(_yd_per_hr2),
+      PHQ_LITERAL(_ft_per_s2),
+      PHQ_LITERAL(_ft_per_min2),
+      PHQ_LITERAL(_ft_per_hr2),
+      PHQ_LITERAL(_dm_per_s2),
+      PHQ_LITERAL(_dm_per_min2),
+      PHQ_LITERAL(_dm_per_hr2),
+      PHQ_LITERAL(_in_per_s2),
+      PHQ_LITERAL(_in_per_min2),
+      PHQ_LITERAL(_in_per_hr2),
+      PHQ_LITERAL(_cm_per_s2),
+      PHQ_LITERAL(_cm_per_min2),
+      PHQ_LITERAL(_cm_per_hr2),
+      PHQ_LITERAL(_mm_per_s2),
+      PHQ_LITERAL(_mm_per_min2),
+      PHQ_LITERAL(_mm_per_hr2),
+      PHQ_LITERAL(_mil_per_s2),
+      PHQ_LITERAL(_mil_per_min2),
+      PHQ_LITERAL(_mil_per_hr2),
+      PHQ_LITERAL(_um_per_s2),
+      PHQ_LITERAL(_um_per_min2),
+      PHQ_LITERAL(_um_per_hr2),
+      PHQ_LITERAL(_uin_per_s2),
+      PHQ_LITERAL(_uin_per_min2),
+      PHQ_LITERAL(_uin_per_hr2),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::Angle>({
+      PHQ_LITERAL(_rad),
+      PHQ_LITERAL(_deg),
+      PHQ_LITERAL(_arcmin),
+      PHQ_LITERAL(_arcsec),
+      PHQ_LITERAL(_rev),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::AngularAcceleration>({
+      PHQ_LITERAL(_rad_per_s2),
+      PHQ_LITERAL(_rad_per_min2),
+      PHQ_LITERAL(_rad_per_hr2),
+      PHQ_LITERAL(_deg_per_s2),
+      PHQ_LITERAL(_deg_per_min2),
+      PHQ_LITERAL(_deg_per_hr2),
+      PHQ_LITERAL(_arcmin_per_s2),
+      PHQ_LITERAL(_arcmin_per_min2),
+      PHQ_LITERAL(_arcmin_per_hr2),
+      PHQ_LITERAL(_arcsec_per_s2),
+      PHQ_LITERAL(_arcsec_per_min2),
+      PHQ_LITERAL(_arcsec_per_hr2),
+      PHQ_LITERAL(_rev_per_s2),
+      PHQ_LITERAL(_rev_per_min2),
+      PHQ_LITERAL(_rev_per_hr2),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::AngularSpeed>({
+      PHQ_LITERAL(_rad_per_s),
+      PHQ_LITERAL(_rad_per_min),
+      PHQ_LITERAL(_rad_per_hr),
+      PHQ_LITERAL(_deg_per_s),
+      PHQ_LITERAL(_deg_per_min),
+      PHQ_LITERAL(_deg_per_hr),
+      PHQ_LITERAL(_arcmin_per_s),
+      PHQ_LITERAL(_arcmin_per_min),
+      PHQ_LITERAL(_arcmin_per_hr),
+      PHQ_LITERAL(_arcsec_per_s),
+      PHQ_LITERAL(_arcsec_per_min),
+      PHQ_LITERAL(_arcsec_per_hr),
+      PHQ_LITERAL(_rev_per_s),
+      PHQ_LITERAL(_rev_per_min),
+      PHQ_LITERAL(_rev_per_hr),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::Area>({
+      PHQ_LITERAL(_nmi2),
+      PHQ_LITERAL(_mi2),
+      PHQ_LITERAL(_km2),
+      PHQ_LITERAL(_ha),
+      PHQ_LITERAL(_ac),
+      PHQ_LITERAL(_m2),
+      PHQ_LITERAL(_yd2),
+      PHQ_LITERAL(_ft2),
+      PHQ_LITERAL(_dm2),
+      PHQ_LITERAL(_in2),
+      PHQ_LITERAL(_cm2),
+      PHQ_LITERAL(_mm2),
+      PHQ_LITERAL(_mil2),
+      PHQ_LITERAL(_um2),
+      PHQ_LITERAL(_uin2),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::Diffusivity>({
+      PHQ_LITERAL(_nmi2_per_s),
+      PHQ_LITERAL(_mi2_per_s),
+      PHQ_LITERAL(_km2_per_s),
+      PHQ_LITERAL(_ha_per_s),
+      PHQ_LITERAL(_ac_per_s),
+      PHQ_LITERAL(_m2_per_s),
+      PHQ_LITERAL(_yd2_per_s),
+      PHQ_LITERAL(_ft2_per_s),
+      PHQ_LITERAL(_dm2_per_s),
+      PHQ_LITERAL(_in2_per_s),
+      PHQ_LITERAL(_cm2_per_s),
+      PHQ_LITERAL(_mm2_per_s),
+      PHQ_LITERAL(_mil2_per_s),
+      PHQ_LITERAL(_um2_per_s),
+      PHQ_LITERAL(_uin2_per_s),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::DynamicViscosity>({
+      PHQ_LITERAL(_Pa_s),
+      PHQ_LITERAL(_kPa_s),
+      PHQ_LITERAL(_MPa_s),
+      PHQ_LITERAL(_GPa_s),
+      PHQ_LITERAL(_P),
+      PHQ_LITERAL(_lbf_s_per_ft2),
+      PHQ_LITERAL(_lbf_s_per_in2),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::ElectricCharge>({
+      PHQ_LITERAL(_C),
+      PHQ_LITERAL(_kC),
+      PHQ_LITERAL(_MC),
+      PHQ_LITERAL(_GC),
+      PHQ_LITERAL(_TC),
+      PHQ_LITERAL(_mC),
+      PHQ_LITERAL(_uC),
+      PHQ_LITERAL(_nC),
+      PHQ_LITERAL(_e),
+      PHQ_LITERAL(_A_min),
+      PHQ_LITERAL(_A_hr),
+      PHQ_LITERAL(_kA_min),
+      PHQ_LITERAL(_kA_hr),
+      PHQ_LITERAL(_MA_min),
+      PHQ_LITERAL(_MA_hr),
+      PHQ_LITERAL(_GA_min),
+      PHQ_LITERAL(_GA_hr),
+      PHQ_LITERAL(_TA_min),
+      PHQ_LITERAL(_TA_hr),
+      PHQ_LITERAL(_mA_min),
+      PHQ_LITERAL(_mA_hr),
+      PHQ_LITERAL(_uA_min),
+      PHQ_LITERAL(_uA_hr),
+      PHQ_LITERAL(_nA_min),
+      PHQ_LITERAL(_nA_hr),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::ElectricCurrent>({
+      PHQ_LITERAL(_A),
+      PHQ_LITERAL(_kA),
+      PHQ_LITERAL(_MA),
+      PHQ_LITERAL(_GA),
+      PHQ_LITERAL(_TA),
+      PHQ_LITERAL(_mA),
+      PHQ_LITERAL(_uA),
+      PHQ_LITERAL(_nA),
+      PHQ_LITERAL(_e_per_s),
+      PHQ_LITERAL(_e_per_min),
+      PHQ_LITERAL(_e_per_hr),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::Energy>({
+      PHQ_LITERAL(_J),
+      PHQ_LITERAL(_mJ),
+      PHQ_LITERAL(_uJ),
+      PHQ_LITERAL(_nJ),
+      PHQ_LITERAL(_kJ),
+      PHQ_LITERAL(_MJ),
+      PHQ_LITERAL(_GJ),
+      PHQ_LITERAL(_W_min),
+      PHQ_LITERAL(_W_hr),
+      PHQ_LITERAL(_kW_min),
+      PHQ_LITERAL(_kW_hr),
+      PHQ_LITERAL(_MW_min),
+      PHQ_LITERAL(_MW_hr),
+      PHQ_LITERAL(_GW_min),
+      PHQ_LITERAL(_GW_hr),
+      PHQ_LITERAL(_ft_lbf),
+      PHQ_LITERAL(_in_lbf),
+      PHQ_LITERAL(_cal),
+      PHQ_LITERAL(_mcal),
+      PHQ_LITERAL(_ucal),
+      PHQ_LITERAL(_ncal),
+      PHQ_LITERAL(_kcal),
+      PHQ_LITERAL(_Mcal),
+      PHQ_LITERAL(_Gcal),
+      PHQ_LITERAL(_eV),
+      PHQ_LITERAL(_meV),
+      PHQ_LITERAL(_ueV),
+      PHQ_LITERAL(_neV),
+      PHQ_LITERAL(_keV),
+      PHQ_LITERAL(_MeV),
+      PHQ_LITERAL(_GeV),
+      PHQ_LITERAL(_BTU),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::EnergyFlux>({
+      PHQ_LITERAL(_W_per_m2),
+      PHQ_LITERAL(_nW_per_mm2),
+      PHQ_LITERAL(_ft_lbf_per_ft2_per_s),
+      PHQ_LITERAL(_in_lbf_per_in2_per_s),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::Force>({
+      PHQ_LITERAL(_N),
+      PHQ_LITERAL(_kN),
+      PHQ_LITERAL(_MN),
+      PHQ_LITERAL(_GN),
+      PHQ_LITERAL(_mN),
+      PHQ_LITERAL(_uN),
+      PHQ_LITERAL(_nN),
+      PHQ_LITERAL(_dyn),
+      PHQ_LITERAL(_lbf),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::Frequency>({
+      PHQ_LITERAL(_Hz),
+      PHQ_LITERAL(_kHz),
+      PHQ_LITERAL(_MHz),
+      PHQ_LITERAL(_GHz),
+      PHQ_LITERAL(_per_min),
+      PHQ_LITERAL(_per_hr),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::HeatCapacity>({
+      PHQ_LITERAL(_J_per_K),
+      PHQ_LITERAL(_nJ_per_K),
+      PHQ_LITERAL(_ft_lbf_per_degR),
+      PHQ_LITERAL(_in_lbf_per_degR),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::Length>({
+      PHQ_LITERAL(_nmi),
+      PHQ_LITERAL(_mi),
+      PHQ_LITERAL(_km),
+      PHQ_LITERAL(_m),
+      PHQ_LITERAL(_yd),
+      PHQ_LITERAL(_ft),
+      PHQ_LITERAL(_dm),
+      PHQ_LITERAL(_in),
+      PHQ_LITERAL(_cm),
+      PHQ_LITERAL(_mm),
+      PHQ_LITERAL(_mil),
+      PHQ_LITERAL(_um),
+      PHQ_LITERAL(_uin),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::Mass>({
+      PHQ_LITERAL(_kg),
+      PHQ_LITERAL(_g),
+      PHQ_LITERAL(_slug),
+      PHQ_LITERAL(_slinch),
+      PHQ_LITERAL(_lbm),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::MassDensity>({
+      PHQ_LITERAL(_kg_per_m3),
+      PHQ_LITERAL(_g_per_mm3),
+      PHQ_LITERAL(_slug_per_ft3),
+      PHQ_LITERAL(_slinch_per_in3),
+      PHQ_LITERAL(_lbm_per_ft3),
+      PHQ_LITERAL(_lbm_per_in3),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::MassRate>({
+      PHQ_LITERAL(_kg_per_s),
+      PHQ_LITERAL(_g_per_s),
+      PHQ_LITERAL(_slug_per_s),
+      PHQ_LITERAL(_slinch_per_s),
+      PHQ_LITERAL(_lbm_per_s),
+      PHQ_LITERAL(_kg_per_min),
+      PHQ_LITERAL(_g_per_min),
+      PHQ_LITERAL(_slug_per_min),
+      PHQ_LITERAL(_slinch_per_min),
+      PHQ_LITERAL(_lbm_per_min),
+      PHQ_LITERAL(_kg_per_hr),
+      PHQ_LITERAL(_g_per_hr),
+      PHQ_LITERAL(_slug_per_hr),
+      PHQ_LITERAL(_slinch_per_hr),
+      PHQ_LITERAL(_lbm_per_hr),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::Memory>({
+      PHQ_LITERAL(_b),
+      PHQ_LITERAL(_B),
+      PHQ_LITERAL(_kb),
+      PHQ_LITERAL(_kib),
+      PHQ_LITERAL(_kB),
+      PHQ_LITERAL(_kiB),
+      PHQ_LITERAL(_Mb),
+      PHQ_LITERAL(_Mib),
+      PHQ_LITERAL(_MB),
+      PHQ_LITERAL(_MiB),
+      PHQ_LITERAL(_Gb),
+      PHQ_LITERAL(_Gib),
+      PHQ_LITERAL(_GB),
+      PHQ_LITERAL(_GiB),
+      PHQ_LITERAL(_Tb),
+      PHQ_LITERAL(_Tib),
+      PHQ_LITERAL(_TB),
+      PHQ_LITERAL(_TiB),
+      PHQ_LITERAL(_Pb),
+      PHQ_LITERAL(_Pib),
+      PHQ_LITERAL(_PB),
+      PHQ_LITERAL(_PiB),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::MemoryRate>({
+      PHQ_LITERAL(_b_per_s),
+      PHQ_LITERAL(_B_per_s),
+      PHQ_LITERAL(_kb_per_s),
+      PHQ_LITERAL(_kib_per_s),
+      PHQ_LITERAL(_kB_per_s),
+      PHQ_LITERAL(_kiB_per_s),
+      PHQ_LITERAL(_Mb_per_s),
+      PHQ_LITERAL(_Mib_per_s),
+      PHQ_LITERAL(_MB_per_s),
+      PHQ_LITERAL(_MiB_per_s),
+      PHQ_LITERAL(_Gb_per_s),
+      PHQ_LITERAL(_Gib_per_s),
+      PHQ_LITERAL(_GB_per_s),
+      PHQ_LITERAL(_GiB_per_s),
+      PHQ_LITERAL(_Tb_per_s),
+      PHQ_LITERAL(_Tib_per_s),
+      PHQ_LITERAL(_TB_per_s),
+      PHQ_LITERAL(_TiB_per_s),
+      PHQ_LITERAL(_Pb_per_s),
+      PHQ_LITERAL(_Pib_per_s),
+      PHQ_LITERAL(_PB_per_s),
+      PHQ_LITERAL(_PiB_per_s),
+      PHQ_LITERAL(_b_per_min),
+      PHQ_LITERAL(_B_per_min),
+      PHQ_LITERAL(_kb_per_min),
+      PHQ_LITERAL(_kib_per_min),
+      PHQ_LITERAL(_kB_per_min),
+      PHQ_LITERAL(_kiB_per_min),
+      PHQ_LITERAL(_Mb_per_min),
+      PHQ_LITERAL(_Mib_per_min),
+      PHQ_LITERAL(_MB_per_min),
+      PHQ_LITERAL(_MiB_per_min),
+      PHQ_LITERAL(_Gb_per_min),
+      PHQ_LITERAL(_Gib_per_min),
+      PHQ_LITERAL(_GB_per_min),
+      PHQ_LITERAL(_GiB_per_min),
+      PHQ_LITERAL(_Tb_per_min),
+      PHQ_LITERAL(_Tib_per_min),
+      PHQ_LITERAL(_TB_per_min),
+      PHQ_LITERAL(_TiB_per_min),
+      PHQ_LITERAL(_Pb_per_min),
+      PHQ_LITERAL(_Pib_per_min),
+      PHQ_LITERAL(_PB_per_min),
+      PHQ_LITERAL(_PiB_per_min),
+      PHQ_LITERAL(_b_per_hr),
+      PHQ_LITERAL(_B_per_hr),
+      PHQ_LITERAL(_kb_per_hr),
+      PHQ_LITERAL(_kib_per_hr),
+      PHQ_LITERAL(_kB_per_hr),
+      PHQ_LITERAL(_kiB_per_hr),
+      PHQ_LITERAL(_Mb_per_hr),
+      PHQ_LITERAL(_Mib_per_hr),
+      PHQ_LITERAL(_MB_per_hr),
+      PHQ_LITERAL(_MiB_per_hr),
+      PHQ_LITERAL(_Gb_per_hr),
+      PHQ_LITERAL(_Gib_per_hr),
+      PHQ_LITERAL(_GB_per_hr),
+      PHQ_LITERAL(_GiB_per_hr),
+      PHQ_LITERAL(_Tb_per_hr),
+      PHQ_LITERAL(_Tib_per_hr),
+      PHQ_LITERAL(_TB_per_hr),
+      PHQ_LITERAL(_TiB_per_hr),
+      PHQ_LITERAL(_Pb_per_hr),
+      PHQ_LITERAL(_Pib_per_hr),
+      PHQ_LITERAL(_PB_per_hr),
+      PHQ_LITERAL(_PiB_per_hr),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::Power>({
+      PHQ_LITERAL(_W),
+      PHQ_LITERAL(_mW),
+      PHQ_LITERAL(_uW),
+      PHQ_LITERAL(_nW),
+      PHQ_LITERAL(_kW),
+      PHQ_LITERAL(_MW),
+      PHQ_LITERAL(_GW),
+      PHQ_LITERAL(_ft_lbf_per_s),
+      PHQ_LITERAL(_in_lbf_per_s),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::Pressure>({
+      PHQ_LITERAL(_Pa),
+      PHQ_LITERAL(_kPa),
+      PHQ_LITERAL(_MPa),
+      PHQ_LITERAL(_GPa),
+      PHQ_LITERAL(_bar),
+      PHQ_LITERAL(_atm),
+      PHQ_LITERAL(_lbf_per_ft2),
+      PHQ_LITERAL(_lbf_per_in2),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::SolidAngle>({
+      PHQ_LITERAL(_sr),
+      PHQ_LITERAL(_deg2),
+      PHQ_LITERAL(_arcmin2),
+      PHQ_LITERAL(_arcsec2),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::SpecificEnergy>({
+      PHQ_LITERAL(_J_per_kg),
+      PHQ_LITERAL(_nJ_per_g),
+      PHQ_LITERAL(_ft_lbf_per_slug),
+      PHQ_LITERAL(_in_lbf_per_slinch),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::SpecificHeatCapacity>({
+      PHQ_LITERAL(_J_per_kg_per_K),
+      PHQ_LITERAL(_nJ_per_g_per_K),
+      PHQ_LITERAL(_ft_lbf_per_slug_per_degR),
+      PHQ_LITERAL(_in_lbf_per_slinch_per_degR),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::SpecificPower>({
+      PHQ_LITERAL(_W_per_kg),
+      PHQ_LITERAL(_nW_per_g),
+      PHQ_LITERAL(_ft_lbf_per_slug_per_s),
+      PHQ_LITERAL(_in_lbf_per_slinch_per_s),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::Speed>({
+      PHQ_LITERAL(_nmi_per_s),
+      PHQ_LITERAL(_nmi_per_min),
+      PHQ_LITERAL(_kn),
+      PHQ_LITERAL(_mi_per_s),
+      PHQ_LITERAL(_mi_per_min),
+      PHQ_LITERAL(_mi_per_hr),
+      PHQ_LITERAL(_km_per_s),
+      PHQ_LITERAL(_km_per_min),
+      PHQ_LITERAL(_km_per_hr),
+      PHQ_LITERAL(_m_per_s),
+      PHQ_LITERAL(_m_per_min),
+      PHQ_LITERAL(_m_per_hr),
+      PHQ_LITERAL(_yd_per_s),
+      PHQ_LITERAL(_yd_per_min),
+      PHQ_LITERAL(_yd_per_hr),
+      PHQ_LITERAL(_ft_per_s),
+      PHQ_LITERAL(_ft_per_min),
+      PHQ_LITERAL(_ft_per_hr),
+      PHQ_LITERAL(_dm_per_s),
+      PHQ_LITERAL(_dm_per_min),
+      PHQ_LITERAL(_dm_per_hr),
+      PHQ_LITERAL(_in_per_s),
+      PHQ_LITERAL(_in_per_min),
+      PHQ_LITERAL(_in_per_hr),
+      PHQ_LITERAL(_cm_per_s),
+      PHQ_LITERAL(_cm_per_min),
+      PHQ_LITERAL(_cm_per_hr),
+      PHQ_LITERAL(_mm_per_s),
+      PHQ_LITERAL(_mm_per_min),
+      PHQ_LITERAL(_mm_per_hr),
+      PHQ_LITERAL(_mil_per_s),
+      PHQ_LITERAL(_mil_per_min),
+      PHQ_LITERAL(_mil_per_hr),
+      PHQ_LITERAL(_um_per_s),
+      PHQ_LITERAL(_um_per_min),
+      PHQ_LITERAL(_um_per_hr),
+      PHQ_LITERAL(_uin_per_s),
+      PHQ_LITERAL(_uin_per_min),
+      PHQ_LITERAL(_uin_per_hr),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::SubstanceAmount>({
+      PHQ_LITERAL(_mol),
+      PHQ_LITERAL(_kmol),
+      PHQ_LITERAL(_Mmol),
+      PHQ_LITERAL(_Gmol),
+      PHQ_LITERAL(_particles),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::Temperature>({
+      PHQ_LITERAL(_K),
+      PHQ_LITERAL(_degC),
+      PHQ_LITERAL(_degR),
+      PHQ_LITERAL(_degF),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::TemperatureGradient>({
+      PHQ_LITERAL(_K_per_m),
+      PHQ_LITERAL(_K_per_mm),
+      PHQ_LITERAL(_degC_per_m),
+      PHQ_LITERAL(_degC_per_mm),
+      PHQ_LITERAL(_degR_per_ft),
+      PHQ_LITERAL(_degR_per_in),
+      PHQ_LITERAL(_degF_per_ft),
+      PHQ_LITERAL(_degF_per_in),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::ThermalConductivity>({
+      PHQ_LITERAL(_W_per_m_per_K),
+      PHQ_LITERAL(_nW_per_mm_per_K),
+      PHQ_LITERAL(_lbf_per_s_per_degR),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::ThermalExpansion>({
+      PHQ_LITERAL(_per_K),
+      PHQ_LITERAL(_per_degC),
+      PHQ_LITERAL(_per_degR),
+      PHQ_LITERAL(_per_degF),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::Time>({
+      PHQ_LITERAL(_ns),
+      PHQ_LITERAL(_us),
+      PHQ_LITERAL(_ms),
+      PHQ_LITERAL(_s),
+      PHQ_LITERAL(_min),
+      PHQ_LITERAL(_hr),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::TransportEnergyConsumption>({
+      PHQ_LITERAL(_J_per_mi),
+      PHQ_LITERAL(_J_per_km),
+      PHQ_LITERAL(_J_per_m),
+      PHQ_LITERAL(_nJ_per_mm),
+      PHQ_LITERAL(_kJ_per_mi),
+      PHQ_LITERAL(_W_min_per_mi),
+      PHQ_LITERAL(_W_hr_per_mi),
+      PHQ_LITERAL(_W_min_per_km),
+      PHQ_LITERAL(_W_hr_per_km),
+      PHQ_LITERAL(_W_min_per_m),
+      PHQ_LITERAL(_W_hr_per_m),
+      PHQ_LITERAL(_kW_min_per_mi),
+      PHQ_LITERAL(_kW_hr_per_mi),
+      PHQ_LITERAL(_kW_min_per_km),
+      PHQ_LITERAL(_kW_hr_per_km),
+      PHQ_LITERAL(_kW_min_per_m),
+      PHQ_LITERAL(_kW_hr_per_m),
+      PHQ_LITERAL(_ft_lbf_per_ft),
+      PHQ_LITERAL(_in_lbf_per_in),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::Volume>({
+      PHQ_LITERAL(_nmi3),
+      PHQ_LITERAL(_mi3),
+      PHQ_LITERAL(_km3),
+      PHQ_LITERAL(_m3),
+      PHQ_LITERAL(_yd3),
+      PHQ_LITERAL(_ft3),
+      PHQ_LITERAL(_dm3),
+      PHQ_LITERAL(_L),
+      PHQ_LITERAL(_in3),
+      PHQ_LITERAL(_cm3),
+      PHQ_LITERAL(_mL),
+      PHQ_LITERAL(_mm3),
+      PHQ_LITERAL(_mil3),
+      PHQ_LITERAL(_um3),
+      PHQ_LITERAL(_uin3),
+  });
+
+  ExpectOneLiteralPerUnit<Unit::VolumeRate>({
+      PHQ_LITERAL(_nmi3_per_s),
+      PHQ_LITERAL(_mi3_per_s),
+      PHQ_LITERAL(_km3_per_s),
+      PHQ_LITERAL(_m3_per_s),
+      PHQ_LITERAL(_yd3_per_s),
+      PHQ_LITERAL(_ft3_per_s),
+      PHQ_LITERAL(_dm3_per_s),
+      PHQ_LITERAL(_L_per_s),
+      PHQ_LITERAL(_in3_per_s),
+      PHQ_LITERAL(_cm3_per_s),
+      PHQ_LITERAL(_mL_per_s),
+      PHQ_LITERAL(_mm3_per_s),
+      PHQ_LITERAL(_mil3_per_s),
+      PHQ_LITERAL(_um3_per_s),
+      PHQ_LITERAL(_uin3_per_s),
+      PHQ_LITERAL(_nmi3_per_min),
+      PHQ_LITERAL(_mi3_per_min),
+      PHQ_LITERAL(_km3_per_min),
+      PHQ_LITERAL(_m3_per_min),
+      PHQ_LITERAL(_yd3_per_min),
+      PHQ_LITERAL(_ft3_per_min),
+      PHQ_LITERAL(_dm3_per_min),
+      PHQ_LITERAL(_L_per_min),
+      PHQ_LITERAL(_in3_per_min),
+      PHQ_LITERAL(_cm3_per_min),
+      PHQ_LITERAL(_mL_per_min),
+      PHQ_LITERAL(_mm3_per_min),
+      PHQ_LITERAL(_mil3_per_min),
+      PHQ_LITERAL(_um3_per_min),
+      PHQ_LITERAL(_uin3_per_min),
+      PHQ_LITERAL(_nmi3_per_hr),
+      PHQ_LITERAL(_mi3_per_hr),
+      PHQ_LITERAL(_km3_per_hr),
+      PHQ_LITERAL(_m3_per_hr),
+      PHQ_LITERAL(_yd3_per_hr),
+      PHQ_LITERAL(_ft3_per_hr),
+      PHQ_LITERAL(_dm3_per_hr),
+      PHQ_LITERAL(_L_per_hr),
+      PHQ_LITERAL(_in3_per_hr),
+      PHQ_LITERAL(_cm3_per_hr),
+      PHQ_LITERAL(_mL_per_hr),
+      PHQ_LITERAL(_mm3_per_hr),
+      PHQ_LITERAL(_mil3_per_hr),
+      PHQ_LITERAL(_um3_per_hr),
+      PHQ_LITERAL(_uin3_per_hr),
+  });
+}
+
+TEST(Literals, FloatingPoint) {
+  EXPECT_EQ(Length<>(12.5_km), Length(12.5, Unit::Length::Kilometre));
+  EXPECT_EQ(Length<>(1.5_mm), Length(1.5, Unit::Length::Millimetre));
+  EXPECT_DOUBLE_EQ(Speed<>(36.0_km_per_hr).Value(), 10.0);
+  EXPECT_DOUBLE_EQ(ScalarAcceleration<>(9.81_m_per_s2).Value(), 9.81);
+  EXPECT_DOUBLE_EQ(Temperature<>(20.0_degC).Value(), 293.15);
+  EXPECT_DOUBLE_EQ(Temperature<>(32.0_degF).Value(), 273.15);
+}
+
+TEST(Literals, Integer) {
+  EXPECT_EQ(Length<>(12_km), Length(12.0, Unit::Length::Kilometre));
+  EXPECT_EQ(Memory<>(1_kiB), Memory(1.0, Unit::Memory::Kibibyte));
+  EXPECT_EQ(Time<>(90_s), Time(1.5, Unit::Time::Minute));
+}
+
+TEST(Literals, MultipleQuantitiesOfTheSameUnitType) {
+  EXPECT_EQ(StaticPressure<>(3.0_MPa), StaticPressure(3.0, Unit::Pressure::Megapascal));
+  EXPECT_EQ(ScalarStress<>(3.0_MPa), ScalarStress(3.0, Unit::Pressure::Megapascal));
+}
+
+TEST(Literals, Negation) {
+  EXPECT_EQ(Length<>(-12.5_km), Length(-12.5, Unit::Length::Kilometre));
+  EXPECT_EQ(Length<>(+12.5_km), Length(12.5, Unit::Length::Kilometre));
+  EXPECT_DOUBLE_EQ(Temperature<>(-40.0_degC).Value(), 233.15);
+  EXPECT_DOUBLE_EQ(Temperature<>(-40.0_degF).Value(Unit::Temperature::Celsius), -40.0);
+}
+
+TEST(Literals, NumericType) {
+  const Length<float> length = 12.5_km;
+  EXPECT_EQ(length, Length<float>(12.5F, Unit::Length::Kilometre));
+  const Length<long double> long_length = 0.1_mm;
+  EXPECT_EQ(long_length.Value(), 0.1L * 0.001L);
+}
+
+TEST(Literals, Operations) {
+  const Length<> length = Length(1.0, Unit::Length::Kilometre) + 500.0_m;
+  EXPECT_EQ(length, Length(1500.0, Unit::Length::Metre));
+  const Speed<> speed = Length<>(100_m) / Time<>(20_s);
+  EXPECT_EQ(speed, Speed(5.0, Unit::Speed::MetrePerSecond));
+}
+
+TEST(Literals, Unit) {
+  EXPECT_EQ((12.5_km).Unit(), Unit::Length::Kilometre);
+  EXPECT_EQ((3.0_MPa).Unit(), Unit::Pressure::Megapascal);
+  EXPECT_EQ((20.0_degC).Unit(), Unit::Temperature::Celsius);
+}
+
+TEST(Literals, Value) {
+  EXPECT_EQ((12.5_km).Value(), 12.5L);
+  EXPECT_EQ((3_MPa).Value(), 3.0L);
+  EXPECT_EQ((-20.0_degC).Value(), -20.0L);
+}
+
+#undef PHQ_LITERAL
+
+}  // namespace
+
+}  // namespace PhQ
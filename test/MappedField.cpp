@@ -0,0 +1,262 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/MappedField.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "../include/PhQ/Force.hpp"
+#include "../include/PhQ/Stress.hpp"
+#include "../include/PhQ/Velocity.hpp"
+
+namespace PhQ {
+
+namespace {
+
+const std::vector<Stress<>> stresses{
+    Stress<>({1.0, -2.0, 3.0, -4.0, 5.0, -6.0}, Unit::Pressure::Pascal),
+    Stress<>({0.125, 1000.0, -0.5, 2.5, -7.0, 8.0}, Unit::Pressure::Kilopascal),
+    Stress<>({9.0, 10.0, -11.0, 12.0, 13.0, -14.0}, Unit::Pressure::Megapascal),
+};
+
+std::string TemporaryPath(const std::string& name) {
+  return ::testing::TempDir() + "PhQ_MappedField_" + name + ".phqf";
+}
+
+// Temporary field file that is removed when this object goes out of scope. Declare it before any
+// field that maps it so that the field is unmapped before the file is removed.
+class TemporaryFile {
+public:
+  explicit TemporaryFile(const std::string& name) : path_(TemporaryPath(name)) {}
+
+  TemporaryFile(const TemporaryFile& other) = delete;
+
+  TemporaryFile& operator=(const TemporaryFile& other) = delete;
+
+  ~TemporaryFile() {
+    std::error_code error;
+    std::filesystem::remove(path_, error);
+  }
+
+  [[nodiscard]] const std::string& Path() const noexcept {
+    return path_;
+  }
+
+private:
+  std::string path_;
+};
+
+void WriteBytes(const std::string& path, const std::vector<char>& bytes) {
+  std::ofstream file{path, std::ios::binary | std::ios::trunc};
+  file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+
+std::vector<char> ReadBytes(const std::string& path) {
+  std::ifstream file{path, std::ios::binary};
+  return {std::istreambuf_iterator<char>{file}, std::istreambuf_iterator<char>{}};
+}
+
+TEST(MappedField, Empty) {
+  const TemporaryFile file{"Empty"};
+  const std::string& path{file.Path()};
+  EXPECT_EQ(WriteMappedField(path, std::vector<Stress<>>{}), MappedFieldError::None);
+  const MappedField<Stress<>> field{path};
+  EXPECT_TRUE(field.Good());
+  EXPECT_TRUE(field.Empty());
+  EXPECT_EQ(field.Size(), 0);
+  EXPECT_EQ(field.begin(), field.end());
+}
+
+TEST(MappedField, ErrorCannotOpenFile) {
+  const MappedField<Stress<>> field{TemporaryPath("DoesNotExist")};
+  EXPECT_EQ(field.Error(), MappedFieldError::CannotOpenFile);
+  EXPECT_FALSE(field.Good());
+  EXPECT_TRUE(field.Empty());
+  EXPECT_EQ(field.Data(), nullptr);
+}
+
+TEST(MappedField, ErrorComponentCountMismatch) {
+  const TemporaryFile file{"ComponentCountMismatch"};
+  const std::string& path{file.Path()};
+  WriteMappedField(path, std::vector{Velocity<>({1.0, 2.0, 3.0}, Unit::Speed::MetrePerSecond)});
+  const MappedField<Stress<>> field{path};
+  EXPECT_EQ(field.Error(), MappedFieldError::ComponentCountMismatch);
+  EXPECT_TRUE(field.Empty());
+}
+
+TEST(MappedField, ErrorDimensionsMismatch) {
+  const TemporaryFile file{"DimensionsMismatch"};
+  const std::string& path{file.Path()};
+  WriteMappedField(path, std::vector{Force<>({1.0, 2.0, 3.0}, Unit::Force::Newton)});
+  const MappedField<Velocity<>> field{path};
+  EXPECT_EQ(field.Error(), MappedFieldError::DimensionsMismatch);
+  EXPECT_TRUE(field.Empty());
+}
+
+TEST(MappedField, ErrorNotAFieldFile) {
+  const TemporaryFile file{"NotAFieldFile"};
+  const std::string& path{file.Path()};
+  WriteBytes(path, std::vector<char>(MappedFieldHeaderSize, 'x'));
+  const MappedField<Stress<>> field{path};
+  EXPECT_EQ(field.Error(), MappedFieldError::NotAFieldFile);
+}
+
+TEST(MappedField, ErrorNumericTypeMismatch) {
+  const TemporaryFile file{"NumericTypeMismatch"};
+  const std::string& path{file.Path()};
+  WriteMappedField(path, std::vector<Stress<float>>{Stress<float>::Zero()});
+  const MappedField<Stress<double>> field{path};
+  EXPECT_EQ(field.Error(), MappedFieldError::NumericTypeMismatch);
+}
+
+TEST(MappedField, ErrorPayloadSizeMismatch) {
+  const TemporaryFile file{"PayloadSizeMismatch"};
+  const std::string& path{file.Path()};
+  WriteMappedField(path, stresses);
+  std::vector<char> bytes{ReadBytes(path)};
+  bytes.pop_back();
+  WriteBytes(path, bytes);
+  const MappedField<Stress<>> truncated{path};
+  EXPECT_EQ(truncated.Error(), MappedFieldError::PayloadSizeMismatch);
+
+  bytes.resize(bytes.size() - sizeof(Stress<>) + 1);
+  WriteBytes(path, bytes);
+  const MappedField<Stress<>> shorter{path};
+  EXPECT_EQ(shorter.Error(), MappedFieldError::PayloadSizeMismatch);
+}
+
+TEST(MappedField, ErrorTruncatedHeader) {
+  const TemporaryFile file{"TruncatedHeader"};
+  const std::string& path{file.Path()};
+  WriteBytes(path, {'P', 'h', 'Q', 'F'});
+  const MappedField<Stress<>> field{path};
+  EXPECT_EQ(field.Error(), MappedFieldError::TruncatedHeader);
+  WriteBytes(path, {});
+  const MappedField<Stress<>> empty_file{path};
+  EXPECT_EQ(empty_file.Error(), MappedFieldError::TruncatedHeader);
+}
+
+TEST(MappedField, ErrorUnsupportedVersion) {
+  const TemporaryFile file{"UnsupportedVersion"};
+  const std::string& path{file.Path()};
+  WriteMappedField(path, stresses);
+  std::vector<char> bytes{ReadBytes(path)};
+  bytes[4] = static_cast<char>(BinaryFormatVersion + 1);
+  WriteBytes(path, bytes);
+  const MappedField<Stress<>> field{path};
+  EXPECT_EQ(field.Error(), MappedFieldError::UnsupportedVersion);
+}
+
+TEST(MappedField, Header) {
+  const TemporaryFile file{"Header"};
+  const std::string& path{file.Path()};
+  EXPECT_EQ(WriteMappedField(path, stresses, Unit::Pressure::Kilopascal), MappedFieldError::None);
+  const std::vector<char> bytes{ReadBytes(path)};
+  ASSERT_EQ(bytes.size(), MappedFieldHeaderSize + stresses.size() * 6 * sizeof(double));
+  EXPECT_EQ(std::string(bytes.data(), 4), "PhQF");
+  std::array<std::byte, BinaryHeaderSize> binary_header;
+  std::memcpy(binary_header.data(), bytes.data() + 4, BinaryHeaderSize);
+  const BinaryHeader header{BinaryHeader::Read(binary_header.data())};
+  EXPECT_EQ(header.version, BinaryFormatVersion);
+  EXPECT_EQ(header.numeric_size, sizeof(double));
+  EXPECT_EQ(header.component_count, 6);
+  EXPECT_EQ(header.unit, static_cast<std::uint8_t>(Unit::Pressure::Kilopascal));
+  EXPECT_EQ(header.dimensions, RelatedDimensions<Unit::Pressure>);
+  EXPECT_EQ(bytes[16], 3);
+  for (std::size_t index = 17; index < MappedFieldHeaderSize; ++index) {
+    EXPECT_EQ(bytes[index], 0);
+  }
+}
+
+TEST(MappedField, Move) {
+  const TemporaryFile file{"Move"};
+  const std::string& path{file.Path()};
+  WriteMappedField(path, stresses);
+  MappedField<Stress<>> first{path};
+  const Stress<>* const data{first.Data()};
+  MappedField<Stress<>> second{std::move(first)};
+  EXPECT_EQ(second.Data(), data);
+  EXPECT_EQ(second.Size(), stresses.size());
+  MappedField<Stress<>> third{TemporaryPath("DoesNotExist")};
+  third = std::move(second);
+  EXPECT_TRUE(third.Good());
+  EXPECT_EQ(third.Data(), data);
+  EXPECT_EQ(third[2], stresses[2]);
+}
+
+TEST(MappedField, RoundTrip) {
+  const TemporaryFile file{"RoundTrip"};
+  const std::string& path{file.Path()};
+  EXPECT_EQ(WriteMappedField(path, stresses), MappedFieldError::None);
+  const MappedField<Stress<>> field{path};
+  ASSERT_TRUE(field.Good());
+  EXPECT_EQ(field.Unit(), Unit::Pressure::Pascal);
+  EXPECT_EQ(field.Size(), stresses.size());
+  EXPECT_TRUE(field.IsDirect());
+  ASSERT_NE(field.Data(), nullptr);
+  for (std::size_t index = 0; index < stresses.size(); ++index) {
+    EXPECT_EQ(field.Data()[index], stresses[index]);
+    EXPECT_EQ(field[index], stresses[index]);
+  }
+  const std::vector<Stress<>> copied{field.begin(), field.end()};
+  EXPECT_EQ(copied, stresses);
+}
+
+TEST(MappedField, RoundTripUnit) {
+  const TemporaryFile file{"RoundTripUnit"};
+  const std::string& path{file.Path()};
+  EXPECT_EQ(WriteMappedField(path, stresses, Unit::Pressure::Kilopascal), MappedFieldError::None);
+  const MappedField<Stress<>> field{path};
+  ASSERT_TRUE(field.Good());
+  EXPECT_EQ(field.Unit(), Unit::Pressure::Kilopascal);
+  EXPECT_FALSE(field.IsDirect());
+  EXPECT_EQ(field.Data(), nullptr);
+  std::size_t index{0};
+  for (const Stress<>& stress : field) {
+    EXPECT_DOUBLE_EQ(stress.Value().xx(), stresses[index].Value().xx());
+    EXPECT_DOUBLE_EQ(stress.Value().yz(), stresses[index].Value().yz());
+    ++index;
+  }
+  EXPECT_EQ(index, stresses.size());
+  std::array<Stress<>, 2> read{Stress<>::Zero(), Stress<>::Zero()};
+  field.Read(1, 2, read.data());
+  EXPECT_DOUBLE_EQ(read[0].Value().xy(), stresses[1].Value().xy());
+  EXPECT_DOUBLE_EQ(read[1].Value().zz(), stresses[2].Value().zz());
+  EXPECT_DOUBLE_EQ(field[2].Value().zz(), stresses[2].Value().zz());
+}
+
+}  // namespace
+
+}  // namespace PhQ
@@ -0,0 +1,143 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/Parallel.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "../include/PhQ/Unit/Length.hpp"
+
+namespace PhQ {
+
+namespace {
+
+// Verifies that every value of a sequence is processed exactly once for a given number of threads.
+void TestParallelForEachChunk(const std::size_t size, const std::size_t thread_count) {
+  std::vector<double> values(size, 0.0);
+  Internal::ParallelForEachChunk(values.data(), size, thread_count,
+                                 [](double* const chunk_values, const std::size_t chunk_size) {
+                                   for (std::size_t index = 0; index < chunk_size; ++index) {
+                                     chunk_values[index] += 1.0;
+                                   }
+                                 });
+  for (const double value : values) {
+    ASSERT_EQ(value, 1.0);
+  }
+}
+
+// Length of a sequence of double-precision values that is long enough to be processed in parallel
+// and that does not divide evenly into chunks.
+constexpr std::size_t LongSize{
+    Internal::MinimumSizeInBytesForParallel / sizeof(double) * 3 + 12345};
+
+TEST(Parallel, ConvertInPlaceExecutionPolicy) {
+  std::vector<double> sequential(LongSize);
+  for (std::size_t index = 0; index < LongSize; ++index) {
+    sequential[index] = static_cast<double>(index) * 0.5;
+  }
+  std::vector<double> parallel{sequential};
+  ConvertInPlace(sequential, Unit::Length::Foot, Unit::Length::Metre, ExecutionPolicy::Sequential);
+  ConvertInPlace(parallel, Unit::Length::Foot, Unit::Length::Metre, ExecutionPolicy::Parallel);
+  EXPECT_EQ(parallel, sequential);
+}
+
+TEST(Parallel, ConvertInPlaceThreadCount) {
+  std::vector<double> expected(LongSize);
+  for (std::size_t index = 0; index < LongSize; ++index) {
+    expected[index] = static_cast<double>(index) * 0.5;
+  }
+  std::vector<double> reference{expected};
+  ConvertInPlace(expected, Unit::Length::Mile, Unit::Length::Kilometre);
+  for (const std::size_t thread_count : {0, 1, 2, 3, 4, 8}) {
+    std::vector<double> values{reference};
+    ConvertInPlace(values, Unit::Length::Mile, Unit::Length::Kilometre, thread_count);
+    EXPECT_EQ(values, expected);
+
+    std::vector<double> buffer{reference};
+    ConvertInPlace(buffer.data(), buffer.size(), Unit::Length::Mile, Unit::Length::Kilometre,
+                   thread_count);
+    EXPECT_EQ(buffer, expected);
+  }
+}
+
+TEST(Parallel, ConvertInPlaceRawBuffer) {
+  std::vector<float> values{1.0F, 2.0F, 3.0F};
+  ConvertInPlace(values.data(), values.size(), Unit::Length::Kilometre, Unit::Length::Metre);
+  EXPECT_FLOAT_EQ(values[0], 1000.0F);
+  EXPECT_FLOAT_EQ(values[1], 2000.0F);
+  EXPECT_FLOAT_EQ(values[2], 3000.0F);
+}
+
+TEST(Parallel, ParallelForEachChunk) {
+  for (const std::size_t thread_count : {0, 1, 2, 3, 7}) {
+    TestParallelForEachChunk(0, thread_count);
+    TestParallelForEachChunk(1, thread_count);
+    TestParallelForEachChunk(1000, thread_count);
+    TestParallelForEachChunk(LongSize, thread_count);
+  }
+}
+
+TEST(Parallel, ParallelForEachChunkShortSequenceIsSequential) {
+  const std::thread::id caller{std::this_thread::get_id()};
+  std::vector<double> values(1000, 0.0);
+  std::size_t calls{0};
+  Internal::ParallelForEachChunk(
+      values.data(), values.size(), 8,
+      [&caller, &calls](double* const /*chunk_values*/, const std::size_t chunk_size) {
+        EXPECT_EQ(std::this_thread::get_id(), caller);
+        EXPECT_EQ(chunk_size, 1000);
+        ++calls;
+      });
+  EXPECT_EQ(calls, 1);
+}
+
+TEST(Parallel, ParallelForEachChunkChunkSizes) {
+  std::mutex mutex;
+  std::vector<std::thread::id> thread_ids;
+  std::vector<double> values(LongSize, 0.0);
+  Internal::ParallelForEachChunk(
+      values.data(), values.size(), 4,
+      [&mutex, &thread_ids](double* const /*chunk_values*/, const std::size_t chunk_size) {
+        EXPECT_LE(chunk_size * sizeof(double), Internal::ParallelChunkSizeInBytes);
+        const std::lock_guard<std::mutex> lock{mutex};
+        thread_ids.push_back(std::this_thread::get_id());
+      });
+  EXPECT_EQ(thread_ids.size(),
+            (LongSize * sizeof(double) + Internal::ParallelChunkSizeInBytes - 1)
+                / Internal::ParallelChunkSizeInBytes);
+}
+
+TEST(Parallel, ThreadCount) {
+  EXPECT_EQ(Internal::ThreadCount(ExecutionPolicy::Sequential), 1);
+  EXPECT_EQ(Internal::ThreadCount(ExecutionPolicy::Parallel), Internal::HardwareThreadCount());
+  EXPECT_GE(Internal::HardwareThreadCount(), 1);
+}
+
+}  // namespace
+
+}  // namespace PhQ
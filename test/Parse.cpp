@@ -0,0 +1,236 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/Parse.hpp"
+
+#include <gtest/gtest.h>
+#include <optional>
+#include <string>
+
+#include "../include/PhQ/PlanarVelocity.hpp"
+#include "../include/PhQ/Speed.hpp"
+#include "../include/PhQ/StaticPressure.hpp"
+#include "../include/PhQ/Stress.hpp"
+#include "../include/PhQ/Temperature.hpp"
+#include "../include/PhQ/Velocity.hpp"
+#include "../include/PhQ/VelocityGradient.hpp"
+
+namespace PhQ {
+
+namespace {
+
+TEST(Parse, Dyad) {
+  const ParseResult<VelocityGradient<>> result{
+      Parse<VelocityGradient<>>("(1, 2, 3; 4, 5, 6; 7, 8, 9) kHz")};
+  EXPECT_EQ(result.error, ParseError::None);
+  EXPECT_EQ(result.position, 0);
+  ASSERT_TRUE(result.quantity.has_value());
+  EXPECT_EQ(result.quantity.value(),
+            VelocityGradient<>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0},
+                               Unit::Frequency::Kilohertz));
+}
+
+TEST(Parse, ErrorInvalidNumber) {
+  EXPECT_EQ(Parse<Speed<>>("").error, ParseError::InvalidNumber);
+  EXPECT_EQ(Parse<Speed<>>("  m/s").error, ParseError::InvalidNumber);
+  EXPECT_EQ(Parse<Speed<>>("  m/s").position, 2);
+  EXPECT_EQ(Parse<Velocity<>>("(1, x, 3) m/s").error, ParseError::InvalidNumber);
+  EXPECT_EQ(Parse<Velocity<>>("(1, x, 3) m/s").position, 4);
+  EXPECT_FALSE(Parse<Speed<>>("").quantity.has_value());
+}
+
+TEST(Parse, ErrorMissingClosingParenthesis) {
+  EXPECT_EQ(Parse<Velocity<>>("(1, 2, 3 m/s").error, ParseError::MissingClosingParenthesis);
+  EXPECT_EQ(Parse<Velocity<>>("(1, 2, 3 m/s").position, 9);
+  EXPECT_EQ(Parse<Velocity<>>("(1, 2, 3, 4) m/s").error, ParseError::MissingClosingParenthesis);
+}
+
+TEST(Parse, ErrorMissingOpeningParenthesis) {
+  EXPECT_EQ(Parse<Velocity<>>("1, 2, 3) m/s").error, ParseError::MissingOpeningParenthesis);
+  EXPECT_EQ(Parse<Velocity<>>(" 1, 2, 3) m/s").position, 1);
+  EXPECT_EQ(Parse<Velocity<>>("").error, ParseError::MissingOpeningParenthesis);
+}
+
+TEST(Parse, ErrorMissingSeparator) {
+  EXPECT_EQ(Parse<Velocity<>>("(1 2 3) m/s").error, ParseError::MissingSeparator);
+  EXPECT_EQ(Parse<Velocity<>>("(1 2 3) m/s").position, 3);
+  EXPECT_EQ(Parse<Velocity<>>("(1, 2) m/s").error, ParseError::MissingSeparator);
+}
+
+TEST(Parse, ErrorMissingUnit) {
+  EXPECT_EQ(Parse<Speed<>>("12.5").error, ParseError::MissingUnit);
+  EXPECT_EQ(Parse<Speed<>>("12.5").position, 4);
+  EXPECT_EQ(Parse<Speed<>>("12.5   ").error, ParseError::MissingUnit);
+  EXPECT_EQ(Parse<Velocity<>>("(1, 2, 3)").error, ParseError::MissingUnit);
+}
+
+TEST(Parse, ErrorNumberOutOfRange) {
+  EXPECT_EQ(Parse<Speed<>>("1.0e1000000 m/s").error, ParseError::NumberOutOfRange);
+  EXPECT_EQ(Parse<Speed<float>>("1.0e100 m/s").error, ParseError::NumberOutOfRange);
+  EXPECT_EQ(Parse<Speed<float>>("1.0e100 m/s").position, 0);
+}
+
+TEST(Parse, ErrorUnexpectedToken) {
+  EXPECT_EQ(ParseJSON<Speed<>>("").error, ParseError::UnexpectedToken);
+  EXPECT_EQ(ParseJSON<Speed<>>(R"({"unit":"m/s","value":1})").error, ParseError::UnexpectedToken);
+  EXPECT_EQ(ParseJSON<Speed<>>(R"({"unit":"m/s","value":1})").position, 1);
+  EXPECT_EQ(ParseJSON<Speed<>>(R"({"value":1,"unit":"m/s")").error, ParseError::UnexpectedToken);
+  EXPECT_EQ(ParseJSON<Speed<>>(R"({"value":1,"unit":"m/s)").error, ParseError::UnexpectedToken);
+  EXPECT_EQ(ParseJSON<Speed<>>(R"({"value":1,"unit":"m/s"} x)").error, ParseError::UnexpectedToken);
+  EXPECT_EQ(ParseJSON<Speed<>>(R"({"value":1,"unit":"m/s"} x)").position, 25);
+  EXPECT_EQ(ParseJSON<Velocity<>>(R"({"value":{"x":1,"z":3,"y":2},"unit":"m/s"})").error,
+            ParseError::UnexpectedToken);
+  EXPECT_EQ(ParseXML<Velocity<>>("<value><x>1</x><y>2</y><z>3</z><unit>m/s</unit>").error,
+            ParseError::UnexpectedToken);
+  EXPECT_EQ(ParseYAML<Speed<>>("{value:1,unit:m/s}").error, ParseError::UnexpectedToken);
+}
+
+TEST(Parse, ErrorUnknownUnit) {
+  EXPECT_EQ(Parse<Speed<>>("12.5 kg").error, ParseError::UnknownUnit);
+  EXPECT_EQ(Parse<Speed<>>("12.5 kg").position, 5);
+  EXPECT_EQ(Parse<Speed<>>("12.5 m/s m/s").error, ParseError::UnknownUnit);
+  EXPECT_EQ(ParseJSON<Speed<>>(R"({"value":12.5,"unit":"kg"})").error, ParseError::UnknownUnit);
+  EXPECT_EQ(ParseJSON<Speed<>>(R"({"value":12.5,"unit":"kg"})").position, 22);
+  EXPECT_EQ(ParseXML<Speed<>>("<value>12.5</value><unit></unit>").error, ParseError::MissingUnit);
+}
+
+TEST(Parse, JSON) {
+  EXPECT_EQ(ParseJSON<Speed<>>(R"({"value":12.5,"unit":"km/hr"})").quantity,
+            std::optional{Speed<>(12.5, Unit::Speed::KilometrePerHour)});
+  EXPECT_EQ(ParseJSON<Speed<>>(" { \"value\" : 12.5 , \"unit\" : \"km/hr\" } \n").quantity,
+            std::optional{Speed<>(12.5, Unit::Speed::KilometrePerHour)});
+  const Temperature<> temperature{-40.0, Unit::Temperature::Celsius};
+  EXPECT_EQ(ParseJSON<Temperature<>>(temperature.JSON()).quantity, std::optional{temperature});
+  const PlanarVelocity<> planar_velocity{{1.5, -2.5}, Unit::Speed::MillimetrePerSecond};
+  EXPECT_EQ(ParseJSON<PlanarVelocity<>>(planar_velocity.JSON()).quantity,
+            std::optional{planar_velocity});
+  const Velocity<float> velocity{{1.0F, -2.0F, 3.0F}, Unit::Speed::MetrePerSecond};
+  EXPECT_EQ(ParseJSON<Velocity<float>>(velocity.JSON()).quantity, std::optional{velocity});
+  const Stress<> stress{{1.0, -2.0, 3.0, -4.0, 5.0, -6.0}, Unit::Pressure::Kilopascal};
+  EXPECT_EQ(ParseJSON<Stress<>>(stress.JSON()).quantity, std::optional{stress});
+  EXPECT_EQ(
+      ParseJSON<Stress<>>(
+          R"({"value":{"xx":1,"xy":2,"xz":3,"yy":4,"yz":5,"zz":6},"unit":"MPa"})")
+          .quantity,
+      std::optional{Stress<>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}, Unit::Pressure::Megapascal)});
+  const VelocityGradient<> velocity_gradient{
+      {1.0, -2.0, 3.0, -4.0, 5.0, -6.0, 7.0, -8.0, 9.0},
+      Unit::Frequency::Kilohertz
+  };
+  EXPECT_EQ(ParseJSON<VelocityGradient<>>(velocity_gradient.JSON()).quantity,
+            std::optional{velocity_gradient});
+}
+
+TEST(Parse, PlanarVector) {
+  const ParseResult<PlanarVelocity<>> result{Parse<PlanarVelocity<>>("(1.5,-2.5)mm/s")};
+  EXPECT_EQ(result.error, ParseError::None);
+  ASSERT_TRUE(result.quantity.has_value());
+  EXPECT_EQ(
+      result.quantity.value(), PlanarVelocity<>({1.5, -2.5}, Unit::Speed::MillimetrePerSecond));
+}
+
+TEST(Parse, Print) {
+  const Speed<> speed{-12.5, Unit::Speed::KilometrePerHour};
+  EXPECT_EQ(Parse<Speed<>>(speed.Print()).quantity, std::optional{speed});
+  const Stress<> stress{{1.0, -2.0, 3.0, -4.0, 5.0, -6.0}, Unit::Pressure::Kilopascal};
+  EXPECT_EQ(Parse<Stress<>>(stress.Print()).quantity, std::optional{stress});
+  const Velocity<float> velocity{{1.0F, -2.0F, 3.0F}, Unit::Speed::MetrePerSecond};
+  EXPECT_EQ(Parse<Velocity<float>>(velocity.Print()).quantity, std::optional{velocity});
+}
+
+TEST(Parse, Scalar) {
+  const ParseResult<Speed<>> result{Parse<Speed<>>("12.5 km/hr")};
+  EXPECT_EQ(result.error, ParseError::None);
+  EXPECT_EQ(result.position, 0);
+  ASSERT_TRUE(result.quantity.has_value());
+  EXPECT_EQ(result.quantity.value(), Speed<>(12.5, Unit::Speed::KilometrePerHour));
+
+  EXPECT_EQ(Parse<StaticPressure<>>("3e6 Pa").quantity,
+            std::optional{StaticPressure<>(3.0, Unit::Pressure::Megapascal)});
+  EXPECT_EQ(Parse<StaticPressure<>>("  +3e6Pa \n").quantity,
+            std::optional{StaticPressure<>(3.0e6, Unit::Pressure::Pascal)});
+  EXPECT_EQ(Parse<Temperature<>>("-40 °C").quantity,
+            std::optional{Temperature<>(-40.0, Unit::Temperature::Celsius)});
+  EXPECT_EQ(Parse<Speed<float>>("1.5 m/s").quantity,
+            std::optional{Speed<float>(1.5F, Unit::Speed::MetrePerSecond)});
+}
+
+TEST(Parse, SymmetricDyad) {
+  const ParseResult<Stress<>> result{Parse<Stress<>>("( 1 , 2 , 3 ; 4 , 5 ; 6 ) MPa")};
+  EXPECT_EQ(result.error, ParseError::None);
+  ASSERT_TRUE(result.quantity.has_value());
+  EXPECT_EQ(result.quantity.value(),
+            Stress<>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}, Unit::Pressure::Megapascal));
+}
+
+TEST(Parse, Vector) {
+  const ParseResult<Velocity<>> result{Parse<Velocity<>>("(1, 2, 3) m/s")};
+  EXPECT_EQ(result.error, ParseError::None);
+  ASSERT_TRUE(result.quantity.has_value());
+  EXPECT_EQ(result.quantity.value(), Velocity<>({1.0, 2.0, 3.0}, Unit::Speed::MetrePerSecond));
+}
+
+TEST(Parse, XML) {
+  EXPECT_EQ(ParseXML<Speed<>>("<value>12.5</value><unit>km/hr</unit>").quantity,
+            std::optional{Speed<>(12.5, Unit::Speed::KilometrePerHour)});
+  EXPECT_EQ(ParseXML<Speed<>>("<value> 12.5 </value> <unit> km/hr </unit>").quantity,
+            std::optional{Speed<>(12.5, Unit::Speed::KilometrePerHour)});
+  const PlanarVelocity<> planar_velocity{{1.5, -2.5}, Unit::Speed::MillimetrePerSecond};
+  EXPECT_EQ(ParseXML<PlanarVelocity<>>(planar_velocity.XML()).quantity,
+            std::optional{planar_velocity});
+  const Velocity<> velocity{{1.0, -2.0, 3.0}, Unit::Speed::MetrePerSecond};
+  EXPECT_EQ(ParseXML<Velocity<>>(velocity.XML()).quantity, std::optional{velocity});
+  const Stress<> stress{{1.0, -2.0, 3.0, -4.0, 5.0, -6.0}, Unit::Pressure::Kilopascal};
+  EXPECT_EQ(ParseXML<Stress<>>(stress.XML()).quantity, std::optional{stress});
+  const VelocityGradient<> velocity_gradient{
+      {1.0, -2.0, 3.0, -4.0, 5.0, -6.0, 7.0, -8.0, 9.0},
+      Unit::Frequency::Kilohertz
+  };
+  EXPECT_EQ(ParseXML<VelocityGradient<>>(velocity_gradient.XML()).quantity,
+            std::optional{velocity_gradient});
+}
+
+TEST(Parse, YAML) {
+  EXPECT_EQ(ParseYAML<Speed<>>(R"({value:12.5,unit:"km/hr"})").quantity,
+            std::optional{Speed<>(12.5, Unit::Speed::KilometrePerHour)});
+  EXPECT_EQ(ParseYAML<Speed<>>(R"({ value: 12.5, unit: "km/hr" })").quantity,
+            std::optional{Speed<>(12.5, Unit::Speed::KilometrePerHour)});
+  const PlanarVelocity<> planar_velocity{{1.5, -2.5}, Unit::Speed::MillimetrePerSecond};
+  EXPECT_EQ(ParseYAML<PlanarVelocity<>>(planar_velocity.YAML()).quantity,
+            std::optional{planar_velocity});
+  const Velocity<> velocity{{1.0, -2.0, 3.0}, Unit::Speed::MetrePerSecond};
+  EXPECT_EQ(ParseYAML<Velocity<>>(velocity.YAML()).quantity, std::optional{velocity});
+  const Stress<> stress{{1.0, -2.0, 3.0, -4.0, 5.0, -6.0}, Unit::Pressure::Kilopascal};
+  EXPECT_EQ(ParseYAML<Stress<>>(stress.YAML()).quantity, std::optional{stress});
+  const VelocityGradient<> velocity_gradient{
+      {1.0, -2.0, 3.0, -4.0, 5.0, -6.0, 7.0, -8.0, 9.0},
+      Unit::Frequency::Kilohertz
+  };
+  EXPECT_EQ(ParseYAML<VelocityGradient<>>(velocity_gradient.YAML()).quantity,
+            std::optional{velocity_gradient});
+}
+
+}  // namespace
+
+}  // namespace PhQ
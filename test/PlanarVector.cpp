@@ -28,6 +28,7 @@
 #include <functional>
 #include <gtest/gtest.h>
 #include <sstream>
+#include <string>
 #include <utility>
 
 namespace PhQ {
@@ -438,6 +439,13 @@ TEST(PlanarVector, JSON) {
   EXPECT_EQ(PlanarVector(1.0, -2.0).JSON(), "{\"x\":" + Print(1.0) + ",\"y\":" + Print(-2.0) + "}");
   EXPECT_EQ(
       PlanarVector(1.0L, -2.0L).JSON(), "{\"x\":" + Print(1.0L) + ",\"y\":" + Print(-2.0L) + "}");
+  const PlanarVector planar_vector(1.0F, -2.0F);
+  std::string string{"prefix:"};
+  planar_vector.AppendJSON(string);
+  EXPECT_EQ(string, R"(prefix:{"x":1.000000000,"y":-2.000000000})");
+  char buffer[64];
+  char* const end{planar_vector.WriteJSON(buffer)};
+  EXPECT_EQ(std::string(buffer, end), R"({"x":1.000000000,"y":-2.000000000})");
 }
 
 TEST(PlanarVector, Magnitude) {
@@ -627,12 +635,26 @@ TEST(PlanarVector, XML) {
   EXPECT_EQ(PlanarVector(1.0, -2.0).XML(), "<x>" + Print(1.0) + "</x><y>" + Print(-2.0) + "</y>");
   EXPECT_EQ(
       PlanarVector(1.0L, -2.0L).XML(), "<x>" + Print(1.0L) + "</x><y>" + Print(-2.0L) + "</y>");
+  const PlanarVector planar_vector(1.0F, -2.0F);
+  std::string string{"prefix:"};
+  planar_vector.AppendXML(string);
+  EXPECT_EQ(string, R"(prefix:<x>1.000000000</x><y>-2.000000000</y>)");
+  char buffer[64];
+  char* const end{planar_vector.WriteXML(buffer)};
+  EXPECT_EQ(std::string(buffer, end), R"(<x>1.000000000</x><y>-2.000000000</y>)");
 }
 
 TEST(PlanarVector, YAML) {
   EXPECT_EQ(PlanarVector(1.0F, -2.0F).YAML(), "{x:" + Print(1.0F) + ",y:" + Print(-2.0F) + "}");
   EXPECT_EQ(PlanarVector(1.0, -2.0).YAML(), "{x:" + Print(1.0) + ",y:" + Print(-2.0) + "}");
   EXPECT_EQ(PlanarVector(1.0L, -2.0L).YAML(), "{x:" + Print(1.0L) + ",y:" + Print(-2.0L) + "}");
+  const PlanarVector planar_vector(1.0F, -2.0F);
+  std::string string{"prefix:"};
+  planar_vector.AppendYAML(string);
+  EXPECT_EQ(string, R"(prefix:{x:1.000000000,y:-2.000000000})");
+  char buffer[64];
+  char* const end{planar_vector.WriteYAML(buffer)};
+  EXPECT_EQ(std::string(buffer, end), R"({x:1.000000000,y:-2.000000000})");
 }
 
 TEST(PlanarVector, Zero) {
@@ -29,6 +29,7 @@
 #include <gtest/gtest.h>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #include "../include/PhQ/Angle.hpp"
 #include "../include/PhQ/Frequency.hpp"
@@ -272,6 +273,15 @@ TEST(PlanarVelocity, SetValue) {
   EXPECT_EQ(velocity.Value(), PlanarVector(-4.0, 5.0));
 }
 
+TEST(PlanarVelocity, SetValues) {
+  const std::vector<PlanarVector<>> values{{1.0, -2.0}, {-4.0, 5.0}};
+  std::vector<PlanarVelocity<>> velocities;
+  SetValues(values, Unit::Speed::MillimetrePerSecond, velocities);
+  ASSERT_EQ(velocities.size(), 2);
+  EXPECT_EQ(velocities[0], PlanarVelocity({1.0, -2.0}, Unit::Speed::MillimetrePerSecond));
+  EXPECT_EQ(velocities[1], PlanarVelocity({-4.0, 5.0}, Unit::Speed::MillimetrePerSecond));
+}
+
 TEST(PlanarVelocity, SizeOf) {
   EXPECT_EQ(sizeof(PlanarVelocity<>{}), 2 * sizeof(double));
 }
@@ -301,6 +311,18 @@ TEST(PlanarVelocity, Value) {
             PlanarVector(1.0, -2.0));
 }
 
+TEST(PlanarVelocity, Values) {
+  const std::vector<PlanarVelocity<>> velocities{
+      PlanarVelocity({1.0, -2.0}, Unit::Speed::MetrePerSecond),
+      PlanarVelocity({-4.0, 5.0}, Unit::Speed::MetrePerSecond),
+  };
+  const std::vector<PlanarVector<>> values{Values(velocities, Unit::Speed::MillimetrePerSecond)};
+  ASSERT_EQ(values.size(), 2);
+  EXPECT_EQ(values[0], velocities[0].Value(Unit::Speed::MillimetrePerSecond));
+  EXPECT_EQ(values[1], velocities[1].Value(Unit::Speed::MillimetrePerSecond));
+  EXPECT_EQ(Values(velocities, Unit::Speed::MetrePerSecond)[1], velocities[1].Value());
+}
+
 TEST(PlanarVelocity, XML) {
   EXPECT_EQ(PlanarVelocity({1.0, -2.0}, Unit::Speed::MetrePerSecond).XML(),
             "<value><x>" + Print(1.0) + "</x><y>" + Print(-2.0) + "</y></value><unit>m/s</unit>");
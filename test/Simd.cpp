@@ -0,0 +1,208 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/Simd.hpp"
+
+#include <cstddef>
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace PhQ::Internal {
+
+namespace {
+
+// Sizes that exercise empty sequences, sequences shorter than one vector register, and sequences
+// with every possible tail length for every register width.
+constexpr std::size_t MaximumSize{70};
+
+template <typename NumericType>
+std::vector<NumericType> Values(const std::size_t size) {
+  std::vector<NumericType> values(size);
+  for (std::size_t index = 0; index < size; ++index) {
+    values[index] = static_cast<NumericType>(1.25L * static_cast<long double>(index) - 20.5L);
+  }
+  return values;
+}
+
+// The explicitly vectorized kernels must round exactly like the scalar kernel, so the results are
+// the same regardless of the processor and of the length of the sequence.
+template <typename NumericType>
+void ExpectEqual(const std::vector<NumericType>& result, const std::vector<NumericType>& expected) {
+  ASSERT_EQ(result.size(), expected.size());
+  for (std::size_t index = 0; index < result.size(); ++index) {
+    EXPECT_EQ(result[index], expected[index]);
+  }
+}
+
+template <typename NumericType>
+std::vector<NumericType> Expected(const std::vector<NumericType>& input, const NumericType scale,
+                                  const NumericType offset) {
+  std::vector<NumericType> expected(input.size());
+  AffineKernelScalar(input.data(), expected.data(), input.size(), scale, offset);
+  return expected;
+}
+
+// Verifies a kernel both out of place and in place for every size up to the maximum size.
+template <typename NumericType, typename Kernel>
+void TestKernel(const Kernel kernel) {
+  const NumericType scale{static_cast<NumericType>(0.3048L)};
+  const NumericType offset{static_cast<NumericType>(-459.67L)};
+  for (std::size_t size = 0; size <= MaximumSize; ++size) {
+    const std::vector<NumericType> input{Values<NumericType>(size)};
+    const std::vector<NumericType> expected{Expected(input, scale, offset)};
+
+    std::vector<NumericType> output(size);
+    kernel(input.data(), output.data(), size, scale, offset);
+    ExpectEqual(output, expected);
+
+    std::vector<NumericType> in_place{input};
+    kernel(in_place.data(), in_place.data(), size, scale, offset);
+    ExpectEqual(in_place, expected);
+  }
+}
+
+TEST(Simd, AffineKernel) {
+  TestKernel<float>(AffineKernel<float>);
+  TestKernel<double>(AffineKernel<double>);
+  TestKernel<long double>(AffineKernel<long double>);
+}
+
+TEST(Simd, AffineKernelLongSequence) {
+  // Converts temperatures from degrees Fahrenheit to kelvins, for which a fused multiply-add rounds
+  // differently from a multiplication followed by an addition for many values.
+  const double scale{5.0 / 9.0};
+  const double offset{459.67 * 5.0 / 9.0};
+  std::vector<double> input(10000);
+  for (std::size_t index = 0; index < input.size(); ++index) {
+    input[index] = 0.0123 * static_cast<double>(index) - 40.0;
+  }
+  std::vector<double> output(input.size());
+  AffineKernel(input.data(), output.data(), input.size(), scale, offset);
+  ExpectEqual(output, Expected(input, scale, offset));
+}
+
+TEST(Simd, AffineKernelScalar) {
+  TestKernel<float>(AffineKernelScalar<float>);
+  TestKernel<double>(AffineKernelScalar<double>);
+  TestKernel<long double>(AffineKernelScalar<long double>);
+}
+
+TEST(Simd, AffineKernelScalarConstexpr) {
+  constexpr double value{[]() {
+    double values[3]{1.0, 2.0, 3.0};
+    AffineKernelScalar(values, values, 3, 2.0, -1.0);
+    return values[0] + values[1] + values[2];
+  }()};
+  EXPECT_EQ(value, 9.0);
+}
+
+TEST(Simd, RunKernel) {
+  for (const std::size_t size : {std::size_t{0}, std::size_t{3}, std::size_t{101}}) {
+    std::vector<double> input(size);
+    std::vector<double> output(size, 0.0);
+    for (std::size_t index = 0; index < size; ++index) {
+      input[index] = static_cast<double>(index);
+    }
+    const double* const input_data{input.data()};
+    double* const output_data{output.data()};
+    RunKernel(
+        [=]() PHQ_ALWAYS_INLINE {
+          for (std::size_t index = 0; index < size; ++index) {
+            output_data[index] = 2.0 * input_data[index] + 1.0;
+          }
+        },
+        size);
+    for (std::size_t index = 0; index < size; ++index) {
+      EXPECT_EQ(output[index], 2.0 * static_cast<double>(index) + 1.0);
+    }
+  }
+}
+
+#ifdef PHQ_SIMD_X86_64
+
+TEST(Simd, AffineKernelSSE2) {
+  const auto float_kernel = [](const float* input, float* output, const std::size_t size,
+                               const float scale, const float offset) {
+    AffineKernelSSE2(input, output, size, scale, offset);
+  };
+  const auto double_kernel = [](const double* input, double* output, const std::size_t size,
+                                const double scale, const double offset) {
+    AffineKernelSSE2(input, output, size, scale, offset);
+  };
+  TestKernel<float>(float_kernel);
+  TestKernel<double>(double_kernel);
+}
+
+TEST(Simd, AffineKernelAVX2) {
+  if (SupportedInstructionSet() < InstructionSet::AVX2) {
+    GTEST_SKIP() << "This processor does not support AVX2.";
+  }
+  const auto float_kernel = [](const float* input, float* output, const std::size_t size,
+                               const float scale, const float offset) {
+    AffineKernelAVX2(input, output, size, scale, offset);
+  };
+  const auto double_kernel = [](const double* input, double* output, const std::size_t size,
+                                const double scale, const double offset) {
+    AffineKernelAVX2(input, output, size, scale, offset);
+  };
+  TestKernel<float>(float_kernel);
+  TestKernel<double>(double_kernel);
+}
+
+  #ifdef PHQ_SIMD_AVX512
+
+TEST(Simd, AffineKernelAVX512) {
+  if (SupportedInstructionSet() < InstructionSet::AVX512) {
+    GTEST_SKIP() << "This processor does not support AVX-512.";
+  }
+  const auto float_kernel = [](const float* input, float* output, const std::size_t size,
+                               const float scale, const float offset) {
+    AffineKernelAVX512(input, output, size, scale, offset);
+  };
+  const auto double_kernel = [](const double* input, double* output, const std::size_t size,
+                                const double scale, const double offset) {
+    AffineKernelAVX512(input, output, size, scale, offset);
+  };
+  TestKernel<float>(float_kernel);
+  TestKernel<double>(double_kernel);
+}
+
+  #endif  // PHQ_SIMD_AVX512
+
+TEST(Simd, SupportedInstructionSet) {
+  EXPECT_GE(SupportedInstructionSet(), InstructionSet::SSE2);
+  EXPECT_EQ(SupportedInstructionSet(), DetectInstructionSet());
+}
+
+#else
+
+TEST(Simd, SupportedInstructionSet) {
+  EXPECT_EQ(SupportedInstructionSet(), InstructionSet::Scalar);
+}
+
+#endif  // PHQ_SIMD_X86_64
+
+}  // namespace
+
+}  // namespace PhQ::Internal
@@ -0,0 +1,219 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/StaticUnitDyad.hpp"
+
+#include <functional>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <utility>
+
+#include "../include/PhQ/Dyad.hpp"
+#include "../include/PhQ/Unit/Frequency.hpp"
+#include "../include/PhQ/VelocityGradient.hpp"
+
+namespace PhQ {
+
+namespace {
+
+using Small = StaticUnitDyad<Unit::Frequency::Hertz>;
+
+using Large = StaticUnitDyad<Unit::Frequency::Kilohertz>;
+
+constexpr Dyad<double> first_value{1.0, -2.0, 3.0, -4.0, 5.0, -6.0, 7.0, -8.0, 9.0};
+
+constexpr Dyad<double> second_value{2.0, 4.0, 6.0, 8.0, 10.0, 12.0, 14.0, 16.0, 18.0};
+
+constexpr Dyad<double> sum_value{3.0, 2.0, 9.0, 4.0, 15.0, 6.0, 21.0, 8.0, 27.0};
+
+constexpr Dyad<double> difference_value{1.0, 6.0, 3.0, 12.0, 5.0, 18.0, 7.0, 24.0, 9.0};
+
+constexpr Dyad<double> doubled_second_value{4.0, 8.0, 12.0, 16.0, 20.0, 24.0, 28.0, 32.0, 36.0};
+
+constexpr Dyad<double> scaled_first_value{
+    1000.0, -2000.0, 3000.0, -4000.0, 5000.0, -6000.0, 7000.0, -8000.0, 9000.0};
+
+constexpr Dyad<double> perturbed_first_value{1.00001, -2.0, 3.0, -4.0, 5.0, -6.0, 7.0, -8.0, 9.0};
+
+TEST(StaticUnitDyad, ArithmeticOperatorAddition) {
+  EXPECT_EQ(Small(first_value) + Small(second_value), Small(sum_value));
+}
+
+TEST(StaticUnitDyad, ArithmeticOperatorDivision) {
+  EXPECT_EQ(Small(doubled_second_value) / 2.0, Small(second_value));
+}
+
+TEST(StaticUnitDyad, ArithmeticOperatorMultiplication) {
+  EXPECT_EQ(Small(second_value) * 2.0, Small(doubled_second_value));
+  EXPECT_EQ(2.0 * Small(second_value), Small(doubled_second_value));
+}
+
+TEST(StaticUnitDyad, ArithmeticOperatorSubtraction) {
+  EXPECT_EQ(Small(second_value) - Small(first_value), Small(difference_value));
+}
+
+TEST(StaticUnitDyad, AssignmentOperatorAddition) {
+  Small quantity(first_value);
+  quantity += Small(second_value);
+  EXPECT_EQ(quantity, Small(sum_value));
+}
+
+TEST(StaticUnitDyad, AssignmentOperatorDivision) {
+  Small quantity(doubled_second_value);
+  quantity /= 2.0;
+  EXPECT_EQ(quantity, Small(second_value));
+}
+
+TEST(StaticUnitDyad, AssignmentOperatorMultiplication) {
+  Small quantity(second_value);
+  quantity *= 2.0;
+  EXPECT_EQ(quantity, Small(doubled_second_value));
+}
+
+TEST(StaticUnitDyad, AssignmentOperatorSubtraction) {
+  Small quantity(second_value);
+  quantity -= Small(first_value);
+  EXPECT_EQ(quantity, Small(difference_value));
+}
+
+TEST(StaticUnitDyad, ComparisonOperators) {
+  const Small first(first_value);
+  const Small second(second_value);
+  EXPECT_EQ(first, first);
+  EXPECT_NE(first, second);
+}
+
+TEST(StaticUnitDyad, Constructor) {
+  constexpr Small small(scaled_first_value);
+  constexpr Large large(small);
+  EXPECT_EQ(large.Value(), first_value);
+  EXPECT_EQ(Small(large).Value(), scaled_first_value);
+  const VelocityGradient quantity(first_value, Unit::Frequency::Kilohertz);
+  EXPECT_EQ(Small(quantity).Value(), scaled_first_value);
+}
+
+TEST(StaticUnitDyad, CopyAssignmentOperator) {
+  const Small first(first_value);
+  Small second = Small::Zero();
+  second = first;
+  EXPECT_EQ(second, first);
+}
+
+TEST(StaticUnitDyad, CopyConstructor) {
+  const Small first(first_value);
+  const Small second{first};
+  EXPECT_EQ(second, first);
+}
+
+TEST(StaticUnitDyad, DefaultConstructor) {
+  EXPECT_NO_THROW(Small{});
+}
+
+TEST(StaticUnitDyad, Dimensions) {
+  EXPECT_EQ(Small::Dimensions(), RelatedDimensions<Unit::Frequency>);
+}
+
+TEST(StaticUnitDyad, Hash) {
+  const Small first(first_value);
+  const Small second(perturbed_first_value);
+  const Small third(second_value);
+  const std::hash<Small> hash;
+  EXPECT_NE(hash(first), hash(second));
+  EXPECT_NE(hash(first), hash(third));
+  EXPECT_NE(hash(second), hash(third));
+}
+
+TEST(StaticUnitDyad, MoveAssignmentOperator) {
+  Small first(first_value);
+  Small second = Small::Zero();
+  second = std::move(first);
+  EXPECT_EQ(second, Small(first_value));
+}
+
+TEST(StaticUnitDyad, MoveConstructor) {
+  Small first(first_value);
+  const Small second{std::move(first)};
+  EXPECT_EQ(second, Small(first_value));
+}
+
+TEST(StaticUnitDyad, MutableValue) {
+  Small quantity(first_value);
+  Dyad<double>& value = quantity.MutableValue();
+  value = second_value;
+  EXPECT_EQ(quantity.Value(), second_value);
+}
+
+TEST(StaticUnitDyad, Print) {
+  EXPECT_EQ(Small(first_value).Print(), first_value.Print() + " Hz");
+  EXPECT_EQ(Large(second_value).Print(), second_value.Print() + " kHz");
+}
+
+TEST(StaticUnitDyad, SetValue) {
+  Small quantity(first_value);
+  quantity.SetValue(second_value);
+  EXPECT_EQ(quantity.Value(), second_value);
+}
+
+TEST(StaticUnitDyad, SizeOf) {
+  EXPECT_EQ(sizeof(Small{}), sizeof(Dyad<double>{}));
+}
+
+TEST(StaticUnitDyad, StaticValue) {
+  constexpr Small quantity(scaled_first_value);
+  constexpr Dyad<double> value = quantity.StaticValue<Unit::Frequency::Kilohertz>();
+  EXPECT_EQ(value, first_value);
+}
+
+TEST(StaticUnitDyad, Stream) {
+  std::ostringstream stream;
+  stream << Small(first_value);
+  EXPECT_EQ(stream.str(), Small(first_value).Print());
+}
+
+TEST(StaticUnitDyad, ToQuantity) {
+  constexpr Large quantity(first_value);
+  constexpr VelocityGradient converted = quantity.ToQuantity<VelocityGradient<>>();
+  EXPECT_EQ(converted, VelocityGradient<>::Create<Unit::Frequency::Kilohertz>(first_value));
+  EXPECT_EQ(
+      Small(first_value).ToQuantity<VelocityGradient<>>(),
+      VelocityGradient(first_value, Unit::Frequency::Hertz));
+}
+
+TEST(StaticUnitDyad, Unit) {
+  EXPECT_EQ(Small::Unit(), Unit::Frequency::Hertz);
+  EXPECT_EQ(Large::Unit(), Unit::Frequency::Kilohertz);
+}
+
+TEST(StaticUnitDyad, Value) {
+  EXPECT_EQ(Small(first_value).Value(), first_value);
+  EXPECT_EQ(Small(scaled_first_value).Value(Unit::Frequency::Kilohertz), first_value);
+}
+
+TEST(StaticUnitDyad, Zero) {
+  EXPECT_EQ(Small::Zero(), Small(Dyad<double>::Zero()));
+}
+
+}  // namespace
+
+}  // namespace PhQ
@@ -0,0 +1,218 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/StaticUnitPlanarVector.hpp"
+
+#include <functional>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <utility>
+
+#include "../include/PhQ/PlanarVector.hpp"
+#include "../include/PhQ/PlanarVelocity.hpp"
+#include "../include/PhQ/Unit/Speed.hpp"
+
+namespace PhQ {
+
+namespace {
+
+using Small = StaticUnitPlanarVector<Unit::Speed::MillimetrePerSecond>;
+
+using Large = StaticUnitPlanarVector<Unit::Speed::MetrePerSecond>;
+
+constexpr PlanarVector<double> first_value{1.0, -2.0};
+
+constexpr PlanarVector<double> second_value{2.0, 4.0};
+
+constexpr PlanarVector<double> sum_value{3.0, 2.0};
+
+constexpr PlanarVector<double> difference_value{1.0, 6.0};
+
+constexpr PlanarVector<double> doubled_second_value{4.0, 8.0};
+
+constexpr PlanarVector<double> scaled_first_value{1000.0, -2000.0};
+
+constexpr PlanarVector<double> perturbed_first_value{1.00001, -2.0};
+
+TEST(StaticUnitPlanarVector, ArithmeticOperatorAddition) {
+  EXPECT_EQ(Small(first_value) + Small(second_value), Small(sum_value));
+}
+
+TEST(StaticUnitPlanarVector, ArithmeticOperatorDivision) {
+  EXPECT_EQ(Small(doubled_second_value) / 2.0, Small(second_value));
+}
+
+TEST(StaticUnitPlanarVector, ArithmeticOperatorMultiplication) {
+  EXPECT_EQ(Small(second_value) * 2.0, Small(doubled_second_value));
+  EXPECT_EQ(2.0 * Small(second_value), Small(doubled_second_value));
+}
+
+TEST(StaticUnitPlanarVector, ArithmeticOperatorSubtraction) {
+  EXPECT_EQ(Small(second_value) - Small(first_value), Small(difference_value));
+}
+
+TEST(StaticUnitPlanarVector, AssignmentOperatorAddition) {
+  Small quantity(first_value);
+  quantity += Small(second_value);
+  EXPECT_EQ(quantity, Small(sum_value));
+}
+
+TEST(StaticUnitPlanarVector, AssignmentOperatorDivision) {
+  Small quantity(doubled_second_value);
+  quantity /= 2.0;
+  EXPECT_EQ(quantity, Small(second_value));
+}
+
+TEST(StaticUnitPlanarVector, AssignmentOperatorMultiplication) {
+  Small quantity(second_value);
+  quantity *= 2.0;
+  EXPECT_EQ(quantity, Small(doubled_second_value));
+}
+
+TEST(StaticUnitPlanarVector, AssignmentOperatorSubtraction) {
+  Small quantity(second_value);
+  quantity -= Small(first_value);
+  EXPECT_EQ(quantity, Small(difference_value));
+}
+
+TEST(StaticUnitPlanarVector, ComparisonOperators) {
+  const Small first(first_value);
+  const Small second(second_value);
+  EXPECT_EQ(first, first);
+  EXPECT_NE(first, second);
+}
+
+TEST(StaticUnitPlanarVector, Constructor) {
+  constexpr Small small(scaled_first_value);
+  constexpr Large large(small);
+  EXPECT_EQ(large.Value(), first_value);
+  EXPECT_EQ(Small(large).Value(), scaled_first_value);
+  const PlanarVelocity quantity(first_value, Unit::Speed::MetrePerSecond);
+  EXPECT_EQ(Small(quantity).Value(), scaled_first_value);
+}
+
+TEST(StaticUnitPlanarVector, CopyAssignmentOperator) {
+  const Small first(first_value);
+  Small second = Small::Zero();
+  second = first;
+  EXPECT_EQ(second, first);
+}
+
+TEST(StaticUnitPlanarVector, CopyConstructor) {
+  const Small first(first_value);
+  const Small second{first};
+  EXPECT_EQ(second, first);
+}
+
+TEST(StaticUnitPlanarVector, DefaultConstructor) {
+  EXPECT_NO_THROW(Small{});
+}
+
+TEST(StaticUnitPlanarVector, Dimensions) {
+  EXPECT_EQ(Small::Dimensions(), RelatedDimensions<Unit::Speed>);
+}
+
+TEST(StaticUnitPlanarVector, Hash) {
+  const Small first(first_value);
+  const Small second(perturbed_first_value);
+  const Small third(second_value);
+  const std::hash<Small> hash;
+  EXPECT_NE(hash(first), hash(second));
+  EXPECT_NE(hash(first), hash(third));
+  EXPECT_NE(hash(second), hash(third));
+}
+
+TEST(StaticUnitPlanarVector, MoveAssignmentOperator) {
+  Small first(first_value);
+  Small second = Small::Zero();
+  second = std::move(first);
+  EXPECT_EQ(second, Small(first_value));
+}
+
+TEST(StaticUnitPlanarVector, MoveConstructor) {
+  Small first(first_value);
+  const Small second{std::move(first)};
+  EXPECT_EQ(second, Small(first_value));
+}
+
+TEST(StaticUnitPlanarVector, MutableValue) {
+  Small quantity(first_value);
+  PlanarVector<double>& value = quantity.MutableValue();
+  value = second_value;
+  EXPECT_EQ(quantity.Value(), second_value);
+}
+
+TEST(StaticUnitPlanarVector, Print) {
+  EXPECT_EQ(Small(first_value).Print(), first_value.Print() + " mm/s");
+  EXPECT_EQ(Large(second_value).Print(), second_value.Print() + " m/s");
+}
+
+TEST(StaticUnitPlanarVector, SetValue) {
+  Small quantity(first_value);
+  quantity.SetValue(second_value);
+  EXPECT_EQ(quantity.Value(), second_value);
+}
+
+TEST(StaticUnitPlanarVector, SizeOf) {
+  EXPECT_EQ(sizeof(Small{}), sizeof(PlanarVector<double>{}));
+}
+
+TEST(StaticUnitPlanarVector, StaticValue) {
+  constexpr Small quantity(scaled_first_value);
+  constexpr PlanarVector<double> value = quantity.StaticValue<Unit::Speed::MetrePerSecond>();
+  EXPECT_EQ(value, first_value);
+}
+
+TEST(StaticUnitPlanarVector, Stream) {
+  std::ostringstream stream;
+  stream << Small(first_value);
+  EXPECT_EQ(stream.str(), Small(first_value).Print());
+}
+
+TEST(StaticUnitPlanarVector, ToQuantity) {
+  constexpr Large quantity(first_value);
+  constexpr PlanarVelocity converted = quantity.ToQuantity<PlanarVelocity<>>();
+  EXPECT_EQ(converted, PlanarVelocity<>::Create<Unit::Speed::MetrePerSecond>(first_value));
+  EXPECT_EQ(
+      Small(first_value).ToQuantity<PlanarVelocity<>>(),
+      PlanarVelocity(first_value, Unit::Speed::MillimetrePerSecond));
+}
+
+TEST(StaticUnitPlanarVector, Unit) {
+  EXPECT_EQ(Small::Unit(), Unit::Speed::MillimetrePerSecond);
+  EXPECT_EQ(Large::Unit(), Unit::Speed::MetrePerSecond);
+}
+
+TEST(StaticUnitPlanarVector, Value) {
+  EXPECT_EQ(Small(first_value).Value(), first_value);
+  EXPECT_EQ(Small(scaled_first_value).Value(Unit::Speed::MetrePerSecond), first_value);
+}
+
+TEST(StaticUnitPlanarVector, Zero) {
+  EXPECT_EQ(Small::Zero(), Small(PlanarVector<double>::Zero()));
+}
+
+}  // namespace
+
+}  // namespace PhQ
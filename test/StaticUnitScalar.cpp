@@ -0,0 +1,212 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/StaticUnitScalar.hpp"
+
+#include <functional>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <utility>
+
+#include "../include/PhQ/Length.hpp"
+#include "../include/PhQ/Unit/Length.hpp"
+
+namespace PhQ {
+
+namespace {
+
+using Millimetres = StaticUnitScalar<Unit::Length::Millimetre>;
+
+using Metres = StaticUnitScalar<Unit::Length::Metre>;
+
+TEST(StaticUnitScalar, ArithmeticOperatorAddition) {
+  EXPECT_EQ(Millimetres(1.0) + Millimetres(2.0), Millimetres(3.0));
+}
+
+TEST(StaticUnitScalar, ArithmeticOperatorDivision) {
+  EXPECT_EQ(Millimetres(8.0) / 2.0, Millimetres(4.0));
+  EXPECT_EQ(Millimetres(8.0) / Millimetres(2.0), 4.0);
+}
+
+TEST(StaticUnitScalar, ArithmeticOperatorMultiplication) {
+  EXPECT_EQ(Millimetres(4.0) * 2.0, Millimetres(8.0));
+  EXPECT_EQ(2.0 * Millimetres(4.0), Millimetres(8.0));
+}
+
+TEST(StaticUnitScalar, ArithmeticOperatorSubtraction) {
+  EXPECT_EQ(Millimetres(3.0) - Millimetres(2.0), Millimetres(1.0));
+}
+
+TEST(StaticUnitScalar, AssignmentOperatorAddition) {
+  Millimetres quantity(1.0);
+  quantity += Millimetres(2.0);
+  EXPECT_EQ(quantity, Millimetres(3.0));
+}
+
+TEST(StaticUnitScalar, AssignmentOperatorDivision) {
+  Millimetres quantity(8.0);
+  quantity /= 2.0;
+  EXPECT_EQ(quantity, Millimetres(4.0));
+}
+
+TEST(StaticUnitScalar, AssignmentOperatorMultiplication) {
+  Millimetres quantity(4.0);
+  quantity *= 2.0;
+  EXPECT_EQ(quantity, Millimetres(8.0));
+}
+
+TEST(StaticUnitScalar, AssignmentOperatorSubtraction) {
+  Millimetres quantity(3.0);
+  quantity -= Millimetres(2.0);
+  EXPECT_EQ(quantity, Millimetres(1.0));
+}
+
+TEST(StaticUnitScalar, ComparisonOperators) {
+  const Millimetres first(1.0);
+  const Millimetres second(2.0);
+  EXPECT_EQ(first, first);
+  EXPECT_NE(first, second);
+  EXPECT_LT(first, second);
+  EXPECT_GT(second, first);
+  EXPECT_LE(first, first);
+  EXPECT_LE(first, second);
+  EXPECT_GE(first, first);
+  EXPECT_GE(second, first);
+}
+
+TEST(StaticUnitScalar, Constructor) {
+  constexpr Millimetres millimetres(1500.0);
+  constexpr Metres metres(millimetres);
+  EXPECT_DOUBLE_EQ(metres.Value(), 1.5);
+  EXPECT_DOUBLE_EQ(Millimetres(metres).Value(), 1500.0);
+  constexpr Length length = Length<>::Create<Unit::Length::Metre>(2.0);
+  constexpr Millimetres from_length(length);
+  EXPECT_DOUBLE_EQ(from_length.Value(), 2000.0);
+  EXPECT_EQ(StaticUnitScalar<Unit::Length::Centimetre>(Length(3.0, Unit::Length::Metre)).Value(),
+            300.0);
+}
+
+TEST(StaticUnitScalar, CopyAssignmentOperator) {
+  const Millimetres first(1.0);
+  Millimetres second = Millimetres::Zero();
+  second = first;
+  EXPECT_EQ(second, first);
+}
+
+TEST(StaticUnitScalar, CopyConstructor) {
+  const Millimetres first(1.0);
+  const Millimetres second{first};
+  EXPECT_EQ(second, first);
+}
+
+TEST(StaticUnitScalar, DefaultConstructor) {
+  EXPECT_NO_THROW(Millimetres{});
+}
+
+TEST(StaticUnitScalar, Dimensions) {
+  EXPECT_EQ(Millimetres::Dimensions(), RelatedDimensions<Unit::Length>);
+}
+
+TEST(StaticUnitScalar, Hash) {
+  const Millimetres first(1.0);
+  const Millimetres second(1.00001);
+  const Millimetres third(-1.0);
+  const std::hash<Millimetres> hash;
+  EXPECT_NE(hash(first), hash(second));
+  EXPECT_NE(hash(first), hash(third));
+  EXPECT_NE(hash(second), hash(third));
+}
+
+TEST(StaticUnitScalar, MoveAssignmentOperator) {
+  Millimetres first(1.0);
+  Millimetres second = Millimetres::Zero();
+  second = std::move(first);
+  EXPECT_EQ(second, Millimetres(1.0));
+}
+
+TEST(StaticUnitScalar, MoveConstructor) {
+  Millimetres first(1.0);
+  const Millimetres second{std::move(first)};
+  EXPECT_EQ(second, Millimetres(1.0));
+}
+
+TEST(StaticUnitScalar, MutableValue) {
+  Millimetres quantity(1.0);
+  double& value = quantity.MutableValue();
+  value = 2.0;
+  EXPECT_EQ(quantity.Value(), 2.0);
+}
+
+TEST(StaticUnitScalar, Print) {
+  EXPECT_EQ(Millimetres(1.0).Print(), Print(1.0) + " mm");
+  EXPECT_EQ(Metres(-2.5).Print(), Print(-2.5) + " m");
+}
+
+TEST(StaticUnitScalar, SetValue) {
+  Millimetres quantity(1.0);
+  quantity.SetValue(2.0);
+  EXPECT_EQ(quantity.Value(), 2.0);
+}
+
+TEST(StaticUnitScalar, SizeOf) {
+  EXPECT_EQ(sizeof(Millimetres{}), sizeof(double));
+  EXPECT_EQ(sizeof(StaticUnitScalar<Unit::Length::Millimetre, float>{}), sizeof(float));
+}
+
+TEST(StaticUnitScalar, StaticValue) {
+  constexpr Millimetres quantity(1500.0);
+  constexpr double value = quantity.StaticValue<Unit::Length::Metre>();
+  EXPECT_DOUBLE_EQ(value, 1.5);
+}
+
+TEST(StaticUnitScalar, Stream) {
+  std::ostringstream stream;
+  stream << Millimetres(1.0);
+  EXPECT_EQ(stream.str(), Millimetres(1.0).Print());
+}
+
+TEST(StaticUnitScalar, ToQuantity) {
+  constexpr Millimetres quantity(1500.0);
+  constexpr Length length = quantity.ToQuantity<Length<>>();
+  EXPECT_DOUBLE_EQ(length.Value(), 1.5);
+  EXPECT_DOUBLE_EQ(Metres(2.0).ToQuantity<Length<>>().Value(Unit::Length::Millimetre), 2000.0);
+}
+
+TEST(StaticUnitScalar, Unit) {
+  EXPECT_EQ(Millimetres::Unit(), Unit::Length::Millimetre);
+  EXPECT_EQ(Metres::Unit(), Unit::Length::Metre);
+}
+
+TEST(StaticUnitScalar, Value) {
+  EXPECT_EQ(Millimetres(1.0).Value(), 1.0);
+  EXPECT_DOUBLE_EQ(Millimetres(1500.0).Value(Unit::Length::Metre), 1.5);
+}
+
+TEST(StaticUnitScalar, Zero) {
+  EXPECT_EQ(Millimetres::Zero(), Millimetres(0.0));
+}
+
+}  // namespace
+
+}  // namespace PhQ
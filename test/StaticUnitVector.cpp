@@ -0,0 +1,218 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/StaticUnitVector.hpp"
+
+#include <functional>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <utility>
+
+#include "../include/PhQ/Unit/Speed.hpp"
+#include "../include/PhQ/Vector.hpp"
+#include "../include/PhQ/Velocity.hpp"
+
+namespace PhQ {
+
+namespace {
+
+using Small = StaticUnitVector<Unit::Speed::MillimetrePerSecond>;
+
+using Large = StaticUnitVector<Unit::Speed::MetrePerSecond>;
+
+constexpr Vector<double> first_value{1.0, -2.0, 3.0};
+
+constexpr Vector<double> second_value{2.0, 4.0, -6.0};
+
+constexpr Vector<double> sum_value{3.0, 2.0, -3.0};
+
+constexpr Vector<double> difference_value{1.0, 6.0, -9.0};
+
+constexpr Vector<double> doubled_second_value{4.0, 8.0, -12.0};
+
+constexpr Vector<double> scaled_first_value{1000.0, -2000.0, 3000.0};
+
+constexpr Vector<double> perturbed_first_value{1.00001, -2.0, 3.0};
+
+TEST(StaticUnitVector, ArithmeticOperatorAddition) {
+  EXPECT_EQ(Small(first_value) + Small(second_value), Small(sum_value));
+}
+
+TEST(StaticUnitVector, ArithmeticOperatorDivision) {
+  EXPECT_EQ(Small(doubled_second_value) / 2.0, Small(second_value));
+}
+
+TEST(StaticUnitVector, ArithmeticOperatorMultiplication) {
+  EXPECT_EQ(Small(second_value) * 2.0, Small(doubled_second_value));
+  EXPECT_EQ(2.0 * Small(second_value), Small(doubled_second_value));
+}
+
+TEST(StaticUnitVector, ArithmeticOperatorSubtraction) {
+  EXPECT_EQ(Small(second_value) - Small(first_value), Small(difference_value));
+}
+
+TEST(StaticUnitVector, AssignmentOperatorAddition) {
+  Small quantity(first_value);
+  quantity += Small(second_value);
+  EXPECT_EQ(quantity, Small(sum_value));
+}
+
+TEST(StaticUnitVector, AssignmentOperatorDivision) {
+  Small quantity(doubled_second_value);
+  quantity /= 2.0;
+  EXPECT_EQ(quantity, Small(second_value));
+}
+
+TEST(StaticUnitVector, AssignmentOperatorMultiplication) {
+  Small quantity(second_value);
+  quantity *= 2.0;
+  EXPECT_EQ(quantity, Small(doubled_second_value));
+}
+
+TEST(StaticUnitVector, AssignmentOperatorSubtraction) {
+  Small quantity(second_value);
+  quantity -= Small(first_value);
+  EXPECT_EQ(quantity, Small(difference_value));
+}
+
+TEST(StaticUnitVector, ComparisonOperators) {
+  const Small first(first_value);
+  const Small second(second_value);
+  EXPECT_EQ(first, first);
+  EXPECT_NE(first, second);
+}
+
+TEST(StaticUnitVector, Constructor) {
+  constexpr Small small(scaled_first_value);
+  constexpr Large large(small);
+  EXPECT_EQ(large.Value(), first_value);
+  EXPECT_EQ(Small(large).Value(), scaled_first_value);
+  const Velocity quantity(first_value, Unit::Speed::MetrePerSecond);
+  EXPECT_EQ(Small(quantity).Value(), scaled_first_value);
+}
+
+TEST(StaticUnitVector, CopyAssignmentOperator) {
+  const Small first(first_value);
+  Small second = Small::Zero();
+  second = first;
+  EXPECT_EQ(second, first);
+}
+
+TEST(StaticUnitVector, CopyConstructor) {
+  const Small first(first_value);
+  const Small second{first};
+  EXPECT_EQ(second, first);
+}
+
+TEST(StaticUnitVector, DefaultConstructor) {
+  EXPECT_NO_THROW(Small{});
+}
+
+TEST(StaticUnitVector, Dimensions) {
+  EXPECT_EQ(Small::Dimensions(), RelatedDimensions<Unit::Speed>);
+}
+
+TEST(StaticUnitVector, Hash) {
+  const Small first(first_value);
+  const Small second(perturbed_first_value);
+  const Small third(second_value);
+  const std::hash<Small> hash;
+  EXPECT_NE(hash(first), hash(second));
+  EXPECT_NE(hash(first), hash(third));
+  EXPECT_NE(hash(second), hash(third));
+}
+
+TEST(StaticUnitVector, MoveAssignmentOperator) {
+  Small first(first_value);
+  Small second = Small::Zero();
+  second = std::move(first);
+  EXPECT_EQ(second, Small(first_value));
+}
+
+TEST(StaticUnitVector, MoveConstructor) {
+  Small first(first_value);
+  const Small second{std::move(first)};
+  EXPECT_EQ(second, Small(first_value));
+}
+
+TEST(StaticUnitVector, MutableValue) {
+  Small quantity(first_value);
+  Vector<double>& value = quantity.MutableValue();
+  value = second_value;
+  EXPECT_EQ(quantity.Value(), second_value);
+}
+
+TEST(StaticUnitVector, Print) {
+  EXPECT_EQ(Small(first_value).Print(), first_value.Print() + " mm/s");
+  EXPECT_EQ(Large(second_value).Print(), second_value.Print() + " m/s");
+}
+
+TEST(StaticUnitVector, SetValue) {
+  Small quantity(first_value);
+  quantity.SetValue(second_value);
+  EXPECT_EQ(quantity.Value(), second_value);
+}
+
+TEST(StaticUnitVector, SizeOf) {
+  EXPECT_EQ(sizeof(Small{}), sizeof(Vector<double>{}));
+}
+
+TEST(StaticUnitVector, StaticValue) {
+  constexpr Small quantity(scaled_first_value);
+  constexpr Vector<double> value = quantity.StaticValue<Unit::Speed::MetrePerSecond>();
+  EXPECT_EQ(value, first_value);
+}
+
+TEST(StaticUnitVector, Stream) {
+  std::ostringstream stream;
+  stream << Small(first_value);
+  EXPECT_EQ(stream.str(), Small(first_value).Print());
+}
+
+TEST(StaticUnitVector, ToQuantity) {
+  constexpr Large quantity(first_value);
+  constexpr Velocity converted = quantity.ToQuantity<Velocity<>>();
+  EXPECT_EQ(converted, Velocity<>::Create<Unit::Speed::MetrePerSecond>(first_value));
+  EXPECT_EQ(
+      Small(first_value).ToQuantity<Velocity<>>(),
+      Velocity(first_value, Unit::Speed::MillimetrePerSecond));
+}
+
+TEST(StaticUnitVector, Unit) {
+  EXPECT_EQ(Small::Unit(), Unit::Speed::MillimetrePerSecond);
+  EXPECT_EQ(Large::Unit(), Unit::Speed::MetrePerSecond);
+}
+
+TEST(StaticUnitVector, Value) {
+  EXPECT_EQ(Small(first_value).Value(), first_value);
+  EXPECT_EQ(Small(scaled_first_value).Value(Unit::Speed::MetrePerSecond), first_value);
+}
+
+TEST(StaticUnitVector, Zero) {
+  EXPECT_EQ(Small::Zero(), Small(Vector<double>::Zero()));
+}
+
+}  // namespace
+
+}  // namespace PhQ
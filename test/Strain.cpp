@@ -25,12 +25,15 @@
 #include "../include/PhQ/Strain.hpp"
 
 #include <array>
+#include <cmath>
 #include <functional>
 #include <gtest/gtest.h>
 #include <sstream>
 #include <utility>
 
 #include "../include/PhQ/Dimensions.hpp"
+#include "../include/PhQ/Direction.hpp"
+#include "../include/PhQ/ScalarStrain.hpp"
 #include "../include/PhQ/SymmetricDyad.hpp"
 
 namespace PhQ {
@@ -187,6 +190,21 @@ TEST(Strain, MutableValue) {
   EXPECT_EQ(strain.Value(), SymmetricDyad(-7.0, 8.0, -9.0, 10.0, -11.0, 12.0));
 }
 
+TEST(Strain, PrincipalStrains) {
+  const Strain strain(2.0, 1.0, 0.0, 2.0, 0.0, 5.0);
+  const std::array<ScalarStrain<>, 3> principal_strains{strain.PrincipalStrains()};
+  EXPECT_NEAR(principal_strains[0].Value(), 5.0, 1.0E-12);
+  EXPECT_NEAR(principal_strains[1].Value(), 3.0, 1.0E-12);
+  EXPECT_NEAR(principal_strains[2].Value(), 1.0, 1.0E-12);
+
+  const std::array<Direction<>, 3> principal_directions{strain.PrincipalDirections()};
+  EXPECT_NEAR(std::abs(principal_directions[0].z()), 1.0, 1.0E-12);
+  EXPECT_NEAR(principal_directions[1].x(), principal_directions[1].y(), 1.0E-12);
+  EXPECT_NEAR(principal_directions[2].x(), -principal_directions[2].y(), 1.0E-12);
+
+  EXPECT_NEAR(strain.MaximumShearStrain().Value(), 2.0, 1.0E-12);
+}
+
 TEST(Strain, Print) {
   EXPECT_EQ(Strain(1.0, -2.0, 3.0, -4.0, 5.0, -6.0).Print(),
             "(" + Print(1.0) + ", " + Print(-2.0) + ", " + Print(3.0) + "; " + Print(-4.0) + ", "
@@ -25,11 +25,13 @@
 #include "../include/PhQ/StrainRate.hpp"
 
 #include <array>
+#include <cmath>
 #include <functional>
 #include <gtest/gtest.h>
 #include <sstream>
 #include <utility>
 
+#include "../include/PhQ/Direction.hpp"
 #include "../include/PhQ/Frequency.hpp"
 #include "../include/PhQ/ScalarStrainRate.hpp"
 #include "../include/PhQ/Strain.hpp"
@@ -258,6 +260,22 @@ TEST(StrainRate, MutableValue) {
   EXPECT_EQ(strain_rate.Value(), SymmetricDyad(-7.0, 8.0, -9.0, 10.0, -11.0, 12.0));
 }
 
+TEST(StrainRate, PrincipalStrainRates) {
+  const StrainRate strain_rate({2.0, 1.0, 0.0, 2.0, 0.0, 5.0}, Unit::Frequency::Hertz);
+  const std::array<ScalarStrainRate<>, 3> principal_strain_rates{
+      strain_rate.PrincipalStrainRates()};
+  EXPECT_NEAR(principal_strain_rates[0].Value(), 5.0, 1.0E-12);
+  EXPECT_NEAR(principal_strain_rates[1].Value(), 3.0, 1.0E-12);
+  EXPECT_NEAR(principal_strain_rates[2].Value(), 1.0, 1.0E-12);
+
+  const std::array<Direction<>, 3> principal_directions{strain_rate.PrincipalDirections()};
+  EXPECT_NEAR(std::abs(principal_directions[0].z()), 1.0, 1.0E-12);
+  EXPECT_NEAR(principal_directions[1].x(), principal_directions[1].y(), 1.0E-12);
+  EXPECT_NEAR(principal_directions[2].x(), -principal_directions[2].y(), 1.0E-12);
+
+  EXPECT_NEAR(strain_rate.MaximumShearStrainRate().Value(), 2.0, 1.0E-12);
+}
+
 TEST(StrainRate, Print) {
   EXPECT_EQ(StrainRate({1.0, -2.0, 3.0, -4.0, 5.0, -6.0}, Unit::Frequency::Hertz).Print(),
             "(" + Print(1.0) + ", " + Print(-2.0) + ", " + Print(3.0) + "; " + Print(-4.0) + ", "
@@ -30,6 +30,7 @@
 #include <gtest/gtest.h>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #include "../include/PhQ/Direction.hpp"
 #include "../include/PhQ/PlanarDirection.hpp"
@@ -231,6 +232,9 @@ TEST(Stress, MiscellaneousMethods) {
                     * (std::pow(8.0 - 16.0, 2) + std::pow(16.0 - 32.0, 2) + std::pow(32.0 - 8.0, 2)
                        + 6.0 * (std::pow(1.0, 2) + std::pow(2.0, 2) + std::pow(4.0, 2)))),
           Unit::Pressure::Pascal));
+  EXPECT_EQ(
+      Stress<float>({8.0F, 1.0F, 2.0F, 16.0F, 4.0F, 32.0F}, Unit::Pressure::Pascal).VonMises(),
+      ScalarStress<float>(std::sqrt(511.0F), Unit::Pressure::Pascal));
 }
 
 TEST(Stress, MoveAssignmentOperator) {
@@ -253,6 +257,29 @@ TEST(Stress, MutableValue) {
   EXPECT_EQ(stress.Value(), SymmetricDyad(-7.0, 8.0, -9.0, 10.0, -11.0, 12.0));
 }
 
+TEST(Stress, PrincipalStresses) {
+  const Stress stress({2.0, 1.0, 0.0, 2.0, 0.0, 5.0}, Unit::Pressure::Pascal);
+  const std::array<ScalarStress<>, 3> principal_stresses{stress.PrincipalStresses()};
+  EXPECT_NEAR(principal_stresses[0].Value(), 5.0, 1.0E-12);
+  EXPECT_NEAR(principal_stresses[1].Value(), 3.0, 1.0E-12);
+  EXPECT_NEAR(principal_stresses[2].Value(), 1.0, 1.0E-12);
+
+  const std::array<Direction<>, 3> principal_directions{stress.PrincipalDirections()};
+  EXPECT_NEAR(std::abs(principal_directions[0].z()), 1.0, 1.0E-12);
+  EXPECT_NEAR(std::abs(principal_directions[1].x()), std::sqrt(0.5), 1.0E-12);
+  EXPECT_NEAR(principal_directions[1].x(), principal_directions[1].y(), 1.0E-12);
+  EXPECT_NEAR(std::abs(principal_directions[2].x()), std::sqrt(0.5), 1.0E-12);
+  EXPECT_NEAR(principal_directions[2].x(), -principal_directions[2].y(), 1.0E-12);
+
+  EXPECT_NEAR(stress.MaximumShearStress().Value(), 2.0, 1.0E-12);
+  EXPECT_NEAR(stress.Tresca().Value(), 4.0, 1.0E-12);
+  EXPECT_NEAR(Stress<float>({2.0F, 1.0F, 0.0F, 2.0F, 0.0F, 5.0F}, Unit::Pressure::Pascal)
+                  .Tresca()
+                  .Value(),
+              4.0F, 1.0E-5F);
+  EXPECT_EQ(Stress<>::Zero().Tresca(), ScalarStress<>::Zero());
+}
+
 TEST(Stress, Print) {
   EXPECT_EQ(Stress({1.0, -2.0, 3.0, -4.0, 5.0, -6.0}, Unit::Pressure::Pascal).Print(),
             "(" + Print(1.0) + ", " + Print(-2.0) + ", " + Print(3.0) + "; " + Print(-4.0) + ", "
@@ -269,6 +296,18 @@ TEST(Stress, SetValue) {
   EXPECT_EQ(stress.Value(), SymmetricDyad(-7.0, 8.0, -9.0, 10.0, -11.0, 12.0));
 }
 
+TEST(Stress, SetValues) {
+  const std::vector<SymmetricDyad<>> values{
+      {1.0, -2.0, 3.0, -4.0, 5.0, -6.0},
+      {-7.0, 8.0, -9.0, 10.0, -11.0, 12.0},
+  };
+  std::vector<Stress<>> stresses;
+  SetValues(values, Unit::Pressure::Kilopascal, stresses);
+  ASSERT_EQ(stresses.size(), 2);
+  EXPECT_EQ(stresses[0], Stress({1.0, -2.0, 3.0, -4.0, 5.0, -6.0}, Unit::Pressure::Kilopascal));
+  EXPECT_EQ(stresses[1], Stress({-7.0, 8.0, -9.0, 10.0, -11.0, 12.0}, Unit::Pressure::Kilopascal));
+}
+
 TEST(Stress, SizeOf) {
   EXPECT_EQ(sizeof(Stress<>{}), 6 * sizeof(double));
 }
@@ -295,6 +334,18 @@ TEST(Stress, Value) {
             SymmetricDyad(1.0, -2.0, 3.0, -4.0, 5.0, -6.0));
 }
 
+TEST(Stress, Values) {
+  const std::vector<Stress<>> stresses{
+      Stress({1.0, -2.0, 3.0, -4.0, 5.0, -6.0}, Unit::Pressure::Pascal),
+      Stress({-7.0, 8.0, -9.0, 10.0, -11.0, 12.0}, Unit::Pressure::Pascal),
+  };
+  const std::vector<SymmetricDyad<>> values{Values(stresses, Unit::Pressure::Kilopascal)};
+  ASSERT_EQ(values.size(), 2);
+  EXPECT_EQ(values[0], stresses[0].Value(Unit::Pressure::Kilopascal));
+  EXPECT_EQ(values[1], stresses[1].Value(Unit::Pressure::Kilopascal));
+  EXPECT_EQ(Values(stresses, Unit::Pressure::Pascal)[1], stresses[1].Value());
+}
+
 TEST(Stress, XML) {
   EXPECT_EQ(Stress({1.0, -2.0, 3.0, -4.0, 5.0, -6.0}, Unit::Pressure::Pascal).XML(),
             "<value><xx>" + Print(1.0) + "</xx><xy>" + Print(-2.0) + "</xy><xz>" + Print(3.0)
@@ -25,13 +25,17 @@
 #include "../include/PhQ/SymmetricDyad.hpp"
 
 #include <array>
+#include <cmath>
+#include <cstddef>
 #include <functional>
 #include <gtest/gtest.h>
 #include <optional>
 #include <sstream>
+#include <string>
 #include <utility>
 
 #include "../include/PhQ/Base.hpp"
+#include "../include/PhQ/Direction.hpp"
 #include "../include/PhQ/PlanarVector.hpp"
 #include "../include/PhQ/Vector.hpp"
 
@@ -527,6 +531,55 @@ TEST(SymmetricDyad, Determinant) {
   EXPECT_EQ(SymmetricDyad(8.0L, 2.0L, 1.0L, 16.0L, 4.0L, 32.0L).Determinant(), 3840.0L);
 }
 
+TEST(SymmetricDyad, Eigenvalues) {
+  const std::array<double, 3> eigenvalues{
+      SymmetricDyad(2.0, 1.0, 0.0, 2.0, 0.0, 5.0).Eigenvalues()};
+  EXPECT_NEAR(eigenvalues[0], 5.0, 1.0E-12);
+  EXPECT_NEAR(eigenvalues[1], 3.0, 1.0E-12);
+  EXPECT_NEAR(eigenvalues[2], 1.0, 1.0E-12);
+
+  const std::array<float, 3> single{
+      SymmetricDyad(1.0F, 0.0F, 0.0F, 3.0F, 0.0F, 2.0F).Eigenvalues()};
+  EXPECT_NEAR(single[0], 3.0F, 1.0E-5F);
+  EXPECT_NEAR(single[1], 2.0F, 1.0E-5F);
+  EXPECT_NEAR(single[2], 1.0F, 1.0E-5F);
+
+  EXPECT_EQ(SymmetricDyad<>::Zero().Eigenvalues(), (std::array<double, 3>{0.0, 0.0, 0.0}));
+  EXPECT_EQ(SymmetricDyad(2.0, 0.0, 0.0, 2.0, 0.0, 2.0).Eigenvalues(),
+            (std::array<double, 3>{2.0, 2.0, 2.0}));
+
+  const std::array<double, 3> repeated{
+      SymmetricDyad(3.0, 0.0, 0.0, 1.0, 0.0, 1.0).Eigenvalues()};
+  EXPECT_NEAR(repeated[0], 3.0, 1.0E-12);
+  EXPECT_NEAR(repeated[1], 1.0, 1.0E-12);
+  EXPECT_NEAR(repeated[2], 1.0, 1.0E-12);
+}
+
+TEST(SymmetricDyad, Eigenvectors) {
+  for (const SymmetricDyad<>& symmetric_dyad :
+       {SymmetricDyad(2.0, 1.0, 0.0, 2.0, 0.0, 5.0), SymmetricDyad(1.0, -2.0, 3.0, -4.0, 5.0, -6.0),
+        SymmetricDyad(3.0, 0.0, 0.0, 1.0, 0.0, 1.0), SymmetricDyad(1.0, 0.0, 0.0, 1.0, 0.0, 3.0),
+        SymmetricDyad(2.0, 0.0, 0.0, 2.0, 0.0, 2.0), SymmetricDyad<>::Zero()}) {
+    const std::array<double, 3> eigenvalues{symmetric_dyad.Eigenvalues()};
+    const std::array<Direction<>, 3> eigenvectors{symmetric_dyad.Eigenvectors()};
+    for (std::size_t index = 0; index < 3; ++index) {
+      const Vector<> residual{symmetric_dyad * eigenvectors[index]
+                              - eigenvectors[index].Value() * eigenvalues[index]};
+      EXPECT_NEAR(residual.Magnitude(), 0.0, 1.0E-12);
+    }
+    EXPECT_NEAR(eigenvectors[0].Dot(eigenvectors[1]), 0.0, 1.0E-12);
+    EXPECT_NEAR(eigenvectors[1].Dot(eigenvectors[2]), 0.0, 1.0E-12);
+    EXPECT_NEAR(eigenvectors[0].Value().Cross(eigenvectors[1].Value()).Dot(eigenvectors[2]), 1.0,
+                1.0E-12);
+  }
+
+  const std::array<Direction<>, 3> eigenvectors{
+      SymmetricDyad(2.0, 1.0, 0.0, 2.0, 0.0, 5.0).Eigenvectors()};
+  EXPECT_NEAR(std::abs(eigenvectors[0].z()), 1.0, 1.0E-12);
+  EXPECT_NEAR(std::abs(eigenvectors[1].x() + eigenvectors[1].y()), std::sqrt(2.0), 1.0E-12);
+  EXPECT_NEAR(std::abs(eigenvectors[2].x() - eigenvectors[2].y()), std::sqrt(2.0), 1.0E-12);
+}
+
 TEST(SymmetricDyad, Hash) {
   {
     constexpr SymmetricDyad first{1.0F, -2.0F, 3.0F, -4.0F, 5.0F, -6.0F};
@@ -621,6 +674,17 @@ TEST(SymmetricDyad, JSON) {
       SymmetricDyad(1.0L, -2.0L, 3.0L, -4.0L, 5.0L, -6.0L).JSON(),
       "{\"xx\":" + Print(1.0L) + ",\"xy\":" + Print(-2.0L) + ",\"xz\":" + Print(3.0L)
           + ",\"yy\":" + Print(-4.0L) + ",\"yz\":" + Print(5.0L) + ",\"zz\":" + Print(-6.0L) + "}");
+  const SymmetricDyad symmetric_dyad(1.0F, -2.0F, 3.0F, -4.0F, 5.0F, -6.0F);
+  std::string string{"prefix:"};
+  symmetric_dyad.AppendJSON(string);
+  EXPECT_EQ(string,
+            R"(prefix:{"xx":1.000000000,"xy":-2.000000000,"xz":3.000000000,"yy":-4.000000000,)"
+            R"("yz":5.000000000,"zz":-6.000000000})");
+  char buffer[128];
+  char* const end{symmetric_dyad.WriteJSON(buffer)};
+  EXPECT_EQ(std::string(buffer, end),
+            R"({"xx":1.000000000,"xy":-2.000000000,"xz":3.000000000,"yy":-4.000000000,)"
+            R"("yz":5.000000000,"zz":-6.000000000})");
 }
 
 TEST(SymmetricDyad, MoveAssignmentOperator) {
@@ -912,6 +976,17 @@ TEST(SymmetricDyad, XML) {
       SymmetricDyad(1.0L, -2.0L, 3.0L, -4.0L, 5.0L, -6.0L).XML(),
       "<xx>" + Print(1.0L) + "</xx><xy>" + Print(-2.0L) + "</xy><xz>" + Print(3.0L) + "</xz><yy>"
           + Print(-4.0L) + "</yy><yz>" + Print(5.0L) + "</yz><zz>" + Print(-6.0L) + "</zz>");
+  const SymmetricDyad symmetric_dyad(1.0F, -2.0F, 3.0F, -4.0F, 5.0F, -6.0F);
+  std::string string{"prefix:"};
+  symmetric_dyad.AppendXML(string);
+  EXPECT_EQ(string,
+            R"(prefix:<xx>1.000000000</xx><xy>-2.000000000</xy><xz>3.000000000</xz>)"
+            R"(<yy>-4.000000000</yy><yz>5.000000000</yz><zz>-6.000000000</zz>)");
+  char buffer[128];
+  char* const end{symmetric_dyad.WriteXML(buffer)};
+  EXPECT_EQ(std::string(buffer, end),
+            R"(<xx>1.000000000</xx><xy>-2.000000000</xy><xz>3.000000000</xz><yy>-4.000000000)"
+            R"(</yy><yz>5.000000000</yz><zz>-6.000000000</zz>)");
 }
 
 TEST(SymmetricDyad, YAML) {
@@ -924,6 +999,17 @@ TEST(SymmetricDyad, YAML) {
   EXPECT_EQ(SymmetricDyad(1.0L, -2.0L, 3.0L, -4.0L, 5.0L, -6.0L).YAML(),
             "{xx:" + Print(1.0L) + ",xy:" + Print(-2.0L) + ",xz:" + Print(3.0L)
                 + ",yy:" + Print(-4.0L) + ",yz:" + Print(5.0L) + ",zz:" + Print(-6.0L) + "}");
+  const SymmetricDyad symmetric_dyad(1.0F, -2.0F, 3.0F, -4.0F, 5.0F, -6.0F);
+  std::string string{"prefix:"};
+  symmetric_dyad.AppendYAML(string);
+  EXPECT_EQ(string,
+            R"(prefix:{xx:1.000000000,xy:-2.000000000,xz:3.000000000,yy:-4.000000000,)"
+            R"(yz:5.000000000,zz:-6.000000000})");
+  char buffer[128];
+  char* const end{symmetric_dyad.WriteYAML(buffer)};
+  EXPECT_EQ(std::string(buffer, end),
+            R"({xx:1.000000000,xy:-2.000000000,xz:3.000000000,yy:-4.000000000,yz:5.000000000,)"
+            R"(zz:-6.000000000})");
 }
 
 TEST(SymmetricDyad, Zero) {
@@ -0,0 +1,306 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/SymmetricDyadField.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "../include/PhQ/Direction.hpp"
+#include "../include/PhQ/StaticPressure.hpp"
+#include "../include/PhQ/Strain.hpp"
+#include "../include/PhQ/StrainRate.hpp"
+#include "../include/PhQ/Stress.hpp"
+#include "../include/PhQ/VectorField.hpp"
+
+namespace PhQ {
+
+namespace {
+
+const std::vector<Stress<>> stresses{
+    Stress<>({8.0, 1.0, 2.0, 16.0, 4.0, 32.0}, Unit::Pressure::Pascal),
+    Stress<>({0.0, 0.0, 0.0, 0.0, 0.0, 0.0}, Unit::Pressure::Pascal),
+    Stress<>({1.0, -2.0, 3.0, -4.0, 5.0, -6.0}, Unit::Pressure::Kilopascal),
+    Stress<>({-0.5, 0.25, 0.0, 2.0, -1.0, 0.75}, Unit::Pressure::Pascal),
+};
+
+TEST(SymmetricDyadField, AddScaled) {
+  SymmetricDyadField<Stress<>> field{stresses};
+  const SymmetricDyadField<Stress<>> other{stresses};
+  field.AddScaled(2.0, other);
+  for (std::size_t index = 0; index < stresses.size(); ++index) {
+    EXPECT_EQ(field[index], stresses[index] * 3.0);
+  }
+}
+
+TEST(SymmetricDyadField, Alignment) {
+  const SymmetricDyadField<Stress<>> field{stresses};
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(field.xx()) % Internal::FieldAlignment, 0);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(field.xy()) % Internal::FieldAlignment, 0);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(field.xz()) % Internal::FieldAlignment, 0);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(field.yy()) % Internal::FieldAlignment, 0);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(field.yz()) % Internal::FieldAlignment, 0);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(field.zz()) % Internal::FieldAlignment, 0);
+}
+
+TEST(SymmetricDyadField, ArithmeticOperators) {
+  const SymmetricDyadField<Stress<>> field{stresses};
+  const SymmetricDyadField<Stress<>> sum{field + field};
+  const SymmetricDyadField<Stress<>> difference{field - field};
+  const SymmetricDyadField<Stress<>> product{field * 2.0};
+  const SymmetricDyadField<Stress<>> reversed_product{2.0 * field};
+  const SymmetricDyadField<Stress<>> quotient{field / 2.0};
+  for (std::size_t index = 0; index < stresses.size(); ++index) {
+    EXPECT_EQ(sum[index], stresses[index] + stresses[index]);
+    EXPECT_EQ(difference[index], Stress<>::Zero());
+    EXPECT_EQ(product[index], stresses[index] * 2.0);
+    EXPECT_EQ(reversed_product[index], stresses[index] * 2.0);
+    EXPECT_EQ(quotient[index], stresses[index] / 2.0);
+  }
+}
+
+TEST(SymmetricDyadField, ComparisonOperators) {
+  const SymmetricDyadField<Stress<>> first{stresses};
+  SymmetricDyadField<Stress<>> second{stresses};
+  EXPECT_EQ(first, second);
+  second[1] = Stress<>({1.0, 0.0, 0.0, 0.0, 0.0, 0.0}, Unit::Pressure::Pascal);
+  EXPECT_NE(first, second);
+}
+
+TEST(SymmetricDyadField, Components) {
+  const SymmetricDyadField<Stress<>> field{stresses};
+  EXPECT_EQ(field.xx()[2], 1000.0);
+  EXPECT_EQ(field.xy()[2], -2000.0);
+  EXPECT_EQ(field.xz()[2], 3000.0);
+  EXPECT_EQ(field.yy()[0], 16.0);
+  EXPECT_EQ(field.yz()[0], 4.0);
+  EXPECT_EQ(field.zz()[3], 0.75);
+}
+
+TEST(SymmetricDyadField, Constructors) {
+  const SymmetricDyadField<Stress<>> empty;
+  EXPECT_TRUE(empty.Empty());
+  const SymmetricDyadField<Stress<>> zeros(3);
+  EXPECT_EQ(zeros.Size(), 3);
+  EXPECT_EQ(zeros[2], Stress<>::Zero());
+  const SymmetricDyadField<Stress<>> copies(2, stresses[0]);
+  EXPECT_EQ(copies[1], stresses[0]);
+  const SymmetricDyadField<Stress<>> field{stresses.data(), stresses.size()};
+  EXPECT_EQ(field.Quantities(), stresses);
+}
+
+TEST(SymmetricDyadField, Determinant) {
+  const SymmetricDyadField<Stress<>> field{stresses};
+  const std::vector<double> determinants{field.Determinant()};
+  ASSERT_EQ(determinants.size(), stresses.size());
+  for (std::size_t index = 0; index < stresses.size(); ++index) {
+    EXPECT_DOUBLE_EQ(determinants[index], stresses[index].Value().Determinant());
+  }
+}
+
+TEST(SymmetricDyadField, Deviatoric) {
+  const SymmetricDyadField<Stress<>> field{stresses};
+  const SymmetricDyadField<Stress<>> deviatoric{field.Deviatoric()};
+  ASSERT_EQ(deviatoric.Size(), stresses.size());
+  for (std::size_t index = 0; index < stresses.size(); ++index) {
+    const SymmetricDyad<> value{stresses[index].Value()};
+    const double mean{value.Trace() / 3.0};
+    EXPECT_DOUBLE_EQ(deviatoric.xx()[index], value.xx() - mean);
+    EXPECT_EQ(deviatoric.xy()[index], value.xy());
+    EXPECT_EQ(deviatoric.xz()[index], value.xz());
+    EXPECT_DOUBLE_EQ(deviatoric.yy()[index], value.yy() - mean);
+    EXPECT_EQ(deviatoric.yz()[index], value.yz());
+    EXPECT_DOUBLE_EQ(deviatoric.zz()[index], value.zz() - mean);
+  }
+}
+
+TEST(SymmetricDyadField, FrobeniusNorm) {
+  const SymmetricDyadField<Stress<>> field{stresses};
+  const std::vector<ScalarStress<>> norms{field.FrobeniusNorm()};
+  ASSERT_EQ(norms.size(), stresses.size());
+  EXPECT_EQ(norms[0], ScalarStress<>(std::sqrt(1386.0), Unit::Pressure::Pascal));
+  EXPECT_EQ(norms[1], ScalarStress<>::Zero());
+}
+
+TEST(SymmetricDyadField, HydrostaticPressure) {
+  const SymmetricDyadField<Stress<>> field{std::vector{
+      Stress<>(StaticPressure<>(101325.0, Unit::Pressure::Pascal)),
+      Stress<>({3.0, 1.0, 2.0, 6.0, 4.0, 9.0}, Unit::Pressure::Pascal),
+  }};
+  const std::vector<StaticPressure<>> pressures{field.HydrostaticPressure()};
+  ASSERT_EQ(pressures.size(), 2);
+  EXPECT_DOUBLE_EQ(pressures[0].Value(), 101325.0);
+  EXPECT_DOUBLE_EQ(pressures[1].Value(), -6.0);
+}
+
+TEST(SymmetricDyadField, LargeField) {
+  std::vector<Stress<>> many;
+  for (std::size_t index = 0; index < 1001; ++index) {
+    const double value{static_cast<double>(index)};
+    many.emplace_back(SymmetricDyad<>{value, -0.5 * value, 2.0, 1.0, 0.25 * value, -value},
+                      Unit::Pressure::Pascal);
+  }
+  const SymmetricDyadField<Stress<>> field{many};
+  const std::vector<ScalarStress<>> von_mises{field.VonMises()};
+  const std::vector<double> determinants{field.Determinant()};
+  for (std::size_t index = 0; index < many.size(); ++index) {
+    EXPECT_DOUBLE_EQ(von_mises[index].Value(), many[index].VonMises().Value());
+    EXPECT_DOUBLE_EQ(determinants[index], many[index].Value().Determinant());
+  }
+}
+
+TEST(SymmetricDyadField, Modifiers) {
+  SymmetricDyadField<Stress<>> field;
+  field.Reserve(2);
+  field.PushBack(stresses[0]);
+  field.PushBack(stresses[2]);
+  EXPECT_EQ(field.Size(), 2);
+  EXPECT_EQ(field[1], stresses[2]);
+  field.Resize(3);
+  EXPECT_EQ(field[2], Stress<>::Zero());
+  field.Clear();
+  EXPECT_TRUE(field.Empty());
+}
+
+TEST(SymmetricDyadField, OtherQuantities) {
+  const SymmetricDyadField<Strain<>> strains{std::vector{
+      Strain<>(0.001, 0.0, 0.0, -0.002, 0.0, 0.004),
+      Strain<>(0.0, 0.5, 0.0, 0.0, 0.0, 0.0),
+  }};
+  EXPECT_EQ(strains[0], Strain<>(0.001, 0.0, 0.0, -0.002, 0.0, 0.004));
+  const std::vector<ScalarStrain<>> traces{strains.Trace()};
+  EXPECT_DOUBLE_EQ(traces[0].Value(), 0.003);
+  const std::vector<ScalarStrain<>> norms{strains.FrobeniusNorm()};
+  EXPECT_DOUBLE_EQ(norms[1].Value(), std::sqrt(0.5));
+
+  const SymmetricDyadField<StrainRate<>> strain_rates(
+      2, StrainRate<>({1.0, 0.0, 0.0, 2.0, 0.0, 3.0}, Unit::Frequency::Hertz));
+  const std::vector<ScalarStrainRate<>> rates{strain_rates.Trace()};
+  EXPECT_EQ(rates[1], ScalarStrainRate<>(6.0, Unit::Frequency::Hertz));
+
+  const SymmetricDyadField<SymmetricDyad<>> dyads{
+      std::vector{SymmetricDyad<>(1.0, 2.0, 3.0, 4.0, 5.0, 6.0)}};
+  EXPECT_EQ(dyads[0], SymmetricDyad<>(1.0, 2.0, 3.0, 4.0, 5.0, 6.0));
+  EXPECT_EQ(dyads.Trace()[0], 11.0);
+  EXPECT_EQ(dyads.Determinant()[0], SymmetricDyad<>(1.0, 2.0, 3.0, 4.0, 5.0, 6.0).Determinant());
+}
+
+TEST(SymmetricDyadField, PrincipalValues) {
+  std::vector<Stress<>> many_stresses;
+  for (std::size_t index = 0; index < 41; ++index) {
+    const double value{static_cast<double>(index)};
+    many_stresses.emplace_back(
+        SymmetricDyad<>(std::sin(value), 0.5 * std::cos(value), 0.25, 2.0 - std::cos(value),
+                        -0.125 * value, std::sin(2.0 * value)),
+        Unit::Pressure::Pascal);
+  }
+  many_stresses.push_back(Stress<>::Zero());
+  many_stresses.emplace_back(SymmetricDyad<>(3.0, 0.0, 0.0, 3.0, 0.0, 3.0), Unit::Pressure::Pascal);
+  const SymmetricDyadField<Stress<>> field{many_stresses};
+
+  const std::array<std::vector<ScalarStress<>>, 3> principal_values{field.PrincipalValues()};
+  const std::array<VectorField<Direction<>>, 3> principal_directions{field.PrincipalDirections()};
+  const std::vector<ScalarStress<>> maximum_shears{field.MaximumShear()};
+  const std::vector<ScalarStress<>> tresca{field.Tresca()};
+  for (std::size_t index = 0; index < many_stresses.size(); ++index) {
+    const std::array<ScalarStress<>, 3> expected{many_stresses[index].PrincipalStresses()};
+    const std::array<Direction<>, 3> expected_directions{
+        many_stresses[index].PrincipalDirections()};
+    for (std::size_t rank = 0; rank < 3; ++rank) {
+      EXPECT_NEAR(principal_values[rank][index].Value(), expected[rank].Value(), 1.0E-12);
+    }
+    EXPECT_NEAR(maximum_shears[index].Value(),
+                many_stresses[index].MaximumShearStress().Value(), 1.0E-12);
+    EXPECT_NEAR(tresca[index].Value(), many_stresses[index].Tresca().Value(), 1.0E-12);
+    if (expected[0].Value() - expected[1].Value() > 1.0E-6
+        && expected[1].Value() - expected[2].Value() > 1.0E-6) {
+      for (std::size_t rank = 0; rank < 3; ++rank) {
+        EXPECT_NEAR(
+            std::abs(principal_directions[rank][index].Dot(expected_directions[rank])), 1.0,
+            1.0E-9);
+      }
+    }
+  }
+  EXPECT_EQ(tresca[41], ScalarStress<>::Zero());
+  EXPECT_NEAR(principal_values[1][42].Value(), 3.0, 1.0E-12);
+
+  const SymmetricDyadField<Strain<>> strains{
+      std::vector{Strain<>(2.0, 1.0, 0.0, 2.0, 0.0, 5.0)}};
+  EXPECT_NEAR(strains.MaximumShear()[0].Value(), 2.0, 1.0E-12);
+}
+
+TEST(SymmetricDyadField, Reference) {
+  SymmetricDyadField<Stress<>> field{stresses};
+  const Stress<> stress{field[0]};
+  EXPECT_EQ(stress, stresses[0]);
+  EXPECT_EQ(field[0].Value(), stresses[0].Value());
+  field[1] = stresses[3];
+  EXPECT_EQ(field[1], stresses[3]);
+  field[1] = field[0];
+  EXPECT_EQ(stresses[0], field[1]);
+  field[0] += stresses[0];
+  EXPECT_EQ(field[0], stresses[0] * 2.0);
+  field[0] -= stresses[0];
+  EXPECT_EQ(field[0], stresses[0]);
+  field[0] *= 4.0;
+  EXPECT_EQ(field[0], stresses[0] * 4.0);
+  field[0] /= 4.0;
+  EXPECT_EQ(field[0], stresses[0]);
+  EXPECT_NE(field[0], stresses[2]);
+}
+
+TEST(SymmetricDyadField, Trace) {
+  const SymmetricDyadField<Stress<>> field{stresses};
+  const std::vector<ScalarStress<>> traces{field.Trace()};
+  ASSERT_EQ(traces.size(), stresses.size());
+  EXPECT_EQ(traces[0], ScalarStress<>(56.0, Unit::Pressure::Pascal));
+  EXPECT_EQ(traces[1], ScalarStress<>::Zero());
+  EXPECT_EQ(traces[2], ScalarStress<>(-9.0, Unit::Pressure::Kilopascal));
+  std::vector<ScalarStress<>> output(stresses.size(), ScalarStress<>::Zero());
+  field.Trace(output.data());
+  EXPECT_EQ(output, traces);
+}
+
+TEST(SymmetricDyadField, VonMises) {
+  const SymmetricDyadField<Stress<>> field{stresses};
+  const std::vector<ScalarStress<>> von_mises{field.VonMises()};
+  ASSERT_EQ(von_mises.size(), stresses.size());
+  for (std::size_t index = 0; index < stresses.size(); ++index) {
+    EXPECT_DOUBLE_EQ(von_mises[index].Value(), stresses[index].VonMises().Value());
+  }
+  EXPECT_EQ(von_mises[0], ScalarStress<>(std::sqrt(511.0), Unit::Pressure::Pascal));
+
+  const SymmetricDyadField<Stress<float>> single_precision(
+      40, Stress<float>({8.0F, 1.0F, 2.0F, 16.0F, 4.0F, 32.0F}, Unit::Pressure::Pascal));
+  const std::vector<ScalarStress<float>> single_precision_von_mises{single_precision.VonMises()};
+  EXPECT_FLOAT_EQ(single_precision_von_mises[39].Value(), std::sqrt(511.0F));
+}
+
+}  // namespace
+
+}  // namespace PhQ
@@ -27,6 +27,7 @@
 #include <functional>
 #include <gtest/gtest.h>
 #include <sstream>
+#include <string>
 #include <utility>
 
 #include "../include/PhQ/Unit/Time.hpp"
@@ -162,6 +163,13 @@ TEST(Time, JSON) {
   EXPECT_EQ(Time(1.0, Unit::Time::Second).JSON(), "{\"value\":" + Print(1.0) + ",\"unit\":\"s\"}");
   EXPECT_EQ(Time(1.0, Unit::Time::Minute).JSON(Unit::Time::Minute),
             "{\"value\":" + Print(1.0) + ",\"unit\":\"min\"}");
+  const Time time(1.0F, Unit::Time::Minute);
+  std::string string{"prefix:"};
+  time.AppendJSON(string);
+  EXPECT_EQ(string, R"(prefix:{"value":60.00000000,"unit":"s"})");
+  char buffer[64];
+  char* const end{time.WriteJSON(buffer)};
+  EXPECT_EQ(std::string(buffer, end), R"({"value":60.00000000,"unit":"s"})");
 }
 
 TEST(Time, MoveAssignmentOperator) {
@@ -224,12 +232,26 @@ TEST(Time, XML) {
   EXPECT_EQ(Time(1.0, Unit::Time::Second).XML(), "<value>" + Print(1.0) + "</value><unit>s</unit>");
   EXPECT_EQ(Time(1.0, Unit::Time::Minute).XML(Unit::Time::Minute),
             "<value>" + Print(1.0) + "</value><unit>min</unit>");
+  const Time time(1.0F, Unit::Time::Minute);
+  std::string string{"prefix:"};
+  time.AppendXML(string, Unit::Time::Minute);
+  EXPECT_EQ(string, R"(prefix:<value>1.000000000</value><unit>min</unit>)");
+  char buffer[64];
+  char* const end{time.WriteXML(buffer, Unit::Time::Minute)};
+  EXPECT_EQ(std::string(buffer, end), R"(<value>1.000000000</value><unit>min</unit>)");
 }
 
 TEST(Time, YAML) {
   EXPECT_EQ(Time(1.0, Unit::Time::Second).YAML(), "{value:" + Print(1.0) + ",unit:\"s\"}");
   EXPECT_EQ(Time(1.0, Unit::Time::Minute).YAML(Unit::Time::Minute),
             "{value:" + Print(1.0) + ",unit:\"min\"}");
+  const Time time(1.0F, Unit::Time::Minute);
+  std::string string{"prefix:"};
+  time.AppendYAML(string, Unit::Time::Minute);
+  EXPECT_EQ(string, R"(prefix:{value:1.000000000,unit:"min"})");
+  char buffer[64];
+  char* const end{time.WriteYAML(buffer, Unit::Time::Minute)};
+  EXPECT_EQ(std::string(buffer, end), R"({value:1.000000000,unit:"min"})");
 }
 
 TEST(Time, Zero) {
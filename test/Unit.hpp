@@ -26,6 +26,12 @@
 #define PHYSICAL_QUANTITIES_TEST_UNIT_HPP
 
 #include <gtest/gtest.h>
+#include <type_traits>
+#include <vector>
+
+#if __cplusplus >= 202002L
+  #include <span>
+#endif
 
 #include "../include/PhQ/Dyad.hpp"
 #include "../include/PhQ/PlanarVector.hpp"
@@ -35,12 +41,108 @@
 
 namespace PhQ::Internal {
 
+/// \brief Tests that the single-step conversion used by the PhQ::ConvertInPlace and PhQ::Convert
+/// functions agrees with the two-step conversion that goes through the standard unit of measure for
+/// a given pair of units of measure and a given value.
+template <typename Unit, typename NumericType>
+void TestConvertFused(const Unit original_unit, const Unit new_unit, const NumericType value) {
+  NumericType fused{value};
+  PhQ::ConvertInPlace(fused, original_unit, new_unit);
+
+  NumericType two_step{value};
+  ConversionToStandard<NumericType>(original_unit).Apply(two_step);
+  ConversionFromStandard<NumericType>(new_unit).Apply(two_step);
+
+  std::vector<NumericType> fused_std_vector{value, value, value};
+  PhQ::ConvertInPlace(fused_std_vector, original_unit, new_unit);
+
+  const std::vector<NumericType> input{value, value, value};
+  std::vector<NumericType> output(input.size());
+  PhQ::Convert(input.data(), output.data(), input.size(), original_unit, new_unit);
+
+  if constexpr (std::is_same_v<NumericType, float>) {
+    EXPECT_FLOAT_EQ(fused, two_step);
+    EXPECT_FLOAT_EQ(fused_std_vector[0], two_step);
+    EXPECT_FLOAT_EQ(fused_std_vector[1], two_step);
+    EXPECT_FLOAT_EQ(fused_std_vector[2], two_step);
+    EXPECT_FLOAT_EQ(output[0], two_step);
+    EXPECT_FLOAT_EQ(output[1], two_step);
+    EXPECT_FLOAT_EQ(output[2], two_step);
+  } else {
+    EXPECT_DOUBLE_EQ(fused, two_step);
+    EXPECT_DOUBLE_EQ(fused_std_vector[0], two_step);
+    EXPECT_DOUBLE_EQ(fused_std_vector[1], two_step);
+    EXPECT_DOUBLE_EQ(fused_std_vector[2], two_step);
+    EXPECT_DOUBLE_EQ(output[0], two_step);
+    EXPECT_DOUBLE_EQ(output[1], two_step);
+    EXPECT_DOUBLE_EQ(output[2], two_step);
+  }
+  EXPECT_EQ(input, std::vector<NumericType>({value, value, value}));
+
+  std::vector<NumericType> unchanged(input.size());
+  PhQ::Convert(input.data(), unchanged.data(), input.size(), original_unit, original_unit);
+  EXPECT_EQ(unchanged, input);
+
+  const std::vector<PlanarVector<NumericType>> planar_vectors(
+      2, PlanarVector<NumericType>(value, value));
+  std::vector<PlanarVector<NumericType>> converted_planar_vectors{planar_vectors};
+  PhQ::ConvertInPlace(converted_planar_vectors, original_unit, new_unit);
+  EXPECT_EQ(converted_planar_vectors,
+            std::vector<PlanarVector<NumericType>>(
+                2, PhQ::Convert(planar_vectors[0], original_unit, new_unit)));
+  EXPECT_EQ(PhQ::Convert(planar_vectors, original_unit, new_unit), converted_planar_vectors);
+
+  const std::vector<Vector<NumericType>> vectors(2, Vector<NumericType>(value, value, value));
+  std::vector<Vector<NumericType>> converted_vectors{vectors};
+  PhQ::ConvertInPlace(converted_vectors, original_unit, new_unit);
+  EXPECT_EQ(converted_vectors, std::vector<Vector<NumericType>>(
+                                   2, PhQ::Convert(vectors[0], original_unit, new_unit)));
+  EXPECT_EQ(PhQ::Convert(vectors, original_unit, new_unit), converted_vectors);
+
+  const std::vector<SymmetricDyad<NumericType>> symmetric_dyads(
+      2, SymmetricDyad<NumericType>(value, value, value, value, value, value));
+  std::vector<SymmetricDyad<NumericType>> converted_symmetric_dyads{symmetric_dyads};
+  PhQ::ConvertInPlace(converted_symmetric_dyads, original_unit, new_unit);
+  EXPECT_EQ(converted_symmetric_dyads,
+            std::vector<SymmetricDyad<NumericType>>(
+                2, PhQ::Convert(symmetric_dyads[0], original_unit, new_unit)));
+  EXPECT_EQ(PhQ::Convert(symmetric_dyads, original_unit, new_unit), converted_symmetric_dyads);
+
+  const std::vector<Dyad<NumericType>> dyads(
+      2, Dyad<NumericType>(value, value, value, value, value, value, value, value, value));
+  std::vector<Dyad<NumericType>> converted_dyads{dyads};
+  PhQ::ConvertInPlace(converted_dyads, original_unit, new_unit);
+  EXPECT_EQ(converted_dyads, std::vector<Dyad<NumericType>>(
+                                 2, PhQ::Convert(dyads[0], original_unit, new_unit)));
+  EXPECT_EQ(PhQ::Convert(dyads, original_unit, new_unit), converted_dyads);
+
+#if __cplusplus >= 202002L
+  std::vector<NumericType> span_output(input.size());
+  EXPECT_TRUE(PhQ::Convert(std::span<const NumericType>{input},
+                           std::span<NumericType>{span_output}, original_unit, new_unit));
+  EXPECT_EQ(span_output, output);
+
+  std::vector<NumericType> short_span_output(input.size() - 1, value);
+  EXPECT_FALSE(PhQ::Convert(std::span<const NumericType>{input},
+                            std::span<NumericType>{short_span_output}, original_unit, new_unit));
+  EXPECT_EQ(short_span_output, std::vector<NumericType>(input.size() - 1, value));
+#endif  // __cplusplus >= 202002L
+}
+
 /// \brief Tests the PhQ::ConvertInPlace and PhQ::Convert unit conversion functions for a given unit
 /// of measure. Verifies that a given first value expressed in a given first unit correctly converts
 /// to a given second value expressed in a given second unit, and vice-versa.
 template <typename Unit>
 void TestConvert(const Unit first_unit, const Unit second_unit, const long double first_value,
                  const long double second_value) {
+  // Single-step conversion versus two-step conversion.
+  TestConvertFused(first_unit, second_unit, static_cast<float>(first_value));
+  TestConvertFused(second_unit, first_unit, static_cast<float>(second_value));
+  TestConvertFused(first_unit, second_unit, static_cast<double>(first_value));
+  TestConvertFused(second_unit, first_unit, static_cast<double>(second_value));
+  TestConvertFused(first_unit, second_unit, first_value);
+  TestConvertFused(second_unit, first_unit, second_value);
+
   // PhQ::ConvertInPlace(float)
   {
     float converted_value{static_cast<float>(first_value)};
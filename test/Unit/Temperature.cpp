@@ -75,6 +75,8 @@ TEST(UnitTemperature, Convert) {
       Temperature::Kelvin, Temperature::Rankine, value, value * 1.8L);
   Internal::TestConvert<Temperature>(
       Temperature::Kelvin, Temperature::Fahrenheit, value, (value * 1.8L) - 459.67L);
+  Internal::TestConvert<Temperature>(
+      Temperature::Celsius, Temperature::Fahrenheit, value, (value * 1.8L) + 32.0L);
 }
 
 TEST(UnitTemperature, ConvertStatically) {
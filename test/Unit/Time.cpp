@@ -50,6 +50,7 @@ TEST(UnitTime, Abbreviation) {
   EXPECT_EQ(Abbreviation(Time::Second), "s");
   EXPECT_EQ(Abbreviation(Time::Minute), "min");
   EXPECT_EQ(Abbreviation(Time::Hour), "hr");
+  static_assert(Abbreviation(Time::Hour) == "hr");
 }
 
 TEST(UnitTime, ConsistentUnit) {
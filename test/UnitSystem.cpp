@@ -27,6 +27,7 @@
 #include <gtest/gtest.h>
 #include <optional>
 #include <sstream>
+#include <string_view>
 
 #include "../include/PhQ/Base.hpp"
 
@@ -37,6 +38,24 @@ TEST(UnitSystem, Abbreviation) {
   EXPECT_EQ(PhQ::Abbreviation(PhQ::UnitSystem::MillimetreGramSecondKelvin), "mm·g·s·K");
   EXPECT_EQ(PhQ::Abbreviation(PhQ::UnitSystem::FootPoundSecondRankine), "ft·lbf·s·°R");
   EXPECT_EQ(PhQ::Abbreviation(PhQ::UnitSystem::InchPoundSecondRankine), "in·lbf·s·°R");
+  static_assert(PhQ::Abbreviation(PhQ::UnitSystem::FootPoundSecondRankine) == "ft·lbf·s·°R");
+}
+
+TEST(UnitSystem, ConstantInitializedTables) {
+  static_assert(PhQ::Internal::IsIndexedByKey(PhQ::Internal::Abbreviations<PhQ::UnitSystem>));
+  static_assert(PhQ::Internal::IsSortedByKey(PhQ::Internal::Spellings<PhQ::UnitSystem>));
+  static_assert(PhQ::Internal::Find(PhQ::Internal::Abbreviations<PhQ::UnitSystem>,
+                                    PhQ::UnitSystem::FootPoundSecondRankine)
+                    ->second
+                == "ft·lbf·s·°R");
+  static_assert(PhQ::Internal::Find(PhQ::Internal::Spellings<PhQ::UnitSystem>,
+                                    std::string_view{"mm·g·s·K"})
+                    ->second
+                == PhQ::UnitSystem::MillimetreGramSecondKelvin);
+  static_assert(PhQ::Internal::Find(PhQ::Internal::Spellings<PhQ::UnitSystem>,
+                                    std::string_view{"Hello world!"})
+                == nullptr);
+  EXPECT_TRUE(PhQ::Internal::IsSortedByKey(PhQ::Internal::Spellings<PhQ::UnitSystem>));
 }
 
 TEST(UnitSystem, ParseEnumeration) {
@@ -28,6 +28,7 @@
 #include <functional>
 #include <gtest/gtest.h>
 #include <sstream>
+#include <string>
 #include <utility>
 
 #include "../include/PhQ/Base.hpp"
@@ -469,6 +470,13 @@ TEST(Vector, JSON) {
             "{\"x\":" + Print(1.0) + ",\"y\":" + Print(-2.0) + ",\"z\":" + Print(3.0) + "}");
   EXPECT_EQ(Vector(1.0L, -2.0L, 3.0L).JSON(),
             "{\"x\":" + Print(1.0L) + ",\"y\":" + Print(-2.0L) + ",\"z\":" + Print(3.0L) + "}");
+  const Vector vector(1.0F, -2.0F, 3.0F);
+  std::string string{"prefix:"};
+  vector.AppendJSON(string);
+  EXPECT_EQ(string, R"(prefix:{"x":1.000000000,"y":-2.000000000,"z":3.000000000})");
+  char buffer[64];
+  char* const end{vector.WriteJSON(buffer)};
+  EXPECT_EQ(std::string(buffer, end), R"({"x":1.000000000,"y":-2.000000000,"z":3.000000000})");
 }
 
 TEST(Vector, Magnitude) {
@@ -674,6 +682,13 @@ TEST(Vector, XML) {
             "<x>" + Print(1.0) + "</x><y>" + Print(-2.0) + "</y><z>" + Print(3.0) + "</z>");
   EXPECT_EQ(Vector(1.0L, -2.0L, 3.0L).XML(),
             "<x>" + Print(1.0L) + "</x><y>" + Print(-2.0L) + "</y><z>" + Print(3.0L) + "</z>");
+  const Vector vector(1.0F, -2.0F, 3.0F);
+  std::string string{"prefix:"};
+  vector.AppendXML(string);
+  EXPECT_EQ(string, R"(prefix:<x>1.000000000</x><y>-2.000000000</y><z>3.000000000</z>)");
+  char buffer[64];
+  char* const end{vector.WriteXML(buffer)};
+  EXPECT_EQ(std::string(buffer, end), R"(<x>1.000000000</x><y>-2.000000000</y><z>3.000000000</z>)");
 }
 
 TEST(Vector, YAML) {
@@ -683,6 +698,13 @@ TEST(Vector, YAML) {
             "{x:" + Print(1.0) + ",y:" + Print(-2.0) + ",z:" + Print(3.0) + "}");
   EXPECT_EQ(Vector(1.0L, -2.0L, 3.0L).YAML(),
             "{x:" + Print(1.0L) + ",y:" + Print(-2.0L) + ",z:" + Print(3.0L) + "}");
+  const Vector vector(1.0F, -2.0F, 3.0F);
+  std::string string{"prefix:"};
+  vector.AppendYAML(string);
+  EXPECT_EQ(string, R"(prefix:{x:1.000000000,y:-2.000000000,z:3.000000000})");
+  char buffer[64];
+  char* const end{vector.WriteYAML(buffer)};
+  EXPECT_EQ(std::string(buffer, end), R"({x:1.000000000,y:-2.000000000,z:3.000000000})");
 }
 
 TEST(Vector, Zero) {
@@ -0,0 +1,245 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/VectorField.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "../include/PhQ/Force.hpp"
+#include "../include/PhQ/Position.hpp"
+#include "../include/PhQ/Velocity.hpp"
+
+namespace PhQ {
+
+namespace {
+
+const std::vector<Velocity<>> velocities{
+    Velocity<>({1.0, -2.0, 2.0}, Unit::Speed::MetrePerSecond),
+    Velocity<>({0.0, 0.0, 0.0}, Unit::Speed::MetrePerSecond),
+    Velocity<>({3.0, 4.0, 0.0}, Unit::Speed::KilometrePerSecond),
+    Velocity<>({-6.0, 0.5, 0.25}, Unit::Speed::MetrePerSecond),
+};
+
+TEST(VectorField, AddScaled) {
+  VectorField<Velocity<>> field{velocities};
+  const VectorField<Velocity<>> other{velocities};
+  field.AddScaled(2.0, other);
+  for (std::size_t index = 0; index < velocities.size(); ++index) {
+    EXPECT_EQ(field[index], velocities[index] * 3.0);
+  }
+}
+
+TEST(VectorField, AddScaledToItself) {
+  // Long enough to be processed with SIMD instructions.
+  std::vector<Velocity<>> many;
+  for (std::size_t repetition = 0; repetition < 25; ++repetition) {
+    many.insert(many.end(), velocities.begin(), velocities.end());
+  }
+  VectorField<Velocity<>> field{many};
+  field.AddScaled(2.0, field);
+  VectorField<Velocity<>> sum{many};
+  sum += sum;
+  VectorField<Velocity<>> difference{many};
+  difference -= difference;
+  for (std::size_t index = 0; index < many.size(); ++index) {
+    EXPECT_EQ(field[index], many[index] * 3.0);
+    EXPECT_EQ(sum[index], many[index] * 2.0);
+    EXPECT_EQ(difference[index], Velocity<>::Zero());
+  }
+}
+
+TEST(VectorField, Alignment) {
+  const VectorField<Velocity<>> field{velocities};
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(field.x()) % Internal::FieldAlignment, 0);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(field.y()) % Internal::FieldAlignment, 0);
+  EXPECT_EQ(reinterpret_cast<std::uintptr_t>(field.z()) % Internal::FieldAlignment, 0);
+}
+
+TEST(VectorField, ArithmeticOperators) {
+  const VectorField<Velocity<>> field{velocities};
+  const VectorField<Velocity<>> sum{field + field};
+  const VectorField<Velocity<>> difference{field - field};
+  const VectorField<Velocity<>> product{field * 2.0};
+  const VectorField<Velocity<>> reversed_product{2.0 * field};
+  const VectorField<Velocity<>> quotient{field / 2.0};
+  for (std::size_t index = 0; index < velocities.size(); ++index) {
+    EXPECT_EQ(sum[index], velocities[index] + velocities[index]);
+    EXPECT_EQ(difference[index], Velocity<>::Zero());
+    EXPECT_EQ(product[index], velocities[index] * 2.0);
+    EXPECT_EQ(reversed_product[index], velocities[index] * 2.0);
+    EXPECT_EQ(quotient[index], velocities[index] / 2.0);
+  }
+}
+
+TEST(VectorField, ComparisonOperators) {
+  const VectorField<Velocity<>> first{velocities};
+  VectorField<Velocity<>> second{velocities};
+  EXPECT_EQ(first, second);
+  second[1] = Velocity<>({1.0, 0.0, 0.0}, Unit::Speed::MetrePerSecond);
+  EXPECT_NE(first, second);
+}
+
+TEST(VectorField, Components) {
+  const VectorField<Velocity<>> field{velocities};
+  EXPECT_EQ(field.x()[2], 3000.0);
+  EXPECT_EQ(field.y()[2], 4000.0);
+  EXPECT_EQ(field.z()[3], 0.25);
+}
+
+TEST(VectorField, Constructors) {
+  const VectorField<Velocity<>> empty;
+  EXPECT_TRUE(empty.Empty());
+  const VectorField<Velocity<>> zeros(3);
+  EXPECT_EQ(zeros.Size(), 3);
+  EXPECT_EQ(zeros[2], Velocity<>::Zero());
+  const VectorField<Velocity<>> copies(2, velocities[0]);
+  EXPECT_EQ(copies[1], velocities[0]);
+  const VectorField<Velocity<>> field{velocities.data(), velocities.size()};
+  EXPECT_EQ(field.Quantities(), velocities);
+}
+
+TEST(VectorField, Cross) {
+  const VectorField<Position<>> positions{std::vector{
+      Position<>({1.0, 0.0, 0.0}, Unit::Length::Metre),
+      Position<>({1.0, 2.0, 3.0}, Unit::Length::Metre),
+  }};
+  const VectorField<Force<>> forces{std::vector{
+      Force<>({0.0, 1.0, 0.0}, Unit::Force::Newton),
+      Force<>({-4.0, 5.0, 6.0}, Unit::Force::Newton),
+  }};
+  const VectorField<Vector<>> moments{positions.Cross(forces)};
+  EXPECT_EQ(moments[0], Vector<>(0.0, 0.0, 1.0));
+  EXPECT_EQ(moments[1], Vector<>(1.0, 2.0, 3.0).Cross(Vector<>(-4.0, 5.0, 6.0)));
+  const VectorField<Vector<>> crossed{positions.Cross(Vector<>(0.0, 0.0, 2.0))};
+  EXPECT_EQ(crossed[1], Vector<>(1.0, 2.0, 3.0).Cross(Vector<>(0.0, 0.0, 2.0)));
+}
+
+TEST(VectorField, Direction) {
+  const VectorField<Velocity<>> field{velocities};
+  const VectorField<Direction<>> directions{field.Direction()};
+  ASSERT_EQ(directions.Size(), velocities.size());
+  for (std::size_t index = 0; index < velocities.size(); ++index) {
+    const Direction<> expected{velocities[index].Direction()};
+    EXPECT_DOUBLE_EQ(directions.x()[index], expected.x());
+    EXPECT_DOUBLE_EQ(directions.y()[index], expected.y());
+    EXPECT_DOUBLE_EQ(directions.z()[index], expected.z());
+  }
+  EXPECT_EQ(directions[1], Direction<>::Zero());
+}
+
+TEST(VectorField, Dot) {
+  const VectorField<Velocity<>> field{velocities};
+  const std::vector<double> squares{field.Dot(field)};
+  const std::vector<double> projections{field.Dot(Direction<>(0.0, 1.0, 0.0))};
+  const std::vector<double> products{field.Dot(Vector<>(1.0, 1.0, 1.0))};
+  for (std::size_t index = 0; index < velocities.size(); ++index) {
+    EXPECT_EQ(squares[index], velocities[index].Value().MagnitudeSquared());
+    EXPECT_EQ(projections[index], velocities[index].Value().y());
+    EXPECT_EQ(products[index], velocities[index].Value().Dot(Vector<>(1.0, 1.0, 1.0)));
+  }
+}
+
+TEST(VectorField, LargeField) {
+  // The components are not exactly representable, so a fused multiply-add in the vectorized
+  // kernels would round differently from the element-wise operations. The directions are the
+  // exception: -ffast-math lets the compiler replace a division by a multiplication by a
+  // reciprocal wherever it sees fit, so they only agree to within one unit in the last place.
+  std::vector<Velocity<>> many;
+  std::vector<Velocity<>> others;
+  for (std::size_t index = 0; index < 1001; ++index) {
+    const double value{0.0123 * static_cast<double>(index) - 4.5};
+    many.emplace_back(Vector<>{value, -0.7 * value, 2.1}, Unit::Speed::MetrePerSecond);
+    others.emplace_back(Vector<>{1.9, value, 0.3 * value}, Unit::Speed::MetrePerSecond);
+  }
+  const VectorField<Velocity<>> field{many};
+  const std::vector<Speed<>> speeds{field.Magnitude()};
+  const std::vector<double> squares{field.Dot(field)};
+  const VectorField<Direction<>> directions{field.Direction()};
+  VectorField<Velocity<>> scaled{many};
+  scaled.AddScaled(0.3, VectorField<Velocity<>>{others});
+  for (std::size_t index = 0; index < many.size(); ++index) {
+    EXPECT_EQ(speeds[index], many[index].Magnitude());
+    EXPECT_EQ(squares[index], many[index].Value().MagnitudeSquared());
+    const Direction<> expected{many[index].Direction()};
+    EXPECT_NEAR(directions.x()[index], expected.x(), std::abs(expected.x()) * 2.3E-16);
+    EXPECT_NEAR(directions.y()[index], expected.y(), std::abs(expected.y()) * 2.3E-16);
+    EXPECT_NEAR(directions.z()[index], expected.z(), std::abs(expected.z()) * 2.3E-16);
+    EXPECT_EQ(scaled[index], many[index] + 0.3 * others[index]);
+  }
+}
+
+TEST(VectorField, Magnitude) {
+  const VectorField<Velocity<>> field{velocities};
+  const std::vector<Speed<>> speeds{field.Magnitude()};
+  ASSERT_EQ(speeds.size(), velocities.size());
+  EXPECT_EQ(speeds[0], Speed<>(3.0, Unit::Speed::MetrePerSecond));
+  EXPECT_EQ(speeds[1], Speed<>::Zero());
+  EXPECT_EQ(speeds[2], Speed<>(5.0, Unit::Speed::KilometrePerSecond));
+  std::vector<Speed<>> output(velocities.size(), Speed<>::Zero());
+  field.Magnitude(output.data());
+  EXPECT_EQ(output, speeds);
+}
+
+TEST(VectorField, Modifiers) {
+  VectorField<Velocity<>> field;
+  field.Reserve(2);
+  field.PushBack(velocities[0]);
+  field.PushBack(velocities[2]);
+  EXPECT_EQ(field.Size(), 2);
+  EXPECT_EQ(field[1], velocities[2]);
+  field.Resize(3);
+  EXPECT_EQ(field[2], Velocity<>::Zero());
+  field.Clear();
+  EXPECT_TRUE(field.Empty());
+}
+
+TEST(VectorField, Reference) {
+  VectorField<Velocity<>> field{velocities};
+  const Velocity<> velocity{field[0]};
+  EXPECT_EQ(velocity, velocities[0]);
+  EXPECT_EQ(field[0].Value(), velocities[0].Value());
+  EXPECT_EQ(field[0].Magnitude(), velocities[0].Magnitude());
+  EXPECT_EQ(field[2].Direction(), velocities[2].Direction());
+  field[1] = velocities[3];
+  EXPECT_EQ(field[1], velocities[3]);
+  field[1] = field[0];
+  EXPECT_EQ(velocities[0], field[1]);
+  field[0] += velocities[0];
+  EXPECT_EQ(field[0], velocities[0] * 2.0);
+  field[0] -= velocities[0];
+  EXPECT_EQ(field[0], velocities[0]);
+  field[0] *= 4.0;
+  EXPECT_EQ(field[0], velocities[0] * 4.0);
+  field[0] /= 4.0;
+  EXPECT_EQ(field[0], velocities[0]);
+  EXPECT_NE(field[0], velocities[2]);
+}
+
+}  // namespace
+
+}  // namespace PhQ
@@ -29,6 +29,7 @@
 #include <gtest/gtest.h>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #include "../include/PhQ/Angle.hpp"
 #include "../include/PhQ/Direction.hpp"
@@ -276,6 +277,15 @@ TEST(Velocity, SetValue) {
   EXPECT_EQ(velocity.Value(), Vector(-4.0, 5.0, -6.0));
 }
 
+TEST(Velocity, SetValues) {
+  const std::vector<Vector<>> values{{1.0, -2.0, 3.0}, {-4.0, 5.0, -6.0}};
+  std::vector<Velocity<>> velocities;
+  SetValues(values, Unit::Speed::MillimetrePerSecond, velocities);
+  ASSERT_EQ(velocities.size(), 2);
+  EXPECT_EQ(velocities[0], Velocity({1.0, -2.0, 3.0}, Unit::Speed::MillimetrePerSecond));
+  EXPECT_EQ(velocities[1], Velocity({-4.0, 5.0, -6.0}, Unit::Speed::MillimetrePerSecond));
+}
+
 TEST(Velocity, SizeOf) {
   EXPECT_EQ(sizeof(Velocity<>{}), 3 * sizeof(double));
 }
@@ -305,6 +315,18 @@ TEST(Velocity, Value) {
             Vector(1.0, -2.0, 3.0));
 }
 
+TEST(Velocity, Values) {
+  const std::vector<Velocity<>> velocities{
+      Velocity({1.0, -2.0, 3.0}, Unit::Speed::MetrePerSecond),
+      Velocity({-4.0, 5.0, -6.0}, Unit::Speed::MetrePerSecond),
+  };
+  const std::vector<Vector<>> values{Values(velocities, Unit::Speed::MillimetrePerSecond)};
+  ASSERT_EQ(values.size(), 2);
+  EXPECT_EQ(values[0], velocities[0].Value(Unit::Speed::MillimetrePerSecond));
+  EXPECT_EQ(values[1], velocities[1].Value(Unit::Speed::MillimetrePerSecond));
+  EXPECT_EQ(Values(velocities, Unit::Speed::MetrePerSecond)[1], velocities[1].Value());
+}
+
 TEST(Velocity, XML) {
   EXPECT_EQ(Velocity({1.0, -2.0, 3.0}, Unit::Speed::MetrePerSecond).XML(),
             "<value><x>" + Print(1.0) + "</x><y>" + Print(-2.0) + "</y><z>" + Print(3.0)
@@ -29,6 +29,7 @@
 #include <gtest/gtest.h>
 #include <sstream>
 #include <utility>
+#include <vector>
 
 #include "../include/PhQ/DisplacementGradient.hpp"
 #include "../include/PhQ/Dyad.hpp"
@@ -362,6 +363,22 @@ TEST(VelocityGradient, SetValue) {
             Dyad(-10.10, 11.0, -12.12, 13.13, -14.14, 15.15, -16.16, 17.17, -18.18));
 }
 
+TEST(VelocityGradient, SetValues) {
+  const std::vector<Dyad<>> values{
+      {1.0, -2.0, 3.0, -4.0, 5.0, -6.0, 7.0, -8.0, 9.0},
+      {-10.0, 11.0, -12.0, 13.0, -14.0, 15.0, -16.0, 17.0, -18.0},
+  };
+  std::vector<VelocityGradient<>> velocity_gradients;
+  SetValues(values, Unit::Frequency::Kilohertz, velocity_gradients);
+  ASSERT_EQ(velocity_gradients.size(), 2);
+  EXPECT_EQ(velocity_gradients[0],
+            VelocityGradient({1.0, -2.0, 3.0, -4.0, 5.0, -6.0, 7.0, -8.0, 9.0},
+                             Unit::Frequency::Kilohertz));
+  EXPECT_EQ(velocity_gradients[1],
+            VelocityGradient({-10.0, 11.0, -12.0, 13.0, -14.0, 15.0, -16.0, 17.0, -18.0},
+                             Unit::Frequency::Kilohertz));
+}
+
 TEST(VelocityGradient, SizeOf) {
   EXPECT_EQ(sizeof(VelocityGradient<>{}), 9 * sizeof(double));
 }
@@ -395,6 +412,19 @@ TEST(VelocityGradient, Value) {
             Dyad(1.0, -2.0, 3.0, -4.0, 5.0, -6.0, 7.0, -8.0, 9.0));
 }
 
+TEST(VelocityGradient, Values) {
+  const std::vector<VelocityGradient<>> velocity_gradients{
+      VelocityGradient({1.0, -2.0, 3.0, -4.0, 5.0, -6.0, 7.0, -8.0, 9.0}, Unit::Frequency::Hertz),
+      VelocityGradient(
+          {-10.0, 11.0, -12.0, 13.0, -14.0, 15.0, -16.0, 17.0, -18.0}, Unit::Frequency::Hertz),
+  };
+  const std::vector<Dyad<>> values{Values(velocity_gradients, Unit::Frequency::Kilohertz)};
+  ASSERT_EQ(values.size(), 2);
+  EXPECT_EQ(values[0], velocity_gradients[0].Value(Unit::Frequency::Kilohertz));
+  EXPECT_EQ(values[1], velocity_gradients[1].Value(Unit::Frequency::Kilohertz));
+  EXPECT_EQ(Values(velocity_gradients, Unit::Frequency::Hertz)[1], velocity_gradients[1].Value());
+}
+
 TEST(VelocityGradient, XML) {
   EXPECT_EQ(
       VelocityGradient({1.0, -2.0, 3.0, -4.0, 5.0, -6.0, 7.0, -8.0, 9.0}, Unit::Frequency::Hertz)
@@ -0,0 +1,199 @@
+// Copyright © 2020-2024 Alexandre Coderre-Chabot
+//
+// This file is part of Physical Quantities (PhQ), a C++ library of physical quantities, physical
+// models, and units of measure for scientific computing.
+//
+// Physical Quantities is hosted at:
+//     https://github.com/acodcha/phq
+//
+// Physical Quantities is licensed under the MIT License:
+//     https://mit-license.org
+//
+// Permission is hereby granted, free of charge, to any person obtaining a copy of this software and
+// associated documentation files (the "Software"), to deal in the Software without restriction,
+// including without limitation the rights to use, copy, modify, merge, publish, distribute,
+// sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is
+// furnished to do so, subject to the following conditions:
+//   - The above copyright notice and this permission notice shall be included in all copies or
+//     substantial portions of the Software.
+//   - THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING
+//     BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+//     NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM,
+//     DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM
+//     OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+#include "../include/PhQ/Writer.hpp"
+
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "../include/PhQ/PlanarVelocity.hpp"
+#include "../include/PhQ/Stress.hpp"
+#include "../include/PhQ/Temperature.hpp"
+#include "../include/PhQ/Velocity.hpp"
+#include "../include/PhQ/VelocityGradient.hpp"
+
+namespace PhQ {
+
+namespace {
+
+const std::vector<Velocity<>> velocities{
+    Velocity<>({1.0, -2.0, 3.0}, Unit::Speed::MetrePerSecond),
+    Velocity<>({0.125, 1000.0, -0.001}, Unit::Speed::MetrePerSecond),
+    Velocity<>({4.0, 5.0, 6.0}, Unit::Speed::KilometrePerSecond),
+};
+
+TEST(Writer, CSV) {
+  std::ostringstream stream;
+  {
+    Writer<Velocity<>> writer{stream, WriterFormat::CSV};
+    writer.Write(velocities);
+  }
+  std::string expected{"x [m/s],y [m/s],z [m/s]\n"};
+  for (const Velocity<>& velocity : velocities) {
+    expected.append(Print(velocity.Value().x())).append(",");
+    expected.append(Print(velocity.Value().y())).append(",");
+    expected.append(Print(velocity.Value().z())).append("\n");
+  }
+  EXPECT_EQ(stream.str(), expected);
+}
+
+TEST(Writer, CSVScalar) {
+  std::ostringstream stream;
+  {
+    Writer<Temperature<>> writer{stream, WriterFormat::CSV, Unit::Temperature::Celsius};
+    writer.Write(Temperature(300.0, Unit::Temperature::Kelvin));
+  }
+  EXPECT_EQ(stream.str(), "value [°C]\n"
+                              + Print(Temperature(300.0, Unit::Temperature::Kelvin)
+                                          .Value(Unit::Temperature::Celsius))
+                              + "\n");
+}
+
+TEST(Writer, Close) {
+  std::ostringstream stream;
+  Writer<Velocity<>> writer{stream, WriterFormat::JSONArray};
+  writer.Write(velocities[0]);
+  writer.Close();
+  writer.Write(velocities[1]);
+  writer.Close();
+  EXPECT_EQ(stream.str(), "[" + velocities[0].JSON() + "]\n");
+  EXPECT_EQ(writer.Count(), 1);
+  EXPECT_TRUE(writer.Good());
+}
+
+TEST(Writer, Count) {
+  std::ostringstream stream;
+  Writer<Velocity<>> writer{stream, WriterFormat::NDJSON};
+  EXPECT_EQ(writer.Count(), 0);
+  writer.Write(velocities.cbegin(), velocities.cend());
+  EXPECT_EQ(writer.Count(), 3);
+  writer.Write(velocities[0]);
+  EXPECT_EQ(writer.Count(), 4);
+}
+
+#if __has_include(<unistd.h>)
+
+TEST(Writer, FileDescriptor) {
+  std::FILE* const file{std::tmpfile()};
+  ASSERT_NE(file, nullptr);
+  {
+    Writer<Stress<>> writer{fileno(file), WriterFormat::NDJSON, Unit::Pressure::Kilopascal};
+    writer.Write(Stress<>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}, Unit::Pressure::Kilopascal));
+    EXPECT_TRUE(writer.Good());
+  }
+  std::rewind(file);
+  std::string contents;
+  char buffer[256];
+  for (std::size_t size = std::fread(buffer, 1, sizeof(buffer), file); size > 0;
+       size = std::fread(buffer, 1, sizeof(buffer), file)) {
+    contents.append(buffer, size);
+  }
+  std::fclose(file);
+  EXPECT_EQ(contents,
+            Stress<>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0}, Unit::Pressure::Kilopascal)
+                    .JSON(Unit::Pressure::Kilopascal)
+                + "\n");
+}
+
+#endif  // __has_include(<unistd.h>)
+
+TEST(Writer, Good) {
+  std::ostringstream stream;
+  stream.setstate(std::ios_base::badbit);
+  Writer<Velocity<>> writer{stream, WriterFormat::NDJSON};
+  writer.Write(velocities);
+  EXPECT_TRUE(writer.Good());
+  writer.Flush();
+  EXPECT_FALSE(writer.Good());
+}
+
+TEST(Writer, JSONArray) {
+  std::ostringstream stream;
+  {
+    Writer<Velocity<>> writer{stream, WriterFormat::JSONArray};
+    writer.Write(velocities);
+  }
+  EXPECT_EQ(stream.str(), "[" + velocities[0].JSON() + "," + velocities[1].JSON() + ","
+                              + velocities[2].JSON() + "]\n");
+}
+
+TEST(Writer, JSONArrayEmpty) {
+  std::ostringstream stream;
+  {
+    const Writer<Velocity<>> writer{stream, WriterFormat::JSONArray};
+  }
+  EXPECT_EQ(stream.str(), "[]\n");
+}
+
+TEST(Writer, NDJSON) {
+  std::ostringstream stream;
+  {
+    Writer<PlanarVelocity<>> writer{stream, WriterFormat::NDJSON};
+    writer.Write(PlanarVelocity<>({1.0, -2.0}, Unit::Speed::MetrePerSecond));
+    writer.Write(PlanarVelocity<>({3.0, 4.0}, Unit::Speed::MetrePerSecond));
+  }
+  EXPECT_EQ(stream.str(), PlanarVelocity<>({1.0, -2.0}, Unit::Speed::MetrePerSecond).JSON() + "\n"
+                              + PlanarVelocity<>({3.0, 4.0}, Unit::Speed::MetrePerSecond).JSON()
+                              + "\n");
+}
+
+TEST(Writer, NDJSONUnit) {
+  std::ostringstream stream;
+  {
+    Writer<Velocity<>> writer{stream, WriterFormat::NDJSON, Unit::Speed::KilometrePerHour};
+    writer.Write(velocities);
+  }
+  std::string expected;
+  for (const Velocity<>& velocity : velocities) {
+    expected.append(velocity.JSON(Unit::Speed::KilometrePerHour)).append("\n");
+  }
+  EXPECT_EQ(stream.str(), expected);
+}
+
+TEST(Writer, SmallBuffer) {
+  const std::vector<VelocityGradient<>> velocity_gradients(
+      100, VelocityGradient<>({1.0, 2.0, 3.0, 4.0, 5.0, 6.0, 7.0, 8.0, 9.0},
+                              Unit::Frequency::Hertz));
+  std::ostringstream stream;
+  {
+    Writer<VelocityGradient<>> writer{stream, WriterFormat::JSONArray, 1};
+    writer.Write(velocity_gradients);
+  }
+  std::string expected{"["};
+  for (const VelocityGradient<>& velocity_gradient : velocity_gradients) {
+    if (expected.size() > 1) {
+      expected.append(",");
+    }
+    expected.append(velocity_gradient.JSON());
+  }
+  expected.append("]\n");
+  EXPECT_EQ(stream.str(), expected);
+}
+
+}  // namespace
+
+}  // namespace PhQ